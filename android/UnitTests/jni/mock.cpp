@@ -216,9 +216,9 @@ void AndroidThreadDetachFromJVM()
   LOG(LWARNING, ("AndroidThreadDetachFromJVM() is not implemented."));
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
-  LOG(LWARNING, ("Platform::RunOnGuiThread() is not implemented."));
+  LOG(LWARNING, ("Platform::PostGuiThreadTask() is not implemented."));
 }
 
 Platform::EConnectionType Platform::ConnectionStatus()
@@ -36,7 +36,7 @@ string Platform::GetMemoryInfo() const
   return jni::ToNativeString(env, memInfoString);
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   android::Platform::Instance().RunOnGuiThread(fn);
 }
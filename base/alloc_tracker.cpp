@@ -0,0 +1,128 @@
+#include "base/alloc_tracker.hpp"
+
+#include "base/assert.hpp"
+#include "base/macros.hpp"
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+namespace my
+{
+namespace
+{
+// Which subsystem allocations on this thread are charged to.
+thread_local AllocTracker::Subsystem t_subsystem = AllocTracker::SubsystemOther;
+
+char const * const kSubsystemNames[] = {"Other", "Search", "Routing", "Rendering"};
+static_assert(ARRAY_SIZE(kSubsystemNames) == AllocTracker::SubsystemsCount, "");
+}  // namespace
+
+// static
+AllocTracker & AllocTracker::Instance()
+{
+  static AllocTracker instance;
+  return instance;
+}
+
+void AllocTracker::OnAlloc(size_t bytes)
+{
+  Counters & counters = m_counters[t_subsystem];
+  counters.m_allocs += 1;
+  counters.m_bytes += bytes;
+}
+
+AverageStats<double> AllocTracker::GetStats(Subsystem subsystem) const
+{
+  ASSERT_LESS(subsystem, SubsystemsCount, ());
+  Counters const & counters = m_counters[subsystem];
+  return AverageStats<double>(static_cast<uint32_t>(counters.m_allocs.load()),
+                              static_cast<double>(counters.m_bytes.load()));
+}
+
+std::string AllocTracker::Dump() const
+{
+  std::ostringstream ss;
+  ss << "Heap allocations by subsystem:\n";
+  for (int subsystem = 0; subsystem < SubsystemsCount; ++subsystem)
+  {
+    ss << " " << kSubsystemNames[subsystem] << ": "
+       << GetStats(static_cast<Subsystem>(subsystem)).GetStatsStr()
+       << " total " << m_counters[subsystem].m_bytes / 1024 << " KB\n";
+  }
+  return ss.str();
+}
+
+void AllocTracker::Reset()
+{
+  for (auto & counters : m_counters)
+  {
+    counters.m_allocs = 0;
+    counters.m_bytes = 0;
+  }
+}
+
+// static
+char const * AllocTracker::GetSubsystemName(Subsystem subsystem)
+{
+  ASSERT_LESS(subsystem, SubsystemsCount, ());
+  return kSubsystemNames[subsystem];
+}
+
+AllocTracker::Scope::Scope(Subsystem subsystem) : m_prev(t_subsystem)
+{
+  t_subsystem = subsystem;
+}
+
+AllocTracker::Scope::~Scope()
+{
+  t_subsystem = m_prev;
+}
+
+}  // namespace my
+
+#ifdef TRACK_ALLOCATIONS
+
+// The overrides only count and delegate to malloc/free; OnAlloc does
+// atomic additions and cannot recurse into operator new.
+
+void * operator new(size_t size)
+{
+  void * p = malloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  my::AllocTracker::Instance().OnAlloc(size);
+  return p;
+}
+
+void * operator new[](size_t size)
+{
+  void * p = malloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  my::AllocTracker::Instance().OnAlloc(size);
+  return p;
+}
+
+void * operator new(size_t size, std::nothrow_t const &) noexcept
+{
+  void * p = malloc(size);
+  if (p != nullptr)
+    my::AllocTracker::Instance().OnAlloc(size);
+  return p;
+}
+
+void * operator new[](size_t size, std::nothrow_t const &) noexcept
+{
+  void * p = malloc(size);
+  if (p != nullptr)
+    my::AllocTracker::Instance().OnAlloc(size);
+  return p;
+}
+
+void operator delete(void * p) noexcept { free(p); }
+void operator delete[](void * p) noexcept { free(p); }
+void operator delete(void * p, std::nothrow_t const &) noexcept { free(p); }
+void operator delete[](void * p, std::nothrow_t const &) noexcept { free(p); }
+
+#endif  // TRACK_ALLOCATIONS
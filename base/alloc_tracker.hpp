@@ -0,0 +1,79 @@
+#pragma once
+
+#include "base/stats.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Opt-in attribution of heap churn to subsystems. When enabled, global
+// operator new is overridden to charge every allocation to the
+// subsystem scope active on the calling thread, so sustained churn seen
+// on user devices can be pinned to a pipeline without external tooling.
+// Disabled by default: the override intercepts every allocation in the
+// process, so it is a diagnostics build mode, not a shipping one.
+//#define TRACK_ALLOCATIONS
+
+namespace my
+{
+
+class AllocTracker
+{
+public:
+  enum Subsystem
+  {
+    SubsystemOther = 0,  // allocations outside any scope
+    SubsystemSearch,
+    SubsystemRouting,
+    SubsystemRendering,
+
+    SubsystemsCount
+  };
+
+  static AllocTracker & Instance();
+
+  /// Charges an allocation to the subsystem scope active on this
+  /// thread. Must not allocate - it runs inside operator new.
+  void OnAlloc(size_t bytes);
+
+  /// Totals as the common stats machinery: N is the number of
+  /// allocations, Av is the average allocation size in bytes.
+  AverageStats<double> GetStats(Subsystem subsystem) const;
+  std::string Dump() const;
+  /// Drops the accumulated counters, e.g. between measured scenarios.
+  void Reset();
+
+  static char const * GetSubsystemName(Subsystem subsystem);
+
+  /// RAII marker: allocations on this thread are charged to |subsystem|
+  /// while the scope is alive. Nested scopes restore the previous one.
+  class Scope
+  {
+  public:
+    explicit Scope(Subsystem subsystem);
+    ~Scope();
+
+  private:
+    Subsystem const m_prev;
+  };
+
+private:
+  AllocTracker() = default;
+
+  struct Counters
+  {
+    std::atomic<uint64_t> m_allocs{0};
+    std::atomic<uint64_t> m_bytes{0};
+  };
+
+  Counters m_counters[SubsystemsCount];
+};
+
+}  // namespace my
+
+#ifdef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS_SCOPE(subsystem) my::AllocTracker::Scope allocTrackerScope(subsystem)
+#else
+#define TRACK_ALLOCATIONS_SCOPE(subsystem)
+#endif
@@ -8,11 +8,14 @@ ROOT_DIR = ..
 include($$ROOT_DIR/common.pri)
 
 SOURCES += \
+    alloc_tracker.cpp \
     base.cpp \
+    buffered_logging.cpp \
     condition.cpp \
     deferred_task.cpp \
     exception.cpp \
     gmtime.cpp \
+    interned_string.cpp \
     internal/message.cpp \
     levenshtein_dfa.cpp \
     logging.cpp \
@@ -21,6 +24,7 @@ SOURCES += \
     random.cpp \
     shared_buffer_manager.cpp \
     src_point.cpp \
+    startup_tracer.cpp \
     string_format.cpp \
     string_utils.cpp \
     strings_bundle.cpp \
@@ -32,14 +36,18 @@ SOURCES += \
     timegm.cpp \
     timer.cpp \
     uni_string_dfa.cpp \
+    work_stealing_thread_pool.cpp \
 
 HEADERS += \
     SRC_FIRST.hpp \
+    alloc_tracker.hpp \
     array_adapters.hpp \
     assert.hpp \
     base.hpp \
     bits.hpp \
     buffer_vector.hpp \
+    buffer_vector_telemetry.hpp \
+    buffered_logging.hpp \
     cache.hpp \
     cancellable.hpp \
     checked_cast.hpp \
@@ -49,6 +57,7 @@ HEADERS += \
     dfa_helpers.hpp \
     exception.hpp \
     gmtime.hpp \
+    interned_string.hpp \
     internal/message.hpp \
     levenshtein_dfa.hpp \
     limited_priority_queue.hpp \
@@ -70,6 +79,7 @@ HEADERS += \
     shared_buffer_manager.hpp \
     small_set.hpp \
     src_point.hpp \
+    startup_tracer.hpp \
     stats.hpp \
     std_serialization.hpp \
     stl_add.hpp \
@@ -88,3 +98,4 @@ HEADERS += \
     timegm.hpp \
     timer.hpp \
     uni_string_dfa.hpp \
+    work_stealing_thread_pool.hpp \
@@ -27,6 +27,7 @@ SOURCES += \
   math_test.cpp \
   matrix_test.cpp \
   mem_trie_test.cpp \
+  interned_string_test.cpp \
   observer_list_test.cpp \
   range_iterator_test.cpp \
   ref_counted_tests.cpp \
@@ -34,6 +35,7 @@ SOURCES += \
   rolling_hash_test.cpp \
   scope_guard_test.cpp \
   small_set_test.cpp \
+  startup_tracer_test.cpp \
   stl_add_test.cpp \
   stl_helpers_test.cpp \
   string_format_test.cpp \
@@ -46,6 +46,26 @@ UNIT_TEST(PopcountArray32)
 UNIT_TEST(Select1Test)
 {
   TEST_EQUAL(0U, bits::select1(1, 1), ());
+  TEST_EQUAL(1U, bits::select1(0xAAAAAAAAAAAAAAAAULL, 1), ());
+  TEST_EQUAL(63U, bits::select1(0xAAAAAAAAAAAAAAAAULL, 32), ());
+  for (uint32_t i = 0; i < 64; ++i)
+    TEST_EQUAL(i, bits::select1(0xFFFFFFFFFFFFFFFFULL, i + 1), (i));
+  TEST_EQUAL(static_cast<unsigned int>(bits::SELECT1_ERROR), bits::select1(0x1, 2), ());
+}
+
+UNIT_TEST(PopcountArray64)
+{
+  for (uint32_t j = 0; j < 2777; ++j)
+  {
+    std::vector<uint64_t> v(j / 10);
+    for (size_t i = 0; i < v.size(); ++i)
+      v[i] = (static_cast<uint64_t>(rand()) << 32) ^ static_cast<uint64_t>(rand());
+    uint64_t expectedPopCount = 0;
+    for (size_t i = 0; i < v.size(); ++i)
+      expectedPopCount += PopCountSimple(v[i]);
+    TEST_EQUAL(bits::PopCount(v.empty() ? NULL : &v[0], v.size()), expectedPopCount,
+               (j, v.size(), expectedPopCount));
+  }
 }
 
 UNIT_TEST(ROL)
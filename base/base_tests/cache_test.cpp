@@ -180,3 +180,24 @@ UNIT_TEST(Cache_Init)
   TEST_EQUAL(cache.Find(5, found), 'b', ());
   TEST(found, ());
 }
+
+UNIT_TEST(StripedCache_Smoke)
+{
+  my::StripedCache<uint32_t, uint64_t> cache(6); // it contains 2^6=64 elements
+
+  uint64_t value = 0;
+  TEST(!cache.Get(5, [] (uint64_t & v) { v = 42; }, value), ());
+  TEST_EQUAL(value, 42, ());
+
+  // The second lookup is a hit, the init functor is not called.
+  TEST(cache.Get(5, [] (uint64_t & v) { v = 43; }, value), ());
+  TEST_EQUAL(value, 42, ());
+
+  // 2 access, 1 miss.
+  TEST(my::AlmostEqualAbs(0.5, cache.GetCacheMiss(), 1.0E-12), ());
+
+  cache.Reset();
+  TEST(my::AlmostEqualAbs(0.0, cache.GetCacheMiss(), 1.0E-12), ());
+  TEST(!cache.Get(5, [] (uint64_t & v) { v = 44; }, value), ());
+  TEST_EQUAL(value, 44, ());
+}
@@ -0,0 +1,51 @@
+#include "testing/testing.hpp"
+
+#include "base/interned_string.hpp"
+
+#include "std/string.hpp"
+
+UNIT_TEST(InternedString_Sharing)
+{
+  my::StringInternPool & pool = my::StringInternPool::Instance();
+
+  my::InternedString const a = pool.Intern("Leninsky prospekt");
+  my::InternedString const b = pool.Intern("Leninsky prospekt");
+  my::InternedString const c = pool.Intern("Lenina ulitsa");
+
+  TEST_EQUAL(a.Get(), "Leninsky prospekt", ());
+
+  // Equal strings share storage, so handles compare by pointer.
+  TEST(a == b, ());
+  TEST(&a.Get() == &b.Get(), ());
+  TEST(a != c, ());
+}
+
+UNIT_TEST(InternedString_Empty)
+{
+  my::InternedString const def;
+  TEST(def.IsEmpty(), ());
+  TEST_EQUAL(def.Get(), "", ());
+
+  // Empty strings are not pooled.
+  my::InternedString const interned = my::StringInternPool::Instance().Intern("");
+  TEST(interned.IsEmpty(), ());
+  TEST(def == interned, ());
+}
+
+UNIT_TEST(InternedString_Expiration)
+{
+  my::StringInternPool & pool = my::StringInternPool::Instance();
+
+  my::InternedString first = pool.Intern("Krymsky val");
+  string const * p = &first.Get();
+  {
+    my::InternedString const second = pool.Intern("Krymsky val");
+    TEST_EQUAL(p, &second.Get(), ());
+  }
+
+  // The pool holds no strong references: when the last handle dies the
+  // string may be recreated at a different address.
+  first = my::InternedString();
+  my::InternedString const recreated = pool.Intern("Krymsky val");
+  TEST_EQUAL(recreated.Get(), "Krymsky val", ());
+}
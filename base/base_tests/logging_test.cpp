@@ -1,7 +1,10 @@
 #include "testing/testing.hpp"
 
+#include "base/buffered_logging.hpp"
 #include "base/logging.hpp"
+#include "base/thread.hpp"
 
+#include "std/mutex.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
 
@@ -43,3 +46,43 @@ UNIT_TEST(NullMessage)
   char const * ptr = 0;
   LOG(LINFO, ("Null message test", ptr));
 }
+
+namespace
+{
+  mutex g_capturedMutex;
+  vector<string> g_captured;
+
+  void CaptureLogMessage(my::LogLevel, my::SrcPoint const &, string const & msg)
+  {
+    lock_guard<mutex> lock(g_capturedMutex);
+    g_captured.push_back(msg);
+  }
+}
+
+UNIT_TEST(BufferedLogging_Smoke)
+{
+  size_t const kThreadsCount = 4;
+  size_t const kMessagesCount = 100;
+
+  my::LogMessageFn const logMessageSaved = my::SetLogMessageFn(&CaptureLogMessage);
+  my::EnableBufferedLogging();
+
+  vector<threads::SimpleThread> workers;
+  for (size_t i = 0; i < kThreadsCount; ++i)
+  {
+    workers.emplace_back([]()
+    {
+      for (size_t j = 0; j < kMessagesCount; ++j)
+        LOG(LINFO, ("Buffered message", j));
+    });
+  }
+  for (auto & worker : workers)
+    worker.join();
+
+  my::DisableBufferedLogging();
+  my::SetLogMessageFn(logMessageSaved);
+
+  lock_guard<mutex> lock(g_capturedMutex);
+  TEST_EQUAL(g_captured.size(), kThreadsCount * kMessagesCount, ());
+  g_captured.clear();
+}
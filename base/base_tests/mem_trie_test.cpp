@@ -10,9 +10,11 @@
 namespace
 {
 using Trie = my::MemTrie<string, my::VectorValues<int>>;
+using PackedTrie = my::PackedMemTrie<string, my::VectorValues<int>>;
 using Data = std::vector<std::pair<std::string, int>>;
 
-void GetTrieContents(Trie const & trie, Data & data)
+template <typename TrieT>
+void GetTrieContents(TrieT const & trie, Data & data)
 {
   data.clear();
   trie.ForEachInTrie([&data](std::string const & k, int v) { data.emplace_back(k, v); });
@@ -48,4 +50,42 @@ UNIT_TEST(MemTrie_Basic)
   GetTrieContents(newTrie, contents);
   TEST_EQUAL(contents, data, ());
 }
+
+UNIT_TEST(PackedMemTrie_Basic)
+{
+  Data data = {{"roger", 3}, {"amy", 1},   {"emma", 1}, {"ann", 1},
+               {"rob", 1},   {"roger", 2}, {"", 0},     {"roger", 1}};
+  std::sort(data.begin(), data.end());
+
+  PackedTrie trie;
+  TEST_EQUAL(trie.GetNumNodes(), 1, ());
+
+  trie.Assign(data.begin(), data.end());
+  TEST_EQUAL(trie.GetNumNodes(), 16, ());
+
+  Data contents;
+  GetTrieContents(trie, contents);
+  TEST_EQUAL(contents, data, ());
+
+  Data values;
+  trie.ForEachInNode("roger", [&values](std::string const & k, int v) { values.emplace_back(k, v); });
+  Data const expectedValues = {{"roger", 1}, {"roger", 2}, {"roger", 3}};
+  TEST_EQUAL(values, expectedValues, ());
+
+  values.clear();
+  trie.ForEachInSubtree("ro", [&values](std::string const & k, int v) { values.emplace_back(k, v); });
+  std::sort(values.begin(), values.end());
+  Data const expectedSubtree = {{"rob", 1}, {"roger", 1}, {"roger", 2}, {"roger", 3}};
+  TEST_EQUAL(values, expectedSubtree, ());
+
+  PackedTrie newTrie(move(trie));
+
+  TEST_EQUAL(trie.GetNumNodes(), 1, ());
+  GetTrieContents(trie, contents);
+  TEST(contents.empty(), ());
+
+  TEST_EQUAL(newTrie.GetNumNodes(), 16, ());
+  GetTrieContents(newTrie, contents);
+  TEST_EQUAL(contents, data, ());
+}
 }  // namespace
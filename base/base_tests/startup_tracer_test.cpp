@@ -0,0 +1,48 @@
+#include "testing/testing.hpp"
+
+#include "base/startup_tracer.hpp"
+#include "base/stl_add.hpp"
+#include "base/string_utils.hpp"
+
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+UNIT_TEST(StartupTracer_Smoke)
+{
+  my::StartupTracer & tracer = my::StartupTracer::Instance();
+
+  tracer.BeginPhase("outer");
+  {
+    my::StartupTracer::Scope scope("inner");
+  }
+  tracer.EndPhase("outer");
+
+  string const dump = tracer.Dump();
+  TEST(!dump.empty(), ());
+
+  vector<string> lines;
+  strings::Tokenize(dump, "\n", MakeBackInsertFunctor(lines));
+  TEST_EQUAL(lines.size(), 4, ());
+
+  // Each line is "<us>\t<B|E>\t<phase>"; events keep the recording order
+  // and the timestamps do not decrease.
+  int64_t prevTimeUs = 0;
+  char const * const expected[] = {"B\touter", "B\tinner", "E\tinner", "E\touter"};
+  for (size_t i = 0; i < lines.size(); ++i)
+  {
+    size_t const tab = lines[i].find('\t');
+    TEST_NOT_EQUAL(tab, string::npos, (lines[i]));
+
+    int64_t timeUs;
+    TEST(strings::to_int64(lines[i].substr(0, tab), timeUs), (lines[i]));
+    TEST_GREATER_OR_EQUAL(timeUs, prevTimeUs, ());
+    prevTimeUs = timeUs;
+
+    TEST_EQUAL(lines[i].substr(tab + 1), expected[i], ());
+  }
+
+  // The tracer is one-shot: after the dump nothing is recorded.
+  tracer.BeginPhase("late");
+  tracer.EndPhase("late");
+  TEST_EQUAL(tracer.Dump(), "", ());
+}
@@ -3,6 +3,7 @@
 #include "base/mutex.hpp"
 #include "base/thread.hpp"
 #include "base/thread_pool.hpp"
+#include "base/work_stealing_thread_pool.hpp"
 #include "base/condition.hpp"
 
 #include "std/vector.hpp"
@@ -151,3 +152,73 @@ UNIT_TEST(ThreadPool_EmptyTest)
   threads::Sleep(100);
   pool.Stop();
 }
+
+namespace
+{
+  class SimpleTask : public threads::IRoutine
+  {
+  public:
+    SimpleTask(int & counter) : m_counter(counter) {}
+
+    virtual void Do()
+    {
+      threads::MutexGuard guard(g_mutex);
+      ++m_counter;
+    }
+
+  private:
+    int & m_counter;
+  };
+}
+
+UNIT_TEST(WorkStealingThreadPool_ExecutionTest)
+{
+  int doCounter = 0;
+  int finishCounter = 0;
+  threads::Condition cond;
+  threads::WorkStealingThreadPool pool(4, bind(&JoinFinishFunction, _1, ref(finishCounter), ref(cond)));
+
+  for (int i = 0; i < TASK_COUNT; ++i)
+    pool.PushBack(new SimpleTask(doCounter));
+
+  while (true)
+  {
+    threads::ConditionGuard guard(cond);
+    if (finishCounter == TASK_COUNT)
+      break;
+    guard.Wait();
+  }
+
+  threads::MutexGuard guard(g_mutex);
+  TEST_EQUAL(doCounter, TASK_COUNT, ());
+}
+
+UNIT_TEST(WorkStealingThreadPool_CanceledTaskTest)
+{
+  int finishCounter = 0;
+  threads::Condition cond;
+  threads::WorkStealingThreadPool pool(4, bind(&JoinFinishFunction, _1, ref(finishCounter), ref(cond)));
+
+  for (int i = 0; i < TASK_COUNT; ++i)
+    pool.PushBack(new CanceledTask());
+
+  pool.Stop();
+
+  TEST_EQUAL(finishCounter, TASK_COUNT, ());
+}
+
+UNIT_TEST(WorkStealingThreadPool_StopOperationTest)
+{
+  int finishCounter = 0;
+  threads::Condition cond;
+  // As with ThreadPool, an empty pool keeps its tasks queued and all of them
+  // must be finished (cancelled, not executed) on the Stop method call.
+  threads::WorkStealingThreadPool pool(0, bind(&JoinFinishFunction, _1, ref(finishCounter), ref(cond)));
+
+  for (int i = 0; i < TASK_COUNT; ++i)
+    pool.PushBack(new EmptyPoolTask());
+
+  pool.Stop();
+
+  TEST_EQUAL(finishCounter, TASK_COUNT, ());
+}
@@ -7,15 +7,21 @@
 
 namespace bits
 {
-  // Count the number of 1 bits. Implementation: see Hacker's delight book.
+  // Count the number of 1 bits. The compiler builtin maps onto the
+  // hardware popcount where the target has one; the fallback is from
+  // the Hacker's delight book.
   inline uint32_t PopCount(uint32_t x) noexcept
   {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_popcount(x));
+#else
     x -= ((x >> 1) & 0x55555555);
     x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
     x = (x + (x >> 4)) & 0x0F0F0F0F;
     x += (x >> 8);
     x += (x >> 16);
     return x & 0x3F;
+#endif
   }
 
   inline uint32_t PopCount(uint8_t x) noexcept
@@ -48,26 +54,46 @@ namespace bits
     return s;
   }
 
+  // Returns the number of trailing zero bits in x. x must be nonzero.
+  inline uint32_t CountTrailingZeros(uint64_t x) noexcept
+  {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctzll(x));
+#else
+    uint32_t n = 0;
+    while ((x & 1) == 0)
+    {
+      x >>= 1;
+      ++n;
+    }
+    return n;
+#endif
+  }
+
   static const int SELECT1_ERROR = -1;
 
   template <typename T> unsigned int select1(T x, unsigned int i)
   {
-    // TODO: Fast implementation of select1.
     ASSERT(i > 0 && i <= sizeof(T) * 8, (i));
-    for (unsigned int j = 0; j < sizeof(T) * 8; x >>= 1, ++j)
-      if (x & 1)
-        if (--i == 0)
-          return j;
-    return static_cast<unsigned int>(SELECT1_ERROR);
+    // Clear the i-1 lowest set bits, the answer is then the lowest bit left.
+    for (unsigned int j = 1; j < i; ++j)
+      x &= x - 1;
+    if (x == 0)
+      return static_cast<unsigned int>(SELECT1_ERROR);
+    return CountTrailingZeros(static_cast<uint64_t>(x));
   }
 
   inline uint32_t PopCount(uint64_t x) noexcept
   {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_popcountll(x));
+#else
     x = x - ((x & 0xAAAAAAAAAAAAAAAA) >> 1);
     x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
     x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
     x = (x * 0x0101010101010101) >> 56;
     return static_cast<uint32_t>(x);
+#endif
   }
 
   inline uint8_t FloorLog(uint64_t x) noexcept
@@ -91,8 +117,24 @@ namespace bits
     return msb;
   }
 
-  // Will be implemented when needed.
-  uint64_t PopCount(uint64_t const * p, uint64_t n);
+  // Count the number of 1 bits in the array of n 64-bit words. The loop
+  // is unrolled so that compilers can keep several hardware popcounts
+  // in flight (or vectorize it) on targets that support that.
+  inline uint64_t PopCount(uint64_t const * p, uint64_t n)
+  {
+    uint64_t s = 0;
+    uint64_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      s += PopCount(p[i]);
+      s += PopCount(p[i + 1]);
+      s += PopCount(p[i + 2]);
+      s += PopCount(p[i + 3]);
+    }
+    for (; i < n; ++i)
+      s += PopCount(p[i]);
+    return s;
+  }
 
   template <typename T> T RoundLastBitsUpAndShiftRight(T x, T bits)
   {
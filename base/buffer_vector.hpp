@@ -9,6 +9,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef BUFFER_VECTOR_TELEMETRY
+#include "base/buffer_vector_telemetry.hpp"
+#endif
+
 // Calls swap() function using argument dependant lookup.
 // // Do NOT override this function, but override swap() function instead!
 template <typename T> inline void Swap(T & a, T & b)
@@ -108,6 +112,13 @@ public:
     return *this;
   }
 
+#ifdef BUFFER_VECTOR_TELEMETRY
+  ~buffer_vector()
+  {
+    TelemetryStats().RecordDestruction(size());
+  }
+#endif
+
   template <size_t M>
   void append(buffer_vector<value_type, M> const & v)
   {
@@ -420,8 +431,20 @@ public:
   }
 
 private:
+#ifdef BUFFER_VECTOR_TELEMETRY
+  static bv_telemetry::SiteStats & TelemetryStats()
+  {
+    static bv_telemetry::SiteStats & stats =
+        bv_telemetry::Registry::Instance().Register(typeid(T), N);
+    return stats;
+  }
+#endif
+
   void SwitchToDynamic()
   {
+#ifdef BUFFER_VECTOR_TELEMETRY
+    TelemetryStats().RecordSpill();
+#endif
     ASSERT_NOT_EQUAL(m_size, static_cast<size_t>(USE_DYNAMIC), ());
     ASSERT_EQUAL(m_dynamic.size(), 0, ());
     m_dynamic.reserve(m_size);
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+// Opt-in allocation telemetry for buffer_vector, enabled by building with
+// -DBUFFER_VECTOR_TELEMETRY. Every <T, N> instantiation registers itself here
+// and records its spill count (transitions to the dynamic vector) and a log2
+// histogram of sizes at destruction. The report is printed at process exit to
+// stderr, or to the file named by the BUFFER_VECTOR_TELEMETRY_OUT environment
+// variable, and shows which static sizes are too small (high spill rate) or
+// too large (sizes concentrated far below N).
+namespace bv_telemetry
+{
+class SiteStats
+{
+public:
+  static size_t constexpr kBucketsCount = 24;
+
+  void RecordDestruction(size_t size)
+  {
+    m_instances.fetch_add(1, std::memory_order_relaxed);
+    m_sizes[Bucket(size)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordSpill() { m_spills.fetch_add(1, std::memory_order_relaxed); }
+
+  uint64_t GetInstances() const { return m_instances.load(std::memory_order_relaxed); }
+  uint64_t GetSpills() const { return m_spills.load(std::memory_order_relaxed); }
+  uint64_t GetSizeCount(size_t bucket) const
+  {
+    return m_sizes[bucket].load(std::memory_order_relaxed);
+  }
+
+  // Bucket 0 holds empty vectors, bucket i holds sizes [2^(i-1), 2^i).
+  static size_t Bucket(size_t size)
+  {
+    size_t bucket = 0;
+    while (size > 0 && bucket + 1 < kBucketsCount)
+    {
+      ++bucket;
+      size >>= 1;
+    }
+    return bucket;
+  }
+
+private:
+  std::atomic<uint64_t> m_instances{0};
+  std::atomic<uint64_t> m_spills{0};
+  std::atomic<uint64_t> m_sizes[kBucketsCount] = {};
+};
+
+class Registry
+{
+public:
+  static Registry & Instance()
+  {
+    // Deliberately leaked: stats are recorded from destructors of objects with
+    // static storage duration too, and the report itself runs at exit.
+    static Registry * instance = new Registry();
+    return *instance;
+  }
+
+  SiteStats & Register(std::type_info const & type, size_t n)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sites[std::make_pair(std::string(type.name()), n)];
+  }
+
+  void Report(FILE * out)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    fprintf(out, "buffer_vector telemetry: %zu instantiations\n", m_sites.size());
+    fprintf(out, "%-64s %6s %12s %12s %8s  %s\n", "type", "N", "instances", "spills",
+            "spill%", "sizes at destruction (log2 buckets, starting with empty)");
+    for (auto const & site : m_sites)
+    {
+      SiteStats const & stats = site.second;
+      uint64_t const instances = stats.GetInstances();
+      double const spillPercent =
+          instances == 0 ? 0.0 : 100.0 * static_cast<double>(stats.GetSpills()) / instances;
+      fprintf(out, "%-64s %6zu %12llu %12llu %8.2f  ", Demangle(site.first.first).c_str(),
+              site.first.second, static_cast<unsigned long long>(instances),
+              static_cast<unsigned long long>(stats.GetSpills()), spillPercent);
+
+      size_t lastBucket = 0;
+      for (size_t i = 0; i < SiteStats::kBucketsCount; ++i)
+        if (stats.GetSizeCount(i) > 0)
+          lastBucket = i;
+      for (size_t i = 0; i <= lastBucket; ++i)
+        fprintf(out, "%s%llu", i == 0 ? "" : " ",
+                static_cast<unsigned long long>(stats.GetSizeCount(i)));
+      fprintf(out, "\n");
+    }
+  }
+
+private:
+  Registry()
+  {
+    std::atexit(&Registry::ReportAtExit);
+  }
+
+  static void ReportAtExit()
+  {
+    char const * path = getenv("BUFFER_VECTOR_TELEMETRY_OUT");
+    FILE * out = path != nullptr ? fopen(path, "w") : stderr;
+    if (out == nullptr)
+      out = stderr;
+    Instance().Report(out);
+    if (out != stderr)
+      fclose(out);
+  }
+
+  static std::string Demangle(std::string const & name)
+  {
+#if defined(__GNUG__)
+    int status = 0;
+    char * demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr)
+    {
+      std::string result(demangled);
+      free(demangled);
+      return result;
+    }
+#endif
+    return name;
+  }
+
+  std::mutex m_mutex;
+  // Keyed by (mangled element type, N); values are stable, the map only grows.
+  std::map<std::pair<std::string, size_t>, SiteStats> m_sites;
+};
+}  // namespace bv_telemetry
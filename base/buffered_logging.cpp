@@ -0,0 +1,237 @@
+#include "base/buffered_logging.hpp"
+
+#include "base/thread.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace my
+{
+namespace
+{
+void BufferedLogMessage(LogLevel level, SrcPoint const & srcPoint, std::string const & msg);
+
+// Entries per thread, must be a power of two.
+size_t const kRingCapacity = 256;
+// Entries have a fixed size so that pushing one never allocates; longer
+// messages are truncated.
+size_t const kMaxMessageSize = 224;
+std::chrono::milliseconds const kFlushInterval(20);
+
+struct Entry
+{
+  LogLevel m_level;
+  SrcPoint m_srcPoint;
+  char m_msg[kMaxMessageSize];
+};
+
+// A single-producer ring buffer: only the owning thread pushes. Consumers
+// are serialized by BufferedLogging::m_drainMutex.
+class Ring
+{
+public:
+  void Push(LogLevel level, SrcPoint const & srcPoint, std::string const & msg)
+  {
+    size_t const head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == kRingCapacity)
+    {
+      // Drop on overflow: blocking here would defeat the purpose of the
+      // sink. The drainer reports the number of dropped messages.
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    Entry & e = m_entries[head % kRingCapacity];
+    e.m_level = level;
+    e.m_srcPoint = srcPoint;
+    size_t const size = std::min(msg.size(), kMaxMessageSize - 1);
+    memcpy(e.m_msg, msg.data(), size);
+    e.m_msg[size] = '\0';
+
+    m_head.store(head + 1, std::memory_order_release);
+  }
+
+  void Drain(LogMessageFn fn)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    size_t const head = m_head.load(std::memory_order_acquire);
+    for (; tail != head; ++tail)
+    {
+      Entry const & e = m_entries[tail % kRingCapacity];
+      fn(e.m_level, e.m_srcPoint, std::string(e.m_msg));
+    }
+    m_tail.store(tail, std::memory_order_release);
+
+    size_t const dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped != 0)
+    {
+      fn(LWARNING, SrcPoint(),
+         "Buffered logging dropped " + std::to_string(dropped) + " message(s).");
+    }
+  }
+
+  bool Empty() const
+  {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+private:
+  Entry m_entries[kRingCapacity];
+
+  std::atomic<size_t> m_head{0};
+  std::atomic<size_t> m_tail{0};
+  std::atomic<size_t> m_dropped{0};
+};
+
+class BufferedLogging
+{
+public:
+  static BufferedLogging & Instance()
+  {
+    static BufferedLogging instance;
+    return instance;
+  }
+
+  void Enable()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_enabled)
+      return;
+    m_enabled = true;
+    m_downstream = SetLogMessageFn(&BufferedLogMessage);
+    {
+      std::lock_guard<std::mutex> condLock(m_condMutex);
+      m_stop = false;
+    }
+    m_thread = threads::SimpleThread(&BufferedLogging::DrainRoutine, this);
+  }
+
+  void Disable()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled)
+      return;
+    m_enabled = false;
+    SetLogMessageFn(m_downstream);
+    {
+      std::lock_guard<std::mutex> condLock(m_condMutex);
+      m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+    // Threads observing the old sink may have pushed right up to the join.
+    Flush();
+  }
+
+  void Flush()
+  {
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+      std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+      rings = m_rings;
+    }
+    for (auto const & ring : rings)
+      ring->Drain(m_downstream);
+    rings.clear();
+
+    // Rings of finished threads are kept alive by the registry only; once
+    // drained they can go.
+    std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+    m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                                 [](std::shared_ptr<Ring> const & ring)
+                                 {
+                                   return ring.use_count() == 1 && ring->Empty();
+                                 }),
+                  m_rings.end());
+  }
+
+  void Log(LogLevel level, SrcPoint const & srcPoint, std::string const & msg)
+  {
+    if (level >= g_LogAbortLevel)
+    {
+      // The downstream sink aborts on such levels; keep that synchronous on
+      // the calling thread, with everything logged so far flushed first.
+      Flush();
+      m_downstream(level, srcPoint, msg);
+      return;
+    }
+
+    GetThreadRing().Push(level, srcPoint, msg);
+  }
+
+private:
+  BufferedLogging() = default;
+
+  Ring & GetThreadRing()
+  {
+    static thread_local std::shared_ptr<Ring> ring;
+    if (!ring)
+    {
+      ring = std::make_shared<Ring>();
+      std::lock_guard<std::mutex> lock(m_ringsMutex);
+      m_rings.push_back(ring);
+    }
+    return *ring;
+  }
+
+  void DrainRoutine()
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_condMutex);
+        if (m_condition.wait_for(lock, kFlushInterval, [this] { return m_stop; }))
+          break;
+      }
+      Flush();
+    }
+  }
+
+  // Guards Enable/Disable.
+  std::mutex m_mutex;
+  bool m_enabled = false;
+  LogMessageFn m_downstream = &LogMessageDefault;
+  threads::SimpleThread m_thread;
+
+  std::mutex m_condMutex;
+  std::condition_variable m_condition;
+  bool m_stop = false;
+
+  // The registry shares ownership of the rings with the thread-local
+  // pointers, so a ring outlives its thread until it is drained.
+  std::mutex m_ringsMutex;
+  std::vector<std::shared_ptr<Ring>> m_rings;
+
+  std::mutex m_drainMutex;
+};
+
+void BufferedLogMessage(LogLevel level, SrcPoint const & srcPoint, std::string const & msg)
+{
+  BufferedLogging::Instance().Log(level, srcPoint, msg);
+}
+}  // namespace
+
+void EnableBufferedLogging()
+{
+  BufferedLogging::Instance().Enable();
+}
+
+void DisableBufferedLogging()
+{
+  BufferedLogging::Instance().Disable();
+}
+
+void FlushBufferedLogs()
+{
+  BufferedLogging::Instance().Flush();
+}
+}  // namespace my
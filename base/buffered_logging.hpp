@@ -0,0 +1,28 @@
+#pragma once
+
+#include "base/logging.hpp"
+
+namespace my
+{
+// A hot-path logging sink for code that cannot afford the mutex-protected
+// default sink, e.g. routing and rendering threads during navigation.
+//
+// EnableBufferedLogging() replaces the current LogMessage function with one
+// that copies the formatted message into a ring buffer owned by the calling
+// thread (a single fixed-size slot write, no allocation, no locks) and
+// returns; a background thread periodically drains all the buffers to the
+// previously installed sink. Ordering is preserved per thread, not across
+// threads. Messages longer than the slot are truncated, and when a thread
+// outruns the drainer its oldest messages are dropped and the drop count is
+// reported. Messages at or above g_LogAbortLevel bypass the buffers and are
+// passed to the previous sink synchronously, so aborting still happens on
+// the offending thread with everything logged before it flushed.
+void EnableBufferedLogging();
+
+// Flushes the buffers, restores the previously installed sink and stops the
+// background thread. No-op if buffered logging is not enabled.
+void DisableBufferedLogging();
+
+// Synchronously drains all thread buffers to the downstream sink.
+void FlushBufferedLogs();
+}
@@ -5,12 +5,30 @@
 #include "base/macros.hpp"
 
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 
 
 namespace my
 {
+  namespace impl
+  {
+    inline uint32_t HashKey(uint32_t x)
+    {
+      x = (x ^ 61) ^ (x >> 16);
+      x = x + (x << 3);
+      x = x ^ (x >> 4);
+      x = x * 0x27d4eb2d;
+      x = x ^ (x >> 15);
+      return x;
+    }
+    inline uint32_t HashKey(uint64_t x)
+    {
+      return HashKey(uint32_t(x) ^ uint32_t(x >> 32));
+    }
+  }
+
   // Simple cache that stores list of values.
   template <typename KeyT, typename ValueT> class Cache
   {
@@ -81,21 +99,7 @@ namespace my
   private:
     inline size_t Index(KeyT const & key) const
     {
-      return static_cast<size_t>(Hash(key) & m_hashMask);
-    }
-
-    inline static uint32_t Hash(uint32_t x)
-    {
-      x = (x ^ 61) ^ (x >> 16);
-      x = x + (x << 3);
-      x = x ^ (x >> 4);
-      x = x * 0x27d4eb2d;
-      x = x ^ (x >> 15);
-      return x;
-    }
-    inline static uint32_t Hash(uint64_t x)
-    {
-      return Hash(uint32_t(x) ^ uint32_t(x >> 32));
+      return static_cast<size_t>(impl::HashKey(key) & m_hashMask);
     }
 
     // TODO: Consider using separate arrays for keys and values, to save on padding.
@@ -166,4 +170,99 @@ namespace my
     uint64_t m_miss;
     uint64_t m_access;
   };
+
+  // Striped-lock cache for concurrent use: the key space is split across
+  // independent Cache shards, each guarded by its own mutex, so threads
+  // hitting different stripes do not serialize on one lock. Values are copied
+  // in and out because a reference into a shard would escape its lock.
+  template <typename KeyT, typename ValueT>
+  class StripedCache
+  {
+    DISALLOW_COPY_AND_MOVE(StripedCache);
+
+  public:
+    StripedCache() = default;
+
+    explicit StripedCache(uint32_t logCacheSize)
+    {
+      Init(logCacheSize);
+    }
+
+    /// @param[in] logCacheSize is pow of two for the total number of elements in all stripes.
+    void Init(uint32_t logCacheSize)
+    {
+      ASSERT_GREATER(logCacheSize, uint32_t(kLogStripesCount), ());
+      for (Stripe & stripe : m_stripes)
+      {
+        stripe.m_cache.Init(logCacheSize - kLogStripesCount);
+        stripe.m_access = stripe.m_miss = 0;
+      }
+    }
+
+    // Finds a value by @key and copies it into @value, returns true on a cache
+    // hit. On a miss calls initValue(value) on the (reused) cache slot first.
+    // initValue runs under the stripe lock: misses for the same stripe
+    // serialize, other stripes are not blocked.
+    template <typename TInitValue>
+    bool Get(KeyT const & key, TInitValue && initValue, ValueT & value)
+    {
+      Stripe & stripe = m_stripes[StripeIndex(key)];
+      std::lock_guard<std::mutex> lock(stripe.m_mutex);
+
+      ++stripe.m_access;
+      bool found = false;
+      ValueT & cached = stripe.m_cache.Find(key, found);
+      if (!found)
+      {
+        ++stripe.m_miss;
+        initValue(cached);
+      }
+      value = cached;
+      return found;
+    }
+
+    double GetCacheMiss() const
+    {
+      uint64_t miss = 0, access = 0;
+      for (Stripe & stripe : m_stripes)
+      {
+        std::lock_guard<std::mutex> lock(stripe.m_mutex);
+        miss += stripe.m_miss;
+        access += stripe.m_access;
+      }
+      if (access == 0)
+        return 0.0;
+      return static_cast<double>(miss) / static_cast<double>(access);
+    }
+
+    void Reset()
+    {
+      for (Stripe & stripe : m_stripes)
+      {
+        std::lock_guard<std::mutex> lock(stripe.m_mutex);
+        stripe.m_cache.Reset();
+        stripe.m_access = stripe.m_miss = 0;
+      }
+    }
+
+  private:
+    static uint32_t constexpr kLogStripesCount = 4;
+    static uint32_t constexpr kStripesCount = 1 << kLogStripesCount;
+
+    // Stripes are selected by the high hash bits, shards index by the low ones.
+    inline static size_t StripeIndex(KeyT const & key)
+    {
+      return static_cast<size_t>(impl::HashKey(key) >> (32 - kLogStripesCount));
+    }
+
+    struct Stripe
+    {
+      std::mutex m_mutex;
+      Cache<KeyT, ValueT> m_cache;
+      uint64_t m_access;
+      uint64_t m_miss;
+    };
+
+    mutable Stripe m_stripes[kStripesCount];
+  };
 }
@@ -25,6 +25,17 @@ public:
       return *this;
     }
 
+    // Moves the iterator along the whole label [begin, end). Stops as
+    // soon as the verdict is known: an accepting prefix stays accepted
+    // and the rejecting state is a sink.
+    template <typename It>
+    Iterator & Move(It begin, It end)
+    {
+      for (; begin != end && !Accepts() && !Rejects(); ++begin)
+        Move(*begin);
+      return *this;
+    }
+
     bool Accepts() const { return m_accepts; }
     bool Rejects() const { return !Accepts() && m_it.Rejects(); }
 
@@ -48,8 +59,7 @@ private:
 template <typename DFAIt, typename It>
 void DFAMove(DFAIt & it, It begin, It end)
 {
-  for (; begin != end; ++begin)
-    it.Move(*begin);
+  it.Move(begin, end);
 }
 
 template <typename DFAIt>
@@ -0,0 +1,64 @@
+#include "base/interned_string.hpp"
+
+#include <algorithm>
+
+namespace my
+{
+
+// static
+size_t const StringInternPool::kMinGCThreshold;
+
+std::string const & InternedString::Get() const
+{
+  static std::string const kEmpty;
+  return m_str ? *m_str : kEmpty;
+}
+
+// static
+StringInternPool & StringInternPool::Instance()
+{
+  static StringInternPool instance;
+  return instance;
+}
+
+InternedString StringInternPool::Intern(std::string const & s)
+{
+  if (s.empty())
+    return InternedString();
+
+  std::lock_guard<std::mutex> lock(m_mu);
+
+  auto const it = m_pool.find(s);
+  if (it != m_pool.end())
+  {
+    if (auto str = it->second.lock())
+      return InternedString(std::move(str));
+  }
+
+  auto str = std::make_shared<std::string const>(s);
+  m_pool[s] = str;
+  if (m_pool.size() >= m_gcThreshold)
+    CollectGarbage();
+  return InternedString(std::move(str));
+}
+
+size_t StringInternPool::GetSize() const
+{
+  std::lock_guard<std::mutex> lock(m_mu);
+  return m_pool.size();
+}
+
+void StringInternPool::CollectGarbage()
+{
+  for (auto it = m_pool.begin(); it != m_pool.end();)
+  {
+    if (it->second.expired())
+      it = m_pool.erase(it);
+    else
+      ++it;
+  }
+  // Amortize the sweep: do not collect again until the pool doubles.
+  m_gcThreshold = std::max(kMinGCThreshold, m_pool.size() * 2);
+}
+
+}  // namespace my
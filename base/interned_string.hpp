@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace my
+{
+
+// Hash-consed immutable strings. The same value interned at different
+// call sites - a street name shaped for every tile it crosses and
+// ranked in dozens of search results - shares one heap allocation and
+// travels as a lightweight handle. A pool entry lives as long as any
+// handle to it: expired entries are collected lazily when the pool
+// grows.
+
+class InternedString
+{
+public:
+  InternedString() = default;
+
+  /// A default-constructed handle reads as an empty string.
+  std::string const & Get() const;
+  bool IsEmpty() const { return !m_str || m_str->empty(); }
+
+  /// All live handles to equal strings share storage (see
+  /// StringInternPool::Intern), so comparing pointers compares values.
+  bool operator==(InternedString const & rhs) const { return m_str == rhs.m_str; }
+  bool operator!=(InternedString const & rhs) const { return !(*this == rhs); }
+
+private:
+  friend class StringInternPool;
+
+  explicit InternedString(std::shared_ptr<std::string const> str) : m_str(std::move(str)) {}
+
+  std::shared_ptr<std::string const> m_str;
+};
+
+class StringInternPool
+{
+public:
+  static StringInternPool & Instance();
+
+  /// Returns the shared instance of |s|, creating it on the first call.
+  /// Empty strings are not pooled: an empty handle is returned.
+  InternedString Intern(std::string const & s);
+
+  /// Number of strings the pool tracks, including entries whose handles
+  /// are all dead and which are not collected yet.
+  size_t GetSize() const;
+
+private:
+  StringInternPool() = default;
+
+  /// @precondition m_mu is taken.
+  void CollectGarbage();
+
+  static size_t const kMinGCThreshold = 1024;
+
+  std::unordered_map<std::string, std::weak_ptr<std::string const>> m_pool;
+  size_t m_gcThreshold = kMinGCThreshold;
+  mutable std::mutex m_mu;
+};
+
+}  // namespace my
@@ -181,12 +181,12 @@ LevenshteinDFA::LevenshteinDFA(UniString const & s, size_t prefixCharsToKeep, ui
 
   auto pushState = [&states, &visited, this](State const & state, size_t id)
   {
-    ASSERT_EQUAL(id, m_transitions.size(), ());
+    ASSERT_EQUAL(id, m_accepting.size(), ());
     ASSERT_EQUAL(visited.count(state), 0, (state, id));
 
     states.emplace(state);
     visited[state] = id;
-    m_transitions.emplace_back(m_alphabet.size());
+    m_transitions.resize(m_transitions.size() + m_alphabet.size());
     m_accepting.push_back(false);
   };
 
@@ -203,7 +203,7 @@ LevenshteinDFA::LevenshteinDFA(UniString const & s, size_t prefixCharsToKeep, ui
 
     ASSERT_GREATER(visited.count(curr), 0, (curr));
     auto const id = visited[curr];
-    ASSERT_LESS(id, m_transitions.size(), ());
+    ASSERT_LESS(id, m_accepting.size(), ());
 
     if (IsAccepting(curr))
       m_accepting[id] = true;
@@ -226,7 +226,7 @@ LevenshteinDFA::LevenshteinDFA(UniString const & s, size_t prefixCharsToKeep, ui
         nid = it->second;
       }
 
-      m_transitions[id][i] = nid;
+      m_transitions[id * m_alphabet.size() + i] = nid;
     }
   }
 }
@@ -301,7 +301,7 @@ size_t LevenshteinDFA::Move(size_t s, UniChar c) const
   else
     i = distance(m_alphabet.begin(), it);
 
-  return m_transitions[s][i];
+  return m_transitions[s * m_alphabet.size() + i];
 }
 
 std::string DebugPrint(LevenshteinDFA::Position const & p)
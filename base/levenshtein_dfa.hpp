@@ -77,6 +77,16 @@ public:
       return *this;
     }
 
+    // Moves the iterator along the whole label [begin, end). Stops as
+    // soon as the rejecting state is reached: it is a sink, so the
+    // rest of the label cannot resurrect the match.
+    template <typename It>
+    Iterator & Move(It begin, It end)
+    {
+      m_s = m_dfa.Move(m_s, begin, end);
+      return *this;
+    }
+
     bool Accepts() const { return m_dfa.IsAccepting(m_s); }
     bool Rejects() const { return m_dfa.IsRejecting(m_s); }
 
@@ -96,7 +106,7 @@ public:
 
   inline Iterator Begin() const { return Iterator(*this); }
 
-  size_t GetNumStates() const { return m_transitions.size(); }
+  size_t GetNumStates() const { return m_accepting.size(); }
   size_t GetAlphabetSize() const { return m_alphabet.size(); }
 
 private:
@@ -117,12 +127,21 @@ private:
 
   size_t Move(size_t s, UniChar c) const;
 
+  template <typename It>
+  size_t Move(size_t s, It begin, It end) const
+  {
+    for (; begin != end && s != kRejectingState; ++begin)
+      s = Move(s, *begin);
+    return s;
+  }
+
   size_t const m_size;
   uint8_t const m_maxErrors;
 
   std::vector<UniChar> m_alphabet;
 
-  std::vector<std::vector<size_t>> m_transitions;
+  // Flattened |states| x |alphabet| transition table, row-major.
+  std::vector<size_t> m_transitions;
   std::vector<bool> m_accepting;
 };
 
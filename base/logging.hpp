@@ -24,6 +24,10 @@ namespace my
   extern TLogLevel g_LogLevel;
   extern TLogLevel g_LogAbortLevel;
 
+  // The level check is on the fast path of every LOG call site and only
+  // gates message construction, so a relaxed load is enough there.
+  inline LogLevel GetLogLevel() { return g_LogLevel.load(std::memory_order_relaxed); }
+
   /// @return Pointer to previous message function.
   LogMessageFn SetLogMessageFn(LogMessageFn fn);
 
@@ -62,9 +66,9 @@ using ::my::LCRITICAL;
 
 // Logging macro.
 // Example usage: LOG(LINFO, (Calc(), m_Var, "Some string constant"));
-#define LOG(level, msg) do { if ((level) < ::my::g_LogLevel) {} \
+#define LOG(level, msg) do { if ((level) < ::my::GetLogLevel()) {} \
   else { ::my::LogMessage(level, SRC(), ::my::impl::Message msg);} } while (false)
 
 // Logging macro with short info (without entry point)
-#define LOG_SHORT(level, msg) do { if ((level) < ::my::g_LogLevel) {} \
+#define LOG_SHORT(level, msg) do { if ((level) < ::my::GetLogLevel()) {} \
   else { ::my::LogMessage(level, my::SrcPoint(), ::my::impl::Message msg);} } while (false)
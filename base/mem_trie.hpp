@@ -1,5 +1,6 @@
 #pragma once
 
+#include "base/assert.hpp"
 #include "base/macros.hpp"
 #include "base/stl_add.hpp"
 
@@ -8,6 +9,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace my
@@ -249,4 +251,202 @@ private:
 
   DISALLOW_COPY(MemTrie);
 };
+
+// A read-mostly counterpart of MemTrie: all nodes live in a single
+// arena and children are kept in arrays sorted by move character, so
+// there is one allocation-free binary search per character instead of
+// a std::map lookup and a pointer chase. The trie is built in one pass
+// with Assign() from key-value pairs sorted by key and is immutable
+// afterwards (except for Clear), which suits indexes built once at
+// startup, e.g. the categories index.
+template <typename String, typename Values>
+class PackedMemTrie
+{
+private:
+  struct Node;
+
+public:
+  using Char = typename String::value_type;
+
+  PackedMemTrie() { m_nodes.emplace_back(); }
+  PackedMemTrie(PackedMemTrie && rhs) { *this = std::move(rhs); }
+
+  PackedMemTrie & operator=(PackedMemTrie && rhs)
+  {
+    m_nodes = std::move(rhs.m_nodes);
+    rhs.Clear();
+    return *this;
+  }
+
+  // A read-only iterator over a node, with the same interface as
+  // MemTrie::Iterator. Any modification to the underlying trie is
+  // assumed to invalidate the iterator.
+  class Iterator
+  {
+  public:
+    using Char = PackedMemTrie::Char;
+
+    Iterator(PackedMemTrie const & trie, uint32_t node) : m_trie(trie), m_node(node) {}
+
+    template <typename ToDo>
+    void ForEachMove(ToDo && toDo) const
+    {
+      for (auto const & move : m_trie.m_nodes[m_node].m_moves)
+        toDo(move.first, Iterator(m_trie, move.second));
+    }
+
+    template <typename ToDo>
+    void ForEachInNode(ToDo && toDo) const
+    {
+      m_trie.m_nodes[m_node].m_values.ForEach(std::forward<ToDo>(toDo));
+    }
+
+  private:
+    PackedMemTrie const & m_trie;
+    uint32_t m_node;
+  };
+
+  // Rebuilds the trie from a range of (key, value) pairs sorted by
+  // key. Since keys arrive in order, every node is created exactly
+  // once and its moves are appended already sorted.
+  template <typename Iter>
+  void Assign(Iter beg, Iter end)
+  {
+    Clear();
+
+    String prev;
+    // |path|[i] is the node reachable by the first i characters of the
+    // previously added key.
+    std::vector<uint32_t> path;
+    path.push_back(0 /* root */);
+
+    for (; beg != end; ++beg)
+    {
+      String const & key = beg->first;
+      ASSERT(!(key < prev), ("Input is not sorted by key."));
+
+      size_t common = 0;
+      while (common < key.size() && common < prev.size() && key[common] == prev[common])
+        ++common;
+      path.resize(common + 1);
+
+      for (size_t i = common; i < key.size(); ++i)
+      {
+        uint32_t const child = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_nodes[path.back()].m_moves.emplace_back(key[i], child);
+        path.push_back(child);
+      }
+
+      m_nodes[path.back()].m_values.Add(beg->second);
+      prev = key;
+    }
+  }
+
+  // Traverses all key-value pairs in the trie and calls |toDo| on each of them.
+  template <typename ToDo>
+  void ForEachInTrie(ToDo && toDo) const
+  {
+    String prefix;
+    ForEachInSubtree(0 /* root */, prefix, std::forward<ToDo>(toDo));
+  }
+
+  // Calls |toDo| for each key-value pair in the node that is reachable
+  // by |prefix| from the trie root. Does nothing if such node does
+  // not exist.
+  template <typename ToDo>
+  void ForEachInNode(String const & prefix, ToDo && toDo) const
+  {
+    uint32_t node;
+    if (MoveTo(prefix, node))
+      ForEachInNode(node, prefix, std::forward<ToDo>(toDo));
+  }
+
+  // Calls |toDo| for each key-value pair in a subtree that is
+  // reachable by |prefix| from the trie root. Does nothing if such
+  // subtree does not exist.
+  template <typename ToDo>
+  void ForEachInSubtree(String prefix, ToDo && toDo) const
+  {
+    uint32_t node;
+    if (MoveTo(prefix, node))
+      ForEachInSubtree(node, prefix, std::forward<ToDo>(toDo));
+  }
+
+  void Clear()
+  {
+    m_nodes.clear();
+    m_nodes.emplace_back();
+  }
+
+  size_t GetNumNodes() const { return m_nodes.size(); }
+  Iterator GetRootIterator() const { return Iterator(*this, 0 /* root */); }
+
+private:
+  struct Node
+  {
+    Node() = default;
+    Node(Node && /* rhs */) = default;
+
+    Node & operator=(Node && /* rhs */) = default;
+
+    // Pairs of (move character, arena index of the child), sorted by
+    // the move character.
+    std::vector<std::pair<Char, uint32_t>> m_moves;
+    Values m_values;
+
+    DISALLOW_COPY(Node);
+  };
+
+  bool MoveTo(String const & key, uint32_t & node) const
+  {
+    uint32_t cur = 0;
+    for (auto const & c : key)
+    {
+      auto const & moves = m_nodes[cur].m_moves;
+      auto const it =
+          std::lower_bound(moves.begin(), moves.end(), c,
+                           [](std::pair<Char, uint32_t> const & move, Char const & c)
+                           {
+                             return move.first < c;
+                           });
+      if (it == moves.end() || it->first != c)
+        return false;
+      cur = it->second;
+    }
+    node = cur;
+    return true;
+  }
+
+  // Calls |toDo| for each key-value pair in a |node| that is
+  // reachable by |prefix| from the trie root.
+  template <typename ToDo>
+  void ForEachInNode(uint32_t node, String const & prefix, ToDo && toDo) const
+  {
+    m_nodes[node].m_values.ForEach(
+        std::bind(std::forward<ToDo>(toDo), std::ref(prefix), std::placeholders::_1));
+  }
+
+  // Calls |toDo| for each key-value pair in subtree where |node| is a
+  // root of the subtree. |prefix| is a path from the trie root to the
+  // |node|.
+  template <typename ToDo>
+  void ForEachInSubtree(uint32_t node, String & prefix, ToDo && toDo) const
+  {
+    ForEachInNode(node, prefix, toDo);
+
+    for (auto const & move : m_nodes[node].m_moves)
+    {
+      prefix.push_back(move.first);
+      ForEachInSubtree(move.second, prefix, toDo);
+      prefix.pop_back();
+    }
+  }
+
+  // The arena: all nodes of the trie, the root at index 0. Nodes refer
+  // to each other by index, so moving the trie moves the arena only.
+  std::vector<Node> m_nodes;
+
+  DISALLOW_COPY(PackedMemTrie);
+};
 }  // namespace my
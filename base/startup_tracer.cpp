@@ -0,0 +1,50 @@
+#include "base/startup_tracer.hpp"
+
+#include <chrono>
+#include <sstream>
+
+namespace my
+{
+
+// static
+StartupTracer & StartupTracer::Instance()
+{
+  static StartupTracer instance;
+  return instance;
+}
+
+void StartupTracer::BeginPhase(char const * name) { Record(name, true /* begin */); }
+
+void StartupTracer::EndPhase(char const * name) { Record(name, false /* begin */); }
+
+void StartupTracer::Record(char const * name, bool begin)
+{
+  std::lock_guard<std::mutex> lock(m_mu);
+  if (!m_enabled)
+    return;
+
+  Event & e = m_events[m_count % kMaxEvents];
+  e.m_name = name;
+  e.m_begin = begin;
+  e.m_timeUs = m_timer.TimeElapsedAs<std::chrono::microseconds>().count();
+  ++m_count;
+}
+
+std::string StartupTracer::Dump()
+{
+  std::lock_guard<std::mutex> lock(m_mu);
+  if (!m_enabled)
+    return std::string();
+  m_enabled = false;
+
+  std::ostringstream ss;
+  size_t const first = m_count > kMaxEvents ? m_count - kMaxEvents : 0;
+  for (size_t i = first; i < m_count; ++i)
+  {
+    Event const & e = m_events[i % kMaxEvents];
+    ss << e.m_timeUs << '\t' << (e.m_begin ? 'B' : 'E') << '\t' << e.m_name << '\n';
+  }
+  return ss.str();
+}
+
+}  // namespace my
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "base/timer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace my
+{
+
+// Collects begin/end markers of the cold start phases (classificator
+// loading, map registration, drape context creation and so on) into a
+// static ring with monotonic timestamps. The timeline is dumped once,
+// when the first frame has been rendered, so field reports include a
+// machine-readable startup breakdown. Recording stops after the dump
+// and the tracer costs nothing afterwards but a flag check.
+class StartupTracer
+{
+public:
+  static StartupTracer & Instance();
+
+  void BeginPhase(char const * name);
+  void EndPhase(char const * name);
+
+  /// Stops recording and returns the collected timeline, one event per
+  /// line: <microseconds since the tracer creation><TAB><B|E><TAB><phase>.
+  /// Nested phases appear as nested B/E pairs. Returns an empty string
+  /// on repeated calls.
+  std::string Dump();
+
+  /// RAII phase marker. |name| must be a string literal: only the
+  /// pointer is stored in the ring.
+  class Scope
+  {
+  public:
+    explicit Scope(char const * name) : m_name(name) { Instance().BeginPhase(m_name); }
+    ~Scope() { Instance().EndPhase(m_name); }
+
+  private:
+    char const * const m_name;
+  };
+
+private:
+  StartupTracer() = default;
+
+  void Record(char const * name, bool begin);
+
+  struct Event
+  {
+    char const * m_name = nullptr;
+    bool m_begin = false;
+    int64_t m_timeUs = 0;
+  };
+
+  static size_t const kMaxEvents = 256;
+  Event m_events[kMaxEvents];  ///< Ring, the oldest events are overwritten.
+  size_t m_count = 0;
+  bool m_enabled = true;
+  Timer m_timer;
+  std::mutex m_mu;
+};
+
+}  // namespace my
@@ -20,6 +20,8 @@ template <typename T> class AverageStats
 {
 public:
   AverageStats() : m_Count(0), m_Sum(0) {}
+  /// Restores totals accumulated elsewhere, e.g. by AllocTracker.
+  AverageStats(uint32_t count, double sum) : m_Count(count), m_Sum(sum) {}
 
   void operator() (T const & x)
   {
@@ -27,7 +29,7 @@ public:
     m_Sum += x;
   }
 
-  string GetStatsStr() const
+  std::string GetStatsStr() const
   {
     std::ostringstream out;
     out << "N: " << m_Count;
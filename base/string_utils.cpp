@@ -216,10 +216,16 @@ bool EqualNoCase(std::string const & s1, std::string const & s2)
 UniString MakeUniString(std::string const & utf8s)
 {
   UniString result;
-  utf8::unchecked::utf8to32(utf8s.begin(), utf8s.end(), std::back_inserter(result));
+  MakeUniString(utf8s, result);
   return result;
 }
 
+void MakeUniString(std::string const & utf8s, UniString & result)
+{
+  result.clear();
+  utf8::unchecked::utf8to32(utf8s.begin(), utf8s.end(), std::back_inserter(result));
+}
+
 std::string ToUtf8(UniString const & s)
 {
   std::string result;
@@ -84,6 +84,9 @@ std::string MakeLowerCase(std::string const & s);
 bool EqualNoCase(std::string const & s1, std::string const & s2);
 
 UniString MakeUniString(std::string const & utf8s);
+/// Decodes |utf8s| into |result| reusing its storage (and, for short strings,
+/// UniString's inline buffer) instead of allocating a new string.
+void MakeUniString(std::string const & utf8s, UniString & result);
 std::string ToUtf8(UniString const & s);
 bool IsASCIIString(std::string const & str);
 bool IsASCIIDigit(UniChar c);
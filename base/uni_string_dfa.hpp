@@ -15,6 +15,16 @@ public:
   public:
     Iterator & Move(UniChar c);
 
+    // Moves the iterator along the whole label [begin, end), stopping
+    // as soon as the string is rejected.
+    template <typename It>
+    Iterator & Move(It begin, It end)
+    {
+      for (; begin != end && !m_rejected; ++begin)
+        Move(*begin);
+      return *this;
+    }
+
     inline bool Accepts() const { return !Rejects() && m_pos == m_s.size(); }
     inline bool Rejects() const { return m_rejected; }
 
@@ -0,0 +1,193 @@
+#include "base/work_stealing_thread_pool.hpp"
+
+#include "base/stl_add.hpp"
+#include "base/thread.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace threads
+{
+  class WorkStealingThreadPool::Impl
+  {
+  public:
+    Impl(size_t size, TFinishRoutineFn const & finishFn)
+      : m_finishFn(finishFn), m_done(false), m_pendingCount(0), m_nextWorker(0)
+    {
+      // Like ThreadPool, a pool of size 0 is allowed: routines are queued and
+      // handed to the finish function on Stop, so keep at least one deque.
+      m_workers.resize(size == 0 ? 1 : size);
+      for (auto & worker : m_workers)
+        worker.reset(new Worker());
+
+      m_threads.resize(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        m_threads[i].reset(new threads::Thread());
+        m_threads[i]->Create(my::make_unique<WorkerRoutine>(*this, i));
+      }
+    }
+
+    ~Impl()
+    {
+      Stop();
+    }
+
+    void Push(threads::IRoutine * routine, bool front)
+    {
+      size_t const index = m_nextWorker.fetch_add(1) % m_workers.size();
+      {
+        std::lock_guard<std::mutex> lock(m_workers[index]->m_mutex);
+        if (front)
+          m_workers[index]->m_tasks.push_front(routine);
+        else
+          m_workers[index]->m_tasks.push_back(routine);
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_condMutex);
+        ++m_pendingCount;
+      }
+      m_condition.notify_one();
+    }
+
+    void Stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_condMutex);
+        m_done = true;
+      }
+      m_condition.notify_all();
+
+      // Cancels the routine a worker is currently running and joins it.
+      for (auto & thread : m_threads)
+        thread->Cancel();
+      m_threads.clear();
+
+      // As in ThreadPool, routines left in the queues are not executed on
+      // stop, only cancelled and passed to the finish function.
+      for (auto & worker : m_workers)
+      {
+        std::lock_guard<std::mutex> lock(worker->m_mutex);
+        for (threads::IRoutine * task : worker->m_tasks)
+        {
+          task->Cancel();
+          m_finishFn(task);
+        }
+        worker->m_tasks.clear();
+      }
+    }
+
+  private:
+    struct Worker
+    {
+      std::mutex m_mutex;
+      std::deque<threads::IRoutine *> m_tasks;
+    };
+
+    class WorkerRoutine : public IRoutine
+    {
+    public:
+      WorkerRoutine(Impl & pool, size_t index) : m_pool(pool), m_index(index) {}
+
+      void Do() override
+      {
+        while (!IsCancelled())
+        {
+          threads::IRoutine * task = m_pool.Pop(m_index);
+          if (task == nullptr)
+          {
+            if (!m_pool.Wait())
+              break;
+            continue;
+          }
+
+          if (!task->IsCancelled())
+            task->Do();
+          m_pool.m_finishFn(task);
+        }
+      }
+
+    private:
+      Impl & m_pool;
+      size_t const m_index;
+    };
+
+    // Takes the front of the worker's own deque or steals from the back of
+    // another worker's one. Returns nullptr if there is no work.
+    threads::IRoutine * Pop(size_t index)
+    {
+      size_t const size = m_workers.size();
+      for (size_t i = 0; i < size; ++i)
+      {
+        Worker & worker = *m_workers[(index + i) % size];
+        std::lock_guard<std::mutex> lock(worker.m_mutex);
+        if (worker.m_tasks.empty())
+          continue;
+
+        threads::IRoutine * task;
+        if (i == 0)
+        {
+          task = worker.m_tasks.front();
+          worker.m_tasks.pop_front();
+        }
+        else
+        {
+          task = worker.m_tasks.back();
+          worker.m_tasks.pop_back();
+        }
+
+        std::lock_guard<std::mutex> condLock(m_condMutex);
+        --m_pendingCount;
+        return task;
+      }
+      return nullptr;
+    }
+
+    // Blocks until there is work or the pool is stopped; returns false on stop.
+    bool Wait()
+    {
+      std::unique_lock<std::mutex> lock(m_condMutex);
+      m_condition.wait(lock, [this] { return m_done || m_pendingCount != 0; });
+      return !m_done;
+    }
+
+    TFinishRoutineFn m_finishFn;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::unique_ptr<threads::Thread>> m_threads;
+
+    std::mutex m_condMutex;
+    std::condition_variable m_condition;
+    bool m_done;
+    size_t m_pendingCount;
+
+    std::atomic<size_t> m_nextWorker;
+  };
+
+  WorkStealingThreadPool::WorkStealingThreadPool(size_t size, TFinishRoutineFn const & finishFn)
+    : m_impl(new Impl(size, finishFn)) {}
+
+  WorkStealingThreadPool::~WorkStealingThreadPool()
+  {
+    delete m_impl;
+  }
+
+  void WorkStealingThreadPool::PushBack(threads::IRoutine * routine)
+  {
+    m_impl->Push(routine, false /* front */);
+  }
+
+  void WorkStealingThreadPool::PushFront(threads::IRoutine * routine)
+  {
+    m_impl->Push(routine, true /* front */);
+  }
+
+  void WorkStealingThreadPool::Stop()
+  {
+    m_impl->Stop();
+  }
+}
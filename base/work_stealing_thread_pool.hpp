@@ -0,0 +1,30 @@
+#pragma once
+
+#include "base/thread_pool.hpp"
+
+namespace threads
+{
+  // Work-stealing counterpart of ThreadPool with the same interface: every
+  // worker owns a deque guarded by its own mutex, routines are distributed
+  // over the workers round-robin and idle workers steal from the others, so
+  // producers and consumers do not serialize on one queue lock.
+  //
+  // A worker serves its own deque from the front; PushFront therefore makes
+  // a routine the next one its worker runs, while stealing takes from the
+  // back, i.e. prefers the lowest priority work.
+  class WorkStealingThreadPool
+  {
+  public:
+    WorkStealingThreadPool(size_t size, TFinishRoutineFn const & finishFn);
+    ~WorkStealingThreadPool();
+
+    // The pool will not delete the routine. You can delete it in finishFn if needed.
+    void PushBack(threads::IRoutine * routine);
+    void PushFront(threads::IRoutine * routine);
+    void Stop();
+
+  private:
+    class Impl;
+    Impl * m_impl;
+  };
+}
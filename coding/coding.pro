@@ -19,9 +19,12 @@ SOURCES += \
     internal/file_data.cpp \
     mmap_reader.cpp \
     multilang_utf8_string.cpp \
+    mwm_diff.cpp \
+    read_ahead_reader.cpp \
     reader.cpp \
     reader_streambuf.cpp \
     reader_writer_ops.cpp \
+    section_read_stats.cpp \
     simple_dense_coding.cpp \
     traffic.cpp \
     uri.cpp \
@@ -62,14 +65,17 @@ HEADERS += \
     memory_region.hpp \
     mmap_reader.hpp \
     multilang_utf8_string.hpp \
+    mwm_diff.hpp \
     parse_xml.hpp \
     polymorph_reader.hpp \
+    read_ahead_reader.hpp \
     read_write_utils.hpp \
     reader.hpp \
     reader_cache.hpp \
     reader_streambuf.hpp \
     reader_wrapper.hpp \
     reader_writer_ops.hpp \
+    section_read_stats.hpp \
     simple_dense_coding.hpp \
     streams.hpp \
     streams_common.hpp \
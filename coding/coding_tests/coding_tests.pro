@@ -31,10 +31,12 @@ SOURCES += ../../testing/testingmain.cpp \
     mem_file_reader_test.cpp \
     mem_file_writer_test.cpp \
     multilang_utf8_string_test.cpp \
+    mwm_diff_test.cpp \
     png_decoder_test.cpp \
     reader_cache_test.cpp \
     reader_test.cpp \
     reader_writer_ops_test.cpp \
+    section_read_stats_test.cpp \
     simple_dense_coding_test.cpp \
     succinct_mapper_test.cpp \
     traffic_test.cpp \
@@ -127,4 +127,52 @@ UNIT_TEST(Huffman_Serialization_Data)
   TEST_EQUAL(expected, received, ());
 }
 
+UNIT_TEST(Huffman_LongCodesAndBatch)
+{
+  // Fibonacci-like frequencies produce a maximally skewed tree, so
+  // the rarest symbols get codes longer than the 8-bit lookup table
+  // and exercise the tree-walk fallback of the decoder.
+  vector<strings::UniString> data;
+  uint32_t prev = 1, curr = 1;
+  for (uint32_t i = 0; i < 14; ++i)
+  {
+    strings::UniString s;
+    for (uint32_t j = 0; j < curr; ++j)
+      s.push_back(static_cast<strings::UniChar>('a' + i));
+    data.push_back(s);
+    uint32_t const next = prev + curr;
+    prev = curr;
+    curr = next;
+  }
+
+  HuffmanCoder h;
+  h.Init(data);
+
+  size_t maxLen = 0;
+  for (uint32_t i = 0; i < 14; ++i)
+  {
+    HuffmanCoder::Code code;
+    TEST(h.Encode('a' + i, code), (i));
+    maxLen = max(maxLen, code.len);
+  }
+  TEST_GREATER(maxLen, 8, ());
+
+  vector<uint8_t> buf;
+  MemWriter<vector<uint8_t>> writer(buf);
+  for (auto const & s : data)
+    h.EncodeAndWrite(writer, s);
+
+  MemReader memReader(&buf[0], buf.size());
+  ReaderSource<MemReader> reader(memReader);
+  for (auto const & s : data)
+    TEST_EQUAL(s, h.ReadAndDecode(reader), ());
+  TEST_EQUAL(reader.Size(), 0, ());
+
+  // The batch overload sees the same strings.
+  ReaderSource<MemReader> batchReader(memReader);
+  vector<strings::UniString> received;
+  h.ReadAndDecode(batchReader, data.size(), received);
+  TEST_EQUAL(data, received, ());
+}
+
 }  // namespace coding
@@ -0,0 +1,91 @@
+#include "testing/testing.hpp"
+
+#include "coding/mwm_diff.hpp"
+#include "coding/reader.hpp"
+#include "coding/writer.hpp"
+
+#include "std/cstdlib.hpp"
+#include "std/vector.hpp"
+
+namespace
+{
+// Makes a patch between |oldData| and |newData|, applies it and checks
+// the result. Returns the patch size or 0 if MakeDiff refused.
+size_t CheckRoundtrip(vector<uint8_t> const & oldData, vector<uint8_t> const & newData)
+{
+  vector<uint8_t> patch;
+  {
+    MemWriter<vector<uint8_t>> writer(patch);
+    if (!diff::MakeDiff(MemReader(oldData.data(), oldData.size()), MemReader(newData.data(), newData.size()), writer))
+      return 0;
+  }
+
+  vector<uint8_t> rebuilt;
+  MemWriter<vector<uint8_t>> writer(rebuilt);
+  TEST(diff::ApplyDiff(MemReader(oldData.data(), oldData.size()), MemReader(patch.data(), patch.size()), writer), ());
+  TEST_EQUAL(newData, rebuilt, ());
+  return patch.size();
+}
+
+UNIT_TEST(MwmDiff_Smoke)
+{
+  srand(40);
+  vector<uint8_t> oldData(1 << 20);
+  for (auto & b : oldData)
+    b = static_cast<uint8_t>(rand());
+
+  // A few percent of scattered changes: the patch must be much smaller
+  // than the new file.
+  vector<uint8_t> newData(oldData);
+  for (size_t i = 0; i < 20; ++i)
+  {
+    size_t const pos = rand() % newData.size();
+    newData[pos] ^= 0xFF;
+  }
+  newData.insert(newData.begin() + newData.size() / 2, 1000, 0xAB);
+  newData.erase(newData.begin(), newData.begin() + 500);
+
+  size_t const patchSize = CheckRoundtrip(oldData, newData);
+  TEST(patchSize != 0, ());
+  TEST_LESS(patchSize, newData.size() / 10, ());
+
+  // Identical files.
+  TEST(CheckRoundtrip(oldData, oldData) != 0, ());
+
+  // Unrelated files: the patch is refused rather than written larger
+  // than the new file.
+  vector<uint8_t> unrelated(1 << 18);
+  for (auto & b : unrelated)
+    b = static_cast<uint8_t>(rand());
+  TEST_EQUAL(CheckRoundtrip(oldData, unrelated), 0, ());
+}
+
+UNIT_TEST(MwmDiff_ChecksumMismatch)
+{
+  srand(41);
+  vector<uint8_t> oldData(1 << 16);
+  for (auto & b : oldData)
+    b = static_cast<uint8_t>(rand());
+  vector<uint8_t> newData(oldData);
+  newData[123] ^= 0xFF;
+
+  vector<uint8_t> patch;
+  {
+    MemWriter<vector<uint8_t>> writer(patch);
+    TEST(diff::MakeDiff(MemReader(oldData.data(), oldData.size()), MemReader(newData.data(), newData.size()), writer), ());
+  }
+
+  // Applying to a different old file must fail.
+  vector<uint8_t> wrongOld(oldData);
+  wrongOld[0] ^= 0xFF;
+  vector<uint8_t> rebuilt;
+  MemWriter<vector<uint8_t>> writer(rebuilt);
+  TEST(!diff::ApplyDiff(MemReader(wrongOld.data(), wrongOld.size()), MemReader(patch.data(), patch.size()), writer), ());
+
+  // A corrupted patch must fail too.
+  patch[patch.size() / 2] ^= 0xFF;
+  vector<uint8_t> rebuilt2;
+  MemWriter<vector<uint8_t>> writer2(rebuilt2);
+  TEST(!diff::ApplyDiff(MemReader(oldData.data(), oldData.size()), MemReader(patch.data(), patch.size()), writer2), ());
+}
+}  // namespace
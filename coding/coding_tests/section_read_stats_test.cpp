@@ -0,0 +1,68 @@
+#include "testing/testing.hpp"
+
+#include "coding/file_container.hpp"
+#include "coding/section_read_stats.hpp"
+#include "coding/varint.hpp"
+
+#include "base/scope_guard.hpp"
+
+#include "std/bind.hpp"
+
+UNIT_TEST(SectionReadStats_CountsReads)
+{
+  string const fName = "section_read_stats.tmp";
+  string const tag = "test_tag";
+  FileWriter::DeleteFileX(fName);
+  MY_SCOPE_GUARD(deleteFile, bind(&FileWriter::DeleteFileX, fName));
+
+  uint32_t const count = 100;
+  {
+    FilesContainerW writer(fName);
+    FileWriter w = writer.GetWriter(tag);
+    for (uint32_t j = 0; j < count; ++j)
+      WriteVarUint(w, j);
+  }
+
+  auto & entry = SectionReadStats::Instance().Register(fName, tag);
+  uint64_t const readsBefore = entry.m_reads;
+  uint64_t const bytesBefore = entry.m_bytes;
+
+  FilesContainerR reader(fName);
+  FilesContainerR::TReader r = reader.GetReader(tag);
+  ReaderSource<FilesContainerR::TReader> src(r);
+  for (uint32_t j = 0; j < count; ++j)
+    TEST_EQUAL(ReadVarUint<uint32_t>(src), j, ());
+
+  TEST_GREATER(uint64_t(entry.m_reads), readsBefore, ());
+  TEST_GREATER(uint64_t(entry.m_bytes), bytesBefore, ());
+
+  string const dump = SectionReadStats::Instance().Dump();
+  TEST(dump.find(tag) != string::npos, (dump));
+}
+
+UNIT_TEST(SectionReadStats_Disabled)
+{
+  string const fName = "section_read_stats_disabled.tmp";
+  string const tag = "test_tag_disabled";
+  FileWriter::DeleteFileX(fName);
+  MY_SCOPE_GUARD(deleteFile, bind(&FileWriter::DeleteFileX, fName));
+
+  {
+    FilesContainerW writer(fName);
+    FileWriter w = writer.GetWriter(tag);
+    WriteVarUint(w, uint32_t(777));
+  }
+
+  auto & stats = SectionReadStats::Instance();
+  auto & entry = stats.Register(fName, tag);
+
+  stats.SetEnabled(false);
+  MY_SCOPE_GUARD(enableBack, [&stats] { stats.SetEnabled(true); });
+
+  FilesContainerR reader(fName);
+  FilesContainerR::TReader r = reader.GetReader(tag);
+  ReaderSource<FilesContainerR::TReader> src(r);
+  TEST_EQUAL(ReadVarUint<uint32_t>(src), 777, ());
+
+  TEST_EQUAL(uint64_t(entry.m_reads), 0, ());
+}
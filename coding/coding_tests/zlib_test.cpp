@@ -47,4 +47,50 @@ UNIT_TEST(ZLib_Large)
 
   TestInflateDeflate(original);
 }
+
+UNIT_TEST(ZLib_Inflater)
+{
+  string original;
+  {
+    ostringstream os;
+    for (size_t i = 0; i < 1000; ++i)
+      os << i;
+    original = os.str();
+  }
+
+  string compressed;
+  TEST(ZLib::Deflate(original, ZLib::Level::BestCompression, back_inserter(compressed)), ());
+
+  ZLib::Inflater inflater;
+  vector<uint8_t> out;
+
+  // The same inflater handles consecutive payloads.
+  for (size_t round = 0; round < 2; ++round)
+  {
+    out.clear();
+    TEST(inflater.Inflate(compressed.data(), compressed.size(), out), (round));
+    TEST_EQUAL(original, string(out.begin(), out.end()), (round));
+  }
+
+  // Streaming, chunk by chunk.
+  inflater.Reset();
+  out.clear();
+  size_t const kChunkSize = 7;
+  for (size_t pos = 0; pos < compressed.size(); pos += kChunkSize)
+  {
+    size_t const size = min(kChunkSize, compressed.size() - pos);
+    TEST(inflater.OnData(compressed.data() + pos, size, out), (pos));
+  }
+  TEST(inflater.IsCompleted(), ());
+  TEST_EQUAL(original, string(out.begin(), out.end()), ());
+
+  // A corrupt payload fails and does not poison the inflater.
+  string corrupt = compressed;
+  corrupt[corrupt.size() / 2] ^= 0xff;
+  out.clear();
+  TEST(!inflater.Inflate(corrupt.data(), corrupt.size(), out), ());
+  out.clear();
+  TEST(inflater.Inflate(compressed.data(), compressed.size(), out), ());
+  TEST_EQUAL(original, string(out.begin(), out.end()), ());
+}
 }  // namespace
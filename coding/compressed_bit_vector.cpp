@@ -6,11 +6,84 @@
 #include "base/bits.hpp"
 
 #include "std/algorithm.hpp"
+#include "std/iterator.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace coding
 {
 namespace
 {
+// Computes res[i] = a[i] & b[i] for i in [0, n). The vectorized versions
+// process two bit groups per step; the scalar tail is at most one group.
+void AndBitGroups(uint64_t const * a, uint64_t const * b, uint64_t * res, size_t n)
+{
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+    __m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(res + i), _mm_and_si128(va, vb));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 2 <= n; i += 2)
+    vst1q_u64(res + i, vandq_u64(vld1q_u64(a + i), vld1q_u64(b + i)));
+#endif
+  for (; i < n; ++i)
+    res[i] = a[i] & b[i];
+}
+
+// Computes res[i] = a[i] & ~b[i] for i in [0, n).
+void AndNotBitGroups(uint64_t const * a, uint64_t const * b, uint64_t * res, size_t n)
+{
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+    __m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(res + i), _mm_andnot_si128(vb, va));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 2 <= n; i += 2)
+    vst1q_u64(res + i, vbicq_u64(vld1q_u64(a + i), vld1q_u64(b + i)));
+#endif
+  for (; i < n; ++i)
+    res[i] = a[i] & ~b[i];
+}
+
+// When one sparse vector is at least this many times shorter than the
+// other, the linear merge is replaced with galloping probes into the
+// longer vector.
+uint64_t const kGallopFactor = 32;
+
+// Returns an iterator to the first position in [it, end) that is not less
+// than |target|. Probes exponentially growing steps before the binary
+// search, so a sequence of calls with increasing targets costs
+// O(log(distance)) per call instead of O(log(size)).
+SparseCBV::TIterator Gallop(SparseCBV::TIterator it, SparseCBV::TIterator end, uint64_t target)
+{
+  size_t step = 1;
+  auto hi = it;
+  while (hi != end && *hi < target)
+  {
+    it = hi;
+    if (static_cast<size_t>(distance(hi, end)) <= step)
+    {
+      hi = end;
+      break;
+    }
+    hi += step;
+    step *= 2;
+  }
+  return lower_bound(it, hi, target);
+}
+
 struct IntersectOp
 {
   IntersectOp() {}
@@ -21,8 +94,7 @@ struct IntersectOp
     size_t sizeA = a.NumBitGroups();
     size_t sizeB = b.NumBitGroups();
     vector<uint64_t> resGroups(min(sizeA, sizeB));
-    for (size_t i = 0; i < resGroups.size(); ++i)
-      resGroups[i] = a.GetBitGroup(i) & b.GetBitGroup(i);
+    AndBitGroups(a.RawBitGroups(), b.RawBitGroups(), resGroups.data(), resGroups.size());
     return coding::CompressedBitVectorBuilder::FromBitGroups(move(resGroups));
   }
 
@@ -49,8 +121,26 @@ struct IntersectOp
   unique_ptr<coding::CompressedBitVector> operator()(coding::SparseCBV const & a,
                                                      coding::SparseCBV const & b) const
   {
+    if (a.PopCount() > b.PopCount())
+      return operator()(b, a);
+
     vector<uint64_t> resPos;
-    set_intersection(a.Begin(), a.End(), b.Begin(), b.End(), back_inserter(resPos));
+    if (a.PopCount() * kGallopFactor < b.PopCount())
+    {
+      auto it = b.Begin();
+      for (auto i = a.Begin(); i != a.End(); ++i)
+      {
+        it = Gallop(it, b.End(), *i);
+        if (it == b.End())
+          break;
+        if (*it == *i)
+          resPos.push_back(*i);
+      }
+    }
+    else
+    {
+      set_intersection(a.Begin(), a.End(), b.Begin(), b.End(), back_inserter(resPos));
+    }
     return make_unique<coding::SparseCBV>(move(resPos));
   }
 };
@@ -65,8 +155,7 @@ struct SubtractOp
     size_t sizeA = a.NumBitGroups();
     size_t sizeB = b.NumBitGroups();
     vector<uint64_t> resGroups(min(sizeA, sizeB));
-    for (size_t i = 0; i < resGroups.size(); ++i)
-      resGroups[i] = a.GetBitGroup(i) & ~b.GetBitGroup(i);
+    AndNotBitGroups(a.RawBitGroups(), b.RawBitGroups(), resGroups.data(), resGroups.size());
     return CompressedBitVectorBuilder::FromBitGroups(move(resGroups));
   }
 
@@ -289,9 +378,7 @@ DenseCBV::DenseCBV(vector<uint64_t> const & setBits)
 unique_ptr<DenseCBV> DenseCBV::BuildFromBitGroups(vector<uint64_t> && bitGroups)
 {
   unique_ptr<DenseCBV> cbv(new DenseCBV());
-  cbv->m_popCount = 0;
-  for (size_t i = 0; i < bitGroups.size(); ++i)
-    cbv->m_popCount += bits::PopCount(bitGroups[i]);
+  cbv->m_popCount = bits::PopCount(bitGroups.data(), bitGroups.size());
   cbv->m_bitGroups = move(bitGroups);
   return cbv;
 }
@@ -435,20 +522,18 @@ unique_ptr<CompressedBitVector> CompressedBitVectorBuilder::FromBitGroups(
     return make_unique<SparseCBV>(move(bitGroups));
 
   uint64_t const maxBit = kBlockSize * (bitGroups.size() - 1) + bits::FloorLog(bitGroups.back());
-  uint64_t popCount = 0;
-  for (size_t i = 0; i < bitGroups.size(); ++i)
-    popCount += bits::PopCount(bitGroups[i]);
+  uint64_t const popCount = bits::PopCount(bitGroups.data(), bitGroups.size());
 
   if (DenseEnough(popCount, maxBit))
     return DenseCBV::BuildFromBitGroups(move(bitGroups));
 
   vector<uint64_t> setBits;
+  setBits.reserve(popCount);
   for (size_t i = 0; i < bitGroups.size(); ++i)
   {
-    for (size_t j = 0; j < kBlockSize; ++j)
+    for (uint64_t group = bitGroups[i]; group != 0; group &= group - 1)
     {
-      if (((bitGroups[i] >> j) & 1) > 0)
-        setBits.push_back(kBlockSize * i + j);
+      setBits.push_back(kBlockSize * i + bits::CountTrailingZeros(group));
     }
   }
   return make_unique<SparseCBV>(setBits);
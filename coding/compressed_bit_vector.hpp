@@ -5,6 +5,7 @@
 #include "coding/writer.hpp"
 
 #include "base/assert.hpp"
+#include "base/bits.hpp"
 #include "base/ref_counted.hpp"
 
 #include "std/algorithm.hpp"
@@ -105,17 +106,19 @@ public:
   {
     for (size_t i = 0; i < m_bitGroups.size(); ++i)
     {
-      for (size_t j = 0; j < kBlockSize; ++j)
-      {
-        if (((m_bitGroups[i] >> j) & 1) > 0)
-          f(kBlockSize * i + j);
-      }
+      // Iterate set bits only, clearing the lowest one on each step.
+      for (uint64_t group = m_bitGroups[i]; group != 0; group &= group - 1)
+        f(kBlockSize * i + bits::CountTrailingZeros(group));
     }
   }
 
   // Returns 0 if the group number is too large to be contained in m_bits.
   uint64_t GetBitGroup(size_t i) const;
 
+  // Direct access to the bit groups for bulk bitwise kernels. The pointer
+  // is valid for NumBitGroups() entries.
+  uint64_t const * RawBitGroups() const { return m_bitGroups.data(); }
+
   // CompressedBitVector overrides:
   uint64_t PopCount() const override;
   bool GetBit(uint64_t pos) const override;
@@ -1,8 +1,12 @@
 #include "coding/file_container.hpp"
 #include "coding/read_write_utils.hpp"
+#include "coding/section_read_stats.hpp"
 #include "coding/write_to_sink.hpp"
 #include "coding/internal/file_data.hpp"
 
+#include "base/logging.hpp"
+#include "base/macros.hpp"
+
 #include "std/cstring.hpp"
 #include "std/sstream.hpp"
 
@@ -83,7 +87,14 @@ FilesContainerR::TReader FilesContainerR::GetReader(Tag const & tag) const
   Info const * p = GetInfo(tag);
   if (!p)
     MYTHROW(Reader::OpenException, ("Can't find section:", GetFileName(), tag));
-  return m_source.SubReader(p->m_offset, p->m_size);
+
+  ModelReaderPtr reader = m_source.SubReader(p->m_offset, p->m_size);
+
+  auto & stats = SectionReadStats::Instance();
+  if (!stats.IsEnabled())
+    return reader;
+  return ModelReaderPtr(
+      make_unique<StatsCollectingReader>(reader, stats.Register(GetFileName(), tag)));
 }
 
 pair<uint64_t, uint64_t> FilesContainerR::GetAbsoluteOffsetAndSize(Tag const & tag) const
@@ -161,7 +172,8 @@ void MappedFile::Close()
 #endif
 }
 
-MappedFile::Handle MappedFile::Map(uint64_t offset, uint64_t size, string const & tag) const
+MappedFile::Handle MappedFile::Map(uint64_t offset, uint64_t size, string const & tag,
+                                   Advice advice) const
 {
 #ifdef OMIM_OS_WINDOWS
   SYSTEM_INFO sysInfo;
@@ -178,6 +190,7 @@ MappedFile::Handle MappedFile::Map(uint64_t offset, uint64_t size, string const
   ASSERT_GREATER_OR_EQUAL(length, size, ());
 
 #ifdef OMIM_OS_WINDOWS
+  UNUSED_VALUE(advice);
   void * pMap = MapViewOfFile(m_hMapping, FILE_MAP_READ, alignedOffset >> (sizeof(DWORD) * 8), DWORD(alignedOffset), length);
   if (pMap == NULL)
     MYTHROW(Reader::OpenException, ("Can't map section:", tag, "with [offset, size]:", offset, size, "win last error:", GetLastError()));
@@ -185,6 +198,14 @@ MappedFile::Handle MappedFile::Map(uint64_t offset, uint64_t size, string const
   void * pMap = mmap(0, length, PROT_READ, MAP_SHARED, m_fd, alignedOffset);
   if (pMap == MAP_FAILED)
     MYTHROW(Reader::OpenException, ("Can't map section:", tag, "with [offset, size]:", offset, size, "errno:", strerror(errno)));
+
+  if (advice != Advice::Normal)
+  {
+    int const adv = (advice == Advice::Random ? MADV_RANDOM : MADV_SEQUENTIAL);
+    // A failed hint is harmless - log it and keep the mapping.
+    if (madvise(pMap, length, adv) != 0)
+      LOG(LWARNING, ("madvise failed for section:", tag, ", reason:", strerror(errno)));
+  }
 #endif
 
   char const * data = reinterpret_cast<char const *>(pMap);
@@ -227,14 +248,14 @@ void FilesMappingContainer::Close()
   m_name.clear();
 }
 
-FilesMappingContainer::Handle FilesMappingContainer::Map(Tag const & tag) const
+FilesMappingContainer::Handle FilesMappingContainer::Map(Tag const & tag, Advice advice) const
 {
   Info const * p = GetInfo(tag);
   if (!p)
     MYTHROW(Reader::OpenException, ("Can't find section:", m_name, tag));
 
   ASSERT_EQUAL(tag, p->m_tag, ());
-  return m_file.Map(p->m_offset, p->m_size, tag);
+  return m_file.Map(p->m_offset, p->m_size, tag, advice);
 }
 
 FileReader FilesMappingContainer::GetReader(Tag const & tag) const
@@ -266,6 +287,35 @@ void FilesMappingContainer::Handle::Assign(Handle && h)
   h.Reset();
 }
 
+uint64_t FilesMappingContainer::Handle::GetResidentSize() const
+{
+  if (!IsValid())
+    return 0;
+
+#ifdef OMIM_OS_WINDOWS
+  // No cheap residency query is available here.
+  return 0;
+#else
+  long const pageSize = sysconf(_SC_PAGE_SIZE);
+  size_t const pagesCount = static_cast<size_t>((m_origSize + pageSize - 1) / pageSize);
+
+#if defined(OMIM_OS_MAC) || defined(OMIM_OS_IPHONE)
+  typedef char TResidencyEntry;
+#else
+  typedef unsigned char TResidencyEntry;
+#endif
+  vector<TResidencyEntry> entries(pagesCount);
+  if (mincore(const_cast<char *>(m_origBase), static_cast<size_t>(m_origSize), &entries[0]) != 0)
+    return 0;
+
+  uint64_t resident = 0;
+  for (auto const e : entries)
+    if (e & 1)
+      resident += pageSize;
+  return (resident < m_origSize ? resident : m_origSize);
+#endif
+}
+
 void FilesMappingContainer::Handle::Unmap()
 {
   if (IsValid())
@@ -406,7 +456,8 @@ FileWriter FilesContainerW::GetWriter(Tag const & tag)
     ASSERT(!m_info.empty(), ());
 
     uint64_t const curr = m_info.back().m_offset + m_info.back().m_size;
-    FileWriter writer(m_name, FileWriter::OP_WRITE_EXISTING, true);
+    FileWriter writer(m_name, FileWriter::OP_WRITE_EXISTING, true /* bTruncOnClose */,
+                      FileWriter::kDefaultBufferSize);
     writer.Seek(curr);
     writer.WritePaddingByPos(kSectionAlignment);
     m_info.push_back(Info(tag, writer.Pos()));
@@ -416,7 +467,8 @@ FileWriter FilesContainerW::GetWriter(Tag const & tag)
   else
   {
     SaveCurrentSize();
-    FileWriter writer(m_name, FileWriter::OP_APPEND);
+    FileWriter writer(m_name, FileWriter::OP_APPEND, false /* bTruncOnClose */,
+                      FileWriter::kDefaultBufferSize);
     writer.WritePaddingByPos(kSectionAlignment);
     m_info.push_back(Info(tag, writer.Pos()));
     ASSERT(m_info.back().m_offset % kSectionAlignment == 0, ());
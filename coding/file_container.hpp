@@ -137,6 +137,16 @@ class MappedFile
   DISALLOW_COPY(MappedFile);
 
 public:
+  /// Access pattern hint for a mapped section, forwarded to the OS
+  /// (madvise on POSIX). Random disables read-ahead for sections with
+  /// scattered lookups, Sequential increases it for linear scans.
+  enum class Advice
+  {
+    Normal,
+    Random,
+    Sequential,
+  };
+
   MappedFile() = default;
   ~MappedFile() { Close(); }
 
@@ -171,6 +181,10 @@ public:
     bool IsValid() const { return (m_base != 0); }
     uint64_t GetSize() const { return m_size; }
 
+    /// Returns the number of mapped bytes currently resident in physical
+    /// memory (0 if the residency can't be queried on this platform).
+    uint64_t GetResidentSize() const;
+
     template <class T> T const * GetData() const
     {
       ASSERT_EQUAL(m_size % sizeof(T), 0, ());
@@ -189,7 +203,8 @@ public:
     uint64_t m_origSize;
   };
 
-  Handle Map(uint64_t offset, uint64_t size, string const & tag) const;
+  Handle Map(uint64_t offset, uint64_t size, string const & tag,
+             Advice advice = Advice::Normal) const;
 
 private:
 #ifdef OMIM_OS_WINDOWS
@@ -206,6 +221,7 @@ class FilesMappingContainer : public FilesContainerBase
 {
 public:
   typedef detail::MappedFile::Handle Handle;
+  typedef detail::MappedFile::Advice Advice;
 
   /// Do nothing by default, call Open to attach to file.
   FilesMappingContainer() = default;
@@ -216,7 +232,7 @@ public:
   void Open(string const & fName);
   void Close();
 
-  Handle Map(Tag const & tag) const;
+  Handle Map(Tag const & tag, Advice advice = Advice::Normal) const;
   FileReader GetReader(Tag const & tag) const;
 
   string const & GetName() const { return m_name; }
@@ -4,10 +4,16 @@
 #include "base/base.hpp"
 #include "base/logging.hpp"
 #include "base/exception.hpp"
+#include "base/thread.hpp"
 #include "std/algorithm.hpp"
+#include "std/condition_variable.hpp"
 #include "std/cstdlib.hpp"
+#include "std/deque.hpp"
 #include "std/functional.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/queue.hpp"
+#include "std/thread.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/string.hpp"
 #include "std/utility.hpp"
@@ -24,6 +30,11 @@ struct Sorter
   }
 };
 
+// External sorter. Chunks are sorted by a pool of worker threads while
+// the producer keeps filling the next one; the temporary file is still
+// written in chunk order from the producer thread. The final k-way
+// merge reads every chunk through a block buffer, so it does large
+// sequential reads instead of one small read per item.
 template <
     typename T,                                       // Item type.
     class OutputSinkT = FileWriter,                   // Sink to output into result file.
@@ -38,13 +49,17 @@ public:
              OutputSinkT & outputSink,
              LessT fLess = LessT()) :
   m_TmpFileName(tmpFileName),
-  m_BufferCapacity(max(size_t(16), bufferBytes / sizeof(T))),
+  // The pipeline holds up to kPipelineDepth chunks at once (one being
+  // filled, the rest queued, sorted or written), so each chunk gets a
+  // fraction of |bufferBytes| to keep the overall memory contract.
+  m_BufferCapacity(max(size_t(16), bufferBytes / sizeof(T) / kPipelineDepth)),
   m_OutputSink(outputSink),
   m_ItemCount(0),
   m_Less(fLess)
   {
     m_Buffer.reserve(m_BufferCapacity);
     m_pTmpWriter.reset(new FileWriter(tmpFileName));
+    StartWorkers();
   }
 
   void Add(T const & item)
@@ -59,23 +74,43 @@ public:
   {
     ASSERT(m_pTmpWriter.get(), ());
     FlushToTmpFile();
+    WriteSortedChunks(true /* waitAll */);
+    StopWorkers();
 
     // Write output.
     {
       m_pTmpWriter.reset();
       FileReader reader(m_TmpFileName);
+
+      uint32_t const chunksCount =
+          static_cast<uint32_t>((m_ItemCount + m_BufferCapacity - 1) / m_BufferCapacity);
+      size_t const blockItems = max(size_t(1), m_BufferCapacity / max(uint32_t(1), chunksCount));
+
+      vector<ChunkSource> sources;
+      sources.reserve(chunksCount);
+      for (uint32_t i = 0; i < chunksCount; ++i)
+      {
+        uint64_t const beg = static_cast<uint64_t>(i) * m_BufferCapacity;
+        uint64_t const end = min(beg + m_BufferCapacity, static_cast<uint64_t>(m_ItemCount));
+        sources.emplace_back(reader, beg, end, blockItems);
+      }
+
       ItemIndexPairGreater fGreater(m_Less);
       PriorityQueueType q(fGreater);
-      for (uint32_t i = 0; i < m_ItemCount; i += m_BufferCapacity)
-        Push(q, i, reader);
+      T item;
+      for (uint32_t i = 0; i < chunksCount; ++i)
+      {
+        if (sources[i].Next(item))
+          q.push(pair<T, uint32_t>(item, i));
+      }
 
       while (!q.empty())
       {
         m_OutputSink(q.top().first);
-        uint32_t const i = q.top().second + 1;
+        uint32_t const i = q.top().second;
         q.pop();
-        if (i % m_BufferCapacity != 0 && i < m_ItemCount)
-          Push(q, i, reader);
+        if (sources[i].Next(item))
+          q.push(pair<T, uint32_t>(item, i));
       }
     }
     FileWriter::DeleteFileX(m_TmpFileName);
@@ -98,9 +133,13 @@ public:
         LOG(LERROR, (e.what()));
       }
     }
+    StopWorkers();
   }
 
 private:
+  static size_t const kMaxWorkers = 4;
+  static size_t const kPipelineDepth = kMaxWorkers + 2;
+
   struct ItemIndexPairGreater
   {
     explicit ItemIndexPairGreater(LessT fLess) : m_Less(fLess) {}
@@ -114,21 +153,151 @@ private:
   typedef priority_queue<pair<T, uint32_t>, vector<pair<T, uint32_t> >, ItemIndexPairGreater>
       PriorityQueueType;
 
+  // Sequential reader of one sorted chunk, refilled a block at a time.
+  class ChunkSource
+  {
+  public:
+    ChunkSource(FileReader const & reader, uint64_t beg, uint64_t end, size_t blockItems)
+      : m_reader(reader), m_pos(beg), m_end(end), m_blockItems(blockItems), m_bufferPos(0)
+    {
+    }
+
+    bool Next(T & item)
+    {
+      if (m_bufferPos == m_buffer.size())
+      {
+        size_t const count = static_cast<size_t>(min(static_cast<uint64_t>(m_blockItems),
+                                                     m_end - m_pos));
+        if (count == 0)
+          return false;
+        m_buffer.resize(count);
+        m_reader.Read(m_pos * sizeof(T), &m_buffer[0], count * sizeof(T));
+        m_pos += count;
+        m_bufferPos = 0;
+      }
+      item = m_buffer[m_bufferPos++];
+      return true;
+    }
+
+  private:
+    FileReader const & m_reader;
+    uint64_t m_pos;
+    uint64_t const m_end;
+    size_t const m_blockItems;
+    vector<T> m_buffer;
+    size_t m_bufferPos;
+  };
+
+  void StartWorkers()
+  {
+    size_t count = thread::hardware_concurrency();
+    if (count == 0)
+      count = 2;
+    count = min(count, static_cast<size_t>(kMaxWorkers));
+    m_workers.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+      m_workers.emplace_back(&FileSorter::SortRoutine, this);
+  }
+
+  void StopWorkers()
+  {
+    {
+      lock_guard<mutex> guard(m_mutex);
+      m_finishing = true;
+    }
+    m_cv.notify_all();
+    for (auto & worker : m_workers)
+    {
+      if (worker.joinable())
+        worker.join();
+    }
+    m_workers.clear();
+  }
+
+  void SortRoutine()
+  {
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+      m_cv.wait(lock, [this]() { return m_finishing || !m_sortQueue.empty(); });
+      if (m_sortQueue.empty())
+      {
+        if (m_finishing)
+          return;
+        continue;
+      }
+
+      uint32_t const seq = m_sortQueue.front().first;
+      vector<T> chunk(move(m_sortQueue.front().second));
+      m_sortQueue.pop_front();
+      lock.unlock();
+
+      try
+      {
+        SorterT<LessT> sorter(m_Less);
+        sorter(chunk.begin(), chunk.end());
+        lock.lock();
+        m_sorted.insert(make_pair(seq, move(chunk)));
+      }
+      catch (...)
+      {
+        lock.lock();
+        m_workerError = true;
+      }
+      m_cv.notify_all();
+    }
+  }
+
+  // Writes sorted chunks to the temporary file in chunk order. With
+  // |waitAll| set it drains everything, otherwise it only blocks when
+  // too many chunks are in flight, bounding the memory held by the
+  // pipeline.
+  void WriteSortedChunks(bool waitAll)
+  {
+    unique_lock<mutex> lock(m_mutex);
+    while (m_written < m_enqueued)
+    {
+      auto it = m_sorted.find(m_written);
+      if (it == m_sorted.end())
+      {
+        if (!waitAll && m_enqueued - m_written <= m_workers.size() + 1)
+          return;
+        m_cv.wait(lock,
+                  [this]() { return m_workerError || m_sorted.count(m_written) != 0; });
+        if (m_workerError)
+          MYTHROW(RootException, ("Chunk sorting failed:", m_TmpFileName));
+        it = m_sorted.find(m_written);
+      }
+
+      vector<T> chunk(move(it->second));
+      m_sorted.erase(it);
+      lock.unlock();
+
+      m_pTmpWriter->Write(&chunk[0], chunk.size() * sizeof(T));
+
+      lock.lock();
+      ++m_written;
+    }
+    if (m_workerError)
+      MYTHROW(RootException, ("Chunk sorting failed:", m_TmpFileName));
+  }
+
   void FlushToTmpFile()
   {
     if (m_Buffer.empty())
       return;
-    SorterT<LessT> sorter(m_Less);
-    sorter(m_Buffer.begin(), m_Buffer.end());
-    m_pTmpWriter->Write(&m_Buffer[0], m_Buffer.size() * sizeof(T));
-    m_Buffer.clear();
-  }
 
-  void Push(PriorityQueueType & q, uint32_t i, FileReader const & reader)
-  {
-    T item;
-    reader.Read(static_cast<uint64_t>(i) * sizeof(T), &item, sizeof(T));
-    q.push(pair<T, uint32_t>(item, i));
+    {
+      lock_guard<mutex> guard(m_mutex);
+      m_sortQueue.push_back(make_pair(m_enqueued, move(m_Buffer)));
+      ++m_enqueued;
+    }
+    m_cv.notify_all();
+
+    m_Buffer = vector<T>();
+    m_Buffer.reserve(m_BufferCapacity);
+
+    WriteSortedChunks(false /* waitAll */);
   }
 
   string const m_TmpFileName;
@@ -138,4 +307,15 @@ private:
   vector<T> m_Buffer;
   uint32_t m_ItemCount;
   LessT m_Less;
+
+  // Chunk sorting pipeline.
+  vector<threads::SimpleThread> m_workers;
+  deque<pair<uint32_t, vector<T> > > m_sortQueue;
+  map<uint32_t, vector<T> > m_sorted;
+  uint32_t m_enqueued = 0;
+  uint32_t m_written = 0;
+  bool m_finishing = false;
+  bool m_workerError = false;
+  mutex m_mutex;
+  condition_variable m_cv;
 };
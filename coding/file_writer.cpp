@@ -1,15 +1,22 @@
 #include "coding/file_writer.hpp"
 #include "coding/internal/file_data.hpp"
 
+#include "std/algorithm.hpp"
+
 
 FileWriter::FileWriter(FileWriter && rhs)
-: m_pFileData(move(rhs.m_pFileData)), m_bTruncOnClose(rhs.m_bTruncOnClose)
+: m_pFileData(move(rhs.m_pFileData)), m_buffer(move(rhs.m_buffer)),
+  m_bufferSize(rhs.m_bufferSize), m_bTruncOnClose(rhs.m_bTruncOnClose)
 {
+  rhs.m_bufferSize = 0;
 }
 
-FileWriter::FileWriter(string const & fileName, FileWriter::Op op, bool bTruncOnClose)
-: m_pFileData(new fdata_t(fileName, static_cast<fdata_t::Op>(op))), m_bTruncOnClose(bTruncOnClose)
+FileWriter::FileWriter(string const & fileName, FileWriter::Op op, bool bTruncOnClose,
+                       size_t bufferSize)
+: m_pFileData(new fdata_t(fileName, static_cast<fdata_t::Op>(op))),
+  m_bufferSize(bufferSize), m_bTruncOnClose(bTruncOnClose)
 {
+  m_buffer.reserve(m_bufferSize);
 }
 
 FileWriter::~FileWriter()
@@ -25,17 +32,30 @@ FileWriter::~FileWriter()
 
 uint64_t FileWriter::Pos() const
 {
-  return m_pFileData->Pos();
+  return m_pFileData->Pos() + m_buffer.size();
 }
 
 void FileWriter::Seek(uint64_t pos)
 {
+  FlushBuffer();
   m_pFileData->Seek(pos);
 }
 
 void FileWriter::Write(void const * p, size_t size)
 {
-  m_pFileData->Write(p, size);
+  if (size < m_bufferSize)
+  {
+    if (m_buffer.size() + size > m_bufferSize)
+      FlushBuffer();
+    char const * pc = static_cast<char const *>(p);
+    m_buffer.insert(m_buffer.end(), pc, pc + size);
+  }
+  else
+  {
+    // A write this big goes to the file directly, after the gathered slices.
+    FlushBuffer();
+    m_pFileData->Write(p, size);
+  }
 }
 
 void FileWriter::WritePaddingByEnd(size_t factor) { WritePadding(Size(), factor); }
@@ -49,11 +69,12 @@ string const & FileWriter::GetName() const
 
 uint64_t FileWriter::Size() const
 {
-  return m_pFileData->Size();
+  return max(m_pFileData->Size(), Pos());
 }
 
 void FileWriter::Flush()
 {
+  FlushBuffer();
   m_pFileData->Flush();
 }
 
@@ -61,6 +82,7 @@ void FileWriter::Reserve(uint64_t size)
 {
   if (size > 0)
   {
+    FlushBuffer();
     m_pFileData->Seek(size-1);
     uint8_t b = 0;
     m_pFileData->Write(&b, 1);
@@ -72,6 +94,14 @@ void FileWriter::DeleteFileX(string const & fName)
   (void)my::DeleteFileX(fName);
 }
 
+void FileWriter::FlushBuffer()
+{
+  if (m_buffer.empty())
+    return;
+  m_pFileData->Write(m_buffer.data(), m_buffer.size());
+  m_buffer.clear();
+}
+
 void FileWriter::WritePadding(uint64_t offset, uint64_t factor)
 {
   ASSERT(factor > 1, ());
@@ -2,6 +2,7 @@
 #include "coding/writer.hpp"
 #include "base/base.hpp"
 #include "std/unique_ptr.hpp"
+#include "std/vector.hpp"
 
 namespace my { class FileData; }
 
@@ -25,10 +26,18 @@ public:
     OP_APPEND = 3
   };
 
+  /// Buffer size used by the writers of FilesContainerW sections.
+  static size_t const kDefaultBufferSize = 1 << 20;
+
   FileWriter(FileWriter && rhs);
 
+  /// @param[in] bufferSize If nonzero, small writes are gathered into an internal
+  /// buffer of this size and flushed to the file in one call, amortizing the
+  /// per-call overhead of many tiny writes (varints, 4-byte sizes, ...).
+  /// Pos(), Seek() and Size() stay exact in the buffered mode.
   explicit FileWriter(string const & fileName,
-                      Op operation = OP_WRITE_TRUNCATE, bool bTruncOnClose = false);
+                      Op operation = OP_WRITE_TRUNCATE, bool bTruncOnClose = false,
+                      size_t bufferSize = 0);
   ~FileWriter() override;
 
   void Seek(uint64_t pos) override;
@@ -51,7 +60,11 @@ private:
   typedef my::FileData fdata_t;
 
   void WritePadding(uint64_t offset, uint64_t factor);
+  void FlushBuffer();
 
   unique_ptr<fdata_t> m_pFileData;
+  // Gather buffer for the buffered mode; unused (capacity 0) otherwise.
+  vector<char> m_buffer;
+  size_t m_bufferSize;
   bool m_bTruncOnClose;
 };
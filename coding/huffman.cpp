@@ -14,6 +14,7 @@ void HuffmanCoder::Init(vector<strings::UniString> const & data)
   DeleteHuffmanTree(m_root);
   BuildHuffmanTree(data.begin(), data.end());
   BuildTables(m_root, 0);
+  BuildDecoderLookup();
 }
 
 bool HuffmanCoder::Encode(uint32_t symbol, Code & code) const
@@ -49,6 +50,24 @@ void HuffmanCoder::BuildTables(Node * root, uint32_t path)
   BuildTables(root->r, path + (static_cast<uint32_t>(1) << root->depth));
 }
 
+void HuffmanCoder::BuildDecoderLookup()
+{
+  m_decoderLookup.assign(static_cast<size_t>(1) << CHAR_BIT, TableEntry());
+  for (auto const & kv : m_decoderTable)
+  {
+    Code const & code = kv.first;
+    if (code.len == 0 || code.len > CHAR_BIT)
+      continue;
+    // Fill every 8-bit extension of the code with the same entry.
+    uint32_t const step = static_cast<uint32_t>(1) << code.len;
+    for (size_t i = code.bits; i < m_decoderLookup.size(); i += step)
+    {
+      m_decoderLookup[i].m_symbol = kv.second;
+      m_decoderLookup[i].m_len = static_cast<uint8_t>(code.len);
+    }
+  }
+}
+
 void HuffmanCoder::DeleteHuffmanTree(Node * root)
 {
   if (!root)
@@ -98,6 +98,8 @@ public:
       cur->isLeaf = true;
       cur->symbol = symbol;
     }
+
+    BuildDecoderLookup();
   }
 
   bool Encode(uint32_t symbol, Code & code) const;
@@ -119,12 +121,38 @@ public:
   template <typename TSource>
   strings::UniString ReadAndDecode(TSource & src) const
   {
-    BitReader<TSource> bitReader(src);
-    size_t sz = static_cast<size_t>(ReadVarUint<uint32_t, TSource>(src));
-    vector<strings::UniChar> v(sz);
+    strings::UniString s;
+    ReadAndDecode(src, s);
+    return s;
+  }
+
+  // Same as above but decodes into |s|, which lets the caller reuse
+  // the string's storage. Symbols are decoded through a byte-indexed
+  // lookup table, so codes of up to 8 bits cost a single lookup
+  // instead of a bit-by-bit tree walk.
+  template <typename TSource>
+  void ReadAndDecode(TSource & src, strings::UniString & s) const
+  {
+    size_t const sz = static_cast<size_t>(ReadVarUint<uint32_t, TSource>(src));
+    s.resize(sz);
+    // Bits not yet consumed, next code starting at the least significant bit.
+    uint32_t acc = 0;
+    uint32_t avail = 0;
     for (size_t i = 0; i < sz; ++i)
-      v[i] = static_cast<strings::UniChar>(ReadAndDecode(bitReader));
-    return strings::UniString(v.begin(), v.end());
+      s[i] = static_cast<strings::UniChar>(DecodeSymbol(src, acc, avail));
+  }
+
+  // Batch-decodes |count| strings written one after another by
+  // EncodeAndWrite, appending them to |out|.
+  template <typename TSource>
+  void ReadAndDecode(TSource & src, size_t count, vector<strings::UniString> & out) const
+  {
+    out.reserve(out.size() + count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      out.push_back(strings::UniString());
+      ReadAndDecode(src, out.back());
+    }
   }
 
 private:
@@ -171,28 +199,70 @@ private:
     return code.len;
   }
 
+  // An entry of the byte-indexed decoding table. A nonzero m_len means
+  // that the low m_len bits of the index form a complete code for
+  // m_symbol; a zero m_len means the code continues beyond 8 bits.
+  struct TableEntry
+  {
+    uint32_t m_symbol = 0;
+    uint8_t m_len = 0;
+  };
+
+  // Decodes one symbol from |src|, keeping the bits read but not yet
+  // consumed in |acc| (next code starting at the least significant
+  // bit, |avail| valid bits). A byte of |src| is read only when the
+  // current code is known to extend into it, so the decoder never
+  // looks past the encoded data.
   template <typename TSource>
-  uint32_t ReadAndDecode(BitReader<TSource> & bitReader) const
+  uint32_t DecodeSymbol(TSource & src, uint32_t & acc, uint32_t & avail) const
   {
-    Node * cur = m_root;
-    while (cur)
+    CHECK(m_root != nullptr, ("Could not decode a Huffman-encoded symbol."));
+    if (m_root->isLeaf)
+      return m_root->symbol;  // The single zero-length code.
+
+    for (;;)
+    {
+      TableEntry const & e = m_decoderLookup[acc & 0xFF];
+      if (e.m_len != 0 && e.m_len <= avail)
+      {
+        acc >>= e.m_len;
+        avail -= e.m_len;
+        return e.m_symbol;
+      }
+      if (avail >= CHAR_BIT)
+        break;
+      uint8_t b;
+      src.Read(&b, 1);
+      acc |= static_cast<uint32_t>(b) << avail;
+      avail += CHAR_BIT;
+    }
+
+    // A code longer than 8 bits; these are rare, walk the tree.
+    Node const * cur = m_root;
+    while (cur != nullptr && !cur->isLeaf)
     {
-      if (cur->isLeaf)
-        return cur->symbol;
-      uint8_t bit = bitReader.Read(1);
-      if (bit == 0)
-        cur = cur->l;
-      else
-        cur = cur->r;
+      if (avail == 0)
+      {
+        uint8_t b;
+        src.Read(&b, 1);
+        acc = b;
+        avail = CHAR_BIT;
+      }
+      cur = ((acc & 1) == 0) ? cur->l : cur->r;
+      acc >>= 1;
+      --avail;
     }
-    CHECK(false, ("Could not decode a Huffman-encoded symbol."));
-    return 0;
+    CHECK(cur != nullptr, ("Could not decode a Huffman-encoded symbol."));
+    return cur->symbol;
   }
 
   // Converts a Huffman tree into the more convenient representation
   // of encoding and decoding tables.
   void BuildTables(Node * root, uint32_t path);
 
+  // Fills m_decoderLookup from m_decoderTable.
+  void BuildDecoderLookup();
+
   void DeleteHuffmanTree(Node * root);
 
   // Builds a fixed Huffman tree for a collection of strings::UniStrings.
@@ -261,6 +331,10 @@ private:
   Node * m_root;  // m_pRoot?
   map<Code, uint32_t> m_decoderTable;
   map<uint32_t, Code> m_encoderTable;
+  // 2^8 entries indexed by the next 8 bits of the stream (garbage
+  // beyond the end of a short code does not matter: every extension of
+  // a code maps to the same entry).
+  vector<TableEntry> m_decoderLookup;
 };
 
 }  // namespace coding
@@ -0,0 +1,252 @@
+#include "coding/mwm_diff.hpp"
+
+#include "coding/varint.hpp"
+#include "coding/write_to_sink.hpp"
+#include "coding/writer.hpp"
+
+#include "base/assert.hpp"
+#include "base/logging.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/cstring.hpp"
+#include "std/unordered_map.hpp"
+#include "std/vector.hpp"
+
+#include "zlib.h"
+
+namespace diff
+{
+namespace
+{
+uint32_t const kVersion = 1;
+// The granularity of the old-file block table. Smaller blocks find
+// more matches but grow the table; 4 KB works well for mwm sections.
+uint32_t const kBlockSize = 1 << 12;
+size_t const kChecksumChunkSize = 1 << 20;
+
+uint32_t Checksum(Reader const & reader)
+{
+  uLong crc = crc32(0L, Z_NULL, 0);
+  uint64_t const size = reader.Size();
+  vector<uint8_t> buffer(static_cast<size_t>(min(size, static_cast<uint64_t>(kChecksumChunkSize))));
+  for (uint64_t pos = 0; pos < size;)
+  {
+    size_t const n = static_cast<size_t>(min(size - pos, static_cast<uint64_t>(buffer.size())));
+    reader.Read(pos, buffer.data(), n);
+    crc = crc32(crc, buffer.data(), static_cast<uInt>(n));
+    pos += n;
+  }
+  return static_cast<uint32_t>(crc);
+}
+
+// The rsync rolling checksum of a kBlockSize window.
+struct RollingChecksum
+{
+  uint32_t m_s1 = 0;
+  uint32_t m_s2 = 0;
+
+  void Init(uint8_t const * p)
+  {
+    m_s1 = m_s2 = 0;
+    for (uint32_t i = 0; i < kBlockSize; ++i)
+    {
+      m_s1 += p[i];
+      m_s2 += (kBlockSize - i) * p[i];
+    }
+  }
+
+  void Roll(uint8_t out, uint8_t in)
+  {
+    m_s1 += in - out;
+    m_s2 += m_s1 - kBlockSize * out;
+  }
+
+  uint32_t Get() const { return (m_s2 << 16) | (m_s1 & 0xFFFF); }
+};
+}  // namespace
+
+bool MakeDiff(Reader const & oldReader, Reader const & newReader, Writer & patchWriter)
+{
+  vector<uint8_t> oldData(static_cast<size_t>(oldReader.Size()));
+  if (!oldData.empty())
+    oldReader.Read(0, oldData.data(), oldData.size());
+  vector<uint8_t> newData(static_cast<size_t>(newReader.Size()));
+  if (!newData.empty())
+    newReader.Read(0, newData.data(), newData.size());
+
+  // Block table of the old file: weak checksum -> block offsets.
+  unordered_map<uint32_t, vector<uint64_t>> blocks;
+  for (uint64_t off = 0; off + kBlockSize <= oldData.size(); off += kBlockSize)
+  {
+    RollingChecksum cs;
+    cs.Init(&oldData[off]);
+    blocks[cs.Get()].push_back(off);
+  }
+
+  vector<uint8_t> patch;
+  MemWriter<vector<uint8_t>> writer(patch);
+
+  WriteVarUint(writer, kVersion);
+  WriteVarUint(writer, kBlockSize);
+  WriteVarUint(writer, static_cast<uint64_t>(oldData.size()));
+  WriteVarUint(writer, static_cast<uint64_t>(newData.size()));
+  WriteToSink(writer, Checksum(oldReader));
+  WriteToSink(writer, Checksum(newReader));
+
+  // The operation stream alternates literal runs and copies:
+  //   VarUint literal size, the literal bytes,
+  //   VarUint copy size, VarInt copy offset delta.
+  // The trailing copy is omitted when the literals reach the file end.
+  uint64_t literalBegin = 0;  // First new-file byte not yet emitted.
+  uint64_t prevCopyEnd = 0;   // Copy offsets are delta-coded against this.
+  uint64_t pos = 0;
+  RollingChecksum cs;
+  bool checksumValid = false;
+
+  while (pos + kBlockSize <= newData.size())
+  {
+    if (!checksumValid)
+    {
+      cs.Init(&newData[pos]);
+      checksumValid = true;
+    }
+
+    uint64_t matchOff = 0;
+    bool found = false;
+    auto const it = blocks.find(cs.Get());
+    if (it != blocks.end())
+    {
+      for (uint64_t off : it->second)
+      {
+        if (memcmp(&oldData[off], &newData[pos], kBlockSize) == 0)
+        {
+          matchOff = off;
+          found = true;
+          break;
+        }
+      }
+    }
+
+    if (!found)
+    {
+      cs.Roll(newData[pos], newData[pos + kBlockSize]);
+      ++pos;
+      continue;
+    }
+
+    // Extend the match forward past the block.
+    uint64_t len = kBlockSize;
+    while (matchOff + len < oldData.size() && pos + len < newData.size() &&
+           oldData[matchOff + len] == newData[pos + len])
+    {
+      ++len;
+    }
+
+    WriteVarUint(writer, pos - literalBegin);
+    if (pos > literalBegin)
+      writer.Write(&newData[literalBegin], static_cast<size_t>(pos - literalBegin));
+    WriteVarUint(writer, len);
+    WriteVarInt(writer, static_cast<int64_t>(matchOff) - static_cast<int64_t>(prevCopyEnd));
+
+    prevCopyEnd = matchOff + len;
+    pos += len;
+    literalBegin = pos;
+    checksumValid = false;
+  }
+
+  // Trailing literals.
+  WriteVarUint(writer, newData.size() - literalBegin);
+  if (newData.size() > literalBegin)
+    writer.Write(&newData[literalBegin], static_cast<size_t>(newData.size() - literalBegin));
+
+  if (patch.size() >= newData.size())
+    return false;
+
+  patchWriter.Write(patch.data(), patch.size());
+  return true;
+}
+
+bool ApplyDiff(Reader const & oldReader, Reader const & patchReader, Writer & newWriter)
+try
+{
+  NonOwningReaderSource src(patchReader);
+
+  if (ReadVarUint<uint32_t>(src) != kVersion)
+  {
+    LOG(LWARNING, ("Unsupported patch version."));
+    return false;
+  }
+  ReadVarUint<uint32_t>(src);  // Block size, not needed to apply.
+  uint64_t const oldSize = ReadVarUint<uint64_t>(src);
+  uint64_t const newSize = ReadVarUint<uint64_t>(src);
+  uint32_t const oldCrc = ReadPrimitiveFromSource<uint32_t>(src);
+  uint32_t const newCrc = ReadPrimitiveFromSource<uint32_t>(src);
+
+  if (oldReader.Size() != oldSize || Checksum(oldReader) != oldCrc)
+  {
+    LOG(LWARNING, ("The patch does not match the old file."));
+    return false;
+  }
+
+  uLong crc = crc32(0L, Z_NULL, 0);
+  vector<uint8_t> buffer(kChecksumChunkSize);
+  uint64_t written = 0;
+  uint64_t prevCopyEnd = 0;
+
+  auto const write = [&](size_t n)
+  {
+    crc = crc32(crc, buffer.data(), static_cast<uInt>(n));
+    newWriter.Write(buffer.data(), n);
+    written += n;
+  };
+
+  while (written < newSize)
+  {
+    uint64_t literal = ReadVarUint<uint64_t>(src);
+    if (written + literal > newSize)
+    {
+      LOG(LWARNING, ("Malformed patch operation."));
+      return false;
+    }
+    for (; literal != 0;)
+    {
+      size_t const n = static_cast<size_t>(min(literal, static_cast<uint64_t>(buffer.size())));
+      src.Read(buffer.data(), n);
+      write(n);
+      literal -= n;
+    }
+    if (written == newSize)
+      break;
+
+    uint64_t copy = ReadVarUint<uint64_t>(src);
+    uint64_t const copyStart =
+        static_cast<uint64_t>(static_cast<int64_t>(prevCopyEnd) + ReadVarInt<int64_t>(src));
+    if (copy == 0 || copyStart + copy > oldSize || written + copy > newSize)
+    {
+      LOG(LWARNING, ("Malformed patch operation."));
+      return false;
+    }
+    prevCopyEnd = copyStart + copy;
+    for (uint64_t off = copyStart; copy != 0;)
+    {
+      size_t const n = static_cast<size_t>(min(copy, static_cast<uint64_t>(buffer.size())));
+      oldReader.Read(off, buffer.data(), n);
+      write(n);
+      off += n;
+      copy -= n;
+    }
+  }
+
+  if (static_cast<uint32_t>(crc) != newCrc)
+  {
+    LOG(LWARNING, ("Checksum mismatch after applying the patch."));
+    return false;
+  }
+  return true;
+}
+catch (Reader::Exception const & e)
+{
+  LOG(LWARNING, ("Truncated or malformed patch:", e.Msg()));
+  return false;
+}
+}  // namespace diff
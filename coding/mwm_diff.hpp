@@ -0,0 +1,29 @@
+#pragma once
+
+#include "coding/reader.hpp"
+#include "coding/writer.hpp"
+
+namespace diff
+{
+// Block-based binary diff between two versions of a file.
+//
+// The patch stores a header (format version, block size, sizes and
+// crc32 checksums of both files) followed by an operation stream: runs
+// of literal bytes interleaved with copies from arbitrary offsets of
+// the old file. The maker hashes the old file in fixed blocks and
+// scans the new file with a rolling checksum (the rsync scheme), so a
+// monthly update that changes a few percent of an mwm yields a patch
+// of roughly the changed bytes.
+
+// Writes a patch transforming |oldReader|'s contents into
+// |newReader|'s. Loads both files into memory, so this is meant for
+// the generator side. Returns false if the patch would not be smaller
+// than the new file; nothing useful is written in that case.
+bool MakeDiff(Reader const & oldReader, Reader const & newReader, Writer & patchWriter);
+
+// Rebuilds the new file from |oldReader| and |patchReader| into
+// |newWriter|. The old file is read by offset, not loaded into
+// memory. Returns false if the patch version is unsupported or either
+// checksum does not match; the written data must be discarded then.
+bool ApplyDiff(Reader const & oldReader, Reader const & patchReader, Writer & newWriter);
+}  // namespace diff
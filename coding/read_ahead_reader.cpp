@@ -0,0 +1,139 @@
+#include "coding/read_ahead_reader.hpp"
+
+#include "base/logging.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/cstring.hpp"
+#include "std/utility.hpp"
+
+ReadAheadReader::ReadAheadReader(ModelReaderPtr reader, size_t chunkSize)
+  : ModelReader(reader.GetName()),
+    m_reader(reader),
+    m_size(reader.Size()),
+    m_chunkSize(chunkSize)
+{
+  ASSERT_GREATER(chunkSize, 0, ());
+
+  m_current.m_data.resize(m_chunkSize);
+  m_next.m_data.resize(m_chunkSize);
+  m_thread = threads::SimpleThread(&ReadAheadReader::FetchRoutine, this);
+}
+
+ReadAheadReader::~ReadAheadReader()
+{
+  {
+    lock_guard<mutex> guard(m_mutex);
+    m_finishing = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+}
+
+void ReadAheadReader::Read(uint64_t pos, void * p, size_t size) const
+{
+  if (pos + size > m_size)
+    MYTHROW(Reader::SizeException, (pos, size, m_size));
+
+  char * dst = static_cast<char *>(p);
+  while (size > 0)
+  {
+    if (m_current.m_size == 0 || pos < m_current.m_pos ||
+        pos >= m_current.m_pos + m_current.m_size)
+    {
+      unique_lock<mutex> lock(m_mutex);
+      AdvanceTo(pos, lock);
+    }
+
+    size_t const offset = static_cast<size_t>(pos - m_current.m_pos);
+    size_t const count = min(size, m_current.m_size - offset);
+    memcpy(dst, &m_current.m_data[offset], count);
+
+    dst += count;
+    pos += count;
+    size -= count;
+  }
+}
+
+unique_ptr<Reader> ReadAheadReader::CreateSubReader(uint64_t pos, uint64_t size) const
+{
+  unique_lock<mutex> lock(m_mutex);
+  DrainFetch(lock);
+  return m_reader.GetPtr()->CreateSubReader(pos, size);
+}
+
+void ReadAheadReader::DrainFetch(unique_lock<mutex> & lock) const
+{
+  m_cv.wait(lock, [this]() { return !m_fetchRequested; });
+}
+
+size_t ReadAheadReader::ChunkSizeAt(uint64_t pos) const
+{
+  uint64_t const left = m_size - pos;
+  return (left < m_chunkSize ? static_cast<size_t>(left) : m_chunkSize);
+}
+
+void ReadAheadReader::AdvanceTo(uint64_t pos, unique_lock<mutex> & lock) const
+{
+  // The background thread is the only other user of the underlying
+  // reader, so an in-flight read has to finish first.
+  DrainFetch(lock);
+
+  uint64_t const chunkPos = (pos / m_chunkSize) * m_chunkSize;
+
+  if (!m_fetchFailed && m_next.m_size != 0 && m_next.m_pos == chunkPos)
+  {
+    swap(m_current, m_next);
+  }
+  else
+  {
+    // Random access or a failed prefetch - read synchronously. A failure
+    // rethrows here, on the calling thread, if the bytes are needed.
+    m_current.m_pos = chunkPos;
+    m_current.m_size = ChunkSizeAt(chunkPos);
+    m_reader.Read(chunkPos, m_current.m_data.data(), m_current.m_size);
+  }
+
+  m_fetchFailed = false;
+  m_next.m_size = 0;
+
+  uint64_t const nextPos = chunkPos + m_current.m_size;
+  if (nextPos < m_size)
+  {
+    m_fetchPos = nextPos;
+    m_fetchRequested = true;
+    m_cv.notify_all();
+  }
+}
+
+void ReadAheadReader::FetchRoutine()
+{
+  unique_lock<mutex> lock(m_mutex);
+  while (true)
+  {
+    m_cv.wait(lock, [this]() { return m_fetchRequested || m_finishing; });
+    if (m_finishing)
+      return;
+
+    uint64_t const pos = m_fetchPos;
+    size_t const count = ChunkSizeAt(pos);
+    lock.unlock();
+
+    bool failed = false;
+    try
+    {
+      m_reader.Read(pos, m_next.m_data.data(), count);
+    }
+    catch (Reader::Exception const & e)
+    {
+      LOG(LWARNING, ("Read-ahead failed for", GetName(), ":", e.Msg()));
+      failed = true;
+    }
+
+    lock.lock();
+    m_next.m_pos = pos;
+    m_next.m_size = (failed ? 0 : count);
+    m_fetchFailed = failed;
+    m_fetchRequested = false;
+    m_cv.notify_all();
+  }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "coding/reader.hpp"
+
+#include "base/thread.hpp"
+
+#include "std/condition_variable.hpp"
+#include "std/mutex.hpp"
+#include "std/noncopyable.hpp"
+#include "std/vector.hpp"
+
+// Reader decorator for strictly-forward consumers: while the caller
+// decodes the current chunk, a background thread fetches the next one
+// from the underlying reader, overlapping I/O with decoding. Reads
+// outside the prefetched window fall back to a synchronous read, so
+// occasional random access stays correct, just not faster.
+//
+// Like any Reader it is not thread-safe for concurrent callers.
+class ReadAheadReader : public ModelReader, private noncopyable
+{
+public:
+  static size_t const kDefaultChunkSize = 1 << 20;
+
+  explicit ReadAheadReader(ModelReaderPtr reader, size_t chunkSize = kDefaultChunkSize);
+  ~ReadAheadReader() override;
+
+  // Reader overrides:
+  uint64_t Size() const override { return m_size; }
+  void Read(uint64_t pos, void * p, size_t size) const override;
+
+  /// Subreaders are served by the underlying reader and bypass the
+  /// read-ahead. Don't interleave their use with reads through this
+  /// reader - the underlying reader is not thread-safe.
+  unique_ptr<Reader> CreateSubReader(uint64_t pos, uint64_t size) const override;
+
+private:
+  struct Chunk
+  {
+    vector<char> m_data;
+    uint64_t m_pos = 0;
+    // 0 means the chunk holds nothing.
+    size_t m_size = 0;
+  };
+
+  void FetchRoutine();
+
+  /// Makes |m_current| hold the chunk containing |pos| and schedules a
+  /// prefetch of the chunk after it. |lock| must hold |m_mutex|.
+  void AdvanceTo(uint64_t pos, unique_lock<mutex> & lock) const;
+
+  /// Waits until the background thread has no read in flight.
+  void DrainFetch(unique_lock<mutex> & lock) const;
+
+  size_t ChunkSizeAt(uint64_t pos) const;
+
+  ModelReaderPtr m_reader;
+  uint64_t const m_size;
+  size_t const m_chunkSize;
+
+  // Read() is const in the Reader interface, so all state is mutable.
+  // |m_current| is touched only by the calling thread, |m_next| only by
+  // the background thread while a fetch is in flight.
+  mutable Chunk m_current;
+  mutable Chunk m_next;
+  mutable bool m_fetchRequested = false;
+  mutable bool m_fetchFailed = false;
+  mutable bool m_finishing = false;
+  mutable uint64_t m_fetchPos = 0;
+  mutable mutex m_mutex;
+  mutable condition_variable m_cv;
+  threads::SimpleThread m_thread;
+};
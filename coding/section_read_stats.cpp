@@ -0,0 +1,80 @@
+#include "coding/section_read_stats.hpp"
+
+#include "base/timer.hpp"
+
+#include "std/sstream.hpp"
+
+// static
+SectionReadStats & SectionReadStats::Instance()
+{
+  static SectionReadStats instance;
+  return instance;
+}
+
+SectionReadStats::Entry & SectionReadStats::Register(string const & file, string const & tag)
+{
+  lock_guard<mutex> lock(m_mu);
+  auto & entry = m_entries[make_pair(file, tag)];
+  if (!entry)
+    entry.reset(new Entry());
+  return *entry;
+}
+
+string SectionReadStats::Dump()
+{
+  lock_guard<mutex> lock(m_mu);
+
+  ostringstream ss;
+  ss << "Mwm section reads:\n";
+  for (auto const & e : m_entries)
+  {
+    uint64_t const reads = e.second->m_reads;
+    if (reads == 0)
+      continue;
+
+    uint64_t const bytes = e.second->m_bytes;
+    uint64_t const timeUs = e.second->m_timeUs;
+    ss << " " << e.first.first << " [" << e.first.second << "]: "
+       << "reads " << reads << ", bytes " << bytes
+       << ", time " << timeUs / 1000 << " ms"
+       << ", avg " << timeUs / reads << " us\n";
+  }
+  return ss.str();
+}
+
+void SectionReadStats::Reset()
+{
+  lock_guard<mutex> lock(m_mu);
+  for (auto const & e : m_entries)
+  {
+    e.second->m_reads = 0;
+    e.second->m_bytes = 0;
+    e.second->m_timeUs = 0;
+  }
+}
+
+// StatsCollectingReader ---------------------------------------------------------------------------
+StatsCollectingReader::StatsCollectingReader(ModelReaderPtr reader, SectionReadStats::Entry & entry)
+  : ModelReader(reader.GetName()), m_reader(reader), m_entry(entry)
+{
+}
+
+uint64_t StatsCollectingReader::Size() const
+{
+  return m_reader.Size();
+}
+
+void StatsCollectingReader::Read(uint64_t pos, void * p, size_t size) const
+{
+  my::Timer timer;
+  m_reader.Read(pos, p, size);
+
+  m_entry.m_reads += 1;
+  m_entry.m_bytes += size;
+  m_entry.m_timeUs += timer.TimeElapsedAs<std::chrono::microseconds>().count();
+}
+
+unique_ptr<Reader> StatsCollectingReader::CreateSubReader(uint64_t pos, uint64_t size) const
+{
+  return make_unique<StatsCollectingReader>(m_reader.SubReader(pos, size), m_entry);
+}
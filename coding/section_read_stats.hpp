@@ -0,0 +1,67 @@
+#pragma once
+#include "coding/reader.hpp"
+
+#include "std/atomic.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
+#include "std/noncopyable.hpp"
+#include "std/string.hpp"
+#include "std/unique_ptr.hpp"
+#include "std/utility.hpp"
+
+// Always-on counters of reads, bytes and wall time per mwm container
+// section (FEATURES_FILE_TAG, SEARCH_INDEX_FILE_TAG, ...). Shows which
+// sections actually cost I/O in the field, so preload and caching
+// strategies can be planned from data instead of guesses.
+class SectionReadStats : private noncopyable
+{
+public:
+  struct Entry
+  {
+    atomic<uint64_t> m_reads{0};
+    atomic<uint64_t> m_bytes{0};
+    atomic<uint64_t> m_timeUs{0};
+  };
+
+  static SectionReadStats & Instance();
+
+  /// Returns counters for section |tag| of container |file|, creating
+  /// them on first use. Entries are never removed, so the reference
+  /// stays valid for the whole process lifetime.
+  Entry & Register(string const & file, string const & tag);
+
+  /// A read can be disabled entirely (readers are returned unwrapped),
+  /// e.g. for benchmarks measuring raw I/O.
+  void SetEnabled(bool enabled) { m_enabled = enabled; }
+  bool IsEnabled() const { return m_enabled; }
+
+  string Dump();
+  /// Zeroes all counters, e.g. between measurement scenarios.
+  void Reset();
+
+private:
+  SectionReadStats() = default;
+
+  atomic<bool> m_enabled{true};
+
+  mutex m_mu;
+  // Entries are heap-allocated: counters are updated without |m_mu|.
+  map<pair<string, string>, unique_ptr<Entry>> m_entries;
+};
+
+// ModelReader decorator attributing all reads (including reads through
+// sub readers) to one section's counters.
+class StatsCollectingReader : public ModelReader
+{
+public:
+  StatsCollectingReader(ModelReaderPtr reader, SectionReadStats::Entry & entry);
+
+  // Reader overrides:
+  uint64_t Size() const override;
+  void Read(uint64_t pos, void * p, size_t size) const override;
+  unique_ptr<Reader> CreateSubReader(uint64_t pos, uint64_t size) const override;
+
+private:
+  ModelReaderPtr m_reader;
+  SectionReadStats::Entry & m_entry;
+};
@@ -25,7 +25,7 @@ namespace stream
 
     ReaderStream & operator >> (string & t)
     {
-      detail::ReadString(*this, t);
+      detail::ReadString(*this, m_reader, t);
       return *this;
     }
   };
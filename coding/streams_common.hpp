@@ -9,20 +9,16 @@ namespace stream
 {
   namespace detail
   {
-    template <class TStream>
-    void ReadString(TStream & s, string & t)
+    // Reads the string in one call instead of char by char; reusing
+    // the same string between records also reuses its storage.
+    template <class TStream, class TReader>
+    void ReadString(TStream & s, TReader & r, string & t)
     {
       uint32_t count;
       s >> count;
-      t.reserve(count);
-
-      while (count > 0)
-      {
-        char c;
-        s >> c;
-        t.push_back(c);
-        --count;
-      }
+      t.resize(count);
+      if (count > 0)
+        r.Read(&t[0], count);
     }
 
     template <class TStream, class TWriter>
@@ -32,7 +32,7 @@ namespace stream
 
     SinkReaderStream & operator >> (string & t)
     {
-      detail::ReadString(*this, t);
+      detail::ReadString(*this, m_reader, t);
       return *this;
     }
 
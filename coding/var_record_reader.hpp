@@ -72,6 +72,15 @@ public:
     ASSERT_EQUAL(pos, m_ReaderSize, ());
   }
 
+  uint64_t Size() const { return m_ReaderSize; }
+
+  // Raw read of [pos, pos + size), not aligned to record boundaries.
+  void Read(uint64_t pos, void * p, size_t size) const
+  {
+    ASSERT_LESS_OR_EQUAL(pos + size, m_ReaderSize, ());
+    m_Reader.Read(pos, p, size);
+  }
+
   bool IsEqual(string const & fName) const { return m_Reader.IsEqual(fName); }
 
 protected:
@@ -8,6 +8,7 @@
 #include "base/exception.hpp"
 #include "base/stl_add.hpp"
 
+#include "std/cstring.hpp"
 #include "std/string.hpp"
 #include "std/type_traits.hpp"
 
@@ -274,3 +275,59 @@ void const * ReadVarUint64Array(void const * pBeg, size_t count, F f)
   return impl::ReadVarInt64Array(pBeg, impl::ReadVarInt64ArrayGivenSize(count), f, IdFunctor());
 }
 
+/// Decodes varuints from the contiguous buffer [pBeg, pEnd) into |out| until
+/// either |count| values are decoded or the buffer ends. Unlike the per-byte
+/// readers above this works word-at-a-time: one 8-byte load covers a whole
+/// varint of up to 8 bytes, with a single branch on the continuation mask.
+/// Returns the number of decoded values. |out| must have room for |count|.
+inline size_t ReadVarUint64Block(void const * pBeg, void const * pEnd, size_t count,
+                                 uint64_t * out)
+{
+  uint8_t const * p = static_cast<uint8_t const *>(pBeg);
+  uint8_t const * const end = static_cast<uint8_t const *>(pEnd);
+
+  size_t decoded = 0;
+  while (decoded < count && p != end)
+  {
+    if (end - p >= 8)
+    {
+      uint64_t w;
+      memcpy(&w, p, sizeof(w));
+      uint64_t const stops = ~w & 0x8080808080808080ULL;
+      if (stops != 0)
+      {
+        // The first byte without a continuation bit ends the varint.
+        size_t const len = (bits::CountTrailingZeros(stops) >> 3) + 1;
+        if (len < 8)
+          w &= (static_cast<uint64_t>(1) << (8 * len)) - 1;
+        // Compact the eight 7-bit groups into the low 56 bits.
+        w &= 0x7f7f7f7f7f7f7f7fULL;
+        w = (w & 0x007f007f007f007fULL) | ((w & 0x7f007f007f007f00ULL) >> 1);
+        w = (w & 0x00003fff00003fffULL) | ((w & 0x3fff00003fff0000ULL) >> 2);
+        w = (w & 0x000000000fffffffULL) | ((w & 0x0fffffff00000000ULL) >> 4);
+        out[decoded++] = w;
+        p += len;
+        continue;
+      }
+      // A varint longer than 8 bytes - decode it below.
+    }
+
+    // Buffer tail or a 9-10 byte varint.
+    uint64_t res = 0;
+    uint32_t shift = 0;
+    while (true)
+    {
+      if (p == end)
+        MYTHROW(ReadVarIntException, ());
+      uint8_t const t = *p++;
+      res |= static_cast<uint64_t>(t & 127) << shift;
+      if (!(t & 128))
+        break;
+      shift += 7;
+      ASSERT_LESS(shift, 64, ());
+    }
+    out[decoded++] = res;
+  }
+  return decoded;
+}
+
@@ -49,6 +49,89 @@ bool ZLib::Processor::BufferIsFull() const
   return m_stream.avail_out == 0;
 }
 
+// ZLib::Inflater ----------------------------------------------------------------------------------
+ZLib::Inflater::Inflater() noexcept : Inflater(string()) {}
+
+ZLib::Inflater::Inflater(string const & dictionary) noexcept : m_dictionary(dictionary)
+{
+  m_stream.next_in = Z_NULL;
+  m_stream.avail_in = 0;
+
+  m_stream.zalloc = Z_NULL;
+  m_stream.zfree = Z_NULL;
+  m_stream.opaque = Z_NULL;
+
+  m_init = (inflateInit(&m_stream) == Z_OK);
+}
+
+ZLib::Inflater::~Inflater() noexcept
+{
+  if (m_init)
+    inflateEnd(&m_stream);
+}
+
+bool ZLib::Inflater::Inflate(void const * data, size_t size, vector<uint8_t> & out)
+{
+  Reset();
+  return OnData(data, size, out) && m_completed;
+}
+
+void ZLib::Inflater::Reset()
+{
+  if (m_init)
+    inflateReset(&m_stream);
+  m_completed = false;
+}
+
+bool ZLib::Inflater::OnData(void const * data, size_t size, vector<uint8_t> & out)
+{
+  if (!m_init || data == nullptr)
+    return false;
+  if (m_completed)
+    return size == 0;
+
+  // See the note on const_cast in Processor's constructor.
+  m_stream.next_in = static_cast<unsigned char *>(const_cast<void *>(data));
+  m_stream.avail_in = static_cast<unsigned int>(size);
+
+  unsigned char buffer[kBufferSize];
+  while (true)
+  {
+    m_stream.next_out = buffer;
+    m_stream.avail_out = kBufferSize;
+
+    int const ret = inflate(&m_stream, Z_NO_FLUSH);
+    if (ret == Z_NEED_DICT)
+    {
+      if (m_dictionary.empty() ||
+          inflateSetDictionary(&m_stream,
+                               reinterpret_cast<unsigned char const *>(m_dictionary.data()),
+                               static_cast<unsigned int>(m_dictionary.size())) != Z_OK)
+      {
+        return false;
+      }
+      continue;
+    }
+
+    // Z_BUF_ERROR is not fatal: it only means no progress was possible
+    // with the input seen so far.
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+      return false;
+
+    out.insert(out.end(), buffer, buffer + (kBufferSize - m_stream.avail_out));
+
+    if (ret == Z_STREAM_END)
+    {
+      m_completed = true;
+      // Data after the end of the stream means a broken payload.
+      return m_stream.avail_in == 0;
+    }
+
+    if (m_stream.avail_out != 0)
+      return true;  // This chunk is fully consumed, wait for the next one.
+  }
+}
+
 // ZLib::Deflate -----------------------------------------------------------------------------------
 ZLib::DeflateProcessor::DeflateProcessor(void const * data, size_t size, ZLib::Level level) noexcept
   : Processor(data, size)
@@ -5,6 +5,7 @@
 
 #include "std/algorithm.hpp"
 #include "std/string.hpp"
+#include "std/vector.hpp"
 
 #include "zlib.h"
 
@@ -57,6 +58,50 @@ public:
     return Inflate(s.c_str(), s.size(), out);
   }
 
+  // Reusable inflater: keeps a single z_stream (and its window) across
+  // calls instead of paying inflateInit/inflateEnd for every payload,
+  // and appends to a caller-supplied buffer whose capacity survives
+  // between calls. Optionally primed with a preset dictionary. Also
+  // usable as a streaming decoder: start a stream with Reset(), feed
+  // consecutive chunks of a compressed body to OnData() and check
+  // IsCompleted() - the whole compressed payload never needs to be in
+  // memory at once.
+  //
+  // *NOTE* Not thread-safe. On error the output may be partially
+  // formed, same as with Inflate() above.
+  class Inflater
+  {
+  public:
+    Inflater() noexcept;
+    explicit Inflater(string const & dictionary) noexcept;
+    ~Inflater() noexcept;
+
+    // Decompresses the whole |data| buffer, appending to |out|.
+    // Returns false on corrupt or truncated input.
+    bool Inflate(void const * data, size_t size, vector<uint8_t> & out);
+
+    // Starts a fresh compressed stream.
+    void Reset();
+
+    // Decompresses the next chunk of the current stream, appending to
+    // |out|. Returns false on corrupt input or on data past the end of
+    // the stream.
+    bool OnData(void const * data, size_t size, vector<uint8_t> & out);
+
+    // Returns true when the end of the current stream has been reached.
+    bool IsCompleted() const { return m_completed; }
+
+  private:
+    static size_t constexpr kBufferSize = 1024;
+
+    z_stream m_stream;
+    string m_dictionary;
+    bool m_init = false;
+    bool m_completed = false;
+
+    DISALLOW_COPY_AND_MOVE(Inflater);
+  };
+
 private:
   class Processor
   {
@@ -12,6 +12,7 @@
 #define WAYS_FILE "ways.dat"
 #define RELATIONS_FILE "relations.dat"
 #define TOWNS_FILE "towns.csv"
+#define ELEMENT2COUNTRY_FILE "element2country.dat"
 #define OFFSET_EXT ".offs"
 #define ID2REL_EXT ".id2rel"
 
@@ -29,6 +30,8 @@
 #define ALTITUDES_FILE_TAG "altitudes"
 #define ROAD_ACCESS_FILE_TAG "roadaccess"
 #define RESTRICTIONS_FILE_TAG "restrictions"
+#define JOINT_HIERARCHY_FILE_TAG "joint_hierarchy"
+#define SEGMENT_WEIGHTS_FILE_TAG "segment_weights"
 #define ROUTING_FILE_TAG "routing"
 #define CROSS_MWM_FILE_TAG "cross_mwm"
 #define FEATURE_OFFSETS_FILE_TAG "offs"
@@ -36,6 +39,8 @@
 #define REGION_INFO_FILE_TAG "rgninfo"
 // Temporary addresses section that is used in search index generation.
 #define SEARCH_TOKENS_FILE_TAG "addrtags"
+// Precomputed per-category-type feature bit vectors (see search::CategoriesCBV).
+#define CATEGORIES_CBVS_FILE_TAG "catcbv"
 #define TRAFFIC_KEYS_FILE_TAG "traffic"
 
 #define ROUTING_MATRIX_FILE_TAG "mercedes"
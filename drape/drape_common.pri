@@ -15,18 +15,22 @@ SOURCES += \
     $$DRAPE_DIR/data_buffer.cpp \
     $$DRAPE_DIR/debug_rect_renderer.cpp \
     $$DRAPE_DIR/font_texture.cpp \
+    $$DRAPE_DIR/frame_profiler.cpp \
     $$DRAPE_DIR/fribidi.cpp \
     $$DRAPE_DIR/glconstants.cpp \
     $$DRAPE_DIR/glextensions_list.cpp \
     $$DRAPE_DIR/glstate.cpp \
+    $$DRAPE_DIR/glyph_cache.cpp \
     $$DRAPE_DIR/glyph_manager.cpp \
     $$DRAPE_DIR/gpu_buffer.cpp \
+    $$DRAPE_DIR/gpu_buffer_pool.cpp \
     $$DRAPE_DIR/gpu_program.cpp \
     $$DRAPE_DIR/gpu_program_manager.cpp \
     $$DRAPE_DIR/hw_texture.cpp \
     $$DRAPE_DIR/index_buffer.cpp \
     $$DRAPE_DIR/index_buffer_mutator.cpp \
     $$DRAPE_DIR/index_storage.cpp \
+    $$DRAPE_DIR/object_pool.cpp \
     $$DRAPE_DIR/oglcontextfactory.cpp \
     $$DRAPE_DIR/overlay_handle.cpp \
     $$DRAPE_DIR/overlay_tree.cpp \
@@ -34,6 +38,7 @@ SOURCES += \
     $$DRAPE_DIR/render_bucket.cpp \
     $$DRAPE_DIR/shader.cpp \
     $$DRAPE_DIR/shader_def.cpp \
+    $$DRAPE_DIR/staged_batcher.cpp \
     $$DRAPE_DIR/static_texture.cpp \
     $$DRAPE_DIR/stipple_pen_resource.cpp \
     $$DRAPE_DIR/support_manager.cpp \
@@ -44,6 +49,7 @@ SOURCES += \
     $$DRAPE_DIR/uniform_value.cpp \
     $$DRAPE_DIR/uniform_values_storage.cpp \
     $$DRAPE_DIR/utils/glyph_usage_tracker.cpp \
+    $$DRAPE_DIR/utils/gpu_mem_ledger.cpp \
     $$DRAPE_DIR/utils/gpu_mem_tracker.cpp \
     $$DRAPE_DIR/utils/projection.cpp \
     $$DRAPE_DIR/utils/vertex_decl.cpp \
@@ -66,6 +72,7 @@ HEADERS += \
     $$DRAPE_DIR/drape_global.hpp \
     $$DRAPE_DIR/dynamic_texture.hpp \
     $$DRAPE_DIR/font_texture.hpp \
+    $$DRAPE_DIR/frame_profiler.hpp \
     $$DRAPE_DIR/fribidi.hpp \
     $$DRAPE_DIR/glconstants.hpp \
     $$DRAPE_DIR/glextensions_list.hpp \
@@ -74,8 +81,10 @@ HEADERS += \
     $$DRAPE_DIR/glsl_func.hpp \
     $$DRAPE_DIR/glsl_types.hpp \
     $$DRAPE_DIR/glstate.hpp \
+    $$DRAPE_DIR/glyph_cache.hpp \
     $$DRAPE_DIR/glyph_manager.hpp \
     $$DRAPE_DIR/gpu_buffer.hpp \
+    $$DRAPE_DIR/gpu_buffer_pool.hpp \
     $$DRAPE_DIR/gpu_program.hpp \
     $$DRAPE_DIR/gpu_program_manager.hpp \
     $$DRAPE_DIR/hw_texture.hpp \
@@ -91,6 +100,7 @@ HEADERS += \
     $$DRAPE_DIR/render_bucket.hpp \
     $$DRAPE_DIR/shader.hpp \
     $$DRAPE_DIR/shader_def.hpp \
+    $$DRAPE_DIR/staged_batcher.hpp \
     $$DRAPE_DIR/static_texture.hpp \
     $$DRAPE_DIR/stipple_pen_resource.hpp \
     $$DRAPE_DIR/support_manager.hpp \
@@ -101,6 +111,7 @@ HEADERS += \
     $$DRAPE_DIR/uniform_value.hpp \
     $$DRAPE_DIR/uniform_values_storage.hpp \
     $$DRAPE_DIR/utils/glyph_usage_tracker.hpp \
+    $$DRAPE_DIR/utils/gpu_mem_ledger.hpp \
     $$DRAPE_DIR/utils/gpu_mem_tracker.hpp \
     $$DRAPE_DIR/utils/projection.hpp \
     $$DRAPE_DIR/utils/vertex_decl.hpp \
@@ -232,39 +232,50 @@ UNIT_TEST(ColorPalleteUploadingPartialyRow)
     cp.MapResource(dp::Color(0xAA, 0xAA, 0xAA, 0));
     cp.MapResource(dp::Color(0xAA, 0xAA, 0xAA, 0xAA));
 
-    uint8_t memoryEtalon1[] =
+    // The pending colors wrap to the second row, so the whole row span is
+    // uploaded at once, including the colors of the previous upload.
+    uint8_t memoryEtalon[] =
     {
-      0xAA, 0x00, 0x00, 0x00, // 1 pixel
-      0xAA, 0x00, 0x00, 0x00, // 1 pixel
-      0xAA, 0xAA, 0x00, 0x00, // 2 pixel
-      0xAA, 0xAA, 0x00, 0x00, // 2 pixel
-
-      0xAA, 0x00, 0x00, 0x00, // 1 pixel
-      0xAA, 0x00, 0x00, 0x00, // 1 pixel
-      0xAA, 0xAA, 0x00, 0x00, // 2 pixel
-      0xAA, 0xAA, 0x00, 0x00  // 2 pixel
-    };
+      0xFF, 0x00, 0x00, 0x00, // 1 pixel (1st row)
+      0xFF, 0x00, 0x00, 0x00, // 1 pixel (1st row)
+      0xFF, 0xFF, 0x00, 0x00, // 2 pixel (1st row)
+      0xFF, 0xFF, 0x00, 0x00, // 2 pixel (1st row)
+      0xAA, 0x00, 0x00, 0x00, // 3 pixel (1st row)
+      0xAA, 0x00, 0x00, 0x00, // 3 pixel (1st row)
+      0xAA, 0xAA, 0x00, 0x00, // 4 pixel (1st row)
+      0xAA, 0xAA, 0x00, 0x00, // 4 pixel (1st row)
 
-    uint8_t memoryEtalon2[] =
-    {
-      0xAA, 0xAA, 0xAA, 0x00, // 1 pixel
-      0xAA, 0xAA, 0xAA, 0x00, // 1 pixel
-      0xAA, 0xAA, 0xAA, 0xAA, // 2 pixel
-      0xAA, 0xAA, 0xAA, 0xAA, // 2 pixel
-
-      0xAA, 0xAA, 0xAA, 0x00, // 1 pixel
-      0xAA, 0xAA, 0xAA, 0x00, // 1 pixel
-      0xAA, 0xAA, 0xAA, 0xAA, // 2 pixel
-      0xAA, 0xAA, 0xAA, 0xAA  // 2 pixel
+      0xFF, 0x00, 0x00, 0x00, // 1 pixel (2nd row)
+      0xFF, 0x00, 0x00, 0x00, // 1 pixel (2nd row)
+      0xFF, 0xFF, 0x00, 0x00, // 2 pixel (2nd row)
+      0xFF, 0xFF, 0x00, 0x00, // 2 pixel (2nd row)
+      0xAA, 0x00, 0x00, 0x00, // 3 pixel (2nd row)
+      0xAA, 0x00, 0x00, 0x00, // 3 pixel (2nd row)
+      0xAA, 0xAA, 0x00, 0x00, // 4 pixel (2nd row)
+      0xAA, 0xAA, 0x00, 0x00, // 4 pixel (2nd row)
+
+      0xAA, 0xAA, 0xAA, 0x00, // 5 pixel (3rd row)
+      0xAA, 0xAA, 0xAA, 0x00, // 5 pixel (3rd row)
+      0xAA, 0xAA, 0xAA, 0xAA, // 6 pixel (3rd row)
+      0xAA, 0xAA, 0xAA, 0xAA, // 6 pixel (3rd row)
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00, // empty
+
+      0xAA, 0xAA, 0xAA, 0x00, // 5 pixel (4th row)
+      0xAA, 0xAA, 0xAA, 0x00, // 5 pixel (4th row)
+      0xAA, 0xAA, 0xAA, 0xAA, // 6 pixel (4th row)
+      0xAA, 0xAA, 0xAA, 0xAA, // 6 pixel (4th row)
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00, // empty
+      0x00, 0x00, 0x00, 0x00  // empty
     };
 
-    MemoryComparer cmp1(memoryEtalon1, ARRAY_SIZE(memoryEtalon1));
-    EXPECTGL(glTexSubImage2D(4, 0, 4, 2, AnyOf(gl_const::GLRGBA, gl_const::GLRGBA8), gl_const::GL8BitOnChannel, _))
-        .WillOnce(Invoke(&cmp1, &MemoryComparer::cmpSubImage));
-
-    MemoryComparer cmp2(memoryEtalon2, ARRAY_SIZE(memoryEtalon2));
-    EXPECTGL(glTexSubImage2D(0, 2, 4, 2, AnyOf(gl_const::GLRGBA, gl_const::GLRGBA8), gl_const::GL8BitOnChannel, _))
-        .WillOnce(Invoke(&cmp2, &MemoryComparer::cmpSubImage));
+    MemoryComparer cmp(memoryEtalon, ARRAY_SIZE(memoryEtalon));
+    EXPECTGL(glTexSubImage2D(0, 0, 8, 4, AnyOf(gl_const::GLRGBA, gl_const::GLRGBA8), gl_const::GL8BitOnChannel, _))
+        .WillOnce(Invoke(&cmp, &MemoryComparer::cmpSubImage));
 
     cp.UploadResources(make_ref(&texture));
   }
@@ -289,7 +300,6 @@ UNIT_TEST(ColorPalleteUploadingMultiplyRow)
   texture.Create(p);
 
   DummyColorPallete cp(m2::PointU(width, height));
-  cp.SetIsDebug(true);
 
   {
     cp.MapResource(dp::Color(0xFF, 0, 0, 0));
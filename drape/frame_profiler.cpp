@@ -0,0 +1,148 @@
+#include "drape/frame_profiler.hpp"
+
+#include "base/assert.hpp"
+#include "base/macros.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/chrono.hpp"
+#include "std/sstream.hpp"
+#include "std/vector.hpp"
+
+namespace dp
+{
+
+namespace
+{
+
+char const * const kStageNames[] =
+{
+  "Frame",
+  "Geometry",
+  "Overlay",
+  "TrafficAndRoute",
+  "BucketUpload",
+  "TextureUpdate",
+  "TileRead",
+};
+
+static_assert(ARRAY_SIZE(kStageNames) == FrameProfiler::StagesCount, "");
+
+} // namespace
+
+FrameProfiler & FrameProfiler::Instance()
+{
+  static FrameProfiler s_instance;
+  return s_instance;
+}
+
+void FrameProfiler::AddMeasurement(Stage stage, uint32_t timeUs)
+{
+  ASSERT_LESS(stage, StagesCount, ());
+
+  threads::MutexGuard g(m_mutex);
+  StageRing & ring = m_stages[stage];
+  ring.m_samples[ring.m_next] = timeUs;
+  ring.m_next = (ring.m_next + 1) % kRingSize;
+  if (ring.m_count < kRingSize)
+    ++ring.m_count;
+
+  if (stage == StageFrame)
+  {
+    ++m_totalFrames;
+    if (timeUs > kDroppedFrameTimeUs)
+      ++m_droppedFrames;
+  }
+}
+
+uint64_t FrameProfiler::GetTotalFramesCount()
+{
+  threads::MutexGuard g(m_mutex);
+  return m_totalFrames;
+}
+
+uint64_t FrameProfiler::GetDroppedFramesCount()
+{
+  threads::MutexGuard g(m_mutex);
+  return m_droppedFrames;
+}
+
+FrameProfiler::StageStatistic FrameProfiler::GetStatistic(Stage stage)
+{
+  threads::MutexGuard g(m_mutex);
+  return GetStatisticImpl(stage);
+}
+
+FrameProfiler::StageStatistic FrameProfiler::GetStatisticImpl(Stage stage)
+{
+  ASSERT_LESS(stage, StagesCount, ());
+
+  StageRing const & ring = m_stages[stage];
+  StageStatistic stat;
+  stat.m_count = ring.m_count;
+  if (ring.m_count == 0)
+    return stat;
+
+  vector<uint32_t> samples(ring.m_samples.begin(), ring.m_samples.begin() + ring.m_count);
+  uint64_t sum = 0;
+  for (uint32_t sample : samples)
+  {
+    sum += sample;
+    stat.m_maxTimeUs = max(stat.m_maxTimeUs, sample);
+  }
+  stat.m_avgTimeUs = static_cast<uint32_t>(sum / samples.size());
+
+  size_t const p95Index = samples.size() * 95 / 100;
+  nth_element(samples.begin(), samples.begin() + p95Index, samples.end());
+  stat.m_p95TimeUs = samples[p95Index];
+
+  return stat;
+}
+
+string FrameProfiler::StageStatistic::ToString() const
+{
+  ostringstream ss;
+  ss << "count = " << m_count
+     << ", avg = " << m_avgTimeUs << "us"
+     << ", p95 = " << m_p95TimeUs << "us"
+     << ", max = " << m_maxTimeUs << "us";
+  return ss.str();
+}
+
+void FrameProfiler::Reset()
+{
+  threads::MutexGuard g(m_mutex);
+  for (StageRing & ring : m_stages)
+  {
+    ring.m_next = 0;
+    ring.m_count = 0;
+  }
+  m_totalFrames = 0;
+  m_droppedFrames = 0;
+}
+
+char const * FrameProfiler::GetStageName(Stage stage)
+{
+  ASSERT_LESS(stage, StagesCount, ());
+  return kStageNames[stage];
+}
+
+string FrameProfiler::Dump()
+{
+  threads::MutexGuard g(m_mutex);
+
+  ostringstream ss;
+  ss << "Frame profile:\n";
+  for (int stage = 0; stage < StagesCount; ++stage)
+    ss << " " << kStageNames[stage] << ": "
+       << GetStatisticImpl(static_cast<Stage>(stage)).ToString() << "\n";
+  ss << " Dropped frames: " << m_droppedFrames << " of " << m_totalFrames << "\n";
+  return ss.str();
+}
+
+FrameProfiler::MeasurementGuard::~MeasurementGuard()
+{
+  uint64_t const timeUs = m_timer.TimeElapsedAs<std::chrono::microseconds>().count();
+  FrameProfiler::Instance().AddMeasurement(m_stage, static_cast<uint32_t>(timeUs));
+}
+
+} // namespace dp
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "base/mutex.hpp"
+#include "base/timer.hpp"
+
+#include "std/array.hpp"
+#include "std/cstdint.hpp"
+#include "std/noncopyable.hpp"
+#include "std/string.hpp"
+
+namespace dp
+{
+
+// Always-on profiler of the rendering pipeline. Each stage keeps a ring
+// buffer of its last timings, so jank reported from the field can be
+// attributed to a concrete stage without attaching an external profiler.
+// Stages are measured with a steady CPU clock: timer queries are not part
+// of the ES2 contexts we target, and for the stages below the wall time on
+// the calling thread is what actually delays the frame.
+class FrameProfiler : private noncopyable
+{
+public:
+  enum Stage
+  {
+    StageFrame = 0,       // whole RenderScene pass
+    StageGeometry,        // 2d and 3d geometry layers
+    StageOverlay,         // overlay tree solving and rendering
+    StageTrafficAndRoute,
+    StageBucketUpload,    // building GPU buffers for flushed render buckets
+    StageTextureUpdate,   // dynamic texture uploads
+    StageTileRead,        // reading and applying features of one tile
+
+    StagesCount
+  };
+
+  /// A frame counts as dropped when the whole pass took longer than two
+  /// 60 Hz vsync intervals, i.e. at least one presentation deadline was missed.
+  static uint32_t const kDroppedFrameTimeUs = 33333;
+
+  static FrameProfiler & Instance();
+
+  /// Thread-safe: the frontend and backend threads record independently.
+  void AddMeasurement(Stage stage, uint32_t timeUs);
+
+  struct StageStatistic
+  {
+    string ToString() const;
+
+    uint32_t m_count = 0;
+    uint32_t m_avgTimeUs = 0;
+    uint32_t m_p95TimeUs = 0;
+    uint32_t m_maxTimeUs = 0;
+  };
+
+  /// Statistic over the measurements currently held in the ring buffer.
+  StageStatistic GetStatistic(Stage stage);
+  string Dump();
+
+  /// Frame counters are cumulative since the last Reset and are not
+  /// limited by the ring size, so they stay exact over long benchmark runs.
+  uint64_t GetTotalFramesCount();
+  uint64_t GetDroppedFramesCount();
+
+  /// Drops all collected measurements, e.g. between benchmark scenarios.
+  void Reset();
+
+  static char const * GetStageName(Stage stage);
+
+  /// Measures the enclosing scope into the given stage.
+  class MeasurementGuard
+  {
+  public:
+    explicit MeasurementGuard(Stage stage) : m_stage(stage) {}
+    ~MeasurementGuard();
+
+  private:
+    Stage m_stage;
+    my::Timer m_timer;
+  };
+
+private:
+  FrameProfiler() = default;
+
+  static uint32_t const kRingSize = 512;
+
+  struct StageRing
+  {
+    array<uint32_t, kRingSize> m_samples;
+    uint32_t m_next = 0;
+    uint32_t m_count = 0;
+  };
+
+  StageStatistic GetStatisticImpl(Stage stage);
+
+  array<StageRing, StagesCount> m_stages;
+  uint64_t m_totalFrames = 0;
+  uint64_t m_droppedFrames = 0;
+  threads::Mutex m_mutex;
+};
+
+} // namespace dp
@@ -2,29 +2,51 @@
 
 #include "3party/fribidi/lib/fribidi.h"
 
+#include "std/map.hpp"
 #include "std/mutex.hpp"
+#include "std/utility.hpp"
 
 namespace fribidi
 {
 
+namespace
+{
+// The same name is reordered for every tile it appears in, so results
+// are memoized. A full reset on overflow keeps the cache bounded.
+size_t const kMaxCacheSize = 5000;
+
+// The vendored fribidi keeps global run free-lists, so the reorder call
+// itself still has to be serialized across threads.
+mutex g_fribidiMutex;
+}
+
 strings::UniString log2vis(strings::UniString const & str)
 {
-  static mutex log2visMutex;
+  // Each shape-generation thread memoizes independently, so the common
+  // case (a hit on a label seen in a neighbouring tile) takes no lock.
+  static thread_local map<strings::UniString, strings::UniString> log2visCache;
 
   size_t const count = str.size();
   if (count == 0)
     return str;
 
+  auto const it = log2visCache.find(str);
+  if (it != log2visCache.end())
+    return it->second;
+
   strings::UniString res(count);
 
   FriBidiParType dir = FRIBIDI_PAR_LTR;  // requested base direction
 
-  // call fribidi_log2vis synchronously
   {
-    lock_guard<mutex> lock(log2visMutex);
+    lock_guard<mutex> lock(g_fribidiMutex);
     fribidi_log2vis(&str[0], static_cast<int>(count), &dir, &res[0], 0, 0, 0);
   }
 
+  if (log2visCache.size() >= kMaxCacheSize)
+    log2visCache.clear();
+  log2visCache.insert(make_pair(str, res));
+
   return res;
 }
 
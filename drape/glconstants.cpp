@@ -25,6 +25,10 @@
   #define GL_LUMINANCE8_ALPHA4_OES 0x8043
 #endif
 
+#if !defined(GL_PIXEL_UNPACK_BUFFER)
+  #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+
 #if defined(GL_WRITE_ONLY)
   #define WRITE_ONLY_DEF GL_WRITE_ONLY
 #elif defined(GL_WRITE_ONLY_OES)
@@ -90,6 +94,7 @@ const glConst GLMaxTextureSize      = GL_MAX_TEXTURE_SIZE;
 
 const glConst GLArrayBuffer         = GL_ARRAY_BUFFER;
 const glConst GLElementArrayBuffer  = GL_ELEMENT_ARRAY_BUFFER;
+const glConst GLPixelBufferWrite    = GL_PIXEL_UNPACK_BUFFER;
 
 const glConst GLBufferSize          = GL_BUFFER_SIZE;
 const glConst GLBufferUsage         = GL_BUFFER_USAGE;
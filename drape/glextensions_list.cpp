@@ -87,6 +87,7 @@ GLExtensionsList::GLExtensionsList()
   m_impl->CheckExtension(MapBuffer, "GL_OES_mapbuffer");
   m_impl->CheckExtension(UintIndices, "GL_OES_element_index_uint");
   m_impl->CheckExtension(MapBufferRange, "GL_EXT_map_buffer_range");
+  m_impl->CheckExtension(PixelBufferObject, "GL_NV_pixel_buffer_object");
 #elif defined(OMIM_OS_WINDOWS)
   m_impl->CheckExtension(TextureNPOT, "GL_ARB_texture_non_power_of_two");
   m_impl->SetExtension(VertexArrayObject, false);
@@ -94,6 +95,7 @@ GLExtensionsList::GLExtensionsList()
   m_impl->SetExtension(MapBuffer, true);
   m_impl->SetExtension(MapBufferRange, false);
   m_impl->SetExtension(UintIndices, true);
+  m_impl->SetExtension(PixelBufferObject, true);
 #else
   m_impl->CheckExtension(VertexArrayObject, "GL_APPLE_vertex_array_object");
   m_impl->CheckExtension(TextureNPOT, "GL_ARB_texture_non_power_of_two");
@@ -101,6 +103,7 @@ GLExtensionsList::GLExtensionsList()
   m_impl->SetExtension(MapBuffer, true);
   m_impl->SetExtension(MapBufferRange, false);
   m_impl->SetExtension(UintIndices, true);
+  m_impl->SetExtension(PixelBufferObject, true);
 #endif
 }
 
@@ -15,7 +15,8 @@ public:
     RequiredInternalFormat,
     MapBuffer,
     UintIndices,
-    MapBufferRange
+    MapBufferRange,
+    PixelBufferObject
   };
 
   static GLExtensionsList & Instance();
@@ -13,6 +13,8 @@
 #endif
 
 #include "std/algorithm.hpp"
+#include "std/array.hpp"
+#include "std/cstring.hpp"
 #include "std/map.hpp"
 #include "std/utility.hpp"
 
@@ -192,6 +194,8 @@ public:
     m_glActiveTextureCache = CachedParam<glConst>();
     m_glUseProgramCache = CachedParam<uint32_t>();
     m_glLineWidthCache = CachedParam<uint32_t>();
+    m_glDepthFuncCache = CachedParam<glConst>();
+    m_glBlendFuncCache = CachedParam<pair<glConst, glConst>>();
     m_glStateCache.clear();
     m_uniformsCache.clear();
   }
@@ -242,6 +246,36 @@ public:
     }
   }
 
+  void glUniformValuei(int8_t location, int32_t v1, int32_t v2)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<int32_t, 2>{{ v1, v2 }}))
+    {
+      ASSERT(glUniform2iFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform2iFn(location, v1, v2));
+    }
+  }
+
+  void glUniformValuei(int8_t location, int32_t v1, int32_t v2, int32_t v3)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<int32_t, 3>{{ v1, v2, v3 }}))
+    {
+      ASSERT(glUniform3iFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform3iFn(location, v1, v2, v3));
+    }
+  }
+
+  void glUniformValuei(int8_t location, int32_t v1, int32_t v2, int32_t v3, int32_t v4)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<int32_t, 4>{{ v1, v2, v3, v4 }}))
+    {
+      ASSERT(glUniform4iFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform4iFn(location, v1, v2, v3, v4));
+    }
+  }
+
   void glUniformValuef(int8_t location, float v)
   {
     if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, v))
@@ -252,6 +286,48 @@ public:
     }
   }
 
+  void glUniformValuef(int8_t location, float v1, float v2)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<float, 2>{{ v1, v2 }}))
+    {
+      ASSERT(glUniform2fFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform2fFn(location, v1, v2));
+    }
+  }
+
+  void glUniformValuef(int8_t location, float v1, float v2, float v3)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<float, 3>{{ v1, v2, v3 }}))
+    {
+      ASSERT(glUniform3fFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform3fFn(location, v1, v2, v3));
+    }
+  }
+
+  void glUniformValuef(int8_t location, float v1, float v2, float v3, float v4)
+  {
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, array<float, 4>{{ v1, v2, v3, v4 }}))
+    {
+      ASSERT(glUniform4fFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniform4fFn(location, v1, v2, v3, v4));
+    }
+  }
+
+  void glUniformMatrix4x4Value(int8_t location, float const * values)
+  {
+    array<float, 16> matrix;
+    memcpy(matrix.data(), values, matrix.size() * sizeof(float));
+    if (!IsCachedThread() || GetCacheForCurrentProgram().Assign(location, matrix))
+    {
+      ASSERT(glUniformMatrix4fvFn != nullptr, ());
+      ASSERT(location != -1, ());
+      GLCHECK(glUniformMatrix4fvFn(location, 1, GL_FALSE, matrix.data()));
+    }
+  }
+
   void glLineWidth(uint32_t value)
   {
     if (!IsCachedThread() || m_glLineWidthCache.Assign(value))
@@ -260,6 +336,18 @@ public:
     }
   }
 
+  void glDepthFunc(glConst depthFunc)
+  {
+    if (!IsCachedThread() || m_glDepthFuncCache.Assign(depthFunc))
+      GLCHECK(::glDepthFunc(depthFunc));
+  }
+
+  void glBlendFunc(glConst srcFactor, glConst dstFactor)
+  {
+    if (!IsCachedThread() || m_glBlendFuncCache.Assign(make_pair(srcFactor, dstFactor)))
+      GLCHECK(::glBlendFunc(srcFactor, dstFactor));
+  }
+
 private:
 
   template<typename TValue>
@@ -309,10 +397,24 @@ private:
   struct UniformsCache
   {
     UniformCache<int32_t> m_glUniform1iCache;
+    UniformCache<array<int32_t, 2>> m_glUniform2iCache;
+    UniformCache<array<int32_t, 3>> m_glUniform3iCache;
+    UniformCache<array<int32_t, 4>> m_glUniform4iCache;
     UniformCache<float> m_glUniform1fCache;
+    UniformCache<array<float, 2>> m_glUniform2fCache;
+    UniformCache<array<float, 3>> m_glUniform3fCache;
+    UniformCache<array<float, 4>> m_glUniform4fCache;
+    UniformCache<array<float, 16>> m_glUniformMatrix4Cache;
 
     bool Assign(int8_t location, int32_t value) { return Assign(location, value, m_glUniform1iCache); }
+    bool Assign(int8_t location, array<int32_t, 2> const & value) { return Assign(location, value, m_glUniform2iCache); }
+    bool Assign(int8_t location, array<int32_t, 3> const & value) { return Assign(location, value, m_glUniform3iCache); }
+    bool Assign(int8_t location, array<int32_t, 4> const & value) { return Assign(location, value, m_glUniform4iCache); }
     bool Assign(int8_t location, float value) { return Assign(location, value, m_glUniform1fCache); }
+    bool Assign(int8_t location, array<float, 2> const & value) { return Assign(location, value, m_glUniform2fCache); }
+    bool Assign(int8_t location, array<float, 3> const & value) { return Assign(location, value, m_glUniform3fCache); }
+    bool Assign(int8_t location, array<float, 4> const & value) { return Assign(location, value, m_glUniform4fCache); }
+    bool Assign(int8_t location, array<float, 16> const & value) { return Assign(location, value, m_glUniformMatrix4Cache); }
 
     template<typename TValue>
     bool Assign(int8_t location, TValue const & value, UniformCache<TValue> & cache)
@@ -337,6 +439,8 @@ private:
   CachedParam<uint32_t> m_glUseProgramCache;
   StateParams m_glStateCache;
   CachedParam<uint32_t> m_glLineWidthCache;
+  CachedParam<glConst> m_glDepthFuncCache;
+  CachedParam<pair<glConst, glConst>> m_glBlendFuncCache;
 
   map<uint32_t, UniformsCache> m_uniformsCache;
 
@@ -625,7 +729,7 @@ void GLFunctions::glDepthMask(bool needWriteToDepthBuffer)
 
 void GLFunctions::glDepthFunc(glConst depthFunc)
 {
-  GLCHECK(::glDepthFunc(depthFunc));
+  s_cache.glDepthFunc(depthFunc);
 }
 
 void GLFunctions::glBlendEquation(glConst function)
@@ -636,7 +740,7 @@ void GLFunctions::glBlendEquation(glConst function)
 
 void GLFunctions::glBlendFunc(glConst srcFactor, glConst dstFactor)
 {
-  GLCHECK(::glBlendFunc(srcFactor, dstFactor));
+  s_cache.glBlendFunc(srcFactor, dstFactor);
 }
 
 uint32_t GLFunctions::glGenVertexArray()
@@ -894,23 +998,17 @@ void GLFunctions::glUniformValuei(int8_t location, int32_t v)
 
 void GLFunctions::glUniformValuei(int8_t location, int32_t v1, int32_t v2)
 {
-  ASSERT(glUniform2iFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform2iFn(location, v1, v2));
+  s_cache.glUniformValuei(location, v1, v2);
 }
 
 void GLFunctions::glUniformValuei(int8_t location, int32_t v1, int32_t v2, int32_t v3)
 {
-  ASSERT(glUniform3iFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform3iFn(location, v1, v2, v3));
+  s_cache.glUniformValuei(location, v1, v2, v3);
 }
 
 void GLFunctions::glUniformValuei(int8_t location, int32_t v1, int32_t v2, int32_t v3, int32_t v4)
 {
-  ASSERT(glUniform4iFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform4iFn(location, v1, v2, v3, v4));
+  s_cache.glUniformValuei(location, v1, v2, v3, v4);
 }
 
 void GLFunctions::glUniformValueiv(int8_t location, int32_t * v, uint32_t size)
@@ -927,23 +1025,17 @@ void GLFunctions::glUniformValuef(int8_t location, float v)
 
 void GLFunctions::glUniformValuef(int8_t location, float v1, float v2)
 {
-  ASSERT(glUniform2fFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform2fFn(location, v1, v2));
+  s_cache.glUniformValuef(location, v1, v2);
 }
 
 void GLFunctions::glUniformValuef(int8_t location, float v1, float v2, float v3)
 {
-  ASSERT(glUniform3fFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform3fFn(location, v1, v2, v3));
+  s_cache.glUniformValuef(location, v1, v2, v3);
 }
 
 void GLFunctions::glUniformValuef(int8_t location, float v1, float v2, float v3, float v4)
 {
-  ASSERT(glUniform4fFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniform4fFn(location, v1, v2, v3, v4));
+  s_cache.glUniformValuef(location, v1, v2, v3, v4);
 }
 
 void GLFunctions::glUniformValuefv(int8_t location, float * v, uint32_t size)
@@ -955,9 +1047,7 @@ void GLFunctions::glUniformValuefv(int8_t location, float * v, uint32_t size)
 
 void GLFunctions::glUniformMatrix4x4Value(int8_t location,  float const * values)
 {
-  ASSERT(glUniformMatrix4fvFn != nullptr, ());
-  ASSERT(location != -1, ());
-  GLCHECK(glUniformMatrix4fvFn(location, 1, GL_FALSE, values));
+  s_cache.glUniformMatrix4x4Value(location, values);
 }
 
 uint32_t GLFunctions::glGetCurrentProgram()
@@ -0,0 +1,230 @@
+#include "drape/glyph_cache.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/reader.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/logging.hpp"
+#include "base/math.hpp"
+
+#include "std/cstring.hpp"
+
+namespace dp
+{
+
+namespace
+{
+
+uint32_t const kCacheFormatVersion = 1;
+
+// Floats are stored through their bit pattern: the cache never leaves
+// the device, so host representation is fine.
+template <class TSink>
+void WriteFloat(TSink & sink, float f)
+{
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  WriteToSink(sink, bits);
+}
+
+template <class TSource>
+float ReadFloat(TSource & src)
+{
+  uint32_t const bits = ReadPrimitiveFromSource<uint32_t>(src);
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+} // namespace
+
+GlyphCache::GlyphCache(string const & filePath, uint32_t baseGlyphHeight, uint32_t sdfScale)
+  : m_filePath(filePath)
+  , m_baseGlyphHeight(baseGlyphHeight)
+  , m_sdfScale(sdfScale)
+{
+  try
+  {
+    Load();
+  }
+  catch (RootException const & e)
+  {
+    // A truncated or outdated cache is recreated from scratch.
+    LOG(LINFO, ("Recreating glyph cache", m_filePath, ":", e.Msg()));
+    m_index.clear();
+    m_reader.reset();
+
+    try
+    {
+      {
+        FileWriter writer(m_filePath);
+        WriteToSink(writer, kCacheFormatVersion);
+        WriteToSink(writer, m_baseGlyphHeight);
+        WriteToSink(writer, m_sdfScale);
+      }
+      Load();
+    }
+    catch (RootException const & e)
+    {
+      LOG(LWARNING, ("Glyph cache is not available:", e.Msg()));
+      m_reader.reset();
+    }
+  }
+}
+
+GlyphCache::~GlyphCache()
+{
+}
+
+void GlyphCache::Load()
+{
+  // FileReader reports out of bounds reads with a fatal assert, so a
+  // truncated file (e.g. after a crash in the middle of Put) must be
+  // detected by explicit size checks.
+  size_t const kHeaderSize = 3 * sizeof(uint32_t);
+  size_t const kRecordFixedSize = 3 * sizeof(uint32_t) + 4 * sizeof(uint32_t) + 3 * sizeof(uint32_t);
+
+  m_reader = make_unique<FileReader>(m_filePath);
+  ReaderSource<FileReader> src(*m_reader);
+
+  if (src.Size() < kHeaderSize ||
+      ReadPrimitiveFromSource<uint32_t>(src) != kCacheFormatVersion ||
+      ReadPrimitiveFromSource<uint32_t>(src) != m_baseGlyphHeight ||
+      ReadPrimitiveFromSource<uint32_t>(src) != m_sdfScale)
+  {
+    MYTHROW(Reader::Exception, ("Glyph cache version or parameters mismatch"));
+  }
+
+  while (src.Size() > 0)
+  {
+    if (src.Size() < kRecordFixedSize)
+      MYTHROW(Reader::Exception, ("Truncated glyph cache record"));
+
+    uint64_t const offset = src.Pos();
+
+    Key key;
+    key.m_fontIndex = ReadPrimitiveFromSource<int32_t>(src);
+    key.m_code = ReadPrimitiveFromSource<uint32_t>(src);
+    key.m_fixedSize = ReadPrimitiveFromSource<int32_t>(src);
+
+    // Skip the metrics and the image, they are read back in Get.
+    for (size_t i = 0; i < 4; ++i)
+      ReadFloat(src);
+    ReadPrimitiveFromSource<uint32_t>(src);  // width
+    ReadPrimitiveFromSource<uint32_t>(src);  // height
+
+    uint32_t const dataSize = ReadPrimitiveFromSource<uint32_t>(src);
+    if (src.Size() < dataSize)
+      MYTHROW(Reader::Exception, ("Truncated glyph cache record"));
+    src.Skip(dataSize);
+
+    m_index.emplace(key, offset);
+  }
+}
+
+bool GlyphCache::Get(int fontIndex, strings::UniChar code, int fixedSize,
+                     GlyphManager::Glyph & glyph)
+{
+  lock_guard<mutex> lock(m_mutex);
+
+  if (m_reader == nullptr)
+    return false;
+
+  auto const it = m_index.find(Key{fontIndex, code, fixedSize});
+  if (it == m_index.end())
+    return false;
+
+  ReaderSource<FileReader> src(*m_reader);
+  src.Skip(it->second);
+
+  src.Skip(sizeof(int32_t) + sizeof(uint32_t) + sizeof(int32_t));  // The key.
+
+  glyph.m_metrics.m_xAdvance = ReadFloat(src);
+  glyph.m_metrics.m_yAdvance = ReadFloat(src);
+  glyph.m_metrics.m_xOffset = ReadFloat(src);
+  glyph.m_metrics.m_yOffset = ReadFloat(src);
+  glyph.m_metrics.m_isValid = true;
+
+  glyph.m_image.m_width = ReadPrimitiveFromSource<uint32_t>(src);
+  glyph.m_image.m_height = ReadPrimitiveFromSource<uint32_t>(src);
+  glyph.m_image.m_bitmapRows = 0;
+  glyph.m_image.m_bitmapPitch = 0;
+
+  uint32_t const dataSize = ReadPrimitiveFromSource<uint32_t>(src);
+  if (dataSize != 0)
+  {
+    glyph.m_image.m_data =
+        SharedBufferManager::instance().reserveSharedBuffer(my::NextPowOf2(dataSize));
+    src.Read(glyph.m_image.m_data->data(), dataSize);
+  }
+  else
+  {
+    glyph.m_image.m_data = nullptr;
+  }
+
+  glyph.m_fontIndex = fontIndex;
+  glyph.m_code = code;
+  glyph.m_fixedSize = fixedSize;
+  glyph.m_generated = true;
+
+  return true;
+}
+
+bool GlyphCache::Has(int fontIndex, strings::UniChar code, int fixedSize)
+{
+  lock_guard<mutex> lock(m_mutex);
+
+  Key const key{fontIndex, code, fixedSize};
+  return m_index.find(key) != m_index.end() || m_sessionKeys.find(key) != m_sessionKeys.end();
+}
+
+void GlyphCache::Put(GlyphManager::Glyph const & glyph)
+{
+  if (!glyph.m_metrics.m_isValid)
+    return;
+
+  lock_guard<mutex> lock(m_mutex);
+
+  if (m_reader == nullptr)
+    return;
+
+  Key const key{glyph.m_fontIndex, glyph.m_code, glyph.m_fixedSize};
+  if (m_index.find(key) != m_index.end() || m_sessionKeys.find(key) != m_sessionKeys.end())
+    return;
+
+  try
+  {
+    if (m_writer == nullptr)
+      m_writer = make_unique<FileWriter>(m_filePath, FileWriter::OP_APPEND);
+
+    WriteToSink(*m_writer, static_cast<int32_t>(glyph.m_fontIndex));
+    WriteToSink(*m_writer, static_cast<uint32_t>(glyph.m_code));
+    WriteToSink(*m_writer, static_cast<int32_t>(glyph.m_fixedSize));
+
+    WriteFloat(*m_writer, glyph.m_metrics.m_xAdvance);
+    WriteFloat(*m_writer, glyph.m_metrics.m_yAdvance);
+    WriteFloat(*m_writer, glyph.m_metrics.m_xOffset);
+    WriteFloat(*m_writer, glyph.m_metrics.m_yOffset);
+
+    WriteToSink(*m_writer, glyph.m_image.m_width);
+    WriteToSink(*m_writer, glyph.m_image.m_height);
+
+    uint32_t const dataSize =
+        glyph.m_image.m_data != nullptr ? glyph.m_image.m_width * glyph.m_image.m_height : 0;
+    WriteToSink(*m_writer, dataSize);
+    if (dataSize != 0)
+      m_writer->Write(glyph.m_image.m_data->data(), dataSize);
+
+    m_writer->Flush();
+    m_sessionKeys.insert(key);
+  }
+  catch (RootException const & e)
+  {
+    // Failing to extend the cache must not affect rendering.
+    LOG(LWARNING, ("Can't write to glyph cache:", e.Msg()));
+    m_writer.reset();
+  }
+}
+
+} // namespace dp
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "drape/glyph_manager.hpp"
+
+#include "base/string_utils.hpp"
+
+#include "std/map.hpp"
+#include "std/mutex.hpp"
+#include "std/set.hpp"
+#include "std/string.hpp"
+#include "std/unique_ptr.hpp"
+
+class FileReader;
+class FileWriter;
+
+namespace dp
+{
+
+// Persistent on-disk cache of rasterized SDF glyphs keyed by
+// font + code point + size. Rendering a glyph means rasterizing it
+// with FreeType at sdfScale times the base size and running the SDF
+// transform, which is the main source of first-label jank on scripts
+// with large alphabets. The cache keeps the final SDF bitmaps and
+// metrics between runs, so a glyph is rendered at most once per
+// device.
+//
+// The cache file is local to the device: records are stored in host
+// byte order and are invalidated by a version/parameters mismatch.
+// All methods are thread-safe.
+class GlyphCache
+{
+public:
+  GlyphCache(string const & filePath, uint32_t baseGlyphHeight, uint32_t sdfScale);
+  ~GlyphCache();
+
+  // Fills |glyph| (with m_generated set) and returns true if the
+  // cache holds a record for the key. The glyph image is allocated
+  // from SharedBufferManager and must be Destroy()ed by the caller.
+  bool Get(int fontIndex, strings::UniChar code, int fixedSize, GlyphManager::Glyph & glyph);
+
+  // Returns true if the key is known, without reading the record.
+  bool Has(int fontIndex, strings::UniChar code, int fixedSize);
+
+  // Appends the generated |glyph| to the cache. Invalid glyphs and
+  // duplicates are silently skipped.
+  void Put(GlyphManager::Glyph const & glyph);
+
+private:
+  struct Key
+  {
+    int m_fontIndex;
+    strings::UniChar m_code;
+    int m_fixedSize;
+
+    bool operator<(Key const & rhs) const
+    {
+      if (m_fontIndex != rhs.m_fontIndex)
+        return m_fontIndex < rhs.m_fontIndex;
+      if (m_code != rhs.m_code)
+        return m_code < rhs.m_code;
+      return m_fixedSize < rhs.m_fixedSize;
+    }
+  };
+
+  void Load();
+
+  string const m_filePath;
+  uint32_t const m_baseGlyphHeight;
+  uint32_t const m_sdfScale;
+
+  // Offsets of the records present in the file when it was opened.
+  map<Key, uint64_t> m_index;
+  // Keys appended during this session. They are served from the GPU
+  // texture already, so Get does not read them back.
+  set<Key> m_sessionKeys;
+
+  unique_ptr<FileReader> m_reader;
+  unique_ptr<FileWriter> m_writer;
+
+  mutex m_mutex;
+};
+
+} // namespace dp
@@ -1,4 +1,5 @@
 #include "drape/glyph_manager.hpp"
+#include "drape/glyph_cache.hpp"
 #include "3party/sdf_image/sdf_image.h"
 
 #include "platform/platform.hpp"
@@ -10,8 +11,11 @@
 #include "base/math.hpp"
 #include "base/timer.hpp"
 
+#include "std/atomic.hpp"
 #include "std/limits.hpp"
+#include "std/mutex.hpp"
 #include "std/sstream.hpp"
+#include "std/thread.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/unordered_set.hpp"
 
@@ -405,6 +409,13 @@ struct GlyphManager::Impl
   vector<unique_ptr<Font>> m_fonts;
 
   uint32_t m_baseGlyphHeight;
+
+  unique_ptr<GlyphCache> m_cache;
+  // Guards the FreeType faces and m_lastUsedBlock: the cache prewarm
+  // thread rasterizes glyphs concurrently with GetGlyph.
+  mutex m_fontAccess;
+  thread m_prewarmThread;
+  atomic<bool> m_prewarmCancelled{false};
 };
 
 GlyphManager::GlyphManager(GlyphManager::Params const & params)
@@ -528,10 +539,20 @@ GlyphManager::GlyphManager(GlyphManager::Params const & params)
   }
 
   m_impl->m_lastUsedBlock = m_impl->m_blocks.end();
+
+  if (!params.m_cacheFilePath.empty() && !m_impl->m_fonts.empty())
+  {
+    m_impl->m_cache = make_unique<GlyphCache>(params.m_cacheFilePath, params.m_baseGlyphHeight,
+                                              params.m_sdfScale);
+  }
 }
 
 GlyphManager::~GlyphManager()
 {
+  m_impl->m_prewarmCancelled = true;
+  if (m_impl->m_prewarmThread.joinable())
+    m_impl->m_prewarmThread.join();
+
   for (auto const & f : m_impl->m_fonts)
     f->DestroyFont();
 
@@ -600,13 +621,29 @@ int GlyphManager::FindFontIndexInBlock(UnicodeBlock const & block, strings::UniC
 }
 
 GlyphManager::Glyph GlyphManager::GetGlyph(strings::UniChar unicodePoint, int fixedHeight)
+{
+  lock_guard<mutex> lock(m_impl->m_fontAccess);
+  return GetGlyphImpl(unicodePoint, fixedHeight);
+}
+
+GlyphManager::Glyph GlyphManager::GetGlyphImpl(strings::UniChar unicodePoint, int fixedHeight)
 {
   int const fontIndex = GetFontIndex(unicodePoint);
   if (fontIndex == kInvalidFont)
     return GetInvalidGlyph(fixedHeight);
 
-  auto const & f = m_impl->m_fonts[fontIndex];
   bool const isSdf = fixedHeight < 0;
+  if (m_impl->m_cache != nullptr)
+  {
+    Glyph glyph;
+    if (m_impl->m_cache->Get(fontIndex, unicodePoint,
+                             isSdf ? kDynamicGlyphSize : fixedHeight, glyph))
+    {
+      return glyph;
+    }
+  }
+
+  auto const & f = m_impl->m_fonts[fontIndex];
   Glyph glyph = f->GetGlyph(unicodePoint, isSdf ? m_impl->m_baseGlyphHeight : fixedHeight, isSdf);
   glyph.m_fontIndex = fontIndex;
   return glyph;
@@ -616,8 +653,62 @@ GlyphManager::Glyph GlyphManager::GenerateGlyph(Glyph const & glyph) const
 {
   ASSERT_NOT_EQUAL(glyph.m_fontIndex, -1, ());
   ASSERT_LESS(glyph.m_fontIndex, static_cast<int>(m_impl->m_fonts.size()), ());
+
+  if (glyph.m_generated)
+  {
+    // The image is already final. It still has to be deep copied:
+    // the glyph generator destroys the source image after generation.
+    Glyph resultGlyph = glyph;
+    if (glyph.m_image.m_data != nullptr)
+    {
+      size_t const bufferSize = my::NextPowOf2(glyph.m_image.m_width * glyph.m_image.m_height);
+      resultGlyph.m_image.m_data = SharedBufferManager::instance().reserveSharedBuffer(bufferSize);
+      resultGlyph.m_image.m_data->assign(glyph.m_image.m_data->begin(), glyph.m_image.m_data->end());
+    }
+    return resultGlyph;
+  }
+
   auto const & f = m_impl->m_fonts[glyph.m_fontIndex];
-  return f->GenerateGlyph(glyph);
+  Glyph result = f->GenerateGlyph(glyph);
+  if (m_impl->m_cache != nullptr)
+    m_impl->m_cache->Put(result);
+  return result;
+}
+
+void GlyphManager::PrewarmGlyphCache(strings::UniString const & chars)
+{
+  if (m_impl->m_cache == nullptr || chars.empty())
+    return;
+
+  ASSERT(!m_impl->m_prewarmThread.joinable(), ());
+  m_impl->m_prewarmThread = thread([this, chars]()
+  {
+    for (strings::UniChar const c : chars)
+    {
+      if (m_impl->m_prewarmCancelled)
+        return;
+
+      Glyph glyph;
+      {
+        lock_guard<mutex> lock(m_impl->m_fontAccess);
+        int const fontIndex = GetFontIndex(c);
+        if (fontIndex == kInvalidFont)
+          continue;
+        if (m_impl->m_cache->Has(fontIndex, c, kDynamicGlyphSize))
+          continue;
+
+        glyph = m_impl->m_fonts[fontIndex]->GetGlyph(c, m_impl->m_baseGlyphHeight, true /* isSdf */);
+        glyph.m_fontIndex = fontIndex;
+      }
+
+      // The SDF transform does not touch the font, run it unlocked.
+      // GenerateGlyph stores the result into the cache.
+      Glyph generated = GenerateGlyph(glyph);
+      if (generated.m_image.m_data != glyph.m_image.m_data)
+        generated.m_image.Destroy();
+      glyph.m_image.Destroy();
+    }
+  });
 }
 
 void GlyphManager::ForEachUnicodeBlock(GlyphManager::TUniBlockCallback const & fn) const
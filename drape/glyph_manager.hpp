@@ -29,6 +29,10 @@ public:
 
     vector<string> m_fonts;
 
+    // Path of the persistent glyph cache. An empty path disables
+    // caching.
+    string m_cacheFilePath;
+
     uint32_t m_baseGlyphHeight = 22;
     uint32_t m_sdfScale = 4;
   };
@@ -74,6 +78,9 @@ public:
     int m_fontIndex;
     strings::UniChar m_code;
     int m_fixedSize;
+    // True when m_image already holds the final (SDF processed)
+    // bitmap, e.g. it was read from the persistent cache.
+    bool m_generated = false;
   };
 
   GlyphManager(Params const & params);
@@ -92,7 +99,14 @@ public:
 
   uint32_t GetBaseGlyphHeight() const;
 
+  // Rasterizes |chars| into the persistent glyph cache on a
+  // background thread, so the first labels of the user's script do
+  // not stall the glyph generator. Does nothing when the cache is
+  // disabled. The pass is cancelled by the destructor.
+  void PrewarmGlyphCache(strings::UniString const & chars);
+
 private:
+  Glyph GetGlyphImpl(strings::UniChar unicodePoint, int fixedHeight);
   int GetFontIndex(strings::UniChar unicodePoint);
   // Immutable version can be called from any thread and doesn't require internal synchronization.
   int GetFontIndexImmutable(strings::UniChar unicodePoint) const;
@@ -1,6 +1,7 @@
 #include "drape/gpu_buffer.hpp"
 #include "drape/glfunctions.hpp"
 #include "drape/glextensions_list.hpp"
+#include "drape/gpu_buffer_pool.hpp"
 #include "drape/utils/gpu_mem_tracker.hpp"
 
 #include "base/assert.hpp"
@@ -36,17 +37,14 @@ GPUBuffer::GPUBuffer(Target t, void const * data, uint8_t elementSize, uint32_t
   , m_isMapped(false)
 #endif
 {
-  m_bufferID = GLFunctions::glGenBuffer();
+  m_bufferID = 0;
+  m_storeSize = 0;
   Resize(data, capacity);
 }
 GPUBuffer::~GPUBuffer()
 {
   GLFunctions::glBindBuffer(0, glTarget(m_t));
-  GLFunctions::glDeleteBuffer(m_bufferID);
-
-#if defined(TRACK_GPU_MEM)
-  dp::GPUMemTracker::Inst().RemoveDeallocated("VBO", m_bufferID);
-#endif
+  GPUBufferPool::Instance().Release(glTarget(m_t), m_bufferID, m_storeSize);
 }
 
 void GPUBuffer::UploadData(void const * data, uint32_t elementCount)
@@ -60,7 +58,7 @@ void GPUBuffer::UploadData(void const * data, uint32_t elementCount)
 
 #if defined(CHECK_VBO_BOUNDS)
   int32_t size = GLFunctions::glGetBufferParameter(glTarget(m_t), gl_const::GLBufferSize);
-  ASSERT_EQUAL(GetCapacity() * elementSize, size, ());
+  ASSERT_EQUAL(m_storeSize, size, ());
   ASSERT_LESS_OR_EQUAL((elementCount + currentSize) * elementSize, size,());
 #endif
 
@@ -95,12 +93,11 @@ void GPUBuffer::UpdateData(void * gpuPtr, void const * data, uint32_t elementOff
   uint32_t const elementSize = GetElementSize();
   uint32_t const byteOffset = elementOffset * elementSize;
   uint32_t const byteCount = elementCount * elementSize;
-  uint32_t const byteCapacity = GetCapacity() * elementSize;
   ASSERT(m_isMapped == true, ());
 
 #if defined(CHECK_VBO_BOUNDS)
   int32_t size = GLFunctions::glGetBufferParameter(glTarget(m_t), gl_const::GLBufferSize);
-  ASSERT_EQUAL(size, byteCapacity, ());
+  ASSERT_EQUAL(size, m_storeSize, ());
   ASSERT_LESS(byteOffset + byteCount, size, ());
 #endif
 
@@ -112,7 +109,9 @@ void GPUBuffer::UpdateData(void * gpuPtr, void const * data, uint32_t elementOff
   else
   {
     ASSERT(gpuPtr == NULL, ());
-    if (byteOffset == 0 && byteCount == byteCapacity)
+    // Orphaning the store through glBufferData is allowed only with the
+    // real store size, otherwise the recycled store would be reallocated.
+    if (byteOffset == 0 && byteCount == m_storeSize)
       GLFunctions::glBufferData(glTarget(m_t), byteCount, data, gl_const::GLStaticDraw);
     else
       GLFunctions::glBufferSubData(glTarget(m_t), byteCount, data, byteOffset);
@@ -132,17 +131,21 @@ void GPUBuffer::Unmap()
 void GPUBuffer::Resize(void const * data, uint32_t elementCount)
 {
   TBase::Resize(elementCount);
-  Bind();
-  GLFunctions::glBufferData(glTarget(m_t), GetCapacity() * GetElementSize(), data, gl_const::GLDynamicDraw);
 
-  // if we have set up data already (in glBufferData), we have to call SetDataSize
+  GPUBufferPool & pool = GPUBufferPool::Instance();
+  pool.Release(glTarget(m_t), m_bufferID, m_storeSize);
+  m_storeSize = GetCapacity() * GetElementSize();
+  // Reserve leaves the buffer bound to the target.
+  m_bufferID = pool.Reserve(glTarget(m_t), m_storeSize);
+
+  // if we have set up data already, we have to call SetDataSize
   if (data != nullptr)
+  {
+    GLFunctions::glBufferSubData(glTarget(m_t), GetCapacity() * GetElementSize(), data, 0);
     SetDataSize(elementCount);
+  }
 
 #if defined(TRACK_GPU_MEM)
-  dp::GPUMemTracker & memTracker = dp::GPUMemTracker::Inst();
-  memTracker.RemoveDeallocated("VBO", m_bufferID);
-  memTracker.AddAllocated("VBO", m_bufferID, GetCapacity() * GetElementSize());
   if (data != nullptr)
     dp::GPUMemTracker::Inst().SetUsed("VBO", m_bufferID, GetCurrentSize() * GetElementSize());
 #endif
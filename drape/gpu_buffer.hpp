@@ -35,6 +35,9 @@ private:
   friend class GPUBufferMapper;
   Target m_t;
   uint32_t m_bufferID;
+  /// Actual size of the GL data store. A store recycled through
+  /// GPUBufferPool can be bigger than the capacity in bytes.
+  uint32_t m_storeSize;
 
 #ifdef DEBUG
   bool m_isMapped;
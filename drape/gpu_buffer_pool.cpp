@@ -0,0 +1,151 @@
+#include "drape/gpu_buffer_pool.hpp"
+#include "drape/glfunctions.hpp"
+#include "drape/support_manager.hpp"
+#include "drape/utils/gpu_mem_ledger.hpp"
+#include "drape/utils/gpu_mem_tracker.hpp"
+
+namespace dp
+{
+
+namespace
+{
+
+// Store sizes are rounded up to this granularity, so buckets of slightly
+// different sizes are served from the same pool entry.
+uint32_t const kStoreSizeAlignment = 16 * 1024;
+// An oversized recycled store is acceptable while less than half of its
+// bytes are wasted.
+uint32_t const kMaxStoreOverhead = 2;
+// Total size of the released stores kept for recycling. Everything above
+// this limit is deleted immediately.
+uint32_t const kMaxPooledBytes = 16 * 1024 * 1024;
+
+bool IsPoolingAllowed()
+{
+  // Adreno 200 GPUs aren't able to share OpenGL resources between 2 OGL-contexts
+  // correctly, so a recycled store must not migrate to another thread there.
+  return !SupportManager::Instance().IsAdreno200Device();
+}
+
+uint32_t AlignStoreSize(uint32_t byteSize)
+{
+  return (byteSize + kStoreSizeAlignment - 1) / kStoreSizeAlignment * kStoreSizeAlignment;
+}
+
+void DeleteStore(uint32_t bufferID, uint32_t byteSize)
+{
+  GLFunctions::glDeleteBuffer(bufferID);
+  GPUMemLedger::Instance().RemoveBufferBytes(byteSize);
+
+#if defined(TRACK_GPU_MEM)
+  dp::GPUMemTracker::Inst().RemoveDeallocated("VBO", bufferID);
+#endif
+}
+
+} // namespace
+
+GPUBufferPool & GPUBufferPool::Instance()
+{
+  static GPUBufferPool pool;
+  return pool;
+}
+
+uint32_t GPUBufferPool::Reserve(glConst target, uint32_t & byteSize)
+{
+  if (IsPoolingAllowed())
+  {
+    byteSize = AlignStoreSize(byteSize);
+
+    lock_guard<mutex> lock(m_mutex);
+    TFreeStores & stores = GetStores(target);
+    TFreeStores::iterator const it = stores.lower_bound(byteSize);
+    if (it != stores.end() && it->first / kMaxStoreOverhead <= byteSize)
+    {
+      uint32_t const bufferID = it->second.back();
+      it->second.pop_back();
+      byteSize = it->first;
+      m_pooledBytes -= byteSize;
+      if (it->second.empty())
+        stores.erase(it);
+
+      GLFunctions::glBindBuffer(bufferID, target);
+      return bufferID;
+    }
+  }
+
+  uint32_t const bufferID = GLFunctions::glGenBuffer();
+  GLFunctions::glBindBuffer(bufferID, target);
+  GLFunctions::glBufferData(target, byteSize, nullptr, gl_const::GLDynamicDraw);
+  GPUMemLedger::Instance().AddBufferBytes(byteSize);
+
+#if defined(TRACK_GPU_MEM)
+  dp::GPUMemTracker::Inst().AddAllocated("VBO", bufferID, byteSize);
+#endif
+
+  return bufferID;
+}
+
+void GPUBufferPool::Release(glConst target, uint32_t bufferID, uint32_t byteSize)
+{
+  if (bufferID == 0)
+    return;
+
+  if (IsPoolingAllowed() && byteSize != 0 && byteSize % kStoreSizeAlignment == 0)
+  {
+    lock_guard<mutex> lock(m_mutex);
+    if (m_pooledBytes + byteSize <= kMaxPooledBytes)
+    {
+      GetStores(target)[byteSize].push_back(bufferID);
+      m_pooledBytes += byteSize;
+      return;
+    }
+  }
+
+  DeleteStore(bufferID, byteSize);
+}
+
+void GPUBufferPool::Shrink(uint32_t targetPooledBytes)
+{
+  lock_guard<mutex> lock(m_mutex);
+  for (TFreeStores * stores : { &m_vertexStores, &m_indexStores })
+  {
+    while (!stores->empty() && m_pooledBytes > targetPooledBytes)
+    {
+      TFreeStores::iterator it = stores->end();
+      --it;
+      while (!it->second.empty() && m_pooledBytes > targetPooledBytes)
+      {
+        DeleteStore(it->second.back(), it->first);
+        it->second.pop_back();
+        m_pooledBytes -= it->first;
+      }
+      if (it->second.empty())
+        stores->erase(it);
+      else
+        break;
+    }
+  }
+}
+
+void GPUBufferPool::Clear()
+{
+  lock_guard<mutex> lock(m_mutex);
+  for (TFreeStores * stores : { &m_vertexStores, &m_indexStores })
+  {
+    for (auto const & sizeClass : *stores)
+      for (uint32_t bufferID : sizeClass.second)
+        DeleteStore(bufferID, sizeClass.first);
+    stores->clear();
+  }
+  m_pooledBytes = 0;
+}
+
+GPUBufferPool::TFreeStores & GPUBufferPool::GetStores(glConst target)
+{
+  if (target == gl_const::GLArrayBuffer)
+    return m_vertexStores;
+
+  return m_indexStores;
+}
+
+} // namespace dp
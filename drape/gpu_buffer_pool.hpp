@@ -0,0 +1,54 @@
+#pragma once
+
+#include "drape/glconstants.hpp"
+
+#include "std/map.hpp"
+#include "std/mutex.hpp"
+#include "std/noncopyable.hpp"
+#include "std/vector.hpp"
+
+namespace dp
+{
+
+// Recycles GL buffer objects together with their data stores. Render buckets
+// are created and dropped on every tile read, and allocating a fresh data
+// store with glBufferData each time is expensive in the driver. Reusing a
+// store of a suitable size turns the bucket upload into a plain
+// glBufferSubData call.
+class GPUBufferPool : private noncopyable
+{
+public:
+  static GPUBufferPool & Instance();
+
+  /// Returns a buffer object with a data store of at least byteSize bytes;
+  /// byteSize is updated to the actual store size. The buffer is left bound
+  /// to the target. Must be called with a GL context made current.
+  uint32_t Reserve(glConst target, uint32_t & byteSize);
+  /// Hands the buffer back for recycling, or deletes it when the pool is
+  /// full. Must be called with a GL context made current.
+  void Release(glConst target, uint32_t bufferID, uint32_t byteSize);
+
+  /// Deletes pooled buffers until at most targetPooledBytes are retained.
+  /// Large stores go first: they free the most memory and are the least
+  /// likely to be reused. Must be called with a GL context made current.
+  void Shrink(uint32_t targetPooledBytes);
+
+  /// Deletes all pooled buffers. Must be called before the GL context is
+  /// destroyed: buffer names do not survive context recreation.
+  void Clear();
+
+private:
+  GPUBufferPool() = default;
+
+  /// Free stores of one target grouped by the store size.
+  using TFreeStores = map<uint32_t, vector<uint32_t>>;
+
+  TFreeStores & GetStores(glConst target);
+
+  TFreeStores m_vertexStores;
+  TFreeStores m_indexStores;
+  uint32_t m_pooledBytes = 0;
+  mutex m_mutex;
+};
+
+} // namespace dp
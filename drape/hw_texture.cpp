@@ -2,11 +2,16 @@
 
 #include "glfunctions.hpp"
 #include "glextensions_list.hpp"
+#include "support_manager.hpp"
+#include "utils/gpu_mem_ledger.hpp"
+#include "utils/gpu_mem_tracker.hpp"
 
 #include "platform/platform.hpp"
 
 #include "base/math.hpp"
 
+#include "std/cstring.hpp"
+
 #if defined(OMIM_OS_IPHONE)
 #include "hw_texture_ios.hpp"
 #endif
@@ -16,13 +21,28 @@
 namespace dp
 {
 
+namespace
+{
+
+// Small uploads (single glyphs, palette rows) are cheaper to hand to the
+// driver directly; staging pays off on atlas-scale transfers only.
+uint32_t const kPixelBufferUploadThreshold = 64 * 1024;
+
+} // namespace
+
 HWTexture::HWTexture()
   : m_width(0)
   , m_height(0)
   , m_format(UNSPECIFIED)
   , m_textureID(-1)
   , m_filter(gl_const::GLLinear)
+  , m_memSize(0)
+{
+}
+
+HWTexture::~HWTexture()
 {
+  GPUMemLedger::Instance().RemoveTextureBytes(m_memSize);
 }
 
 void HWTexture::Create(Params const & params)
@@ -37,10 +57,9 @@ void HWTexture::Create(Params const & params, ref_ptr<void> /*data*/)
   m_format = params.m_format;
   m_filter = params.m_filter;
 
-#if defined(TRACK_GPU_MEM)
   glConst layout;
   glConst pixelType;
-  UnpackFormat(format, layout, pixelType);
+  UnpackFormat(m_format, layout, pixelType);
 
   uint32_t channelBitSize = 8;
   uint32_t channelCount = 4;
@@ -50,10 +69,14 @@ void HWTexture::Create(Params const & params, ref_ptr<void> /*data*/)
   if (layout == gl_const::GLAlpha)
     channelCount = 1;
 
-  uint32_t bitCount = channelBitSize * channelCount * m_width * m_height;
-  uint32_t memSize = bitCount >> 3;
-  dp::GPUMemTracker::Inst().AddAllocated("Texture", m_textureID, memSize);
-  dp::GPUMemTracker::Inst().SetUsed("Texture", m_textureID, memSize);
+  uint32_t const bitCount = channelBitSize * channelCount * m_width * m_height;
+  GPUMemLedger::Instance().RemoveTextureBytes(m_memSize);
+  m_memSize = bitCount >> 3;
+  GPUMemLedger::Instance().AddTextureBytes(m_memSize);
+
+#if defined(TRACK_GPU_MEM)
+  dp::GPUMemTracker::Inst().AddAllocated("Texture", m_textureID, m_memSize);
+  dp::GPUMemTracker::Inst().SetUsed("Texture", m_textureID, m_memSize);
 #endif
 }
 
@@ -129,6 +152,12 @@ OpenGLHWTexture::~OpenGLHWTexture()
 {
   if (m_textureID != -1)
     GLFunctions::glDeleteTexture(m_textureID);
+
+  for (uint32_t pbo : m_pixelBuffers)
+  {
+    if (pbo != 0)
+      GLFunctions::glDeleteBuffer(pbo);
+  }
 }
 
 void OpenGLHWTexture::Create(Params const & params, ref_ptr<void> data)
@@ -165,9 +194,45 @@ void OpenGLHWTexture::UploadData(uint32_t x, uint32_t y, uint32_t width, uint32_
   glConst pixelType;
   UnpackFormat(m_format, layout, pixelType);
 
+  uint32_t const byteCount = width * height * GetBytesPerPixel(m_format);
+  if (UsePixelBufferUpload(byteCount))
+  {
+    // Write pixels into an orphaned pixel buffer, then let glTexSubImage2D
+    // source them from driver-owned memory: the call returns without waiting
+    // for the transfer. Alternating two buffers keeps a fresh store available
+    // while the previous upload is still in flight.
+    m_pixelBufferIndex = (m_pixelBufferIndex + 1) % 2;
+    uint32_t & pbo = m_pixelBuffers[m_pixelBufferIndex];
+    if (pbo == 0)
+      pbo = GLFunctions::glGenBuffer();
+
+    GLFunctions::glBindBuffer(pbo, gl_const::GLPixelBufferWrite);
+    GLFunctions::glBufferData(gl_const::GLPixelBufferWrite, byteCount, nullptr, gl_const::GLStreamDraw);
+    void * bufferPointer = GLFunctions::glMapBuffer(gl_const::GLPixelBufferWrite);
+    memcpy(bufferPointer, data.get(), byteCount);
+    GLFunctions::glUnmapBuffer(gl_const::GLPixelBufferWrite);
+    GLFunctions::glTexSubImage2D(x, y, width, height, layout, pixelType, nullptr);
+    GLFunctions::glBindBuffer(0, gl_const::GLPixelBufferWrite);
+    return;
+  }
+
   GLFunctions::glTexSubImage2D(x, y, width, height, layout, pixelType, data.get());
 }
 
+bool OpenGLHWTexture::UsePixelBufferUpload(uint32_t byteCount) const
+{
+  if (byteCount < kPixelBufferUploadThreshold)
+    return false;
+
+  GLExtensionsList & extensions = GLExtensionsList::Instance();
+  if (!extensions.IsSupported(GLExtensionsList::PixelBufferObject) ||
+      !extensions.IsSupported(GLExtensionsList::MapBuffer))
+    return false;
+
+  // Pixel buffer uploads are known to be broken on Adreno 200 drivers.
+  return !SupportManager::Instance().IsAdreno200Device();
+}
+
 drape_ptr<HWTexture> OpenGLHWTextureAllocator::CreateTexture()
 {
   return make_unique_dp<OpenGLHWTexture>();
@@ -14,7 +14,7 @@ class HWTexture
 {
 public:
   HWTexture();
-  virtual ~HWTexture() {}
+  virtual ~HWTexture();
 
   struct Params
   {
@@ -60,6 +60,8 @@ protected:
   TextureFormat m_format;
   int32_t m_textureID;
   glConst m_filter;
+  // Size of the texture data store, accounted in GPUMemLedger.
+  uint32_t m_memSize;
 };
 
 class HWTextureAllocator
@@ -79,6 +81,14 @@ public:
   ~OpenGLHWTexture();
   void Create(Params const & params, ref_ptr<void> data) override;
   void UploadData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, ref_ptr<void> data) override;
+
+private:
+  bool UsePixelBufferUpload(uint32_t byteCount) const;
+
+  // Big uploads are staged through a pair of alternating pixel buffers,
+  // so glTexSubImage2D returns without waiting for the client-side copy.
+  uint32_t m_pixelBuffers[2] = { 0, 0 };
+  uint32_t m_pixelBufferIndex = 0;
 };
 
 class OpenGLHWTextureAllocator : public HWTextureAllocator
@@ -0,0 +1,109 @@
+#include "drape/object_pool.hpp"
+
+#include "std/cstdlib.hpp"
+
+namespace dp
+{
+
+namespace
+{
+
+// Every block starts with a header holding its size class; the header is
+// as big as the strictest alignment so the payload stays aligned.
+size_t const kHeaderSize = alignof(max_align_t);
+// Block sizes are rounded up to this granularity to form the size classes.
+size_t const kClassStep = 32;
+// Bigger blocks are rare and go straight to the heap allocator.
+size_t const kMaxPooledBlockSize = 1024;
+size_t const kClassCount = kMaxPooledBlockSize / kClassStep;
+// Released blocks kept per size class. Everything above is freed.
+size_t const kMaxFreeBlocksPerClass = 2048;
+
+// The size class is kept in the header; this value marks an unpooled block.
+uint32_t const kUnpooledClass = ~0u;
+
+uint32_t & BlockClass(void * block)
+{
+  return *static_cast<uint32_t *>(block);
+}
+
+}  // namespace
+
+SizeClassedPool & SizeClassedPool::Instance()
+{
+  static SizeClassedPool pool;
+  return pool;
+}
+
+SizeClassedPool::SizeClassedPool()
+  : m_freeLists(kClassCount)
+  , m_allocationCount(0)
+  , m_reuseCount(0)
+{
+}
+
+SizeClassedPool::~SizeClassedPool()
+{
+  for (vector<void *> & freeList : m_freeLists)
+  {
+    for (void * block : freeList)
+      free(block);
+  }
+}
+
+void * SizeClassedPool::Allocate(size_t size)
+{
+  size_t const blockSize = ((size + kHeaderSize) + kClassStep - 1) / kClassStep * kClassStep;
+  size_t const classIndex = blockSize / kClassStep - 1;
+
+  m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  void * block = nullptr;
+  if (classIndex < kClassCount)
+  {
+    threads::MutexGuard guard(m_lock);
+    vector<void *> & freeList = m_freeLists[classIndex];
+    if (!freeList.empty())
+    {
+      block = freeList.back();
+      freeList.pop_back();
+    }
+  }
+
+  if (block != nullptr)
+  {
+    m_reuseCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    block = malloc(blockSize);
+    BlockClass(block) = classIndex < kClassCount ? static_cast<uint32_t>(classIndex)
+                                                 : kUnpooledClass;
+  }
+
+  return static_cast<uint8_t *>(block) + kHeaderSize;
+}
+
+void SizeClassedPool::Deallocate(void * ptr)
+{
+  if (ptr == nullptr)
+    return;
+
+  void * block = static_cast<uint8_t *>(ptr) - kHeaderSize;
+  uint32_t const classIndex = BlockClass(block);
+  if (classIndex != kUnpooledClass)
+  {
+    ASSERT_LESS(classIndex, kClassCount, ());
+    threads::MutexGuard guard(m_lock);
+    vector<void *> & freeList = m_freeLists[classIndex];
+    if (freeList.size() < kMaxFreeBlocksPerClass)
+    {
+      freeList.push_back(block);
+      return;
+    }
+  }
+
+  free(block);
+}
+
+} // namespace dp
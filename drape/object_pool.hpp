@@ -3,8 +3,11 @@
 #include "base/assert.hpp"
 #include "base/mutex.hpp"
 
+#include "std/atomic.hpp"
+#include "std/cstdint.hpp"
 #include "std/list.hpp"
 #include "std/set.hpp"
+#include "std/vector.hpp"
 
 template <typename T, typename Factory>
 class ObjectPool
@@ -72,3 +75,40 @@ public:
   }
 };
 
+
+namespace dp
+{
+
+// Recycles the memory blocks of the small polymorphic objects created on
+// every tile build (map shapes, overlay handles, render buckets). Blocks are
+// grouped into size classes; a released block serves the next allocation of
+// the same class instead of going back to the heap allocator. The counters
+// allow to track the reuse rate.
+class SizeClassedPool
+{
+public:
+  static SizeClassedPool & Instance();
+
+  void * Allocate(size_t size);
+  void Deallocate(void * ptr);
+
+  // Total allocations served by the pool and the part of them served from
+  // a recycled block.
+  uint64_t GetAllocationCount() const { return m_allocationCount; }
+  uint64_t GetReuseCount() const { return m_reuseCount; }
+
+private:
+  SizeClassedPool();
+  ~SizeClassedPool();
+
+  SizeClassedPool(SizeClassedPool const &) = delete;
+  SizeClassedPool & operator=(SizeClassedPool const &) = delete;
+
+  vector<vector<void *>> m_freeLists;
+  threads::Mutex m_lock;
+
+  atomic<uint64_t> m_allocationCount;
+  atomic<uint64_t> m_reuseCount;
+};
+
+} // namespace dp
@@ -1,6 +1,7 @@
 #include "drape/overlay_handle.hpp"
 
 #include "drape/constants.hpp"
+#include "drape/object_pool.hpp"
 
 #include "base/macros.hpp"
 
@@ -24,6 +25,16 @@ private:
   uint8_t m_bufferID;
 };
 
+void * OverlayHandle::operator new(size_t size)
+{
+  return SizeClassedPool::Instance().Allocate(size);
+}
+
+void OverlayHandle::operator delete(void * ptr)
+{
+  SizeClassedPool::Instance().Deallocate(ptr);
+}
+
 OverlayHandle::OverlayHandle(OverlayID const & id, dp::Anchor anchor,
                              uint64_t priority, bool isBillboard)
   : m_id(id)
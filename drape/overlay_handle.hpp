@@ -95,6 +95,11 @@ public:
 
   virtual ~OverlayHandle() {}
 
+  // Handles are created in large numbers on every tile build, so their
+  // memory blocks are recycled through the size-classed pool.
+  void * operator new(size_t size);
+  void operator delete(void * ptr);
+
   bool IsVisible() const;
   void SetIsVisible(bool isVisible);
 
@@ -2,6 +2,8 @@
 
 #include "drape/constants.hpp"
 
+#include "base/math.hpp"
+
 #include "std/algorithm.hpp"
 #include "std/bind.hpp"
 
@@ -12,6 +14,11 @@ int const kFrameUpdatePeriod = 10;
 int const kAverageHandlesCount[dp::OverlayRanksCount] = { 300, 200, 50 };
 int const kInvalidFrame = -1;
 
+// A handle whose extended pixel rect deviates from its previous
+// position (compensated by the screen translation) by less than this
+// threshold keeps its placement without re-solving collisions.
+double const kIncrementalMoveThresholdPx = 0.5;
+
 namespace
 {
 
@@ -93,6 +100,11 @@ void OverlayTree::StartOverlayPlacing(ScreenBase const & screen)
   ASSERT(IsNeedUpdate(), ());
   Clear();
   m_handlesCache.clear();
+
+  m_incrementalPlacement = CanRetainPlacement(screen);
+  if (m_incrementalPlacement)
+    m_incrementalOffset = screen.GtoP(m2::PointD::Zero()) - m_prevScreen.GtoP(m2::PointD::Zero());
+
   m_traits.m_modelView = screen;
 
 #ifdef COLLECT_DISPLACEMENT_INFO
@@ -100,8 +112,48 @@ void OverlayTree::StartOverlayPlacing(ScreenBase const & screen)
 #endif
 }
 
+bool OverlayTree::CanRetainPlacement(ScreenBase const & screen) const
+{
+  // Retaining is possible only when every rect moved by the same
+  // screen translation, i.e. the displacement decisions of the
+  // previous placement are still valid.
+  return m_hasPrevPlacement && !m_prevRects.empty() &&
+         !screen.isPerspective() && !m_prevScreen.isPerspective() &&
+         screen.GetAngle() == m_prevScreen.GetAngle() &&
+         my::AlmostEqualAbsOrRel(screen.GetScale(), m_prevScreen.GetScale(), 1e-9);
+}
+
+bool OverlayTree::RetainPlacement(ref_ptr<OverlayHandle> handle)
+{
+  auto const it = m_prevRects.find(handle);
+  if (it == m_prevRects.end())
+    return false;
+
+  m2::RectD const rect = handle->GetExtendedPixelRect(GetModelView());
+  m2::PointD const expected = it->second.LeftBottom() + m_incrementalOffset;
+  if (fabs(rect.minX() - expected.x) > kIncrementalMoveThresholdPx ||
+      fabs(rect.minY() - expected.y) > kIncrementalMoveThresholdPx)
+  {
+    return false;
+  }
+
+  m_handlesCache.insert(handle);
+  TBase::Add(handle, rect);
+  return true;
+}
+
+void OverlayTree::InvalidatePlacementCache()
+{
+  m_prevRects.clear();
+  m_hasPrevPlacement = false;
+}
+
 void OverlayTree::Remove(ref_ptr<OverlayHandle> handle)
 {
+  // The handle is about to be destroyed; its address must not be
+  // matched by the incremental mode of a following placement.
+  m_prevRects.erase(handle);
+
   if (m_frameCounter == kInvalidFrame)
     return;
 
@@ -323,6 +375,12 @@ void OverlayTree::EndOverlayPlacing()
       if (!CheckHandle(handle, rank, parentOverlay))
         continue;
 
+      // A handle which kept its position on the screen keeps its
+      // placement too. New handles take the full path below and
+      // compete with the retained ones as usual.
+      if (m_incrementalPlacement && m_isDisplacementEnabled && RetainPlacement(handle))
+        continue;
+
       InsertHandle(handle, rank, parentOverlay);
     }
   }
@@ -336,6 +394,12 @@ void OverlayTree::EndOverlayPlacing()
     handle->SetCachingEnable(false);
   }
 
+  m_prevRects.clear();
+  for (auto const & handle : m_handlesCache)
+    m_prevRects.emplace(handle, handle->GetExtendedPixelRect(GetModelView()));
+  m_prevScreen = GetModelView();
+  m_hasPrevPlacement = true;
+
   m_frameCounter = 0;
 
 #ifdef DEBUG_OVERLAYS_OUTPUT
@@ -439,26 +503,46 @@ void OverlayTree::Select(m2::RectD const & rect, TOverlayContainer & result) con
   });
 }
 
+// The setters below are called unconditionally on viewport and mode
+// updates, so a value which did not actually change must not invalidate
+// the placement: otherwise every model view change costs a full overlay
+// re-solving pass.
 void OverlayTree::SetFollowingMode(bool mode)
 {
+  if (m_followingMode == mode)
+    return;
+
   m_followingMode = mode;
+  InvalidatePlacementCache();
 }
 
 void OverlayTree::SetDisplacementEnabled(bool enabled)
 {
+  if (m_isDisplacementEnabled == enabled)
+    return;
+
   m_isDisplacementEnabled = enabled;
+  InvalidatePlacementCache();
   m_frameCounter = kInvalidFrame;
 }
 
 void OverlayTree::SetDisplacementMode(int displacementMode)
 {
+  if (m_displacementMode == displacementMode)
+    return;
+
   m_displacementMode = displacementMode;
+  InvalidatePlacementCache();
   m_frameCounter = kInvalidFrame;
 }
 
 void OverlayTree::SetSelectedFeature(FeatureID const & featureID)
 {
+  if (m_selectedFeatureID == featureID)
+    return;
+
   m_selectedFeatureID = featureID;
+  InvalidatePlacementCache();
 }
 
 #ifdef COLLECT_DISPLACEMENT_INFO
@@ -9,8 +9,9 @@
 #include "base/buffer_vector.hpp"
 
 #include "std/array.hpp"
-#include "std/vector.hpp"
+#include "std/unordered_map.hpp"
 #include "std/unordered_set.hpp"
+#include "std/vector.hpp"
 
 namespace dp
 {
@@ -96,6 +97,10 @@ private:
   ref_ptr<OverlayHandle> FindParent(ref_ptr<OverlayHandle> handle, int searchingRank) const;
   void DeleteHandleWithParents(ref_ptr<OverlayHandle> handle, int currentRank);
 
+  bool CanRetainPlacement(ScreenBase const & screen) const;
+  bool RetainPlacement(ref_ptr<OverlayHandle> handle);
+  void InvalidatePlacementCache();
+
   int m_frameCounter;
   array<vector<ref_ptr<OverlayHandle>>, dp::OverlayRanksCount> m_handles;
   HandlesCache m_handlesCache;
@@ -106,6 +111,21 @@ private:
 
   FeatureID m_selectedFeatureID;
 
+  // State of the previous placement used by the incremental mode:
+  // extended pixel rects of the visible handles and the screen they
+  // were computed for. The keys are only compared by pointer, they
+  // are never dereferenced.
+  using TPlacementRects = unordered_map<ref_ptr<OverlayHandle>, m2::RectD, detail::OverlayHasher>;
+  TPlacementRects m_prevRects;
+  ScreenBase m_prevScreen;
+  bool m_hasPrevPlacement = false;
+
+  // True while the current placement pass may retain handles from the
+  // previous one.
+  bool m_incrementalPlacement = false;
+  // Screen translation between the previous and the current placement.
+  m2::PointD m_incrementalOffset = m2::PointD::Zero();
+
 #ifdef COLLECT_DISPLACEMENT_INFO
   TDisplacementInfo m_displacementInfo;
 #endif
@@ -2,6 +2,7 @@
 
 #include "drape/attribute_buffer_mutator.hpp"
 #include "drape/debug_rect_renderer.hpp"
+#include "drape/object_pool.hpp"
 #include "drape/overlay_handle.hpp"
 #include "drape/overlay_tree.hpp"
 #include "drape/vertex_array_buffer.hpp"
@@ -12,6 +13,16 @@
 namespace dp
 {
 
+void * RenderBucket::operator new(size_t size)
+{
+  return SizeClassedPool::Instance().Allocate(size);
+}
+
+void RenderBucket::operator delete(void * ptr)
+{
+  SizeClassedPool::Instance().Deallocate(ptr);
+}
+
 RenderBucket::RenderBucket(drape_ptr<VertexArrayBuffer> && buffer)
   : m_buffer(move(buffer))
 {
@@ -27,6 +27,11 @@ public:
   RenderBucket(drape_ptr<VertexArrayBuffer> && buffer);
   ~RenderBucket();
 
+  // Buckets are created on every tile build, so their memory blocks are
+  // recycled through the size-classed pool.
+  void * operator new(size_t size);
+  void operator delete(void * ptr);
+
   ref_ptr<VertexArrayBuffer> GetBuffer();
   drape_ptr<VertexArrayBuffer> && MoveBuffer();
 
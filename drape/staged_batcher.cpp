@@ -0,0 +1,120 @@
+#include "drape/staged_batcher.hpp"
+
+#include "base/assert.hpp"
+
+#include "std/cstring.hpp"
+
+namespace dp
+{
+
+void StagedBatcher::InsertTriangleList(GLState const & state, ref_ptr<AttributeProvider> params)
+{
+  Stage(Primitive::TriangleList, state, params, 0 /* vertexStride */, nullptr);
+}
+
+void StagedBatcher::InsertTriangleStrip(GLState const & state, ref_ptr<AttributeProvider> params)
+{
+  Stage(Primitive::TriangleStrip, state, params, 0 /* vertexStride */, nullptr);
+}
+
+void StagedBatcher::InsertTriangleFan(GLState const & state, ref_ptr<AttributeProvider> params)
+{
+  Stage(Primitive::TriangleFan, state, params, 0 /* vertexStride */, nullptr);
+}
+
+void StagedBatcher::InsertListOfStrip(GLState const & state, ref_ptr<AttributeProvider> params,
+                                      uint8_t vertexStride)
+{
+  Stage(Primitive::ListOfStrip, state, params, vertexStride, nullptr);
+}
+
+void StagedBatcher::InsertLineStrip(GLState const & state, ref_ptr<AttributeProvider> params)
+{
+  Stage(Primitive::LineStrip, state, params, 0 /* vertexStride */, nullptr);
+}
+
+void StagedBatcher::InsertLineRaw(GLState const & state, ref_ptr<AttributeProvider> params,
+                                  vector<int> const & indices)
+{
+  Stage(Primitive::LineRaw, state, params, 0 /* vertexStride */, &indices);
+}
+
+void StagedBatcher::SetFeatureMinZoom(int minZoom)
+{
+  m_featureMinZoom = minZoom;
+}
+
+void StagedBatcher::Clear()
+{
+  m_operations.clear();
+  m_streams.clear();
+}
+
+void StagedBatcher::MergeInto(ref_ptr<Batcher> batcher)
+{
+  for (Operation const & op : m_operations)
+  {
+    batcher->SetFeatureMinZoom(op.m_featureMinZoom);
+
+    AttributeProvider provider(op.m_streamCount, op.m_vertexCount);
+    for (uint8_t i = 0; i < op.m_streamCount; ++i)
+    {
+      Stream & stream = m_streams[op.m_firstStream + i];
+      provider.InitStream(i, stream.m_info, make_ref(stream.m_data.data()));
+    }
+
+    switch (op.m_primitive)
+    {
+    case Primitive::TriangleList:
+      batcher->InsertTriangleList(op.m_state, make_ref(&provider));
+      break;
+    case Primitive::TriangleStrip:
+      batcher->InsertTriangleStrip(op.m_state, make_ref(&provider));
+      break;
+    case Primitive::TriangleFan:
+      batcher->InsertTriangleFan(op.m_state, make_ref(&provider));
+      break;
+    case Primitive::ListOfStrip:
+      batcher->InsertListOfStrip(op.m_state, make_ref(&provider), op.m_vertexStride);
+      break;
+    case Primitive::LineStrip:
+      batcher->InsertLineStrip(op.m_state, make_ref(&provider));
+      break;
+    case Primitive::LineRaw:
+      batcher->InsertLineRaw(op.m_state, make_ref(&provider), op.m_rawIndices);
+      break;
+    }
+  }
+
+  Clear();
+}
+
+void StagedBatcher::Stage(Primitive primitive, GLState const & state,
+                          ref_ptr<AttributeProvider> params, uint8_t vertexStride,
+                          vector<int> const * rawIndices)
+{
+  ASSERT(params->IsDataExists(), ());
+
+  Operation op(primitive, state);
+  op.m_vertexCount = params->GetVertexCount();
+  op.m_firstStream = m_streams.size();
+  op.m_streamCount = params->GetStreamCount();
+  op.m_vertexStride = vertexStride;
+  op.m_featureMinZoom = m_featureMinZoom;
+  if (rawIndices != nullptr)
+    op.m_rawIndices = *rawIndices;
+
+  for (uint8_t i = 0; i < op.m_streamCount; ++i)
+  {
+    Stream stream;
+    stream.m_info = params->GetBindingInfo(i);
+    size_t const size = static_cast<size_t>(stream.m_info.GetElementSize()) * op.m_vertexCount;
+    stream.m_data.resize(size);
+    memcpy(stream.m_data.data(), params->GetRawPointer(i), size);
+    m_streams.push_back(move(stream));
+  }
+
+  m_operations.push_back(move(op));
+}
+
+} // namespace dp
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "drape/attribute_provider.hpp"
+#include "drape/batcher.hpp"
+#include "drape/binding_info.hpp"
+#include "drape/glstate.hpp"
+#include "drape/pointers.hpp"
+
+#include "std/vector.hpp"
+
+namespace dp
+{
+
+// Accumulates geometry on a producer thread without touching the GPU
+// buckets. Each producer owns its StagedBatcher, so staging needs no
+// synchronization at all; the filled instance is handed over to the
+// batching thread by move and merged into a Batcher in one pass. Only
+// primitives without overlay handles can be staged: an insertion with
+// a handle returns its indices range, which is not known until the
+// merge.
+class StagedBatcher
+{
+public:
+  void InsertTriangleList(GLState const & state, ref_ptr<AttributeProvider> params);
+  void InsertTriangleStrip(GLState const & state, ref_ptr<AttributeProvider> params);
+  void InsertTriangleFan(GLState const & state, ref_ptr<AttributeProvider> params);
+  void InsertListOfStrip(GLState const & state, ref_ptr<AttributeProvider> params, uint8_t vertexStride);
+  void InsertLineStrip(GLState const & state, ref_ptr<AttributeProvider> params);
+  void InsertLineRaw(GLState const & state, ref_ptr<AttributeProvider> params,
+                     vector<int> const & indices);
+
+  // Applies to the insertions staged after the call, mirroring
+  // Batcher::SetFeatureMinZoom on the serial path.
+  void SetFeatureMinZoom(int minZoom);
+
+  bool IsEmpty() const { return m_operations.empty(); }
+  void Clear();
+
+  // Replays the staged insertions into |batcher| preserving their
+  // order. Must be called on the thread owning |batcher|; the staged
+  // data is released afterwards.
+  void MergeInto(ref_ptr<Batcher> batcher);
+
+private:
+  enum class Primitive : uint8_t
+  {
+    TriangleList,
+    TriangleStrip,
+    TriangleFan,
+    ListOfStrip,
+    LineStrip,
+    LineRaw
+  };
+
+  // A deep copy of one attribute stream of the provider.
+  struct Stream
+  {
+    BindingInfo m_info;
+    vector<uint8_t> m_data;
+  };
+
+  struct Operation
+  {
+    Operation(Primitive primitive, GLState const & state)
+      : m_primitive(primitive)
+      , m_state(state)
+    {}
+
+    Primitive m_primitive;
+    GLState m_state;
+    uint32_t m_vertexCount = 0;
+    // Streams are stored by index into m_streams, so moving the whole
+    // StagedBatcher stays cheap and safe.
+    size_t m_firstStream = 0;
+    uint8_t m_streamCount = 0;
+    uint8_t m_vertexStride = 0;
+    int m_featureMinZoom = 0;
+    vector<int> m_rawIndices;
+  };
+
+  void Stage(Primitive primitive, GLState const & state, ref_ptr<AttributeProvider> params,
+             uint8_t vertexStride, vector<int> const * rawIndices);
+
+  vector<Operation> m_operations;
+  vector<Stream> m_streams;
+  int m_featureMinZoom = 0;
+};
+
+} // namespace dp
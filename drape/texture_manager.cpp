@@ -4,10 +4,12 @@
 #include "drape/static_texture.hpp"
 #include "drape/stipple_pen_resource.hpp"
 #include "drape/texture_of_colors.hpp"
+#include "drape/frame_profiler.hpp"
 #include "drape/glfunctions.hpp"
 #include "drape/utils/glyph_usage_tracker.hpp"
 
 #include "platform/platform.hpp"
+#include "platform/preferred_languages.hpp"
 
 #include "coding/file_name_utils.hpp"
 #include "coding/reader.hpp"
@@ -34,6 +36,8 @@ size_t const kDuplicatedGlyphsCount = 128;
 uint32_t const kReservedPatterns = 10;
 size_t const kReservedColors = 20;
 
+size_t const kMaxShapedTextCacheSize = 3000;
+
 float const kGlyphAreaMultiplier = 1.2f;
 float const kGlyphAreaCoverage = 0.9f;
 
@@ -56,6 +60,63 @@ void MultilineTextToUniString(TextureManager::TMultilineText const & text, strin
     outString.append(str.begin(), str.end());
 }
 
+// Code point ranges pre-rasterized into the persistent glyph cache
+// for the corresponding system language, so the first labels of the
+// user's script are served from the cache instead of stalling the
+// glyph generator. CJK ideographs are too numerous to pre-rasterize;
+// they are covered by the persistent cache after the first run.
+struct PrewarmRange
+{
+  char const * m_language;
+  strings::UniChar m_start;
+  strings::UniChar m_end;
+};
+
+PrewarmRange const kPrewarmRanges[] =
+{
+  {"ar", 0x0600, 0x06FF},  // Arabic
+  {"be", 0x0400, 0x045F},  // Cyrillic
+  {"bg", 0x0400, 0x045F},
+  {"el", 0x0370, 0x03FF},  // Greek
+  {"fa", 0x0600, 0x06FF},
+  {"he", 0x0590, 0x05FF},  // Hebrew
+  {"hi", 0x0900, 0x097F},  // Devanagari
+  {"hy", 0x0530, 0x058F},  // Armenian
+  {"ja", 0x3040, 0x30FF},  // Hiragana and Katakana
+  {"ka", 0x10A0, 0x10FF},  // Georgian
+  {"kk", 0x0400, 0x045F},
+  {"ko", 0x3130, 0x318F},  // Hangul compatibility jamo
+  {"mr", 0x0900, 0x097F},
+  {"ru", 0x0400, 0x045F},
+  {"sr", 0x0400, 0x045F},
+  {"th", 0x0E00, 0x0E7F},  // Thai
+  {"uk", 0x0400, 0x045F},
+  {"ur", 0x0600, 0x06FF},
+};
+
+strings::UniString GetPrewarmChars()
+{
+  strings::UniString chars;
+
+  // Basic Latin and Latin-1 letters are used on every map.
+  for (strings::UniChar c = 0x20; c <= 0x7E; ++c)
+    chars.push_back(c);
+  for (strings::UniChar c = 0xC0; c <= 0xFF; ++c)
+    chars.push_back(c);
+
+  string const lang = languages::GetCurrentNorm();
+  for (PrewarmRange const & range : kPrewarmRanges)
+  {
+    if (lang != range.m_language)
+      continue;
+    for (strings::UniChar c = range.m_start; c <= range.m_end; ++c)
+      chars.push_back(c);
+    break;
+  }
+
+  return chars;
+}
+
 string ReadFileToString(string const & filename)
 {
   string result;
@@ -230,6 +291,7 @@ void TextureManager::Release()
   m_hatchingTexture.reset();
 
   m_glyphTextures.clear();
+  m_shapedTextCache.clear();
 
   m_glyphManager.reset();
 }
@@ -241,6 +303,8 @@ bool TextureManager::UpdateDynamicTextures()
   if (!asyncRoutines && m_nothingToUpload.test_and_set())
     return false;
 
+  FrameProfiler::MeasurementGuard guard(FrameProfiler::StageTextureUpdate);
+
   m_colorTexture->UpdateState();
   m_stipplePenTexture->UpdateState();
 
@@ -473,6 +537,8 @@ void TextureManager::Init(Params const & params)
     else
       m_glyphGroups.push_back(GlyphGroup(start, end));
   });
+
+  m_glyphManager->PrewarmGlyphCache(GetPrewarmChars());
 }
 
 void TextureManager::Invalidate(string const & resPostfix)
@@ -525,7 +591,21 @@ void TextureManager::GetGlyphRegions(TMultilineText const & text, int fixedHeigh
 
 void TextureManager::GetGlyphRegions(strings::UniString const & text, int fixedHeight, TGlyphsBuffer & regions)
 {
+  auto const key = make_pair(text, fixedHeight);
+  auto const it = m_shapedTextCache.find(key);
+  if (it != m_shapedTextCache.end())
+  {
+    regions = it->second;
+    return;
+  }
+
   CalcGlyphRegions<strings::UniString, TGlyphsBuffer>(text, fixedHeight, regions);
+
+  // Repeated names dominate, so a simple full reset on overflow is enough
+  // to keep the cache bounded.
+  if (m_shapedTextCache.size() >= kMaxShapedTextCacheSize)
+    m_shapedTextCache.clear();
+  m_shapedTextCache.insert(make_pair(key, regions));
 }
 
 uint32_t TextureManager::GetAbsentGlyphsCount(ref_ptr<Texture> texture, strings::UniString const & text, int fixedHeight)
@@ -10,6 +10,7 @@
 
 #include <atomic>
 #include <list>
+#include <map>
 #include <vector>
 
 namespace dp
@@ -253,6 +254,10 @@ private:
   buffer_vector<GlyphGroup, 64> m_glyphGroups;
   buffer_vector<HybridGlyphGroup, 4> m_hybridGlyphGroups;
 
+  // Shaped glyph runs are reused between labels: the same name is shaped
+  // for every tile it appears in. Cleared together with glyph textures.
+  std::map<std::pair<strings::UniString, int>, TGlyphsBuffer> m_shapedTextCache;
+
   std::atomic_flag m_nothingToUpload;
 };
 
@@ -16,7 +16,8 @@ namespace
 }
 
 ColorPalette::ColorPalette(m2::PointU const & canvasSize)
-   : m_textureSize(canvasSize)
+   : m_canvas(canvasSize.x * canvasSize.y * kBytesPerPixel, 0)
+   , m_textureSize(canvasSize)
    , m_cursor(m2::PointU::Zero())
 {}
 
@@ -83,86 +84,64 @@ void ColorPalette::UploadResources(ref_ptr<Texture> texture)
     m_pendingNodes.swap(pendingNodes);
   }
 
-  buffer_vector<size_t, 3> ranges;
-  ranges.push_back(0);
-
-  uint32_t minX = pendingNodes[0].m_rect.minX();
+  // Pending colors are written into the CPU-side canvas and the dirty region
+  // is uploaded with a single texture update. The packing cursor only moves
+  // forward, so the dirty region is a contiguous row span.
+  uint32_t const byteStride = m_textureSize.x * kBytesPerPixel;
   for (size_t i = 0; i < pendingNodes.size(); ++i)
   {
-    m2::RectU const & currentRect = pendingNodes[i].m_rect;
-    if (minX > currentRect.minX())
+    PendingColor const & c = pendingNodes[i];
+
+    uint8_t const red = c.m_color.GetRed();
+    uint8_t const green = c.m_color.GetGreen();
+    uint8_t const blue = c.m_color.GetBlue();
+    uint8_t const alpha = c.m_color.GetAlfa();
+
+    uint8_t * pointer = m_canvas.data() + c.m_rect.minY() * byteStride +
+                        c.m_rect.minX() * kBytesPerPixel;
+    for (size_t row = 0; row < kResourceSize; row++)
     {
-      ranges.push_back(i);
-      minX = currentRect.minX();
+      for (size_t column = 0; column < kResourceSize; column++)
+      {
+        pointer[row * byteStride + column * kBytesPerPixel] = red;
+        pointer[row * byteStride + column * kBytesPerPixel + 1] = green;
+        pointer[row * byteStride + column * kBytesPerPixel + 2] = blue;
+        pointer[row * byteStride + column * kBytesPerPixel + 3] = alpha;
+      }
     }
   }
 
-  ranges.push_back(pendingNodes.size());
+  uint32_t const minY = pendingNodes.front().m_rect.minY();
+  uint32_t const maxY = pendingNodes.back().m_rect.maxY();
+  ASSERT_LESS_OR_EQUAL(maxY, m_textureSize.y, ());
 
-  for (size_t i = 1; i < ranges.size(); ++i)
+  if (pendingNodes.back().m_rect.minY() == minY)
   {
-    size_t startRange = ranges[i - 1];
-    size_t endRange = ranges[i];
-
-    m2::RectU const & startRect = pendingNodes[startRange].m_rect;
-    m2::RectU const & endRect = pendingNodes[endRange - 1].m_rect;
-
-    m2::RectU uploadRect;
-    if (startRect.minY() == endRect.minY() &&
-        startRect.maxY() == endRect.maxY())
-    {
-      uploadRect = m2::RectU(startRect.minX(), startRect.minY(), endRect.maxX(), endRect.maxY());
-    }
-    else
-    {
-      ASSERT(startRect.minX() == 0, ());
-      uploadRect = m2::RectU(0, startRect.minY(), m_textureSize.x, endRect.maxY());
-    }
-
-    size_t const pixelStride = uploadRect.SizeX();
-    size_t const byteCount = kBytesPerPixel * uploadRect.SizeX() * uploadRect.SizeY();
-    size_t const bufferSize = static_cast<size_t>(my::NextPowOf2(static_cast<uint32_t>(byteCount)));
+    // All pending colors are inside one row, so only the touched columns
+    // are uploaded.
+    uint32_t const minX = pendingNodes.front().m_rect.minX();
+    uint32_t const maxX = pendingNodes.back().m_rect.maxX();
+    uint32_t const regionStride = (maxX - minX) * kBytesPerPixel;
+    uint32_t const byteCount = regionStride * (maxY - minY);
+    uint32_t const bufferSize = my::NextPowOf2(byteCount);
 
     SharedBufferManager::shared_buffer_ptr_t buffer = SharedBufferManager::instance().reserveSharedBuffer(bufferSize);
     uint8_t * pointer = SharedBufferManager::GetRawPointer(buffer);
-    if (m_isDebug)
-      memset(pointer, 0, bufferSize);
-
-    uint32_t currentY = startRect.minY();
-    for (size_t j = startRange; j < endRange; ++j)
+    for (uint32_t y = minY; y < maxY; ++y)
     {
-      ASSERT(pointer < SharedBufferManager::GetRawPointer(buffer) + byteCount, ());
-      PendingColor const & c = pendingNodes[j];
-      if (c.m_rect.minY() > currentY)
-      {
-        pointer += kBytesPerPixel * pixelStride;
-        currentY = c.m_rect.minY();
-      }
-
-      uint32_t const byteStride = static_cast<uint32_t>(pixelStride * kBytesPerPixel);
-      uint8_t const red = c.m_color.GetRed();
-      uint8_t const green = c.m_color.GetGreen();
-      uint8_t const blue = c.m_color.GetBlue();
-      uint8_t const alpha = c.m_color.GetAlfa();
-
-      for (size_t row = 0; row < kResourceSize; row++)
-      {
-        for (size_t column = 0; column < kResourceSize; column++)
-        {
-          pointer[row * byteStride + column * kBytesPerPixel] = red;
-          pointer[row * byteStride + column * kBytesPerPixel + 1] = green;
-          pointer[row * byteStride + column * kBytesPerPixel + 2] = blue;
-          pointer[row * byteStride + column * kBytesPerPixel + 3] = alpha;
-        }
-      }
-
-      pointer += kResourceSize * kBytesPerPixel;
-      ASSERT(pointer <= SharedBufferManager::GetRawPointer(buffer) + byteCount, ());
+      memcpy(pointer + (y - minY) * regionStride,
+             m_canvas.data() + y * byteStride + minX * kBytesPerPixel, regionStride);
     }
 
-    pointer = SharedBufferManager::GetRawPointer(buffer);
-    texture->UploadData(uploadRect.minX(), uploadRect.minY(),
-                        uploadRect.SizeX(), uploadRect.SizeY(), make_ref(pointer));
+    texture->UploadData(minX, minY, maxX - minX, maxY - minY, make_ref(pointer));
+    SharedBufferManager::instance().freeSharedBuffer(bufferSize, buffer);
+  }
+  else
+  {
+    // The dirty region wraps to other rows: upload the whole row span from
+    // the canvas with one update.
+    texture->UploadData(0, minY, m_textureSize.x, maxY - minY,
+                        make_ref(m_canvas.data() + minY * byteStride));
   }
 }
 
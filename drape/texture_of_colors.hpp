@@ -7,6 +7,7 @@
 #include "base/buffer_vector.hpp"
 
 #include "std/mutex.hpp"
+#include "std/vector.hpp"
 
 namespace dp
 {
@@ -36,8 +37,6 @@ public:
   ref_ptr<Texture::ResourceInfo> MapResource(ColorKey const & key, bool & newResource);
   void UploadResources(ref_ptr<Texture> texture);
 
-  void SetIsDebug(bool isDebug) { m_isDebug = isDebug; }
-
 private:
   typedef map<Color, ColorResourceInfo> TPalette;
 
@@ -50,9 +49,12 @@ private:
   TPalette m_palette;
   TPalette m_predefinedPalette;
   buffer_vector<PendingColor, 16> m_pendingNodes;
+  // CPU-side copy of the texture canvas. It allows to upload all pending
+  // colors with a single texture update, even when they span several rows
+  // which already contain uploaded colors.
+  vector<uint8_t> m_canvas;
   m2::PointU m_textureSize;
   m2::PointU m_cursor;
-  bool m_isDebug = false;
   mutex m_lock;
   mutex m_mappingLock;
 };
@@ -0,0 +1,83 @@
+#include "drape/utils/gpu_mem_ledger.hpp"
+
+#include "base/assert.hpp"
+
+namespace dp
+{
+
+namespace
+{
+
+// Keeps the total GPU footprint of map geometry and textures well below the
+// point where 1 Gb devices start killing the application.
+uint64_t const kDefaultBudgetBytes = 256 * 1024 * 1024;
+
+} // namespace
+
+GPUMemLedger::GPUMemLedger()
+  : m_bufferBytes(0)
+  , m_textureBytes(0)
+  , m_budget(kDefaultBudgetBytes)
+{
+}
+
+GPUMemLedger & GPUMemLedger::Instance()
+{
+  static GPUMemLedger s_instance;
+  return s_instance;
+}
+
+void GPUMemLedger::AddBufferBytes(uint32_t size)
+{
+  m_bufferBytes += size;
+}
+
+void GPUMemLedger::RemoveBufferBytes(uint32_t size)
+{
+  ASSERT_GREATER_OR_EQUAL(m_bufferBytes.load(), size, ());
+  m_bufferBytes -= size;
+}
+
+void GPUMemLedger::AddTextureBytes(uint32_t size)
+{
+  m_textureBytes += size;
+}
+
+void GPUMemLedger::RemoveTextureBytes(uint32_t size)
+{
+  ASSERT_GREATER_OR_EQUAL(m_textureBytes.load(), size, ());
+  m_textureBytes -= size;
+}
+
+uint64_t GPUMemLedger::GetBufferBytes() const
+{
+  return m_bufferBytes.load();
+}
+
+uint64_t GPUMemLedger::GetTextureBytes() const
+{
+  return m_textureBytes.load();
+}
+
+uint64_t GPUMemLedger::GetTotalBytes() const
+{
+  return m_bufferBytes.load() + m_textureBytes.load();
+}
+
+void GPUMemLedger::SetBudget(uint64_t bytes)
+{
+  m_budget = bytes;
+}
+
+uint64_t GPUMemLedger::GetBudget() const
+{
+  return m_budget.load();
+}
+
+bool GPUMemLedger::IsOverBudget() const
+{
+  uint64_t const budget = m_budget.load();
+  return budget != 0 && GetTotalBytes() > budget;
+}
+
+} // namespace dp
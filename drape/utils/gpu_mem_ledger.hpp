@@ -0,0 +1,41 @@
+#pragma once
+
+#include "std/atomic.hpp"
+#include "std/cstdint.hpp"
+#include "std/noncopyable.hpp"
+
+namespace dp
+{
+
+// Always-on ledger of GPU allocations. Unlike GPUMemTracker it keeps no
+// per-object records, only byte counters for buffer objects and textures,
+// so it is cheap enough to stay enabled in production builds and drive
+// memory-pressure decisions instead of waiting for the driver to act.
+class GPUMemLedger : private noncopyable
+{
+public:
+  static GPUMemLedger & Instance();
+
+  void AddBufferBytes(uint32_t size);
+  void RemoveBufferBytes(uint32_t size);
+  void AddTextureBytes(uint32_t size);
+  void RemoveTextureBytes(uint32_t size);
+
+  uint64_t GetBufferBytes() const;
+  uint64_t GetTextureBytes() const;
+  uint64_t GetTotalBytes() const;
+
+  /// Budget for all tracked allocations; 0 disables budget checks.
+  void SetBudget(uint64_t bytes);
+  uint64_t GetBudget() const;
+  bool IsOverBudget() const;
+
+private:
+  GPUMemLedger();
+
+  atomic<uint64_t> m_bufferBytes;
+  atomic<uint64_t> m_textureBytes;
+  atomic<uint64_t> m_budget;
+};
+
+} // namespace dp
@@ -6,13 +6,7 @@ namespace df
 // static
 bool Animation::GetCachedProperty(TPropertyCache const & properties, Object object, ObjectProperty property, PropertyValue & value)
 {
-  auto const it = properties.find(make_pair(object, property));
-  if (it != properties.end())
-  {
-    value = it->second;
-    return true;
-  }
-  return false;
+  return properties.Get(object, property, value);
 }
 
 // static
@@ -20,7 +14,7 @@ void Animation::GetCurrentScreen(TPropertyCache const & properties, ScreenBase c
 {
   currentScreen = screen;
 
-  if (!properties.empty())
+  if (!properties.IsEmpty())
   {
     double scale = currentScreen.GetScale();
     double angle = currentScreen.GetAngle();
@@ -69,10 +69,65 @@ public:
     };
   };
 
+  // Last known values of animated properties. A fixed slot is reserved for
+  // every (object, property) pair, so saving and reading values does not allocate.
+  class PropertyCache
+  {
+  public:
+    bool Get(Object object, ObjectProperty property, PropertyValue & value) const
+    {
+      size_t const obj = static_cast<size_t>(object);
+      size_t const prop = static_cast<size_t>(property);
+      if (!m_hasValue[obj][prop])
+        return false;
+      value = m_values[obj][prop];
+      return true;
+    }
+
+    void Set(Object object, ObjectProperty property, PropertyValue const & value)
+    {
+      m_values[static_cast<size_t>(object)][static_cast<size_t>(property)] = value;
+      m_hasValue[static_cast<size_t>(object)][static_cast<size_t>(property)] = true;
+    }
+
+    void Erase(Object object, ObjectProperty property)
+    {
+      m_hasValue[static_cast<size_t>(object)][static_cast<size_t>(property)] = false;
+    }
+
+    bool HasObject(Object object) const
+    {
+      size_t const obj = static_cast<size_t>(object);
+      for (size_t prop = 0; prop < kPropertiesCount; ++prop)
+      {
+        if (m_hasValue[obj][prop])
+          return true;
+      }
+      return false;
+    }
+
+    bool IsEmpty() const
+    {
+      for (size_t obj = 0; obj < kObjectsCount; ++obj)
+      {
+        if (HasObject(static_cast<Object>(obj)))
+          return false;
+      }
+      return true;
+    }
+
+  private:
+    static size_t constexpr kObjectsCount = static_cast<size_t>(Object::Selection) + 1;
+    static size_t constexpr kPropertiesCount = static_cast<size_t>(ObjectProperty::Angle) + 1;
+
+    PropertyValue m_values[kObjectsCount][kPropertiesCount];
+    bool m_hasValue[kObjectsCount][kPropertiesCount] = {};
+  };
+
   using TAnimObjects = std::set<Object>;
   using TObjectProperties = std::set<ObjectProperty>;
   using TAction = function<void(ref_ptr<Animation>)>;
-  using TPropertyCache = map<pair<Object, ObjectProperty>, Animation::PropertyValue>;
+  using TPropertyCache = PropertyCache;
 
   Animation(bool couldBeInterrupted, bool couldBeBlended)
     : m_couldBeInterrupted(couldBeInterrupted)
@@ -2,7 +2,6 @@
 
 #include "base/logging.hpp"
 
-#include "std/bind.hpp"
 #include "std/vector.hpp"
 #include "std/weak_ptr.hpp"
 
@@ -75,37 +74,50 @@ void AnimationSystem::UpdateLastScreen(ScreenBase const & currentScreen)
 
 bool AnimationSystem::GetScreen(ScreenBase const & currentScreen, ScreenBase & screen)
 {
-  return GetScreen(currentScreen, bind(&AnimationSystem::GetProperty, this, _1, _2, _3), screen);
+  return GetScreen(currentScreen, false /* targetValues */, screen);
 }
 
 void AnimationSystem::GetTargetScreen(ScreenBase const & currentScreen, ScreenBase & screen)
 {
-  GetScreen(currentScreen, bind(&AnimationSystem::GetTargetProperty, this, _1, _2, _3), screen);
+  GetScreen(currentScreen, true /* targetValues */, screen);
 }
 
-bool AnimationSystem::GetScreen(ScreenBase const & currentScreen, TGetPropertyFn const & getPropertyFn,  ScreenBase & screen)
+bool AnimationSystem::GetScreen(ScreenBase const & currentScreen, bool targetValues, ScreenBase & screen)
 {
-  ASSERT(getPropertyFn != nullptr, ());
-
   m_lastScreen = currentScreen;
 
   double scale = currentScreen.GetScale();
   double angle = currentScreen.GetAngle();
   m2::PointD pos = currentScreen.GlobalRect().GlobalZero();
 
+  bool changed = false;
   Animation::PropertyValue value;
-  if (getPropertyFn(Animation::Object::MapPlane, Animation::ObjectProperty::Scale, value))
+  if (targetValues ? GetTargetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Scale, value)
+                   : GetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Scale, value))
+  {
     scale = value.m_valueD;
+    changed = true;
+  }
 
-  if (getPropertyFn(Animation::Object::MapPlane, Animation::ObjectProperty::Angle, value))
+  if (targetValues ? GetTargetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Angle, value)
+                   : GetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Angle, value))
+  {
     angle = value.m_valueD;
+    changed = true;
+  }
 
-  if (getPropertyFn(Animation::Object::MapPlane, Animation::ObjectProperty::Position, value))
+  if (targetValues ? GetTargetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Position, value)
+                   : GetProperty(Animation::Object::MapPlane, Animation::ObjectProperty::Position, value))
+  {
     pos = value.m_valuePointD;
+    changed = true;
+  }
 
   screen = currentScreen;
-  screen.SetFromParams(pos, angle, scale);
+  if (!changed)
+    return false;
 
+  screen.SetFromParams(pos, angle, scale);
   return true;
 }
 
@@ -141,12 +153,7 @@ bool AnimationSystem::AnimationExists(Animation::Object object) const
         return true;
     }
   }
-  for (auto const & prop : m_propertyCache)
-  {
-    if (prop.first.first == object)
-      return true;
-  }
-  return false;
+  return m_propertyCache.HasObject(object);
 }
 
 bool AnimationSystem::HasAnimations() const
@@ -414,11 +421,9 @@ bool AnimationSystem::GetProperty(Animation::Object object, Animation::ObjectPro
     }
   }
 
-  auto it = m_propertyCache.find(make_pair(object, property));
-  if (it != m_propertyCache.end())
+  if (m_propertyCache.Get(object, property, value))
   {
-    value = it->second;
-    m_propertyCache.erase(it);
+    m_propertyCache.Erase(object, property);
     return true;
   }
   return false;
@@ -446,13 +451,7 @@ bool AnimationSystem::GetTargetProperty(Animation::Object object, Animation::Obj
     }
   }
 
-  auto it = m_propertyCache.find(make_pair(object, property));
-  if (it != m_propertyCache.end())
-  {
-    value = it->second;
-    return true;
-  }
-  return false;
+  return m_propertyCache.Get(object, property, value);
 }
 
 void AnimationSystem::SaveAnimationResult(Animation const & animation)
@@ -463,7 +462,7 @@ void AnimationSystem::SaveAnimationResult(Animation const & animation)
     {
       Animation::PropertyValue value;
       if (animation.GetProperty(object, property, value))
-        m_propertyCache[make_pair(object, property)] = value;
+        m_propertyCache.Set(object, property, value);
     }
   }
 }
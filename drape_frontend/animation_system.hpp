@@ -64,9 +64,7 @@ public:
 private:  
   AnimationSystem() = default;
 
-  using TGetPropertyFn = function<bool (Animation::Object object, Animation::ObjectProperty property,
-                                        Animation::PropertyValue & value)>;
-  bool GetScreen(ScreenBase const & currentScreen, TGetPropertyFn const & getPropertyFn,  ScreenBase & screen);
+  bool GetScreen(ScreenBase const & currentScreen, bool targetValues, ScreenBase & screen);
 
   bool GetProperty(Animation::Object object, Animation::ObjectProperty property,
                    Animation::PropertyValue & value) const;
@@ -82,10 +80,9 @@ private:
 
   using TAnimationList = list<shared_ptr<Animation>>;
   using TAnimationChain = deque<shared_ptr<TAnimationList>>;
-  using TPropertyCache = map<pair<Animation::Object, Animation::ObjectProperty>, Animation::PropertyValue>;
 
   TAnimationChain m_animationChain;
-  mutable TPropertyCache m_propertyCache;
+  mutable Animation::TPropertyCache m_propertyCache;
 
   ScreenBase m_lastScreen;
 };
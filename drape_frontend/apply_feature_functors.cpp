@@ -55,9 +55,6 @@ df::ColorConstant const kRoadShieldBlueBackgroundColor = "RoadShieldBlueBackgrou
 df::ColorConstant const kRoadShieldRedBackgroundColor = "RoadShieldRedBackground";
 df::ColorConstant const kRoadShieldOrangeBackgroundColor = "RoadShieldOrangeBackground";
 
-int const kLineSimplifyLevelStart = 10;
-int const kLineSimplifyLevelEnd = 12;
-
 uint32_t const kPathTextBaseTextIndex = 0;
 uint32_t const kPathTextBaseTextStep = 100;
 uint32_t const kShieldBaseTextIndex = 1000;
@@ -995,4 +992,15 @@ m2::PolylineD ApplyLineFeature::GetPolyline() const
   return HasGeometry() ? m2::PolylineD(m_spline->GetPath()) : m2::PolylineD();
 }
 
+void ApplyLineFeature::SetSpline(m2::SharedSpline const & spline)
+{
+  ASSERT(m_spline.IsNull(), ());
+  m_spline = spline;
+}
+
+m2::SharedSpline const & ApplyLineFeature::GetSpline() const
+{
+  return m_spline;
+}
+
 } // namespace df
@@ -36,6 +36,11 @@ struct BuildingOutline;
 
 using TInsertShapeFn = function<void(drape_ptr<MapShape> && shape)>;
 
+// Line features are additionally simplified on screen within this zoom range,
+// so their splines depend on the exact zoom level only here.
+int const kLineSimplifyLevelStart = 10;
+int const kLineSimplifyLevelEnd = 12;
+
 class BaseApplyFeature
 {
 public:
@@ -151,6 +156,10 @@ public:
 
   m2::PolylineD GetPolyline() const;
 
+  // Takes an already simplified spline instead of building it point by point.
+  void SetSpline(m2::SharedSpline const & spline);
+  m2::SharedSpline const & GetSpline() const;
+
 private:
   void GetRoadShieldsViewParams(ftypes::RoadShield const & shield,
                                 TextViewParams & textParams,
@@ -14,6 +14,7 @@
 
 #include "indexer/scales.hpp"
 
+#include "drape/gpu_buffer_pool.hpp"
 #include "drape/texture_manager.hpp"
 
 #include "platform/platform.hpp"
@@ -261,11 +262,12 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
       if (marksProvider->IsDirty())
       {
         size_t const layerId = msg->GetLayerId();
+        m2::RectD const dirtyRect = marksProvider->GetDirtyRect();
         m_commutator->PostMessage(ThreadsCommutator::RenderThread,
-                                  make_unique_dp<ClearUserMarkLayerMessage>(layerId),
+                                  make_unique_dp<ClearUserMarkLayerMessage>(layerId, dirtyRect),
                                   MessagePriority::Normal);
 
-        TUserMarkShapes shapes = CacheUserMarks(marksProvider, m_texMng);
+        TUserMarkShapes shapes = CacheUserMarks(marksProvider, dirtyRect, m_texMng);
         m_commutator->PostMessage(ThreadsCommutator::RenderThread,
                                   make_unique_dp<FlushUserMarksMessage>(layerId, move(shapes)),
                                   MessagePriority::Normal);
@@ -376,10 +378,22 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
   case Message::UpdateTraffic:
     {
       ref_ptr<UpdateTrafficMessage> msg = message;
-      m_trafficGenerator->UpdateColoring(msg->GetSegmentsColoring());
-      m_commutator->PostMessage(ThreadsCommutator::RenderThread,
-                                make_unique_dp<RegenerateTrafficMessage>(),
-                                MessagePriority::Normal);
+      auto const & coloring = msg->GetSegmentsColoring();
+      m_trafficGenerator->UpdateColoring(coloring);
+
+      // A coloring update regenerates traffic geometry from the cached
+      // per-tile segments instead of dropping and re-reading all the tiles.
+      // The outdated render data is cleared before the regenerated one arrives.
+      for (auto const & mwmColoring : coloring)
+      {
+        m_commutator->PostMessage(ThreadsCommutator::RenderThread,
+                                  make_unique_dp<ClearTrafficDataMessage>(mwmColoring.first),
+                                  MessagePriority::Normal);
+      }
+      m_trafficGenerator->RegenerateFromCache(coloring, m_texMng, [this](TileKey const & tileKey)
+      {
+        return m_requestedTiles->CheckTileKey(tileKey) && m_readManager->CheckTileKey(tileKey);
+      });
       break;
     }
 
@@ -481,6 +495,7 @@ void BackendRenderer::OnContextDestroy()
   m_texMng->Release();
   m_overlays.clear();
   m_trafficGenerator->ClearGLDependentResources();
+  dp::GPUBufferPool::Instance().Clear();
 
   m_contextFactory->getResourcesUploadContext()->doneCurrent();
 }
@@ -519,6 +534,7 @@ void BackendRenderer::InitGLDependentResource()
   params.m_glyphMngParams.m_blacklist = "fonts_blacklist.txt";
   params.m_glyphMngParams.m_sdfScale = VisualParams::Instance().GetGlyphSdfScale();
   params.m_glyphMngParams.m_baseGlyphHeight = VisualParams::Instance().GetGlyphBaseSize();
+  params.m_glyphMngParams.m_cacheFilePath = GetPlatform().WritablePathForFile("glyphs.cache");
   GetPlatform().GetFontNames(params.m_glyphMngParams.m_fonts);
 
   m_texMng->Init(params);
@@ -134,6 +134,13 @@ void DrapeEngine::Invalidate()
                                   MessagePriority::High);
 }
 
+void DrapeEngine::OnMemoryWarning()
+{
+  m_threadCommutator->PostMessage(ThreadsCommutator::RenderThread,
+                                  make_unique_dp<ShrinkGpuMemoryMessage>(),
+                                  MessagePriority::High);
+}
+
 void DrapeEngine::AddTouchEvent(TouchEvent const & event)
 {
   AddUserEvent(make_unique_dp<TouchEvent>(event));
@@ -175,6 +182,12 @@ void DrapeEngine::ChangeVisibilityUserMarksLayer(size_t layerId, bool isVisible)
 
 void DrapeEngine::UpdateUserMarksLayer(size_t layerId, UserMarksProvider * provider)
 {
+  // API marks can arrive in bursts (e.g. vehicle position ticks), so
+  // updates are coalesced: while a message for this provider is queued,
+  // new changes only accumulate in its dirty rect and are read together.
+  if (provider->SetUpdatePending())
+    return;
+
   m_threadCommutator->PostMessage(ThreadsCommutator::ResourceUploadThread,
                                   make_unique_dp<UpdateUserMarkLayerMessage>(layerId, provider),
                                   MessagePriority::Normal);
@@ -531,16 +544,17 @@ void DrapeEngine::EnableTraffic(bool trafficEnabled)
 
 void DrapeEngine::UpdateTraffic(traffic::TrafficInfo const & info)
 {
-  if (info.GetColoring().empty())
+  if (info.GetNumColoredSegments() == 0)
     return;
 
-#ifdef DEBUG
-  for (auto const & segmentPair : info.GetColoring())
-    ASSERT_NOT_EQUAL(segmentPair.second, traffic::SpeedGroup::Unknown, ());
-#endif
-
   df::TrafficSegmentsColoring segmentsColoring;
-  segmentsColoring.emplace(info.GetMwmId(), info.GetColoring());
+  auto & coloring = segmentsColoring[info.GetMwmId()];
+  info.ForEachColoredSegment([&coloring](traffic::TrafficInfo::RoadSegmentId const & id,
+                                         traffic::SpeedGroup group) {
+    ASSERT_NOT_EQUAL(group, traffic::SpeedGroup::Unknown, ());
+    // The segments are enumerated in the increasing order of keys.
+    coloring.emplace_hint(coloring.end(), id, group);
+  });
 
   m_threadCommutator->PostMessage(ThreadsCommutator::ResourceUploadThread,
                                   make_unique_dp<UpdateTrafficMessage>(move(segmentsColoring)),
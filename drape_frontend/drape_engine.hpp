@@ -108,6 +108,9 @@ public:
 
   void Resize(int w, int h);
   void Invalidate();
+  /// Called by the OS memory-warning handler: drops recyclable GPU caches
+  /// and off-screen geometry regardless of the configured budget.
+  void OnMemoryWarning();
 
   void SetVisibleViewport(m2::RectD const & rect) const;
 
@@ -55,6 +55,7 @@ SOURCES += \
     frontend_renderer.cpp \
     gps_track_renderer.cpp \
     gps_track_shape.cpp \
+    line_geometry_cache.cpp \
     line_shape.cpp \
     line_shape_helper.cpp \
     map_data_provider.cpp \
@@ -68,6 +69,7 @@ SOURCES += \
     path_symbol_shape.cpp \
     path_text_shape.cpp \
     poi_symbol_shape.cpp \
+    position_filter.cpp \
     read_manager.cpp \
     read_mwm_task.cpp \
     render_group.cpp \
@@ -160,6 +162,7 @@ HEADERS += \
     gps_track_renderer.hpp \
     gps_track_shape.hpp \
     intrusive_vector.hpp \
+    line_geometry_cache.hpp \
     line_shape.hpp \
     line_shape_helper.hpp \
     map_data_provider.hpp \
@@ -176,6 +179,7 @@ HEADERS += \
     path_symbol_shape.hpp \
     path_text_shape.hpp \
     poi_symbol_shape.hpp \
+    position_filter.hpp \
     read_manager.hpp \
     read_mwm_task.hpp \
     render_group.hpp \
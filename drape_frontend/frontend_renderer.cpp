@@ -14,10 +14,13 @@
 #include "drape_frontend/user_mark_shapes.hpp"
 
 #include "drape/debug_rect_renderer.hpp"
+#include "drape/frame_profiler.hpp"
+#include "drape/gpu_buffer_pool.hpp"
 #include "drape/shader_def.hpp"
 #include "drape/support_manager.hpp"
 
 #include "drape/utils/glyph_usage_tracker.hpp"
+#include "drape/utils/gpu_mem_ledger.hpp"
 #include "drape/utils/gpu_mem_tracker.hpp"
 #include "drape/utils/projection.hpp"
 
@@ -30,6 +33,7 @@
 #include "base/timer.hpp"
 #include "base/assert.hpp"
 #include "base/logging.hpp"
+#include "base/startup_tracer.hpp"
 #include "base/stl_add.hpp"
 
 #include "std/algorithm.hpp"
@@ -132,6 +136,7 @@ FrontendRenderer::FrontendRenderer(Params && params)
   , m_modelViewChangedFn(params.m_modelViewChangedFn)
   , m_tapEventInfoFn(params.m_tapEventFn)
   , m_userPositionChangedFn(params.m_positionChangedFn)
+  , m_tilesReadFinished(true)
   , m_requestedTiles(params.m_requestedTiles)
   , m_maxGeneration(0)
   , m_needRestoreSize(false)
@@ -262,6 +267,7 @@ void FrontendRenderer::AcceptMessage(ref_ptr<Message> message)
 
       if (m_notFinishedTiles.empty())
       {
+        m_tilesReadFinished = true;
 #if defined(DRAPE_MEASURER) && defined(GENERATING_STATISTIC)
         DrapeMeasurer::Instance().EndScenePreparing();
 #endif
@@ -298,9 +304,11 @@ void FrontendRenderer::AcceptMessage(ref_ptr<Message> message)
     {
       ref_ptr<ClearUserMarkLayerMessage> msg = message;
       size_t const layerId = msg->GetLayerId();
-      auto const functor = [&layerId](drape_ptr<UserMarkRenderGroup> const & g)
+      m2::RectD const & dirtyRect = msg->GetDirtyRect();
+      auto const functor = [&layerId, &dirtyRect](drape_ptr<UserMarkRenderGroup> const & g)
       {
-        return g->GetLayerId() == layerId;
+        return g->GetLayerId() == layerId &&
+               dirtyRect.IsIntersect(g->GetTileKey().GetGlobalRect());
       };
 
       auto const iter = remove_if(m_userMarkRenderGroups.begin(),
@@ -786,6 +794,12 @@ void FrontendRenderer::AcceptMessage(ref_ptr<Message> message)
       break;
     }
 
+  case Message::ShrinkGpuMemory:
+    {
+      ShrinkGpuMemory(true /* aggressive */);
+      break;
+    }
+
   default:
     ASSERT(false, ());
   }
@@ -930,6 +944,10 @@ void FrontendRenderer::AddToRenderGroup(dp::GLState const & state,
   RenderLayer::RenderLayerID id = RenderLayer::GetLayerID(state);
   RenderLayer & layer = m_layers[id];
 
+  // New buckets mean the scene is not settled yet, restart the merge countdown.
+  m_mergeBucketsPending = true;
+  m_mergeBucketsCounter = 0;
+
   for (auto const & g : layer.m_renderGroups)
   {
     if (!g->IsPendingOnDelete() && g->GetState() == state && g->GetTileKey().EqualStrict(newTile))
@@ -1097,6 +1115,8 @@ void FrontendRenderer::EndUpdateOverlayTree()
 
 void FrontendRenderer::RenderScene(ScreenBase const & modelView)
 {
+  dp::FrameProfiler::MeasurementGuard frameGuard(dp::FrameProfiler::StageFrame);
+
 #if defined(DRAPE_MEASURER) && (defined(RENDER_STATISTIC) || defined(TRACK_GPU_MEM))
   DrapeMeasurer::Instance().BeforeRenderFrame();
 #endif
@@ -1167,10 +1187,13 @@ void FrontendRenderer::RenderScene(ScreenBase const & modelView)
 #endif
 
   MergeBuckets();
+  CheckMemoryBudget();
 }
 
 void FrontendRenderer::Render2dLayer(ScreenBase const & modelView)
 {
+  dp::FrameProfiler::MeasurementGuard guard(dp::FrameProfiler::StageGeometry);
+
   RenderLayer & layer2d = m_layers[RenderLayer::Geometry2dID];
   layer2d.Sort(make_ref(m_overlayTree));
 
@@ -1180,6 +1203,8 @@ void FrontendRenderer::Render2dLayer(ScreenBase const & modelView)
 
 void FrontendRenderer::Render3dLayer(ScreenBase const & modelView, bool useFramebuffer)
 {
+  dp::FrameProfiler::MeasurementGuard guard(dp::FrameProfiler::StageGeometry);
+
   if (useFramebuffer)
   {
     ASSERT(m_framebuffer->IsSupported(), ());
@@ -1205,6 +1230,8 @@ void FrontendRenderer::Render3dLayer(ScreenBase const & modelView, bool useFrame
 
 void FrontendRenderer::RenderOverlayLayer(ScreenBase const & modelView)
 {
+  dp::FrameProfiler::MeasurementGuard guard(dp::FrameProfiler::StageOverlay);
+
   RenderLayer & overlay = m_layers[RenderLayer::OverlayID];
   BuildOverlayTree(modelView);
   for (drape_ptr<RenderGroup> & group : overlay.m_renderGroups)
@@ -1213,6 +1240,8 @@ void FrontendRenderer::RenderOverlayLayer(ScreenBase const & modelView)
 
 void FrontendRenderer::RenderTrafficAndRouteLayer(ScreenBase const & modelView)
 {
+  dp::FrameProfiler::MeasurementGuard guard(dp::FrameProfiler::StageTrafficAndRoute);
+
   GLFunctions::glClearDepth();
   GLFunctions::glEnable(gl_const::GLDepthTest);
   if (m_trafficRenderer->HasRenderData())
@@ -1253,6 +1282,8 @@ void FrontendRenderer::BuildOverlayTree(ScreenBase const & modelView)
 
 void FrontendRenderer::PrepareBucket(dp::GLState const & state, drape_ptr<dp::RenderBucket> & bucket)
 {
+  dp::FrameProfiler::MeasurementGuard guard(dp::FrameProfiler::StageBucketUpload);
+
   ref_ptr<dp::GpuProgram> program = m_gpuProgramManager->GetProgram(state.GetProgramIndex());
   ref_ptr<dp::GpuProgram> program3d = m_gpuProgramManager->GetProgram(state.GetProgram3dIndex());
   bool const isPerspective = m_userEventStream.GetCurrentScreen().isPerspective();
@@ -1268,11 +1299,24 @@ void FrontendRenderer::MergeBuckets()
   if (BatchMergeHelper::IsMergeSupported() == false)
     return;
 
+  if (!m_mergeBucketsPending)
+    return;
+
+  // Compaction pays off only in steady state. While tiles are still streaming in
+  // or the user is interacting, merged groups would be invalidated almost
+  // immediately and the readback/upload work would compete with frame production.
+  if (!m_notFinishedTiles.empty() || m_userEventStream.IsWaitingForActionCompletion())
+  {
+    m_mergeBucketsCounter = 0;
+    return;
+  }
+
   ++m_mergeBucketsCounter;
   if (m_mergeBucketsCounter < 60)
     return;
 
   m_mergeBucketsCounter = 0;
+  m_mergeBucketsPending = false;
 
   auto mergeFn = [](RenderLayer & layer, bool isPerspective)
   {
@@ -1318,6 +1362,46 @@ void FrontendRenderer::MergeBuckets()
   mergeFn(m_layers[RenderLayer::Geometry3dID], isPerspective);
 }
 
+void FrontendRenderer::CheckMemoryBudget()
+{
+  // The ledger is a pair of atomic counters, but eviction walks the render
+  // groups, so do not probe it on every frame.
+  ++m_budgetCheckCounter;
+  if (m_budgetCheckCounter < 60)
+    return;
+  m_budgetCheckCounter = 0;
+
+  if (dp::GPUMemLedger::Instance().IsOverBudget())
+    ShrinkGpuMemory(false /* aggressive */);
+}
+
+void FrontendRenderer::ShrinkGpuMemory(bool aggressive)
+{
+  // Pooled free stores are a pure cache, drop them first.
+  dp::GPUBufferPool::Instance().Shrink(0 /* targetPooledBytes */);
+  if (!aggressive && !dp::GPUMemLedger::Instance().IsOverBudget())
+    return;
+
+  // Tiles which went off screen are the least recently viewed geometry;
+  // evict them including the ones kept pending to avoid blinking. They
+  // will be re-read on demand if the user comes back.
+  m2::RectD const & screenRect = m_userEventStream.GetCurrentScreen().ClipRect();
+  auto removePredicate = [&screenRect](drape_ptr<RenderGroup> const & group)
+  {
+    return !group->GetTileKey().GetGlobalRect().IsIntersect(screenRect);
+  };
+  for (RenderLayer & layer : m_layers)
+    layer.m_isDirty |= RemoveGroups(removePredicate, layer.m_renderGroups, make_ref(m_overlayTree));
+
+  if (m_currentZoomLevel > 0)
+  {
+    m_trafficRenderer->OnUpdateViewport(CalcTilesCoverage(screenRect,
+                                                          ClipTileZoomByMaxDataZoom(m_currentZoomLevel),
+                                                          [](int, int) {}),
+                                        m_currentZoomLevel, buffer_vector<TileKey, 8>());
+  }
+}
+
 bool FrontendRenderer::IsPerspective() const
 {
   return m_userEventStream.GetCurrentScreen().isPerspective();
@@ -1600,6 +1684,7 @@ TTilesCollection FrontendRenderer::ResolveTileKeys(ScreenBase const & screen)
       tilesToDelete.push_back(key);
     }
   });
+  m_tilesReadFinished = m_notFinishedTiles.empty();
 
   // Remove old tiles.
   auto removePredicate = [this, &result, &tilesToDelete](drape_ptr<RenderGroup> const & group)
@@ -1658,6 +1743,7 @@ void FrontendRenderer::OnContextDestroy()
 #endif
 
   m_gpuProgramManager.reset();
+  dp::GPUBufferPool::Instance().Clear();
   m_contextFactory->getDrawContext()->doneCurrent();
 
   m_needRestoreSize = true;
@@ -1715,7 +1801,10 @@ void FrontendRenderer::Routine::Do()
   m_renderer.m_myPositionController->SetListener(ref_ptr<MyPositionController::Listener>(&m_renderer));
   m_renderer.m_userEventStream.SetListener(ref_ptr<UserEventStream::Listener>(&m_renderer));
 
-  m_renderer.OnContextCreate();
+  {
+    my::StartupTracer::Scope tracer("drape_context_create");
+    m_renderer.OnContextCreate();
+  }
 
   double const kMaxInactiveSeconds = 2.0;
   double const kShowOverlaysEventsPeriod = 5.0;
@@ -1727,6 +1816,7 @@ void FrontendRenderer::Routine::Do()
   double frameTime = 0.0;
   bool modelViewChanged = true;
   bool viewportChanged = true;
+  bool firstFrame = true;
 
   dp::OGLContext * context = m_renderer.m_contextFactory->getDrawContext();
 
@@ -1748,6 +1838,16 @@ void FrontendRenderer::Routine::Do()
     isActiveFrame |= m_renderer.m_texMng->UpdateDynamicTextures();
     m_renderer.RenderScene(modelView);
 
+    if (firstFrame)
+    {
+      firstFrame = false;
+      // The cold start is over: log the collected phase timeline and
+      // stop the tracer.
+      string const startupTrace = my::StartupTracer::Instance().Dump();
+      if (!startupTrace.empty())
+        LOG(LINFO, ("Startup timeline (us, B/E, phase):\n", startupTrace));
+    }
+
     if (modelViewChanged || m_renderer.m_needRegenerateTraffic)
       m_renderer.UpdateScene(modelView);
 
@@ -142,6 +142,10 @@ public:
 
   drape_ptr<ScenarioManager> const & GetScenarioManager() const;
 
+  /// Thread-safe. True when every tile requested for the current viewport
+  /// has been read; polled by ScenarioManager's WaitForReadingAction.
+  bool IsTileReadingFinished() const { return m_tilesReadFinished; }
+
 protected:
   void AcceptMessage(ref_ptr<Message> message) override;
   unique_ptr<threads::IRoutine> CreateRoutine() override;
@@ -153,6 +157,8 @@ private:
   void RenderScene(ScreenBase const & modelView);
   void PrepareBucket(dp::GLState const & state, drape_ptr<dp::RenderBucket> & bucket);
   void MergeBuckets();
+  void CheckMemoryBudget();
+  void ShrinkGpuMemory(bool aggressive);
   void RenderSingleGroup(ScreenBase const & modelView, ref_ptr<BaseRenderGroup> group);
   void RefreshProjection(ScreenBase const & screen);
   void RefreshZScale(ScreenBase const & screen);
@@ -301,12 +307,16 @@ private:
 
   ScreenBase m_lastReadedModelView;
   TTilesCollection m_notFinishedTiles;
+  // Mirror of m_notFinishedTiles.empty() for threads other than the render one.
+  atomic<bool> m_tilesReadFinished;
 
   int m_currentZoomLevel = -1;
   
   ref_ptr<RequestedTiles> m_requestedTiles;
   uint64_t m_maxGeneration;
   int m_mergeBucketsCounter = 0;
+  bool m_mergeBucketsPending = false;
+  int m_budgetCheckCounter = 0;
 
   int m_lastRecacheRouteId = 0;
 
@@ -0,0 +1,71 @@
+#include "drape_frontend/line_geometry_cache.hpp"
+
+#include "base/assert.hpp"
+
+namespace df
+{
+
+namespace
+{
+
+uint32_t GetSplineMemorySize(m2::SharedSpline const & spline)
+{
+  // Spline keeps positions, directions and lengths of segments.
+  return static_cast<uint32_t>(spline->GetSize() * (2 * sizeof(m2::PointD) + sizeof(double)));
+}
+
+} // namespace
+
+LineGeometryCache::LineGeometryCache(uint32_t maxBytes)
+  : m_maxBytes(maxBytes)
+  , m_totalBytes(0)
+{}
+
+bool LineGeometryCache::Get(FeatureID const & id, int splineKey, m2::SharedSpline & spline)
+{
+  lock_guard<mutex> lock(m_lock);
+
+  auto const it = m_entries.find(make_pair(id, splineKey));
+  if (it == m_entries.end())
+    return false;
+
+  m_accessList.splice(m_accessList.begin(), m_accessList, it->second.m_accessIt);
+  spline = it->second.m_spline;
+  return true;
+}
+
+void LineGeometryCache::Put(FeatureID const & id, int splineKey, m2::SharedSpline const & spline)
+{
+  ASSERT(!spline.IsNull(), ());
+
+  uint32_t const bytes = GetSplineMemorySize(spline);
+  if (bytes > m_maxBytes)
+    return;
+
+  lock_guard<mutex> lock(m_lock);
+
+  TKey const key = make_pair(id, splineKey);
+  if (m_entries.find(key) != m_entries.end())
+    return;
+
+  while (m_totalBytes + bytes > m_maxBytes)
+  {
+    ASSERT(!m_accessList.empty(), ());
+    auto const evictIt = m_entries.find(m_accessList.back());
+    ASSERT(evictIt != m_entries.end(), ());
+    m_totalBytes -= evictIt->second.m_bytes;
+    m_entries.erase(evictIt);
+    m_accessList.pop_back();
+  }
+
+  m_accessList.push_front(key);
+
+  Entry entry;
+  entry.m_spline = spline;
+  entry.m_bytes = bytes;
+  entry.m_accessIt = m_accessList.begin();
+  m_entries.insert(make_pair(key, entry));
+  m_totalBytes += bytes;
+}
+
+} // namespace df
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "indexer/feature_decl.hpp"
+
+#include "geometry/spline.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/list.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
+#include "std/utility.hpp"
+
+namespace df
+{
+
+// Cache of simplified line geometry shared between tile reading threads.
+// Rebuilding a tile (style switch, traffic toggle) reuses splines built on
+// the previous read instead of parsing and simplifying features again.
+// Least recently used entries are evicted when the byte budget is exceeded.
+class LineGeometryCache
+{
+public:
+  explicit LineGeometryCache(uint32_t maxBytes);
+
+  bool Get(FeatureID const & id, int splineKey, m2::SharedSpline & spline);
+  void Put(FeatureID const & id, int splineKey, m2::SharedSpline const & spline);
+
+private:
+  using TKey = pair<FeatureID, int>;
+  using TAccessList = list<TKey>;
+
+  struct Entry
+  {
+    m2::SharedSpline m_spline;
+    uint32_t m_bytes;
+    TAccessList::iterator m_accessIt;
+  };
+
+  uint32_t const m_maxBytes;
+  uint32_t m_totalBytes;
+  map<TKey, Entry> m_entries;
+  TAccessList m_accessList;
+  mutex m_lock;
+};
+
+} // namespace df
@@ -3,6 +3,7 @@
 #include "drape_frontend/message.hpp"
 #include "drape_frontend/tile_key.hpp"
 
+#include "drape/object_pool.hpp"
 #include "drape/pointers.hpp"
 
 #include "geometry/point2d.hpp"
@@ -42,6 +43,11 @@ public:
     return (basePt - tileCenter) * scalar;
   }
 
+  // Shapes are created by tens of thousands on every tile build, so their
+  // memory blocks are recycled through the size-classed pool.
+  void * operator new(size_t size) { return dp::SizeClassedPool::Instance().Allocate(size); }
+  void operator delete(void * ptr) { dp::SizeClassedPool::Instance().Deallocate(ptr); }
+
 private:
   int m_minZoom = 0;
 };
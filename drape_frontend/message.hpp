@@ -77,11 +77,15 @@ public:
     DrapeApiFlush,
     SetCustomSymbols,
     UpdateCustomSymbols,
+    ShrinkGpuMemory,
   };
 
   virtual ~Message() {}
   virtual Type GetType() const { return Unknown; }
   virtual bool IsGLContextDependent() const { return false; }
+  // Returns true if the message carries the full state of its kind, so the
+  // queued messages of the same type become stale and can be dropped.
+  virtual bool SupersedesQueued() const { return false; }
 };
 
 enum class MessagePriority
@@ -3,6 +3,7 @@
 #include "base/assert.hpp"
 #include "base/stl_add.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/chrono.hpp"
 
 namespace df
@@ -52,6 +53,15 @@ void MessageQueue::PushMessage(drape_ptr<Message> && message, MessagePriority pr
   {
   case MessagePriority::Normal:
     {
+      if (message->SupersedesQueued())
+      {
+        Message::Type const type = message->GetType();
+        m_messages.erase(remove_if(m_messages.begin(), m_messages.end(),
+                                   [type](TMessageNode const & node)
+        {
+          return node.second == MessagePriority::Normal && node.first->GetType() == type;
+        }), m_messages.end());
+      }
       m_messages.emplace_back(move(message), priority);
       break;
     }
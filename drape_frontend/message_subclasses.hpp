@@ -214,9 +214,21 @@ class ClearUserMarkLayerMessage : public BaseUserMarkLayerMessage
 {
 public:
   ClearUserMarkLayerMessage(size_t layerId)
-    : BaseUserMarkLayerMessage(layerId) {}
+    : BaseUserMarkLayerMessage(layerId)
+    , m_dirtyRect(m2::RectD::GetInfiniteRect())
+  {}
+
+  ClearUserMarkLayerMessage(size_t layerId, m2::RectD const & dirtyRect)
+    : BaseUserMarkLayerMessage(layerId)
+    , m_dirtyRect(dirtyRect)
+  {}
 
   Type GetType() const override { return Message::ClearUserMarkLayer; }
+
+  m2::RectD const & GetDirtyRect() const { return m_dirtyRect; }
+
+private:
+  m2::RectD m_dirtyRect;
 };
 
 class ChangeUserMarkLayerVisibilityMessage : public BaseUserMarkLayerMessage
@@ -247,6 +259,9 @@ public:
   ~UpdateUserMarkLayerMessage() override
   {
     ASSERT(m_inProcess == false, ());
+    // The message can be destroyed unprocessed on queue cancellation;
+    // the flag must not keep blocking further updates in that case.
+    m_provider->ResetUpdatePending();
     m_provider->DecrementCounter();
     if (m_provider->IsPendingOnDelete() && m_provider->CanBeDeleted())
       delete m_provider;
@@ -472,6 +487,7 @@ public:
   {}
 
   Type GetType() const override { return Message::CompassInfo; }
+  bool SupersedesQueued() const override { return true; }
 
   location::CompassInfo const & GetInfo() const { return m_info; }
 
@@ -490,6 +506,7 @@ public:
   {}
 
   Type GetType() const override { return Message::GpsInfo; }
+  bool SupersedesQueued() const override { return true; }
 
   location::GpsInfo const & GetInfo() const { return m_info; }
   bool IsNavigable() const { return m_isNavigable; }
@@ -1181,4 +1198,13 @@ private:
   std::vector<FeatureID> m_symbolsFeatures;
 };
 
+class ShrinkGpuMemoryMessage : public Message
+{
+public:
+  ShrinkGpuMemoryMessage(){}
+
+  Type GetType() const override { return Message::ShrinkGpuMemory; }
+  bool IsGLContextDependent() const override { return true; }
+};
+
 } // namespace df
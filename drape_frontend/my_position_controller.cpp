@@ -372,7 +372,8 @@ void MyPositionController::OnLocationUpdate(location::GpsInfo const & info, bool
                                                     info.m_horizontalAccuracy);
   // Use FromLatLon instead of rect.Center() since in case of large info.m_horizontalAccuracy
   // there is significant difference between the real location and the estimated one.
-  m_position = MercatorBounds::FromLatLon(info.m_latitude, info.m_longitude);
+  m_position = m_positionFilter.OnLocationUpdate(
+      MercatorBounds::FromLatLon(info.m_latitude, info.m_longitude), info.m_timestamp);
   m_errorRadius = rect.SizeX() * 0.5;
 
   if (info.m_speed > 0.0)
@@ -470,6 +471,7 @@ void MyPositionController::LoseLocation()
   {
     ChangeMode(location::NotFollowNoPosition);
     SetIsVisible(false);
+    m_positionFilter.Reset();
   }
 }
 
@@ -482,7 +484,7 @@ void MyPositionController::OnCompassUpdate(location::CompassInfo const & info, S
       m_lastGPSBearing.ElapsedSeconds() < kGpsBearingLifetimeSec)
     return;
 
-  SetDirection(info.m_bearing);
+  SetDirection(m_positionFilter.OnCompassUpdate(info.m_bearing));
 
   if (m_isPositionAssigned && !AlmostCurrentAzimut(oldAzimut) && m_mode == location::FollowAndRotate)
   {
@@ -728,6 +730,9 @@ m2::PointD MyPositionController::GetDrawablePosition()
   if (m_isPendingAnimation)
     return m_oldPosition;
 
+  if (!m_positionIsObsolete && m_positionFilter.GetExtrapolatedPosition(position))
+    return position;
+
   return m_position;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "drape_frontend/my_position.hpp"
+#include "drape_frontend/position_filter.hpp"
 
 #include "drape/gpu_program_manager.hpp"
 #include "drape/uniform_values_storage.hpp"
@@ -161,6 +162,10 @@ private:
   my::Timer m_updateLocationTimer;
   double m_lastLocationTimestamp;
 
+  // Smooths raw fixes and bearings and extrapolates the arrow position
+  // between fixes, so the arrow moves at render frame rate on 1 Hz GPS.
+  PositionFilter m_positionFilter;
+
   m2::RectD m_pixelRect;
   m2::RectD m_visiblePixelRect;
   double m_positionYOffset;
@@ -0,0 +1,79 @@
+#include "drape_frontend/position_filter.hpp"
+
+#include "geometry/angles.hpp"
+
+#include "std/algorithm.hpp"
+
+namespace
+{
+// Steady-state gains of the filter: position converges fast, velocity slower.
+double const kPositionGain = 0.6;
+double const kVelocityGain = 0.2;
+// Compass bearings are noisy; keep only a fraction of each step.
+double const kBearingGain = 0.25;
+// Fixes further apart than this are treated as a new track.
+double const kResetIntervalSec = 10.0;
+// Extrapolate no longer than a couple of missed 1 Hz fixes.
+double const kMaxExtrapolationSec = 2.0;
+double const kMinIntervalSec = 0.1;
+}  // namespace
+
+namespace df
+{
+
+m2::PointD PositionFilter::OnLocationUpdate(m2::PointD const & position, double timestamp)
+{
+  double const dt = timestamp - m_lastTimestamp;
+  m_lastTimestamp = timestamp;
+  m_lastFixTimer.Reset();
+
+  if (!m_isPositionInitialized || dt <= 0.0 || dt >= kResetIntervalSec)
+  {
+    m_filteredPosition = position;
+    m_velocity = m2::PointD::Zero();
+    m_isPositionInitialized = true;
+    return m_filteredPosition;
+  }
+
+  m2::PointD const predicted = m_filteredPosition + m_velocity * dt;
+  m2::PointD const residual = position - predicted;
+  m_filteredPosition = predicted + residual * kPositionGain;
+  m_velocity = m_velocity + residual * (kVelocityGain / max(dt, kMinIntervalSec));
+  return m_filteredPosition;
+}
+
+double PositionFilter::OnCompassUpdate(double bearing)
+{
+  if (!m_isBearingInitialized)
+  {
+    m_filteredBearing = bearing;
+    m_isBearingInitialized = true;
+    return m_filteredBearing;
+  }
+
+  m_filteredBearing += ang::GetShortestDistance(m_filteredBearing, bearing) * kBearingGain;
+  m_filteredBearing = ang::AngleIn2PI(m_filteredBearing);
+  return m_filteredBearing;
+}
+
+bool PositionFilter::GetExtrapolatedPosition(m2::PointD & position) const
+{
+  if (!m_isPositionInitialized || m_velocity.IsAlmostZero())
+    return false;
+
+  double const elapsed = m_lastFixTimer.ElapsedSeconds();
+  if (elapsed >= kMaxExtrapolationSec)
+    return false;
+
+  position = m_filteredPosition + m_velocity * elapsed;
+  return true;
+}
+
+void PositionFilter::Reset()
+{
+  m_isPositionInitialized = false;
+  m_isBearingInitialized = false;
+  m_velocity = m2::PointD::Zero();
+}
+
+}  // namespace df
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "geometry/point2d.hpp"
+
+#include "base/timer.hpp"
+
+namespace df
+{
+
+// Alpha-beta (steady-state Kalman) filter over GPS fixes with constant
+// velocity extrapolation between them and a complementary low-pass for
+// compass bearings. The whole state is a handful of doubles, so per-frame
+// queries are allocation-free and cheap enough for the render loop.
+class PositionFilter
+{
+public:
+  /// Feeds the next GPS fix in mercator and returns the smoothed position.
+  /// @param timestamp fix time in seconds.
+  m2::PointD OnLocationUpdate(m2::PointD const & position, double timestamp);
+  /// Feeds the next compass bearing in radians and returns the smoothed one.
+  double OnCompassUpdate(double bearing);
+  /// Fills |position| with the last fix extrapolated along the filtered
+  /// velocity and returns true if extrapolation is applicable now.
+  bool GetExtrapolatedPosition(m2::PointD & position) const;
+  void Reset();
+
+private:
+  m2::PointD m_filteredPosition = m2::PointD::Zero();
+  m2::PointD m_velocity = m2::PointD::Zero();  // Mercator units per second.
+  double m_lastTimestamp = 0.0;
+  double m_filteredBearing = 0.0;
+  bool m_isPositionInitialized = false;
+  bool m_isBearingInitialized = false;
+  my::Timer m_lastFixTimer;
+};
+
+}  // namespace df
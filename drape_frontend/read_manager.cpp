@@ -17,6 +17,8 @@ namespace df
 namespace
 {
 
+uint32_t const kLineGeometryCacheBytes = 8 * 1024 * 1024;
+
 struct LessCoverageCell
 {
   bool operator()(shared_ptr<TileInfo> const & l, TileKey const & r) const
@@ -41,7 +43,7 @@ ReadManager::ReadManager(ref_ptr<ThreadsCommutator> commutator, MapDataProvider
                          bool allow3dBuildings, bool trafficEnabled)
   : m_commutator(commutator)
   , m_model(model)
-  , m_pool(make_unique_dp<threads::ThreadPool>(ReadCount(), bind(&ReadManager::OnTaskFinished, this, _1)))
+  , m_pool(make_unique_dp<threads::WorkStealingThreadPool>(ReadCount(), bind(&ReadManager::OnTaskFinished, this, _1)))
   , m_have3dBuildings(false)
   , m_allow3dBuildings(allow3dBuildings)
   , m_trafficEnabled(trafficEnabled)
@@ -49,6 +51,7 @@ ReadManager::ReadManager(ref_ptr<ThreadsCommutator> commutator, MapDataProvider
   , myPool(64, ReadMWMTaskFactory(m_model))
   , m_counter(0)
   , m_generationCounter(0)
+  , m_geometryCache(make_unique_dp<LineGeometryCache>(kLineGeometryCacheBytes))
 {
 }
 
@@ -93,6 +96,17 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
   m_modeChanged |= (m_have3dBuildings != have3dBuildings);
   m_have3dBuildings = have3dBuildings;
 
+  // Covering runs on every pan tick. If the screen did not change since the
+  // last frame, the coverage is the same set of tiles, so skip the set
+  // arithmetic below and only re-check delayed finish notifications. The size
+  // check protects against Invalidate() calls between two equal screens.
+  if (!m_modeChanged && !needRegenerateTraffic && screen == m_currentViewport &&
+      tiles.size() == m_tileInfos.size())
+  {
+    CheckFinishedTiles(TTileInfoCollection(m_tileInfos.begin(), m_tileInfos.end()));
+    return;
+  }
+
   if (m_modeChanged || needRegenerateTraffic || MustDropAllTiles(screen))
   {
     m_modeChanged = false;
@@ -103,7 +117,7 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
     IncreaseCounter(static_cast<int>(tiles.size()));
     m_generationCounter++;
 
-    for_each(tiles.begin(), tiles.end(), bind(&ReadManager::PushTaskBackForTileKey, this, _1, texMng));
+    PushTasksForTileKeys(buffer_vector<TileKey, 8>(tiles.begin(), tiles.end()), screen, texMng);
   }
   else
   {
@@ -138,7 +152,7 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
 
     IncreaseCounter(static_cast<int>(newTiles.size()));
     CheckFinishedTiles(readyTiles);
-    for_each(newTiles.begin(), newTiles.end(), bind(&ReadManager::PushTaskBackForTileKey, this, _1, texMng));
+    PushTasksForTileKeys(move(newTiles), screen, texMng);
   }
 
   m_currentViewport = screen;
@@ -200,10 +214,28 @@ bool ReadManager::MustDropAllTiles(ScreenBase const & screen) const
   return (oldScale != newScale) || !m_currentViewport.GlobalRect().IsIntersect(screen.GlobalRect());
 }
 
+void ReadManager::PushTasksForTileKeys(buffer_vector<TileKey, 8> && tileKeys, ScreenBase const & screen,
+                                       ref_ptr<dp::TextureManager> texMng)
+{
+  // The pool serves tasks in the order they were pushed, so tiles closer to
+  // the screen center are pushed first: the visually important part of the
+  // viewport completes before the edges.
+  m2::PointD const center = screen.GlobalRect().GlobalCenter();
+  sort(tileKeys.begin(), tileKeys.end(), [&center](TileKey const & l, TileKey const & r)
+  {
+    return l.GetGlobalRect().Center().SquareLength(center) <
+           r.GetGlobalRect().Center().SquareLength(center);
+  });
+
+  for (TileKey const & tileKey : tileKeys)
+    PushTaskBackForTileKey(tileKey, texMng);
+}
+
 void ReadManager::PushTaskBackForTileKey(TileKey const & tileKey, ref_ptr<dp::TextureManager> texMng)
 {
   shared_ptr<TileInfo> tileInfo(new TileInfo(make_unique_dp<EngineContext>(TileKey(tileKey, m_generationCounter),
-                                             m_commutator, texMng), m_customSymbolsContext));
+                                             m_commutator, texMng), m_customSymbolsContext,
+                                             make_ref(m_geometryCache)));
   tileInfo->Set3dBuildings(m_have3dBuildings && m_allow3dBuildings);
   tileInfo->SetTrafficEnabled(m_trafficEnabled);
   m_tileInfos.insert(tileInfo);
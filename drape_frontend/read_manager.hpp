@@ -2,6 +2,7 @@
 
 #include "drape_frontend/custom_symbol.hpp"
 #include "drape_frontend/engine_context.hpp"
+#include "drape_frontend/line_geometry_cache.hpp"
 #include "drape_frontend/read_mwm_task.hpp"
 #include "drape_frontend/tile_info.hpp"
 #include "drape_frontend/tile_utils.hpp"
@@ -12,7 +13,7 @@
 #include "drape/pointers.hpp"
 #include "drape/texture_manager.hpp"
 
-#include "base/thread_pool.hpp"
+#include "base/work_stealing_thread_pool.hpp"
 
 #include "std/atomic.hpp"
 #include "std/mutex.hpp"
@@ -52,13 +53,15 @@ private:
   bool MustDropAllTiles(ScreenBase const & screen) const;
 
   void PushTaskBackForTileKey(TileKey const & tileKey, ref_ptr<dp::TextureManager> texMng);
+  void PushTasksForTileKeys(buffer_vector<TileKey, 8> && tileKeys, ScreenBase const & screen,
+                            ref_ptr<dp::TextureManager> texMng);
 
 private:
   ref_ptr<ThreadsCommutator> m_commutator;
 
   MapDataProvider & m_model;
 
-  drape_ptr<threads::ThreadPool> m_pool;
+  drape_ptr<threads::WorkStealingThreadPool> m_pool;
 
   ScreenBase m_currentViewport;
   bool m_have3dBuildings;
@@ -88,6 +91,9 @@ private:
 
   CustomSymbolsContextPtr m_customSymbolsContext;
 
+  // Shared between tile reading tasks, survives tile rebuilds.
+  drape_ptr<LineGeometryCache> m_geometryCache;
+
   // TODO (@y): unfortunately on Debian Jessie libstdc++ does not
   // support atomic_exchange for shared pointers, so mutex is used
   // instead.  Get rid of this as soon as new libstdc++ is released.
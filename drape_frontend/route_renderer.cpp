@@ -275,9 +275,22 @@ void RouteRenderer::RenderRoute(ScreenBase const & screen, bool trafficShown,
     dp::ApplyState(state, prg);
     dp::ApplyUniforms(uniforms, prg);
 
-    // Render buckets.
-    for (drape_ptr<dp::RenderBucket> const & bucket : m_routeData->m_route.m_buckets)
-      bucket->Render(state.GetDrawAsLine());
+    // Render buckets. A bucket which is already passed or outside the viewport
+    // does not contribute to the frame.
+    double const inflation = m_currentHalfWidth * screenScale;
+    m2::RectD clipRect = screen.ClipRect();
+    clipRect.Inflate(inflation, inflation);
+    bool const checkBounds = m_routeData->m_bucketsBounds.size() == m_routeData->m_route.m_buckets.size();
+    for (size_t i = 0; i < m_routeData->m_route.m_buckets.size(); i++)
+    {
+      if (checkBounds)
+      {
+        RouteBucketBounds const & bounds = m_routeData->m_bucketsBounds[i];
+        if (bounds.m_endDistance < m_distanceFromBegin || !clipRect.IsIntersect(bounds.m_boundingRect))
+          continue;
+      }
+      m_routeData->m_route.m_buckets[i]->Render(state.GetDrawAsLine());
+    }
   }
 
   // Render arrows.
@@ -413,7 +426,10 @@ void RouteRenderer::Clear()
 void RouteRenderer::ClearGLDependentResources()
 {
   if (m_routeData != nullptr)
+  {
     m_routeData->m_route = RouteRenderProperty();
+    m_routeData->m_bucketsBounds.clear();
+  }
   if (m_startRouteSign != nullptr)
     m_startRouteSign->m_sign = RouteRenderProperty();
   if (m_finishRouteSign != nullptr)
@@ -28,6 +28,10 @@ float const kRightSide = -1.0f;
 float const kRouteDepth = 100.0f;
 float const kArrowsDepth = 200.0f;
 
+// The route is tessellated in chunks so that every render bucket covers
+// a continuous part of it and can be culled independently while rendering.
+size_t const kRoutePointsPerChunk = 512;
+
 void GetArrowTextureRegion(ref_ptr<dp::TextureManager> textures, dp::TextureManager::SymbolRegion & region)
 {
   textures->GetSymbolRegion("route-arrow", region);
@@ -130,6 +134,7 @@ void GenerateArrowsTriangles(glsl::vec4 const & pivot, vector<glsl::vec2> const
 
 void RouteShape::PrepareGeometry(vector<m2::PointD> const & path, m2::PointD const & pivot,
                                  vector<glsl::vec4> const & segmentsColors,
+                                 double baseDistance, float depthStep, float depth,
                                  TGeometryBuffer & geometry, TGeometryBuffer & joinsGeometry,
                                  double & outputLength)
 {
@@ -149,8 +154,10 @@ void RouteShape::PrepareGeometry(vector<m2::PointD> const & path, m2::PointD con
     length += glsl::length(segments[i].m_points[EndPoint] - segments[i].m_points[StartPoint]);
   outputLength = length;
 
-  float depth = 0.0f;
-  float const depthStep = kRouteDepth / (1 + segments.size());
+  // Vertex distances are global along the route: the shader clips the passed
+  // part against them and they drive the dash pattern.
+  length += static_cast<float>(baseDistance);
+
   for (int i = static_cast<int>(segments.size() - 1); i >= 0; i--)
   {
     UpdateNormals(&segments[i], (i > 0) ? &segments[i - 1] : nullptr,
@@ -435,16 +442,50 @@ void RouteShape::CacheRoute(ref_ptr<dp::TextureManager> textures, RouteData & ro
     segmentsColors.push_back(glsl::vec4(color.GetRedF(), color.GetGreenF(), color.GetBlueF(), alpha));
   }
 
-  TGeometryBuffer geometry;
-  TGeometryBuffer joinsGeometry;
-  PrepareGeometry(routeData.m_sourcePolyline.GetPoints(), routeData.m_pivot, segmentsColors,
-                  geometry, joinsGeometry, routeData.m_length);
-
   dp::GLState state = dp::GLState(gpu::ROUTE_PROGRAM, dp::GLState::GeometryLayer);
   state.SetColorTexture(textures->GetSymbolsTexture());
-  BatchGeometry(state, make_ref(geometry.data()), static_cast<uint32_t>(geometry.size()),
-                make_ref(joinsGeometry.data()), static_cast<uint32_t>(joinsGeometry.size()),
-                RV::GetBindingInfo(), routeData.m_route);
+
+  vector<m2::PointD> const & points = routeData.m_sourcePolyline.GetPoints();
+  ASSERT_GREATER(points.size(), 1, ());
+  size_t const segmentsCount = points.size() - 1;
+
+  // Depths are distributed over the whole route to keep the rendering order
+  // of self-intersecting parts the same in every chunk.
+  float const depthStep = kRouteDepth / (1 + segmentsCount);
+
+  routeData.m_length = 0.0;
+  for (size_t startIndex = 0; startIndex < segmentsCount; startIndex += kRoutePointsPerChunk)
+  {
+    size_t const endIndex = min(startIndex + kRoutePointsPerChunk, segmentsCount);
+
+    // Chunks share the boundary point, the round caps there merge into a join.
+    vector<m2::PointD> const path(points.begin() + startIndex, points.begin() + endIndex + 1);
+    vector<glsl::vec4> colors;
+    if (!segmentsColors.empty())
+      colors.assign(segmentsColors.begin() + startIndex, segmentsColors.begin() + endIndex);
+
+    TGeometryBuffer geometry;
+    TGeometryBuffer joinsGeometry;
+    double chunkLength = 0.0;
+    PrepareGeometry(path, routeData.m_pivot, colors, routeData.m_length, depthStep,
+                    static_cast<float>(segmentsCount - endIndex) * depthStep,
+                    geometry, joinsGeometry, chunkLength);
+
+    size_t const firstBucket = routeData.m_route.m_buckets.size();
+    BatchGeometry(state, make_ref(geometry.data()), static_cast<uint32_t>(geometry.size()),
+                  make_ref(joinsGeometry.data()), static_cast<uint32_t>(joinsGeometry.size()),
+                  RV::GetBindingInfo(), routeData.m_route);
+
+    RouteBucketBounds bounds;
+    bounds.m_startDistance = routeData.m_length;
+    bounds.m_endDistance = routeData.m_length + chunkLength;
+    for (m2::PointD const & pt : path)
+      bounds.m_boundingRect.Add(pt);
+    routeData.m_bucketsBounds.insert(routeData.m_bucketsBounds.end(),
+                                     routeData.m_route.m_buckets.size() - firstBucket, bounds);
+
+    routeData.m_length += chunkLength;
+  }
 }
 
 void RouteShape::BatchGeometry(dp::GLState const & state, ref_ptr<void> geometry, uint32_t geomSize,
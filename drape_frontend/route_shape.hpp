@@ -12,6 +12,7 @@
 #include "traffic/speed_groups.hpp"
 
 #include "geometry/polyline2d.hpp"
+#include "geometry/rect2d.hpp"
 
 #include "std/vector.hpp"
 
@@ -56,6 +57,15 @@ struct RouteRenderProperty
   RouteRenderProperty() : m_state(0, dp::GLState::GeometryLayer) {}
 };
 
+// Part of the route covered by one render bucket. Allows to skip buckets
+// which are already passed or outside the viewport without touching geometry.
+struct RouteBucketBounds
+{
+  double m_startDistance = 0.0;
+  double m_endDistance = 0.0;
+  m2::RectD m_boundingRect;
+};
+
 struct ArrowBorders
 {
   double m_startDistance = 0;
@@ -73,6 +83,8 @@ struct RouteData
   vector<traffic::SpeedGroup> m_traffic;
   double m_length;
   RouteRenderProperty m_route;
+  // Bounds of each bucket of m_route, in the same order.
+  vector<RouteBucketBounds> m_bucketsBounds;
   RoutePattern m_pattern;
   int m_recacheId;
 };
@@ -109,6 +121,7 @@ public:
 private:
   static void PrepareGeometry(vector<m2::PointD> const & path, m2::PointD const & pivot,
                               vector<glsl::vec4> const & segmentsColors,
+                              double baseDistance, float depthStep, float depth,
                               TGeometryBuffer & geometry, TGeometryBuffer & joinsGeometry,
                               double & outputLength);
   static void PrepareArrowGeometry(vector<m2::PointD> const & path, m2::PointD const & pivot,
@@ -2,6 +2,7 @@
 
 #include "drape_frontend/apply_feature_functors.hpp"
 #include "drape_frontend/engine_context.hpp"
+#include "drape_frontend/line_geometry_cache.hpp"
 #include "drape_frontend/stylist.hpp"
 #include "drape_frontend/traffic_renderer.hpp"
 #include "drape_frontend/visual_params.hpp"
@@ -117,12 +118,14 @@ RuleDrawer::RuleDrawer(TDrawerCallback const & drawerFn,
                        TIsCountryLoadedByNameFn const & isLoadedFn,
                        ref_ptr<EngineContext> engineContext,
                        CustomSymbolsContextPtr customSymbolsContext,
+                       ref_ptr<LineGeometryCache> geometryCache,
                        bool is3dBuildings, bool trafficEnabled)
   : m_callback(drawerFn)
   , m_checkCancelled(checkCancelled)
   , m_isLoadedFn(isLoadedFn)
   , m_context(engineContext)
   , m_customSymbolsContext(customSymbolsContext)
+  , m_geometryCache(geometryCache)
   , m_is3dBuildings(is3dBuildings)
   , m_trafficEnabled(trafficEnabled)
   , m_wasCancelled(false)
@@ -332,13 +335,38 @@ void RuleDrawer::operator()(FeatureType const & f)
     ApplyLineFeature apply(m_context->GetTileKey(), insertShape, f.GetID(),
                            m_currentScaleGtoP, minVisibleScale, f.GetRank(),
                            s.GetCaptionDescription(), f.GetPointsCount());
-    f.ForEachPoint(apply, zoomLevel);
+
+    // Simplified splines do not depend on the tile inside one zoom level,
+    // so a spline built on the previous read of this feature is reused.
+    // Outside the screen simplification range the spline depends only on the
+    // geometry scale bucket stored in the mwm; keying by the bucket lets
+    // adjacent zoom levels mapped to one bucket share the entry, so zooming
+    // does not redo geometry work for unchanged features.
+    int splineKey = zoomLevel;
+    if (zoomLevel < kLineSimplifyLevelStart || zoomLevel > kLineSimplifyLevelEnd)
+    {
+      int const scaleIndex = f.GetGeometryScaleIndex(zoomLevel);
+      if (scaleIndex != -1)
+        splineKey = -(scaleIndex + 1);
+    }
+
+    m2::SharedSpline cachedSpline;
+    bool const restored = m_geometryCache != nullptr &&
+                          m_geometryCache->Get(f.GetID(), splineKey, cachedSpline);
+    if (restored)
+      apply.SetSpline(cachedSpline);
+    else
+      f.ForEachPoint(apply, zoomLevel);
 
     if (CheckCancelled())
       return;
 
     if (apply.HasGeometry())
+    {
+      if (!restored && m_geometryCache != nullptr)
+        m_geometryCache->Put(f.GetID(), splineKey, apply.GetSpline());
       s.ForEachRule(bind(&ApplyLineFeature::ProcessRule, &apply, _1));
+    }
 
     apply.Finish(ftypes::GetRoadShields(f));
 
@@ -21,6 +21,7 @@ namespace df
 {
 
 class EngineContext;
+class LineGeometryCache;
 class Stylist;
 
 class RuleDrawer
@@ -35,6 +36,7 @@ public:
              TIsCountryLoadedByNameFn const & isLoadedFn,
              ref_ptr<EngineContext> engineContext,
              CustomSymbolsContextPtr customSymbolsContext,
+             ref_ptr<LineGeometryCache> geometryCache,
              bool is3dBuildings, bool trafficEnabled);
   ~RuleDrawer();
 
@@ -49,6 +51,7 @@ private:
 
   ref_ptr<EngineContext> m_context;
   CustomSymbolsContextPtr m_customSymbolsContext;
+  ref_ptr<LineGeometryCache> m_geometryCache;
   m2::RectD m_globalRect;
   double m_currentScaleGtoP;
   double m_trafficScalePtoG;
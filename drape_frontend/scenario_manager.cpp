@@ -5,6 +5,13 @@
 namespace df
 {
 
+namespace
+{
+// Protects WaitForReading against a paused or stuck rendering loop.
+auto const kMaxReadingWaitDuration = std::chrono::minutes(1);
+auto const kReadingPollInterval = std::chrono::milliseconds(30);
+} //  namespace
+
 ScenarioManager::ScenarioManager(FrontendRenderer * frontendRenderer)
   : m_frontendRenderer(frontendRenderer)
   , m_needInterrupt(false)
@@ -100,6 +107,24 @@ void ScenarioManager::ThreadRoutine()
         break;
       }
 
+    case ActionType::WaitForReading:
+      {
+        auto const startTime = std::chrono::steady_clock::now();
+        while (!m_frontendRenderer->IsTileReadingFinished())
+        {
+          {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Leave the flag set: the outer loop consumes it and stops the scenario.
+            if (m_needInterrupt)
+              break;
+          }
+          if (std::chrono::steady_clock::now() - startTime > kMaxReadingWaitDuration)
+            break;
+          std::this_thread::sleep_for(kReadingPollInterval);
+        }
+        break;
+      }
+
     default:
       LOG(LINFO, ("Unknown action in scenario"));
     }
@@ -24,7 +24,8 @@ public:
   enum class ActionType
   {
     CenterViewport,
-    WaitForTime
+    WaitForTime,
+    WaitForReading
   };
 
   class Action
@@ -64,6 +65,16 @@ public:
     Duration m_duration;
   };
 
+  /// Waits until every tile requested for the current viewport is read.
+  /// Unlike WaitForTime this makes a scenario measure the same amount of
+  /// work on fast and slow devices instead of whatever fits into a
+  /// wall-clock interval.
+  class WaitForReadingAction : public Action
+  {
+  public:
+    ActionType GetType() override { return ActionType::WaitForReading; }
+  };
+
   using Scenario = std::vector<std::unique_ptr<Action>>;
   using ScenarioCallback = std::function<void(std::string const & name)>;
 
@@ -228,26 +228,35 @@ void CaptionDescription::Init(FeatureType const & f,
                               drule::text_type_t const mainTextType,
                               bool const auxCaptionExists)
 {
+  string mainText;
+  string auxText;
+
   if (auxCaptionExists || type == feature::GEOM_LINE)
-    f.GetPreferredNames(m_mainText, m_auxText);
+    f.GetPreferredNames(mainText, auxText);
   else
-    f.GetReadableName(m_mainText);
+    f.GetReadableName(mainText);
 
   m_roadNumber = f.GetRoadNumber();
   m_houseNumber = f.GetHouseNumber();
 
-  ProcessZoomLevel(zoomLevel);
-  ProcessMainTextType(mainTextType);
+  ProcessZoomLevel(zoomLevel, mainText, auxText);
+  ProcessMainTextType(mainTextType, mainText);
+
+  // The same name is shaped in every tile its feature crosses; intern
+  // the captions so those copies share one allocation.
+  my::StringInternPool & pool = my::StringInternPool::Instance();
+  m_mainText = pool.Intern(mainText);
+  m_auxText = pool.Intern(auxText);
 }
 
 string const & CaptionDescription::GetMainText() const
 {
-  return m_mainText;
+  return m_mainText.Get();
 }
 
 string const & CaptionDescription::GetAuxText() const
 {
-  return m_auxText;
+  return m_auxText.Get();
 }
 
 string const & CaptionDescription::GetRoadNumber() const
@@ -258,41 +267,42 @@ string const & CaptionDescription::GetRoadNumber() const
 string CaptionDescription::GetPathName() const
 {
   // Always concat names for linear features because we process only one draw rule now.
-  if (m_mainText.empty())
-    return m_mainText;
+  if (m_mainText.IsEmpty())
+    return m_mainText.Get();
   else
-    return m_mainText + "   " + m_auxText;
+    return m_mainText.Get() + "   " + m_auxText.Get();
 }
 
 bool CaptionDescription::IsNameExists() const
 {
-  return !m_mainText.empty() || !m_houseNumber.empty();
+  return !m_mainText.IsEmpty() || !m_houseNumber.empty();
 }
 
-void CaptionDescription::ProcessZoomLevel(int const zoomLevel)
+void CaptionDescription::ProcessZoomLevel(int const zoomLevel, string & mainText, string & auxText)
 {
-  if (zoomLevel <= scales::GetUpperWorldScale() && !m_auxText.empty())
+  if (zoomLevel <= scales::GetUpperWorldScale() && !auxText.empty())
   {
-    m_auxText.clear();
+    auxText.clear();
   }
 
-  if (zoomLevel < 5 && m_mainText.size() > 50)
-    m_mainText.clear();
+  if (zoomLevel < 5 && mainText.size() > 50)
+    mainText.clear();
 }
 
-void CaptionDescription::ProcessMainTextType(drule::text_type_t const & mainTextType)
+void CaptionDescription::ProcessMainTextType(drule::text_type_t const & mainTextType,
+                                             string & mainText)
 {
   if (mainTextType == drule::text_type_housenumber)
   {
-    m_mainText.swap(m_houseNumber);
+    mainText.swap(m_houseNumber);
     m_houseNumber.clear();
   }
   else if (mainTextType == drule::text_type_name)
   {
     if (!m_houseNumber.empty())
     {
-      if (m_mainText.empty() || m_houseNumber.find(m_mainText) != string::npos)
-        m_houseNumber.swap(m_mainText);
+      if (mainText.empty() || m_houseNumber.find(mainText) != string::npos)
+        m_houseNumber.swap(mainText);
     }
   }
 }
@@ -5,6 +5,7 @@
 #include "indexer/drawing_rule_def.hpp"
 
 #include "base/buffer_vector.hpp"
+#include "base/interned_string.hpp"
 
 #include "std/function.hpp"
 #include "std/string.hpp"
@@ -53,12 +54,12 @@ struct CaptionDescription
 
 private:
   /// Clear aux name on high zoom and clear long main name on low zoom.
-  void ProcessZoomLevel(int const zoomLevel);
+  void ProcessZoomLevel(int const zoomLevel, string & mainText, string & auxText);
   /// Try to use house number as name of the object.
-  void ProcessMainTextType(drule::text_type_t const & mainTextType);
+  void ProcessMainTextType(drule::text_type_t const & mainTextType, string & mainText);
 
-  string m_mainText;
-  string m_auxText;
+  my::InternedString m_mainText;
+  my::InternedString m_auxText;
   string m_roadNumber;
   string m_houseNumber;
 };
@@ -9,7 +9,9 @@
 #include "std/algorithm.hpp"
 #include "std/bind.hpp"
 #include "std/iterator.hpp"
+#include "std/map.hpp"
 #include "std/numeric.hpp"
+#include "std/utility.hpp"
 
 
 namespace df
@@ -184,6 +186,36 @@ void SplitText(strings::UniString & visText,
   delimIndexes.push_back(count);
 }
 
+// Straight labels reorder and break the same names for every tile they
+// appear in, so the combined bidi + line-break result is memoized per
+// thread. A full reset on overflow keeps the cache bounded.
+size_t const kMaxTextBreakCacheSize = 5000;
+
+void GetVisibleTextAndBreaks(strings::UniString const & text, strings::UniString & visText,
+                             buffer_vector<size_t, 2> & delimIndexes)
+{
+  typedef pair<strings::UniString, buffer_vector<size_t, 2>> TCachedBreaking;
+  static thread_local map<strings::UniString, TCachedBreaking> cache;
+
+  auto const it = cache.find(text);
+  if (it != cache.end())
+  {
+    visText = it->second.first;
+    delimIndexes = it->second.second;
+    return;
+  }
+
+  visText = fribidi::log2vis(text);
+  if (visText == text)
+    SplitText(visText, delimIndexes);
+  else
+    delimIndexes.push_back(visText.size());
+
+  if (cache.size() >= kMaxTextBreakCacheSize)
+    cache.clear();
+  cache.insert(make_pair(text, make_pair(visText, delimIndexes)));
+}
+
 class XLayouter
 {
 public:
@@ -337,12 +369,9 @@ strings::UniString const & TextLayout::GetText() const
 StraightTextLayout::StraightTextLayout(strings::UniString const & text, float fontSize, bool isSdf,
                                        ref_ptr<dp::TextureManager> textures, dp::Anchor anchor)
 {
-  strings::UniString visibleText = fribidi::log2vis(text);
+  strings::UniString visibleText;
   buffer_vector<size_t, 2> delimIndexes;
-  if (visibleText == text)
-    SplitText(visibleText, delimIndexes);
-  else
-    delimIndexes.push_back(visibleText.size());
+  GetVisibleTextAndBreaks(text, visibleText, delimIndexes);
 
   TBase::Init(visibleText, fontSize, isSdf, textures);
   CalculateOffsets(anchor, m_textSizeRatio, m_metrics, delimIndexes, m_offsets, m_pixelSize);
@@ -5,8 +5,11 @@
 #include "drape_frontend/stylist.hpp"
 #include "drape_frontend/tile_info.hpp"
 
+#include "drape/frame_profiler.hpp"
+
 #include "indexer/scales.hpp"
 
+#include "base/alloc_tracker.hpp"
 #include "base/scope_guard.hpp"
 #include "base/logging.hpp"
 
@@ -16,9 +19,11 @@ namespace df
 {
 
 TileInfo::TileInfo(drape_ptr<EngineContext> && engineContext,
-                   CustomSymbolsContextWeakPtr customSymbolsContext)
+                   CustomSymbolsContextWeakPtr customSymbolsContext,
+                   ref_ptr<LineGeometryCache> geometryCache)
   : m_context(move(engineContext))
   , m_customSymbolsContext(customSymbolsContext)
+  , m_geometryCache(geometryCache)
   , m_is3dBuildings(false)
   , m_trafficEnabled(false)
   , m_isCanceled(false)
@@ -59,6 +64,9 @@ void TileInfo::ReadFeatureIndex(MapDataProvider const & model)
 
 void TileInfo::ReadFeatures(MapDataProvider const & model)
 {
+  TRACK_ALLOCATIONS_SCOPE(my::AllocTracker::SubsystemRendering);
+  dp::FrameProfiler::MeasurementGuard profilerGuard(dp::FrameProfiler::StageTileRead);
+
 #if defined(DRAPE_MEASURER) && defined(TILES_STATISTIC)
   DrapeMeasurer::Instance().StartTileReading();
 #endif
@@ -76,7 +84,7 @@ void TileInfo::ReadFeatures(MapDataProvider const & model)
                       bind(&TileInfo::IsCancelled, this),
                       model.m_isCountryLoadedByName,
                       make_ref(m_context), m_customSymbolsContext.lock(),
-                      m_is3dBuildings, m_trafficEnabled);
+                      m_geometryCache, m_is3dBuildings, m_trafficEnabled);
     model.ReadFeatures(bind<void>(ref(drawer), _1), m_featureInfo);
   }
 #if defined(DRAPE_MEASURER) && defined(TILES_STATISTIC)
@@ -18,6 +18,7 @@ class FeatureType;
 namespace df
 {
 
+class LineGeometryCache;
 class MapDataProvider;
 class Stylist;
 
@@ -27,7 +28,8 @@ public:
   DECLARE_EXCEPTION(ReadCanceledException, RootException);
 
   TileInfo(drape_ptr<EngineContext> && engineContext,
-           CustomSymbolsContextWeakPtr customSymbolsContext);
+           CustomSymbolsContextWeakPtr customSymbolsContext,
+           ref_ptr<LineGeometryCache> geometryCache);
 
   void ReadFeatures(MapDataProvider const & model);
   void Cancel();
@@ -54,6 +56,7 @@ private:
 private:
   drape_ptr<EngineContext> m_context;
   CustomSymbolsContextWeakPtr m_customSymbolsContext;
+  ref_ptr<LineGeometryCache> m_geometryCache;
   vector<FeatureID> m_featureInfo;
   bool m_is3dBuildings;
   bool m_trafficEnabled;
@@ -120,11 +120,47 @@ void TrafficGenerator::Init()
 void TrafficGenerator::ClearGLDependentResources()
 {
   InvalidateTexturesCache();
+  m_tilesGeometry.clear();
   m_batchersPool.reset();
 }
 
 void TrafficGenerator::FlushSegmentsGeometry(TileKey const & tileKey, TrafficSegmentsGeometry const & geom,
                                              ref_ptr<dp::TextureManager> textures)
+{
+  m_tilesGeometry[tileKey] = geom;
+  GenerateSegmentsGeometry(tileKey, geom, textures);
+}
+
+void TrafficGenerator::RegenerateFromCache(TrafficSegmentsColoring const & coloring,
+                                           ref_ptr<dp::TextureManager> textures,
+                                           TTileAliveFn const & isTileAlive)
+{
+  if (m_batchersPool == nullptr)
+    return;
+
+  for (auto it = m_tilesGeometry.begin(); it != m_tilesGeometry.end();)
+  {
+    if (!isTileAlive(it->first))
+    {
+      it = m_tilesGeometry.erase(it);
+      continue;
+    }
+
+    // Only mwms affected by the coloring update are regenerated.
+    TrafficSegmentsGeometry geometry;
+    for (auto const & mwmGeometry : it->second)
+    {
+      if (coloring.find(mwmGeometry.first) != coloring.end())
+        geometry.insert(mwmGeometry);
+    }
+    if (!geometry.empty())
+      GenerateSegmentsGeometry(it->first, geometry, textures);
+    ++it;
+  }
+}
+
+void TrafficGenerator::GenerateSegmentsGeometry(TileKey const & tileKey, TrafficSegmentsGeometry const & geom,
+                                                ref_ptr<dp::TextureManager> textures)
 {
   FillColorsCache(textures);
   ASSERT(m_colorsCacheValid, ());
@@ -220,11 +256,20 @@ void TrafficGenerator::ClearCache()
 {
   InvalidateTexturesCache();
   m_coloring.clear();
+  m_tilesGeometry.clear();
 }
 
 void TrafficGenerator::ClearCache(MwmSet::MwmId const & mwmId)
 {
   m_coloring.erase(mwmId);
+  for (auto it = m_tilesGeometry.begin(); it != m_tilesGeometry.end();)
+  {
+    it->second.erase(mwmId);
+    if (it->second.empty())
+      it = m_tilesGeometry.erase(it);
+    else
+      ++it;
+  }
 }
 
 void TrafficGenerator::InvalidateTexturesCache()
@@ -139,9 +139,15 @@ public:
   void Init();
   void ClearGLDependentResources();
 
+  using TTileAliveFn = function<bool (TileKey const &)>;
+
   void FlushSegmentsGeometry(TileKey const & tileKey, TrafficSegmentsGeometry const & geom,
                              ref_ptr<dp::TextureManager> textures);
   void UpdateColoring(TrafficSegmentsColoring const & coloring);
+  /// Regenerates traffic geometry of the given mwms from the cached per-tile
+  /// segments, so a coloring update does not require re-reading the tiles.
+  void RegenerateFromCache(TrafficSegmentsColoring const & coloring, ref_ptr<dp::TextureManager> textures,
+                           TTileAliveFn const & isTileAlive);
 
   void ClearCache();
   void ClearCache(MwmSet::MwmId const & mwmId);
@@ -179,6 +185,8 @@ private:
     }
   };
 
+  void GenerateSegmentsGeometry(TileKey const & tileKey, TrafficSegmentsGeometry const & geom,
+                                ref_ptr<dp::TextureManager> textures);
   void GenerateSegment(dp::TextureManager::ColorRegion const & colorRegion,
                        m2::PolylineD const & polyline, m2::PointD const & tileCenter,
                        bool generateCaps, float depth, float vOffset, float minU,
@@ -193,6 +201,10 @@ private:
 
   TrafficSegmentsColoring m_coloring;
 
+  // Source geometry of the read tiles. Entries of dead tiles are evicted
+  // on regeneration, re-read tiles overwrite their entries.
+  map<TileKey, TrafficSegmentsGeometry> m_tilesGeometry;
+
   array<dp::TextureManager::ColorRegion, static_cast<size_t>(traffic::SpeedGroup::Count)> m_colorsCache;
   bool m_colorsCacheValid = false;
 
@@ -78,8 +78,8 @@ struct UserPointVertex : gpu::BaseVertex
 
 using UPV = UserPointVertex;
 
-void CacheUserPoints(UserMarksProvider const * provider, ref_ptr<dp::TextureManager> textures,
-                     TUserMarkShapes & outShapes)
+void CacheUserPoints(UserMarksProvider const * provider, m2::RectD const & dirtyRect,
+                     ref_ptr<dp::TextureManager> textures, TUserMarkShapes & outShapes)
 {
   size_t markCount = provider->GetUserPointCount();
   if (markCount == 0)
@@ -91,6 +91,8 @@ void CacheUserPoints(UserMarksProvider const * provider, ref_ptr<dp::TextureMana
   {
     UserPointMark const * userMark = provider->GetUserPointMark(i);
     TileKey const tileKey = GetTileKeyByPoint(userMark->GetPivot(), kZoomLevel);
+    if (!tileKey.GetGlobalRect().IsIntersect(dirtyRect))
+      continue;
     marks[tileKey].push_back(userMark);
   }
 
@@ -153,8 +155,8 @@ void CacheUserPoints(UserMarksProvider const * provider, ref_ptr<dp::TextureMana
   }
 }
 
-void CacheUserLines(UserMarksProvider const * provider, ref_ptr<dp::TextureManager> textures,
-                    TUserMarkShapes & outShapes)
+void CacheUserLines(UserMarksProvider const * provider, m2::RectD const & dirtyRect,
+                    ref_ptr<dp::TextureManager> textures, TUserMarkShapes & outShapes)
 {
   int const kZoomLevel = 10;
   map<TileKey, vector<pair<UserLineMark const *, m2::SharedSpline>>> userLines;
@@ -173,6 +175,8 @@ void CacheUserLines(UserMarksProvider const * provider, ref_ptr<dp::TextureManag
     }
 
     TileKey const tileKey = GetTileKeyByPoint(rect.Center(), kZoomLevel);
+    if (!tileKey.GetGlobalRect().IsIntersect(dirtyRect))
+      continue;
     userLines[tileKey].push_back(make_pair(line, m2::SharedSpline(points)));
   }
 
@@ -210,11 +214,12 @@ void CacheUserLines(UserMarksProvider const * provider, ref_ptr<dp::TextureManag
 
 } // namespace
 
-TUserMarkShapes CacheUserMarks(UserMarksProvider const * provider, ref_ptr<dp::TextureManager> textures)
+TUserMarkShapes CacheUserMarks(UserMarksProvider const * provider, m2::RectD const & dirtyRect,
+                               ref_ptr<dp::TextureManager> textures)
 {
   TUserMarkShapes shapes;
-  CacheUserPoints(provider, textures, shapes);
-  CacheUserLines(provider, textures, shapes);
+  CacheUserPoints(provider, dirtyRect, textures, shapes);
+  CacheUserLines(provider, dirtyRect, textures, shapes);
   return shapes;
 }
 
@@ -7,6 +7,7 @@
 #include "drape/texture_manager.hpp"
 
 #include "geometry/point2d.hpp"
+#include "geometry/rect2d.hpp"
 
 #include "std/function.hpp"
 
@@ -27,7 +28,9 @@ struct UserMarkShape
 
 using TUserMarkShapes = vector<UserMarkShape>;
 
-TUserMarkShapes CacheUserMarks(UserMarksProvider const * provider,
+/// Caches only the marks falling into tiles which intersect dirtyRect,
+/// the rest of the layer is considered unchanged.
+TUserMarkShapes CacheUserMarks(UserMarksProvider const * provider, m2::RectD const & dirtyRect,
                                ref_ptr<dp::TextureManager> textures);
 
 } // namespace df
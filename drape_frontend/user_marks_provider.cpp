@@ -2,23 +2,43 @@
 
 df::UserMarksProvider::UserMarksProvider()
   : m_pendingOnDelete(false)
+  , m_pendingUpdate(false)
   , m_counter(0)
 {
 }
 
 void df::UserMarksProvider::BeginRead()
 {
+  // Drop the pending flag before taking the lock: changes made from now
+  // on may not be seen by this read and must post a new update.
+  m_pendingUpdate = false;
   Lock();
 }
 
+bool df::UserMarksProvider::SetUpdatePending()
+{
+  return m_pendingUpdate.exchange(true);
+}
+
+void df::UserMarksProvider::ResetUpdatePending()
+{
+  m_pendingUpdate = false;
+}
+
 bool df::UserMarksProvider::IsDirty() const
 {
   return m_isDirty;
 }
 
+m2::RectD const & df::UserMarksProvider::GetDirtyRect() const
+{
+  return m_dirtyRect;
+}
+
 void df::UserMarksProvider::EndRead()
 {
   m_isDirty = false;
+  m_dirtyRect.MakeEmpty();
   Unlock();
 }
 
@@ -58,6 +78,13 @@ void df::UserMarksProvider::BeginWrite()
 void df::UserMarksProvider::SetDirty()
 {
   m_isDirty = true;
+  m_dirtyRect = m2::RectD::GetInfiniteRect();
+}
+
+void df::UserMarksProvider::SetDirty(m2::PointD const & pt)
+{
+  m_isDirty = true;
+  m_dirtyRect.Add(pt);
 }
 
 void df::UserMarksProvider::EndWrite()
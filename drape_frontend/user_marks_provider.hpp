@@ -3,6 +3,7 @@
 #include "drape/drape_global.hpp"
 
 #include "geometry/point2d.hpp"
+#include "geometry/rect2d.hpp"
 
 #include "base/mutex.hpp"
 
@@ -47,6 +48,9 @@ public:
   void BeginRead();
 
   bool IsDirty() const;
+  /// Area affected by the changes since the last read. An infinite rect
+  /// means the whole layer must be regenerated.
+  m2::RectD const & GetDirtyRect() const;
   virtual bool IsDrawable() const = 0;
 
   virtual size_t GetUserPointCount() const = 0;
@@ -65,9 +69,18 @@ public:
   bool IsPendingOnDelete();
   void DeleteLater();
 
+  /// Returns the previous value. While an update message is in flight
+  /// the queued read will pick up later changes as well, so there is no
+  /// need to post another one.
+  bool SetUpdatePending();
+  void ResetUpdatePending();
+
 protected:
   void BeginWrite();
   void SetDirty();
+  /// Marks dirty only the area around the given point, so the layer
+  /// can be regenerated partially.
+  void SetDirty(m2::PointD const & pt);
   void EndWrite();
 
 private:
@@ -76,7 +89,9 @@ private:
 
   threads::Mutex m_mutex;
   bool m_isDirty = false;
+  m2::RectD m_dirtyRect;
   atomic<bool> m_pendingOnDelete;
+  atomic<bool> m_pendingUpdate;
   atomic<int> m_counter;
 };
 
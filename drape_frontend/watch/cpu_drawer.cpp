@@ -13,6 +13,7 @@
 
 #include "base/macros.hpp"
 #include "base/logging.hpp"
+#include "base/math.hpp"
 
 #include "std/algorithm.hpp"
 #include "std/bind.hpp"
@@ -310,6 +311,60 @@ void CPUDrawer::DrawSearchArrow(double azimut)
 void CPUDrawer::EndFrame(FrameImage & image)
 {
   m_renderer->EndFrame(image);
+  ClearShapes();
+}
+
+void CPUDrawer::CacheFrame(ScreenBase const & screen, int zoom)
+{
+  m2::RectD const frameRect = m_renderer->FrameRect();
+  m_frameCache.m_width = static_cast<uint32_t>(frameRect.SizeX());
+  m_frameCache.m_height = static_cast<uint32_t>(frameRect.SizeY());
+  m_renderer->CopyFrame(m_frameCache.m_data);
+  m_frameCache.m_screen = screen;
+  m_frameCache.m_zoom = zoom;
+  m_frameCache.m_isValid = true;
+
+  m_renderer->DiscardFrame();
+  ClearShapes();
+}
+
+bool CPUDrawer::RestoreFrameFromCache(ScreenBase const & screen, int zoom, uint32_t pxWidth,
+                                      uint32_t pxHeight, dp::Color const & bgColor)
+{
+  if (!m_frameCache.m_isValid || m_frameCache.m_zoom != zoom)
+    return false;
+
+  if (!my::AlmostEqualULPs(m_frameCache.m_screen.GetScale(), screen.GetScale()))
+    return false;
+
+  // Pixel offset of the requested window inside the cached frame.
+  m2::PointD const offset = m_frameCache.m_screen.GtoP(screen.PtoG(m2::PointD(0.0, 0.0)));
+  double const x = my::rounds(offset.x);
+  double const y = my::rounds(offset.y);
+
+  // A subpixel shift would misalign the map content with the overlays.
+  double const kMaxSubpixelShift = 0.1;
+  if (fabs(offset.x - x) > kMaxSubpixelShift || fabs(offset.y - y) > kMaxSubpixelShift)
+    return false;
+
+  if (x < 0.0 || y < 0.0 || x + pxWidth > m_frameCache.m_width ||
+      y + pxHeight > m_frameCache.m_height)
+    return false;
+
+  m_renderer->BeginFrame(pxWidth, pxHeight, bgColor);
+  m_renderer->BlitFrame(m_frameCache.m_data, m_frameCache.m_width, m_frameCache.m_height,
+                        static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+  return true;
+}
+
+void CPUDrawer::ResetFrameCache()
+{
+  m_frameCache.m_isValid = false;
+  m_frameCache.m_data.clear();
+}
+
+void CPUDrawer::ClearShapes()
+{
   m_stylers.clear();
   m_areasGeometry.clear();
   m_pathGeometry.clear();
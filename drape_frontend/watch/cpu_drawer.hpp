@@ -40,6 +40,16 @@ public:
 
   void BeginFrame(uint32_t width, uint32_t height, dp::Color const & bgColor);
   void Flush();
+  /// Sequential watch frames differ mostly by center, so the rasterized map
+  /// content is cached: CacheFrame stores the pixels of the current (backing)
+  /// frame and closes it, RestoreFrameFromCache begins a new frame from a
+  /// crop of the stored pixels when |screen| fits into the cached coverage
+  /// at the same zoom. The cache is dropped on zoom change, on map updates
+  /// (ResetFrameCache) and when the requested window leaves the coverage.
+  void CacheFrame(ScreenBase const & screen, int zoom);
+  bool RestoreFrameFromCache(ScreenBase const & screen, int zoom, uint32_t pxWidth,
+                             uint32_t pxHeight, dp::Color const & bgColor);
+  void ResetFrameCache();
   void DrawMyPosition(m2::PointD const & myPxPotision);
   void DrawSearchResult(m2::PointD const & pxPosition);
   void DrawSearchArrow(double azimut);
@@ -82,6 +92,7 @@ protected:
 
 private:
   void Render();
+  void ClearShapes();
 
 private:
   unique_ptr<SoftwareRenderer> m_renderer;
@@ -216,6 +227,18 @@ private:
   double m_visualScale;
 
   FeatureID m_currentFeatureID;
+
+  // Rasterized map content of the last backing frame.
+  struct FrameCache
+  {
+    vector<uint8_t> m_data;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    ScreenBase m_screen;
+    int m_zoom = 0;
+    bool m_isValid = false;
+  };
+  FrameCache m_frameCache;
 };
 
 }
@@ -586,6 +586,35 @@ void SoftwareRenderer::EndFrame(FrameImage & image)
   m_frameHeight = 0;
 }
 
+void SoftwareRenderer::CopyFrame(vector<uint8_t> & frame) const
+{
+  ASSERT(m_frameWidth > 0 && m_frameHeight > 0, ());
+  frame = m_frameBuffer;
+}
+
+void SoftwareRenderer::BlitFrame(vector<uint8_t> const & frame, uint32_t frameWidth,
+                                 uint32_t frameHeight, uint32_t srcX, uint32_t srcY)
+{
+  ASSERT(m_frameWidth > 0 && m_frameHeight > 0, ());
+  ASSERT_LESS_OR_EQUAL(srcX + m_frameWidth, frameWidth, ());
+  ASSERT_LESS_OR_EQUAL(srcY + m_frameHeight, frameHeight, ());
+  UNUSED_VALUE(frameHeight);
+
+  uint32_t const kBytesPerPixel = 4;
+  for (uint32_t y = 0; y < m_frameHeight; ++y)
+  {
+    memcpy(&m_frameBuffer[y * m_frameWidth * kBytesPerPixel],
+           &frame[((srcY + y) * frameWidth + srcX) * kBytesPerPixel],
+           m_frameWidth * kBytesPerPixel);
+  }
+}
+
+void SoftwareRenderer::DiscardFrame()
+{
+  m_frameWidth = 0;
+  m_frameHeight = 0;
+}
+
 m2::RectD SoftwareRenderer::FrameRect() const
 {
   return m2::RectD(0.0, 0.0, m_frameWidth, m_frameHeight);
@@ -74,6 +74,14 @@ public:
                            vector<m2::RectD> & rects);
 
   void EndFrame(FrameImage & image);
+  /// Copies the content of the current frame (raw RGBA rows) into |frame|.
+  void CopyFrame(vector<uint8_t> & frame) const;
+  /// Fills the current frame with a crop of a frame stored by CopyFrame.
+  /// The crop has the top-left corner at (srcX, srcY) and the size of the current frame.
+  void BlitFrame(vector<uint8_t> const & frame, uint32_t frameWidth, uint32_t frameHeight,
+                 uint32_t srcX, uint32_t srcY);
+  /// Closes the current frame without encoding an image.
+  void DiscardFrame();
   m2::RectD FrameRect() const;
 
   GlyphCache * GetGlyphCache() const { return m_glyphCache.get(); }
@@ -2,19 +2,101 @@
 
 #include "platform/platform.hpp"
 
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
 #include "coding/internal/file_data.hpp"
+#include "coding/read_write_utils.hpp"
 
 #include "base/logging.hpp"
 
+#include "std/cstring.hpp"
+#include "std/sstream.hpp"
 #include "std/string.hpp"
+#include "std/vector.hpp"
 
 using namespace pugi;
 
 namespace
 {
 char const * kEditorXMLFileName = "edits.xml";
+// Length-prefixed single-feature edit records appended by AppendEdit()
+// live here between full rewrites of the main file.
+char const * kEditorJournalFileName = "edits.journal";
+
+// When the journal grows past this size AppendEdit() refuses to append,
+// which makes the editor compact the edits with a full Save().
+uint64_t const kMaxJournalSizeBytes = 512 * 1024;
 
 string GetEditorFilePath() { return GetPlatform().WritablePathForFile(kEditorXMLFileName); }
+string GetJournalFilePath() { return GetPlatform().WritablePathForFile(kEditorJournalFileName); }
+
+void DeleteJournal()
+{
+  auto const journalFilePath = GetJournalFilePath();
+  uint64_t journalSize = 0;
+  if (my::GetFileSize(journalFilePath, journalSize))
+    my::DeleteFileX(journalFilePath);
+}
+
+// Replays a single-feature edit record over |doc|. An older edit of the
+// same feature (same mwm "name" and feature "mwm_file_index" attributes,
+// see osm::Editor::Save() for the format) is replaced wherever it is, so
+// the most recently appended record always wins.
+void MergeEditRecord(xml_node const & editRoot, xml_document & doc)
+{
+  xml_node root = doc.document_element();
+  if (!root)
+  {
+    doc.append_copy(editRoot);
+    return;
+  }
+
+  for (auto const & mwm : editRoot.children())
+  {
+    char const * mwmName = mwm.attribute("name").value();
+
+    xml_node docMwm;
+    for (auto const & candidate : root.children(mwm.name()))
+    {
+      if (strcmp(candidate.attribute("name").value(), mwmName) == 0)
+      {
+        docMwm = candidate;
+        break;
+      }
+    }
+
+    if (!docMwm)
+    {
+      root.append_copy(mwm);
+      continue;
+    }
+
+    for (auto const & section : mwm.children())
+    {
+      for (auto const & feature : section.children())
+      {
+        auto const index = feature.attribute("mwm_file_index").as_uint();
+        // The feature's status may have changed, so the old edit is
+        // looked for in every section, not only in |section|'s twin.
+        for (auto docSection : docMwm.children())
+        {
+          for (xml_node docFeature = docSection.first_child(); docFeature;)
+          {
+            xml_node const next = docFeature.next_sibling();
+            if (docFeature.attribute("mwm_file_index").as_uint() == index)
+              docSection.remove_child(docFeature);
+            docFeature = next;
+          }
+        }
+
+        xml_node docSection = docMwm.child(section.name());
+        if (!docSection)
+          docSection = docMwm.append_child(section.name());
+        docSection.append_copy(feature);
+      }
+    }
+  }
+}
 }  // namespace
 
 namespace editor
@@ -23,9 +105,16 @@ namespace editor
 bool LocalStorage::Save(xml_document const & doc)
 {
   auto const editorFilePath = GetEditorFilePath();
-  return my::WriteToTempAndRenameToFile(editorFilePath, [&doc](string const & fileName) {
-    return doc.save_file(fileName.data(), "  " /* indent */);
-  });
+  if (!my::WriteToTempAndRenameToFile(editorFilePath, [&doc](string const & fileName) {
+        return doc.save_file(fileName.data(), "  " /* indent */);
+      }))
+  {
+    return false;
+  }
+
+  // The main file now holds all the edits, so the journal is obsolete.
+  DeleteJournal();
+  return true;
 }
 
 bool LocalStorage::Load(xml_document & doc)
@@ -39,12 +128,93 @@ bool LocalStorage::Load(xml_document & doc)
     return false;
   }
 
+  auto const journalFilePath = GetJournalFilePath();
+  uint64_t journalSize = 0;
+  if (!my::GetFileSize(journalFilePath, journalSize) || journalSize == 0)
+    return true;
+
+  vector<char> buffer(journalSize);
+  try
+  {
+    FileReader(journalFilePath).Read(0 /* pos */, buffer.data(), buffer.size());
+  }
+  catch (Reader::Exception const & ex)
+  {
+    LOG(LERROR, ("Can't read the edits journal:", journalFilePath, ex.Msg()));
+    return false;
+  }
+
+  size_t numRecords = 0;
+  size_t pos = 0;
+  while (pos < buffer.size())
+  {
+    // Decode the VarUint record size by hand: an append interrupted in
+    // the middle of the prefix or of the payload tears the tail of the
+    // journal, and all complete records before it must still be merged.
+    uint64_t recordSize = 0;
+    uint32_t shift = 0;
+    bool prefixComplete = false;
+    while (pos < buffer.size() && !prefixComplete)
+    {
+      uint8_t const b = static_cast<uint8_t>(buffer[pos++]);
+      recordSize |= static_cast<uint64_t>(b & 127) << shift;
+      shift += 7;
+      prefixComplete = (b & 128) == 0;
+    }
+    if (!prefixComplete || recordSize > buffer.size() - pos)
+    {
+      LOG(LWARNING, ("Dropping a torn record at the end of the edits journal:", journalFilePath));
+      break;
+    }
+
+    xml_document edit;
+    if (edit.load_buffer(&buffer[pos], recordSize))
+    {
+      MergeEditRecord(edit.document_element(), doc);
+      ++numRecords;
+    }
+    else
+    {
+      LOG(LWARNING, ("Skipping a malformed edit record in", journalFilePath));
+    }
+    pos += recordSize;
+  }
+
+  LOG(LINFO, ("Merged", numRecords, "edit record(s) from the journal."));
+  // Compact right away so that the journal never outlives the edits
+  // which were merged from it.
+  return Save(doc);
+}
+
+bool LocalStorage::AppendEdit(xml_document const & edit)
+{
+  auto const journalFilePath = GetJournalFilePath();
+
+  uint64_t journalSize = 0;
+  if (my::GetFileSize(journalFilePath, journalSize) && journalSize >= kMaxJournalSizeBytes)
+    return false;  // Time to compact: the caller falls back to a full Save().
+
+  ostringstream record;
+  edit.save(record, "" /* indent */, format_raw);
+
+  try
+  {
+    FileWriter writer(journalFilePath, FileWriter::OP_APPEND);
+    rw::Write(writer, record.str());
+  }
+  catch (RootException const & ex)
+  {
+    LOG(LERROR, ("Can't append an edit to the journal:", journalFilePath, ex.Msg()));
+    return false;
+  }
+
   return true;
 }
 
 void LocalStorage::Reset()
 {
   my::DeleteFileX(GetEditorFilePath());
+  DeleteJournal();
 }
 
 // StorageMemory -----------------------------------------------------------------------------------
@@ -12,16 +12,27 @@ public:
 
   virtual bool Save(pugi::xml_document const & doc) = 0;
   virtual bool Load(pugi::xml_document & doc) = 0;
+  // Appends a single-feature edit record instead of rewriting all edits.
+  // |edit| is a whole document in the regular edits format which contains
+  // exactly one feature. Returns false when the storage does not support
+  // incremental writes or wants a full Save() to compact accumulated
+  // records; the caller should then fall back to Save().
+  virtual bool AppendEdit(pugi::xml_document const & edit) { return false; }
   virtual void Reset() = 0;
 };
 
 // Class which saves/loads edits to/from local file.
+// Single-feature edits are appended to a journal file next to the main
+// one, so saving an edit does not rewrite the whole XML. The journal is
+// merged into the main file and removed on Load() and on every full
+// Save().
 class LocalStorage : public StorageBase
 {
 public:
   // StorageBase overrides:
   bool Save(pugi::xml_document const & doc) override;
   bool Load(pugi::xml_document & doc) override;
+  bool AppendEdit(pugi::xml_document const & edit) override;
   void Reset() override;
 };
 
@@ -0,0 +1,136 @@
+#include "testing/testing.hpp"
+
+#include "editor/editor_storage.hpp"
+
+#include "platform/platform_tests_support/writable_dir_changer.hpp"
+
+#include "base/macros.hpp"
+
+#include "std/string.hpp"
+
+#include "3party/pugixml/src/pugixml.hpp"
+
+namespace editor
+{
+namespace
+{
+auto constexpr kEditorTestDir = "editor-tests";
+
+// Builds a one-feature edit record in the format produced by osm::Editor::SaveEdit().
+void MakeRecord(pugi::xml_document & edit, string const & mwmName, string const & section,
+                uint32_t index, string const & value)
+{
+  edit.reset();
+  auto root = edit.append_child("mapsme");
+  root.append_attribute("format_version") = 1;
+  auto mwm = root.append_child("mwm");
+  mwm.append_attribute("name") = mwmName.c_str();
+  mwm.append_attribute("version") = 0;
+  auto node = mwm.append_child(section.c_str()).append_child("node");
+  node.append_attribute("mwm_file_index") = index;
+  node.append_attribute("v") = value.c_str();
+}
+
+bool AppendRecord(StorageBase & storage, string const & mwmName, string const & section,
+                  uint32_t index, string const & value)
+{
+  pugi::xml_document edit;
+  MakeRecord(edit, mwmName, section, index, value);
+  return storage.AppendEdit(edit);
+}
+
+string GetFeatureValue(pugi::xml_document const & doc, string const & mwmName,
+                       string const & section, uint32_t index)
+{
+  for (auto const & mwm : doc.child("mapsme").children("mwm"))
+  {
+    if (mwmName != mwm.attribute("name").value())
+      continue;
+    for (auto const & feature : mwm.child(section.c_str()).children())
+    {
+      if (feature.attribute("mwm_file_index").as_uint() == index)
+        return feature.attribute("v").value();
+    }
+  }
+  return {};
+}
+
+size_t CountFeatures(pugi::xml_document const & doc, string const & mwmName,
+                     string const & section)
+{
+  size_t count = 0;
+  for (auto const & mwm : doc.child("mapsme").children("mwm"))
+  {
+    if (mwmName != mwm.attribute("name").value())
+      continue;
+    for (auto const & feature : mwm.child(section.c_str()).children())
+    {
+      UNUSED_VALUE(feature);
+      ++count;
+    }
+  }
+  return count;
+}
+
+UNIT_TEST(LocalStorage_JournalMerge)
+{
+  WritableDirChanger wdc(kEditorTestDir);
+
+  LocalStorage storage;
+  storage.Reset();
+
+  TEST(AppendRecord(storage, "TestMwm", "create", 1, "one"), ());
+  TEST(AppendRecord(storage, "TestMwm", "modify", 2, "two"), ());
+  TEST(AppendRecord(storage, "OtherMwm", "delete", 7, "seven"), ());
+  // Re-edit the first feature: the status changes and the last record must win.
+  TEST(AppendRecord(storage, "TestMwm", "modify", 1, "one-v2"), ());
+
+  pugi::xml_document doc;
+  TEST(storage.Load(doc), ());
+  TEST_EQUAL(CountFeatures(doc, "TestMwm", "create"), 0, ());
+  TEST_EQUAL(CountFeatures(doc, "TestMwm", "modify"), 2, ());
+  TEST_EQUAL(CountFeatures(doc, "OtherMwm", "delete"), 1, ());
+  TEST_EQUAL(GetFeatureValue(doc, "TestMwm", "modify", 1), "one-v2", ());
+  TEST_EQUAL(GetFeatureValue(doc, "TestMwm", "modify", 2), "two", ());
+
+  // Load() has compacted the journal into the main file; a second load
+  // must see exactly the same edits.
+  pugi::xml_document reloaded;
+  TEST(storage.Load(reloaded), ());
+  TEST_EQUAL(CountFeatures(reloaded, "TestMwm", "modify"), 2, ());
+  TEST_EQUAL(GetFeatureValue(reloaded, "TestMwm", "modify", 1), "one-v2", ());
+
+  // Records appended over an existing main file are merged on top of it.
+  TEST(AppendRecord(storage, "TestMwm", "modify", 3, "three"), ());
+  pugi::xml_document merged;
+  TEST(storage.Load(merged), ());
+  TEST_EQUAL(CountFeatures(merged, "TestMwm", "modify"), 3, ());
+  TEST_EQUAL(GetFeatureValue(merged, "TestMwm", "modify", 3), "three", ());
+
+  storage.Reset();
+}
+
+UNIT_TEST(LocalStorage_JournalDroppedByFullSave)
+{
+  WritableDirChanger wdc(kEditorTestDir);
+
+  LocalStorage storage;
+  storage.Reset();
+
+  TEST(AppendRecord(storage, "TestMwm", "modify", 1, "one"), ());
+
+  // A full Save() holds all the edits the editor knows about, so
+  // previously appended records must not resurface on the next load.
+  pugi::xml_document full;
+  MakeRecord(full, "TestMwm", "modify", 2, "two");
+  TEST(storage.Save(full), ());
+
+  pugi::xml_document loaded;
+  TEST(storage.Load(loaded), ());
+  TEST_EQUAL(CountFeatures(loaded, "TestMwm", "modify"), 1, ());
+  TEST_EQUAL(GetFeatureValue(loaded, "TestMwm", "modify", 2), "two", ());
+
+  storage.Reset();
+}
+}  // namespace
+}  // namespace editor
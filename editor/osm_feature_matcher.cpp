@@ -4,6 +4,7 @@
 #include "base/stl_helpers.hpp"
 
 #include "std/algorithm.hpp"
+#include "std/map.hpp"
 #include "std/utility.hpp"
 
 using editor::XMLFeature;
@@ -28,85 +29,102 @@ double ScoreLatLon(XMLFeature const & xmlFt, ms::LatLon const & latLon)
   return 1.0 - (a.Length(b) / kPointDiffEps);
 }
 
-template <typename TFunc>
-void ForEachWaysNode(pugi::xml_document const & osmResponse, pugi::xml_node const & way,
-                     TFunc && func)
+// Node centers and per-way geometries of one OSM server response.
+// XPath id lookups are linear in the document size, so extracting every
+// candidate's geometry through them made the matching quadratic; the
+// cache indexes the response once and reuses way geometries between the
+// way candidates and the relations they are members of.
+class ResponseGeometryCache
 {
-  for (auto const xNodeRef : way.select_nodes("nd/@ref"))
+public:
+  explicit ResponseGeometryCache(pugi::xml_document const & osmResponse)
   {
-    string const nodeRef = xNodeRef.attribute().value();
-    auto const node = osmResponse.select_node(("osm/node[@id='" + nodeRef + "']").data()).node();
-    ASSERT(node, ("OSM response have ref", nodeRef, "but have no node with such id.", osmResponse));
-    XMLFeature xmlFt(node);
-    func(xmlFt);
+    for (auto const & node : osmResponse.child("osm").children("node"))
+    {
+      try
+      {
+        m_nodes.emplace(node.attribute("id").value(), XMLFeature(node).GetMercatorCenter());
+      }
+      catch (editor::NoLatLon const & ex)
+      {
+        LOG(LWARNING, ("No lat/lon attribute in osm response node.", ex.Msg()));
+      }
+    }
+
+    for (auto const & way : osmResponse.child("osm").children("way"))
+      m_ways.emplace(way.attribute("id").value(), way);
   }
-}
 
-template <typename TFunc>
-void ForEachRelationsNode(pugi::xml_document const & osmResponse, pugi::xml_node const & relation,
-                          TFunc && func)
-{
-  for (auto const xNodeRef : relation.select_nodes("member[@type='way']/@ref"))
+  // TODO(mgsergio): XMLFeature should have GetGeometry method.
+  vector<m2::PointD> GetGeometry(pugi::xml_node const & wayOrRelation)
   {
-    string const wayRef = xNodeRef.attribute().value();
-    auto const xpath = "osm/way[@id='" + wayRef + "']";
-    auto const way = osmResponse.select_node(xpath.data()).node();
-    // Some ways can be missed from relation.
-    if (!way)
-      continue;
-    ForEachWaysNode(osmResponse, way, forward<TFunc>(func));
+    if (strcmp(wayOrRelation.name(), "way") == 0)
+      return GetWayGeometry(wayOrRelation);
+
+    vector<m2::PointD> result;
+    for (auto const & member : wayOrRelation.children("member"))
+    {
+      if (strcmp(member.attribute("type").value(), "way") != 0)
+        continue;
+      auto const it = m_ways.find(member.attribute("ref").value());
+      // Some ways can be missed from relation.
+      if (it == m_ways.end())
+        continue;
+      auto const & wayGeometry = GetWayGeometry(it->second);
+      result.insert(result.end(), wayGeometry.begin(), wayGeometry.end());
+    }
+    return result;
   }
-}
 
-vector<m2::PointD> GetWaysGeometry(pugi::xml_document const & osmResponse,
-                                   pugi::xml_node const & way)
-{
-  vector<m2::PointD> result;
-  ForEachWaysNode(osmResponse, way, [&result](XMLFeature const & xmlFt)
-                  {
-                    result.push_back(xmlFt.GetMercatorCenter());
-                  });
-  return result;
-}
+private:
+  vector<m2::PointD> const & GetWayGeometry(pugi::xml_node const & way)
+  {
+    string const wayId = way.attribute("id").value();
+    auto it = m_wayGeometry.find(wayId);
+    if (it == m_wayGeometry.end())
+    {
+      vector<m2::PointD> geometry;
+      for (auto const & nd : way.children("nd"))
+      {
+        auto const nodeIt = m_nodes.find(nd.attribute("ref").value());
+        ASSERT(nodeIt != m_nodes.end(),
+               ("OSM response have ref", nd.attribute("ref").value(),
+                "but have no node with such id."));
+        if (nodeIt != m_nodes.end())
+          geometry.push_back(nodeIt->second);
+      }
+      it = m_wayGeometry.emplace(move(wayId), move(geometry)).first;
+    }
+    return it->second;
+  }
 
-vector<m2::PointD> GetRelationsGeometry(pugi::xml_document const & osmResponse,
-                                        pugi::xml_node const & relation)
-{
-  vector<m2::PointD> result;
-  ForEachRelationsNode(osmResponse, relation, [&result](XMLFeature const & xmlFt)
-                       {
-                         result.push_back(xmlFt.GetMercatorCenter());
-                       });
-  return result;
-}
+  map<string, m2::PointD> m_nodes;
+  map<string, pugi::xml_node> m_ways;
+  map<string, vector<m2::PointD>> m_wayGeometry;
+};
 
-// TODO(mgsergio): XMLFeature should have GetGeometry method.
-vector<m2::PointD> GetWaysOrRelationsGeometry(pugi::xml_document const & osmResponse,
-                                              pugi::xml_node const & wayOrRelation)
+m2::RectD GetBoundingRect(vector<m2::PointD> const & geometry)
 {
-  if (strcmp(wayOrRelation.name(), "way") == 0)
-    return GetWaysGeometry(osmResponse, wayOrRelation);
-  return GetRelationsGeometry(osmResponse, wayOrRelation);
+  m2::RectD rect;
+  for (auto const & p : geometry)
+    rect.Add(p);
+  return rect;
 }
 
 /// @returns value form [-0.5, 0.5]. Negative values are used as penalty,
 /// positive as score.
-/// @param osmResponse - nodes, ways and relations from osm
-/// @param wayOrRelation - either way or relation to be compared agains ourGeometry
-/// @param outGeometry - geometry of a FeatureType (ourGeometry must be sort-uniqued)
-double ScoreGeometry(pugi::xml_document const & osmResponse,
-                     pugi::xml_node const & wayOrRelation, vector<m2::PointD> ourGeometry)
+/// @param theirGeometry - geometry of an OSM way or relation (must be sort-uniqued)
+/// @param ourGeometry - geometry of a FeatureType (must be sort-uniqued)
+double ScoreGeometry(pugi::xml_node const & wayOrRelation,
+                     vector<m2::PointD> const & theirGeometry,
+                     vector<m2::PointD> const & ourGeometry)
 {
   ASSERT(!ourGeometry.empty(), ("Our geometry cannot be empty"));
   int matched = 0;
 
-  auto theirGeometry = GetWaysOrRelationsGeometry(osmResponse, wayOrRelation);
-
   if (theirGeometry.empty())
     return -1;
 
-  my::SortUnique(theirGeometry);
-
   auto ourIt = begin(ourGeometry);
   auto theirIt = begin(theirGeometry);
 
@@ -181,10 +199,30 @@ pugi::xml_node GetBestOsmWayOrRelation(pugi::xml_document const & osmResponse,
   double bestScore = -1;
   pugi::xml_node bestMatchWay;
 
+  ResponseGeometryCache geometryCache(osmResponse);
+  auto ourRect = GetBoundingRect(geometry);
+  ourRect.Inflate(kPointDiffEps, kPointDiffEps);
+
   auto const xpath = "osm/way|osm/relation[tag[@k='type' and @v='multipolygon']]";
   for (auto const & xWayOrRelation : osmResponse.select_nodes(xpath))
   {
-    double const nodeScore = ScoreGeometry(osmResponse, xWayOrRelation.node(), geometry);
+    auto theirGeometry = geometryCache.GetGeometry(xWayOrRelation.node());
+    my::SortUnique(theirGeometry);
+
+    // Cheap exact rejects before the pointwise scoring. A positive
+    // score needs more than half of the points of both geometries
+    // matched, which is impossible when one geometry has more than
+    // twice as many points as the other or when the bounding rects do
+    // not even touch.
+    if (theirGeometry.size() >= 2 * geometry.size() ||
+        geometry.size() >= 2 * theirGeometry.size())
+    {
+      continue;
+    }
+    if (!ourRect.IsIntersect(GetBoundingRect(theirGeometry)))
+      continue;
+
+    double const nodeScore = ScoreGeometry(xWayOrRelation.node(), theirGeometry, geometry);
     if (nodeScore < 0)
       continue;
 
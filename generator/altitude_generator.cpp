@@ -54,6 +54,12 @@ public:
     return m_srtmManager.GetHeight(MercatorBounds::ToLatLon(p));
   }
 
+  void Prefetch(m2::RectD const & rect) override
+  {
+    m_srtmManager.PrefetchTiles(MercatorBounds::ToLatLon(rect.LeftBottom()),
+                                MercatorBounds::ToLatLon(rect.RightTop()));
+  }
+
 private:
   generator::SrtmTileManager m_srtmManager;
 };
@@ -109,6 +115,8 @@ public:
     if (pointsCount == 0)
       return;
 
+    m_altitudeGetter.Prefetch(f.GetLimitRect(FeatureType::BEST_GEOMETRY));
+
     TAltitudes altitudes;
     TAltitude minFeatureAltitude = kInvalidAltitude;
     for (size_t i = 0; i < pointsCount; ++i)
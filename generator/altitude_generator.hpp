@@ -1,6 +1,7 @@
 #pragma once
 
 #include "geometry/point2d.hpp"
+#include "geometry/rect2d.hpp"
 
 #include "indexer/feature_altitude.hpp"
 
@@ -12,6 +13,8 @@ class AltitudeGetter
 {
 public:
   virtual feature::TAltitude GetAltitude(m2::PointD const & p) = 0;
+  // A hint that the following GetAltitude() calls stay within |rect|.
+  virtual void Prefetch(m2::RectD const & /* rect */) {}
 };
 
 /// \brief Adds altitude section to mwm. It has the following format:
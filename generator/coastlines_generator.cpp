@@ -11,6 +11,7 @@
 #include "std/bind.hpp"
 #include "std/condition_variable.hpp"
 #include "std/function.hpp"
+#include "std/shared_ptr.hpp"
 #include "std/thread.hpp"
 #include "std/utility.hpp"
 
@@ -191,6 +192,16 @@ public:
     return count;
   }
 
+  /// Moves out the cell regions (without the bounding rect) to clip child cells
+  /// against, instead of re-clipping the original full-size regions.
+  void TakeRegions(vector<RegionT> & rgns)
+  {
+    rgns.clear();
+    rgns.reserve(m_res.size() - 1);
+    for (size_t i = 1; i < m_res.size(); ++i)
+      rgns.push_back(move(m_res[i]));
+  }
+
   void AssignGeometry(FeatureBuilder1 & fb)
   {
     for (size_t i = 0; i < m_res.size(); ++i)
@@ -216,10 +227,15 @@ public:
   static int constexpr kMaxPoints = 20000;
 
 protected:
+  // Regions already clipped to the parent cell, shared between its children.
+  // Empty pointer means the cell is a root task and regions come from the index.
+  using TParentRegions = shared_ptr<vector<RegionT> const>;
+  using TTask = pair<TCell, TParentRegions>;
+
   struct Context
   {
     mutex mutexTasks;
-    list<TCell> listTasks;
+    list<TTask> listTasks;
     condition_variable listCondVar;
     size_t inWork = 0;
     TProcessResultFunc processResultFunc;
@@ -239,7 +255,10 @@ public:
     Context ctx;
 
     for (size_t i = 0; i < TCell::TotalCellsOnLevel(baseScale); ++i)
-      ctx.listTasks.push_back(TCell::FromBitsAndLevel(i, static_cast<int>(baseScale)));
+    {
+      ctx.listTasks.push_back(
+          make_pair(TCell::FromBitsAndLevel(i, static_cast<int>(baseScale)), TParentRegions()));
+    }
 
     ctx.processResultFunc = funcResult;
 
@@ -258,7 +277,8 @@ public:
     return ctx.listTasks.empty();
   }
 
-  bool ProcessCell(TCell const & cell)
+  bool ProcessCell(TCell const & cell, TParentRegions const & parentRegions,
+                   TParentRegions & childRegions)
   {
     // get rect cell
     double minX, minY, maxX, maxY;
@@ -272,11 +292,31 @@ public:
     // Do 'and' with all regions and accumulate the result, including bound region.
     // In 'odd' parts we will have an ocean.
     DoDifference doDiff(rectR);
-    m_index.ForEachInRect(GetLimitRect(rectR), bind<void>(ref(doDiff), _1));
+    if (parentRegions)
+    {
+      // Split cells clip against the regions already clipped to their parent:
+      // a piece inside the parent intersected with a child rect gives exactly the
+      // same geometry as the original full-size region would.
+      RectT const limitRect = rectR.GetRect();
+      for (RegionT const & rgn : *parentRegions)
+      {
+        if (limitRect.IsIntersect(rgn.GetRect()))
+          doDiff(rgn);
+      }
+    }
+    else
+    {
+      m_index.ForEachInRect(GetLimitRect(rectR), bind<void>(ref(doDiff), _1));
+    }
 
     // Check if too many points for feature.
     if (cell.Level() < kHighLevel && doDiff.GetPointsCount() >= kMaxPoints)
+    {
+      vector<RegionT> rgns;
+      doDiff.TakeRegions(rgns);
+      childRegions = make_shared<vector<RegionT> const>(move(rgns));
       return false;
+    }
 
     m_ctx.processResultFunc(cell, doDiff);
     return true;
@@ -292,19 +332,20 @@ public:
       if (m_ctx.listTasks.empty())
         break;
 
-      TCell currentCell = m_ctx.listTasks.front();
+      TTask task = move(m_ctx.listTasks.front());
       m_ctx.listTasks.pop_front();
       ++m_ctx.inWork;
       lock.unlock();
 
-      bool const done = ProcessCell(currentCell);
+      TParentRegions childRegions;
+      bool const done = ProcessCell(task.first, task.second, childRegions);
 
       lock.lock();
       // return to queue not ready cells
       if (!done)
       {
         for (int8_t i = 0; i < TCell::MAX_CHILDREN; ++i)
-          m_ctx.listTasks.push_back(currentCell.Child(i));
+          m_ctx.listTasks.push_back(make_pair(task.first.Child(i), childRegions));
       }
       --m_ctx.inWork;
       m_ctx.listCondVar.notify_all();
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "generator/osm_id.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/reader.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/map.hpp"
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+namespace gen
+{
+/// Persistent mapping from OSM elements to the countries their features were emitted to.
+/// It is rewritten during a full --generate_features planet run and allows the following
+/// runs to stream only the elements of the requested countries (--filter_countries).
+/// Stored as fixed 12-byte (osm::Id, country index) records; country names are kept as
+/// text lines in a sibling ".countries" file.
+class ElementCountryIndexWriter
+{
+public:
+  explicit ElementCountryIndexWriter(string const & basePath)
+    : m_basePath(basePath), m_writer(basePath)
+  {
+  }
+
+  ~ElementCountryIndexWriter()
+  {
+    try
+    {
+      FileWriter writer(m_basePath + ".countries");
+      for (string const & name : m_names)
+      {
+        writer.Write(name.data(), name.size());
+        writer.Write("\n", 1);
+      }
+    }
+    catch (RootException const & ex)
+    {
+      LOG(LERROR, ("Can't save countries list for the element index:", ex.Msg()));
+    }
+  }
+
+  void Write(vector<osm::Id> const & ids, string const & country)
+  {
+    uint32_t index;
+    auto const it = m_countryIndexes.find(country);
+    if (it != m_countryIndexes.end())
+    {
+      index = it->second;
+    }
+    else
+    {
+      index = static_cast<uint32_t>(m_names.size());
+      m_countryIndexes.emplace(country, index);
+      m_names.push_back(country);
+    }
+
+    for (osm::Id const & id : ids)
+    {
+      m_writer.Write(&id, sizeof(id));
+      WriteToSink(m_writer, index);
+    }
+  }
+
+private:
+  string const m_basePath;
+  FileWriter m_writer;
+  map<string, uint32_t> m_countryIndexes;
+  vector<string> m_names;
+};
+
+/// Loads a sorted list of element ids belonging to any of |countries|.
+/// @return false if the index was not built yet (no full planet run happened).
+inline bool LoadElementCountryFilter(string const & basePath, vector<string> const & countries,
+                                     vector<osm::Id> & ids)
+{
+  try
+  {
+    string names;
+    FileReader(basePath + ".countries").ReadAsString(names);
+
+    vector<bool> wanted;
+    strings::Tokenize(names, "\n", [&wanted, &countries](string const & name)
+    {
+      wanted.push_back(find(countries.begin(), countries.end(), name) != countries.end());
+    });
+
+    FileReader reader(basePath);
+    ReaderSource<FileReader> src(reader);
+    while (src.Size() > 0)
+    {
+      osm::Id id;
+      src.Read(&id, sizeof(id));
+      uint32_t const country = ReadPrimitiveFromSource<uint32_t>(src);
+      if (country < wanted.size() && wanted[country])
+        ids.push_back(id);
+    }
+
+    sort(ids.begin(), ids.end());
+    ids.erase(unique(ids.begin(), ids.end()), ids.end());
+    return true;
+  }
+  catch (RootException const &)
+  {
+    return false;
+  }
+}
+}  // namespace gen
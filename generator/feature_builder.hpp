@@ -5,6 +5,7 @@
 #include "indexer/feature.hpp"
 
 #include "coding/file_reader.hpp"
+#include "coding/read_ahead_reader.hpp"
 #include "coding/read_write_utils.hpp"
 
 #include "std/bind.hpp"
@@ -276,8 +277,10 @@ namespace feature
   template <class ToDo>
   void ForEachFromDatRawFormat(string const & fName, ToDo && toDo)
   {
-    FileReader reader(fName);
-    ReaderSource<FileReader> src(reader);
+    // The scan below is strictly forward, so prefetch the next chunk
+    // while the current one is being deserialized.
+    ModelReaderPtr reader(make_unique<ReadAheadReader>(make_unique<FileReader>(fName)));
+    ReaderSource<ModelReaderPtr> src(reader);
 
     uint64_t currPos = 0;
     uint64_t const fSize = reader.Size();
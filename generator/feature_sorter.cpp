@@ -27,6 +27,8 @@
 #include "base/scope_guard.hpp"
 #include "base/string_utils.hpp"
 
+#include "std/unordered_map.hpp"
+
 namespace
 {
   typedef pair<uint64_t, uint64_t> CellAndOffsetT;
@@ -111,6 +113,15 @@ namespace feature
     // Mapping from feature id to offset in file section with the correspondent metadata.
     vector<pair<uint32_t, uint32_t>> m_metadataIndex;
 
+    // Offsets of already written geometry blobs keyed by their content,
+    // one map per scale. Features reference geometry by offset, so
+    // identical serialized chunks (coincident lines, duplicated
+    // outlines) are stored once and no reader changes are needed.
+    using TDedupMap = unordered_map<string, uint32_t>;
+    vector<TDedupMap> m_geoDedup, m_trgDedup;
+    uint64_t m_dedupSavedBytes = 0;
+    uint32_t m_dedupSavedChunks = 0;
+
     DataHeader m_header;
     RegionData m_regionData;
     uint32_t m_versionDate;
@@ -129,6 +140,8 @@ namespace feature
         m_geoFile.push_back(make_unique<TmpFile>(fName + GEOMETRY_FILE_TAG + postfix));
         m_trgFile.push_back(make_unique<TmpFile>(fName + TRIANGLE_FILE_TAG + postfix));
       }
+      m_geoDedup.resize(m_header.GetScalesCount());
+      m_trgDedup.resize(m_header.GetScalesCount());
 
       m_helperFile.resize(FILES_COUNT);
       m_helperFile[METADATA] = make_unique<TmpFile>(fName + METADATA_FILE_TAG);
@@ -176,6 +189,12 @@ namespace feature
         finalizeFn(move(m_trgFile[i]), TRIANGLE_FILE_TAG, postfix);
       }
 
+      if (m_dedupSavedChunks > 0)
+      {
+        LOG(LINFO, ("Shared geometry chunks:", m_dedupSavedChunks,
+                    "bytes saved:", m_dedupSavedBytes));
+      }
+
       {
         /// @todo Replace this mapping vector with succint structure.
         FileWriter w = m_writer.GetWriter(METADATA_INDEX_FILE_TAG);
@@ -199,6 +218,28 @@ namespace feature
     }
 
   private:
+    /// Appends |blob| to the geometry or triangles file of scale |i|, or
+    /// reuses the offset of an identical blob written earlier.
+    uint32_t WriteGeometryBlob(vector<char> const & blob, int i, bool triangles)
+    {
+      TDedupMap & dedup = (triangles ? m_trgDedup : m_geoDedup)[i];
+      string key(blob.begin(), blob.end());
+
+      auto const it = dedup.find(key);
+      if (it != dedup.end())
+      {
+        ++m_dedupSavedChunks;
+        m_dedupSavedBytes += blob.size();
+        return it->second;
+      }
+
+      FileWriter & file = *(triangles ? m_trgFile : m_geoFile)[i];
+      uint32_t const offset = GetFileSize(file);
+      file.Write(blob.data(), blob.size());
+      dedup.emplace(move(key), offset);
+      return offset;
+    }
+
     typedef vector<m2::PointD> points_t;
     typedef list<points_t> polygons_t;
 
@@ -213,6 +254,10 @@ namespace feature
 
       points_t m_current;
 
+      // Last tessellated polygons and their triangulation, reused across scales.
+      polygons_t m_trgPolys;
+      tesselator::TrianglesInfo m_trgInfo;
+
       DataHeader const & m_header;
 
       void WriteOuterPoints(points_t const & points, int i)
@@ -228,19 +273,28 @@ namespace feature
         points_t toSave(points.begin() + 1, points.end());
 
         m_buffer.m_ptsMask |= (1 << i);
-        m_buffer.m_ptsOffset.push_back(m_rMain.GetFileSize(*m_rMain.m_geoFile[i]));
-        serial::SaveOuterPath(toSave, cp, *m_rMain.m_geoFile[i]);
+        vector<char> buffer;
+        MemWriter<vector<char>> writer(buffer);
+        serial::SaveOuterPath(toSave, cp, writer);
+        m_buffer.m_ptsOffset.push_back(m_rMain.WriteGeometryBlob(buffer, i, false /* triangles */));
       }
 
       void WriteOuterTriangles(polygons_t const & polys, int i)
       {
-        // tesselation
-        tesselator::TrianglesInfo info;
-        if (0 == tesselator::TesselateInterior(polys, info))
+        // Triangulation does not depend on the scale coding params, and simplification
+        // at neighbouring scales often leaves a polygon unchanged, so tessellate only
+        // when the input differs from the previously processed one.
+        if (m_trgInfo.IsEmpty() || polys != m_trgPolys)
         {
-          LOG(LINFO, ("NO TRIANGLES in", polys));
-          return;
+          m_trgPolys = polys;
+          m_trgInfo = tesselator::TrianglesInfo();
+          if (0 == tesselator::TesselateInterior(polys, m_trgInfo))
+          {
+            LOG(LINFO, ("NO TRIANGLES in", polys));
+            return;
+          }
         }
+        tesselator::TrianglesInfo const & info = m_trgInfo;
 
         serial::CodingParams const cp = m_header.GetCodingParams(i);
 
@@ -263,8 +317,10 @@ namespace feature
 
         // saving to file
         m_buffer.m_trgMask |= (1 << i);
-        m_buffer.m_trgOffset.push_back(m_rMain.GetFileSize(*m_rMain.m_trgFile[i]));
-        saver.Save(*m_rMain.m_trgFile[i]);
+        vector<char> buffer;
+        MemWriter<vector<char>> writer(buffer);
+        saver.Save(writer);
+        m_buffer.m_trgOffset.push_back(m_rMain.WriteGeometryBlob(buffer, i, true /* triangles */));
       }
 
       void FillInnerPointsMask(points_t const & points, uint32_t scaleIndex)
@@ -404,18 +460,18 @@ namespace feature
       }
     };
 
-    void SimplifyPoints(points_t const & in, points_t & out, int level,
-                        bool isCoast, m2::RectD const & rect)
+    static void CalcTolerances(points_t const & in, vector<double> & tolerances,
+                               bool isCoast, m2::RectD const & rect)
     {
       if (isCoast)
       {
         BoundsDistance dist(rect);
-        feature::SimplifyPoints(dist, in, out, level);
+        CalcSimplificationTolerances(in, dist, tolerances);
       }
       else
       {
         m2::DistanceToLineSquare<m2::PointD> dist;
-        feature::SimplifyPoints(dist, in, out, level);
+        CalcSimplificationTolerances(in, dist, tolerances);
       }
     }
 
@@ -453,6 +509,12 @@ namespace feature
       bool const isLine = fb.IsLine();
       bool const isArea = fb.IsArea();
 
+      // Elimination tolerances do not depend on the scale, so they are computed
+      // once per geometry (lazily, at the first drawable scale) and every scale
+      // is emitted by thresholding them.
+      vector<double> srcTolerances;
+      vector<vector<double>> polyTolerances;
+
       int const scalesStart = static_cast<int>(m_header.GetScalesCount()) - 1;
       for (int i = scalesStart; i >= 0; --i)
       {
@@ -467,9 +529,15 @@ namespace feature
 
           // Do not change linear geometry for the upper scale.
           if (isLine && i == scalesStart && IsCountry() && fb.IsRoad())
+          {
             points = holder.GetSourcePoints();
+          }
           else
-            SimplifyPoints(holder.GetSourcePoints(), points, level, isCoast, rect);
+          {
+            if (srcTolerances.size() != holder.GetSourcePoints().size())
+              CalcTolerances(holder.GetSourcePoints(), srcTolerances, isCoast, rect);
+            feature::SimplifyByTolerances(holder.GetSourcePoints(), srcTolerances, points, level);
+          }
 
           if (isLine)
             holder.AddPoints(points, i);
@@ -493,12 +561,22 @@ namespace feature
               simplified.back().swap(points);
             }
 
+            if (polyTolerances.size() != polys.size() - 1)
+            {
+              polyTolerances.resize(polys.size() - 1);
+              size_t k = 0;
+              auto iT = polys.begin();
+              for (++iT; iT != polys.end(); ++iT, ++k)
+                CalcTolerances(*iT, polyTolerances[k], isCoast, rect);
+            }
+
+            size_t k = 0;
             auto iH = polys.begin();
-            for (++iH; iH != polys.end(); ++iH)
+            for (++iH; iH != polys.end(); ++iH, ++k)
             {
               simplified.push_back(points_t());
 
-              SimplifyPoints(*iH, simplified.back(), level, isCoast, rect);
+              feature::SimplifyByTolerances(*iH, polyTolerances[k], simplified.back(), level);
 
               // Increment level check for coastline polygons for the first scale level.
               // This is used for better coastlines quality.
@@ -72,4 +72,28 @@ namespace feature
       CHECK ( are_points_equal(in.back(), out.back()), () );
     }
   }
+
+  /// Emits one scale level from tolerances precalculated with
+  /// CalcSimplificationTolerances: a point survives the level if eliminating it
+  /// would move the line farther than the level's epsilon.
+  template <class PointsContainerT>
+  void SimplifyByTolerances(PointsContainerT const & in, vector<double> const & tolerances,
+                            PointsContainerT & out, int level)
+  {
+    if (in.size() < 2)
+      return;
+
+    ASSERT_EQUAL ( in.size(), tolerances.size(), () );
+
+    double const eps = my::sq(scales::GetEpsilonForSimplify(level));
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+      if (tolerances[i] > eps)
+        out.push_back(in[i]);
+    }
+
+    CHECK_GREATER ( out.size(), 1, () );
+    CHECK ( are_points_equal(in.front(), out.front()), () );
+    CHECK ( are_points_equal(in.back(), out.back()), () );
+  }
 }
@@ -6,9 +6,15 @@
 
 #include "coding/file_name_utils.hpp"
 
+#include "std/shared_ptr.hpp"
 #include "std/string.hpp"
 #include "std/vector.hpp"
 
+namespace generator
+{
+class StageProfiler;
+}
+
 namespace feature
 {
 struct GenerateInfo
@@ -17,7 +23,8 @@ struct GenerateInfo
   {
     Memory,
     Index,
-    File
+    File,
+    MmapSharded
   };
 
   enum class OsmSourceType
@@ -40,6 +47,10 @@ struct GenerateInfo
   OsmSourceType m_osmFileType;
   string m_osmFileName;
 
+  // If not empty, --generate_features streams only the elements recorded for these
+  // countries in the element index of a previous full planet run.
+  vector<string> m_filterCountries;
+
   string m_bookingDatafileName;
   string m_bookingReferenceDir;
   string m_opentableDatafileName;
@@ -57,6 +68,8 @@ struct GenerateInfo
   bool m_failOnCoasts = false;
   bool m_preloadCache = false;
 
+  // Optional per-stage performance accounting (see --stage_profile).
+  shared_ptr<generator::StageProfiler> m_stageProfiler;
 
   GenerateInfo() = default;
 
@@ -78,6 +91,8 @@ struct GenerateInfo
       m_nodeStorageType = NodeStorageType::Index;
     else if (type == "mem")
       m_nodeStorageType = NodeStorageType::Memory;
+    else if (type == "mmap")
+      m_nodeStorageType = NodeStorageType::MmapSharded;
     else
       LOG(LCRITICAL, ("Incorrect node_storage type:", type));
   }
@@ -46,6 +46,7 @@ SOURCES += \
     search_index_builder.cpp \
     sponsored_scoring.cpp \
     srtm_parser.cpp \
+    stage_profiler.cpp \
     statistics.cpp \
     tesselator.cpp \
     towns_dumper.cpp \
@@ -61,6 +62,7 @@ HEADERS += \
     check_model.hpp \
     coastlines_generator.hpp \
     dumper.hpp \
+    element_country_index.hpp \
     feature_builder.hpp \
     feature_emitter_iface.hpp \
     feature_generator.hpp \
@@ -92,6 +94,7 @@ HEADERS += \
     sponsored_dataset_inl.hpp \
     sponsored_scoring.hpp \
     srtm_parser.hpp \
+    stage_profiler.hpp \
     statistics.hpp \
     tag_admixer.hpp \
     tesselator.hpp \
@@ -8,8 +8,15 @@
 
 #include "testing/testing.hpp"
 
+#include "generator/intermediate_data.hpp"
 #include "generator/intermediate_elements.hpp"
 
+#include "platform/platform.hpp"
+
+#include "coding/internal/file_data.hpp"
+
+#include "base/math.hpp"
+
 
 UNIT_TEST(Intermediate_Data_empty_way_element_save_load_test)
 {
@@ -99,3 +106,36 @@ UNIT_TEST(Intermediate_Data_relation_element_save_load_test)
   TEST_NOT_EQUAL(e2.tags["key1old"], "value1old", ());
   TEST_NOT_EQUAL(e2.tags["key2old"], "value2old", ());
 }
+
+UNIT_TEST(Intermediate_Data_sharded_point_storage_test)
+{
+  string const basePath = GetPlatform().TmpPathForFile("sharded_points_test");
+  // Belongs to the second shard.
+  uint64_t const shardedId = (uint64_t(1) << 27) + 5;
+
+  {
+    cache::ShardedMmapPointStorage<cache::EMode::Write> storage(basePath);
+    storage.AddPoint(1, 53.9, 27.56);
+    storage.AddPoint(2, 53.91, 27.57);
+    storage.AddPoint(100, -34.6, -58.38);
+    storage.AddPoint(shardedId, 35.68, 139.69);
+  }
+
+  {
+    cache::ShardedMmapPointStorage<cache::EMode::Read> storage(basePath);
+    double lat = 0.0;
+    double lng = 0.0;
+    TEST(storage.GetPoint(2, lat, lng), ());
+    TEST(my::AlmostEqualAbs(lat, 53.91, 1e-6), (lat));
+    TEST(my::AlmostEqualAbs(lng, 27.57, 1e-6), (lng));
+    TEST(storage.GetPoint(shardedId, lat, lng), ());
+    TEST(my::AlmostEqualAbs(lat, 35.68, 1e-6), (lat));
+    TEST(my::AlmostEqualAbs(lng, 139.69, 1e-6), (lng));
+    TEST(!storage.GetPoint(50, lat, lng), ("Never written id should be reported as absent."));
+    TEST(!storage.GetPoint(3 * (uint64_t(1) << 27), lat, lng),
+         ("An id from an absent shard should be reported as absent."));
+  }
+
+  my::DeleteFileX(basePath + ".shard0");
+  my::DeleteFileX(basePath + ".shard1");
+}
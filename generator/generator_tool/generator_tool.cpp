@@ -13,6 +13,7 @@
 #include "generator/routing_generator.hpp"
 #include "generator/routing_index_generator.hpp"
 #include "generator/search_index_builder.hpp"
+#include "generator/stage_profiler.hpp"
 #include "generator/statistics.hpp"
 #include "generator/traffic_generator.hpp"
 #include "generator/unpack_mwm.hpp"
@@ -31,8 +32,15 @@
 
 #include "coding/file_name_utils.hpp"
 
+#include "base/string_utils.hpp"
 #include "base/timer.hpp"
 
+#include "std/algorithm.hpp"
+#include "std/mutex.hpp"
+#include "std/numeric.hpp"
+#include "std/thread.hpp"
+#include "std/vector.hpp"
+
 #include "defines.hpp"
 
 #include "3party/gflags/src/gflags/gflags.h"
@@ -51,8 +59,12 @@ DEFINE_string(user_resource_path, "", "User defined resource path for classifica
 DEFINE_string(intermediate_data_path, "", "Path to stored nodes, ways, relations.");
 DEFINE_string(output, "", "File name for process (without 'mwm' ext).");
 DEFINE_bool(preload_cache, false, "Preload all ways and relations cache.");
+DEFINE_string(stage_profile, "",
+              "If defined, path of a JSON report with per-stage wall/CPU time, peak RSS "
+              "and IO byte counters.");
 DEFINE_string(node_storage, "map",
-              "Type of storage for intermediate points representation. Available: raw, map, mem.");
+              "Type of storage for intermediate points representation. Available: raw, map, mem, "
+              "mmap.");
 DEFINE_uint64(planet_version, my::SecondsSinceEpoch(),
               "Version as seconds since epoch, by default - now.");
 
@@ -61,11 +73,17 @@ DEFINE_bool(preprocess, false, "1st pass - create nodes/ways/relations data.");
 DEFINE_bool(generate_features, false, "2nd pass - generate intermediate features.");
 DEFINE_bool(generate_geometry, false,
             "3rd pass - split and simplify geometry and triangles for features.");
+DEFINE_uint64(generate_geometry_threads, 0,
+              "Number of countries processed in parallel on the 3rd pass. Each worker keeps one "
+              "country's features in memory, so this also bounds peak RAM. 0 - use all cores.");
 DEFINE_bool(generate_index, false, "4rd pass - generate index.");
 DEFINE_bool(generate_search_index, false, "5th pass - generate search index.");
 DEFINE_bool(generate_world, false, "Generate separate world file.");
 DEFINE_bool(split_by_polygons, false,
             "Use countries borders to split planet by regions and countries.");
+DEFINE_string(filter_countries, "",
+              "Comma separated country names. If set, the 2nd pass streams only the OSM elements "
+              "recorded for these countries by a previous full --generate_features run.");
 
 // Routing.
 DEFINE_string(osrm_file_name, "", "Input osrm file to generate routing info.");
@@ -73,6 +91,10 @@ DEFINE_bool(make_routing, false, "Make routing info based on osrm file.");
 DEFINE_bool(make_cross_section, false, "Make cross section in routing file for cross mwm routing (for OSRM routing).");
 DEFINE_bool(make_routing_index, false, "Make sections with the routing information.");
 DEFINE_bool(make_cross_mwm, false, "Make section for cross mwm routing (for dynamic indexed routing).");
+DEFINE_bool(make_joint_hierarchy, false,
+            "Make contraction hierarchy section for fast in-mwm routing.");
+DEFINE_bool(make_segment_weights, false,
+            "Make section with baked per-segment traversal times.");
 DEFINE_string(srtm_path, "",
               "Path to srtm directory. If set, generates a section with altitude information "
               "about roads.");
@@ -145,9 +167,15 @@ int main(int argc, char ** argv)
   if (!FLAGS_osm_file_type.empty())
     genInfo.SetOsmFileType(FLAGS_osm_file_type);
 
+  if (!FLAGS_stage_profile.empty())
+    genInfo.m_stageProfiler = make_shared<generator::StageProfiler>(FLAGS_stage_profile);
+  generator::StageProfiler * const profiler = genInfo.m_stageProfiler.get();
+
   // Generate intermediate files.
   if (FLAGS_preprocess)
   {
+    generator::StageProfiler::Guard const stage(profiler, "preprocess");
+
     LOG(LINFO, ("Generating intermediate data ...."));
     if (!GenerateIntermediateData(genInfo))
     {
@@ -172,6 +200,8 @@ int main(int argc, char ** argv)
   // Generate dat file.
   if (FLAGS_generate_features || FLAGS_make_coasts)
   {
+    generator::StageProfiler::Guard const stage(profiler, "generate_features");
+
     LOG(LINFO, ("Generating final data ..."));
 
     genInfo.m_splitByPolygons = FLAGS_split_by_polygons;
@@ -180,6 +210,10 @@ int main(int argc, char ** argv)
     genInfo.m_emitCoasts = FLAGS_emit_coasts;
     genInfo.m_fileName = FLAGS_output;
     genInfo.m_genAddresses = FLAGS_generate_addresses_file;
+    strings::Tokenize(FLAGS_filter_countries, ",", [&genInfo](string const & name)
+    {
+      genInfo.m_filterCountries.push_back(name);
+    });
 
     if (!GenerateFeatures(genInfo))
       return -1;
@@ -196,8 +230,64 @@ int main(int argc, char ** argv)
       genInfo.m_bucketNames.push_back(FLAGS_output);
   }
 
-  // Enumerate over all dat files that were created.
   size_t const count = genInfo.m_bucketNames.size();
+
+  // Generate final geometry for all countries up front. Countries are independent, so they are
+  // processed by a worker pool, the biggest ones first: otherwise a huge country picked up last
+  // leaves the rest of the pool idle for its whole duration.
+  vector<uint8_t> geometryGenerated(count, 0);
+  if (FLAGS_generate_geometry && count != 0)
+  {
+    generator::StageProfiler::Guard const stage(profiler, "generate_geometry");
+
+    size_t numThreads = FLAGS_generate_geometry_threads != 0
+                            ? static_cast<size_t>(FLAGS_generate_geometry_threads)
+                            : thread::hardware_concurrency();
+    numThreads = min(max(numThreads, size_t(1)), count);
+
+    vector<size_t> order(count);
+    iota(order.begin(), order.end(), 0);
+    vector<uint64_t> sizes(count, 0);
+    for (size_t i = 0; i < count; ++i)
+      Platform::GetFileSizeByFullPath(genInfo.GetTmpFileName(genInfo.m_bucketNames[i]), sizes[i]);
+    stable_sort(order.begin(), order.end(),
+                [&sizes](size_t lhs, size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+
+    mutex tasksMutex;
+    size_t nextTask = 0;
+    auto const worker = [&]()
+    {
+      while (true)
+      {
+        size_t i;
+        {
+          lock_guard<mutex> lock(tasksMutex);
+          if (nextTask == count)
+            return;
+          i = order[nextTask++];
+        }
+
+        string const & country = genInfo.m_bucketNames[i];
+        int mapType = feature::DataHeader::country;
+        if (country == WORLD_FILE_NAME)
+          mapType = feature::DataHeader::world;
+        if (country == WORLD_COASTS_FILE_NAME)
+          mapType = feature::DataHeader::worldcoasts;
+
+        LOG(LINFO, ("Generating result features for", country));
+        if (feature::GenerateFinalFeatures(genInfo, country, mapType))
+          geometryGenerated[i] = 1;
+      }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < numThreads; ++i)
+      threads.emplace_back(worker);
+    for (auto & t : threads)
+      t.join();
+  }
+
+  // Enumerate over all dat files that were created.
   for (size_t i = 0; i < count; ++i)
   {
     string const & country = genInfo.m_bucketNames[i];
@@ -205,16 +295,8 @@ int main(int argc, char ** argv)
 
     if (FLAGS_generate_geometry)
     {
-      int mapType = feature::DataHeader::country;
-      if (country == WORLD_FILE_NAME)
-        mapType = feature::DataHeader::world;
-      if (country == WORLD_COASTS_FILE_NAME)
-        mapType = feature::DataHeader::worldcoasts;
-
       // On error move to the next bucket without index generation.
-
-      LOG(LINFO, ("Generating result features for", country));
-      if (!feature::GenerateFinalFeatures(genInfo, country, mapType))
+      if (!geometryGenerated[i])
         continue;
 
       LOG(LINFO, ("Generating offsets table for", datFile));
@@ -224,6 +306,8 @@ int main(int argc, char ** argv)
 
     if (FLAGS_generate_index)
     {
+      generator::StageProfiler::Guard const stage(profiler, "generate_index");
+
       LOG(LINFO, ("Generating index for", datFile));
 
       if (!indexer::BuildIndexFromDataFile(datFile, FLAGS_intermediate_data_path + country))
@@ -232,6 +316,8 @@ int main(int argc, char ** argv)
 
     if (FLAGS_generate_search_index)
     {
+      generator::StageProfiler::Guard const stage(profiler, "generate_search_index");
+
       LOG(LINFO, ("Generating search index for", datFile));
 
       if (!indexer::BuildSearchIndexFromDataFile(datFile, true))
@@ -247,10 +333,15 @@ int main(int argc, char ** argv)
     }
 
     if (!FLAGS_srtm_path.empty())
+    {
+      generator::StageProfiler::Guard const stage(profiler, "altitudes");
       routing::BuildRoadAltitudes(datFile, FLAGS_srtm_path);
+    }
 
     if (FLAGS_make_routing_index)
     {
+      generator::StageProfiler::Guard const stage(profiler, "routing_index");
+
       string const osmToFeatureFilename = genInfo.GetTargetFileName(country) + OSM2FEATURE_FILE_EXTENSION;
       string const restrictionsFilename =
           genInfo.GetIntermediateFileName(RESTRICTIONS_FILENAME, "" /* extension */);
@@ -263,7 +354,16 @@ int main(int argc, char ** argv)
     }
 
     if (FLAGS_make_cross_mwm)
+    {
+      generator::StageProfiler::Guard const stage(profiler, "cross_mwm");
       routing::BuildCrossMwmSection(path, datFile, country);
+    }
+
+    if (FLAGS_make_joint_hierarchy)
+      routing::BuildJointHierarchySection(path, datFile, country);
+
+    if (FLAGS_make_segment_weights)
+      routing::BuildSegmentWeightsSection(path, datFile, country);
 
     if (FLAGS_generate_traffic_keys)
     {
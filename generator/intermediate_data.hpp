@@ -8,11 +8,14 @@
 #include "coding/mmap_reader.hpp"
 
 #include "base/logging.hpp"
+#include "base/string_utils.hpp"
 
 #include "std/algorithm.hpp"
 #include "std/deque.hpp"
 #include "std/exception.hpp"
 #include "std/limits.hpp"
+#include "std/mutex.hpp"
+#include "std/unique_ptr.hpp"
 #include "std/unordered_map.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
@@ -365,6 +368,134 @@ public:
   }
 };
 
+/// Stores nodes as dense fixed LatLon records (offset = id * sizeof(LatLon)
+/// inside a shard) split into shards of kShardRecords ids each. Shard files
+/// are created only for populated id ranges and are mmapped independently on
+/// reading, so the working set is managed by the OS page cache and a planet
+/// build does not need the whole node table in RAM. GetPoint() is const and
+/// safe to call from several threads at once.
+template <EMode TMode>
+class ShardedMmapPointStorage : public PointStorage
+{
+#ifdef OMIM_OS_WINDOWS
+  using TFileReader = FileReader;
+#else
+  using TFileReader = MmapReader;
+#endif
+
+  /// 2^27 records, 1 GB per shard file.
+  static uint64_t constexpr kShardRecords = uint64_t(1) << 27;
+
+  constexpr static double const kValueOrder = 1E+7;
+
+  string const m_name;
+
+  // Write mode members.
+  vector<unique_ptr<FileWriter>> m_writers;
+  /// Next dense record index per shard: osm node ids mostly increase,
+  /// so consecutive records are appended without Seek.
+  vector<uint64_t> m_nextRecords;
+
+  // Read mode members.
+  enum class ShardState : uint8_t { Unknown, Opened, Absent };
+  mutable vector<unique_ptr<TFileReader>> m_readers;
+  mutable vector<ShardState> m_states;
+  /// Guards lazy shard opening only; reading an opened shard is lock-free.
+  mutable mutex m_mutex;
+
+  string GetShardPath(size_t shard) const
+  {
+    return m_name + ".shard" + strings::to_string(shard);
+  }
+
+  template <EMode T = TMode>
+  typename enable_if<T == EMode::Read, TFileReader const *>::type GetReader(size_t shard) const
+  {
+    lock_guard<mutex> lock(m_mutex);
+    if (shard >= m_states.size())
+    {
+      m_readers.resize(shard + 1);
+      m_states.resize(shard + 1, ShardState::Unknown);
+    }
+    if (m_states[shard] == ShardState::Unknown)
+    {
+      try
+      {
+        m_readers[shard].reset(new TFileReader(GetShardPath(shard)));
+        m_states[shard] = ShardState::Opened;
+      }
+      catch (RootException const &)
+      {
+        // No nodes were written to this id range.
+        m_states[shard] = ShardState::Absent;
+      }
+    }
+    return m_readers[shard].get();
+  }
+
+public:
+  explicit ShardedMmapPointStorage(string const & name) : m_name(name) {}
+
+  template <EMode T = TMode>
+  typename enable_if<T == EMode::Write, void>::type AddPoint(uint64_t id, double lat, double lng)
+  {
+    int64_t const lat64 = lat * kValueOrder;
+    int64_t const lng64 = lng * kValueOrder;
+
+    LatLon ll;
+    ll.lat = static_cast<int32_t>(lat64);
+    ll.lon = static_cast<int32_t>(lng64);
+    CHECK_EQUAL(static_cast<int64_t>(ll.lat), lat64, ("Latitude is out of 32bit boundary!"));
+    CHECK_EQUAL(static_cast<int64_t>(ll.lon), lng64, ("Longtitude is out of 32bit boundary!"));
+
+    size_t const shard = static_cast<size_t>(id / kShardRecords);
+    uint64_t const record = id % kShardRecords;
+
+    if (shard >= m_writers.size())
+    {
+      m_writers.resize(shard + 1);
+      m_nextRecords.resize(shard + 1, 0);
+    }
+    if (!m_writers[shard])
+      m_writers[shard].reset(new FileWriter(GetShardPath(shard)));
+
+    if (m_nextRecords[shard] != record)
+      m_writers[shard]->Seek(record * sizeof(ll));
+    m_writers[shard]->Write(&ll, sizeof(ll));
+    m_nextRecords[shard] = record + 1;
+
+    IncProcessedPoint();
+  }
+
+  template <EMode T = TMode>
+  typename enable_if<T == EMode::Read, bool>::type GetPoint(uint64_t id, double & lat,
+                                                            double & lng) const
+  {
+    size_t const shard = static_cast<size_t>(id / kShardRecords);
+    uint64_t const record = id % kShardRecords;
+
+    LatLon ll;
+    TFileReader const * reader = GetReader(shard);
+    if (reader == nullptr || (record + 1) * sizeof(ll) > reader->Size())
+    {
+      LOG(LERROR, ("Node with id = ", id, " not found!"));
+      return false;
+    }
+
+    reader->Read(record * sizeof(ll), &ll, sizeof(ll));
+
+    // assume that valid coordinate is not (0, 0)
+    if (ll.lat != 0.0 || ll.lon != 0.0)
+    {
+      lat = static_cast<double>(ll.lat) / kValueOrder;
+      lng = static_cast<double>(ll.lon) / kValueOrder;
+      return true;
+    }
+    LOG(LERROR, ("Node with id = ", id, " not found!"));
+    return false;
+  }
+};
+
 template <EMode TMode>
 class MapFilePointStorage : public PointStorage
 {
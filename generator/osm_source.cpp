@@ -1,4 +1,5 @@
 #include "generator/coastlines_generator.hpp"
+#include "generator/element_country_index.hpp"
 #include "generator/feature_generator.hpp"
 #include "generator/intermediate_data.hpp"
 #include "generator/intermediate_elements.hpp"
@@ -27,6 +28,13 @@
 #include "coding/file_name_utils.hpp"
 #include "coding/parse_xml.hpp"
 
+#include "std/algorithm.hpp"
+#include "std/condition_variable.hpp"
+#include "std/deque.hpp"
+#include "std/mutex.hpp"
+#include "std/thread.hpp"
+#include "std/utility.hpp"
+
 #include "defines.hpp"
 
 SourceReader::SourceReader()
@@ -610,62 +618,147 @@ void BuildIntermediateDataFromO5M(SourceReader & stream, TCache & cache, TownsDu
   }
 }
 
-void ProcessOsmElementsFromO5M(SourceReader & stream, function<void(OsmElement *)> processor)
+namespace
 {
-  using TType = osm::O5MSource::EntityType;
+/// A bounded queue of OsmElement batches handing decoded elements from
+/// the o5m reader thread to the translating one in file order.
+class OsmElementBatchQueue
+{
+public:
+  using TBatch = vector<OsmElement>;
 
-  osm::O5MSource dataset([&stream](uint8_t * buffer, size_t size)
+  explicit OsmElementBatchQueue(size_t maxBatches) : m_maxBatches(maxBatches) {}
+
+  void Push(TBatch && batch)
   {
-    return stream.Read(reinterpret_cast<char *>(buffer), size);
-  });
+    unique_lock<mutex> lock(m_mutex);
+    m_canPush.wait(lock, [this]() { return m_batches.size() < m_maxBatches; });
+    m_batches.push_back(move(batch));
+    m_canPop.notify_one();
+  }
 
-  auto translate = [](TType t) -> OsmElement::EntityType
+  void Finish()
   {
-    switch (t)
-    {
-      case TType::Node: return OsmElement::EntityType::Node;
-      case TType::Way: return OsmElement::EntityType::Way;
-      case TType::Relation: return OsmElement::EntityType::Relation;
-      default: return OsmElement::EntityType::Unknown;
-    }
-  };
+    unique_lock<mutex> lock(m_mutex);
+    m_finished = true;
+    m_canPop.notify_one();
+  }
 
-  for (auto const & em : dataset)
+  /// @return false when the queue is drained and Finish() was called.
+  bool Pop(TBatch & batch)
   {
-    OsmElement p;
-    p.id = em.id;
+    unique_lock<mutex> lock(m_mutex);
+    m_canPop.wait(lock, [this]() { return !m_batches.empty() || m_finished; });
+    if (m_batches.empty())
+      return false;
+    batch = move(m_batches.front());
+    m_batches.pop_front();
+    m_canPush.notify_one();
+    return true;
+  }
+
+private:
+  size_t const m_maxBatches;
+  deque<TBatch> m_batches;
+  bool m_finished = false;
+  mutex m_mutex;
+  condition_variable m_canPush;
+  condition_variable m_canPop;
+};
+}  // namespace
+
+void ProcessOsmElementsFromO5M(SourceReader & stream, function<void(OsmElement *)> processor)
+{
+  using TType = osm::O5MSource::EntityType;
+
+  // Decoding the o5m stream and building OsmElements is pipelined with
+  // their translation: the reader thread parses the next batches while
+  // this thread processes the current one. Batches are handed over in
+  // file order, so the output is the same as with the sequential
+  // version. Translation itself is stateful (intermediate data cache,
+  // emitters) and stays on one thread.
+  size_t const kBatchSize = 1024;
+  size_t const kMaxQueuedBatches = 8;
+
+  OsmElementBatchQueue queue(kMaxQueuedBatches);
+
+  thread reader([&stream, &queue]()
+  {
+    osm::O5MSource dataset([&stream](uint8_t * buffer, size_t size)
+    {
+      return stream.Read(reinterpret_cast<char *>(buffer), size);
+    });
 
-    switch (em.type)
+    auto translate = [](TType t) -> OsmElement::EntityType
     {
-      case TType::Node:
+      switch (t)
       {
-        p.type = OsmElement::EntityType::Node;
-        p.lat = em.lat;
-        p.lon = em.lon;
-        break;
+        case TType::Node: return OsmElement::EntityType::Node;
+        case TType::Way: return OsmElement::EntityType::Way;
+        case TType::Relation: return OsmElement::EntityType::Relation;
+        default: return OsmElement::EntityType::Unknown;
       }
-      case TType::Way:
+    };
+
+    OsmElementBatchQueue::TBatch batch;
+    batch.reserve(kBatchSize);
+
+    for (auto const & em : dataset)
+    {
+      OsmElement p;
+      p.id = em.id;
+
+      switch (em.type)
       {
-        p.type = OsmElement::EntityType::Way;
-        for (uint64_t nd : em.Nodes())
-          p.AddNd(nd);
-        break;
+        case TType::Node:
+        {
+          p.type = OsmElement::EntityType::Node;
+          p.lat = em.lat;
+          p.lon = em.lon;
+          break;
+        }
+        case TType::Way:
+        {
+          p.type = OsmElement::EntityType::Way;
+          for (uint64_t nd : em.Nodes())
+            p.AddNd(nd);
+          break;
+        }
+        case TType::Relation:
+        {
+          p.type = OsmElement::EntityType::Relation;
+          for (auto const & member : em.Members())
+            p.AddMember(member.ref, translate(member.type), member.role);
+          break;
+        }
+        default: break;
       }
-      case TType::Relation:
+
+      for (auto const & tag : em.Tags())
+        p.AddTag(tag.key, tag.value);
+
+      batch.push_back(move(p));
+      if (batch.size() >= kBatchSize)
       {
-        p.type = OsmElement::EntityType::Relation;
-        for (auto const & member : em.Members())
-          p.AddMember(member.ref, translate(member.type), member.role);
-        break;
+        queue.Push(move(batch));
+        batch = OsmElementBatchQueue::TBatch();
+        batch.reserve(kBatchSize);
       }
-      default: break;
     }
 
-    for (auto const & tag : em.Tags())
-      p.AddTag(tag.key, tag.value);
+    if (!batch.empty())
+      queue.Push(move(batch));
+    queue.Finish();
+  });
 
-    processor(&p);
+  OsmElementBatchQueue::TBatch batch;
+  while (queue.Pop(batch))
+  {
+    for (OsmElement & e : batch)
+      processor(&e);
   }
+
+  reader.join();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,9 +788,39 @@ bool GenerateFeaturesImpl(feature::GenerateInfo & info, EmitterBase & emitter)
     TagReplacer tagReplacer(GetPlatform().ResourcesDir() + REPLACED_TAGS_FILE);
     OsmTagMixer osmTagMixer(GetPlatform().ResourcesDir() + MIXED_TAGS_FILE);
 
+    // Incremental mode: process only the elements recorded for the requested countries
+    // by a previous full planet run.
+    vector<osm::Id> allowedIds;
+    bool const filtered = !info.m_filterCountries.empty();
+    if (filtered)
+    {
+      if (!gen::LoadElementCountryFilter(info.GetIntermediateFileName(ELEMENT2COUNTRY_FILE, ""),
+                                         info.m_filterCountries, allowedIds))
+      {
+        LOG(LCRITICAL, ("Can't load the element index. A full --generate_features planet run "
+                        "is needed before using --filter_countries."));
+      }
+      LOG(LINFO, ("Filtering the planet stream to", allowedIds.size(), "elements of",
+                  info.m_filterCountries));
+    }
+
+    auto const elementId = [](OsmElement const & e)
+    {
+      switch (e.type)
+      {
+        case OsmElement::EntityType::Node: return osm::Id::Node(e.id);
+        case OsmElement::EntityType::Way: return osm::Id::Way(e.id);
+        case OsmElement::EntityType::Relation: return osm::Id::Relation(e.id);
+        default: return osm::Id();
+      }
+    };
+
     // Here we can add new tags to the elements!
     auto const fn = [&](OsmElement * e)
     {
+      if (filtered && !binary_search(allowedIds.begin(), allowedIds.end(), elementId(*e)))
+        return;
+
       tagReplacer(e);
       tagAdmixer(e);
       osmTagMixer(e);
@@ -778,6 +901,9 @@ bool GenerateFeatures(feature::GenerateInfo & info, EmitterFactory factory)
       return GenerateFeaturesImpl<cache::MapFilePointStorage<cache::EMode::Read>>(info, *emitter);
     case feature::GenerateInfo::NodeStorageType::Memory:
       return GenerateFeaturesImpl<cache::RawMemPointStorage<cache::EMode::Read>>(info, *emitter);
+    case feature::GenerateInfo::NodeStorageType::MmapSharded:
+      return GenerateFeaturesImpl<cache::ShardedMmapPointStorage<cache::EMode::Read>>(info,
+                                                                                     *emitter);
   }
   return false;
 }
@@ -792,6 +918,9 @@ bool GenerateIntermediateData(feature::GenerateInfo & info)
       return GenerateIntermediateDataImpl<cache::MapFilePointStorage<cache::EMode::Write>>(info);
     case feature::GenerateInfo::NodeStorageType::Memory:
       return GenerateIntermediateDataImpl<cache::RawMemPointStorage<cache::EMode::Write>>(info);
+    case feature::GenerateInfo::NodeStorageType::MmapSharded:
+      return GenerateIntermediateDataImpl<cache::ShardedMmapPointStorage<cache::EMode::Write>>(
+          info);
   }
   return false;
 }
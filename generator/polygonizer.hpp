@@ -1,6 +1,7 @@
 #pragma once
 
 #include "generator/borders_loader.hpp"
+#include "generator/element_country_index.hpp"
 #include "generator/feature_builder.hpp"
 #include "generator/generate_info.hpp"
 #include "generator/osm_source.hpp"
@@ -17,6 +18,7 @@
 #include "base/macros.hpp"
 
 #include "std/string.hpp"
+#include "std/unique_ptr.hpp"
 
 #ifndef PARALLEL_POLYGONIZER
 #define PARALLEL_POLYGONIZER 1
@@ -40,6 +42,7 @@ namespace feature
     vector<FeatureOutT*> m_Buckets;
     vector<string> m_Names;
     borders::CountriesContainerT m_countries;
+    unique_ptr<gen::ElementCountryIndexWriter> m_elementIndex;
 
 #if PARALLEL_POLYGONIZER
     QThreadPool m_ThreadPool;
@@ -62,6 +65,14 @@ namespace feature
       {
         CHECK(borders::LoadCountriesList(info.m_targetDir, m_countries),
             ("Error loading country polygons files"));
+
+        // Full planet runs rebuild the element -> country index used by the
+        // --filter_countries mode; filtered runs must not clobber it with partial data.
+        if (info.m_filterCountries.empty())
+        {
+          m_elementIndex.reset(new gen::ElementCountryIndexWriter(
+              info.GetIntermediateFileName(ELEMENT2COUNTRY_FILE, "")));
+        }
       }
       else
       {
@@ -166,6 +177,9 @@ namespace feature
 
       auto & bucket = *(m_Buckets[country->m_index]);
       bucket(fb);
+
+      if (m_elementIndex)
+        m_elementIndex->Write(fb.GetOsmIds(), country->m_name);
     }
 
     vector<string> const & Names() const
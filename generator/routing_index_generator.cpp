@@ -9,6 +9,7 @@
 #include "routing/index_graph.hpp"
 #include "routing/index_graph_loader.hpp"
 #include "routing/index_graph_serialization.hpp"
+#include "routing/joint_hierarchy.hpp"
 #include "routing/vehicle_mask.hpp"
 
 #include "routing_common/bicycle_model.hpp"
@@ -26,7 +27,9 @@
 
 #include "base/checked_cast.hpp"
 #include "base/logging.hpp"
+#include "base/math.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -161,6 +164,99 @@ private:
   IndexGraph & m_graph;
 };
 
+// Conservative rasterization of the country border lines onto a coarse grid.
+// A transition point always lies on a border edge, so a feature whose limit rect
+// does not touch any cell a border edge passes through cannot produce a transition
+// and skips the expensive per-point RegionsContain() checks.
+class BordersGrid final
+{
+public:
+  static size_t constexpr kGridSize = 512;
+
+  explicit BordersGrid(vector<m2::RegionD> const & borders)
+  {
+    for (auto const & border : borders)
+      m_limitRect.Add(border.GetRect());
+
+    if (!m_limitRect.IsValid())
+      return;
+
+    m_cells.assign(kGridSize * kGridSize, false);
+    for (auto const & border : borders)
+    {
+      m2::PointD first;
+      m2::PointD prev;
+      bool hasPrev = false;
+      border.ForEachPoint([&](m2::PointD const & point) {
+        if (hasPrev)
+        {
+          MarkEdge(prev, point);
+        }
+        else
+        {
+          first = point;
+          hasPrev = true;
+        }
+        prev = point;
+      });
+
+      if (hasPrev)
+        MarkEdge(prev, first);
+    }
+  }
+
+  // Returns false only if |rect| is guaranteed to stay on one side of every border.
+  bool MayCross(m2::RectD const & rect) const
+  {
+    if (m_cells.empty() || !m_limitRect.IsIntersect(rect))
+      return false;
+
+    size_t const minX = CellX(rect.minX());
+    size_t const maxX = CellX(rect.maxX());
+    size_t const maxY = CellY(rect.maxY());
+    for (size_t y = CellY(rect.minY()); y <= maxY; ++y)
+    {
+      for (size_t x = minX; x <= maxX; ++x)
+      {
+        if (m_cells[y * kGridSize + x])
+          return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  static size_t Cell(double v, double minV, double size)
+  {
+    if (size <= 0.0)
+      return 0;
+
+    double const cell = (v - minV) / size * kGridSize;
+    return static_cast<size_t>(my::clamp(cell, 0.0, static_cast<double>(kGridSize - 1)));
+  }
+
+  size_t CellX(double x) const { return Cell(x, m_limitRect.minX(), m_limitRect.SizeX()); }
+  size_t CellY(double y) const { return Cell(y, m_limitRect.minY(), m_limitRect.SizeY()); }
+
+  void MarkEdge(m2::PointD const & p1, m2::PointD const & p2)
+  {
+    // Marking the edge bounding box is enough: border edges are short compared
+    // to the cell size, and overmarking only costs a few extra exact checks.
+    size_t const maxX = CellX(max(p1.x, p2.x));
+    size_t const maxY = CellY(max(p1.y, p2.y));
+    size_t const minX = CellX(min(p1.x, p2.x));
+    for (size_t y = CellY(min(p1.y, p2.y)); y <= maxY; ++y)
+    {
+      for (size_t x = minX; x <= maxX; ++x)
+        m_cells[y * kGridSize + x] = true;
+    }
+  }
+
+  m2::RectD m_limitRect;
+  vector<bool> m_cells;
+};
+
 bool RegionsContain(vector<m2::RegionD> const & regions, m2::PointD const & point)
 {
   for (auto const & region : regions)
@@ -180,6 +276,7 @@ void CalcCrossMwmTransitions(string const & path, string const & mwmFile, string
   vector<m2::RegionD> borders;
   osm::LoadBorders(polyFile, borders);
 
+  BordersGrid const bordersGrid(borders);
   VehicleMaskBuilder const maskMaker(country);
 
   feature::ForEachFromDat(mwmFile, [&](FeatureType const & f, uint32_t featureId) {
@@ -192,7 +289,12 @@ void CalcCrossMwmTransitions(string const & path, string const & mwmFile, string
     if (pointsCount == 0)
       return;
 
+    if (!bordersGrid.MayCross(f.GetLimitRect(FeatureType::BEST_GEOMETRY)))
+      return;
+
     bool prevPointIn = RegionsContain(borders, f.GetPoint(0));
+    VehicleMask oneWayMask = 0;
+    bool oneWayMaskCalculated = false;
 
     for (size_t i = 1; i < pointsCount; ++i)
     {
@@ -201,7 +303,11 @@ void CalcCrossMwmTransitions(string const & path, string const & mwmFile, string
         continue;
 
       uint32_t const segmentIdx = base::asserted_cast<uint32_t>(i - 1);
-      VehicleMask const oneWayMask = maskMaker.CalcOneWayMask(f);
+      if (!oneWayMaskCalculated)
+      {
+        oneWayMask = maskMaker.CalcOneWayMask(f);
+        oneWayMaskCalculated = true;
+      }
 
       transitions.emplace_back(featureId, segmentIdx, roadMask, oneWayMask, currPointIn,
                                f.GetPoint(i - 1), f.GetPoint(i));
@@ -338,4 +444,73 @@ void BuildCrossMwmSection(string const & path, string const & mwmFile, string co
 
   LOG(LINFO, ("Cross mwm section generated, size:", sectionSize, "bytes"));
 }
+
+void BuildJointHierarchySection(string const & path, string const & mwmFile,
+                                string const & country)
+{
+  LOG(LINFO, ("Building joint hierarchy section for", country));
+  my::Timer timer;
+
+  shared_ptr<IVehicleModel> vehicleModel = CarModelFactory().GetVehicleModelForCountry(country);
+  IndexGraph graph(
+      GeometryLoader::CreateFromFile(mwmFile, vehicleModel),
+      EdgeEstimator::CreateForCar(nullptr /* trafficStash */, vehicleModel->GetMaxSpeed()));
+
+  MwmValue mwmValue(LocalCountryFile(path, platform::CountryFile(country), 0 /* version */));
+  DeserializeIndexGraph(mwmValue, graph);
+
+  JointHierarchy hierarchy;
+  hierarchy.Build(graph);
+  LOG(LINFO, ("Contraction finished, elapsed:", timer.ElapsedSeconds(), "seconds"));
+
+  FilesContainerW cont(mwmFile, FileWriter::OP_WRITE_EXISTING);
+  FileWriter writer = cont.GetWriter(JOINT_HIERARCHY_FILE_TAG);
+  auto const startPos = writer.Pos();
+  hierarchy.Serialize(writer);
+  auto const sectionSize = writer.Pos() - startPos;
+
+  LOG(LINFO, ("Joint hierarchy section generated, size:", sectionSize, "bytes,",
+              hierarchy.GetNumShortcuts(), "shortcuts"));
+}
+
+void BuildSegmentWeightsSection(string const & path, string const & mwmFile,
+                                string const & country)
+{
+  LOG(LINFO, ("Building segment weights section for", country));
+  my::Timer timer;
+
+  shared_ptr<IVehicleModel> vehicleModel = CarModelFactory().GetVehicleModelForCountry(country);
+  IndexGraph graph(
+      GeometryLoader::CreateFromFile(mwmFile, vehicleModel),
+      EdgeEstimator::CreateForCar(nullptr /* trafficStash */, vehicleModel->GetMaxSpeed()));
+
+  MwmValue mwmValue(LocalCountryFile(path, platform::CountryFile(country), 0 /* version */));
+  DeserializeIndexGraph(mwmValue, graph);
+
+  SegmentWeights weights;
+  Geometry & geometry = graph.GetGeometry();
+  EdgeEstimator const & estimator = graph.GetEstimator();
+  graph.ForEachRoad([&](uint32_t featureId, RoadJointIds const & /* road */) {
+    RoadGeometry const & roadGeometry = geometry.GetRoad(featureId);
+    if (!roadGeometry.IsValid() || roadGeometry.GetPointsCount() < 2)
+      return;
+
+    vector<uint32_t> segments(roadGeometry.GetPointsCount() - 1);
+    for (uint32_t i = 0; i < segments.size(); ++i)
+    {
+      segments[i] = SegmentWeights::QuantizeWeight(estimator.CalcSegmentWeight(
+          Segment(kFakeNumMwmId, featureId, i, true /* forward */), roadGeometry));
+    }
+    weights.AddRoad(featureId, move(segments));
+  });
+
+  FilesContainerW cont(mwmFile, FileWriter::OP_WRITE_EXISTING);
+  FileWriter writer = cont.GetWriter(SEGMENT_WEIGHTS_FILE_TAG);
+  auto const startPos = writer.Pos();
+  weights.Serialize(writer);
+  auto const sectionSize = writer.Pos() - startPos;
+
+  LOG(LINFO, ("Segment weights section generated, size:", sectionSize, "bytes,",
+              weights.GetNumRoads(), "roads, elapsed:", timer.ElapsedSeconds(), "seconds"));
+}
 }  // namespace routing
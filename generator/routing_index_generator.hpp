@@ -6,4 +6,8 @@ namespace routing
 {
 bool BuildRoutingIndex(string const & filename, string const & country);
 void BuildCrossMwmSection(string const & path, string const & mwmFile, string const & country);
+void BuildJointHierarchySection(string const & path, string const & mwmFile,
+                                string const & country);
+void BuildSegmentWeightsSection(string const & path, string const & mwmFile,
+                                string const & country);
 }  // namespace routing
@@ -6,6 +6,7 @@
 #include "search/search_trie.hpp"
 #include "search/types_skipper.hpp"
 
+#include "indexer/categories_cbv.hpp"
 #include "indexer/categories_holder.hpp"
 #include "indexer/classificator.hpp"
 #include "indexer/feature_algo.hpp"
@@ -39,6 +40,8 @@
 #include "std/fstream.hpp"
 #include "std/initializer_list.hpp"
 #include "std/limits.hpp"
+#include "std/queue.hpp"
+#include "std/thread.hpp"
 #include "std/unordered_map.hpp"
 #include "std/vector.hpp"
 
@@ -239,17 +242,24 @@ class FeatureInserter
 
   CategoriesHolder const & m_categories;
 
+  // (classificator type index, feature index) pairs mirroring the
+  // category tokens added to the trie; serialized later into the
+  // categories bit vectors section.
+  vector<pair<uint32_t, uint32_t>> & m_categoryPairs;
+
   pair<int, int> m_scales;
 
   ValueBuilder<TValue> const & m_valueBuilder;
 
 public:
   FeatureInserter(SynonymsHolder * synonyms, vector<pair<TKey, TValue>> & keyValuePairs,
-                  CategoriesHolder const & catHolder, pair<int, int> const & scales,
+                  CategoriesHolder const & catHolder,
+                  vector<pair<uint32_t, uint32_t>> & categoryPairs, pair<int, int> const & scales,
                   ValueBuilder<TValue> const & valueBuilder)
     : m_synonyms(synonyms)
     , m_keyValuePairs(keyValuePairs)
     , m_categories(catHolder)
+    , m_categoryPairs(categoryPairs)
     , m_scales(scales)
     , m_valueBuilder(valueBuilder)
   {
@@ -301,15 +311,27 @@ public:
 
     // add names of categories of the feature
     for (uint32_t t : categoryTypes)
-      inserter.AddToken(kCategoriesLang, FeatureTypeToString(c.GetIndexForType(t)));
+    {
+      uint32_t const typeIndex = c.GetIndexForType(t);
+      inserter.AddToken(kCategoriesLang, FeatureTypeToString(typeIndex));
+      m_categoryPairs.emplace_back(typeIndex, index);
+    }
   }
 };
 
+/// Extracts (token, value) pairs from all features of |container| into |keyValuePairs|,
+/// sorted and ready for the trie builder. Tokens are collected on a worker pool: every
+/// worker walks the whole dat section (feature parsing is lazy, so skipped records cost
+/// almost nothing) and processes its own interleaved stripe of features with a private
+/// reader and result vector. The sorted per-worker runs are then k-way merged, so the
+/// peak memory stays the same as with a single shared vector.
 template <typename TKey, typename TValue>
-void AddFeatureNameIndexPairs(FeaturesVectorTest const & features,
+void AddFeatureNameIndexPairs(FilesContainerR const & container,
                               CategoriesHolder & categoriesHolder,
-                              vector<pair<TKey, TValue>> & keyValuePairs)
+                              vector<pair<TKey, TValue>> & keyValuePairs,
+                              map<uint32_t, vector<uint64_t>> & categoryFeatures)
 {
+  FeaturesVectorTest features(container);
   feature::DataHeader const & header = features.GetHeader();
 
   ValueBuilder<TValue> valueBuilder;
@@ -318,8 +340,63 @@ void AddFeatureNameIndexPairs(FeaturesVectorTest const & features,
   if (header.GetType() == feature::DataHeader::world)
     synonyms.reset(new SynonymsHolder(GetPlatform().WritablePathForFile(SYNONYMS_FILE)));
 
-  features.GetVector().ForEach(FeatureInserter<TKey, TValue>(
-      synonyms.get(), keyValuePairs, categoriesHolder, header.GetScaleRange(), valueBuilder));
+  size_t const numThreads = max(size_t(1), size_t(thread::hardware_concurrency()));
+  vector<vector<pair<TKey, TValue>>> runs(numThreads);
+  vector<vector<pair<uint32_t, uint32_t>>> categoryRuns(numThreads);
+
+  vector<thread> threads;
+  for (size_t t = 0; t < numThreads; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      // FeaturesVector is not thread-safe, give every worker its own reader.
+      FeaturesVectorTest workerFeatures(container.GetFileName());
+      FeatureInserter<TKey, TValue> inserter(synonyms.get(), runs[t], categoriesHolder,
+                                             categoryRuns[t], header.GetScaleRange(),
+                                             valueBuilder);
+      workerFeatures.GetVector().ForEach([&](FeatureType const & f, uint32_t index)
+      {
+        if (index % numThreads == t)
+          inserter(f, index);
+      });
+      sort(runs[t].begin(), runs[t].end());
+    });
+  }
+  for (auto & worker : threads)
+    worker.join();
+
+  for (auto const & run : categoryRuns)
+  {
+    for (auto const & pair : run)
+      categoryFeatures[pair.first].push_back(pair.second);
+  }
+
+  size_t total = 0;
+  for (auto const & run : runs)
+    total += run.size();
+  keyValuePairs.reserve(keyValuePairs.size() + total);
+
+  // K-way merge of the sorted runs. A queued run is keyed by its current element;
+  // the key changes only when the run is popped, incremented and pushed back.
+  vector<size_t> pos(numThreads, 0);
+  auto const greater = [&runs, &pos](size_t l, size_t r)
+  {
+    return runs[r][pos[r]] < runs[l][pos[l]];
+  };
+  priority_queue<size_t, vector<size_t>, decltype(greater)> queue(greater);
+  for (size_t t = 0; t < numThreads; ++t)
+  {
+    if (!runs[t].empty())
+      queue.push(t);
+  }
+  while (!queue.empty())
+  {
+    size_t const t = queue.top();
+    queue.pop();
+    keyValuePairs.push_back(move(runs[t][pos[t]]));
+    if (++pos[t] < runs[t].size())
+      queue.push(t);
+  }
 }
 
 void BuildAddressTable(FilesContainerR & container, Writer & writer)
@@ -409,9 +486,10 @@ bool BuildSearchIndexFromDataFile(string const & filename, bool forceRebuild)
 
   try
   {
+    map<uint32_t, vector<uint64_t>> categoryFeatures;
     {
       FileWriter writer(indexFilePath);
-      BuildSearchIndex(readContainer, writer);
+      BuildSearchIndex(readContainer, writer, categoryFeatures);
       LOG(LINFO, ("Search index size =", writer.Size()));
     }
     if (filename != WORLD_FILE_NAME && filename != WORLD_COASTS_FILE_NAME)
@@ -446,6 +524,12 @@ bool BuildSearchIndexFromDataFile(string const & filename, bool forceRebuild)
         FilesContainerW writeContainer(readContainer.GetFileName(), FileWriter::OP_WRITE_EXISTING);
         writeContainer.Write(addrFilePath, SEARCH_ADDRESS_FILE_TAG);
       }
+
+      {
+        FilesContainerW writeContainer(readContainer.GetFileName(), FileWriter::OP_WRITE_EXISTING);
+        FileWriter writer = writeContainer.GetWriter(CATEGORIES_CBVS_FILE_TAG);
+        search::CategoriesCBV::Serialize(writer, move(categoryFeatures));
+      }
     }
   }
   catch (Reader::Exception const & e)
@@ -462,7 +546,8 @@ bool BuildSearchIndexFromDataFile(string const & filename, bool forceRebuild)
   return true;
 }
 
-void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter)
+void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter,
+                      map<uint32_t, vector<uint64_t>> & categoryFeatures)
 {
   using TKey = strings::UniString;
   using TValue = FeatureIndexValue;
@@ -479,9 +564,8 @@ void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter)
   SingleValueSerializer<TValue> serializer(codingParams);
 
   vector<pair<TKey, TValue>> searchIndexKeyValuePairs;
-  AddFeatureNameIndexPairs(features, categoriesHolder, searchIndexKeyValuePairs);
-
-  sort(searchIndexKeyValuePairs.begin(), searchIndexKeyValuePairs.end());
+  AddFeatureNameIndexPairs(container, categoriesHolder, searchIndexKeyValuePairs,
+                           categoryFeatures);
   LOG(LINFO, ("End sorting strings:", timer.ElapsedSeconds()));
 
   trie::Build<Writer, TKey, ValueList<TValue>, SingleValueSerializer<TValue>>(
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "std/cstdint.hpp"
+#include "std/map.hpp"
 #include "std/string.hpp"
+#include "std/vector.hpp"
 
 class FilesContainerR;
 class Writer;
@@ -13,5 +16,10 @@ namespace indexer
 // in version mismatch when trying to read the index.
 bool BuildSearchIndexFromDataFile(string const & filename, bool forceRebuild = false);
 
-void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter);
+// Builds the search index trie and writes it to |indexWriter|. Also
+// fills |categoryFeatures| with per-category-type feature lists, which
+// duplicate the category tokens put into the trie and are serialized
+// into the categories bit vectors section (see search::CategoriesCBV).
+void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter,
+                      map<uint32_t, vector<uint64_t>> & categoryFeatures);
 }  // namespace indexer
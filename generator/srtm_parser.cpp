@@ -144,11 +144,51 @@ void SrtmTile::Invalidate()
 }
 
 // SrtmTileManager ---------------------------------------------------------------------------------
-SrtmTileManager::SrtmTileManager(string const & dir) : m_dir(dir) {}
+SrtmTileManager::SrtmTileManager(string const & dir)
+  : m_dir(dir), m_lastKey(0), m_lastTile(nullptr)
+{
+}
+
 feature::TAltitude SrtmTileManager::GetHeight(ms::LatLon const & coord)
 {
-  string const base = SrtmTile::GetBase(coord);
-  auto it = m_tiles.find(base);
+  return GetTile(coord).GetHeight(coord);
+}
+
+void SrtmTileManager::PrefetchTiles(ms::LatLon const & leftBottom, ms::LatLon const & rightTop)
+{
+  for (int lat = LatIndex(leftBottom.lat); lat <= LatIndex(rightTop.lat); ++lat)
+  {
+    for (int lon = LonIndex(leftBottom.lon); lon <= LonIndex(rightTop.lon); ++lon)
+      GetTile(ms::LatLon(lat + 0.5, lon + 0.5));
+  }
+}
+
+// static
+int SrtmTileManager::LatIndex(double lat)
+{
+  return lat >= 0 ? static_cast<int>(lat) : -static_cast<int>(-lat + 1);
+}
+
+// static
+int SrtmTileManager::LonIndex(double lon)
+{
+  return lon >= 0 ? static_cast<int>(lon) : -static_cast<int>(-lon + 1);
+}
+
+// static
+uint32_t SrtmTileManager::GetKey(ms::LatLon const & coord)
+{
+  return (static_cast<uint32_t>(LatIndex(coord.lat) + 90) << 9) |
+         static_cast<uint32_t>(LonIndex(coord.lon) + 180);
+}
+
+SrtmTile & SrtmTileManager::GetTile(ms::LatLon const & coord)
+{
+  uint32_t const key = GetKey(coord);
+  if (m_lastTile != nullptr && m_lastKey == key)
+    return *m_lastTile;
+
+  auto it = m_tiles.find(key);
   if (it == m_tiles.end())
   {
     SrtmTile tile;
@@ -158,14 +198,28 @@ feature::TAltitude SrtmTileManager::GetHeight(ms::LatLon const & coord)
     }
     catch (RootException const & e)
     {
-      LOG(LINFO, ("Can't init SRTM tile:", base, "reason:", e.Msg()));
+      LOG(LINFO, ("Can't init SRTM tile:", SrtmTile::GetBase(coord), "reason:", e.Msg()));
     }
 
     // It's OK to store even invalid tiles and return invalid height
     // for them later.
-    it = m_tiles.emplace(base, move(tile)).first;
+    m_lru.emplace_front(key, move(tile));
+    m_tiles.emplace(key, m_lru.begin());
+
+    if (m_tiles.size() > kMaxCachedTiles)
+    {
+      uint32_t const victim = m_lru.back().first;
+      m_tiles.erase(victim);
+      m_lru.pop_back();
+    }
+  }
+  else
+  {
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
   }
 
-  return it->second.GetHeight(coord);
+  m_lastKey = key;
+  m_lastTile = &m_lru.front().second;
+  return *m_lastTile;
 }
 }  // namespace generator
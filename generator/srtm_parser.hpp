@@ -7,8 +7,10 @@
 #include "base/macros.hpp"
 
 #include "std/cstdint.hpp"
+#include "std/list.hpp"
 #include "std/string.hpp"
 #include "std/unordered_map.hpp"
+#include "std/utility.hpp"
 
 namespace generator
 {
@@ -44,13 +46,35 @@ private:
 class SrtmTileManager
 {
 public:
+  // A decoded tile takes ~25 MB, the cap bounds the manager by ~1.6 GB while still
+  // keeping every tile of a feature's bounding box resident.
+  static size_t constexpr kMaxCachedTiles = 64;
+
   SrtmTileManager(string const & dir);
 
   feature::TAltitude GetHeight(ms::LatLon const & coord);
 
+  // Decodes all tiles overlapping the [leftBottom, rightTop] rect up front, so the
+  // following per-point GetHeight() calls hit the cache.
+  void PrefetchTiles(ms::LatLon const & leftBottom, ms::LatLon const & rightTop);
+
 private:
+  // Integer tile indexes matching SrtmTile::GetBase() naming arithmetic.
+  static int LatIndex(double lat);
+  static int LonIndex(double lon);
+  static uint32_t GetKey(ms::LatLon const & coord);
+
+  SrtmTile & GetTile(ms::LatLon const & coord);
+
   string m_dir;
-  unordered_map<string, SrtmTile> m_tiles;
+
+  // LRU of decoded tiles: most recently used in front. The map points into the list.
+  list<pair<uint32_t, SrtmTile>> m_lru;
+  unordered_map<uint32_t, list<pair<uint32_t, SrtmTile>>::iterator> m_tiles;
+
+  // Fast path for consecutive points of one feature, which mostly share a tile.
+  uint32_t m_lastKey;
+  SrtmTile * m_lastTile;
 
   DISALLOW_COPY(SrtmTileManager);
 };
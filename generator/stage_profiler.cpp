@@ -0,0 +1,179 @@
+#include "generator/stage_profiler.hpp"
+
+#include "base/assert.hpp"
+#include "base/logging.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/fstream.hpp"
+#include "std/iomanip.hpp"
+#include "std/target_os.hpp"
+
+#ifndef OMIM_OS_WINDOWS
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+namespace generator
+{
+namespace
+{
+double CpuSeconds()
+{
+#ifndef OMIM_OS_WINDOWS
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0.0;
+
+  auto const toSeconds = [](struct timeval const & tv) {
+    return tv.tv_sec + tv.tv_usec * 1.0E-6;
+  };
+  return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+#else
+  return 0.0;
+#endif
+}
+
+uint64_t PeakRssBytes()
+{
+#ifndef OMIM_OS_WINDOWS
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+#ifdef OMIM_OS_MAC
+  // ru_maxrss is in bytes on OS X ...
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  // ... and in kilobytes everywhere else.
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+void IoBytes(uint64_t & bytesRead, uint64_t & bytesWritten)
+{
+  bytesRead = 0;
+  bytesWritten = 0;
+
+#ifdef OMIM_OS_LINUX
+  ifstream io("/proc/self/io");
+  string name;
+  uint64_t value;
+  while (io >> name >> value)
+  {
+    if (name == "read_bytes:")
+      bytesRead = value;
+    else if (name == "write_bytes:")
+      bytesWritten = value;
+  }
+#endif
+}
+}  // namespace
+
+// StageProfiler::Guard ----------------------------------------------------------------------------
+StageProfiler::Guard::Guard(StageProfiler * profiler, string const & name)
+  : m_profiler(profiler), m_name(name)
+{
+  if (m_profiler)
+    m_profiler->StartStage(m_name);
+}
+
+StageProfiler::Guard::~Guard()
+{
+  if (m_profiler)
+    m_profiler->FinishStage(m_name);
+}
+
+// StageProfiler -----------------------------------------------------------------------------------
+StageProfiler::StageProfiler(string const & reportPath) : m_reportPath(reportPath) {}
+
+StageProfiler::~StageProfiler()
+{
+  WriteReport();
+}
+
+void StageProfiler::StartStage(string const & name)
+{
+  Stage & stage = GetStage(name);
+  ASSERT(!stage.m_running, ("Stage", name, "is started twice."));
+
+  stage.m_start = TakeSample();
+  stage.m_running = true;
+}
+
+void StageProfiler::FinishStage(string const & name)
+{
+  Stage & stage = GetStage(name);
+  ASSERT(stage.m_running, ("Stage", name, "is finished but was not started."));
+
+  Sample const now = TakeSample();
+  stage.m_total.m_wallSeconds += now.m_wallSeconds - stage.m_start.m_wallSeconds;
+  stage.m_total.m_cpuSeconds += now.m_cpuSeconds - stage.m_start.m_cpuSeconds;
+  // Peak RSS is process-wide and monotonic, so report the value seen at stage end.
+  stage.m_total.m_peakRssBytes = max(stage.m_total.m_peakRssBytes, now.m_peakRssBytes);
+  stage.m_total.m_bytesRead += now.m_bytesRead - stage.m_start.m_bytesRead;
+  stage.m_total.m_bytesWritten += now.m_bytesWritten - stage.m_start.m_bytesWritten;
+  stage.m_running = false;
+}
+
+StageProfiler::Sample StageProfiler::TakeSample() const
+{
+  Sample sample;
+  sample.m_wallSeconds = m_timer.ElapsedSeconds();
+  sample.m_cpuSeconds = CpuSeconds();
+  sample.m_peakRssBytes = PeakRssBytes();
+  IoBytes(sample.m_bytesRead, sample.m_bytesWritten);
+  return sample;
+}
+
+StageProfiler::Stage & StageProfiler::GetStage(string const & name)
+{
+  for (Stage & stage : m_stages)
+  {
+    if (stage.m_name == name)
+      return stage;
+  }
+
+  m_stages.emplace_back(name);
+  return m_stages.back();
+}
+
+void StageProfiler::WriteReport() const
+{
+  ofstream report(m_reportPath.c_str());
+  if (!report.is_open())
+  {
+    LOG(LERROR, ("Can't write the stage profile report to", m_reportPath));
+    return;
+  }
+
+  report << fixed << setprecision(3);
+  report << "{\n  \"stages\": [\n";
+  for (size_t i = 0; i < m_stages.size(); ++i)
+  {
+    Sample const & s = m_stages[i].m_total;
+    report << "    {\n"
+           << "      \"name\": \"" << m_stages[i].m_name << "\",\n"
+           << "      \"wall_seconds\": " << s.m_wallSeconds << ",\n"
+           << "      \"cpu_seconds\": " << s.m_cpuSeconds << ",\n"
+           << "      \"peak_rss_bytes\": " << s.m_peakRssBytes << ",\n"
+           << "      \"bytes_read\": " << s.m_bytesRead << ",\n"
+           << "      \"bytes_written\": " << s.m_bytesWritten << "\n"
+           << "    }" << (i + 1 == m_stages.size() ? "\n" : ",\n");
+  }
+
+  Sample const total = TakeSample();
+  report << "  ],\n"
+         << "  \"process\": {\n"
+         << "    \"wall_seconds\": " << total.m_wallSeconds << ",\n"
+         << "    \"cpu_seconds\": " << total.m_cpuSeconds << ",\n"
+         << "    \"peak_rss_bytes\": " << total.m_peakRssBytes << ",\n"
+         << "    \"bytes_read\": " << total.m_bytesRead << ",\n"
+         << "    \"bytes_written\": " << total.m_bytesWritten << "\n"
+         << "  }\n}\n";
+
+  LOG(LINFO, ("Stage profile report is written to", m_reportPath));
+}
+}  // namespace generator
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "base/timer.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+namespace generator
+{
+/// Accumulates per-stage wall and CPU time, peak RSS and IO byte counters and
+/// writes a JSON report on destruction. A stage may run several times (e.g. once
+/// per country); its samples are summed under one name.
+class StageProfiler
+{
+public:
+  explicit StageProfiler(string const & reportPath);
+  ~StageProfiler();
+
+  void StartStage(string const & name);
+  void FinishStage(string const & name);
+
+  /// Scoped stage wrapper. Does nothing when |profiler| is nullptr, so call
+  /// sites do not need to check whether profiling is enabled.
+  class Guard
+  {
+  public:
+    Guard(StageProfiler * profiler, string const & name);
+    ~Guard();
+
+  private:
+    StageProfiler * m_profiler;
+    string m_name;
+  };
+
+private:
+  struct Sample
+  {
+    double m_wallSeconds = 0.0;
+    double m_cpuSeconds = 0.0;
+    uint64_t m_peakRssBytes = 0;
+    uint64_t m_bytesRead = 0;
+    uint64_t m_bytesWritten = 0;
+  };
+
+  struct Stage
+  {
+    explicit Stage(string const & name) : m_name(name) {}
+
+    string m_name;
+    Sample m_start;
+    Sample m_total;
+    bool m_running = false;
+  };
+
+  Sample TakeSample() const;
+  Stage & GetStage(string const & name);
+  void WriteReport() const;
+
+  string m_reportPath;
+  my::Timer m_timer;
+
+  // Linear scan is fine: there is a handful of stages, and keeping the insertion
+  // order makes the report follow the pipeline order.
+  vector<Stage> m_stages;
+};
+}  // namespace generator
@@ -9,6 +9,7 @@
 #include "base/assert.hpp"
 #include "base/logging.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/limits.hpp"
 #include "std/queue.hpp"
 #include "std/unique_ptr.hpp"
@@ -90,34 +91,45 @@ int TesselateInterior(PolygonsT const & polys, TrianglesInfo & info)
   }
 
   /// Find best (cheap in serialization) start edge for processing.
+  /// Border edges are collected and sorted once, so every following call just skips
+  /// the candidates whose triangles were already visited by previous chains.
   TrianglesInfo::ListInfo::TIterator
   TrianglesInfo::ListInfo::FindStartTriangle(PointsInfo const & points) const
   {
-    TIterator ret = m_neighbors.end();
-    size_t cr = numeric_limits<size_t>::max();
-
-    for (TIterator i = m_neighbors.begin(); i != m_neighbors.end(); ++i)
+    if (m_startCandidates.empty())
     {
-      if (!m_visited[i->second] &&
-          m_neighbors.find(make_pair(i->first.second, i->first.first)) == m_neighbors.end())
+      for (TIterator i = m_neighbors.begin(); i != m_neighbors.end(); ++i)
       {
+        if (m_neighbors.find(make_pair(i->first.second, i->first.first)) != m_neighbors.end())
+          continue;
+
         uint64_t deltas[3];
         deltas[0] = EncodeDelta(points.m_points[i->first.first], points.m_base);
         deltas[1] = EncodeDelta(points.m_points[i->first.second], points.m_points[i->first.first]);
         deltas[2] = EncodeDelta(points.m_points[m_triangles[i->second].GetPoint3(i->first)],
                                 points.m_points[i->first.second]);
 
-        size_t const sz = GetBufferSize(deltas, deltas + 3);
-        if (sz < cr)
-        {
-          ret = i;
-          cr = sz;
-        }
+        m_startCandidates.emplace_back(GetBufferSize(deltas, deltas + 3), i);
       }
+
+      stable_sort(m_startCandidates.begin(), m_startCandidates.end(),
+                  [](pair<uint64_t, TIterator> const & l, pair<uint64_t, TIterator> const & r)
+                  {
+                    return l.first < r.first;
+                  });
+      m_nextCandidate = 0;
+    }
+
+    while (m_nextCandidate < m_startCandidates.size())
+    {
+      TIterator const it = m_startCandidates[m_nextCandidate].second;
+      if (!m_visited[it->second])
+        return it;
+      ++m_nextCandidate;
     }
 
-    ASSERT ( ret != m_neighbors.end(), ("?WTF? There is no border triangles!") );
-    return ret;
+    ASSERT ( false, ("?WTF? There is no border triangles!") );
+    return m_neighbors.end();
   }
 
   /// Return indexes of common edges of [to, from] triangles.
@@ -193,6 +205,7 @@ int TesselateInterior(PolygonsT const & polys, TrianglesInfo & info)
       if (m_visited[e.m_p[1]])
         continue;
       m_visited[e.m_p[1]] = true;
+      ++m_visitedCount;
 
       // push to chain
       chain.push_back(e);
@@ -63,6 +63,7 @@ namespace tesselator
       vector<Triangle> m_triangles;
 
       mutable vector<bool> m_visited;
+      mutable size_t m_visitedCount;
 
       // directed edge -> triangle
       template <typename T1, typename T2> struct HashPair
@@ -76,6 +77,11 @@ namespace tesselator
       using TNeighbours = unordered_map<pair<int, int>, int, HashPair<int, int>>;
       TNeighbours m_neighbors;
 
+      // Border edges (without a mirrored twin) ordered cheapest first. Built lazily in
+      // FindStartTriangle for the current PointsInfo; holds iterators into m_neighbors.
+      mutable vector<pair<uint64_t, TNeighbours::const_iterator>> m_startCandidates;
+      mutable size_t m_nextCandidate;
+
       void AddNeighbour(int p1, int p2, int trg);
 
       void GetNeighbors(
@@ -88,6 +94,7 @@ namespace tesselator
       using TIterator = TNeighbours::const_iterator;
 
       ListInfo(size_t count)
+        : m_visitedCount(0), m_nextCandidate(0)
       {
         m_triangles.reserve(count);
       }
@@ -96,14 +103,15 @@ namespace tesselator
 
       void Start() const
       {
-        m_visited.resize(m_triangles.size());
+        m_visited.assign(m_triangles.size(), false);
+        m_visitedCount = 0;
+        m_startCandidates.clear();
+        m_nextCandidate = 0;
       }
 
       bool HasUnvisited() const
       {
-        vector<bool> test;
-        test.assign(m_triangles.size(), true);
-        return (m_visited != test);
+        return m_visitedCount != m_triangles.size();
       }
 
       TIterator FindStartTriangle(PointsInfo const & points) const;
@@ -78,42 +78,69 @@ template <class CellIdT, class CellIdContainerT, typename IntersectF>
 void CoverObject(IntersectF const & intersect, uint64_t cellPenaltyArea, CellIdContainerT & out,
                  int cellDepth, CellIdT cell)
 {
-  if (cell.Level() == cellDepth - 1)
+  // Iterative DFS instead of recursion: a cell's subdivision is written
+  // straight into @out and collapsed in place if keeping the cell itself is
+  // cheaper, so covering does not allocate an interim vector per tree level.
+  struct Frame
   {
-    out.push_back(cell);
-    return;
-  }
+    CellIdT m_cell;
+    uint8_t m_nextChild;    // First not yet visited child.
+    uint32_t m_firstCell;   // Start of this cell's subdivision in @out.
+  };
 
-  uint64_t const cellArea = my::sq(uint64_t(1 << (cellDepth - 1 - cell.Level())));
-  CellObjectIntersection const intersection = intersect(cell);
+  buffer_vector<Frame, 16> stack;
 
-  if (intersection == CELL_OBJECT_NO_INTERSECTION)
-    return;
-  if (intersection == CELL_INSIDE_OBJECT || cellPenaltyArea >= cellArea)
+  // Emits the cell if its covering is decided right away, otherwise opens a
+  // frame for its subdivision.
+  auto const visit = [&] (CellIdT const & c)
   {
-    out.push_back(cell);
-    return;
-  }
+    if (c.Level() == cellDepth - 1)
+    {
+      out.push_back(c);
+      return;
+    }
 
-  buffer_vector<CellIdT, 32> subdiv;
-  for (uint8_t i = 0; i < 4; ++i)
-    CoverObject(intersect, cellPenaltyArea, subdiv, cellDepth, cell.Child(i));
+    CellObjectIntersection const intersection = intersect(c);
+    if (intersection == CELL_OBJECT_NO_INTERSECTION)
+      return;
 
-  uint64_t subdivArea = 0;
-  for (size_t i = 0; i < subdiv.size(); ++i)
-    subdivArea += my::sq(uint64_t(1 << (cellDepth - 1 - subdiv[i].Level())));
+    uint64_t const cellArea = my::sq(uint64_t(1 << (cellDepth - 1 - c.Level())));
+    if (intersection == CELL_INSIDE_OBJECT || cellPenaltyArea >= cellArea)
+    {
+      out.push_back(c);
+      return;
+    }
 
-  ASSERT(!subdiv.empty(), (cellPenaltyArea, out, cell));
+    stack.push_back(Frame{c, 0, static_cast<uint32_t>(out.size())});
+  };
 
-  // This criteria is more clear for me. Let's divide if we can save more than cellPenaltyArea.
-  if (subdiv.size() > 1 && cellPenaltyArea >= cellArea - subdivArea)
-  {
-    out.push_back(cell);
-  }
-  else
+  visit(cell);
+
+  while (!stack.empty())
   {
-    for (size_t i = 0; i < subdiv.size(); ++i)
-      out.push_back(subdiv[i]);
+    Frame & f = stack.back();
+    if (f.m_nextChild < 4)
+    {
+      // May push a new frame; f is not touched afterwards.
+      visit(f.m_cell.Child(f.m_nextChild++));
+      continue;
+    }
+
+    ASSERT_GREATER(out.size(), f.m_firstCell, (cellPenaltyArea, f.m_cell));
+
+    uint64_t const cellArea = my::sq(uint64_t(1 << (cellDepth - 1 - f.m_cell.Level())));
+    uint64_t subdivArea = 0;
+    for (size_t i = f.m_firstCell; i < out.size(); ++i)
+      subdivArea += my::sq(uint64_t(1 << (cellDepth - 1 - out[i].Level())));
+
+    // This criteria is more clear for me. Let's divide if we can save more than cellPenaltyArea.
+    if (out.size() - f.m_firstCell > 1 && cellPenaltyArea >= cellArea - subdivArea)
+    {
+      out.resize(f.m_firstCell);
+      out.push_back(f.m_cell);
+    }
+
+    stack.pop_back();
   }
 }
 
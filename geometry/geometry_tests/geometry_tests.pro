@@ -31,6 +31,7 @@ SOURCES += \
   intersect_test.cpp \
   latlon_test.cpp \
   mercator_test.cpp \
+  packed_segments_test.cpp \
   packer_test.cpp \
   point_test.cpp \
   pointu_to_uint64_test.cpp \
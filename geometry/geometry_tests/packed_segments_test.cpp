@@ -0,0 +1,68 @@
+#include "testing/testing.hpp"
+
+#include "geometry/distance.hpp"
+#include "geometry/packed_segments.hpp"
+#include "geometry/point2d.hpp"
+
+#include "std/vector.hpp"
+
+namespace
+{
+using P = m2::PointD;
+
+void CheckAgainstScalar(vector<P> const & points, P const & pt)
+{
+  m2::PackedSegments segments;
+  segments.Assign(points);
+
+  size_t const count = points.size() - 1;
+  TEST_EQUAL(segments.GetCount(), count, ());
+
+  vector<double> projX, projY, distSq;
+  segments.ProjectPoint(pt, 0, count, projX, projY, distSq);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    m2::ProjectionToSection<P> proj;
+    proj.SetBounds(points[i], points[i + 1]);
+    P const expected = proj(pt);
+
+    TEST_ALMOST_EQUAL_ULPS(projX[i], expected.x, (i));
+    TEST_ALMOST_EQUAL_ULPS(projY[i], expected.y, (i));
+
+    m2::DistanceToLineSquare<P> dist;
+    dist.SetBounds(points[i], points[i + 1]);
+    TEST(my::AlmostEqualAbs(distSq[i], dist(pt), 1.0E-12), (i, distSq[i], dist(pt)));
+  }
+}
+}  // namespace
+
+UNIT_TEST(PackedSegments_MatchesProjectionToSection)
+{
+  vector<P> const points = {P(0, 0), P(2, 0), P(2, 2), P(-1, 3), P(-1, 3), P(5, -4)};
+
+  CheckAgainstScalar(points, P(1, 1));
+  CheckAgainstScalar(points, P(-3, 0.5));
+  CheckAgainstScalar(points, P(10, 10));
+  CheckAgainstScalar(points, P(2, 0));
+}
+
+UNIT_TEST(PackedSegments_Range)
+{
+  vector<P> const points = {P(0, 0), P(1, 0), P(2, 0), P(3, 0)};
+
+  m2::PackedSegments segments;
+  segments.Assign(points);
+
+  vector<double> projX, projY, distSq;
+  segments.ProjectPoint(P(2.5, 1), 1, 3, projX, projY, distSq);
+  TEST_EQUAL(projX.size(), 2, ());
+  TEST_ALMOST_EQUAL_ULPS(projX[0], 2.0, ());
+  TEST_ALMOST_EQUAL_ULPS(projX[1], 2.5, ());
+
+  double d;
+  TEST_EQUAL(segments.GetNearest(P(2.5, 1), 0, 3, d), 2, ());
+  TEST_ALMOST_EQUAL_ULPS(d, 1.0, ());
+
+  TEST_EQUAL(segments.GetNearest(P(2.5, 1), 1, 1, d), 1, ());
+}
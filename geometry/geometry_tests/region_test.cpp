@@ -200,6 +200,34 @@ UNIT_TEST(Region_Contains_double)
   }
 }
 
+UNIT_TEST(Region_Contains_Indexed)
+{
+  // Enough points to trigger the lazy slab index inside Contains().
+  size_t const count = 2000;
+  vector<m2::PointD> points;
+  points.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    double const a = 2.0 * math::pi * i / count;
+    points.emplace_back(10.0 * cos(a), 10.0 * sin(a));
+  }
+
+  m2::RegionD region(points.begin(), points.end());
+
+  for (size_t i = 0; i < 100; ++i)
+  {
+    double const a = 2.0 * math::pi * i / 100 + 0.001;
+    // Points well inside and outside the circle (the polygon chords deviate from
+    // it by less than 1.0E-3 at this density).
+    TEST(region.Contains(m2::PointD(9.9 * cos(a), 9.9 * sin(a))), (i));
+    TEST(!region.Contains(m2::PointD(10.1 * cos(a), 10.1 * sin(a))), (i));
+  }
+
+  // Vertices are inside too.
+  TEST(region.Contains(points.front()), ());
+  TEST(region.Contains(points[count / 3]), ());
+}
+
 template <class TPoint> class PointsSummator
 {
   TPoint & m_res;
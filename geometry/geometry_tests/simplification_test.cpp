@@ -166,6 +166,53 @@ UNIT_TEST(Simpfication_DP_DegenerateTrg)
   CheckDPStrict(arr2, ARRAY_SIZE(arr2), 1.0, 4);
 }
 
+UNIT_TEST(Simplification_Tolerances)
+{
+  vector<P> poly;
+  for (int i = 0; i < 100; ++i)
+    poly.push_back(P(i, (i % 7) * 0.01));
+
+  DistanceF dist;
+  vector<double> tolerances;
+  CalcSimplificationTolerances(poly, dist, tolerances);
+
+  TEST_EQUAL(tolerances.size(), poly.size(), ());
+  TEST_EQUAL(tolerances.front(), numeric_limits<double>::max(), ());
+  TEST_EQUAL(tolerances.back(), numeric_limits<double>::max(), ());
+
+  // Thresholding with a growing epsilon gives nested polylines with bounded deviation.
+  double const eps[] = { 1.0E-6, 1.0E-2, 1.0 };
+  vector<size_t> prevKept;
+  for (double e : eps)
+  {
+    vector<size_t> kept;
+    for (size_t i = 0; i < poly.size(); ++i)
+    {
+      if (tolerances[i] > e)
+        kept.push_back(i);
+    }
+
+    TEST_GREATER(kept.size(), 1, (e));
+    if (!prevKept.empty())
+    {
+      TEST_LESS_OR_EQUAL(kept.size(), prevKept.size(), (e));
+      TEST(includes(prevKept.begin(), prevKept.end(), kept.begin(), kept.end()), (e));
+    }
+
+    // The removal order bounds the deviation by the threshold up to a small
+    // factor (neighbors of a removed point may be removed later themselves).
+    for (size_t s = 0; s + 1 < kept.size(); ++s)
+    {
+      DistanceF d;
+      d.SetBounds(poly[kept[s]], poly[kept[s + 1]]);
+      for (size_t i = kept[s] + 1; i < kept[s + 1]; ++i)
+        TEST_LESS_OR_EQUAL(d(poly[i]), 4.0 * e, (i));
+    }
+
+    prevKept.swap(kept);
+  }
+}
+
 #include "geometry/geometry_tests/large_polygon.hpp"
 
 m2::PointD const * LargePolylineTestData::m_Data = LargePolygon::kLargePolygon;
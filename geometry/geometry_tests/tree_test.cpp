@@ -123,6 +123,29 @@ UNIT_TEST(Tree4D_ForEachInRect)
   CheckInRect(arr, ARRAY_SIZE(arr), R(-5.5, -5.5, -0.5, -0.5), 2);
 }
 
+UNIT_TEST(Tree4D_Assign)
+{
+  vector<R> arr;
+  for (int i = 0; i < 100; ++i)
+    arr.push_back(R(i, i, i + 1, i + 1));
+
+  TTree theTree;
+  R const stale(1000, 1000, 1001, 1001);
+  theTree.Add(stale);
+
+  // Assign replaces the old contents with a balanced tree over the range.
+  theTree.Assign(arr.begin(), arr.end());
+  TEST_EQUAL(theTree.GetSize(), arr.size(), ());
+
+  vector<R> test;
+  theTree.ForEachInRect(R(-1, -1, 2.5, 2.5), MakeBackInsertFunctor(test));
+  TEST_EQUAL(test.size(), 3, ());
+
+  test.clear();
+  theTree.ForEachInRect(R(999, 999, 1002, 1002), MakeBackInsertFunctor(test));
+  TEST_EQUAL(test.size(), 0, ());
+}
+
 namespace
 {
 
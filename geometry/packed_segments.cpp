@@ -0,0 +1,171 @@
+#include "geometry/packed_segments.hpp"
+
+#include "base/assert.hpp"
+#include "base/math.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/limits.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define PACKED_SEGMENTS_NEON
+#endif
+
+namespace m2
+{
+namespace
+{
+// Clamped projection of (ptx, pty) onto |count| packed segments. The loop body
+// is branchless, so two segments are processed per iteration on SSE2/NEON.
+void ProjectKernel(double ptx, double pty, size_t count, double const * p0x, double const * p0y,
+                   double const * dx, double const * dy, double const * len, double * projX,
+                   double * projY, double * distSq)
+{
+  size_t i = 0;
+
+#if defined(__SSE2__)
+  __m128d const x = _mm_set1_pd(ptx);
+  __m128d const y = _mm_set1_pd(pty);
+  __m128d const zero = _mm_setzero_pd();
+  for (; i + 2 <= count; i += 2)
+  {
+    __m128d const sx = _mm_loadu_pd(p0x + i);
+    __m128d const sy = _mm_loadu_pd(p0y + i);
+    __m128d const ex = _mm_loadu_pd(dx + i);
+    __m128d const ey = _mm_loadu_pd(dy + i);
+
+    __m128d t = _mm_add_pd(_mm_mul_pd(_mm_sub_pd(x, sx), ex), _mm_mul_pd(_mm_sub_pd(y, sy), ey));
+    t = _mm_min_pd(_mm_max_pd(t, zero), _mm_loadu_pd(len + i));
+
+    __m128d const px = _mm_add_pd(sx, _mm_mul_pd(ex, t));
+    __m128d const py = _mm_add_pd(sy, _mm_mul_pd(ey, t));
+    _mm_storeu_pd(projX + i, px);
+    _mm_storeu_pd(projY + i, py);
+
+    __m128d const rx = _mm_sub_pd(x, px);
+    __m128d const ry = _mm_sub_pd(y, py);
+    _mm_storeu_pd(distSq + i, _mm_add_pd(_mm_mul_pd(rx, rx), _mm_mul_pd(ry, ry)));
+  }
+#elif defined(PACKED_SEGMENTS_NEON)
+  float64x2_t const x = vdupq_n_f64(ptx);
+  float64x2_t const y = vdupq_n_f64(pty);
+  float64x2_t const zero = vdupq_n_f64(0.0);
+  for (; i + 2 <= count; i += 2)
+  {
+    float64x2_t const sx = vld1q_f64(p0x + i);
+    float64x2_t const sy = vld1q_f64(p0y + i);
+    float64x2_t const ex = vld1q_f64(dx + i);
+    float64x2_t const ey = vld1q_f64(dy + i);
+
+    float64x2_t t = vaddq_f64(vmulq_f64(vsubq_f64(x, sx), ex), vmulq_f64(vsubq_f64(y, sy), ey));
+    t = vminq_f64(vmaxq_f64(t, zero), vld1q_f64(len + i));
+
+    float64x2_t const px = vaddq_f64(sx, vmulq_f64(ex, t));
+    float64x2_t const py = vaddq_f64(sy, vmulq_f64(ey, t));
+    vst1q_f64(projX + i, px);
+    vst1q_f64(projY + i, py);
+
+    float64x2_t const rx = vsubq_f64(x, px);
+    float64x2_t const ry = vsubq_f64(y, py);
+    vst1q_f64(distSq + i, vaddq_f64(vmulq_f64(rx, rx), vmulq_f64(ry, ry)));
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    double t = (ptx - p0x[i]) * dx[i] + (pty - p0y[i]) * dy[i];
+    t = min(max(t, 0.0), len[i]);
+
+    double const px = p0x[i] + dx[i] * t;
+    double const py = p0y[i] + dy[i] * t;
+    projX[i] = px;
+    projY[i] = py;
+    distSq[i] = (ptx - px) * (ptx - px) + (pty - py) * (pty - py);
+  }
+}
+}  // namespace
+
+void PackedSegments::Assign(vector<PointD> const & points)
+{
+  size_t const count = points.empty() ? 0 : points.size() - 1;
+  m_p0x.resize(count);
+  m_p0y.resize(count);
+  m_dx.resize(count);
+  m_dy.resize(count);
+  m_len.resize(count);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    m_p0x[i] = points[i].x;
+    m_p0y[i] = points[i].y;
+
+    PointD d = points[i + 1] - points[i];
+    double const len = sqrt(DotProduct(d, d));
+    if (my::AlmostEqualULPs(len, 0.0))
+      d = PointD::Zero();
+    else
+      d = d / len;
+
+    m_dx[i] = d.x;
+    m_dy[i] = d.y;
+    m_len[i] = len;
+  }
+}
+
+void PackedSegments::ProjectPoint(PointD const & pt, size_t begin, size_t end,
+                                  vector<double> & projX, vector<double> & projY,
+                                  vector<double> & distSq) const
+{
+  ASSERT_LESS_OR_EQUAL(begin, end, ());
+  ASSERT_LESS_OR_EQUAL(end, GetCount(), ());
+
+  size_t const count = end - begin;
+  projX.resize(count);
+  projY.resize(count);
+  distSq.resize(count);
+  if (count == 0)
+    return;
+
+  ProjectKernel(pt.x, pt.y, count, m_p0x.data() + begin, m_p0y.data() + begin,
+                m_dx.data() + begin, m_dy.data() + begin, m_len.data() + begin, projX.data(),
+                projY.data(), distSq.data());
+}
+
+size_t PackedSegments::GetNearest(PointD const & pt, size_t begin, size_t end,
+                                  double & distSq) const
+{
+  ASSERT_LESS_OR_EQUAL(begin, end, ());
+  ASSERT_LESS_OR_EQUAL(end, GetCount(), ());
+
+  size_t best = end;
+  double bestDistSq = numeric_limits<double>::max();
+  for (size_t i = begin; i < end; ++i)
+  {
+    double t = (pt.x - m_p0x[i]) * m_dx[i] + (pt.y - m_p0y[i]) * m_dy[i];
+    t = min(max(t, 0.0), m_len[i]);
+
+    double const rx = pt.x - (m_p0x[i] + m_dx[i] * t);
+    double const ry = pt.y - (m_p0y[i] + m_dy[i] * t);
+    double const d = rx * rx + ry * ry;
+    if (d < bestDistSq)
+    {
+      bestDistSq = d;
+      best = i;
+    }
+  }
+
+  distSq = bestDistSq;
+  return best;
+}
+
+void PackedSegments::Swap(PackedSegments & rhs)
+{
+  m_p0x.swap(rhs.m_p0x);
+  m_p0y.swap(rhs.m_p0y);
+  m_dx.swap(rhs.m_dx);
+  m_dy.swap(rhs.m_dy);
+  m_len.swap(rhs.m_len);
+}
+}  // namespace m2
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "geometry/point2d.hpp"
+
+#include "std/vector.hpp"
+
+namespace m2
+{
+/// Struct-of-arrays copy of polyline segments for projecting one point onto many
+/// segments at once. The packed layout turns the per-segment projection
+/// (see ProjectionToSection) into a branchless kernel over contiguous doubles:
+/// the hottest part runs on SSE2 where available and autovectorizes elsewhere.
+class PackedSegments
+{
+public:
+  /// Packs segments [points[i], points[i + 1]) of a polyline.
+  void Assign(vector<PointD> const & points);
+
+  size_t GetCount() const { return m_p0x.size(); }
+
+  /// Projects |pt| onto every segment in [begin, end), clamped to the segment as
+  /// in ProjectionToSection. Output vectors are resized to end - begin;
+  /// projX/projY hold the projection and distSq its squared distance to |pt|.
+  void ProjectPoint(PointD const & pt, size_t begin, size_t end, vector<double> & projX,
+                    vector<double> & projY, vector<double> & distSq) const;
+
+  /// Returns the index of the segment in [begin, end) nearest to |pt| (its squared
+  /// distance goes to |distSq|), or |end| if the range is empty.
+  size_t GetNearest(PointD const & pt, size_t begin, size_t end, double & distSq) const;
+
+  void Swap(PackedSegments & rhs);
+
+private:
+  // Segment start points, normalized directions and lengths. A degenerate
+  // segment keeps a zero direction, so its projection sticks to the start point.
+  vector<double> m_p0x;
+  vector<double> m_p0y;
+  vector<double> m_dx;
+  vector<double> m_dy;
+  vector<double> m_len;
+};
+}  // namespace m2
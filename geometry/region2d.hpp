@@ -136,6 +136,7 @@ namespace m2
     {
       m_points.push_back(pt);
       m_rect.Add(pt);
+      ResetContainsIndex();
     }
 
     template <class TFunctor>
@@ -152,6 +153,10 @@ namespace m2
     {
       m_points.swap(rhs.m_points);
       std::swap(m_rect, rhs.m_rect);
+      m_slabStart.swap(rhs.m_slabStart);
+      m_slabEdges.swap(rhs.m_slabEdges);
+      std::swap(m_slabMinY, rhs.m_slabMinY);
+      std::swap(m_slabScale, rhs.m_slabScale);
     }
 
     ContainerT Data() const { return m_points; }
@@ -187,6 +192,58 @@ namespace m2
 
   public:
 
+    /// Builds the horizontal-slab edge index Contains() queries: only the edges
+    /// whose y-range covers the point's slab take part in the ray casting. It is
+    /// built lazily on the first Contains() call for a large region; call it up
+    /// front when one region is shared between threads.
+    void BuildContainsIndex() const
+    {
+      size_t const n = m_points.size();
+      if (n < kContainsIndexThreshold || !m_slabStart.empty())
+        return;
+
+      double const minY = static_cast<double>(m_rect.minY());
+      double const maxY = static_cast<double>(m_rect.maxY());
+      if (!(maxY > minY))
+        return;
+
+      size_t const slabCount = min(n / 4, size_t(kMaxContainsSlabs));
+      m_slabMinY = minY;
+      m_slabScale = slabCount / (maxY - minY);
+
+      // Expand edges by the comparison precision, so equal-with-precision vertex
+      // checks at slab borders still see their edge.
+      double const eps = detail::DefEqualFloat::kPrecision;
+
+      vector<uint32_t> start(slabCount + 1, 0);
+      for (size_t i = 0; i < n; ++i)
+      {
+        double const y1 = static_cast<double>(m_points[i == 0 ? n - 1 : i - 1].y);
+        double const y2 = static_cast<double>(m_points[i].y);
+        size_t const s1 = SlabOf(min(y1, y2) - eps, slabCount);
+        size_t const s2 = SlabOf(max(y1, y2) + eps, slabCount);
+        for (size_t s = s1; s <= s2; ++s)
+          ++start[s + 1];
+      }
+
+      for (size_t s = 1; s <= slabCount; ++s)
+        start[s] += start[s - 1];
+
+      m_slabEdges.resize(start[slabCount]);
+      vector<uint32_t> cursor(start.begin(), start.end() - 1);
+      for (size_t i = 0; i < n; ++i)
+      {
+        double const y1 = static_cast<double>(m_points[i == 0 ? n - 1 : i - 1].y);
+        double const y2 = static_cast<double>(m_points[i].y);
+        size_t const s1 = SlabOf(min(y1, y2) - eps, slabCount);
+        size_t const s2 = SlabOf(max(y1, y2) + eps, slabCount);
+        for (size_t s = s1; s <= s2; ++s)
+          m_slabEdges[cursor[s]++] = static_cast<uint32_t>(i);
+      }
+
+      m_slabStart.swap(start);
+    }
+
     /// Taken from Computational Geometry in C and modified
     template <class TEqualF>
     bool Contains(PointT const & pt, TEqualF equalF) const
@@ -194,6 +251,8 @@ namespace m2
       if (!m_rect.IsPointInside(pt))
         return false;
 
+      BuildContainsIndex();
+
       int rCross = 0; /* number of right edge/ray crossings */
       int lCross = 0; /* number of left edge/ray crossings */
 
@@ -202,38 +261,32 @@ namespace m2
       typedef typename TraitsT::BigType BigCoordT;
       typedef Point<BigCoordT> BigPointT;
 
-      BigPointT prev = BigPointT(m_points[numPoints - 1]) - BigPointT(pt);
-      for (size_t i = 0; i < numPoints; ++i)
+      if (!m_slabStart.empty())
       {
-        if (equalF.EqualPoints(m_points[i], pt))
-          return true;
-
-        BigPointT const curr = BigPointT(m_points[i]) - BigPointT(pt);
-
-        bool const rCheck = ((curr.y > 0) != (prev.y > 0));
-        bool const lCheck = ((curr.y < 0) != (prev.y < 0));
-
-        if (rCheck || lCheck)
+        size_t const slab = SlabOf(static_cast<double>(pt.y), m_slabStart.size() - 1);
+        for (uint32_t k = m_slabStart[slab]; k < m_slabStart[slab + 1]; ++k)
         {
-          ASSERT_NOT_EQUAL ( curr.y, prev.y, () );
-
-          BigCoordT const delta = prev.y - curr.y;
-          BigCoordT const cp = CrossProduct(curr, prev);
-
-          // Squared precision is needed here because of comparison between cross product of two
-          // vectors and zero. It's impossible to compare them relatively, so they're compared
-          // absolutely, and, as cross product is proportional to product of lengths of both
-          // operands precision must be squared too.
-          if (!equalF.EqualZeroSquarePrecision(cp))
-          {
-            bool const PrevGreaterCurr = delta > 0.0;
-
-            if (rCheck && ((cp > 0) == PrevGreaterCurr)) ++rCross;
-            if (lCheck && ((cp > 0) != PrevGreaterCurr)) ++lCross;
-          }
+          size_t const i = m_slabEdges[k];
+          if (equalF.EqualPoints(m_points[i], pt))
+            return true;
+
+          BigPointT const prev = BigPointT(m_points[i == 0 ? numPoints - 1 : i - 1]) - BigPointT(pt);
+          BigPointT const curr = BigPointT(m_points[i]) - BigPointT(pt);
+          UpdateCrossings(prev, curr, equalF, rCross, lCross);
         }
+      }
+      else
+      {
+        BigPointT prev = BigPointT(m_points[numPoints - 1]) - BigPointT(pt);
+        for (size_t i = 0; i < numPoints; ++i)
+        {
+          if (equalF.EqualPoints(m_points[i], pt))
+            return true;
 
-        prev = curr;
+          BigPointT const curr = BigPointT(m_points[i]) - BigPointT(pt);
+          UpdateCrossings(prev, curr, equalF, rCross, lCross);
+          prev = curr;
+        }
       }
 
       /* q on the edge if left and right cross are not the same parity. */
@@ -308,11 +361,72 @@ namespace m2
       m_rect.MakeEmpty();
       for (size_t i = 0; i < m_points.size(); ++i)
         m_rect.Add(m_points[i]);
+      ResetContainsIndex();
     }
 
+    void ResetContainsIndex()
+    {
+      m_slabStart.clear();
+      m_slabEdges.clear();
+    }
+
+    static size_t SlabOf(double y, size_t slabCount, double minY, double scale)
+    {
+      double const s = (y - minY) * scale;
+      if (s <= 0.0)
+        return 0;
+      if (s >= static_cast<double>(slabCount))
+        return slabCount - 1;
+      return static_cast<size_t>(s);
+    }
+
+    size_t SlabOf(double y, size_t slabCount) const
+    {
+      return SlabOf(y, slabCount, m_slabMinY, m_slabScale);
+    }
+
+    template <class TEqualF, class BigPointT>
+    static void UpdateCrossings(BigPointT const & prev, BigPointT const & curr,
+                                TEqualF const & equalF, int & rCross, int & lCross)
+    {
+      bool const rCheck = ((curr.y > 0) != (prev.y > 0));
+      bool const lCheck = ((curr.y < 0) != (prev.y < 0));
+
+      if (rCheck || lCheck)
+      {
+        ASSERT_NOT_EQUAL ( curr.y, prev.y, () );
+
+        auto const delta = prev.y - curr.y;
+        auto const cp = CrossProduct(curr, prev);
+
+        // Squared precision is needed here because of comparison between cross product of two
+        // vectors and zero. It's impossible to compare them relatively, so they're compared
+        // absolutely, and, as cross product is proportional to product of lengths of both
+        // operands precision must be squared too.
+        if (!equalF.EqualZeroSquarePrecision(cp))
+        {
+          bool const PrevGreaterCurr = delta > 0.0;
+
+          if (rCheck && ((cp > 0) == PrevGreaterCurr)) ++rCross;
+          if (lCheck && ((cp > 0) != PrevGreaterCurr)) ++lCross;
+        }
+      }
+    }
+
+    static size_t constexpr kContainsIndexThreshold = 512;
+    static size_t constexpr kMaxContainsSlabs = 1024;
+
     ContainerT m_points;
     m2::Rect<CoordT> m_rect;
 
+    // Horizontal-slab edge index for Contains(): edge i is
+    // (m_points[i - 1 or last], m_points[i]), ids grouped by slab. Empty until
+    // BuildContainsIndex() runs; mutation resets it.
+    mutable vector<uint32_t> m_slabStart;
+    mutable vector<uint32_t> m_slabEdges;
+    mutable double m_slabMinY = 0.0;
+    mutable double m_slabScale = 0.0;
+
     template <class T> friend string DebugPrint(Region<T> const &);
   };
 
@@ -327,6 +441,7 @@ namespace m2
   {
     ar >> region.m_rect;
     ar >> region.m_points;
+    region.ResetContainsIndex();
     return ar;
   }
 
@@ -132,7 +132,7 @@ double ScreenBase::CalculatePerspectiveAngle(double scale) const
 void ScreenBase::SetAutoPerspective(bool isAutoPerspective)
 {
   m_isAutoPerspective = isAutoPerspective;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::SetFromRects(m2::AnyRectD const & glbRect, m2::RectD const & pxRect)
@@ -144,11 +144,12 @@ void ScreenBase::SetFromRects(m2::AnyRectD const & glbRect, m2::RectD const & px
   m_Angle = glbRect.Angle();
   m_Org = glbRect.GlobalCenter();
 
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::SetFromRect(m2::AnyRectD const & glbRect)
 {
+  CheckDependentParameters();
   SetFromRects(glbRect, m_PixelRect);
 }
 
@@ -157,7 +158,7 @@ void ScreenBase::SetFromParams(m2::PointD const & org, double angle, double scal
   m_Scale = scale;
   m_Angle = angle;
   m_Org = org;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::MatchGandP(m2::PointD const & g, m2::PointD const & p)
@@ -175,37 +176,37 @@ void ScreenBase::MatchGandP3d(m2::PointD const & g, m2::PointD const &p3d)
 void ScreenBase::SetOrg(m2::PointD const & p)
 {
   m_Org = p;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::Move(double dx, double dy)
 {
   m_Org = PtoG(GtoP(m_Org) - m2::PointD(dx, dy));
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::MoveG(m2::PointD const & p)
 {
   m_Org -= p;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::Scale(double scale)
 {
   m_Scale /= scale;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::Rotate(double angle)
 {
   m_Angle = ang::AngleD(m_Angle.val() + angle);
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::OnSize(m2::RectI const & r)
 {
   m_ViewportRect = m2::RectD(r);
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::OnSize(int x0, int y0, int w, int h)
@@ -216,22 +217,24 @@ void ScreenBase::OnSize(int x0, int y0, int w, int h)
 void ScreenBase::SetScale(double scale)
 {
   m_Scale = scale;
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::SetAngle(double angle)
 {
   m_Angle = ang::AngleD(angle);
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 int ScreenBase::GetWidth() const
 {
+  CheckDependentParameters();
   return my::rounds(m_PixelRect.SizeX());
 }
 
 int ScreenBase::GetHeight() const
 {
+  CheckDependentParameters();
   return my::rounds(m_PixelRect.SizeY());
 }
 
@@ -262,6 +265,9 @@ ScreenBase::CalcTransform(m2::PointD const & oldPt1, m2::PointD const & oldPt2,
 
 void ScreenBase::SetGtoPMatrix(MatrixT const & m)
 {
+  // m_PixelRect is read below, before the matrices are replaced.
+  CheckDependentParameters();
+
   m_GtoP = m;
   m_PtoG = math::Inverse(m_GtoP);
   /// Extracting transformation params, assuming that the matrix
@@ -273,7 +279,7 @@ void ScreenBase::SetGtoPMatrix(MatrixT const & m)
   m_Scale = 1 / s;
   m_Org = PtoG(m_PixelRect.Center());
 
-  UpdateDependentParameters();
+  InvalidateDependentParameters();
 }
 
 void ScreenBase::GtoP(m2::RectD const & glbRect, m2::RectD & pxRect) const
@@ -365,6 +371,8 @@ void ScreenBase::ApplyPerspective(double currentRotationAngle, double maxRotatio
   ASSERT_GREATER_OR_EQUAL(maxRotationAngle, 0.0, ());
   ASSERT_LESS(maxRotationAngle, math::pi2, ());
 
+  CheckDependentParameters();
+
   m_isPerspective = true;
   m_isAutoPerspective = false;
 
@@ -386,6 +394,8 @@ void ScreenBase::ApplyPerspective(double currentRotationAngle, double maxRotatio
 // orthogonal projection does and rotate the map plane around its near horizontal side.
 void ScreenBase::SetRotationAngle(double rotationAngle)
 {
+  CheckDependentParameters();
+
   ASSERT(rotationAngle == 0.0 || (rotationAngle > 0.0 && m_isPerspective), ());
   ASSERT_GREATER_OR_EQUAL(rotationAngle, 0.0, ());
   ASSERT_LESS_OR_EQUAL(rotationAngle, m_3dMaxAngleX, ());
@@ -430,6 +440,8 @@ void ScreenBase::SetRotationAngle(double rotationAngle)
 
 void ScreenBase::ResetPerspective()
 {
+  CheckDependentParameters();
+
   m_isPerspective = false;
   m_isAutoPerspective = false;
 
@@ -449,12 +461,14 @@ m2::PointD ScreenBase::PtoP3d(m2::PointD const & pt) const
 
 double ScreenBase::GetZScale() const
 {
+  CheckDependentParameters();
   double const averageScale3d = m_isPerspective ? 2.7 : 1.0;
   return 2.0 / (m_Scale * m_ViewportRect.SizeY() * averageScale3d);
 }
 
 m2::PointD ScreenBase::PtoP3d(m2::PointD const & pt, double ptZ) const
 {
+  CheckDependentParameters();
   if (!m_isPerspective)
     return pt;
   Vector3dT const normalizedPoint{float(2.0 * pt.x / m_PixelRect.SizeX() - 1.0),
@@ -473,6 +487,7 @@ m2::PointD ScreenBase::PtoP3d(m2::PointD const & pt, double ptZ) const
 
 m2::PointD ScreenBase::P3dtoP(m2::PointD const & pt) const
 {
+  CheckDependentParameters();
   if (!m_isPerspective)
     return pt;
 
@@ -507,6 +522,7 @@ m2::PointD ScreenBase::P3dtoP(m2::PointD const & pt) const
 
 bool ScreenBase::IsReverseProjection3d(m2::PointD const & pt) const
 {
+  CheckDependentParameters();
   if (!m_isPerspective)
     return false;
 
@@ -519,6 +535,7 @@ bool ScreenBase::IsReverseProjection3d(m2::PointD const & pt) const
 
 ScreenBase::Matrix3dT ScreenBase::GetModelView() const
 {
+  CheckDependentParameters();
   return ScreenBase::Matrix3dT
   {
     m_GtoP(0, 0), m_GtoP(1, 0), 0, m_GtoP(2, 0),
@@ -530,6 +547,7 @@ ScreenBase::Matrix3dT ScreenBase::GetModelView() const
 
 ScreenBase::Matrix3dT ScreenBase::GetModelView(m2::PointD const & pivot, double scalar) const
 {
+  CheckDependentParameters();
   MatrixT const & m = m_GtoP;
   double const s = 1.0 / scalar;
   return ScreenBase::Matrix3dT
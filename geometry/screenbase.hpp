@@ -55,9 +55,27 @@ protected:
   Matrix3dT m_3dtoP;
 
   // Update dependent parameters from base parameters.
-  // Must be called when base parameters changed.
   void UpdateDependentParameters();
 
+  // The dependent parameters are recomputed lazily: setters only mark them
+  // invalid and the first reader rebuilds them, so a chain of setters
+  // (e.g. a pinch frame composing scale, rotation and offset) pays for one
+  // matrix build instead of one per setter.
+  void InvalidateDependentParameters() { m_needUpdateDependentParameters = true; }
+
+  // Must be called before any dependent parameter is read.
+  void CheckDependentParameters() const
+  {
+    if (m_needUpdateDependentParameters)
+    {
+      // Drop the flag first: UpdateDependentParameters reads the matrices itself.
+      m_needUpdateDependentParameters = false;
+      const_cast<ScreenBase *>(this)->UpdateDependentParameters();
+    }
+  }
+
+  mutable bool m_needUpdateDependentParameters = false;
+
 public:
   ScreenBase();
   ScreenBase(m2::RectI const & pxRect, m2::AnyRectD const & glbRect);
@@ -93,16 +111,19 @@ public:
 
   inline m2::PointD GtoP(m2::PointD const & pt) const
   {
+    CheckDependentParameters();
     return pt * m_GtoP;
   }
 
   inline m2::PointD PtoG(m2::PointD const & pt) const
   {
+    CheckDependentParameters();
     return pt * m_PtoG;
   }
 
   inline void GtoP(double & x, double & y) const
   {
+    CheckDependentParameters();
     double tempX = x;
     x = tempX * m_GtoP(0, 0) + y * m_GtoP(1, 0) + m_GtoP(2, 0);
     y = tempX * m_GtoP(1, 0) + y * m_GtoP(1, 1) + m_GtoP(2, 1);
@@ -110,6 +131,7 @@ public:
 
   inline void PtoG(double & x, double & y) const
   {
+    CheckDependentParameters();
     double tempX = x;
     x = tempX * m_PtoG(0, 0) + y * m_PtoG(1, 0) + m_PtoG(2, 0);
     y = tempX * m_PtoG(0, 1) + y * m_PtoG(1, 1) + m_PtoG(2, 1);
@@ -125,29 +147,29 @@ public:
   void GetTouchRect(m2::PointD const & pixPoint, double const pxWidth,
                     double const pxHeight, m2::AnyRectD & glbRect) const;
 
-  MatrixT const & GtoPMatrix() const { return m_GtoP; }
-  MatrixT const & PtoGMatrix() const { return m_PtoG; }
+  MatrixT const & GtoPMatrix() const { CheckDependentParameters(); return m_GtoP; }
+  MatrixT const & PtoGMatrix() const { CheckDependentParameters(); return m_PtoG; }
 
-  m2::RectD const & PixelRect() const { return m_PixelRect; }
-  m2::AnyRectD const & GlobalRect() const { return m_GlobalRect; }
-  m2::RectD const & ClipRect() const { return m_ClipRect; }
+  m2::RectD const & PixelRect() const { CheckDependentParameters(); return m_PixelRect; }
+  m2::AnyRectD const & GlobalRect() const { CheckDependentParameters(); return m_GlobalRect; }
+  m2::RectD const & ClipRect() const { CheckDependentParameters(); return m_ClipRect; }
 
   void ApplyPerspective(double currentRotationAngle, double maxRotationAngle, double angleFOV);
   void ResetPerspective();
 
   void SetRotationAngle(double rotationAngle);
-  double GetRotationAngle() const { return m_3dAngleX; }
-  double GetMaxRotationAngle() const { return m_3dMaxAngleX; }
+  double GetRotationAngle() const { CheckDependentParameters(); return m_3dAngleX; }
+  double GetMaxRotationAngle() const { CheckDependentParameters(); return m_3dMaxAngleX; }
   double GetAngleFOV() const { return m_3dFOV; }
-  double GetScale3d() const { return m_3dScale; }
+  double GetScale3d() const { CheckDependentParameters(); return m_3dScale; }
   double GetZScale() const;
 
-  double GetDepth3d() const { return m_3dFarZ - m_3dNearZ; }
+  double GetDepth3d() const { CheckDependentParameters(); return m_3dFarZ - m_3dNearZ; }
 
   m2::PointD P3dtoP(m2::PointD const & pt) const;
 
-  Matrix3dT const & Pto3dMatrix() const { return m_Pto3d; }
-  bool isPerspective() const { return m_isPerspective; }
+  Matrix3dT const & Pto3dMatrix() const { CheckDependentParameters(); return m_Pto3d; }
+  bool isPerspective() const { CheckDependentParameters(); return m_isPerspective; }
   bool isAutoPerspective() const { return m_isAutoPerspective; }
   void SetAutoPerspective(bool isAutoPerspective);
 
@@ -190,6 +212,8 @@ public:
 
   bool operator == (ScreenBase const & src) const
   {
+    CheckDependentParameters();
+    src.CheckDependentParameters();
     return (m_GtoP == src.m_GtoP) && (m_PtoG == src.m_PtoG);
   }
 };
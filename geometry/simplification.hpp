@@ -5,6 +5,9 @@
 
 #include "std/iterator.hpp"
 #include "std/algorithm.hpp"
+#include "std/functional.hpp"
+#include "std/limits.hpp"
+#include "std/queue.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
 
@@ -156,3 +159,72 @@ public:
     m_vec.push_back(p);
   }
 };
+
+// Computes for every point the error of eliminating it: points are removed one by
+// one, cheapest first (Visvalingam-style), with the cost measured by |dist| against
+// the line of the point's current neighbors - the same squared-distance metric the
+// simplifiers above threshold with. Tolerances are made monotone in removal order,
+// so filtering with any epsilon yields a consistent polyline and all scale levels
+// can be emitted from this single pass. The first and the last point (and points
+// |dist| declares unremovable) get numeric_limits<double>::max().
+template <typename DistanceF, typename PointsContainerT>
+void CalcSimplificationTolerances(PointsContainerT const & points, DistanceF & dist,
+                                  vector<double> & tolerances)
+{
+  size_t const n = points.size();
+  tolerances.assign(n, numeric_limits<double>::max());
+  if (n <= 2)
+    return;
+
+  vector<size_t> prevPt(n), nextPt(n);
+  vector<double> cost(n, numeric_limits<double>::max());
+  for (size_t i = 0; i < n; ++i)
+  {
+    prevPt[i] = i - 1;  // Unused for i == 0.
+    nextPt[i] = i + 1;
+  }
+
+  auto const calcCost = [&](size_t i)
+  {
+    dist.SetBounds(points[prevPt[i]], points[nextPt[i]]);
+    return dist(points[i]);
+  };
+
+  // Min-heap with lazy invalidation: an entry is stale if its cost differs from
+  // cost[i] or the point is already removed.
+  priority_queue<pair<double, size_t>, vector<pair<double, size_t>>,
+                 greater<pair<double, size_t>>> queue;
+  for (size_t i = 1; i + 1 < n; ++i)
+  {
+    cost[i] = calcCost(i);
+    if (cost[i] < numeric_limits<double>::max())
+      queue.push(make_pair(cost[i], i));
+  }
+
+  double maxTolerance = 0.0;
+  while (!queue.empty())
+  {
+    double const c = queue.top().first;
+    size_t const i = queue.top().second;
+    queue.pop();
+    if (c != cost[i] || tolerances[i] != numeric_limits<double>::max())
+      continue;
+
+    // Remove i: a coarser threshold removes everything a finer one did.
+    maxTolerance = max(maxTolerance, c);
+    tolerances[i] = maxTolerance;
+    nextPt[prevPt[i]] = nextPt[i];
+    prevPt[nextPt[i]] = prevPt[i];
+
+    size_t const neighbors[] = { prevPt[i], nextPt[i] };
+    for (size_t j : neighbors)
+    {
+      if (j == 0 || j + 1 >= n || tolerances[j] != numeric_limits<double>::max())
+        continue;
+
+      cost[j] = calcCost(j);
+      if (cost[j] < numeric_limits<double>::max())
+        queue.push(make_pair(cost[j], j));
+    }
+  }
+}
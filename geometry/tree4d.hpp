@@ -3,9 +3,13 @@
 #include "geometry/rect2d.hpp"
 #include "geometry/point2d.hpp"
 
+#include "base/assert.hpp"
 #include "base/stl_add.hpp"
 #include "base/logging.hpp"
 
+#include "std/functional.hpp"
+#include "std/iterator.hpp"
+#include "std/shared_ptr.hpp"
 #include "std/sstream.hpp"
 #include "std/vector.hpp"
 
@@ -14,6 +18,78 @@
 
 namespace m4
 {
+  namespace detail
+  {
+    /// Allocator for KDTree nodes that carves them out of contiguous chunks
+    /// and reuses freed slots through a free list. KDTree passes allocators
+    /// around by value, so all copies share one pool; the chunks are released
+    /// when the last copy goes away.
+    template <class T> class PoolAllocator
+    {
+      static size_t const kChunkCapacity = 1024;
+
+      struct Pool
+      {
+        vector<T *> m_chunks;
+        vector<T *> m_free;
+        size_t m_lastUsed;
+
+        Pool() : m_lastUsed(kChunkCapacity) {}
+
+        ~Pool()
+        {
+          for (T * chunk : m_chunks)
+            std::allocator<T>().deallocate(chunk, kChunkCapacity);
+        }
+
+        T * Take()
+        {
+          if (!m_free.empty())
+          {
+            T * const p = m_free.back();
+            m_free.pop_back();
+            return p;
+          }
+
+          if (m_lastUsed == kChunkCapacity)
+          {
+            m_chunks.push_back(std::allocator<T>().allocate(kChunkCapacity));
+            m_lastUsed = 0;
+          }
+          return m_chunks.back() + m_lastUsed++;
+        }
+
+        void Put(T * p) { m_free.push_back(p); }
+      };
+
+      shared_ptr<Pool> m_pool;
+
+    public:
+      typedef T value_type;
+      typedef T * pointer;
+      typedef size_t size_type;
+
+      PoolAllocator() : m_pool(make_shared<Pool>()) {}
+
+      pointer allocate(size_type n)
+      {
+        ASSERT_EQUAL ( n, 1, () );
+        return m_pool->Take();
+      }
+
+      void deallocate(pointer p, size_type n)
+      {
+        ASSERT_EQUAL ( n, 1, () );
+        m_pool->Put(p);
+      }
+
+      void destroy(pointer p) { p->~T(); }
+
+      bool operator==(PoolAllocator const & r) const { return m_pool == r.m_pool; }
+      bool operator!=(PoolAllocator const & r) const { return m_pool != r.m_pool; }
+    };
+  }
+
   template <typename T>
   struct TraitsDef
   {
@@ -80,7 +156,9 @@ namespace m4
       m2::RectD GetRect() const { return m2::RectD(m_pts[0], m_pts[1], m_pts[2], m_pts[3]); }
     };
 
-    typedef KDTree::KDTree<4, ValueT> TreeT;
+    typedef KDTree::KDTree<4, ValueT, KDTree::_Bracket_accessor<ValueT>,
+                           KDTree::squared_difference<double, double>, less<double>,
+                           detail::PoolAllocator<KDTree::_Node<ValueT> > > TreeT;
     TreeT m_tree;
 
     // Do-class for rect-iteration in tree.
@@ -154,6 +232,22 @@ namespace m4
       m_tree.insert(ValueT(move(obj), rect));
     }
 
+    /// Clears the tree and rebuilds it balanced from the given range of
+    /// objects. Prefer it to a run of Add calls for read-mostly containers
+    /// filled once: inserting never rebalances, so sorted input degenerates
+    /// the tree into a list, while the bulk build also packs the nodes
+    /// contiguously in the arena.
+    template <class IterT>
+    void Assign(IterT beg, IterT end)
+    {
+      vector<ValueT> values;
+      values.reserve(distance(beg, end));
+      for (; beg != end; ++beg)
+        values.push_back(ValueT(*beg, GetLimitRect(*beg)));
+
+      m_tree.efficient_replace_and_optimise(values);
+    }
+
   private:
     template <class CompareT>
     void ReplaceImpl(T const & obj, m2::RectD const & rect, CompareT comp)
@@ -0,0 +1,96 @@
+#include "indexer/categories_cbv.hpp"
+
+#include "defines.hpp"
+
+#include "coding/file_container.hpp"
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+#include "coding/write_to_sink.hpp"
+#include "coding/writer.hpp"
+
+#include "base/logging.hpp"
+#include "base/stl_helpers.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/utility.hpp"
+
+namespace search
+{
+// static
+unique_ptr<CategoriesCBV> CategoriesCBV::Load(FilesContainerR const & cont)
+{
+  if (!cont.IsExist(CATEGORIES_CBVS_FILE_TAG))
+    return unique_ptr<CategoriesCBV>();
+
+  try
+  {
+    ReaderSource<ModelReaderPtr> src(cont.GetReader(CATEGORIES_CBVS_FILE_TAG));
+
+    uint8_t const version = ReadPrimitiveFromSource<uint8_t>(src);
+    if (version != V0)
+    {
+      LOG(LWARNING, ("Unknown categories section version:", version));
+      return unique_ptr<CategoriesCBV>();
+    }
+
+    unique_ptr<CategoriesCBV> result(new CategoriesCBV());
+    uint32_t const count = ReadVarUint<uint32_t>(src);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      uint32_t const typeIndex = ReadVarUint<uint32_t>(src);
+      uint32_t const blobSize = ReadVarUint<uint32_t>(src);
+      if (blobSize > src.Size())
+      {
+        LOG(LWARNING, ("Truncated categories section in", cont.GetFileName()));
+        return unique_ptr<CategoriesCBV>();
+      }
+      result->m_cbvs[typeIndex] = coding::CompressedBitVectorBuilder::DeserializeFromSource(src);
+    }
+    return result;
+  }
+  catch (Reader::Exception const & ex)
+  {
+    LOG(LWARNING, ("Can't read categories section:", cont.GetFileName(), ex.Msg()));
+    return unique_ptr<CategoriesCBV>();
+  }
+}
+
+// static
+void CategoriesCBV::Serialize(Writer & writer, map<uint32_t, vector<uint64_t>> && typeToFeatures)
+{
+  WriteToSink(writer, static_cast<uint8_t>(V0));
+  WriteVarUint(writer, static_cast<uint32_t>(typeToFeatures.size()));
+  for (auto & entry : typeToFeatures)
+  {
+    my::SortUnique(entry.second);
+    auto const cbv = coding::CompressedBitVectorBuilder::FromBitPositions(move(entry.second));
+
+    WriteVarUint(writer, entry.first);
+
+    // The blob is serialized into a buffer first to prefix it with its
+    // size, which lets readers skip unneeded entries.
+    vector<char> buffer;
+    MemWriter<vector<char>> blobWriter(buffer);
+    cbv->Serialize(blobWriter);
+    WriteVarUint(writer, static_cast<uint32_t>(buffer.size()));
+    writer.Write(buffer.data(), buffer.size());
+  }
+}
+
+coding::CompressedBitVector const * CategoriesCBV::Get(uint32_t typeIndex) const
+{
+  auto const it = m_cbvs.find(typeIndex);
+  return it == m_cbvs.end() ? nullptr : it->second.get();
+}
+
+unique_ptr<coding::CompressedBitVector> CategoriesCBV::Take(uint32_t typeIndex)
+{
+  auto const it = m_cbvs.find(typeIndex);
+  if (it == m_cbvs.end())
+    return unique_ptr<coding::CompressedBitVector>();
+
+  auto result = move(it->second);
+  m_cbvs.erase(it);
+  return result;
+}
+}  // namespace search
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "coding/compressed_bit_vector.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/map.hpp"
+#include "std/unique_ptr.hpp"
+#include "std/vector.hpp"
+
+class FilesContainerR;
+class Writer;
+
+namespace search
+{
+// Per-category-type feature bit vectors, persisted as the "catcbv" mwm
+// section by the search index builder. The section duplicates the
+// category part of the search index: a type's bit vector holds exactly
+// the features the search trie returns for the corresponding category
+// token, so consumers retrieving features by category can skip the trie
+// altogether. Readers must fall back to the trie when the section is
+// absent (older mwms).
+//
+// Section format:
+//   version      : uint8, must be 0
+//   count        : VarUint32, number of per-type entries
+//   count times:
+//     type index : VarUint32, classificator type index (see
+//                  Classificator::GetIndexForType), the same key the
+//                  search trie uses for category tokens
+//     blob size  : VarUint32
+//     blob       : serialized coding::CompressedBitVector
+class CategoriesCBV
+{
+public:
+  enum Version
+  {
+    V0 = 0,
+    VERSION_COUNT
+  };
+
+  // Reads the whole section from |cont|. Returns nullptr when the
+  // section is absent or its header is damaged.
+  static unique_ptr<CategoriesCBV> Load(FilesContainerR const & cont);
+
+  // Serializes per-type feature lists. |typeToFeatures| maps a
+  // classificator type index to the features indexed with the
+  // corresponding category token; the lists do not need to be sorted.
+  static void Serialize(Writer & writer, map<uint32_t, vector<uint64_t>> && typeToFeatures);
+
+  // Returns the bit vector of features indexed with the category
+  // |typeIndex| or nullptr when no feature has this category.
+  coding::CompressedBitVector const * Get(uint32_t typeIndex) const;
+
+  // Moves the bit vector for |typeIndex| out of the index; returns
+  // nullptr when no feature has this category.
+  unique_ptr<coding::CompressedBitVector> Take(uint32_t typeIndex);
+
+private:
+  CategoriesCBV() = default;
+
+  map<uint32_t, unique_ptr<coding::CompressedBitVector>> m_cbvs;
+};
+}  // namespace search
@@ -188,7 +188,8 @@ CategoriesHolder::CategoriesHolder(unique_ptr<Reader> && reader)
   LoadFromStream(s);
 }
 
-void CategoriesHolder::AddCategory(Category & cat, vector<uint32_t> & types)
+void CategoriesHolder::AddCategory(Category & cat, vector<uint32_t> & types,
+                                   vector<pair<String, uint32_t>> & name2type)
 {
   if (!cat.m_synonyms.empty() && !types.empty())
   {
@@ -215,7 +216,7 @@ void CategoriesHolder::AddCategory(Category & cat, vector<uint32_t> & types)
         if (!ValidKeyToken(token))
           continue;
         for (uint32_t const t : types)
-          m_name2type.Add(localePrefix + token, t);
+          name2type.emplace_back(localePrefix + token, t);
       }
     }
   }
@@ -250,6 +251,7 @@ void CategoriesHolder::LoadFromStream(istream & s)
   Category cat;
   vector<uint32_t> types;
   vector<string> currentGroups;
+  vector<pair<String, uint32_t>> name2type;
 
   int lineNumber = 0;
   while (s.good())
@@ -265,7 +267,7 @@ void CategoriesHolder::LoadFromStream(istream & s)
 
     if (state == EParseTypes)
     {
-      AddCategory(cat, types);
+      AddCategory(cat, types, name2type);
       currentGroups.clear();
 
       while (iter)
@@ -305,8 +307,13 @@ void CategoriesHolder::LoadFromStream(istream & s)
     }
   }
   // add last category
-  AddCategory(cat, types);
+  AddCategory(cat, types, name2type);
   TrimGroupTranslations(m_groupTranslations);
+
+  // The whole token set is known now, so the trie is built in one pass
+  // over the sorted pairs instead of per-token node insertions.
+  sort(name2type.begin(), name2type.end());
+  m_name2type.Assign(name2type.begin(), name2type.end());
 }
 
 bool CategoriesHolder::GetNameByType(uint32_t type, int8_t locale, string & name) const
@@ -49,10 +49,13 @@ public:
 
   using GroupTranslations = unordered_map<string, vector<Category::Name>>;
 
-private:
   using String = strings::UniString;
+  // Built once from all (locale-prefixed token, type) pairs when the
+  // categories file is loaded, so the arena-backed trie fits well here.
+  using Trie = my::PackedMemTrie<String, my::VectorValues<uint32_t>>;
+
+private:
   using Type2CategoryCont = multimap<uint32_t, shared_ptr<Category>>;
-  using Trie = my::MemTrie<String, my::VectorValues<uint32_t>>;
 
   Type2CategoryCont m_type2cat;
 
@@ -146,7 +149,8 @@ public:
   static string MapIntegerToLocale(int8_t code);
 
 private:
-  void AddCategory(Category & cat, vector<uint32_t> & types);
+  void AddCategory(Category & cat, vector<uint32_t> & types,
+                   vector<pair<String, uint32_t>> & name2type);
   static bool ValidKeyToken(String const & s);
 };
 
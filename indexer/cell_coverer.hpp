@@ -12,19 +12,30 @@
 constexpr int SPLIT_RECT_CELLS_COUNT = 512;
 
 template <typename BoundsT, typename CellIdT>
-inline size_t SplitRectCell(CellIdT const & id, m2::RectD const & rect,
+inline m2::RectD GetCellRect(CellIdT const & id)
+{
+  double minCellX, minCellY, maxCellX, maxCellY;
+  CellIdConverter<BoundsT, CellIdT>::GetCellBounds(id, minCellX, minCellY, maxCellX, maxCellY);
+  return {minCellX, minCellY, maxCellX, maxCellY};
+}
+
+template <typename BoundsT, typename CellIdT>
+inline size_t SplitRectCell(CellIdT const & id, m2::RectD const & cellRect, m2::RectD const & rect,
                             array<pair<CellIdT, m2::RectD>, 4> & result)
 {
   size_t index = 0;
+  // Children rects are the quadrants of the parent's rect (Child(i) adds i & 1
+  // in x and i & 2 in y), so deriving them from it saves a GetCellBounds bit
+  // walk per child.
+  m2::PointD const center = cellRect.Center();
   for (int8_t i = 0; i < 4; ++i)
   {
-    CellIdT const child = id.Child(i);
-    double minCellX, minCellY, maxCellX, maxCellY;
-    CellIdConverter<BoundsT, CellIdT>::GetCellBounds(child, minCellX, minCellY, maxCellX, maxCellY);
-
-    m2::RectD const childRect(minCellX, minCellY, maxCellX, maxCellY);
+    m2::RectD const childRect((i & 1) ? center.x : cellRect.minX(),
+                              (i & 2) ? center.y : cellRect.minY(),
+                              (i & 1) ? cellRect.maxX() : center.x,
+                              (i & 2) ? cellRect.maxY() : center.y);
     if (rect.IsIntersect(childRect))
-      result[index++] = {child, childRect};
+      result[index++] = {id.Child(i), childRect};
   }
   return index;
 }
@@ -43,29 +54,40 @@ inline void CoverRect(m2::RectD rect, size_t cellsCount, int maxDepth, vector<Ce
   CellIdT const commonCell = CellIdConverter<BoundsT, CellIdT>::Cover2PointsWithCell(
       rect.minX(), rect.minY(), rect.maxX(), rect.maxY());
 
-  priority_queue<CellIdT, buffer_vector<CellIdT, SPLIT_RECT_CELLS_COUNT>,
-                 typename CellIdT::GreaterLevelOrder>
-      cellQueue;
-  cellQueue.push(commonCell);
+  using TCell = pair<CellIdT, m2::RectD>;
+  struct GreaterLevelOrder
+  {
+    bool operator()(TCell const & l, TCell const & r) const
+    {
+      return typename CellIdT::GreaterLevelOrder()(l.first, r.first);
+    }
+  };
+
+  priority_queue<TCell, buffer_vector<TCell, SPLIT_RECT_CELLS_COUNT>, GreaterLevelOrder> cellQueue;
+  cellQueue.push({commonCell, GetCellRect<BoundsT, CellIdT>(commonCell)});
 
   maxDepth -= 1;
 
   while (!cellQueue.empty() && cellQueue.size() + result.size() < cellsCount)
   {
-    CellIdT id = cellQueue.top();
+    TCell cell = cellQueue.top();
     cellQueue.pop();
 
-    while (id.Level() > maxDepth)
-      id = id.Parent();
+    if (cell.first.Level() > maxDepth)
+    {
+      while (cell.first.Level() > maxDepth)
+        cell.first = cell.first.Parent();
+      cell.second = GetCellRect<BoundsT, CellIdT>(cell.first);
+    }
 
-    if (id.Level() == maxDepth)
+    if (cell.first.Level() == maxDepth)
     {
-      result.push_back(id);
+      result.push_back(cell.first);
       break;
     }
 
-    array<pair<CellIdT, m2::RectD>, 4> arr;
-    size_t const count = SplitRectCell<BoundsT>(id, rect, arr);
+    array<TCell, 4> arr;
+    size_t const count = SplitRectCell<BoundsT>(cell.first, cell.second, rect, arr);
 
     if (cellQueue.size() + result.size() + count <= cellsCount)
     {
@@ -74,27 +96,27 @@ inline void CoverRect(m2::RectD rect, size_t cellsCount, int maxDepth, vector<Ce
         if (rect.IsRectInside(arr[i].second))
           result.push_back(arr[i].first);
         else
-          cellQueue.push(arr[i].first);
+          cellQueue.push(arr[i]);
       }
     }
     else
     {
-      result.push_back(id);
+      result.push_back(cell.first);
     }
   }
 
   for (; !cellQueue.empty(); cellQueue.pop())
   {
-    CellIdT id = cellQueue.top();
-    while (id.Level() < maxDepth)
+    TCell cell = cellQueue.top();
+    while (cell.first.Level() < maxDepth)
     {
-      array<pair<CellIdT, m2::RectD>, 4> arr;
-      size_t const count = SplitRectCell<BoundsT>(id, rect, arr);
+      array<TCell, 4> arr;
+      size_t const count = SplitRectCell<BoundsT>(cell.first, cell.second, rect, arr);
       ASSERT_GREATER(count, 0, ());
       if (count > 1)
         break;
-      id = arr[0].first;
+      cell = arr[0];
     }
-    result.push_back(id);
+    result.push_back(cell.first);
   }
 }
@@ -161,17 +161,14 @@ public:
 
       m_reader.Read(m_header.m_deltasOffset + start, data.data(), data.size());
 
-      MemReader mreader(data.data(), data.size());
-      NonOwningReaderSource msource(mreader);
-
-      uint64_t delta = ReadVarUint<uint64_t>(msource);
-      entry[0] = DecodeDelta(delta, m_codingParams.GetBasePoint());
-
-      for (size_t i = 1; i < kBlockSize && msource.Size() > 0; ++i)
-      {
-        delta = ReadVarUint<uint64_t>(msource);
-        entry[i] = DecodeDelta(delta, entry[i - 1]);
-      }
+      uint64_t deltas[kBlockSize];
+      size_t const n = ReadVarUint64Block(data.data(), data.data() + data.size(), kBlockSize,
+                                          deltas);
+      ASSERT_GREATER(n, 0, ());
+
+      entry[0] = DecodeDelta(deltas[0], m_codingParams.GetBasePoint());
+      for (size_t i = 1; i < n; ++i)
+        entry[i] = DecodeDelta(deltas[i], entry[i - 1]);
     }
 
     center = PointU2PointD(entry[offset], m_codingParams.GetCoordBits());
@@ -433,6 +433,71 @@ void Classificator::Clear()
 {
   ClassifObject("world").Swap(m_root);
   m_mapping.Clear();
+  m_drawRulesKeys.clear();
+  m_drawRulesOffsets.clear();
+}
+
+namespace
+{
+size_t constexpr kDrawRulesScales = scales::UPPER_STYLE_SCALE + 1;
+size_t constexpr kDrawRulesGeomTypes = 3;
+
+size_t DrawRulesCell(uint32_t ind, int scale, feature::EGeomType ft)
+{
+  return (ind * kDrawRulesScales + scale) * kDrawRulesGeomTypes + ft;
+}
+}  // namespace
+
+void Classificator::BuildDrawRulesTable()
+{
+  size_t const count = m_mapping.GetCount();
+
+  m_drawRulesKeys.clear();
+  m_drawRulesOffsets.clear();
+  m_drawRulesOffsets.reserve(count * kDrawRulesScales * kDrawRulesGeomTypes + 1);
+
+  drule::KeysT keys;
+  for (uint32_t ind = 0; ind < count; ++ind)
+  {
+    ClassifObject const * const p = GetObject(m_mapping.GetType(ind));
+    for (int scale = 0; scale < static_cast<int>(kDrawRulesScales); ++scale)
+    {
+      for (size_t ft = 0; ft < kDrawRulesGeomTypes; ++ft)
+      {
+        m_drawRulesOffsets.push_back(static_cast<uint32_t>(m_drawRulesKeys.size()));
+
+        if (p == &m_root)
+          continue;
+
+        keys.clear();
+        p->GetSuitable(scale, feature::EGeomType(ft), keys);
+        m_drawRulesKeys.insert(m_drawRulesKeys.end(), keys.begin(), keys.end());
+      }
+    }
+  }
+  m_drawRulesOffsets.push_back(static_cast<uint32_t>(m_drawRulesKeys.size()));
+}
+
+void Classificator::GetSuitableRules(uint32_t type, int scale, feature::EGeomType ft,
+                                     drule::KeysT & keys) const
+{
+  ASSERT(HasDrawRulesTable(), ());
+  scale = min(scale, scales::GetUpperStyleScale());
+
+  uint32_t ind;
+  if (!m_mapping.TryGetIndex(type, ind))
+  {
+    // The table covers only indexed types; resolve the rest the usual way.
+    ClassifObject const * const p = GetObject(type);
+    if (p != &m_root)
+      p->GetSuitable(scale, ft, keys);
+    return;
+  }
+
+  size_t const cell = DrawRulesCell(ind, scale, ft);
+  ASSERT_LESS(cell + 1, m_drawRulesOffsets.size(), ());
+  for (uint32_t i = m_drawRulesOffsets[cell]; i < m_drawRulesOffsets[cell + 1]; ++i)
+    keys.push_back(m_drawRulesKeys[i]);
 }
 
 string Classificator::GetReadableObjectName(uint32_t type) const
@@ -161,6 +161,12 @@ class Classificator : private noncopyable
 
   uint32_t m_coastType;
 
+  /// Flat draw rules table data (see BuildDrawRulesTable). All keys are
+  /// stored in one vector; a cell (type index, zoom, geometry type) owns
+  /// the range [m_drawRulesOffsets[cell], m_drawRulesOffsets[cell + 1]).
+  vector<drule::Key> m_drawRulesKeys;
+  vector<uint32_t> m_drawRulesOffsets;
+
   static ClassifObject * AddV(ClassifObject * parent, string const & key, string const & value);
 
 public:
@@ -198,6 +204,18 @@ public:
   uint32_t GetTypeForIndex(uint32_t i) const { return m_mapping.GetType(i); }
   bool IsTypeValid(uint32_t t) const { return m_mapping.HasIndex(t); }
 
+  /// @name Flat draw rules table.
+  /// Maps (type index, zoom, geometry type) to the resolved draw rule keys,
+  /// so that per-feature rule resolution is a single probe instead of a
+  /// classificator tree walk. Built on style load, see classificator::Load.
+  //@{
+  void BuildDrawRulesTable();
+  bool HasDrawRulesTable() const { return !m_drawRulesOffsets.empty(); }
+  /// Appends the draw rule keys of |type| at |scale| to |keys|. Falls back
+  /// to the tree walk for types missing from the index mapping.
+  void GetSuitableRules(uint32_t type, int scale, feature::EGeomType ft, drule::KeysT & keys) const;
+  //@}
+
   inline uint32_t GetCoastType() const { return m_coastType; }
 
   /// @name used in osm2type.cpp, not for public use.
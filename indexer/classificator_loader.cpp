@@ -8,6 +8,7 @@
 #include "coding/reader_streambuf.hpp"
 
 #include "base/logging.hpp"
+#include "base/startup_tracer.hpp"
 
 #include "std/iostream.hpp"
 
@@ -42,6 +43,8 @@ namespace classificator
 {
 void Load()
 {
+  my::StartupTracer::Scope tracer("classificator_load");
+
   LOG(LDEBUG, ("Reading of classificator started"));
 
   Platform & p = GetPlatform();
@@ -59,6 +62,10 @@ void Load()
                  p.GetReader("types.txt"));
 
       drule::LoadRules();
+
+      // Resolve the draw rules of all indexed types once per style load,
+      // so per-feature rule lookup is a table probe.
+      classif().BuildDrawRulesTable();
     }
   }
 
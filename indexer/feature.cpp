@@ -31,6 +31,10 @@ void FeatureBase::Deserialize(feature::LoaderBase * pLoader, TBuffer buffer)
 
   m_limitRect = m2::RectD::GetEmptyRect();
   m_typesParsed = m_commonParsed = false;
+  // Not all params are overwritten by ParseCommon (their presence depends
+  // on the header), so reset them to allow reusing one instance for
+  // successive features.
+  m_params.MakeZero();
   m_header = m_pLoader->GetHeader();
 }
 
@@ -294,7 +298,15 @@ void FeatureType::Deserialize(feature::LoaderBase * pLoader, TBuffer buffer)
 
   m_pLoader->InitFeature(this);
 
-  m_header2Parsed = m_pointsParsed = m_trianglesParsed = m_metadataParsed = false;
+  m_header2Parsed = m_pointsParsed = m_trianglesParsed = false;
+  m_metadataParsed = m_metadataHotParsed = false;
+
+  // Clear the containers but keep their capacity: read functors re-bind one
+  // FeatureType instance to successive offsets, and ParseHeader2/ParseMetadata
+  // append to these containers.
+  m_points.clear();
+  m_triangles.clear();
+  m_metadata.Clear();
 
   m_innerStats.MakeZero();
 }
@@ -332,6 +344,11 @@ void FeatureType::ResetGeometry() const
   m_pLoader->ResetGeometry();
 }
 
+int FeatureType::GetGeometryScaleIndex(int scale) const
+{
+  return m_pLoader->GetScaleIndex(scale);
+}
+
 uint32_t FeatureType::ParseGeometry(int scale) const
 {
   uint32_t sz = 0;
@@ -362,9 +379,19 @@ void FeatureType::ParseMetadata() const
 {
   if (m_metadataParsed) return;
 
-  m_pLoader->ParseMetadata();
+  m_pLoader->ParseMetadata(false /* hotOnly */);
 
-  m_metadataParsed = true;
+  m_metadataParsed = m_metadataHotParsed = true;
+}
+
+void FeatureType::ParseHotMetadata() const
+{
+  // A full parse is a superset of the hot one.
+  if (m_metadataParsed || m_metadataHotParsed) return;
+
+  m_pLoader->ParseMetadata(true /* hotOnly */);
+
+  m_metadataHotParsed = true;
 }
 
 StringUtf8Multilang const & FeatureType::GetNames() const
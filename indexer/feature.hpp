@@ -203,6 +203,7 @@ public:
   uint32_t ParseTriangles(int scale) const;
 
   void ParseMetadata() const;
+  void ParseHotMetadata() const;
   //@}
 
   /// @name Geometry.
@@ -214,6 +215,10 @@ public:
 
   bool IsEmptyGeometry(int scale) const;
 
+  /// Index of the geometry scale bucket the given scale maps to, or -1.
+  /// Scales mapped to equal indices parse identical geometry.
+  int GetGeometryScaleIndex(int scale) const;
+
   template <typename TFunctor>
   void ForEachPoint(TFunctor && f, int scale) const
   {
@@ -303,6 +308,16 @@ public:
     return m_metadata;
   }
 
+  /// Metadata restricted to the hot (ranking-relevant) subset of keys,
+  /// see feature::Metadata::IsHotType. Cold values (urls, wikipedia, ...)
+  /// are not decoded, which matters when the search engine runs over
+  /// thousands of candidate features.
+  inline feature::Metadata const & GetHotMetadata() const
+  {
+    ParseHotMetadata();
+    return m_metadata;
+  }
+
   inline feature::Metadata & GetMetadata()
   {
     ParseMetadata();
@@ -367,6 +382,7 @@ private:
   mutable bool m_pointsParsed = false;
   mutable bool m_trianglesParsed = false;
   mutable bool m_metadataParsed = false;
+  mutable bool m_metadataHotParsed = false;
 
   mutable inner_geom_stat_t m_innerStats;
 
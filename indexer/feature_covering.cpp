@@ -6,6 +6,8 @@
 
 #include "geometry/covering_utils.hpp"
 
+#include "base/buffer_vector.hpp"
+
 #include "std/vector.hpp"
 
 
@@ -140,7 +142,7 @@ vector<int64_t> CoverFeature(FeatureType const & f, int cellDepth, uint64_t cell
                             RectId::DEPTH_LEVELS - 1).ToInt64(cellDepth));
   }
 
-  vector<RectId> cells;
+  buffer_vector<RectId, 64> cells;
   covering::CoverObject(fIsect, cellPenaltyArea, cells, cellDepth, RectId::Root());
 
   vector<int64_t> res(cells.size());
@@ -125,6 +125,7 @@ void LoaderCurrent::ParseHeader2()
   ArrayByteSource src(bitSource.RoundPtr());
 
   serial::CodingParams const & cp = GetDefCodingParams();
+  serial::DecodeProfile const & profile = m_Info.GetDefDecodeProfile();
 
   if (typeMask == HEADER_GEOM_LINE)
   {
@@ -141,7 +142,7 @@ void LoaderCurrent::ParseHeader2()
 
       char const * start = src.PtrC();
 
-      src = ArrayByteSource(serial::LoadInnerPath(start, ptsCount, cp, m_pF->m_points));
+      src = ArrayByteSource(serial::LoadInnerPath(start, ptsCount, profile, m_pF->m_points));
 
       m_pF->m_innerStats.m_points = static_cast<uint32_t>(src.PtrC() - start);
     }
@@ -161,7 +162,7 @@ void LoaderCurrent::ParseHeader2()
       char const * start = static_cast<char const *>(src.PtrC());
 
       FeatureType::points_t points;
-      src = ArrayByteSource(serial::LoadInnerTriangles(start, trgCount, cp, points));
+      src = ArrayByteSource(serial::LoadInnerTriangles(start, trgCount, profile, points));
 
       m_pF->m_innerStats.m_strips = static_cast<uint32_t>(src.PtrC() - start);
 
@@ -196,9 +197,9 @@ uint32_t LoaderCurrent::ParseGeometry(int scale)
         ReaderSource<FilesContainerR::TReader> src(m_Info.GetGeometryReader(ind));
         src.Skip(m_ptsOffsets[ind]);
 
-        serial::CodingParams cp = GetCodingParams(ind);
-        cp.SetBasePoint(m_pF->m_points[0]);
-        serial::LoadOuterPath(src, cp, m_pF->m_points);
+        serial::DecodeProfile profile = m_Info.GetDecodeProfile(ind);
+        profile.SetBasePoint(m_pF->m_points[0]);
+        serial::LoadOuterPath(src, profile, m_pF->m_points);
 
         sz = static_cast<uint32_t>(src.Pos() - m_ptsOffsets[ind]);
       }
@@ -243,7 +244,7 @@ uint32_t LoaderCurrent::ParseTriangles(int scale)
       {
         ReaderSource<FilesContainerR::TReader> src(m_Info.GetTrianglesReader(ind));
         src.Skip(m_trgOffsets[ind]);
-        serial::LoadOuterTriangles(src, GetCodingParams(ind), m_pF->m_triangles);
+        serial::LoadOuterTriangles(src, m_Info.GetDecodeProfile(ind), m_pF->m_triangles);
 
         sz = static_cast<uint32_t>(src.Pos() - m_trgOffsets[ind]);
       }
@@ -255,7 +256,7 @@ uint32_t LoaderCurrent::ParseTriangles(int scale)
   return sz;
 }
 
-void LoaderCurrent::ParseMetadata()
+void LoaderCurrent::ParseMetadata(bool hotOnly)
 {
   try
   {
@@ -279,9 +280,18 @@ void LoaderCurrent::ParseMetadata()
       ReaderSource<FilesContainerR::TReader> src(m_Info.GetMetadataReader());
       src.Skip(it->value);
       if (m_Info.GetMWMFormat() >= version::Format::v8)
-        m_pF->m_metadata.Deserialize(src);
+      {
+        if (hotOnly)
+          m_pF->m_metadata.DeserializeSubset(src, &Metadata::IsHotType);
+        else
+          m_pF->m_metadata.Deserialize(src);
+      }
       else
+      {
+        // The v7 layout reads the value bytes anyway, so there is nothing
+        // to save by filtering - always decode everything.
         m_pF->m_metadata.DeserializeFromMWMv7OrLower(src);
+      }
     }
   }
   catch (Reader::OpenException const &)
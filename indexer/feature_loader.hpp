@@ -8,15 +8,7 @@ namespace feature
   {
     typedef LoaderBase BaseT;
 
-    /// Get the index for geometry serialization.
-    /// @param[in]  scale:
-    /// -1 : index for the best geometry
-    /// -2 : index for the worst geometry
-    /// default : needed geometry
-    //@{
-    int GetScaleIndex(int scale) const;
     int GetScaleIndex(int scale, offsets_t const & offsets) const;
-    //@}
 
   public:
     LoaderCurrent(SharedLoadInfo const & info) : BaseT(info) {}
@@ -27,6 +19,13 @@ namespace feature
     void ParseHeader2() override;
     uint32_t ParseGeometry(int scale) override;
     uint32_t ParseTriangles(int scale) override;
-    void ParseMetadata() override;
+    void ParseMetadata(bool hotOnly) override;
+
+    /// Get the index for geometry serialization.
+    /// @param[in]  scale:
+    /// -1 : index for the best geometry
+    /// -2 : index for the worst geometry
+    /// default : needed geometry
+    int GetScaleIndex(int scale) const override;
   };
 }
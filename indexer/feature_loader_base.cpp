@@ -19,6 +19,18 @@ namespace feature
 SharedLoadInfo::SharedLoadInfo(FilesContainerR const & cont, DataHeader const & header)
   : m_cont(cont), m_header(header)
 {
+  int const scalesCount = GetScalesCount();
+  m_geometryReaders.reserve(scalesCount);
+  m_trianglesReaders.reserve(scalesCount);
+  m_scaleProfiles.reserve(scalesCount);
+  for (int i = 0; i < scalesCount; ++i)
+  {
+    m_geometryReaders.push_back(m_cont.GetReader(GetTagForIndex(GEOMETRY_FILE_TAG, i)));
+    m_trianglesReaders.push_back(m_cont.GetReader(GetTagForIndex(TRIANGLE_FILE_TAG, i)));
+    m_scaleProfiles.push_back(serial::DecodeProfile(GetCodingParams(i)));
+  }
+  m_defProfile = serial::DecodeProfile(GetDefCodingParams());
+
   CreateLoader();
 }
 
@@ -49,12 +61,14 @@ SharedLoadInfo::TReader SharedLoadInfo::GetAltitudeReader() const
 
 SharedLoadInfo::TReader SharedLoadInfo::GetGeometryReader(int ind) const
 {
-  return m_cont.GetReader(GetTagForIndex(GEOMETRY_FILE_TAG, ind));
+  ASSERT_LESS(static_cast<size_t>(ind), m_geometryReaders.size(), ());
+  return m_geometryReaders[ind];
 }
 
 SharedLoadInfo::TReader SharedLoadInfo::GetTrianglesReader(int ind) const
 {
-  return m_cont.GetReader(GetTagForIndex(TRIANGLE_FILE_TAG, ind));
+  ASSERT_LESS(static_cast<size_t>(ind), m_trianglesReaders.size(), ());
+  return m_trianglesReaders[ind];
 }
 
 void SharedLoadInfo::CreateLoader()
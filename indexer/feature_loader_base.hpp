@@ -1,10 +1,12 @@
 #pragma once
 #include "indexer/coding_params.hpp"
 #include "indexer/data_header.hpp"
+#include "indexer/geometry_serialization.hpp"
 
 #include "coding/file_container.hpp"
 
 #include "std/noncopyable.hpp"
+#include "std/vector.hpp"
 
 
 class FeatureType;
@@ -22,6 +24,15 @@ namespace feature
 
     using TReader = FilesContainerR::TReader;
 
+    /// Per-scale geometry and triangles readers, looked up in the container
+    /// directory once here instead of on every feature parse.
+    vector<TReader> m_geometryReaders, m_trianglesReaders;
+
+    /// Decode profiles derived from the coding params once here instead
+    /// of on every feature geometry decode.
+    serial::DecodeProfile m_defProfile;
+    vector<serial::DecodeProfile> m_scaleProfiles;
+
     LoaderBase * m_pLoader;
     void CreateLoader();
 
@@ -49,6 +60,13 @@ namespace feature
       return m_header.GetCodingParams(scaleIndex);
     }
 
+    inline serial::DecodeProfile const & GetDefDecodeProfile() const { return m_defProfile; }
+    inline serial::DecodeProfile const & GetDecodeProfile(int scaleIndex) const
+    {
+      ASSERT_LESS(static_cast<size_t>(scaleIndex), m_scaleProfiles.size(), ());
+      return m_scaleProfiles[scaleIndex];
+    }
+
     inline int GetScalesCount() const { return static_cast<int>(m_header.GetScalesCount()); }
     inline int GetScale(int i) const { return m_header.GetScale(i); }
     inline int GetLastScale() const { return m_header.GetLastScale(); }
@@ -78,7 +96,13 @@ namespace feature
     virtual void ParseHeader2() = 0;
     virtual uint32_t ParseGeometry(int scale) = 0;
     virtual uint32_t ParseTriangles(int scale) = 0;
-    virtual void ParseMetadata() = 0;
+    /// With hotOnly only the ranking-relevant subset of metadata is decoded
+    /// (see feature::Metadata::IsHotType); cold values are skipped.
+    virtual void ParseMetadata(bool hotOnly) = 0;
+
+    /// Index of the geometry scale bucket the given scale maps to.
+    /// Equal indices select identical serialized geometry.
+    virtual int GetScaleIndex(int scale) const = 0;
 
     inline uint32_t GetTypesSize() const { return m_CommonOffset - m_TypesOffset; }
 
@@ -41,6 +41,23 @@ string Metadata::GetWikiURL() const
   return "https://" + v.substr(0, colon) + kBaseWikiUrl + v.substr(colon + 1);
 }
 
+// static
+bool Metadata::IsHotType(uint8_t type)
+{
+  switch (type)
+  {
+  case FMD_CUISINE:
+  case FMD_OPEN_HOURS:
+  case FMD_STARS:
+  case FMD_POSTCODE:
+  case FMD_PRICE_RATE:
+  case FMD_RATING:
+    return true;
+  default:
+    return false;
+  }
+}
+
 // static
 bool Metadata::TypeFromString(string const & k, Metadata::EType & outType)
 {
@@ -3,10 +3,12 @@
 #include "coding/multilang_utf8_string.hpp"
 #include "coding/reader.hpp"
 
+#include "base/buffer_vector.hpp"
+
 #include "std/algorithm.hpp"
 #include "std/limits.hpp"
-#include "std/map.hpp"
 #include "std/string.hpp"
+#include "std/utility.hpp"
 #include "std/vector.hpp"
 
 
@@ -15,35 +17,65 @@ namespace feature
 class MetadataBase
 {
 protected:
+  // Entries are kept sorted by type. A short inline vector avoids the
+  // per-entry node allocations of a map: typical features carry only a
+  // few metadata fields, and when one instance is reused for
+  // successive features the strings' storage is reused as well.
+  using TEntry = pair<uint8_t, string>;
+  using TEntries = buffer_vector<TEntry, 8>;
+
+  TEntries::const_iterator Find(uint8_t type) const
+  {
+    return lower_bound(m_metadata.begin(), m_metadata.end(), type,
+                       [](TEntry const & e, uint8_t t) { return e.first < t; });
+  }
+
+  TEntries::iterator Find(uint8_t type)
+  {
+    return lower_bound(m_metadata.begin(), m_metadata.end(), type,
+                       [](TEntry const & e, uint8_t t) { return e.first < t; });
+  }
+
+  // Returns the value slot for |type|, inserting an empty entry if needed.
+  string & MutableValue(uint8_t type)
+  {
+    auto const it = Find(type);
+    if (it != m_metadata.end() && it->first == type)
+      return it->second;
+    size_t const pos = distance(m_metadata.begin(), it);
+    m_metadata.insert(it, TEntry(type, string()));
+    return m_metadata[pos].second;
+  }
+
   // TODO: Change uint8_t to appropriate type when FMD_COUNT reaches 256.
   void Set(uint8_t type, string const & value)
   {
-    auto found = m_metadata.find(type);
-    if (found == m_metadata.end())
+    auto const it = Find(type);
+    if (it == m_metadata.end() || it->first != type)
     {
       if (!value.empty())
-        m_metadata[type] = value;
+        m_metadata.insert(it, TEntry(type, value));
     }
     else
     {
       if (value.empty())
-        m_metadata.erase(found);
+        m_metadata.erase_if([type](TEntry const & e) { return e.first == type; });
       else
-        found->second = value;
+        it->second = value;
     }
   }
 
 public:
   bool Has(uint8_t type) const
   {
-    auto const it = m_metadata.find(type);
-    return it != m_metadata.end();
+    auto const it = Find(type);
+    return it != m_metadata.end() && it->first == type;
   }
 
   string Get(uint8_t type) const
   {
-    auto const it = m_metadata.find(type);
-    return (it == m_metadata.end()) ? string() : it->second;
+    auto const it = Find(type);
+    return (it == m_metadata.end() || it->first != type) ? string() : it->second;
   }
 
   vector<uint8_t> GetPresentTypes() const
@@ -59,6 +91,7 @@ public:
 
   inline bool Empty() const { return m_metadata.empty(); }
   inline size_t Size() const { return m_metadata.size(); }
+  inline void Clear() { m_metadata.clear(); }
 
   template <class TSink>
   void Serialize(TSink & sink) const
@@ -72,15 +105,47 @@ public:
     }
   }
 
+  // Replaces the contents with the serialized entries accepted by |filter|.
+  // Rejected values are skipped by their length prefix without being
+  // materialized as strings, so the cost of an entry the caller does not
+  // need is a varint read and a Skip. |src| must support Skip (reader
+  // sources do, plain byte sources don't).
+  template <class TSource, class TFilter>
+  void DeserializeSubset(TSource & src, TFilter && filter)
+  {
+    auto const sz = ReadVarUint<uint32_t>(src);
+    m_metadata.clear();
+    for (size_t i = 0; i < sz; ++i)
+    {
+      auto const type = static_cast<uint8_t>(ReadVarUint<uint32_t>(src));
+      if (filter(type))
+      {
+        // Entries are serialized in ascending type order, so this is a push_back.
+        utils::ReadString(src, MutableValue(type));
+      }
+      else
+      {
+        src.Skip(ReadVarUint<uint32_t>(src) + 1);
+      }
+    }
+  }
+
+  // Replaces the contents with the serialized entries, which Serialize
+  // emits in ascending type order. Reading in place reuses the strings'
+  // storage when the instance is reused between features.
   template <class TSource>
   void Deserialize(TSource & src)
   {
     auto const sz = ReadVarUint<uint32_t>(src);
+    m_metadata.resize(sz);
     for (size_t i = 0; i < sz; ++i)
     {
-      auto const key = ReadVarUint<uint32_t>(src);
-      utils::ReadString(src, m_metadata[key]);
+      m_metadata[i].first = static_cast<uint8_t>(ReadVarUint<uint32_t>(src));
+      utils::ReadString(src, m_metadata[i].second);
     }
+    ASSERT(is_sorted(m_metadata.begin(), m_metadata.end(),
+                     [](TEntry const & l, TEntry const & r) { return l.first < r.first; }),
+           ());
   }
 
   inline bool Equals(MetadataBase const & other) const
@@ -89,7 +154,7 @@ public:
   }
 
 protected:
-  map<uint8_t, string> m_metadata;
+  TEntries m_metadata;
 };
 
 class Metadata : public MetadataBase
@@ -134,6 +199,11 @@ public:
   static bool TypeFromString(string const & osmTagKey, EType & outType);
   static bool IsSponsoredType(EType const & type);
 
+  /// "Hot" types are the few the search engine reads for every candidate
+  /// while ranking and filtering; everything else (urls, wikipedia, ...)
+  /// is needed only for the place page of a single selected feature.
+  static bool IsHotType(uint8_t type);
+
   void Set(EType type, string const & value) { MetadataBase::Set(type, value); }
   void Drop(EType type) { Set(type, string()); }
   string GetWikiURL() const;
@@ -164,7 +234,7 @@ public:
     {
       src.Read(header, sizeof(header));
       src.Read(buffer, header[1]);
-      m_metadata[header[0] & 0x7F].assign(buffer, header[1]);
+      MutableValue(header[0] & 0x7F).assign(buffer, header[1]);
     } while (!(header[0] & 0x80));
   }
 
@@ -94,9 +94,17 @@ pair<int, bool> GetDrawRule(TypesHolder const & types, int level,
   ASSERT ( keys.empty(), () );
   Classificator const & c = classif();
 
-  DrawRuleGetter doRules(level, types.GetGeoType(), keys);
-  for (uint32_t t : types)
-    (void)c.ProcessObjects(t, doRules);
+  if (c.HasDrawRulesTable())
+  {
+    for (uint32_t t : types)
+      c.GetSuitableRules(t, level, types.GetGeoType(), keys);
+  }
+  else
+  {
+    DrawRuleGetter doRules(level, types.GetGeoType(), keys);
+    for (uint32_t t : types)
+      (void)c.ProcessObjects(t, doRules);
+  }
 
   return make_pair(types.GetGeoType(), types.Has(c.GetCoastType()));
 }
@@ -108,6 +116,13 @@ void GetDrawRule(vector<uint32_t> const & types, int level, int geoType,
   ASSERT ( keys.empty(), () );
   Classificator const & c = classif();
 
+  if (c.HasDrawRulesTable())
+  {
+    for (uint32_t t : types)
+      c.GetSuitableRules(t, level, EGeomType(geoType), keys);
+    return;
+  }
+
   DrawRuleGetter doRules(level, EGeomType(geoType), keys);
 
   for (uint32_t t : types)
@@ -12,6 +12,8 @@
 #include "base/logging.hpp"
 #include "base/scope_guard.hpp"
 
+#include "std/algorithm.hpp"
+#include "std/iterator.hpp"
 #include "std/string.hpp"
 
 
@@ -19,6 +21,13 @@ using namespace platform;
 
 namespace feature
 {
+  namespace
+  {
+  // Number of GetFeatureOffset() calls after which the whole table is
+  // decoded into a plain in-memory array (see m_plain).
+  uint32_t const kHotLookupsCount = 1000;
+  }  // namespace
+
   void FeaturesOffsetsTable::Builder::PushOffset(uint32_t const offset)
   {
     ASSERT(m_offsets.empty() || m_offsets.back() < offset, ());
@@ -72,7 +81,9 @@ namespace feature
 
     table->m_file.Open(cont.GetFileName());
     auto p = cont.GetAbsoluteOffsetAndSize(FEATURE_OFFSETS_FILE_TAG);
-    table->m_handle.Assign(table->m_file.Map(p.first, p.second, FEATURE_OFFSETS_FILE_TAG));
+    // Offsets are looked up by feature id in no particular order.
+    table->m_handle.Assign(table->m_file.Map(p.first, p.second, FEATURE_OFFSETS_FILE_TAG,
+                                             detail::MappedFile::Advice::Random));
 
     succinct::mapper::map(table->m_table, table->m_handle.GetData<char>());
     return table;
@@ -145,6 +156,23 @@ namespace feature
   uint32_t FeaturesOffsetsTable::GetFeatureOffset(size_t index) const
   {
     ASSERT_LESS(index, size(), ("Index out of bounds", index, size()));
+
+    if (m_plainReady.load())
+      return m_plain[index];
+
+    // Exactly one thread crosses the threshold and decodes the whole table.
+    // A sequential decode is much cheaper than the same number of random
+    // select() chains, so this pays off quickly for hot mwms while cold
+    // ones never spend the memory.
+    if (m_numLookups.fetch_add(1) + 1 == kHotLookupsCount)
+    {
+      size_t const count = size();
+      m_plain.resize(count);
+      for (size_t i = 0; i < count; ++i)
+        m_plain[i] = static_cast<uint32_t>(m_table.select(i));
+      m_plainReady.store(true);
+    }
+
     return static_cast<uint32_t>(m_table.select(index));
   }
 
@@ -155,6 +183,13 @@ namespace feature
                                                      m_table.select(size() - 1)));
     ASSERT_GREATER_OR_EQUAL(offset, m_table.select(0), ("Offset out of bounds", offset,
                                                         m_table.select(size() - 1)));
+    if (m_plainReady.load())
+    {
+      auto const it = lower_bound(m_plain.begin(), m_plain.end(), offset);
+      ASSERT(it != m_plain.end() && *it == offset, ("Can't find offset", offset, "in the table"));
+      return static_cast<size_t>(distance(m_plain.begin(), it));
+    }
+
     //Binary search in elias_fano list
     size_t leftBound = 0, rightBound = size();
     while (leftBound + 1 < rightBound) {
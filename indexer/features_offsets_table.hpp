@@ -5,6 +5,7 @@
 
 #include "defines.hpp"
 
+#include "std/atomic.hpp"
 #include "std/cstdint.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/vector.hpp"
@@ -106,6 +107,16 @@ namespace feature
                                                        string const & storePath);
 
     succinct::elias_fano m_table;
+
+    // Plain copy of all offsets, decoded once the table proves hot (see
+    // kHotLookupsCount). GetFeatureOffset() then becomes a direct
+    // indexation instead of an elias-fano select() chain, at a cost of 4
+    // bytes per feature. Written by the single thread that crosses the
+    // lookups threshold and published via |m_plainReady|.
+    mutable vector<uint32_t> m_plain;
+    mutable atomic<bool> m_plainReady{false};
+    mutable atomic<uint32_t> m_numLookups{0};
+
     unique_ptr<MmapReader> m_pReader;
 
     detail::MappedFile m_file;
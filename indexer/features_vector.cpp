@@ -6,6 +6,16 @@
 #include "platform/mwm_version.hpp"
 
 
+namespace
+{
+// Maximum distance between the starts of two consecutive batched records
+// that is still coalesced into one reader request: reading a small gap
+// sequentially is cheaper than issuing a separate request.
+uint64_t const kMaxCoalesceDistance = 1024;
+// Upper bound on the size of a single coalesced read.
+uint64_t const kMaxBatchChunkSize = 1 << 20;
+}  // namespace
+
 void FeaturesVector::GetByIndex(uint32_t index, FeatureType & ft) const
 {
   uint32_t offset = 0, size = 0;
@@ -14,6 +24,63 @@ void FeaturesVector::GetByIndex(uint32_t index, FeatureType & ft) const
   ft.Deserialize(m_LoadInfo.GetLoader(), &m_buffer[offset]);
 }
 
+void FeaturesVector::ReadBatch(vector<uint32_t> const & indexes, TBatchCallback const & toDo) const
+{
+  ASSERT(is_sorted(indexes.begin(), indexes.end()), ());
+
+  FeatureType ft;
+
+  if (!m_table)
+  {
+    // Without the offsets table an index is a raw file position and the
+    // record end is unknown until the record is read.
+    for (uint32_t const index : indexes)
+    {
+      GetByIndex(index, ft);
+      toDo(ft, index);
+    }
+    return;
+  }
+
+  size_t const count = m_table->size();
+
+  vector<uint64_t> offsets;
+  offsets.reserve(indexes.size());
+  for (uint32_t const index : indexes)
+    offsets.push_back(m_table->GetFeatureOffset(index));
+
+  vector<char> buffer;
+  size_t i = 0;
+  while (i < indexes.size())
+  {
+    size_t j = i + 1;
+    while (j < indexes.size() && offsets[j] - offsets[j - 1] <= kMaxCoalesceDistance &&
+           offsets[j] - offsets[i] < kMaxBatchChunkSize)
+    {
+      ++j;
+    }
+
+    // Records are contiguous in the data section, so the next feature's
+    // offset is the end of the previous record.
+    uint32_t const last = indexes[j - 1];
+    uint64_t const begin = offsets[i];
+    uint64_t const end =
+        last + 1 < count ? m_table->GetFeatureOffset(last + 1) : m_RecordReader.Size();
+    ASSERT_LESS(begin, end, ());
+
+    buffer.resize(end - begin);
+    m_RecordReader.Read(begin, buffer.data(), buffer.size());
+
+    for (; i < j; ++i)
+    {
+      ArrayByteSource source(buffer.data() + (offsets[i] - begin));
+      VarRecordSizeReaderVarint(source);  // Skips the record size.
+      ft.Deserialize(m_LoadInfo.GetLoader(), static_cast<char const *>(source.PtrC()));
+      toDo(ft, indexes[i]);
+    }
+  }
+}
+
 size_t FeaturesVector::GetNumFeatures() const
 {
   return m_table ? m_table->size() : 0;
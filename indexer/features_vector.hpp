@@ -4,6 +4,8 @@
 
 #include "coding/var_record_reader.hpp"
 
+#include "std/function.hpp"
+
 
 namespace feature { class FeaturesOffsetsTable; }
 
@@ -22,14 +24,24 @@ public:
 
   void GetByIndex(uint32_t index, FeatureType & ft) const;
 
+  using TBatchCallback = function<void(FeatureType &, uint32_t /* index */)>;
+
+  /// Calls |toDo| with a deserialized feature for each index of |indexes|,
+  /// which must be sorted. Records that are adjacent or close to each other
+  /// in the data section are coalesced into single reader requests, so a
+  /// sorted batch mostly results in sequential I/O instead of one scattered
+  /// read per feature. The feature passed to |toDo|, as with GetByIndex(),
+  /// has no id set and is valid only inside the call.
+  void ReadBatch(vector<uint32_t> const & indexes, TBatchCallback const & toDo) const;
+
   size_t GetNumFeatures() const;
 
   template <class ToDo> void ForEach(ToDo && toDo) const
   {
     uint32_t index = 0;
+    FeatureType ft;
     m_RecordReader.ForEachRecord([&] (uint32_t pos, char const * data, uint32_t /*size*/)
     {
-      FeatureType ft;
       ft.Deserialize(m_LoadInfo.GetLoader(), data);
 
       // We can't properly set MwmId here, because FeaturesVector
@@ -15,49 +15,60 @@
 
 namespace
 {
+// Sorted flat table (type -> class) is filled once and then probed with a
+// binary search: GetHighwayClass() is called per feature in routing and
+// search loops, where a node-based map lookup is noticeably slower.
 class HighwayClasses
 {
-  map<uint32_t, ftypes::HighwayClass> m_map;
+  vector<pair<uint32_t, ftypes::HighwayClass>> m_map;
 
 public:
   HighwayClasses()
   {
     auto const & c = classif();
-    m_map[c.GetTypeByPath({"highway", "motorway"})] = ftypes::HighwayClass::Trunk;
-    m_map[c.GetTypeByPath({"highway", "motorway_link"})] = ftypes::HighwayClass::Trunk;
-    m_map[c.GetTypeByPath({"highway", "trunk"})] = ftypes::HighwayClass::Trunk;
-    m_map[c.GetTypeByPath({"highway", "trunk_link"})] = ftypes::HighwayClass::Trunk;
-    m_map[c.GetTypeByPath({"route", "ferry"})] = ftypes::HighwayClass::Trunk;
-
-    m_map[c.GetTypeByPath({"highway", "primary"})] = ftypes::HighwayClass::Primary;
-    m_map[c.GetTypeByPath({"highway", "primary_link"})] = ftypes::HighwayClass::Primary;
-
-    m_map[c.GetTypeByPath({"highway", "secondary"})] = ftypes::HighwayClass::Secondary;
-    m_map[c.GetTypeByPath({"highway", "secondary_link"})] = ftypes::HighwayClass::Secondary;
-
-    m_map[c.GetTypeByPath({"highway", "tertiary"})] = ftypes::HighwayClass::Tertiary;
-    m_map[c.GetTypeByPath({"highway", "tertiary_link"})] = ftypes::HighwayClass::Tertiary;
-
-    m_map[c.GetTypeByPath({"highway", "unclassified"})] = ftypes::HighwayClass::LivingStreet;
-    m_map[c.GetTypeByPath({"highway", "residential"})] = ftypes::HighwayClass::LivingStreet;
-    m_map[c.GetTypeByPath({"highway", "living_street"})] = ftypes::HighwayClass::LivingStreet;
-    m_map[c.GetTypeByPath({"highway", "road"})] = ftypes::HighwayClass::LivingStreet;
-
-    m_map[c.GetTypeByPath({"highway", "service"})] = ftypes::HighwayClass::Service;
-    m_map[c.GetTypeByPath({"highway", "track"})] = ftypes::HighwayClass::Service;
-
-    m_map[c.GetTypeByPath({"highway", "pedestrian"})] = ftypes::HighwayClass::Pedestrian;
-    m_map[c.GetTypeByPath({"highway", "footway"})] = ftypes::HighwayClass::Pedestrian;
-    m_map[c.GetTypeByPath({"highway", "bridleway"})] = ftypes::HighwayClass::Pedestrian;
-    m_map[c.GetTypeByPath({"highway", "steps"})] = ftypes::HighwayClass::Pedestrian;
-    m_map[c.GetTypeByPath({"highway", "cycleway"})] = ftypes::HighwayClass::Pedestrian;
-    m_map[c.GetTypeByPath({"highway", "path"})] = ftypes::HighwayClass::Pedestrian;
+    auto const add = [&](initializer_list<char const *> const & path, ftypes::HighwayClass cls)
+    {
+      m_map.emplace_back(c.GetTypeByPath(path), cls);
+    };
+
+    add({"highway", "motorway"}, ftypes::HighwayClass::Trunk);
+    add({"highway", "motorway_link"}, ftypes::HighwayClass::Trunk);
+    add({"highway", "trunk"}, ftypes::HighwayClass::Trunk);
+    add({"highway", "trunk_link"}, ftypes::HighwayClass::Trunk);
+    add({"route", "ferry"}, ftypes::HighwayClass::Trunk);
+
+    add({"highway", "primary"}, ftypes::HighwayClass::Primary);
+    add({"highway", "primary_link"}, ftypes::HighwayClass::Primary);
+
+    add({"highway", "secondary"}, ftypes::HighwayClass::Secondary);
+    add({"highway", "secondary_link"}, ftypes::HighwayClass::Secondary);
+
+    add({"highway", "tertiary"}, ftypes::HighwayClass::Tertiary);
+    add({"highway", "tertiary_link"}, ftypes::HighwayClass::Tertiary);
+
+    add({"highway", "unclassified"}, ftypes::HighwayClass::LivingStreet);
+    add({"highway", "residential"}, ftypes::HighwayClass::LivingStreet);
+    add({"highway", "living_street"}, ftypes::HighwayClass::LivingStreet);
+    add({"highway", "road"}, ftypes::HighwayClass::LivingStreet);
+
+    add({"highway", "service"}, ftypes::HighwayClass::Service);
+    add({"highway", "track"}, ftypes::HighwayClass::Service);
+
+    add({"highway", "pedestrian"}, ftypes::HighwayClass::Pedestrian);
+    add({"highway", "footway"}, ftypes::HighwayClass::Pedestrian);
+    add({"highway", "bridleway"}, ftypes::HighwayClass::Pedestrian);
+    add({"highway", "steps"}, ftypes::HighwayClass::Pedestrian);
+    add({"highway", "cycleway"}, ftypes::HighwayClass::Pedestrian);
+    add({"highway", "path"}, ftypes::HighwayClass::Pedestrian);
+
+    sort(m_map.begin(), m_map.end());
   }
 
   ftypes::HighwayClass Get(uint32_t t) const
   {
-    auto const it = m_map.find(t);
-    if (it == m_map.cend())
+    auto const it = lower_bound(m_map.begin(), m_map.end(),
+                                make_pair(t, ftypes::HighwayClass::Undefined));
+    if (it == m_map.end() || it->first != t)
       return ftypes::HighwayClass::Error;
     return it->second;
   }
@@ -326,30 +337,44 @@ IsBuildingChecker const & IsBuildingChecker::Instance()
   return inst;
 }
 
-IsBridgeChecker::IsBridgeChecker() : BaseChecker(3 /* level */) {}
+namespace
+{
+// Collects all level 3 types conforming the path into |types|. Enumerating
+// the classificator tree once at construction leaves IsMatched() with plain
+// numeric compares instead of a per-call tree walk with string compares.
+void CollectConformedTypes(StringIL const & path, vector<uint32_t> & types)
+{
+  auto collector = [&](ClassifObject const *, uint32_t type)
+  {
+    if (ftype::GetLevel(type) == 3 && IsTypeConformed(type, path))
+      types.push_back(type);
+  };
+  classif().ForEachTree(collector);
+}
+}  // namespace
+
+IsBridgeChecker::IsBridgeChecker() : BaseChecker(3 /* level */)
+{
+  CollectConformedTypes({"highway", "*", "bridge"}, m_types);
+}
+
 IsBridgeChecker const & IsBridgeChecker::Instance()
 {
   static IsBridgeChecker const inst;
   return inst;
 }
 
-bool IsBridgeChecker::IsMatched(uint32_t type) const
+IsTunnelChecker::IsTunnelChecker() : BaseChecker(3 /* level */)
 {
-  return IsTypeConformed(type, {"highway", "*", "bridge"});
+  CollectConformedTypes({"highway", "*", "tunnel"}, m_types);
 }
 
-IsTunnelChecker::IsTunnelChecker() : BaseChecker(3 /* level */) {}
 IsTunnelChecker const & IsTunnelChecker::Instance()
 {
   static IsTunnelChecker const inst;
   return inst;
 }
 
-bool IsTunnelChecker::IsMatched(uint32_t type) const
-{
-  return IsTypeConformed(type, {"highway", "*", "tunnel"});
-}
-
 IsBookingChecker::IsBookingChecker()
 {
   Classificator const & c = classif();
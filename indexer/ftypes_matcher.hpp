@@ -130,8 +130,6 @@ public:
 
 class IsBridgeChecker : public BaseChecker
 {
-  virtual bool IsMatched(uint32_t type) const override;
-
   IsBridgeChecker();
 public:
   static IsBridgeChecker const & Instance();
@@ -139,8 +137,6 @@ public:
 
 class IsTunnelChecker : public BaseChecker
 {
-  virtual bool IsMatched(uint32_t type) const override;
-
   IsTunnelChecker();
 public:
   static IsTunnelChecker const & Instance();
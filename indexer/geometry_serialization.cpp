@@ -61,8 +61,18 @@ namespace serial
     (*fn)(make_read_adapter(upoints), pts::GetBasePoint(params), pts::GetMaxPoint(params), adapt);
   }
 
+  DecodeProfile::DecodeProfile() : DecodeProfile(CodingParams()) {}
+
+  DecodeProfile::DecodeProfile(CodingParams const & params)
+    : m_params(params), m_maxPoint(pts::GetMaxPoint(params))
+  {
+    double const kCoordSize = (1 << params.GetCoordBits()) - 1;
+    m_kx = (MercatorBounds::maxX - MercatorBounds::minX) / kCoordSize;
+    m_ky = (MercatorBounds::maxY - MercatorBounds::minY) / kCoordSize;
+  }
+
   template <class TDecodeFun, class TOutPoints>
-  void DecodeImpl(TDecodeFun fn, DeltasT const & deltas, CodingParams const & params,
+  void DecodeImpl(TDecodeFun fn, DeltasT const & deltas, DecodeProfile const & profile,
                   TOutPoints & points, size_t reserveF)
   {
     size_t const count = deltas.size() * reserveF;
@@ -71,7 +81,8 @@ namespace serial
     upoints.resize(count);
 
     geo_coding::OutPointsT adapt(upoints);
-    (*fn)(make_read_adapter(deltas), pts::GetBasePoint(params), pts::GetMaxPoint(params), adapt);
+    (*fn)(make_read_adapter(deltas), profile.GetParams().GetBasePoint(), profile.GetMaxPoint(),
+          adapt);
 
     if (points.size() < 2)
     {
@@ -79,31 +90,65 @@ namespace serial
       points.reserve(count);
     }
 
-    transform(upoints.begin(), upoints.begin() + adapt.size(), back_inserter(points),
-              bind(&pts::U2D, _1, params.GetCoordBits()));
+    // Explicit conversion loop instead of transform + bind(&pts::U2D, ...):
+    // with the scale factors hoisted out of the loop every point converts
+    // with two independent multiply-adds, which the compiler can vectorize.
+    double const kx = profile.GetScaleX();
+    double const ky = profile.GetScaleY();
+
+    size_t const decodedCount = adapt.size();
+    size_t const base = points.size();
+    points.resize(base + decodedCount);
+    for (size_t i = 0; i < decodedCount; ++i)
+    {
+      points[base + i] = m2::PointD(upoints[i].x * kx + MercatorBounds::minX,
+                                    upoints[i].y * ky + MercatorBounds::minY);
+      ASSERT(MercatorBounds::minX <= points[base + i].x && points[base + i].x <= MercatorBounds::maxX,
+             (upoints[i], points[base + i], profile.GetParams().GetCoordBits()));
+      ASSERT(MercatorBounds::minY <= points[base + i].y && points[base + i].y <= MercatorBounds::maxY,
+             (upoints[i], points[base + i], profile.GetParams().GetCoordBits()));
+    }
   }
 
   void Decode(DecodeFunT fn, DeltasT const & deltas, CodingParams const & params,
               OutPointsT & points, size_t reserveF)
   {
-    DecodeImpl(fn, deltas, params, points, reserveF);
+    DecodeImpl(fn, deltas, DecodeProfile(params), points, reserveF);
   }
 
   void Decode(DecodeFunT fn, DeltasT const & deltas, CodingParams const & params,
               vector<m2::PointD> & points, size_t reserveF)
   {
-    DecodeImpl(fn, deltas, params, points, reserveF);
+    DecodeImpl(fn, deltas, DecodeProfile(params), points, reserveF);
+  }
+
+  void Decode(DecodeFunT fn, DeltasT const & deltas, DecodeProfile const & profile,
+              OutPointsT & points, size_t reserveF)
+  {
+    DecodeImpl(fn, deltas, profile, points, reserveF);
+  }
+
+  void Decode(DecodeFunT fn, DeltasT const & deltas, DecodeProfile const & profile,
+              vector<m2::PointD> & points, size_t reserveF)
+  {
+    DecodeImpl(fn, deltas, profile, points, reserveF);
   }
 
   void const * LoadInner(DecodeFunT fn, void const * pBeg, size_t count,
                          CodingParams const & params, OutPointsT & points)
+  {
+    return LoadInner(fn, pBeg, count, DecodeProfile(params), points);
+  }
+
+  void const * LoadInner(DecodeFunT fn, void const * pBeg, size_t count,
+                         DecodeProfile const & profile, OutPointsT & points)
   {
     DeltasT deltas;
     deltas.reserve(count);
     void const * ret = ReadVarUint64Array(static_cast<char const *>(pBeg), count,
                                           MakeBackInsertFunctor(deltas));
 
-    Decode(fn, deltas, params, points);
+    Decode(fn, deltas, profile, points);
     return ret;
   }
 
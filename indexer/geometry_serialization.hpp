@@ -41,15 +41,49 @@ namespace serial
   typedef buffer_vector<uint64_t, 32> DeltasT;
   typedef buffer_vector<m2::PointD, 32> OutPointsT;
 
+  /// Decode-side constants derived from CodingParams: the clamping max
+  /// point and the uint -> mercator scale factors. They depend only on
+  /// the coord bits, which are fixed when an mwm is opened, so a profile
+  /// is built once per mwm (see feature::SharedLoadInfo) instead of
+  /// being rederived for every feature geometry.
+  class DecodeProfile
+  {
+  public:
+    DecodeProfile();
+    explicit DecodeProfile(CodingParams const & params);
+
+    inline CodingParams const & GetParams() const { return m_params; }
+    inline m2::PointU const & GetMaxPoint() const { return m_maxPoint; }
+    inline double GetScaleX() const { return m_kx; }
+    inline double GetScaleY() const { return m_ky; }
+
+    /// The base point varies per feature for outer geometry while the
+    /// derived constants depend only on the coord bits, so changing it
+    /// keeps the profile valid.
+    inline void SetBasePoint(m2::PointD const & pt) { m_params.SetBasePoint(pt); }
+
+  private:
+    CodingParams m_params;
+    m2::PointU m_maxPoint;
+    double m_kx;
+    double m_ky;
+  };
+
   void Encode(EncodeFunT fn, vector<m2::PointD> const & points, CodingParams const & params,
               DeltasT & deltas);
 
   /// @name Overloads for different out container types.
+  /// The CodingParams overloads build a DecodeProfile per call and suit
+  /// one-off decoding; hot paths pass a precomputed profile.
   //@{
   void Decode(DecodeFunT fn, DeltasT const & deltas, CodingParams const & params,
               OutPointsT & points, size_t reserveF = 1);
   void Decode(DecodeFunT fn, DeltasT const & deltas, CodingParams const & params,
               vector<m2::PointD> & points, size_t reserveF = 1);
+  void Decode(DecodeFunT fn, DeltasT const & deltas, DecodeProfile const & profile,
+              OutPointsT & points, size_t reserveF = 1);
+  void Decode(DecodeFunT fn, DeltasT const & deltas, DecodeProfile const & profile,
+              vector<m2::PointD> & points, size_t reserveF = 1);
   //@}
 
   template <class TSink>
@@ -99,19 +133,26 @@ namespace serial
 
   void const * LoadInner(DecodeFunT fn, void const * pBeg, size_t count,
                          CodingParams const & params, OutPointsT & points);
+  void const * LoadInner(DecodeFunT fn, void const * pBeg, size_t count,
+                         DecodeProfile const & profile, OutPointsT & points);
 
-  template <class TSource, class TPoints>
-  void LoadOuter(DecodeFunT fn, TSource & src, CodingParams const & params,
+  /// |TParams| is CodingParams or DecodeProfile, see Decode overloads.
+  template <class TSource, class TParams, class TPoints>
+  void LoadOuter(DecodeFunT fn, TSource & src, TParams const & params,
                  TPoints & points, size_t reserveF = 1)
   {
     uint32_t const count = ReadVarUint<uint32_t>(src);
-    vector<char> buffer(count);
+    // Stack storage covers most outer geometries at the drawing scales, so
+    // this loop does not hit the heap for every feature.
+    buffer_vector<char, 256> buffer(count);
     char * p = &buffer[0];
     src.Read(p, count);
 
+    // One byte per varint is the worst case, so a single resize covers any
+    // input and the bulk decoder writes straight into the array.
     DeltasT deltas;
-    deltas.reserve(count / 2);
-    ReadVarUint64Array(p, p + count, MakeBackInsertFunctor(deltas));
+    deltas.resize(count);
+    deltas.resize(ReadVarUint64Block(p, p + count, count, deltas.data()));
 
     Decode(fn, deltas, params, points, reserveF);
   }
@@ -136,8 +177,14 @@ namespace serial
     return LoadInner(&geo_coding::DecodePolyline, pBeg, count, params, points);
   }
 
-  template <class TSource, class TPoints>
-  void LoadOuterPath(TSource & src, CodingParams const & params, TPoints & points)
+  inline void const * LoadInnerPath(void const * pBeg, size_t count, DecodeProfile const & profile,
+                                    OutPointsT & points)
+  {
+    return LoadInner(&geo_coding::DecodePolyline, pBeg, count, profile, points);
+  }
+
+  template <class TSource, class TParams, class TPoints>
+  void LoadOuterPath(TSource & src, TParams const & params, TPoints & points)
   {
     LoadOuter(&geo_coding::DecodePolyline, src, params, points);
   }
@@ -158,6 +205,12 @@ namespace serial
     return LoadInner(&geo_coding::DecodeTriangleStrip, pBeg, count, params, points);
   }
 
+  inline void const * LoadInnerTriangles(void const * pBeg, size_t count,
+                                         DecodeProfile const & profile, OutPointsT & points)
+  {
+    return LoadInner(&geo_coding::DecodeTriangleStrip, pBeg, count, profile, points);
+  }
+
   class TrianglesChainSaver
   {
     using TPoint = m2::PointU;
@@ -203,8 +256,8 @@ namespace serial
                        m2::PointU const & maxPoint,
                        geo_coding::OutPointsT & triangles);
 
-  template <class TSource>
-  void LoadOuterTriangles(TSource & src, CodingParams const & params, OutPointsT & triangles)
+  template <class TSource, class TParams>
+  void LoadOuterTriangles(TSource & src, TParams const & params, OutPointsT & triangles)
   {
     uint32_t const count = ReadVarUint<uint32_t>(src);
 
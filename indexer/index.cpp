@@ -80,6 +80,12 @@ pair<MwmSet::MwmId, MwmSet::RegResult> Index::RegisterMap(LocalCountryFile const
   return Register(localFile);
 }
 
+pair<MwmSet::MwmId, MwmSet::RegResult> Index::RegisterMap(LocalCountryFile const & localFile,
+                                                          unique_ptr<MwmInfo> info)
+{
+  return Register(localFile, move(info));
+}
+
 bool Index::DeregisterMap(CountryFile const & countryFile) { return Deregister(countryFile); }
 
 //////////////////////////////////////////////////////////////////////////////////
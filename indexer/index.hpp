@@ -73,6 +73,10 @@ public:
   /// Registers a new map.
   pair<MwmId, RegResult> RegisterMap(platform::LocalCountryFile const & localFile);
 
+  /// Registers a new map with MwmInfo prepared by ParseInfo().
+  pair<MwmId, RegResult> RegisterMap(platform::LocalCountryFile const & localFile,
+                                     unique_ptr<MwmInfo> info);
+
   /// Deregisters a map from internal records.
   ///
   /// \param countryFile A countryFile denoting a map to be deregistered.
@@ -121,35 +125,54 @@ private:
         CheckUniqueIndexes checkUnique(header.GetFormat() >= version::Format::v5);
         MwmId const & mwmID = handle.GetId();
 
+        // Enumeration through the interval index and reading of the
+        // features are split into two stages: the index pages stay hot
+        // while all intervals are walked, and the collected ids are then
+        // read with sorted, batched I/O instead of one scattered read per
+        // traversal hit.
+        vector<uint32_t> indexes;
         for (auto const & i : interval)
         {
           index.ForEachInIntervalAndScale(
               [&](uint32_t index)
               {
-                if (!checkUnique(index))
-                  return;
-
-                FeatureType feature;
-                switch (m_editor.GetFeatureStatus(mwmID, index))
-                {
-                case osm::Editor::FeatureStatus::Deleted:
-                case osm::Editor::FeatureStatus::Obsolete:
-                  return;
-                case osm::Editor::FeatureStatus::Modified:
-                  VERIFY(m_editor.GetEditedFeature(mwmID, index, feature), ());
-                  m_f(feature);
-                  return;
-                case osm::Editor::FeatureStatus::Created:
-                  CHECK(false, ("Created features index should be generated."));
-                case osm::Editor::FeatureStatus::Untouched: break;
-                }
-
-                fv.GetByIndex(index, feature);
-                feature.SetID(FeatureID(mwmID, index));
-                m_f(feature);
+                if (checkUnique(index))
+                  indexes.push_back(index);
               },
               i.first, i.second, scale);
         }
+        sort(indexes.begin(), indexes.end());
+
+        // One feature instance is reused for all matched indexes:
+        // Deserialize() re-binds it to the next offset keeping the
+        // capacity of its internal buffers.
+        FeatureType feature;
+
+        vector<uint32_t> untouched;
+        untouched.reserve(indexes.size());
+        for (uint32_t index : indexes)
+        {
+          switch (m_editor.GetFeatureStatus(mwmID, index))
+          {
+          case osm::Editor::FeatureStatus::Deleted:
+          case osm::Editor::FeatureStatus::Obsolete:
+            continue;
+          case osm::Editor::FeatureStatus::Modified:
+            VERIFY(m_editor.GetEditedFeature(mwmID, index, feature), ());
+            m_f(feature);
+            continue;
+          case osm::Editor::FeatureStatus::Created:
+            CHECK(false, ("Created features index should be generated."));
+          case osm::Editor::FeatureStatus::Untouched: break;
+          }
+          untouched.push_back(index);
+        }
+
+        fv.ReadBatch(untouched, [&](FeatureType & ft, uint32_t index)
+                     {
+                       ft.SetID(FeatureID(mwmID, index));
+                       m_f(ft);
+                     });
       }
     }
   };
@@ -238,36 +261,69 @@ public:
     while (fidIter != endIter)
     {
       MwmId const & id = fidIter->m_mwmId;
+
+      auto mwmEnd = fidIter;
+      while (mwmEnd != endIter && id == mwmEnd->m_mwmId)
+        ++mwmEnd;
+
       MwmHandle const handle = GetMwmHandleById(id);
       if (handle.IsAlive())
       {
         MwmValue const * pValue = handle.GetValue<MwmValue>();
         FeaturesVector const featureReader(pValue->m_cont, pValue->GetHeader(),
                                            pValue->m_table.get());
-        do
+
+        // When no feature of the span is touched by the editor - the common
+        // case - the whole span is read in a batch, coalescing reads of
+        // records that are close to each other in the data file.
+        bool hasEdited = false;
+        vector<uint32_t> indexes;
+        indexes.reserve(distance(fidIter, mwmEnd));
+        for (auto it = fidIter; it != mwmEnd; ++it)
         {
-          osm::Editor::FeatureStatus const fts = editor.GetFeatureStatus(id, fidIter->m_index);
+          osm::Editor::FeatureStatus const fts = editor.GetFeatureStatus(id, it->m_index);
           ASSERT_NOT_EQUAL(osm::Editor::FeatureStatus::Deleted, fts,
                            ("Deleted feature was cached. It should not be here. Please review your code."));
-          FeatureType featureType;
-          if (fts == osm::Editor::FeatureStatus::Modified || fts == osm::Editor::FeatureStatus::Created)
+          if (fts == osm::Editor::FeatureStatus::Modified ||
+              fts == osm::Editor::FeatureStatus::Created)
           {
-            VERIFY(editor.GetEditedFeature(id, fidIter->m_index, featureType), ());
+            hasEdited = true;
+            break;
           }
-          else
+          indexes.push_back(it->m_index);
+        }
+
+        if (!hasEdited)
+        {
+          featureReader.ReadBatch(indexes, [&](FeatureType & featureType, uint32_t index)
+                                  {
+                                    featureType.SetID(FeatureID(id, index));
+                                    f(featureType);
+                                  });
+        }
+        else
+        {
+          FeatureType featureType;
+          for (auto it = fidIter; it != mwmEnd; ++it)
           {
-            featureReader.GetByIndex(fidIter->m_index, featureType);
-            featureType.SetID(*fidIter);
+            osm::Editor::FeatureStatus const fts = editor.GetFeatureStatus(id, it->m_index);
+            if (fts == osm::Editor::FeatureStatus::Modified ||
+                fts == osm::Editor::FeatureStatus::Created)
+            {
+              VERIFY(editor.GetEditedFeature(id, it->m_index, featureType), ());
+            }
+            else
+            {
+              featureReader.GetByIndex(it->m_index, featureType);
+              featureType.SetID(*it);
+            }
+            f(featureType);
           }
-          f(featureType);
         }
-        while (++fidIter != endIter && id == fidIter->m_mwmId);
-      }
-      else
-      {
-        // Skip unregistered mwm files.
-        while (++fidIter != endIter && id == fidIter->m_mwmId);
       }
+
+      // Skip unregistered mwm files.
+      fidIter = mwmEnd;
     }
   }
 
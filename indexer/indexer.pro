@@ -13,6 +13,7 @@ SOURCES += \
     altitude_loader.cpp \
     categories_holder.cpp \
     categories_holder_loader.cpp \
+    categories_cbv.cpp \
     categories_index.cpp \
     centers_table.cpp \
     classificator.cpp \
@@ -52,6 +53,7 @@ SOURCES += \
     mwm_set.cpp \
     new_feature_categories.cpp \  # it's in indexer because of CategoriesHolder dependency.
     old/feature_loader_101.cpp \
+    opening_hours_cache.cpp \
     osm_editor.cpp \
     point_to_int64.cpp \
     postcodes_matcher.cpp \  # it's in indexer due to editor wich is in indexer and depends on postcodes_marcher
@@ -67,6 +69,7 @@ HEADERS += \
     altitude_loader.hpp \
     banners.hpp \
     categories_holder.hpp \
+    categories_cbv.hpp \
     categories_index.hpp \
     cell_coverer.hpp \
     cell_id.hpp \
@@ -115,6 +118,7 @@ HEADERS += \
     new_feature_categories.hpp \  # it's in indexer because of CategoriesHolder dependency.
     old/feature_loader_101.hpp \
     old/interval_index_101.hpp \
+    opening_hours_cache.hpp \
     osm_editor.hpp \
     point_to_int64.hpp \
     postcodes_matcher.hpp \   # it's in indexer due to editor wich is in indexer and depends on postcodes_marcher
@@ -0,0 +1,68 @@
+#include "testing/testing.hpp"
+
+#include "indexer/categories_cbv.hpp"
+
+#include "platform/platform.hpp"
+
+#include "coding/file_container.hpp"
+#include "coding/file_writer.hpp"
+
+#include "base/scope_guard.hpp"
+
+#include "std/bind.hpp"
+#include "std/map.hpp"
+#include "std/string.hpp"
+#include "std/utility.hpp"
+#include "std/vector.hpp"
+
+#include "defines.hpp"
+
+UNIT_TEST(CategoriesCBV_SerializationSmoke)
+{
+  string const path = GetPlatform().WritablePathForFile("categories_cbv_test.mwm");
+  MY_SCOPE_GUARD(cleanup, bind(&FileWriter::DeleteFileX, path));
+
+  map<uint32_t, vector<uint64_t>> typeFeatures;
+  // Unsorted with a duplicate: Serialize must handle both.
+  typeFeatures[10] = {5, 1, 3, 3};
+  typeFeatures[42] = {100000};
+
+  {
+    FilesContainerW cont(path);
+    FileWriter writer = cont.GetWriter(CATEGORIES_CBVS_FILE_TAG);
+    search::CategoriesCBV::Serialize(writer, move(typeFeatures));
+  }
+
+  FilesContainerR cont(path);
+  auto cbvs = search::CategoriesCBV::Load(cont);
+  TEST(cbvs.get(), ());
+
+  auto const * first = cbvs->Get(10);
+  TEST(first, ());
+  TEST_EQUAL(first->PopCount(), 3, ());
+  TEST(first->GetBit(1) && first->GetBit(3) && first->GetBit(5), ());
+  TEST(!first->GetBit(2), ());
+
+  TEST(cbvs->Get(11) == nullptr, ());
+
+  auto second = cbvs->Take(42);
+  TEST(second.get(), ());
+  TEST(second->GetBit(100000), ());
+  TEST(cbvs->Get(42) == nullptr, ());
+}
+
+UNIT_TEST(CategoriesCBV_AbsentSection)
+{
+  string const path = GetPlatform().WritablePathForFile("categories_cbv_test.mwm");
+  MY_SCOPE_GUARD(cleanup, bind(&FileWriter::DeleteFileX, path));
+
+  {
+    FilesContainerW cont(path);
+    FileWriter writer = cont.GetWriter("dummy");
+    uint8_t const zero = 0;
+    writer.Write(&zero, sizeof(zero));
+  }
+
+  FilesContainerR cont(path);
+  TEST(search::CategoriesCBV::Load(cont) == nullptr, ());
+}
@@ -88,6 +88,31 @@ UNIT_TEST(Feature_Serialization)
   }
 }
 
+UNIT_TEST(Feature_Metadata_DeserializeSubset)
+{
+  Metadata original;
+  for (auto const & value : kKeyValues)
+    original.Set(value.first, value.second);
+
+  vector<char> buffer;
+  MemWriter<decltype(buffer)> writer(buffer);
+  original.Serialize(writer);
+
+  MemReader reader(buffer.data(), buffer.size());
+  ReaderSource<MemReader> src(reader);
+
+  Metadata subset;
+  subset.DeserializeSubset(src, &Metadata::IsHotType);
+
+  // Only the hot entry survives; the cold url and email are skipped.
+  TEST_EQUAL(subset.Size(), 1, ());
+  TEST_EQUAL(subset.Get(Metadata::FMD_CUISINE), kKeyValues.find(Metadata::FMD_CUISINE)->second, ());
+  TEST_EQUAL(subset.Get(Metadata::FMD_URL), "", ());
+
+  // The whole blob is consumed even though most of it is skipped.
+  TEST_EQUAL(src.Size(), 0, ());
+}
+
 UNIT_TEST(Feature_Metadata_GetWikipedia)
 {
   Metadata m;
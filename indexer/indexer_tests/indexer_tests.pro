@@ -28,6 +28,7 @@ HEADERS += \
 
 SOURCES += \
     ../../testing/testingmain.cpp \
+    categories_cbv_test.cpp \
     categories_test.cpp \
     cell_coverer_test.cpp \
     cell_id_test.cpp \
@@ -46,6 +47,7 @@ SOURCES += \
     index_test.cpp \
     interval_index_test.cpp \
     mwm_set_test.cpp \
+    opening_hours_cache_test.cpp \
     osm_editor_test.cpp \
     point_to_int64_test.cpp \
     postcodes_matcher_tests.cpp \
@@ -157,3 +157,88 @@ UNIT_TEST(MwmSetLockAndIdTest)
   TEST(!handle.GetId().IsAlive(), ());
   TEST(!handle.GetId().GetInfo().get(), ());
 }
+
+UNIT_TEST(MwmSetHandleStatsTest)
+{
+  TestMwmSet mwmSet;
+  UNUSED_VALUE(mwmSet.Register(LocalCountryFile::MakeForTesting("1")));
+  UNUSED_VALUE(mwmSet.Register(LocalCountryFile::MakeForTesting("2")));
+
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("1"));
+    TEST(handle.IsAlive(), ());
+    MwmSet::HandleStats const stats = mwmSet.GetHandleStats();
+    TEST_EQUAL(stats.m_lockCount, 1, ());
+    TEST_EQUAL(stats.m_createCount, 1, ());
+    TEST_EQUAL(stats.m_cacheHitCount, 0, ());
+    TEST_EQUAL(stats.m_activeCount, 1, ());
+    TEST_EQUAL(stats.m_cachedCount, 0, ());
+  }
+
+  {
+    // The value released above must be served from the idle cache.
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("1"));
+    MwmSet::HandleStats const stats = mwmSet.GetHandleStats();
+    TEST_EQUAL(stats.m_lockCount, 2, ());
+    TEST_EQUAL(stats.m_createCount, 1, ());
+    TEST_EQUAL(stats.m_cacheHitCount, 1, ());
+  }
+
+  // With a budget of one open value locking another mwm must close the
+  // idle one first.
+  mwmSet.SetOpenValueBudget(1);
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("2"));
+    TEST(handle.IsAlive(), ());
+    MwmSet::HandleStats const stats = mwmSet.GetHandleStats();
+    TEST_EQUAL(stats.m_createCount, 2, ());
+    TEST_EQUAL(stats.m_evictCount, 1, ());
+    TEST_EQUAL(stats.m_activeCount, 1, ());
+    TEST_EQUAL(stats.m_cachedCount, 0, ());
+  }
+}
+
+UNIT_TEST(MwmSetCostAwareEvictionTest)
+{
+  TestMwmSet mwmSet;
+  UNUSED_VALUE(mwmSet.Register(LocalCountryFile::MakeForTesting("1")));
+  UNUSED_VALUE(mwmSet.Register(LocalCountryFile::MakeForTesting("2")));
+
+  // Lock mwm 1 several times so it becomes more valuable to keep than
+  // the once-locked mwm 2.
+  for (size_t i = 0; i < 3; ++i)
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("1"));
+    TEST(handle.IsAlive(), ());
+  }
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("2"));
+    TEST(handle.IsAlive(), ());
+  }
+
+  // Both idle values are cached now; test files have no size on disk, so
+  // each is charged one byte.
+  MwmSet::HandleStats stats = mwmSet.GetHandleStats();
+  TEST_EQUAL(stats.m_cachedCount, 2, ());
+  TEST_EQUAL(stats.m_cachedBytes, 2, ());
+  TEST_EQUAL(stats.m_cacheHitCount, 2, ());
+
+  // A byte budget of one must evict mwm 2, not the older but frequently
+  // locked mwm 1.
+  mwmSet.SetCacheByteBudget(1);
+  stats = mwmSet.GetHandleStats();
+  TEST_EQUAL(stats.m_cachedCount, 1, ());
+  TEST_EQUAL(stats.m_cachedBytes, 1, ());
+  TEST_EQUAL(stats.m_evictCount, 1, ());
+
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("1"));
+    TEST(handle.IsAlive(), ());
+    TEST_EQUAL(mwmSet.GetHandleStats().m_cacheHitCount, 3, ());
+  }
+  {
+    MwmSet::MwmHandle const handle = mwmSet.GetMwmHandleByCountryFile(CountryFile("2"));
+    TEST(handle.IsAlive(), ());
+    TEST_EQUAL(mwmSet.GetHandleStats().m_createCount, 3, ());
+  }
+}
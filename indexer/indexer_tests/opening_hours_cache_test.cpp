@@ -0,0 +1,22 @@
+#include "testing/testing.hpp"
+
+#include "indexer/opening_hours_cache.hpp"
+
+#include "3party/opening_hours/opening_hours.hpp"
+
+UNIT_TEST(OpeningHoursCache_Smoke)
+{
+  auto const first = osm::GetCachedOpeningHours("24/7");
+  TEST(first->IsValid(), ());
+
+  // A repeated string must hit the cache instead of being reparsed.
+  auto const second = osm::GetCachedOpeningHours("24/7");
+  TEST_EQUAL(first.get(), second.get(), ());
+
+  TEST(osm::GetCachedOpeningHours("Mo-Fr 09:00-18:00")->IsValid(), ());
+  TEST(!osm::GetCachedOpeningHours("garbage")->IsValid(), ());
+
+  // The cached entries survive other strings passing through the cache.
+  auto const third = osm::GetCachedOpeningHours("24/7");
+  TEST_EQUAL(first.get(), third.get(), ());
+}
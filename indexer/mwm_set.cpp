@@ -7,6 +7,7 @@
 #include "base/exception.hpp"
 #include "base/logging.hpp"
 #include "base/stl_add.hpp"
+#include "base/timer.hpp"
 
 #include "std/algorithm.hpp"
 #include "std/exception.hpp"
@@ -17,7 +18,11 @@
 using platform::CountryFile;
 using platform::LocalCountryFile;
 
-MwmInfo::MwmInfo() : m_minScale(0), m_maxScale(0), m_status(STATUS_DEREGISTERED), m_numRefs(0) {}
+MwmInfo::MwmInfo()
+  : m_minScale(0), m_maxScale(0), m_status(STATUS_DEREGISTERED), m_numRefs(0), m_numLocks(0),
+    m_numOpens(0), m_loadTimeMs(0.0)
+{
+}
 
 MwmInfo::MwmTypeT MwmInfo::GetType() const
 {
@@ -86,6 +91,17 @@ MwmSet::MwmId MwmSet::GetMwmIdByCountryFileImpl(CountryFile const & countryFile)
 }
 
 pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const & localFile)
+{
+  return Register(localFile, nullptr /* info */);
+}
+
+unique_ptr<MwmInfo> MwmSet::ParseInfo(LocalCountryFile const & localFile) const
+{
+  return CreateInfo(localFile);
+}
+
+pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const & localFile,
+                                                        unique_ptr<MwmInfo> info)
 {
   pair<MwmSet::MwmId, MwmSet::RegResult> result;
   auto registerFile = [&](EventList & events)
@@ -94,24 +110,24 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
     MwmId const id = GetMwmIdByCountryFileImpl(countryFile);
     if (!id.IsAlive())
     {
-      result = RegisterImpl(localFile, events);
+      result = RegisterImpl(localFile, move(info), events);
       return;
     }
 
-    shared_ptr<MwmInfo> info = id.GetInfo();
+    shared_ptr<MwmInfo> oldInfo = id.GetInfo();
 
     // Deregister old mwm for the country.
-    if (info->GetVersion() < localFile.GetVersion())
+    if (oldInfo->GetVersion() < localFile.GetVersion())
     {
       EventList subEvents;
       DeregisterImpl(id, subEvents);
-      result = RegisterImpl(localFile, subEvents);
+      result = RegisterImpl(localFile, move(info), subEvents);
 
       // In the case of success all sub-events are
       // replaced with a single UPDATE event. Otherwise,
       // sub-events are reported as is.
       if (result.second == MwmSet::RegResult::Success)
-        events.Add(Event(Event::TYPE_UPDATED, localFile, info->GetLocalFile()));
+        events.Add(Event(Event::TYPE_UPDATED, localFile, oldInfo->GetLocalFile()));
       else
         events.Append(subEvents);
       return;
@@ -119,17 +135,17 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
 
     string const name = countryFile.GetName();
     // Update the status of the mwm with the same version.
-    if (info->GetVersion() == localFile.GetVersion())
+    if (oldInfo->GetVersion() == localFile.GetVersion())
     {
       LOG(LINFO, ("Updating already registered mwm:", name));
-      SetStatus(*info, MwmInfo::STATUS_REGISTERED, events);
-      info->m_file = localFile;
+      SetStatus(*oldInfo, MwmInfo::STATUS_REGISTERED, events);
+      oldInfo->m_file = localFile;
       result = make_pair(id, RegResult::VersionAlreadyExists);
       return;
     }
 
     LOG(LWARNING, ("Trying to add too old (", localFile.GetVersion(), ") mwm (", name,
-                   "), current version:", info->GetVersion()));
+                   "), current version:", oldInfo->GetVersion()));
     result = make_pair(MwmId(), RegResult::VersionTooOld);
     return;
   };
@@ -139,10 +155,11 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
 }
 
 pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::RegisterImpl(LocalCountryFile const & localFile,
+                                                            unique_ptr<MwmInfo> preparedInfo,
                                                             EventList & events)
 {
   // This function can throw an exception for a bad mwm file.
-  shared_ptr<MwmInfo> info(CreateInfo(localFile));
+  shared_ptr<MwmInfo> info(preparedInfo ? move(preparedInfo) : CreateInfo(localFile));
   if (!info)
     return make_pair(MwmId(), RegResult::UnsupportedFileFormat);
 
@@ -278,6 +295,8 @@ unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventLi
   //  return TMwmValueBasePtr();
 
   ++info->m_numRefs;
+  ++info->m_numLocks;
+  ++m_lockCount;
 
   // Search in cache.
   for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
@@ -286,16 +305,45 @@ unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventLi
     {
       unique_ptr<MwmValueBase> result = move(it->second);
       m_cache.erase(it);
+      ++m_cacheHitCount;
+      ++m_activeCount;
       return result;
     }
   }
 
+  // Close idle values first, so opening a new container fits the budget.
+  EnforceValueBudget(1 /* newValuesCount */);
+
   try
   {
-    return CreateValue(*info);
+    my::Timer timer;
+    unique_ptr<MwmValueBase> result = CreateValue(*info);
+    UpdateLoadCost(*info, timer.ElapsedSeconds() * 1000.0);
+    ++m_createCount;
+    ++m_activeCount;
+    return result;
   }
   catch (Reader::TooManyFilesException const & ex)
   {
+    // The budget turned out to be higher than the OS limit: close all idle
+    // values and retry once.
+    if (!m_cache.empty())
+    {
+      m_evictCount += m_cache.size();
+      ClearCacheImpl(m_cache.begin(), m_cache.end());
+      try
+      {
+        my::Timer timer;
+        unique_ptr<MwmValueBase> result = CreateValue(*info);
+        UpdateLoadCost(*info, timer.ElapsedSeconds() * 1000.0);
+        ++m_createCount;
+        ++m_activeCount;
+        return result;
+      }
+      catch (Reader::TooManyFilesException const &)
+      {
+      }
+    }
     LOG(LERROR, ("Too many open files, can't open:", info->GetCountryName()));
     --info->m_numRefs;
     return nullptr;
@@ -328,6 +376,8 @@ void MwmSet::UnlockValueImpl(MwmId const & id, unique_ptr<MwmValueBase> p, Event
   shared_ptr<MwmInfo> const & info = id.GetInfo();
   ASSERT_GREATER(info->m_numRefs, 0, ());
   --info->m_numRefs;
+  ASSERT_GREATER(m_activeCount, 0, ());
+  --m_activeCount;
   if (info->m_numRefs == 0 && info->GetStatus() == MwmInfo::STATUS_MARKED_TO_DEREGISTER)
     VERIFY(DeregisterImpl(id, events), ());
 
@@ -340,8 +390,9 @@ void MwmSet::UnlockValueImpl(MwmId const & id, unique_ptr<MwmValueBase> p, Event
     if (m_cache.size() > m_cacheSize)
     {
       ASSERT_EQUAL(m_cache.size(), m_cacheSize + 1, ());
-      m_cache.pop_front();
+      EvictVictim();
     }
+    EnforceValueBudget(0 /* newValuesCount */);
   }
 }
 
@@ -397,6 +448,102 @@ void MwmSet::ClearCacheImpl(CacheType::iterator beg, CacheType::iterator end)
   m_cache.erase(beg, end);
 }
 
+void MwmSet::EnforceValueBudget(size_t newValuesCount)
+{
+  while (!m_cache.empty() && m_activeCount + m_cache.size() + newValuesCount > m_valueBudget)
+    EvictVictim();
+  while (m_cacheByteBudget != 0 && !m_cache.empty() && GetCachedBytes() > m_cacheByteBudget)
+    EvictVictim();
+}
+
+MwmSet::CacheType::iterator MwmSet::GetEvictionVictim()
+{
+  ASSERT(!m_cache.empty(), ());
+
+  // The front of the deque is the least recently released value, so the
+  // first minimum keeps the choice LRU among equally weighted values.
+  auto victim = m_cache.begin();
+  double victimWeight = RetentionWeight(*victim->first.GetInfo());
+  for (auto it = m_cache.begin() + 1; it != m_cache.end(); ++it)
+  {
+    double const weight = RetentionWeight(*it->first.GetInfo());
+    if (weight < victimWeight)
+    {
+      victim = it;
+      victimWeight = weight;
+    }
+  }
+  return victim;
+}
+
+void MwmSet::EvictVictim()
+{
+  m_cache.erase(GetEvictionVictim());
+  ++m_evictCount;
+}
+
+uint64_t MwmSet::GetCachedBytes() const
+{
+  uint64_t bytes = 0;
+  for (auto const & p : m_cache)
+    bytes += GetValueCost(p.first);
+  return bytes;
+}
+
+// static
+uint64_t MwmSet::GetValueCost(MwmId const & id)
+{
+  // A value of unknown size is charged one byte, so the byte budget
+  // still bounds the number of such values.
+  return max(id.GetInfo()->GetLocalFile().GetSize(MapOptions::Map), uint64_t(1));
+}
+
+// static
+double MwmSet::RetentionWeight(MwmInfo const & info)
+{
+  // Frequently locked and expensive-to-open values are kept preferentially.
+  // The floor makes frequency decisive when load times were not measured
+  // yet or are all negligible.
+  double const kMinLoadTimeMs = 1.0e-2;
+  return info.m_numLocks * max(info.m_loadTimeMs, kMinLoadTimeMs);
+}
+
+// static
+void MwmSet::UpdateLoadCost(MwmInfo & info, double timeMs)
+{
+  ++info.m_numOpens;
+  info.m_loadTimeMs += (timeMs - info.m_loadTimeMs) / info.m_numOpens;
+}
+
+MwmSet::HandleStats MwmSet::GetHandleStats() const
+{
+  lock_guard<mutex> lock(m_lock);
+
+  HandleStats stats;
+  stats.m_lockCount = m_lockCount;
+  stats.m_cacheHitCount = m_cacheHitCount;
+  stats.m_createCount = m_createCount;
+  stats.m_evictCount = m_evictCount;
+  stats.m_activeCount = m_activeCount;
+  stats.m_cachedCount = m_cache.size();
+  stats.m_cachedBytes = GetCachedBytes();
+  return stats;
+}
+
+void MwmSet::SetOpenValueBudget(size_t budget)
+{
+  lock_guard<mutex> lock(m_lock);
+  m_valueBudget = max(budget, size_t(1));
+  EnforceValueBudget(0 /* newValuesCount */);
+}
+
+void MwmSet::SetCacheByteBudget(uint64_t budget)
+{
+  lock_guard<mutex> lock(m_lock);
+  m_cacheByteBudget = budget;
+  EnforceValueBudget(0 /* newValuesCount */);
+}
+
 void MwmSet::ClearCache(MwmId const & id)
 {
   auto sameId = [&id](pair<MwmSet::MwmId, unique_ptr<MwmSet::MwmValueBase>> const & p)
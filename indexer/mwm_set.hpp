@@ -11,6 +11,7 @@
 #include "indexer/feature_meta.hpp"
 
 #include "std/atomic.hpp"
+#include "std/cstdint.hpp"
 #include "std/deque.hpp"
 #include "std/map.hpp"
 #include "std/mutex.hpp"
@@ -73,6 +74,11 @@ public:
   /// Returns the lock counter value for test needs.
   uint8_t GetNumRefs() const { return m_numRefs; }
 
+  /// Total number of value locks and the average time to open a value.
+  /// Maintained by MwmSet for cost-aware cache eviction.
+  uint32_t GetNumLocks() const { return m_numLocks; }
+  double GetLoadTimeMs() const { return m_loadTimeMs; }
+
 protected:
   inline Status SetStatus(Status status)
   {
@@ -86,6 +92,9 @@ protected:
   platform::LocalCountryFile m_file;  ///< Path to the mwm file.
   atomic<Status> m_status;            ///< Current country status.
   uint32_t m_numRefs;                 ///< Number of active handles.
+  uint32_t m_numLocks;                ///< Total number of value locks.
+  uint32_t m_numOpens;                ///< Number of times a value was opened.
+  double m_loadTimeMs;                ///< Average time to open a value, ms.
 };
 
 class MwmSet
@@ -121,6 +130,19 @@ public:
   explicit MwmSet(size_t cacheSize = 64) : m_cacheSize(cacheSize) {}
   virtual ~MwmSet() = default;
 
+  /// Counters of mwm value (opened file container) usage for analyzing
+  /// handle churn. All *Count counters are cumulative.
+  struct HandleStats
+  {
+    uint64_t m_lockCount = 0;     ///< Total number of value locks.
+    uint64_t m_cacheHitCount = 0; ///< Locks served from the idle value cache.
+    uint64_t m_createCount = 0;   ///< Locks which had to open a container.
+    uint64_t m_evictCount = 0;    ///< Idle values closed to fit the budget.
+    size_t m_activeCount = 0;     ///< Values locked at the moment.
+    size_t m_cachedCount = 0;     ///< Idle values cached at the moment.
+    uint64_t m_cachedBytes = 0;   ///< Total size of the cached idle values.
+  };
+
   class MwmValueBase
   {
   public:
@@ -255,10 +277,24 @@ public:
   /// are older than the localFile (in this case mwm handle will point
   /// to just-registered file).
 protected:
-  pair<MwmId, RegResult> RegisterImpl(platform::LocalCountryFile const & localFile, EventList & events);
+  /// \param info MwmInfo prepared by ParseInfo() for localFile, or nullptr
+  ///             to parse it here.
+  pair<MwmId, RegResult> RegisterImpl(platform::LocalCountryFile const & localFile,
+                                      unique_ptr<MwmInfo> info, EventList & events);
 
 public:
   pair<MwmId, RegResult> Register(platform::LocalCountryFile const & localFile);
+
+  /// A variant of Register() that takes MwmInfo prepared by ParseInfo(), so
+  /// that the registration itself only inserts it under the lock.
+  pair<MwmId, RegResult> Register(platform::LocalCountryFile const & localFile,
+                                  unique_ptr<MwmInfo> info);
+
+  /// Parses the header of localFile and builds MwmInfo for it without
+  /// touching the mwm registry. This is the expensive part of Register()
+  /// and, unlike Register(), it is safe to call from several threads at
+  /// once, so infos for a batch of files can be prepared concurrently.
+  unique_ptr<MwmInfo> ParseInfo(platform::LocalCountryFile const & localFile) const;
   //@}
 
   /// @name Remove mwm.
@@ -308,6 +344,22 @@ public:
     return const_cast<MwmSet *>(this)->GetMwmHandleById(id);
   }
 
+  HandleStats GetHandleStats() const;
+
+  /// Limits the total number of open mwm containers: active locks plus the
+  /// idle value cache. When the budget is reached, idle values are closed
+  /// before a new container is opened. Active locks are never blocked, so
+  /// momentarily the budget can be exceeded by the number of active locks.
+  void SetOpenValueBudget(size_t budget);
+
+  /// Limits the total size in bytes of idle cached values; active locks
+  /// are not counted. When releasing a value would exceed the budget,
+  /// values which are cheap to reopen - rarely locked and fast to
+  /// deserialize - are closed first, so routing- and search-hot mwms
+  /// survive rendering of their once-touched neighbors. Zero (the
+  /// default) keeps only the count-based limits.
+  void SetCacheByteBudget(uint64_t budget);
+
 protected:
   virtual unique_ptr<MwmInfo> CreateInfo(platform::LocalCountryFile const & localFile) const = 0;
   virtual unique_ptr<MwmValueBase> CreateValue(MwmInfo & info) const = 0;
@@ -351,9 +403,41 @@ private:
   /// @precondition This function is always called under mutex m_lock.
   void ClearCacheImpl(CacheType::iterator beg, CacheType::iterator end);
 
+  /// Closes idle cached values until the open value and byte budgets are met.
+  /// @precondition This function is always called under mutex m_lock.
+  void EnforceValueBudget(size_t newValuesCount);
+
+  /// Returns the cached value which is the cheapest to reopen. With equal
+  /// weights the least recently released value is chosen, i.e. the policy
+  /// degrades to plain LRU.
+  /// @precondition m_cache is not empty and mutex m_lock is taken.
+  CacheType::iterator GetEvictionVictim();
+
+  /// @precondition This function is always called under mutex m_lock.
+  void EvictVictim();
+
+  /// Total size of the idle cached values. A value of unknown size is
+  /// charged one byte, so the byte budget still bounds their number.
+  /// @precondition This function is always called under mutex m_lock.
+  uint64_t GetCachedBytes() const;
+
+  static uint64_t GetValueCost(MwmId const & id);
+  static double RetentionWeight(MwmInfo const & info);
+  static void UpdateLoadCost(MwmInfo & info, double timeMs);
+
   CacheType m_cache;
   size_t const m_cacheSize;
 
+  static size_t const kDefaultOpenValueBudget = 128;
+  size_t m_valueBudget = kDefaultOpenValueBudget;
+  uint64_t m_cacheByteBudget = 0;  ///< Zero - no byte limit.
+
+  uint64_t m_lockCount = 0;
+  uint64_t m_cacheHitCount = 0;
+  uint64_t m_createCount = 0;
+  uint64_t m_evictCount = 0;
+  size_t m_activeCount = 0;
+
 protected:
   /// @precondition This function is always called under mutex m_lock.
   void ClearCache(MwmId const & id);
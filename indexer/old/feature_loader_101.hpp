@@ -35,7 +35,7 @@ namespace old_101 { namespace feature
     void ParseHeader2() override;
     uint32_t ParseGeometry(int scale) override;
     uint32_t ParseTriangles(int scale) override;
-    void ParseMetadata() override {}  /// not supported in this version
+    void ParseMetadata(bool /* hotOnly */) override {}  /// not supported in this version
   };
 }
 }
@@ -0,0 +1,44 @@
+#include "indexer/opening_hours_cache.hpp"
+
+#include "base/cache.hpp"
+
+#include "std/functional.hpp"
+#include "std/mutex.hpp"
+
+#include "3party/opening_hours/opening_hours.hpp"
+
+namespace osm
+{
+namespace
+{
+// 1024 entries cover the distinct strings of a search results page with
+// a good margin. The cache is hash-addressed, so a collision only costs
+// a reparse of the evicted string.
+uint32_t constexpr kLogCacheSize = 10;
+
+struct Entry
+{
+  string m_raw;
+  shared_ptr<osmoh::OpeningHours const> m_hours;
+};
+}  // namespace
+
+shared_ptr<osmoh::OpeningHours const> GetCachedOpeningHours(string const & openingHours)
+{
+  static mutex cacheMutex;
+  static my::Cache<uint64_t, Entry> cache(kLogCacheSize);
+
+  lock_guard<mutex> lock(cacheMutex);
+
+  bool found = false;
+  auto & entry = cache.Find(static_cast<uint64_t>(hash<string>()(openingHours)), found);
+  // The raw string is compared to protect from hash collisions: the
+  // cache addresses entries by the hash only.
+  if (!found || entry.m_raw != openingHours)
+  {
+    entry.m_raw = openingHours;
+    entry.m_hours = make_shared<osmoh::OpeningHours>(openingHours);
+  }
+  return entry.m_hours;
+}
+}  // namespace osm
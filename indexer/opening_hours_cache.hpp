@@ -0,0 +1,21 @@
+#pragma once
+
+#include "std/shared_ptr.hpp"
+#include "std/string.hpp"
+
+namespace osmoh
+{
+class OpeningHours;
+}
+
+namespace osm
+{
+/// Returns parsed |openingHours| from a process-wide cache, parsing and
+/// caching it on a miss. Raw opening hours strings repeat massively
+/// across features ("24/7", "Mo-Fr 09:00-18:00" and the like) and
+/// parsing is much more expensive than a lookup, so consumers which
+/// evaluate many features in a row (search results, hotel filtering)
+/// should not construct osmoh::OpeningHours directly.
+/// Thread-safe.
+shared_ptr<osmoh::OpeningHours const> GetCachedOpeningHours(string const & openingHours);
+}  // namespace osm
@@ -7,6 +7,7 @@
 #include "indexer/feature_meta.hpp"
 #include "indexer/ftypes_matcher.hpp"
 #include "indexer/index.hpp"
+#include "indexer/opening_hours_cache.hpp"
 #include "indexer/osm_editor.hpp"
 #include "indexer/index_helpers.hpp"
 
@@ -58,6 +59,10 @@ constexpr char const * kObsoleteSection = "obsolete";
 /// We store edited streets in OSM-compatible way.
 constexpr char const * kAddrStreetTag = "addr:street";
 
+// Guards Save()/SaveEdit() which may be called from different threads.
+// TODO(AlexZ): Improve synchronization in Editor code.
+mutex g_saveMutex;
+
 constexpr char const * kUploaded = "Uploaded";
 constexpr char const * kDeletedFromOSMServer = "Deleted from OSM by someone";
 constexpr char const * kRelationsAreNotSupported = "Relations are not supported yet";
@@ -172,6 +177,7 @@ void Editor::LoadMapEdits()
 
   // TODO(mgsergio): synchronize access to m_features.
   m_features.clear();
+  InvalidateCreatedFeaturesIndex();
   for (xml_node mwm : doc.child(kXmlRootNode).children(kXmlMwmNode))
   {
     string const mapName = mwm.attribute("name").as_string("");
@@ -252,6 +258,7 @@ void Editor::LoadMapEdits()
           }
           // Insert initialized structure at the end: exceptions are possible in above code.
           m_features[fid.m_mwmId].emplace(fid.m_index, move(fti));
+          InvalidateCreatedFeaturesIndex();
         }
         catch (editor::XMLFeatureError const & ex)
         {
@@ -276,11 +283,30 @@ void Editor::LoadMapEdits()
               created, "created,", deleted, "deleted and", obsolete, "obsolete features."));
 }
 
+// static
+XMLFeature Editor::SerializeEditedFeature(FeatureTypeInfo const & fti, uint32_t index)
+{
+  // TODO: Do we really need to serialize deleted features in full details? Looks like mwm ID and meta fields are enough.
+  XMLFeature xf = fti.m_feature.ToXML(true /*type serializing helps during migration*/);
+  xf.SetMWMFeatureIndex(index);
+  if (!fti.m_street.empty())
+    xf.SetTagValue(kAddrStreetTag, fti.m_street);
+  ASSERT_NOT_EQUAL(0, fti.m_modificationTimestamp, ());
+  xf.SetModificationTime(fti.m_modificationTimestamp);
+  if (fti.m_uploadAttemptTimestamp != my::INVALID_TIME_STAMP)
+  {
+    xf.SetUploadTime(fti.m_uploadAttemptTimestamp);
+    ASSERT(!fti.m_uploadStatus.empty(), ("Upload status updates with upload timestamp."));
+    xf.SetUploadStatus(fti.m_uploadStatus);
+    if (!fti.m_uploadError.empty())
+      xf.SetUploadError(fti.m_uploadError);
+  }
+  return xf;
+}
+
 bool Editor::Save() const
 {
-  // TODO(AlexZ): Improve synchronization in Editor code.
-  static mutex saveMutex;
-  lock_guard<mutex> lock(saveMutex);
+  lock_guard<mutex> lock(g_saveMutex);
 
   if (m_features.empty())
   {
@@ -304,21 +330,7 @@ bool Editor::Save() const
     for (auto const & index : mwm.second)
     {
       FeatureTypeInfo const & fti = index.second;
-      // TODO: Do we really need to serialize deleted features in full details? Looks like mwm ID and meta fields are enough.
-      XMLFeature xf = fti.m_feature.ToXML(true /*type serializing helps during migration*/);
-      xf.SetMWMFeatureIndex(index.first);
-      if (!fti.m_street.empty())
-        xf.SetTagValue(kAddrStreetTag, fti.m_street);
-      ASSERT_NOT_EQUAL(0, fti.m_modificationTimestamp, ());
-      xf.SetModificationTime(fti.m_modificationTimestamp);
-      if (fti.m_uploadAttemptTimestamp != my::INVALID_TIME_STAMP)
-      {
-        xf.SetUploadTime(fti.m_uploadAttemptTimestamp);
-        ASSERT(!fti.m_uploadStatus.empty(), ("Upload status updates with upload timestamp."));
-        xf.SetUploadStatus(fti.m_uploadStatus);
-        if (!fti.m_uploadError.empty())
-          xf.SetUploadError(fti.m_uploadError);
-      }
+      XMLFeature xf = SerializeEditedFeature(fti, index.first);
       switch (fti.m_status)
       {
       case FeatureStatus::Deleted: VERIFY(xf.AttachToParentNode(deleted), ()); break;
@@ -333,9 +345,49 @@ bool Editor::Save() const
   return m_storage->Save(doc);
 }
 
+bool Editor::SaveEdit(FeatureID const & fid) const
+{
+  {
+    lock_guard<mutex> lock(g_saveMutex);
+
+    auto const * fti = GetFeatureTypeInfo(fid.m_mwmId, fid.m_index);
+    if (fti != nullptr)
+    {
+      xml_document edit;
+      xml_node root = edit.append_child(kXmlRootNode);
+      root.append_attribute("format_version") = 1;
+      xml_node mwmNode = root.append_child(kXmlMwmNode);
+      mwmNode.append_attribute("name") = fid.m_mwmId.GetInfo()->GetCountryName().c_str();
+      mwmNode.append_attribute("version") =
+          static_cast<long long>(fid.m_mwmId.GetInfo()->GetVersion());
+
+      char const * section = nullptr;
+      switch (fti->m_status)
+      {
+      case FeatureStatus::Deleted: section = kDeleteSection; break;
+      case FeatureStatus::Modified: section = kModifySection; break;
+      case FeatureStatus::Created: section = kCreateSection; break;
+      case FeatureStatus::Obsolete: section = kObsoleteSection; break;
+      case FeatureStatus::Untouched: CHECK(false, ("Not edited features shouldn't be here."));
+      }
+
+      XMLFeature xf = SerializeEditedFeature(*fti, fid.m_index);
+      VERIFY(xf.AttachToParentNode(mwmNode.append_child(section)), ());
+
+      if (m_storage->AppendEdit(edit))
+        return true;
+    }
+  }
+
+  // The storage either asks for a compaction or does not support
+  // incremental writes at all; rewrite all the edits at once.
+  return Save();
+}
+
 void Editor::ClearAllLocalEdits()
 {
   m_features.clear();
+  InvalidateCreatedFeaturesIndex();
   Save();
   Invalidate();
 }
@@ -355,6 +407,7 @@ void Editor::OnMapDeregistered(platform::LocalCountryFile const & localFile)
   if (m_features.end() != matchedMwm)
   {
     m_features.erase(matchedMwm);
+    InvalidateCreatedFeaturesIndex();
     Save();
   }
 }
@@ -400,7 +453,7 @@ void Editor::DeleteFeature(FeatureID const & fid)
   MarkFeatureWithStatus(fid, FeatureStatus::Deleted);
 
   // TODO(AlexZ): Synchronize Save call/make it on a separate thread.
-  Save();
+  SaveEdit(fid);
   Invalidate();
 }
 
@@ -530,9 +583,10 @@ Editor::SaveResult Editor::SaveEditedFeature(EditableMapObject const & emo)
   // Reset upload status so already uploaded features can be uploaded again after modification.
   fti.m_uploadStatus = {};
   m_features[fid.m_mwmId][fid.m_index] = move(fti);
+  InvalidateCreatedFeaturesIndex();
 
   // TODO(AlexZ): Synchronize Save call/make it on a separate thread.
-  bool const savedSuccessfully = Save();
+  bool const savedSuccessfully = SaveEdit(fid);
   Invalidate();
   return savedSuccessfully ? SavedSuccessfully : NoFreeSpaceError;
 }
@@ -550,19 +604,13 @@ void Editor::ForEachFeatureInMwmRectAndScale(MwmSet::MwmId const & id,
                                              m2::RectD const & rect,
                                              int /*scale*/)
 {
-  auto const mwmFound = m_features.find(id);
-  if (mwmFound == m_features.end())
-    return;
-
   // TODO(AlexZ): Check that features are visible at this scale.
   // Process only new (created) features.
-  for (auto const & index : mwmFound->second)
-  {
-    FeatureTypeInfo const & ftInfo = index.second;
-    if (ftInfo.m_status == FeatureStatus::Created &&
-        rect.IsPointInside(ftInfo.m_feature.GetCenter()))
-      f(FeatureID(id, index.first));
-  }
+  auto const * index = GetCreatedFeaturesIndex(id);
+  if (index == nullptr)
+    return;
+
+  index->ForEachInRect(rect, [&](uint32_t featureIndex) { f(FeatureID(id, featureIndex)); });
 }
 
 void Editor::ForEachFeatureInMwmRectAndScale(MwmSet::MwmId const & id,
@@ -570,19 +618,47 @@ void Editor::ForEachFeatureInMwmRectAndScale(MwmSet::MwmId const & id,
                                              m2::RectD const & rect,
                                              int /*scale*/)
 {
-  auto mwmFound = m_features.find(id);
-  if (mwmFound == m_features.end())
-    return;
-
   // TODO(AlexZ): Check that features are visible at this scale.
   // Process only new (created) features.
-  for (auto & index : mwmFound->second)
+  auto const * index = GetCreatedFeaturesIndex(id);
+  if (index == nullptr)
+    return;
+
+  index->ForEachInRect(rect, [&](uint32_t featureIndex) {
+    auto * ftInfo = GetFeatureTypeInfo(id, featureIndex);
+    ASSERT(ftInfo != nullptr, ("The spatial index is out of sync with m_features."));
+    if (ftInfo != nullptr)
+      f(ftInfo->m_feature);
+  });
+}
+
+m4::Tree<uint32_t> const * Editor::GetCreatedFeaturesIndex(MwmSet::MwmId const & id) const
+{
+  if (!m_createdFeaturesIndexIsValid)
   {
-    FeatureTypeInfo & ftInfo = index.second;
-    if (ftInfo.m_status == FeatureStatus::Created &&
-        rect.IsPointInside(ftInfo.m_feature.GetCenter()))
-      f(ftInfo.m_feature);
+    // Keeps features lying exactly on a query rect border, as the
+    // IsPointInside check of the linear scan did.
+    double constexpr kEps = 1.0E-9;
+
+    m_createdFeaturesIndex.clear();
+    for (auto const & mwm : m_features)
+    {
+      for (auto const & index : mwm.second)
+      {
+        FeatureTypeInfo const & ftInfo = index.second;
+        if (ftInfo.m_status != FeatureStatus::Created)
+          continue;
+
+        m2::RectD rect(ftInfo.m_feature.GetCenter(), ftInfo.m_feature.GetCenter());
+        rect.Inflate(kEps, kEps);
+        m_createdFeaturesIndex[mwm.first].Add(index.first, rect);
+      }
+    }
+    m_createdFeaturesIndexIsValid = true;
   }
+
+  auto const found = m_createdFeaturesIndex.find(id);
+  return found == m_createdFeaturesIndex.end() ? nullptr : &found->second;
 }
 
 bool Editor::GetEditedFeature(MwmSet::MwmId const & mwmId, uint32_t index,
@@ -651,7 +727,7 @@ EditableProperties Editor::GetEditableProperties(FeatureType const & feature) co
     auto const & metadata = originalFeaturePtr->GetMetadata();
     auto const & featureOpeningHours = metadata.Get(feature::Metadata::FMD_OPEN_HOURS);
     // Note: empty string is parsed as a valid opening hours rule.
-    if (!osmoh::OpeningHours(featureOpeningHours).IsValid())
+    if (!GetCachedOpeningHours(featureOpeningHours)->IsValid())
     {
       auto & meta = editableProperties.m_metadata;
       auto const toBeRemoved = remove(begin(meta), end(meta), feature::Metadata::FMD_OPEN_HOURS);
@@ -927,7 +1003,7 @@ void Editor::SaveUploadedInformation(FeatureTypeInfo const & fromUploader)
   fti.m_uploadAttemptTimestamp = fromUploader.m_uploadAttemptTimestamp;
   fti.m_uploadStatus = fromUploader.m_uploadStatus;
   fti.m_uploadError = fromUploader.m_uploadError;
-  Save();
+  SaveEdit(fid);
 }
 
 // Macros is used to avoid code duplication.
@@ -968,7 +1044,10 @@ void Editor::RemoveFeatureFromStorageIfExists(MwmSet::MwmId const & mwmId, uint3
 
   auto matchedIndex = matchedMwm->second.find(index);
   if (matchedIndex != matchedMwm->second.end())
+  {
     matchedMwm->second.erase(matchedIndex);
+    InvalidateCreatedFeaturesIndex();
+  }
 
   if (matchedMwm->second.empty())
     m_features.erase(matchedMwm);
@@ -997,7 +1076,7 @@ bool Editor::MarkFeatureAsObsolete(FeatureID const & fid)
   MarkFeatureWithStatus(fid, FeatureStatus::Obsolete);
 
   Invalidate();
-  return Save();
+  return SaveEdit(fid);
 }
 
 bool Editor::RemoveFeature(FeatureID const & fid)
@@ -1132,6 +1211,7 @@ void Editor::MarkFeatureWithStatus(FeatureID const & fid, FeatureStatus status)
   fti.m_feature = *originalFeaturePtr;
   fti.m_status = status;
   fti.m_modificationTimestamp = time(nullptr);
+  InvalidateCreatedFeaturesIndex();
 }
 
 MwmSet::MwmId Editor::GetMwmIdByMapName(string const & name)
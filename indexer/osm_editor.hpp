@@ -1,6 +1,7 @@
 #pragma once
 
 #include "geometry/rect2d.hpp"
+#include "geometry/tree4d.hpp"
 
 #include "indexer/editable_map_object.hpp"
 #include "indexer/feature.hpp"
@@ -203,6 +204,11 @@ private:
   // TODO(AlexZ): Synchronize Save call/make it on a separate thread.
   /// @returns false if fails.
   bool Save() const;
+  /// Saves a single edited feature: appends a one-feature record to the
+  /// storage's journal when it supports incremental writes and falls back
+  /// to a full Save() otherwise.
+  /// @returns false if fails.
+  bool SaveEdit(FeatureID const & fid) const;
   void RemoveFeatureFromStorageIfExists(MwmSet::MwmId const & mwmId, uint32_t index);
   void RemoveFeatureFromStorageIfExists(FeatureID const & fid);
   /// Notify framework that something has changed and should be redisplayed.
@@ -228,6 +234,8 @@ private:
     string m_uploadStatus;
     string m_uploadError;
   };
+  /// Serializes |fti| into the XML format used by Save() and SaveEdit().
+  static editor::XMLFeature SerializeEditedFeature(FeatureTypeInfo const & fti, uint32_t index);
   /// @returns pointer to m_features[id][index] if exists, nullptr otherwise.
   FeatureTypeInfo const * GetFeatureTypeInfo(MwmSet::MwmId const & mwmId, uint32_t index) const;
   FeatureTypeInfo * GetFeatureTypeInfo(MwmSet::MwmId const & mwmId, uint32_t index);
@@ -235,6 +243,12 @@ private:
 
   void MarkFeatureWithStatus(FeatureID const & fid, FeatureStatus status);
 
+  /// @returns the spatial index of created features for |id| or nullptr if
+  /// there are none. Rebuilds the indexes of all mwms after edits.
+  m4::Tree<uint32_t> const * GetCreatedFeaturesIndex(MwmSet::MwmId const & id) const;
+  /// Must be called after every modification of m_features.
+  void InvalidateCreatedFeaturesIndex() const { m_createdFeaturesIndexIsValid = false; }
+
   // These methods are just checked wrappers around Delegate.
   MwmSet::MwmId GetMwmIdByMapName(string const & name);
   unique_ptr<FeatureType> GetOriginalFeature(FeatureID const & fid) const;
@@ -245,6 +259,12 @@ private:
   /// Deleted, edited and created features.
   map<MwmSet::MwmId, map<uint32_t, FeatureTypeInfo>> m_features;
 
+  /// Spatial indexes of created features per mwm consulted by
+  /// ForEachFeatureInMwmRectAndScale: a redraw should not pay for a linear
+  /// scan of all edits. Rebuilt lazily after m_features modifications.
+  mutable map<MwmSet::MwmId, m4::Tree<uint32_t>> m_createdFeaturesIndex;
+  mutable bool m_createdFeaturesIndexIsValid = false;
+
   unique_ptr<Delegate> m_delegate;
 
   /// Invalidate map viewport after edits.
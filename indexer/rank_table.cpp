@@ -73,7 +73,8 @@ unique_ptr<MappedMemoryRegion> GetMemoryRegionForTag(FilesMappingContainer const
 {
   if (!mcont.IsExist(tag))
     return unique_ptr<MappedMemoryRegion>();
-  FilesMappingContainer::Handle handle = mcont.Map(tag);
+  // Ranks are accessed by feature id in no particular order.
+  FilesMappingContainer::Handle handle = mcont.Map(tag, FilesMappingContainer::Advice::Random);
   return make_unique<MappedMemoryRegion>(move(handle));
 }
 
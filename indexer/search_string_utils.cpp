@@ -2,10 +2,13 @@
 #include "indexer/string_set.hpp"
 
 #include "base/assert.hpp"
+#include "base/cache.hpp"
 #include "base/macros.hpp"
 #include "base/mem_trie.hpp"
 
 #include "std/algorithm.hpp"
+#include "std/functional.hpp"
+#include "std/mutex.hpp"
 
 using namespace strings;
 
@@ -13,7 +16,32 @@ namespace search
 {
 UniString NormalizeAndSimplifyString(string const & s)
 {
-  UniString uniString = MakeUniString(s);
+  UniString uniString;
+  NormalizeAndSimplifyString(s, uniString);
+  return uniString;
+}
+
+void NormalizeAndSimplifyString(string const & s, UniString & uniString)
+{
+  // Fast path for plain ASCII strings: the transformations below only
+  // affect characters above 0x7F — the hacks in the switch, the NFKD
+  // normalization and the accents cleanup are all identity on ASCII —
+  // so lower-casing the bytes directly gives the same result and skips
+  // the whole Unicode pipeline.
+  if (IsASCIIString(s))
+  {
+    uniString.resize(s.size());
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+      char c = s[i];
+      if (c >= 'A' && c <= 'Z')
+        c += 'a' - 'A';
+      uniString[i] = static_cast<UniChar>(c);
+    }
+    return;
+  }
+
+  MakeUniString(s, uniString);
   for (size_t i = 0; i < uniString.size(); ++i)
   {
     UniChar & c = uniString[i];
@@ -57,8 +85,6 @@ UniString NormalizeAndSimplifyString(string const & s)
     return (c == 0x0300 || c == 0x0301);
   });
 
-  return uniString;
-
   /// @todo Restore this logic to distinguish и-й in future.
   /*
   // Just after lower casing is a correct place to avoid normalization for specific chars.
@@ -84,6 +110,36 @@ UniString NormalizeAndSimplifyString(string const & s)
   */
 }
 
+UniString NormalizeAndSimplifyStringCached(string const & s)
+{
+  // 2048 entries cover the feature names of a typical ranking pass; the
+  // cache is hash-addressed, so a collision only costs a
+  // re-normalization of the evicted string.
+  uint32_t constexpr kLogCacheSize = 11;
+
+  struct Entry
+  {
+    string m_raw;
+    UniString m_normalized;
+  };
+
+  static mutex cacheMutex;
+  static my::Cache<uint64_t, Entry> cache(kLogCacheSize);
+
+  lock_guard<mutex> lock(cacheMutex);
+
+  bool found = false;
+  auto & entry = cache.Find(static_cast<uint64_t>(hash<string>()(s)), found);
+  // The raw string is compared to protect from hash collisions: the
+  // cache addresses entries by the hash only.
+  if (!found || entry.m_raw != s)
+  {
+    entry.m_raw = s;
+    NormalizeAndSimplifyString(s, entry.m_normalized);
+  }
+  return entry.m_normalized;
+}
+
 UniString FeatureTypeToString(uint32_t type)
 {
   string const s = "!type:" + to_string(type);
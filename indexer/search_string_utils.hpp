@@ -14,6 +14,15 @@ namespace search
 // It does some magic text transformation which greatly helps us to improve our search.
 strings::UniString NormalizeAndSimplifyString(string const & s);
 
+// Same, but writes the result into |uniString| reusing its storage. Use this
+// variant in hot loops to avoid an allocation per processed string.
+void NormalizeAndSimplifyString(string const & s, strings::UniString & uniString);
+
+// Same, but memoizes the results in a process-wide cache. Use for feature
+// names during ranking, where the same names are normalized over and over
+// again. Thread-safe.
+strings::UniString NormalizeAndSimplifyStringCached(string const & s);
+
 template <class DelimsT, typename F>
 void SplitUniString(strings::UniString const & uniS, F f, DelimsT const & delims)
 {
@@ -27,6 +27,18 @@ public:
 
   uint32_t GetIndex(uint32_t t) const;
 
+  /// @returns false for a type which is not present in the mapping.
+  bool TryGetIndex(uint32_t t, uint32_t & ind) const
+  {
+    MapT::const_iterator const i = m_map.find(t);
+    if (i == m_map.end())
+      return false;
+    ind = i->second;
+    return true;
+  }
+
+  size_t GetCount() const { return m_types.size(); }
+
   /// For Debug purposes only.
   bool HasIndex(uint32_t t) const { return (m_map.find(t) != m_map.end()); }
 };
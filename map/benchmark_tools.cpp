@@ -4,6 +4,12 @@
 #include "drape_frontend/drape_measurer.hpp"
 #include "drape_frontend/scenario_manager.hpp"
 
+#include "drape/frame_profiler.hpp"
+
+#include "indexer/map_style.hpp"
+
+#include "coding/file_writer.hpp"
+
 #include "platform/http_client.hpp"
 #include "platform/platform.hpp"
 
@@ -11,29 +17,115 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "std/target_os.hpp"
+
 namespace
 {
 
+struct ScenarioResult
+{
+  std::string m_name;
+  dp::FrameProfiler::StageStatistic m_stages[dp::FrameProfiler::StagesCount];
+  uint64_t m_totalFrames = 0;
+  uint64_t m_droppedFrames = 0;
+  uint64_t m_peakRssKb = 0;
+};
+
+// Peak resident set size of the process in kilobytes, or 0 when the platform
+// does not expose it. The value is a high-water mark, so per-scenario numbers
+// are only meaningful for the scenario which pushed it up.
+uint64_t GetPeakRSSKb()
+{
+#if defined(OMIM_OS_LINUX) || defined(OMIM_OS_ANDROID)
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return static_cast<uint64_t>(atoll(line.c_str() + 6));
+  }
+#endif
+  return 0;
+}
+
 struct BenchmarkHandle
 {
   std::vector<df::ScenarioManager::ScenarioData> m_scenariosToRun;
+  // Per-scenario map style. MapStyleCount means "keep the current style".
+  std::vector<MapStyle> m_scenarioStyles;
   size_t m_currentScenario = 0;
   std::vector<storage::TCountryId> m_regionsToDownload;
   size_t m_regionsToDownloadCounter = 0;
 
+  std::vector<ScenarioResult> m_results;
 #ifdef DRAPE_MEASURER
   std::vector<std::pair<string, df::DrapeMeasurer::DrapeStatistic>> m_drapeStatistic;
 #endif
 };
 
+// Writes per-scenario per-stage statistic into a json file in the writable
+// directory, so benchmark runs can be diffed by regression tracking scripts.
+void SaveResults(std::shared_ptr<BenchmarkHandle> handle)
+{
+  using dp::FrameProfiler;
+
+  my::JsonHandle root;
+  root.AttachNew(json_object());
+  json_t * resultsNode = json_array();
+  json_object_set_new(root.get(), "results", resultsNode);
+  for (ScenarioResult const & result : handle->m_results)
+  {
+    json_t * scenarioNode = json_object();
+    json_object_set_new(scenarioNode, "name", json_string(result.m_name.c_str()));
+    json_t * stagesNode = json_object();
+    for (int stage = 0; stage < FrameProfiler::StagesCount; ++stage)
+    {
+      FrameProfiler::StageStatistic const & stat = result.m_stages[stage];
+      json_t * stageNode = json_object();
+      json_object_set_new(stageNode, "count", json_integer(stat.m_count));
+      json_object_set_new(stageNode, "avgTimeUs", json_integer(stat.m_avgTimeUs));
+      json_object_set_new(stageNode, "p95TimeUs", json_integer(stat.m_p95TimeUs));
+      json_object_set_new(stageNode, "maxTimeUs", json_integer(stat.m_maxTimeUs));
+      json_object_set_new(stagesNode,
+                          FrameProfiler::GetStageName(static_cast<FrameProfiler::Stage>(stage)),
+                          stageNode);
+    }
+    json_object_set_new(scenarioNode, "stages", stagesNode);
+    json_object_set_new(scenarioNode, "totalFrames", json_integer(result.m_totalFrames));
+    json_object_set_new(scenarioNode, "droppedFrames", json_integer(result.m_droppedFrames));
+    json_object_set_new(scenarioNode, "peakRssKb", json_integer(result.m_peakRssKb));
+    json_array_append_new(resultsNode, scenarioNode);
+  }
+
+  char * dump = json_dumps(root.get(), JSON_INDENT(2));
+  if (dump == nullptr)
+    return;
+  std::string const filePath = GetPlatform().WritablePathForFile("graphics_benchmark_results.json");
+  try
+  {
+    FileWriter writer(filePath);
+    writer.Write(dump, strlen(dump));
+    LOG(LINFO, ("Graphics benchmark results are saved to", filePath));
+  }
+  catch (FileWriter::Exception const & e)
+  {
+    LOG(LWARNING, ("Can't save graphics benchmark results:", e.Msg()));
+  }
+  free(dump);
+}
+
 void RunScenario(Framework * framework, std::shared_ptr<BenchmarkHandle> handle)
 {
   if (handle->m_currentScenario >= handle->m_scenariosToRun.size())
   {
+    SaveResults(handle);
 #ifdef DRAPE_MEASURER
     for (auto const & it : handle->m_drapeStatistic)
     {
@@ -48,15 +140,33 @@ void RunScenario(Framework * framework, std::shared_ptr<BenchmarkHandle> handle)
 
   auto & scenarioData = handle->m_scenariosToRun[handle->m_currentScenario];
 
+  MapStyle const style = handle->m_scenarioStyles[handle->m_currentScenario];
+  if (style != MapStyleCount && style != framework->GetMapStyle())
+    framework->SetMapStyle(style);
+
   framework->GetDrapeEngine()->RunScenario(std::move(scenarioData),
                                            [handle](std::string const & name)
   {
+    // Drop measurements of the preceding scenario, so the collected
+    // statistic covers only this one.
+    dp::FrameProfiler::Instance().Reset();
 #ifdef DRAPE_MEASURER
     df::DrapeMeasurer::Instance().StartBenchmark();
 #endif
   },
                                            [framework, handle](std::string const & name)
   {
+    ScenarioResult result;
+    result.m_name = name;
+    for (int stage = 0; stage < dp::FrameProfiler::StagesCount; ++stage)
+    {
+      result.m_stages[stage] = dp::FrameProfiler::Instance().GetStatistic(
+          static_cast<dp::FrameProfiler::Stage>(stage));
+    }
+    result.m_totalFrames = dp::FrameProfiler::Instance().GetTotalFramesCount();
+    result.m_droppedFrames = dp::FrameProfiler::Instance().GetDroppedFramesCount();
+    result.m_peakRssKb = GetPeakRSSKb();
+    handle->m_results.push_back(std::move(result));
 #ifdef DRAPE_MEASURER
     df::DrapeMeasurer::Instance().StopBenchmark();
     auto const drapeStatistic = df::DrapeMeasurer::Instance().GetDrapeStatistic();
@@ -69,6 +179,53 @@ void RunScenario(Framework * framework, std::shared_ptr<BenchmarkHandle> handle)
     });
   });
 }
+
+#ifdef SCENARIO_ENABLE
+bool ParseSteps(json_t * stepsNode, df::ScenarioManager::Scenario & scenario,
+                std::vector<m2::PointD> & points)
+{
+  using namespace df;
+
+  size_t const stepsCount = json_array_size(stepsNode);
+  scenario.reserve(stepsCount);
+  for (size_t j = 0; j < stepsCount; ++j)
+  {
+    auto stepElem = json_array_get(stepsNode, j);
+    if (stepElem == nullptr)
+      return false;
+    string actionType;
+    my::FromJSONObject(stepElem, "actionType", actionType);
+    if (actionType == "waitForTime")
+    {
+      json_int_t timeInSeconds = 0;
+      my::FromJSONObject(stepElem, "time", timeInSeconds);
+      scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                           new ScenarioManager::WaitForTimeAction(seconds(timeInSeconds))));
+    }
+    else if (actionType == "waitForReading")
+    {
+      scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                           new ScenarioManager::WaitForReadingAction()));
+    }
+    else if (actionType == "centerViewport")
+    {
+      json_t * centerNode = json_object_get(stepElem, "center");
+      if (centerNode == nullptr)
+        return false;
+      double x = 0.0, y = 0.0;
+      my::FromJSONObject(centerNode, "x", x);
+      my::FromJSONObject(centerNode, "y", y);
+      json_int_t zoomLevel = -1;
+      my::FromJSONObject(stepElem, "zoomLevel", zoomLevel);
+      m2::PointD const pt(x, y);
+      points.push_back(pt);
+      scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                           new ScenarioManager::CenterViewportAction(pt, static_cast<int>(zoomLevel))));
+    }
+  }
+  return true;
+}
+#endif
 } //  namespace
 
 namespace benchmark
@@ -95,49 +252,78 @@ void RunGraphicsBenchmark(Framework * framework)
     if (scenariosNode == nullptr || !json_is_array(scenariosNode))
       return;
     size_t const sz = json_array_size(scenariosNode);
-    handle->m_scenariosToRun.resize(sz);
     for (size_t i = 0; i < sz; ++i)
     {
       auto scenarioElem = json_array_get(scenariosNode, i);
       if (scenarioElem == nullptr)
         return;
-      my::FromJSONObject(scenarioElem, "name", handle->m_scenariosToRun[i].m_name);
+      string name;
+      my::FromJSONObject(scenarioElem, "name", name);
       json_t * stepsNode = json_object_get(scenarioElem, "steps");
-      if (stepsNode != nullptr && json_is_array(stepsNode))
+
+      // A scenario with a "styles" list becomes a parameter sweep: it is
+      // run once for every listed style. The steps are re-parsed for each
+      // run, because actions are not copyable.
+      std::vector<string> styles;
+      my::FromJSONObjectOptionalField(scenarioElem, "styles", styles);
+      size_t const runsCount = styles.empty() ? 1 : styles.size();
+      for (size_t run = 0; run < runsCount; ++run)
       {
-        size_t const stepsCount = json_array_size(stepsNode);
-        auto & scenario = handle->m_scenariosToRun[i].m_scenario;
-        scenario.reserve(stepsCount);
-        for (size_t j = 0; j < stepsCount; ++j)
+        ScenarioManager::ScenarioData data;
+        data.m_name = styles.empty() ? name : name + "_" + styles[run];
+        if (stepsNode != nullptr && json_is_array(stepsNode))
         {
-          auto stepElem = json_array_get(stepsNode, j);
-          if (stepElem == nullptr)
+          if (!ParseSteps(stepsNode, data.m_scenario, points))
             return;
-          string actionType;
-          my::FromJSONObject(stepElem, "actionType", actionType);
-          if (actionType == "waitForTime")
-          {
-            json_int_t timeInSeconds = 0;
-            my::FromJSONObject(stepElem, "time", timeInSeconds);
-            scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
-                                 new ScenarioManager::WaitForTimeAction(seconds(timeInSeconds))));
-          }
-          else if (actionType == "centerViewport")
-          {
-            json_t * centerNode = json_object_get(stepElem, "center");
-            if (centerNode == nullptr)
-              return;
-            double x = 0.0, y = 0.0;
-            my::FromJSONObject(centerNode, "x", x);
-            my::FromJSONObject(centerNode, "y", y);
-            json_int_t zoomLevel = -1;
-            my::FromJSONObject(stepElem, "zoomLevel", zoomLevel);
-            m2::PointD const pt(x, y);
-            points.push_back(pt);
-            scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
-                                 new ScenarioManager::CenterViewportAction(pt, static_cast<int>(zoomLevel))));
-          }
         }
+        handle->m_scenariosToRun.push_back(std::move(data));
+        handle->m_scenarioStyles.push_back(styles.empty() ? MapStyleCount
+                                                          : MapStyleFromSettings(styles[run]));
+      }
+    }
+
+    // A viewport sweep generates one scenario per zoom level at the given
+    // center, so a regression can be attributed to a concrete viewport.
+    json_t * sweepNode = json_object_get(root.get(), "viewportSweep");
+    if (sweepNode != nullptr && json_is_object(sweepNode))
+    {
+      json_t * centerNode = json_object_get(sweepNode, "center");
+      if (centerNode == nullptr)
+        return;
+      double x = 0.0, y = 0.0;
+      my::FromJSONObject(centerNode, "x", x);
+      my::FromJSONObject(centerNode, "y", y);
+      json_int_t timeInSeconds = 0;
+      my::FromJSONObject(sweepNode, "time", timeInSeconds);
+      string name;
+      my::FromJSONObjectOptionalField(sweepNode, "name", name);
+      if (name.empty())
+        name = "viewportSweep";
+      json_t * zoomLevelsNode = json_object_get(sweepNode, "zoomLevels");
+      if (zoomLevelsNode == nullptr || !json_is_array(zoomLevelsNode))
+        return;
+
+      m2::PointD const pt(x, y);
+      points.push_back(pt);
+      size_t const zoomsCount = json_array_size(zoomLevelsNode);
+      for (size_t z = 0; z < zoomsCount; ++z)
+      {
+        json_t * zoomElem = json_array_get(zoomLevelsNode, z);
+        if (zoomElem == nullptr || !json_is_integer(zoomElem))
+          return;
+        json_int_t const zoomLevel = json_integer_value(zoomElem);
+        ScenarioManager::ScenarioData data;
+        data.m_name = name + "_zoom" + std::to_string(zoomLevel);
+        data.m_scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                                    new ScenarioManager::CenterViewportAction(pt, static_cast<int>(zoomLevel))));
+        // Let tile reading settle first, so the timed window below measures
+        // steady-state rendering of the viewport, not its loading.
+        data.m_scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                                    new ScenarioManager::WaitForReadingAction()));
+        data.m_scenario.push_back(std::unique_ptr<ScenarioManager::Action>(
+                                    new ScenarioManager::WaitForTimeAction(seconds(timeInSeconds))));
+        handle->m_scenariosToRun.push_back(std::move(data));
+        handle->m_scenarioStyles.push_back(MapStyleCount);
       }
     }
   }
@@ -24,6 +24,7 @@
 #include "std/auto_ptr.hpp"
 #include "std/fstream.hpp"
 #include "std/iterator.hpp"
+#include "std/set.hpp"
 
 Bookmark::Bookmark(m2::PointD const & ptOrg, UserMarkContainer * container)
   : TBase(ptOrg, container)
@@ -133,12 +134,20 @@ void BookmarkCategory::AddTrack(unique_ptr<Track> && track)
 
 Track const * BookmarkCategory::GetTrack(size_t index) const
 {
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
   return (index < m_tracks.size() ? m_tracks[index].get() : 0);
 }
 
+size_t BookmarkCategory::GetTracksCount() const
+{
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
+  return m_tracks.size();
+}
+
 BookmarkCategory::BookmarkCategory(string const & name, Framework & framework)
   : TBase(0.0 /* bookmarkDepth */, UserMarkType::BOOKMARK_MARK, framework)
   , m_name(name)
+  , m_loaded(true)
 {
 }
 
@@ -147,8 +156,27 @@ BookmarkCategory::~BookmarkCategory()
   ClearTracks();
 }
 
+size_t BookmarkCategory::GetUserPointCount() const
+{
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
+  return TBase::GetUserPointCount();
+}
+
+size_t BookmarkCategory::GetUserMarkCount() const
+{
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
+  return TBase::GetUserMarkCount();
+}
+
+UserMark const * BookmarkCategory::GetUserMark(size_t index) const
+{
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
+  return TBase::GetUserMark(index);
+}
+
 size_t BookmarkCategory::GetUserLineCount() const
 {
+  const_cast<BookmarkCategory *>(this)->EnsureKMLLoaded();
   return m_tracks.size();
 }
 
@@ -158,6 +186,37 @@ df::UserLineMark const * BookmarkCategory::GetUserLineMark(size_t index) const
   return m_tracks[index].get();
 }
 
+void BookmarkCategory::EnsureKMLLoaded()
+{
+  // The flag becomes true before the body is parsed, so readers which see
+  // it synchronize on the container lock taken for the whole parse.
+  if (m_loaded)
+    return;
+
+  lock_guard<mutex> guard(m_loadGuard);
+  if (m_loaded)
+    return;
+  m_loaded = true;
+
+  try
+  {
+    if (!LoadFromKML(make_unique<FileReader>(m_file)))
+      LOG(LWARNING, ("Error while loading bookmarks from", m_file));
+  }
+  catch (std::exception const & e)
+  {
+    LOG(LWARNING, ("Error while loading bookmarks from", m_file, e.what()));
+  }
+}
+
+UserMarksController & BookmarkCategory::RequestController()
+{
+  // Load before TBase locks the container for writing: parsing the KML
+  // body requests the controller itself.
+  EnsureKMLLoaded();
+  return TBase::RequestController();
+}
+
 void BookmarkCategory::ClearTracks()
 {
   m_tracks.clear();
@@ -216,7 +275,10 @@ namespace
     BookmarkCategory & m_category;
     UserMarksController & m_controller;
 
-    vector<string> m_tags;
+    // Tag names repeat for every placemark, so the tag stack keeps
+    // pointers into an interning pool instead of copying each name.
+    set<string> m_tagPool;
+    vector<string const *> m_tags;
     GeometryType m_geometryType;
     m2::PolylineD m_points;
     dp::Color m_trackColor;
@@ -355,7 +417,10 @@ namespace
   public:
     KMLParser(BookmarkCategory & cat)
       : m_category(cat)
-      , m_controller(m_category.RequestController())
+      // The base class controller is requested directly: the parser runs
+      // inside EnsureKMLLoaded and must not recurse into it through
+      // BookmarkCategory::RequestController.
+      , m_controller(static_cast<UserMarkContainer &>(m_category).RequestController())
     {
       Reset();
     }
@@ -367,7 +432,7 @@ namespace
 
     bool Push(string const & name)
     {
-      m_tags.push_back(name);
+      m_tags.push_back(&*m_tagPool.insert(name).first);
       return true;
     }
 
@@ -390,12 +455,12 @@ namespace
     string const & GetTagFromEnd(size_t n) const
     {
       ASSERT_LESS(n, m_tags.size(), ());
-      return m_tags[m_tags.size() - n - 1];
+      return *m_tags[m_tags.size() - n - 1];
     }
 
     void Pop(string const & tag)
     {
-      ASSERT_EQUAL(m_tags.back(), tag, ());
+      ASSERT_EQUAL(*m_tags.back(), tag, ());
 
       if (tag == kPlacemark)
       {
@@ -441,9 +506,9 @@ namespace
       size_t const count = m_tags.size();
       if (count > 1 && !value.empty())
       {
-        string const & currTag = m_tags[count - 1];
-        string const & prevTag = m_tags[count - 2];
-        string const ppTag = count > 3 ? m_tags[count - 3] : string();
+        string const & currTag = *m_tags[count - 1];
+        string const & prevTag = *m_tags[count - 2];
+        string const ppTag = count > 3 ? *m_tags[count - 3] : string();
 
         if (prevTag == kDocument)
         {
@@ -555,6 +620,104 @@ namespace
       }
     }
   };
+
+  // Parses only the category header: <name> and <visibility> of the
+  // Document. Placemark and style subtrees are skipped, and parsing is
+  // stopped as soon as the header has been seen.
+  class KMLHeaderParser
+  {
+    vector<string> m_tags;
+
+    string m_name;
+    bool m_visible = true;
+    bool m_hasName = false;
+    bool m_hasDocument = false;
+    bool m_done = false;
+
+  public:
+    bool Push(string const & tag)
+    {
+      if (m_done)
+        return false;
+
+      if (tag == kDocument)
+      {
+        m_hasDocument = true;
+      }
+      else if (tag == kPlacemark)
+      {
+        // Our own files always store the header before the first
+        // Placemark; scan on (skipping the bodies) only when a
+        // third-party file puts the name after them.
+        if (m_hasName)
+          m_done = true;
+        return false;
+      }
+      else if (tag == kStyle || tag == kStyleMap)
+      {
+        return false;
+      }
+
+      m_tags.push_back(tag);
+      return true;
+    }
+
+    void AddAttr(string const &, string const &) {}
+
+    void Pop(string const & tag)
+    {
+      ASSERT_EQUAL(m_tags.back(), tag, ());
+      m_tags.pop_back();
+    }
+
+    void CharData(string value)
+    {
+      strings::Trim(value);
+
+      size_t const count = m_tags.size();
+      if (count > 1 && !value.empty() && m_tags[count - 2] == kDocument)
+      {
+        if (m_tags[count - 1] == "name")
+        {
+          m_name = value;
+          m_hasName = true;
+        }
+        else if (m_tags[count - 1] == "visibility")
+        {
+          m_visible = value != "0";
+        }
+      }
+    }
+
+    bool IsDone() const { return m_done; }
+    bool HasDocument() const { return m_hasDocument; }
+    string const & GetName() const { return m_name; }
+    bool IsVisible() const { return m_visible; }
+  };
+
+  // Feeds ParseXMLSequence and stops supplying data as soon as the header
+  // parser has seen everything it needs.
+  class KMLHeaderSource
+  {
+    ReaderSource<ReaderPtr<Reader>> & m_source;
+    KMLHeaderParser const & m_parser;
+
+  public:
+    KMLHeaderSource(ReaderSource<ReaderPtr<Reader>> & source, KMLHeaderParser const & parser)
+      : m_source(source)
+      , m_parser(parser)
+    {
+    }
+
+    uint64_t Read(void * p, uint64_t size)
+    {
+      if (m_parser.IsDone())
+        return 0;
+      size_t const correctSize = static_cast<size_t>(min(size, m_source.Size()));
+      m_source.Read(p, correctSize);
+      return correctSize;
+    }
+  };
 }
 
 string BookmarkCategory::GetDefaultType()
@@ -575,13 +738,32 @@ bool BookmarkCategory::LoadFromKML(ReaderPtr<Reader> const & reader)
   }
 }
 
+bool BookmarkCategory::LoadHeaderFromKML(ReaderPtr<Reader> const & reader)
+{
+  ReaderSource<ReaderPtr<Reader> > src(reader);
+  KMLHeaderParser parser;
+
+  KMLHeaderSource source(src, parser);
+  ParseXMLSequence(source, parser, true);
+
+  if (!parser.HasDocument())
+    return false;
+
+  SetName(parser.GetName());
+  SetIsVisible(parser.IsVisible());
+  return true;
+}
+
 BookmarkCategory * BookmarkCategory::CreateFromKMLFile(string const & file, Framework & framework)
 {
   auto_ptr<BookmarkCategory> cat(new BookmarkCategory("", framework));
   try
   {
-    if (cat->LoadFromKML(make_unique<FileReader>(file)))
+    if (cat->LoadHeaderFromKML(make_unique<FileReader>(file)))
+    {
       cat->m_file = file;
+      cat->m_loaded = false;
+    }
     else
       cat.reset();
   }
@@ -10,6 +10,7 @@
 
 #include "base/timer.hpp"
 
+#include "std/mutex.hpp"
 #include "std/string.hpp"
 #include "std/noncopyable.hpp"
 #include "std/iostream.hpp"
@@ -113,6 +114,12 @@ class BookmarkCategory : public UserMarkContainer
   string m_name;
   /// Stores file name from which category was loaded
   string m_file;
+  /// False while only the KML header (name and visibility) was parsed
+  /// and the bookmark bodies are still in the file.
+  bool m_loaded;
+  /// Serializes the background loading thread with the first access
+  /// from the UI thread.
+  mutex m_loadGuard;
 
 public:
   class Guard
@@ -138,9 +145,26 @@ public:
   BookmarkCategory(string const & name, Framework & framework);
   ~BookmarkCategory() override;
 
+  size_t GetUserPointCount() const override;
+  size_t GetUserMarkCount() const override;
+  UserMark const * GetUserMark(size_t index) const override;
+
   size_t GetUserLineCount() const override;
   df::UserLineMark const * GetUserLineMark(size_t index) const override;
 
+  /// @name Lazy loading.
+  /// Categories created from a KML file get only their header (name and
+  /// visibility) parsed eagerly; bookmarks and tracks are parsed on the
+  /// first access to the category content.
+  //@{
+  bool IsLoaded() const { return m_loaded; }
+  /// Parses the rest of the KML file if only the header was loaded so far.
+  void EnsureKMLLoaded();
+  /// Hides TBase::RequestController to load the KML body before the
+  /// container is locked for writing.
+  UserMarksController & RequestController();
+  //@}
+
   static string GetDefaultType();
 
   void ClearTracks();
@@ -149,7 +173,7 @@ public:
   //@{
   void AddTrack(unique_ptr<Track> && track);
   Track const * GetTrack(size_t index) const;
-  inline size_t GetTracksCount() const { return m_tracks.size(); }
+  size_t GetTracksCount() const;
   void DeleteTrack(size_t index);
   //@}
 
@@ -161,6 +185,9 @@ public:
   /// You don't need to call them from client code.
   //@{
   bool LoadFromKML(ReaderPtr<Reader> const & reader);
+  /// Parses only the category name and visibility, stopping before the
+  /// bookmark bodies. @return false if the reader does not contain KML.
+  bool LoadHeaderFromKML(ReaderPtr<Reader> const & reader);
   void SaveToKML(ostream & s);
 
   /// Uses the same file name from which was loaded, or
@@ -51,8 +51,15 @@ void BookmarkManager::LoadState()
   settings::Get(BOOKMARK_TYPE, m_lastType);
 }
 
+void BookmarkManager::JoinLoadBookmarksThread()
+{
+  if (m_loadBookmarksThread.joinable())
+    m_loadBookmarksThread.join();
+}
+
 void BookmarkManager::ClearItems()
 {
+  JoinLoadBookmarksThread();
   for_each(m_categories.begin(), m_categories.end(), DeleteFunctor());
   m_categories.clear();
 }
@@ -80,12 +87,31 @@ void BookmarkManager::LoadBookmark(string const & filePath)
 
 void BookmarkManager::InitBookmarks()
 {
+  JoinLoadBookmarksThread();
+
+  vector<BookmarkCategory *> cats;
   for (auto it = m_categories.begin(); it != m_categories.end(); ++it)
   {
     BookmarkCategory * cat = *it;
-    BookmarkCategory::Guard guard(*cat);
-    guard.m_controller.Update();
+    // Hidden categories are left unloaded: there is nothing to render and
+    // their bookmarks are parsed on the first access to the category.
+    if (!cat->IsLoaded() && !cat->IsVisible())
+      continue;
+    cats.push_back(cat);
   }
+
+  // Parsing large KML files freezes the UI thread for seconds, so the
+  // bodies are loaded in the background. The container is locked for the
+  // whole parse and the marks are delivered to drape in one batch when
+  // the guard is released, so concurrent accesses just wait for the load.
+  m_loadBookmarksThread = threads::SimpleThread([cats]()
+  {
+    for (BookmarkCategory * cat : cats)
+    {
+      BookmarkCategory::Guard guard(*cat);
+      guard.m_controller.Update();
+    }
+  });
 }
 
 size_t BookmarkManager::AddBookmark(size_t categoryIndex, m2::PointD const & ptOrg, BookmarkData & bm)
@@ -171,6 +197,9 @@ size_t BookmarkManager::CreateBmCategory(string const & name)
 
 void BookmarkManager::DeleteBmCategory(CategoryIter i)
 {
+  // The background loading thread holds raw category pointers.
+  JoinLoadBookmarksThread();
+
   BookmarkCategory * cat = *i;
   m_categories.erase(i);
   cat->DeleteLater();
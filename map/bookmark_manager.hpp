@@ -3,6 +3,8 @@
 #include "map/bookmark.hpp"
 #include "map/user_mark_container.hpp"
 
+#include "base/thread.hpp"
+
 #include "std/function.hpp"
 #include "std/unique_ptr.hpp"
 
@@ -21,8 +23,13 @@ class BookmarkManager : private noncopyable
   vector<UserMarkContainer *> m_userMarkLayers;
   typedef vector<BookmarkCategory *>::iterator CategoryIter;
 
+  /// Parses the bodies of the visible categories off the UI thread.
+  /// Joined before the categories are modified or destroyed.
+  threads::SimpleThread m_loadBookmarksThread;
+
   void SaveState() const;
   void LoadState();
+  void JoinLoadBookmarksThread();
 
 public:
   BookmarkManager(Framework & f);
@@ -91,6 +91,20 @@ void ScaleChartData(vector<double> & chartData, double scale)
     chartData[i] *= scale;
 }
 
+void DownsampleChartPoints(vector<m2::PointD> & points, size_t maxPointCount)
+{
+  if (maxPointCount < 2 || points.size() <= maxPointCount)
+    return;
+
+  vector<m2::PointD> result;
+  result.reserve(maxPointCount);
+  double const step = static_cast<double>(points.size() - 1) / (maxPointCount - 1);
+  for (size_t i = 0; i < maxPointCount; ++i)
+    result.push_back(points[min(static_cast<size_t>(i * step + 0.5), points.size() - 1)]);
+  result.back() = points.back();
+  points.swap(result);
+}
+
 void ShiftChartData(vector<double> & chartData, double shift)
 {
   for (size_t i = 0; i < chartData.size(); ++i)
@@ -211,6 +225,14 @@ bool GenerateChartByPoints(uint32_t width, uint32_t height, vector<m2::PointD> c
   if (width == 0 || height == 0)
     return false;
 
+  size_t constexpr kMaxPointsPerPxl = 2;
+  if (geometry.size() > kMaxPointsPerPxl * width)
+  {
+    vector<m2::PointD> downsampled(geometry);
+    DownsampleChartPoints(downsampled, kMaxPointsPerPxl * width);
+    return GenerateChartByPoints(width, height, downsampled, mapStyle, frameBuffer);
+  }
+
   agg::rgba8 const kBackgroundColor = agg::rgba8(255, 255, 255, 0);
   agg::rgba8 const kLineColor = GetLineColor(mapStyle);
   agg::rgba8 const kCurveColor = GetCurveColor(mapStyle);
@@ -14,6 +14,11 @@ namespace maps
 uint32_t constexpr kAltitudeChartBPP = 4;
 
 void ScaleChartData(vector<double> & chartData, double scale);
+/// \brief reduces |points| to at most |maxPointCount| evenly picked points.
+/// The first and the last points are always kept. Rasterizing more than a few
+/// points per pixel column only burns time, so the chart is downsampled
+/// proportionally to its width before rendering.
+void DownsampleChartPoints(vector<m2::PointD> & points, size_t maxPointCount);
 void ShiftChartData(vector<double> & chartData, double shift);
 void ReflectChartData(vector<double> & chartData);
 
@@ -3,11 +3,14 @@
 #include "search/categories_cache.hpp"
 #include "search/locality_finder.hpp"
 
+#include "geometry/mercator.hpp"
 #include "geometry/point2d.hpp"
 
 #include "base/cancellable.hpp"
 
 #include <cstdint>
+#include <string>
+#include <vector>
 
 class CityFinder
 {
@@ -19,14 +22,49 @@ public:
 
   string GetCityName(m2::PointD const & p, int8_t lang)
   {
+    // Consecutive queries mostly come from the same place (e.g. events
+    // logged during one session), so a point close to the previous one
+    // reuses its answer without touching the index.
+    if (m_hasLastResult && lang == m_lastLang &&
+        MercatorBounds::DistanceOnEarth(p, m_lastPoint) < kCacheRadiusMeters)
+    {
+      return m_lastCity;
+    }
+
     string city;
     m_finder.SetLanguage(lang);
     m_finder.GetLocality(p, city);
+
+    m_hasLastResult = true;
+    m_lastPoint = p;
+    m_lastLang = lang;
+    m_lastCity = city;
     return city;
   }
 
+  /// Resolves all points in one pass. The locality finder keeps the
+  /// vicinities loaded for the points seen so far, so tagging a batch is
+  /// much cheaper than resolving the same points one by one from scratch.
+  std::vector<string> GetCityNames(std::vector<m2::PointD> const & points, int8_t lang)
+  {
+    std::vector<string> cities;
+    cities.reserve(points.size());
+    for (m2::PointD const & p : points)
+      cities.push_back(GetCityName(p, lang));
+    return cities;
+  }
+
 private:
+  // A city is never smaller than this, so within the radius the answer
+  // can not change.
+  static double constexpr kCacheRadiusMeters = 2000.0;
+
   my::Cancellable m_cancellable;
   search::VillagesCache m_unusedCache;
   search::LocalityFinder m_finder;
+
+  bool m_hasLastResult = false;
+  m2::PointD m_lastPoint = m2::PointD(0.0, 0.0);
+  int8_t m_lastLang = 0;
+  string m_lastCity;
 };
@@ -44,10 +44,16 @@ void FeaturesFetcher::InitClassificator()
 
 pair<MwmSet::MwmId, MwmSet::RegResult> FeaturesFetcher::RegisterMap(
     LocalCountryFile const & localFile)
+{
+  return RegisterMap(localFile, nullptr /* info */);
+}
+
+pair<MwmSet::MwmId, MwmSet::RegResult> FeaturesFetcher::RegisterMap(
+    LocalCountryFile const & localFile, unique_ptr<MwmInfo> info)
 {
   try
   {
-    auto result = m_multiIndex.RegisterMap(localFile);
+    auto result = m_multiIndex.RegisterMap(localFile, move(info));
     if (result.second != MwmSet::RegResult::Success)
     {
       LOG(LWARNING, ("Can't add map", localFile.GetCountryName(), "(", result.second, ").",
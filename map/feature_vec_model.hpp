@@ -50,6 +50,10 @@ class FeaturesFetcher : public MwmSet::Observer
     pair<MwmSet::MwmId, MwmSet::RegResult> RegisterMap(
         platform::LocalCountryFile const & localFile);
 
+    /// Registers a new map with MwmInfo prepared by Index::ParseInfo().
+    pair<MwmSet::MwmId, MwmSet::RegResult> RegisterMap(
+        platform::LocalCountryFile const & localFile, unique_ptr<MwmInfo> info);
+
     /// Deregisters a map denoted by file from internal records.
     bool DeregisterMap(platform::CountryFile const & countryFile);
 
@@ -15,6 +15,7 @@
 #include "routing/online_absent_fetcher.hpp"
 #include "routing/road_graph_router.hpp"
 #include "routing/route.hpp"
+#include "routing/route_corpus.hpp"
 #include "routing/routing_algorithm.hpp"
 #include "routing/routing_helpers.hpp"
 
@@ -71,6 +72,7 @@
 #include "platform/socket.hpp"
 
 #include "coding/internal/file_data.hpp"
+#include "coding/section_read_stats.hpp"
 #include "coding/zip_reader.hpp"
 #include "coding/url_encode.hpp"
 #include "coding/file_name_utils.hpp"
@@ -86,10 +88,14 @@
 #include "base/logging.hpp"
 #include "base/math.hpp"
 #include "base/scope_guard.hpp"
+#include "base/startup_tracer.hpp"
+#include "base/thread.hpp"
 #include "base/timer.hpp"
 
 #include "std/algorithm.hpp"
+#include "std/atomic.hpp"
 #include "std/bind.hpp"
+#include "std/future.hpp"
 #include "std/target_os.hpp"
 #include "std/vector.hpp"
 
@@ -372,6 +378,7 @@ void Framework::Migrate(bool keepDownloaded)
   InitCountryInfoGetter();
   InitSearchEngine();
   RegisterAllMaps();
+  m_searchEngine->SetSupportOldFormat(m_minMwmFormat < static_cast<int>(version::Format::v3));
 
   m_trafficManager.SetCurrentDataVersion(GetStorage().GetCurrentDataVersion());
   if (m_drapeEngine && m_isRenderingEnabled)
@@ -397,8 +404,11 @@ Framework::Framework()
     int const mode = show ? dp::displacement::kHotelMode : dp::displacement::kDefaultMode;
     CallDrapeFunction(bind(&df::DrapeEngine::SetDisplacementMode, _1, mode));
   })
+  , m_minMwmFormat(numeric_limits<int>::max())
   , m_lastReportedCountry(kInvalidCountryId)
 {
+  my::StartupTracer::Scope tracer("framework_init");
+
   m_startBackgroundTime = my::Timer::LocalTime();
 
   // Restore map style before classificator loading
@@ -434,17 +444,41 @@ Framework::Framework()
 
   m_displayedCategories = make_unique<search::DisplayedCategories>(GetDefaultCategories());
 
-  // To avoid possible races - init country info getter once in constructor.
-  InitCountryInfoGetter();
-  LOG(LDEBUG, ("Country info getter initialized"));
+  // Stage initialization to shorten the cold start: the country info getter
+  // and the search engine do not touch the mwm registry, so they are prepared
+  // on a background thread while maps are registered here. Both must be
+  // initialized once and only in the constructor to avoid possible races.
+  // The affiliations read by the info getter are filled in the Storage
+  // constructor and immutable afterwards, so reading them concurrently with
+  // map registration is safe. When a migration is pending, RegisterAllMaps
+  // may reinitialize both subsystems via Migrate, so that path stays serial.
+  future<void> searchEngineReady;
+  auto const initCountryInfoGetterAndSearchEngine = [this]
+  {
+    my::StartupTracer::Scope tracer("search_engine_init");
 
-  // To avoid possible races - init search engine once in constructor.
-  InitSearchEngine();
-  LOG(LDEBUG, ("Search engine initialized"));
+    InitCountryInfoGetter();
+    LOG(LDEBUG, ("Country info getter initialized"));
 
-  RegisterAllMaps();
+    InitSearchEngine();
+    LOG(LDEBUG, ("Search engine initialized"));
+  };
+  if (!platform::migrate::NeedMigrate())
+    searchEngineReady = async(launch::async, initCountryInfoGetterAndSearchEngine);
+  else
+    initCountryInfoGetterAndSearchEngine();
+
+  {
+    my::StartupTracer::Scope registerTracer("register_maps");
+    RegisterAllMaps();
+  }
   LOG(LDEBUG, ("Maps initialized"));
 
+  if (searchEngineReady.valid())
+    searchEngineReady.get();
+
+  m_searchEngine->SetSupportOldFormat(m_minMwmFormat < static_cast<int>(version::Format::v3));
+
   // Init storage with needed callback.
   m_storage.Init(
                  bind(&Framework::OnCountryFileDownloaded, this, _1, _2),
@@ -469,6 +503,7 @@ Framework::Framework()
 #else
   routing::RouterDelegate::TPointCheckCallback const routingVisualizerFn = nullptr;
 #endif
+  my::StartupTracer::Instance().BeginPhase("routing_init");
   m_routingSession.Init(routingStatisticsFn, routingVisualizerFn);
   m_routingSession.SetReadyCallbacks([&](Route const & route, IRouter::ResultCode code){ OnBuildRouteReady(route, code); },
                                      [&](Route const & route, IRouter::ResultCode code){ OnRebuildRouteReady(route, code); });
@@ -477,6 +512,7 @@ Framework::Framework()
 
   UpdateMinBuildingsTapZoom();
 
+  my::StartupTracer::Instance().EndPhase("routing_init");
   LOG(LDEBUG, ("Routing engine initialized"));
 
   LOG(LINFO, ("System languages:", languages::GetPreferred()));
@@ -485,7 +521,10 @@ Framework::Framework()
 
   editor.SetDelegate(make_unique<search::EditorDelegate>(m_model.GetIndex()));
   editor.SetInvalidateFn([this](){ InvalidateRect(GetCurrentViewport()); });
-  editor.LoadMapEdits();
+  {
+    my::StartupTracer::Scope editorTracer("editor_load");
+    editor.LoadMapEdits();
+  }
 
   m_model.GetIndex().AddObserver(editor);
 
@@ -539,23 +578,55 @@ void Framework::DrawWatchFrame(m2::PointD const & center, int zoomModifier,
   ASSERT_GREATER(resultZoom, 0, ());
 
   uint32_t const bgColor = drule::rules().GetBgColor(resultZoom);
-  m_cpuDrawer->BeginFrame(pxWidth, pxHeight, dp::Extract(bgColor, 255 - (bgColor >> 24)));
-
-  m2::RectD renderRect = m2::RectD(0, 0, pxWidth, pxHeight);
-  m2::RectD selectRect;
-  m2::RectD clipRect;
-  double const inflationSize = 24 * m_cpuDrawer->GetVisualScale();
-  screen.PtoG(m2::Inflate(renderRect, inflationSize, inflationSize), clipRect);
-  screen.PtoG(renderRect, selectRect);
-
-  uint32_t const tileSize = static_cast<uint32_t>(df::CalculateTileSize(pxWidth, pxHeight));
-  int const drawScale = df::GetDrawTileScale(screen, tileSize, m_cpuDrawer->GetVisualScale());
-  df::watch::FeatureProcessor doDraw(make_ref(m_cpuDrawer), clipRect, screen, drawScale);
-
-  int const upperScale = scales::GetUpperScale();
-  m_model.ForEachFeature(selectRect, doDraw, min(upperScale, drawScale));
-
-  m_cpuDrawer->Flush();
+  dp::Color const bg = dp::Extract(bgColor, 255 - (bgColor >> 24));
+
+  // Sequential watch frames differ mostly by center, so the map content is
+  // rasterized into a backing frame inflated by half the frame size on each
+  // side and cached. Frames at the same zoom are served by cropping the
+  // cached pixels; features are re-read only on zoom change, on map updates
+  // or when the requested window leaves the cached coverage.
+  if (!m_cpuDrawer->RestoreFrameFromCache(screen, resultZoom, pxWidth, pxHeight, bg))
+  {
+    uint32_t const marginX = pxWidth / 2;
+    uint32_t const marginY = pxHeight / 2;
+    uint32_t const backingWidth = pxWidth + 2 * marginX;
+    uint32_t const backingHeight = pxHeight + 2 * marginY;
+
+    ScreenBase backingScreen = screen;
+    backingScreen.OnSize(0, 0, backingWidth, backingHeight);
+    m2::RectD backingGlobalRect;
+    screen.PtoG(m2::RectD(-double(marginX), -double(marginY),
+                          double(pxWidth + marginX), double(pxHeight + marginY)),
+                backingGlobalRect);
+    backingScreen.SetFromRect(m2::AnyRectD(backingGlobalRect));
+
+    m_cpuDrawer->BeginFrame(backingWidth, backingHeight, bg);
+
+    m2::RectD renderRect = m2::RectD(0, 0, backingWidth, backingHeight);
+    m2::RectD selectRect;
+    m2::RectD clipRect;
+    double const inflationSize = 24 * m_cpuDrawer->GetVisualScale();
+    backingScreen.PtoG(m2::Inflate(renderRect, inflationSize, inflationSize), clipRect);
+    backingScreen.PtoG(renderRect, selectRect);
+
+    // The draw scale is calculated for the requested frame size, not for the
+    // backing one, to keep the feature set identical to a direct rendering.
+    uint32_t const tileSize = static_cast<uint32_t>(df::CalculateTileSize(pxWidth, pxHeight));
+    int const drawScale = df::GetDrawTileScale(screen, tileSize, m_cpuDrawer->GetVisualScale());
+    df::watch::FeatureProcessor doDraw(make_ref(m_cpuDrawer), clipRect, backingScreen, drawScale);
+
+    int const upperScale = scales::GetUpperScale();
+    m_model.ForEachFeature(selectRect, doDraw, min(upperScale, drawScale));
+
+    m_cpuDrawer->Flush();
+    m_cpuDrawer->CacheFrame(backingScreen, resultZoom);
+
+    VERIFY(m_cpuDrawer->RestoreFrameFromCache(screen, resultZoom, pxWidth, pxHeight, bg),
+           ("The backing frame must cover the requested frame."));
+  }
+
+  // The overlays depend on the request, so they are always drawn afresh and
+  // are never baked into the cached frame.
   m_cpuDrawer->DrawMyPosition(screen.GtoP(center));
 
   if (symbols.m_showSearchResult)
@@ -617,6 +688,8 @@ void Framework::OnCountryFileDownloaded(storage::TCountryId const & countryId, s
   m_trafficManager.Invalidate();
   InvalidateRect(rect);
   m_searchEngine->ClearCaches();
+  if (IsWatchFrameRendererInited())
+    m_cpuDrawer->ResetFrameCache();
 }
 
 bool Framework::OnCountryFileDelete(storage::TCountryId const & countryId, storage::Storage::TLocalFilePtr const localFile)
@@ -709,9 +782,49 @@ void Framework::RegisterAllMaps()
 
   vector<shared_ptr<LocalCountryFile>> maps;
   m_storage.GetLocalMaps(maps);
-  for (auto const & localFile : maps)
+
+  // Parsing mwm headers is the expensive part of the registration and does
+  // not touch the mwm registry, so infos for all local maps are prepared
+  // concurrently. The registration itself (below) stays on this thread:
+  // it only inserts prepared infos under the registry lock and notifies
+  // observers, which are not ready to be called from arbitrary threads.
+  vector<unique_ptr<MwmInfo>> infos(maps.size());
+  if (!maps.empty())
+  {
+    size_t const numWorkers = min(maps.size(), static_cast<size_t>(GetPlatform().CpuCores()));
+    atomic<size_t> nextMap(0);
+    auto const & index = m_model.GetIndex();
+
+    vector<threads::SimpleThread> workers;
+    workers.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; ++i)
+    {
+      workers.emplace_back([&]()
+      {
+        for (size_t j = nextMap.fetch_add(1); j < maps.size(); j = nextMap.fetch_add(1))
+        {
+          try
+          {
+            infos[j] = index.ParseInfo(*maps[j]);
+          }
+          catch (RootException const & ex)
+          {
+            // Leave the info empty: RegisterMap() below parses it again and
+            // reports the error the usual way.
+            LOG(LWARNING, ("Can't parse header of", maps[j]->GetCountryName(), ex.Msg()));
+          }
+        }
+      });
+    }
+    for (auto & worker : workers)
+      worker.join();
+  }
+
+  for (size_t mapIndex = 0; mapIndex < maps.size(); ++mapIndex)
   {
-    auto p = RegisterMap(*localFile);
+    auto const & localFile = maps[mapIndex];
+    LOG(LINFO, ("Loading map:", localFile->GetCountryName()));
+    auto p = m_model.RegisterMap(*localFile, move(infos[mapIndex]));
     if (p.second != MwmSet::RegResult::Success)
       continue;
 
@@ -734,7 +847,10 @@ void Framework::RegisterAllMaps()
                                           system_clock::now().time_since_epoch()).count()));
   }
 
-  m_searchEngine->SetSupportOldFormat(minFormat < static_cast<int>(version::Format::v3));
+  // Not applied to the search engine here: in the constructor registration
+  // runs concurrently with the engine initialization, so the caller applies
+  // it once the engine is known to be ready.
+  m_minMwmFormat = minFormat;
 }
 
 void Framework::DeregisterAllMaps()
@@ -1342,6 +1458,8 @@ void Framework::MemoryWarning()
   LOG(LINFO, ("MemoryWarning"));
   ClearAllCaches();
   SharedBufferManager::instance().clearReserved();
+  if (m_drapeEngine != nullptr)
+    m_drapeEngine->OnMemoryWarning();
 }
 
 void Framework::EnterBackground()
@@ -1524,6 +1642,8 @@ void Framework::ShowSearchResult(search::Result const & res)
 
   alohalytics::LogEvent("searchShowResult", {{"pos", strings::to_string(res.GetPositionInResults())},
                                              {"result", res.ToStringForStats()}});
+  m_searchResultSaver.Add(res);
+
   place_page::Info info;
   using namespace search;
   int scale;
@@ -1553,6 +1673,16 @@ void Framework::ShowSearchResult(search::Result const & res)
   m_lastTapEvent = MakeTapEvent(center, info.GetID(), TapEvent::Source::Search);
 }
 
+list<Framework::TSavedResult> const & Framework::GetLastSelectedResults()
+{
+  m_searchResultSaver.RemoveObsolete([this](TSavedResult const & r)
+  {
+    auto const id = m_model.GetIndex().GetMwmIdByCountryFile(platform::CountryFile(r.m_mwmName));
+    return id.IsAlive() && id.GetInfo()->GetVersion() == r.m_mwmVersion;
+  });
+  return m_searchResultSaver.Get();
+}
+
 size_t Framework::ShowSearchResults(search::Results const & results)
 {
   using namespace search;
@@ -1685,6 +1815,8 @@ bool Framework::GetDistanceAndAzimut(m2::PointD const & point,
 
 void Framework::CreateDrapeEngine(ref_ptr<dp::OGLContextFactory> contextFactory, DrapeCreationParams && params)
 {
+  my::StartupTracer::Scope tracer("drape_engine_init");
+
   auto idReadFn = [this](df::MapDataProvider::TReadCallback<FeatureID> const & fn,
                          m2::RectD const & r, int scale) -> void
   {
@@ -2037,36 +2169,45 @@ Framework::ParsedRoutingData Framework::GetParsedRoutingData() const
 
 unique_ptr<FeatureType> Framework::GetFeatureAtPoint(m2::PointD const & mercator) const
 {
-  unique_ptr<FeatureType> poi, line, area;
+  // Candidates are only checked by their header and hit-test geometry
+  // here; the single winner is fully parsed afterwards.
+  FeatureID poi, line, area;
+  bool areaIsBuilding = false;
   uint32_t const coastlineType = classif().GetCoastType();
   indexer::ForEachFeatureAtPoint(m_model.GetIndex(), [&, coastlineType](FeatureType & ft)
   {
-    // TODO @alexz
-    // remove manual parsing after refactoring with usermarks'll be finished
-    ft.ParseEverything();
     switch (ft.GetFeatureType())
     {
     case feature::GEOM_POINT:
-      poi.reset(new FeatureType(ft));
+      poi = ft.GetID();
       break;
     case feature::GEOM_LINE:
-      line.reset(new FeatureType(ft));
+      line = ft.GetID();
       break;
     case feature::GEOM_AREA:
       // Buildings have higher priority over other types.
-      if (area && ftypes::IsBuildingChecker::Instance()(*area))
+      if (areaIsBuilding)
         return;
       // Skip/ignore coastlines.
       if (feature::TypesHolder(ft).Has(coastlineType))
         return;
-      area.reset(new FeatureType(ft));
+      area = ft.GetID();
+      areaIsBuilding = ftypes::IsBuildingChecker::Instance()(ft);
       break;
     case feature::GEOM_UNDEFINED:
       ASSERT(false, ("case feature::GEOM_UNDEFINED"));
       break;
     }
   }, mercator);
-  return poi ? move(poi) : (area ? move(area) : move(line));
+
+  FeatureID const & winner = poi.IsValid() ? poi : (area.IsValid() ? area : line);
+  if (!winner.IsValid())
+    return unique_ptr<FeatureType>();
+
+  auto feature = make_unique<FeatureType>();
+  if (!GetFeatureByID(winner, *feature))
+    return unique_ptr<FeatureType>();
+  return feature;
 }
 
 bool Framework::GetFeatureByID(FeatureID const & fid, FeatureType & ft) const
@@ -2459,6 +2600,10 @@ void Framework::BuildRoute(m2::PointD const & start, m2::PointD const & finish,
   if (IsRoutingActive())
     CloseRouting();
 
+  // Appends the request to the benchmark corpus if recording is enabled.
+  routing::RecordRouteRequest(
+      routing::RouteRequestRecord(start, finish, routing::ToString(m_currentRouterType)));
+
   m_routingSession.SetUserCurrentPosition(start);
   m_routingSession.BuildRoute(start, finish, timeoutSec);
 }
@@ -2518,6 +2663,7 @@ routing::RouterType Framework::GetRouter() const
 void Framework::SetRouterImpl(RouterType type)
 {
   unique_ptr<IRouter> router;
+  unique_ptr<IRouter> secondaryRouter;
   unique_ptr<OnlineAbsentCountriesFetcher> fetcher;
 
   auto countryFileGetter = [this](m2::PointD const & p) -> string
@@ -2553,9 +2699,14 @@ void Framework::SetRouterImpl(RouterType type)
                       IndexRouter::CreateCarRouter(countryFileGetter, numMwmIds, m_routingSession, m_model.GetIndex())));
     fetcher.reset(new OnlineAbsentCountriesFetcher(countryFileGetter, localFileChecker));
     m_routingSession.SetRoutingSettings(routing::GetCarRoutingSettings());
+    // Car -> pedestrian is the most frequent profile toggle, so the
+    // pedestrian route is calculated speculatively while the worker is
+    // idle. The way back is served by the cached car route.
+    secondaryRouter = CreatePedestrianAStarBidirectionalRouter(m_model.GetIndex(), countryFileGetter);
   }
 
   m_routingSession.SetRouter(move(router), move(fetcher));
+  m_routingSession.SetSecondaryRouter(move(secondaryRouter));
   m_currentRouterType = type;
 }
 
@@ -2690,6 +2841,8 @@ void Framework::OnBuildRouteReady(Route const & route, IRouter::ResultCode code)
       m2::RectD routeRect = route.GetPoly().GetLimitRect();
       routeRect.Scale(kRouteScaleMultiplier);
       ShowRect(routeRect, -1);
+
+      PrefetchAbsentMapsAlongRoute(route);
     }
   }
   else
@@ -2712,6 +2865,43 @@ void Framework::OnRebuildRouteReady(Route const & route, IRouter::ResultCode cod
   CallRouteBuilded(code, storage::TCountriesVec());
 }
 
+void Framework::PrefetchAbsentMapsAlongRoute(Route const & route)
+{
+  // Prefetching is a data-heavy background activity: do it on Wi-Fi only.
+  if (Platform::ConnectionStatus() != Platform::EConnectionType::CONNECTION_WIFI)
+    return;
+
+  vector<m2::PointD> const & points = route.GetPoly().GetPoints();
+  if (points.empty())
+    return;
+
+  // Consecutive points mostly hit the recent regions cache, so the
+  // lookup below is cheap, but there is no need to test every point of
+  // a long route.
+  size_t const kMaxPointsToTest = 1024;
+  size_t const step = max(size_t(1), points.size() / kMaxPointsToTest);
+  vector<m2::PointD> samples;
+  samples.reserve(points.size() / step + 2);
+  for (size_t i = 0; i < points.size(); i += step)
+    samples.push_back(points[i]);
+  samples.push_back(points.back());
+
+  for (auto const & countryId : m_infoGetter->GetRegionsCountryIdByPoints(samples))
+  {
+    if (!m_storage.IsLeaf(countryId))
+      continue;
+
+    storage::NodeStatuses statuses;
+    m_storage.GetNodeStatuses(countryId, statuses);
+    if (statuses.m_status == storage::NodeStatus::NotDownloaded ||
+        statuses.m_status == storage::NodeStatus::OnDiskOutOfDate)
+    {
+      LOG(LINFO, ("Prefetching map along the route:", countryId));
+      m_storage.DownloadNode(countryId);
+    }
+  }
+}
+
 RouterType Framework::GetBestRouter(m2::PointD const & startPoint, m2::PointD const & finalPoint)
 {
   if (MercatorBounds::DistanceOnEarth(startPoint, finalPoint) < kKeepPedestrianDistanceMeters)
@@ -3355,6 +3545,32 @@ bool Framework::OriginalFeatureHasDefaultName(FeatureID const & fid) const
 
 bool Framework::HasRouteAltitude() const { return m_routingSession.HasRouteAltitude(); }
 
+namespace
+{
+void FillRouteAltitudeBounds(feature::TAltitudes const & altitudes, int32_t & minRouteAltitude,
+                             int32_t & maxRouteAltitude, measurement_utils::Units & altitudeUnits)
+{
+  auto const minMaxIt = minmax_element(altitudes.cbegin(), altitudes.cend());
+  feature::TAltitude const minRouteAltitudeM = *minMaxIt.first;
+  feature::TAltitude const maxRouteAltitudeM = *minMaxIt.second;
+
+  if (!settings::Get(settings::kMeasurementUnits, altitudeUnits))
+    altitudeUnits = measurement_utils::Units::Metric;
+
+  switch (altitudeUnits)
+  {
+  case measurement_utils::Units::Imperial:
+    minRouteAltitude = measurement_utils::MetersToFeet(minRouteAltitudeM);
+    maxRouteAltitude = measurement_utils::MetersToFeet(maxRouteAltitudeM);
+    break;
+  case measurement_utils::Units::Metric:
+    minRouteAltitude = minRouteAltitudeM;
+    maxRouteAltitude = maxRouteAltitudeM;
+    break;
+  }
+}
+}  // namespace
+
 bool Framework::GenerateRouteAltitudeChart(uint32_t width, uint32_t height,
                                            vector<uint8_t> & imageRGBAData,
                                            int32_t & minRouteAltitude, int32_t & maxRouteAltitude,
@@ -3373,25 +3589,47 @@ bool Framework::GenerateRouteAltitudeChart(uint32_t width, uint32_t height,
   if (!maps::GenerateChart(width, height, segDistance, altitudes, GetMapStyle(), imageRGBAData))
     return false;
 
-  auto const minMaxIt = minmax_element(altitudes.cbegin(), altitudes.cend());
-  feature::TAltitude const minRouteAltitudeM = *minMaxIt.first;
-  feature::TAltitude const maxRouteAltitudeM = *minMaxIt.second;
+  FillRouteAltitudeBounds(altitudes, minRouteAltitude, maxRouteAltitude, altitudeUnits);
+  return true;
+}
 
-  if (!settings::Get(settings::kMeasurementUnits, altitudeUnits))
-    altitudeUnits = measurement_utils::Units::Metric;
+void Framework::GenerateRouteAltitudeChartAsync(uint32_t width, uint32_t height,
+                                                TRouteAltitudeChartCallback const & callback) const
+{
+  ASSERT(callback, ());
 
-  switch (altitudeUnits)
+  // The routing session may not be accessed from a worker thread,
+  // so the route data is copied here.
+  feature::TAltitudes altitudes;
+  vector<double> segDistance;
+
+  if (!m_routingSession.GetRouteAltitudesAndDistancesM(segDistance, altitudes) || altitudes.empty())
   {
-  case measurement_utils::Units::Imperial:
-    minRouteAltitude = measurement_utils::MetersToFeet(minRouteAltitudeM);
-    maxRouteAltitude = measurement_utils::MetersToFeet(maxRouteAltitudeM);
-    break;
-  case measurement_utils::Units::Metric:
-    minRouteAltitude = minRouteAltitudeM;
-    maxRouteAltitude = maxRouteAltitudeM;
-    break;
+    callback(false /* success */, {} /* imageRGBAData */, 0 /* minRouteAltitude */,
+             0 /* maxRouteAltitude */, measurement_utils::Units::Metric);
+    return;
   }
-  return true;
+  segDistance.insert(segDistance.begin(), 0.0);
+
+  MapStyle const mapStyle = GetMapStyle();
+  GetPlatform().RunAsync([width, height, mapStyle, callback, segDistance, altitudes]()
+  {
+    vector<uint8_t> imageRGBAData;
+    int32_t minRouteAltitude = 0;
+    int32_t maxRouteAltitude = 0;
+    measurement_utils::Units altitudeUnits = measurement_utils::Units::Metric;
+
+    bool const success =
+        maps::GenerateChart(width, height, segDistance, altitudes, mapStyle, imageRGBAData);
+    if (success)
+      FillRouteAltitudeBounds(altitudes, minRouteAltitude, maxRouteAltitude, altitudeUnits);
+
+    GetPlatform().RunOnGuiThread(
+        [callback, success, imageRGBAData, minRouteAltitude, maxRouteAltitude, altitudeUnits]()
+    {
+      callback(success, imageRGBAData, minRouteAltitude, maxRouteAltitude, altitudeUnits);
+    });
+  });
 }
 
 namespace
@@ -3432,6 +3670,16 @@ void Framework::VisualizeRoadsInRect(m2::RectD const & rect)
   }, kScale);
 }
 
+string Framework::GetMwmSectionStats() const
+{
+  return SectionReadStats::Instance().Dump();
+}
+
+void Framework::ResetMwmSectionStats()
+{
+  SectionReadStats::Instance().Reset();
+}
+
 vector<MwmSet::MwmId> Framework::GetMwmsByRect(m2::RectD const & rect)
 {
   vector<MwmSet::MwmId> result;
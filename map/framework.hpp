@@ -31,6 +31,7 @@
 #include "search/engine.hpp"
 #include "search/mode.hpp"
 #include "search/query_saver.hpp"
+#include "search/result_saver.hpp"
 #include "search/viewport_search_callback.hpp"
 
 #include "storage/downloading_policy.hpp"
@@ -143,7 +144,13 @@ protected:
 
   unique_ptr<search::Engine> m_searchEngine;
 
+  // Minimal mwm format met by the last RegisterAllMaps() call. Recorded
+  // instead of being applied to the search engine right away, because map
+  // registration may run concurrently with the engine initialization.
+  int m_minMwmFormat;
+
   search::QuerySaver m_searchQuerySaver;
+  search::ResultSaver m_searchResultSaver;
 
   ScreenBase m_currentModelView;
   m2::RectD m_visibleViewport;
@@ -318,6 +325,10 @@ public:
   // Utilities
   void VisualizeRoadsInRect(m2::RectD const & rect);
 
+  /// Human-readable per-section mwm read counters, see SectionReadStats.
+  string GetMwmSectionStats() const;
+  void ResetMwmSectionStats();
+
 protected:
   // search::ViewportSearchCallback::Delegate overrides:
   void RunUITask(function<void()> fn) override { GetPlatform().RunOnGuiThread(move(fn)); }
@@ -543,7 +554,16 @@ public:
 
   list<TSearchRequest> const & GetLastSearchQueries() const { return m_searchQuerySaver.Get(); }
   void SaveSearchQuery(TSearchRequest const & query) { m_searchQuerySaver.Add(query); }
-  void ClearSearchHistory() { m_searchQuerySaver.Clear(); }
+  void ClearSearchHistory()
+  {
+    m_searchQuerySaver.Clear();
+    m_searchResultSaver.Clear();
+  }
+
+  using TSavedResult = search::ResultSaver::SavedResult;
+  /// Returns previously chosen results for the zero-query search screen.
+  /// Entries whose mwm was deleted or updated since are dropped.
+  list<TSavedResult> const & GetLastSelectedResults();
 
   /// Calculate distance and direction to POI for the given position.
   /// @param[in]  point             POI's position;
@@ -815,6 +835,16 @@ public:
                                   int32_t & minRouteAltitude, int32_t & maxRouteAltitude,
                                   measurement_utils::Units & altitudeUnits) const;
 
+  using TRouteAltitudeChartCallback =
+      function<void(bool success, vector<uint8_t> const & imageRGBAData, int32_t minRouteAltitude,
+                    int32_t maxRouteAltitude, measurement_utils::Units altitudeUnits)>;
+  /// \brief Asynchronous counterpart of GenerateRouteAltitudeChart. The route
+  /// data is copied on the caller thread, the chart is rasterized on a worker
+  /// thread and |callback| is called on the gui thread. On long routes the
+  /// rasterization takes long enough to be visible as a hang of the UI.
+  void GenerateRouteAltitudeChartAsync(uint32_t width, uint32_t height,
+                                       TRouteAltitudeChartCallback const & callback) const;
+
 public:
   /// @name Editor interface.
   //@{
@@ -846,6 +876,10 @@ private:
   string GetRoutingErrorMessage(routing::IRouter::ResultCode code);
   void OnBuildRouteReady(routing::Route const & route, routing::IRouter::ResultCode code);
   void OnRebuildRouteReady(routing::Route const & route, routing::IRouter::ResultCode code);
+  /// Queues downloading of maps the route passes through but which are
+  /// absent on the device, so cross-border rebuilds don't fail.
+  /// Prefetching is done on Wi-Fi only.
+  void PrefetchAbsentMapsAlongRoute(routing::Route const & route);
 
   TRouteBuildingCallback m_routingCallback;
   routing::RouterType m_currentRouterType;
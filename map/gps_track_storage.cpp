@@ -1,7 +1,6 @@
 #include "map/gps_track_storage.hpp"
 
 #include "coding/endianness.hpp"
-#include "coding/internal/file_data.hpp"
 
 #include "std/algorithm.hpp"
 #include "std/cstring.hpp"
@@ -13,10 +12,12 @@ namespace
 {
 
 // Current file format version
-uint32_t constexpr kCurrentVersion = 1;
+uint32_t constexpr kCurrentVersion = 2;
 
-// Header size in bytes, header consists of uint32_t 'version' only
-uint32_t constexpr kHeaderSize = sizeof(uint32_t);
+// Header consists of uint32_t 'version', uint32_t 'ring capacity in items'
+// and uint64_t 'total number of items ever written'. The write position
+// inside the ring is (total % capacity).
+uint32_t constexpr kHeaderSize = 2 * sizeof(uint32_t) + sizeof(uint64_t);
 
 // Number of items for batch processing
 size_t constexpr kItemBlockSize = 1000;
@@ -27,6 +28,11 @@ size_t constexpr kItemBlockSize = 1000;
 // Size of point in bytes to write in file of read from file
 size_t constexpr kPointSize = 8 * sizeof(double) + sizeof(uint8_t);
 
+// Appended items are packed into a memory buffer and written out only when
+// a page worth of data has accumulated, so track recording does not cause
+// a storage write on every GPS fix.
+size_t constexpr kFlushPageSize = 4096;
+
 // Writes value in memory in LittleEndian
 template <typename T>
 void MemWrite(void * ptr, T value)
@@ -45,7 +51,7 @@ T MemRead(void const * ptr)
 }
 
 void Pack(char * p, location::GpsInfo const & info)
-{  
+{
   MemWrite<double>(p + 0 * sizeof(double), info.m_timestamp);
   MemWrite<double>(p + 1 * sizeof(double), info.m_latitude);
   MemWrite<double>(p + 2 * sizeof(double), info.m_longitude);
@@ -73,31 +79,33 @@ void Unpack(char const * p, location::GpsInfo & info)
   info.m_source = static_cast<location::TLocationSource>(source);
 }
 
-inline size_t GetItemOffset(size_t itemIndex)
-{
-  return kHeaderSize + itemIndex * kPointSize;
-}
-
-inline size_t GetItemCount(size_t fileSize)
+inline size_t GetItemOffset(size_t slotIndex)
 {
-  ASSERT_GREATER_OR_EQUAL(fileSize, kHeaderSize, ());
-  return (fileSize - kHeaderSize) / kPointSize;
+  return kHeaderSize + slotIndex * kPointSize;
 }
 
-inline bool WriteVersion(fstream & f, uint32_t version)
+inline bool WriteHeader(fstream & f, uint32_t capacity, uint64_t writeIndex)
 {
-  static_assert(kHeaderSize == sizeof(version), "");
-  version = SwapIfBigEndian(version);
-  f.write(reinterpret_cast<char const *>(&version), kHeaderSize);
+  char buff[kHeaderSize];
+  MemWrite<uint32_t>(buff, kCurrentVersion);
+  MemWrite<uint32_t>(buff + sizeof(uint32_t), capacity);
+  MemWrite<uint64_t>(buff + 2 * sizeof(uint32_t), writeIndex);
+  f.seekp(0, ios::beg);
+  f.write(buff, kHeaderSize);
   return f.good();
 }
 
-inline bool ReadVersion(fstream & f, uint32_t & version)
+inline bool ReadHeader(fstream & f, uint32_t & version, uint32_t & capacity, uint64_t & writeIndex)
 {
-  static_assert(kHeaderSize == sizeof(version), "");
-  f.read(reinterpret_cast<char *>(&version), kHeaderSize);
-  version = SwapIfBigEndian(version);
-  return f.good();
+  char buff[kHeaderSize];
+  f.seekg(0, ios::beg);
+  f.read(buff, kHeaderSize);
+  if (!f.good())
+    return false;
+  version = MemRead<uint32_t>(buff);
+  capacity = MemRead<uint32_t>(buff + sizeof(uint32_t));
+  writeIndex = MemRead<uint64_t>(buff + 2 * sizeof(uint32_t));
+  return true;
 }
 
 } // namespace
@@ -105,7 +113,7 @@ inline bool ReadVersion(fstream & f, uint32_t & version)
 GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
   : m_filePath(filePath)
   , m_maxItemCount(maxItemCount)
-  , m_itemCount(0)
+  , m_writeIndex(0)
 {
   ASSERT_GREATER(m_maxItemCount, 0, ());
 
@@ -115,31 +123,17 @@ GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
   if (m_stream)
   {
     uint32_t version = 0;
-    if (!ReadVersion(m_stream, version))
-      MYTHROW(OpenException, ("Read version error.", m_filePath));
-
-    if (version == kCurrentVersion)
+    uint32_t capacity = 0;
+    uint64_t writeIndex = 0;
+    if (ReadHeader(m_stream, version, capacity, writeIndex) &&
+        version == kCurrentVersion && capacity == m_maxItemCount)
     {
-      // Seek to end to get file size
-      m_stream.seekp(0, ios::end);
-      if (!m_stream.good())
-        MYTHROW(OpenException, ("Seek to the end error.", m_filePath));
-
-      size_t const fileSize = m_stream.tellp();
-
-      m_itemCount = GetItemCount(fileSize);
-
-      // Set write position after last item position
-      size_t const offset = GetItemOffset(m_itemCount);
-      m_stream.seekp(offset, ios::beg);
-      if (!m_stream.good())
-        MYTHROW(OpenException, ("Seek to the offset error:", offset, m_filePath));
+      m_writeIndex = writeIndex;
     }
     else
     {
+      // Obsolete version or changed ring capacity, start a new track file.
       m_stream.close();
-      // TODO: migration for file m_filePath from version 'version' to version 'kCurrentVersion'
-      // TODO: For now we support only one version, but in future migration may be needed.
     }
   }
 
@@ -151,10 +145,22 @@ GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
     if (!m_stream)
       MYTHROW(OpenException, ("Open file error.", m_filePath));
 
-    if (!WriteVersion(m_stream, kCurrentVersion))
-      MYTHROW(OpenException, ("Write version error.", m_filePath));
+    if (!WriteHeader(m_stream, static_cast<uint32_t>(m_maxItemCount), 0))
+      MYTHROW(OpenException, ("Write header error.", m_filePath));
 
-    m_itemCount = 0;
+    m_writeIndex = 0;
+  }
+}
+
+GpsTrackStorage::~GpsTrackStorage()
+{
+  try
+  {
+    FlushBuffer();
+  }
+  catch (RootException const & e)
+  {
+    LOG(LWARNING, ("Flush on close error:", e.Msg()));
   }
 }
 
@@ -165,41 +171,21 @@ void GpsTrackStorage::Append(vector<TItem> const & items)
   if (items.empty())
     return;
 
-  bool const needTrunc = (m_itemCount + items.size()) > (m_maxItemCount * 2); // see NOTE in declaration
-
-  if (needTrunc)
-    TruncFile();
-
-  // Write position must be after last item position
-  ASSERT_EQUAL(m_stream.tellp(), GetItemOffset(m_itemCount), ());
-
-  vector<char> buff(min(kItemBlockSize, items.size()) * kPointSize);
-  for (size_t i = 0; i < items.size();)
-  {
-    size_t const n = min(items.size() - i, kItemBlockSize);
-
-    for (size_t j = 0; j < n; ++j)
-      Pack(&buff[0] + j * kPointSize, items[i + j]);
-
-    m_stream.write(&buff[0], n * kPointSize);
-    if (!m_stream.good())
-      MYTHROW(WriteException, ("File:", m_filePath));
-
-    i += n;
-  }
-
-  m_stream.flush();
-  if (!m_stream.good())
-    MYTHROW(WriteException, ("File:", m_filePath));
+  size_t const sz = m_buffer.size();
+  m_buffer.resize(sz + items.size() * kPointSize);
+  for (size_t i = 0; i < items.size(); ++i)
+    Pack(&m_buffer[0] + sz + i * kPointSize, items[i]);
 
-  m_itemCount += items.size();
+  if (m_buffer.size() >= kFlushPageSize)
+    FlushBuffer();
 }
 
 void GpsTrackStorage::Clear()
 {
   ASSERT(m_stream.is_open(), ());
 
-  m_itemCount = 0;
+  m_writeIndex = 0;
+  m_buffer.clear();
 
   m_stream.close();
 
@@ -208,35 +194,32 @@ void GpsTrackStorage::Clear()
   if (!m_stream)
     MYTHROW(WriteException, ("File:", m_filePath));
 
-  if (!WriteVersion(m_stream, kCurrentVersion))
+  if (!WriteHeader(m_stream, static_cast<uint32_t>(m_maxItemCount), 0))
     MYTHROW(WriteException, ("File:", m_filePath));
-
-  // Write position is set to the first item in the file
-  ASSERT_EQUAL(m_stream.tellp(), GetItemOffset(0), ());
 }
 
 void GpsTrackStorage::ForEach(std::function<bool(TItem const & item)> const & fn)
 {
   ASSERT(m_stream.is_open(), ());
 
-  size_t i = GetFirstItemIndex();
+  FlushBuffer();
 
-  // Set read position to the first item
-  m_stream.seekg(GetItemOffset(i), ios::beg);
-  if (!m_stream.good())
-    MYTHROW(ReadException, ("File:", m_filePath));
+  size_t const count = GetRingCount();
+  size_t slot = GetRingStart();
 
-  vector<char> buff(min(kItemBlockSize, m_itemCount) * kPointSize);
-  for (; i < m_itemCount;)
+  vector<char> buff(min(kItemBlockSize, count) * kPointSize);
+  for (size_t i = 0; i < count;)
   {
-    size_t const n = min(m_itemCount - i, kItemBlockSize);
+    // Read a contiguous run: up to a block of items or up to the ring end.
+    size_t const n = min(min(count - i, kItemBlockSize), m_maxItemCount - slot);
 
+    m_stream.seekg(GetItemOffset(slot), ios::beg);
     m_stream.read(&buff[0], n * kPointSize);
     if (!m_stream.good())
       MYTHROW(ReadException, ("File:", m_filePath));
 
     for (size_t j = 0; j < n; ++j)
-    {      
+    {
       TItem item;
       Unpack(&buff[0] + j * kPointSize, item);
       if (!fn(item))
@@ -244,74 +227,64 @@ void GpsTrackStorage::ForEach(std::function<bool(TItem const & item)> const & fn
     }
 
     i += n;
+    slot = (slot + n) % m_maxItemCount;
   }
 }
 
-void GpsTrackStorage::TruncFile()
+void GpsTrackStorage::FlushBuffer()
 {
-  string const tmpFilePath = m_filePath + ".tmp";
-
-  // Create a tmp file
-  fstream tmp(tmpFilePath, ios::in | ios::out | ios::binary | ios::trunc);
-
-  if (!tmp)
-    MYTHROW(WriteException, ("Unable to create temporary file:", tmpFilePath));
-
-  if (!WriteVersion(tmp, kCurrentVersion))
-    MYTHROW(WriteException, ("File:", tmpFilePath));
-
-  size_t i = GetFirstItemIndex();
+  if (m_buffer.empty())
+    return;
 
-  // Set read position to the first item
-  m_stream.seekg(GetItemOffset(i), ios::beg);
-  if (!m_stream.good())
-    MYTHROW(ReadException, ("File:", m_filePath));
+  size_t const itemCount = m_buffer.size() / kPointSize;
+  ASSERT_EQUAL(m_buffer.size(), itemCount * kPointSize, ());
 
-  size_t newItemCount = 0;
+  // If the buffer alone overruns the ring, only the last m_maxItemCount
+  // items of it can survive anyway.
+  size_t skipped = 0;
+  if (itemCount > m_maxItemCount)
+    skipped = itemCount - m_maxItemCount;
 
-  // Copy items
-  vector<char> buff(min(kItemBlockSize, m_itemCount) * kPointSize);
-  for (; i < m_itemCount;)
+  size_t slot = (m_writeIndex + skipped) % m_maxItemCount;
+  for (size_t i = skipped; i < itemCount;)
   {
-    size_t const n = min(m_itemCount - i, kItemBlockSize);
+    // Write a contiguous run up to the ring end, then wrap.
+    size_t const n = min(itemCount - i, m_maxItemCount - slot);
 
-    m_stream.read(&buff[0], n * kPointSize);
+    m_stream.seekp(GetItemOffset(slot), ios::beg);
+    m_stream.write(&m_buffer[0] + i * kPointSize, n * kPointSize);
     if (!m_stream.good())
-      MYTHROW(ReadException, ("File:", m_filePath));
-
-    tmp.write(&buff[0], n * kPointSize);
-    if (!tmp.good())
-      MYTHROW(WriteException, ("File:", tmpFilePath));
+      MYTHROW(WriteException, ("File:", m_filePath));
 
     i += n;
-    newItemCount += n;
+    slot = (slot + n) % m_maxItemCount;
   }
-  buff.clear();
-  buff.shrink_to_fit();
-
-  tmp.close();
-  m_stream.close();
 
-  // Replace file
-  if (!my::DeleteFileX(m_filePath) ||
-      !my::RenameFileX(tmpFilePath, m_filePath))
-  {
-    MYTHROW(WriteException, ("File:", m_filePath));
-  }
+  m_writeIndex += itemCount;
+  m_buffer.clear();
 
-  // Reopen stream
-  m_stream.open(m_filePath, ios::in | ios::out | ios::binary | ios::ate);
+  WriteRingHeader();
 
-  if (!m_stream)
+  m_stream.flush();
+  if (!m_stream.good())
     MYTHROW(WriteException, ("File:", m_filePath));
+}
 
-  m_itemCount = newItemCount;
+void GpsTrackStorage::WriteRingHeader()
+{
+  if (!WriteHeader(m_stream, static_cast<uint32_t>(m_maxItemCount), m_writeIndex))
+    MYTHROW(WriteException, ("File:", m_filePath));
+}
 
-  // Write position must be after last item position (end of file)
-  ASSERT_EQUAL(m_stream.tellp(), GetItemOffset(m_itemCount), ());
+size_t GpsTrackStorage::GetRingCount() const
+{
+  return static_cast<size_t>(min(m_writeIndex, static_cast<uint64_t>(m_maxItemCount)));
 }
 
-size_t GpsTrackStorage::GetFirstItemIndex() const
+size_t GpsTrackStorage::GetRingStart() const
 {
-  return (m_itemCount > m_maxItemCount) ? (m_itemCount - m_maxItemCount) : 0; // see NOTE in declaration
+  if (m_writeIndex <= m_maxItemCount)
+    return 0;
+  return static_cast<size_t>(m_writeIndex % m_maxItemCount);
 }
+
@@ -5,10 +5,12 @@
 #include "base/exception.hpp"
 #include "base/macros.hpp"
 
+#include "std/cstdint.hpp"
 #include "std/fstream.hpp"
 #include "std/function.hpp"
 #include "std/limits.hpp"
 #include "std/string.hpp"
+#include "std/vector.hpp"
 
 class GpsTrackStorage final
 {
@@ -25,6 +27,9 @@ public:
   /// @exception OpenException if seek fails.
   GpsTrackStorage(string const & filePath, size_t maxItemCount);
 
+  /// Flushes the points which are still buffered in memory.
+  ~GpsTrackStorage();
+
   /// Appends new point to the storage
   /// @param items - collection of gps track points.
   /// @exceptions WriteException if write fails or ReadException if read fails.
@@ -42,23 +47,25 @@ public:
 private:
   DISALLOW_COPY_AND_MOVE(GpsTrackStorage);
 
-  void TruncFile();
-  size_t GetFirstItemIndex() const;
+  void FlushBuffer();
+  void WriteRingHeader();
+
+  size_t GetRingCount() const;
+  size_t GetRingStart() const;
 
   string const m_filePath;
   size_t const m_maxItemCount;
   fstream m_stream;
-  size_t m_itemCount; // current number of items in file, read note
 
   // NOTE
-  // New items append to the end of file, when file become too big, it is truncated.
-  // Here 'silly window sindrome' is possible: for example max file size is 100k items,
-  // and 99k items are filled, when 2k items is coming, then 98k items is copying to the tmp file
-  // which replaces origin file, and 2k added to the new file. Next time, when 1k items
-  // is comming, then again file truncated. That means that trunc will happens every time.
-  // Similar problem in TCP called 'silly window sindrome'.
-  // To prevent that problem, max file size can be 2 x m_maxItemCount items, when current number of items m_itemCount
-  // exceed 2 x m_maxItemCount, then second half of file - m_maxItemCount items is copying to the tmp file,
-  // which replaces origin file. That means that trunc will happens only then new m_maxItemCount items will be
-  // added but not every time.
+  // The file is a fixed-capacity ring of m_maxItemCount items: the header
+  // keeps the total number of items ever written, and new items overwrite
+  // the oldest ones in place once the ring is full. There is no file
+  // truncation or copying, so appending stays O(batch) forever.
+  // Appended points are first packed into m_buffer and hit the disk only
+  // when a page worth of data has accumulated (or on Clear/ForEach/
+  // destruction), so recording a track does not touch the storage on
+  // every GPS fix.
+  uint64_t m_writeIndex; // total number of items written to the file
+  vector<char> m_buffer; // packed items not yet written to the file
 };
@@ -71,6 +71,28 @@ UNIT_TEST(ReflectChartData_Test)
   TEST_EQUAL(chartData, expectedChartData, ());
 }
 
+UNIT_TEST(DownsampleChartPoints_NoDownsamplingTest)
+{
+  vector<m2::PointD> points = {{0.0, 1.0}, {1.0, 2.0}, {2.0, 3.0}};
+  vector<m2::PointD> const expectedPoints = points;
+  maps::DownsampleChartPoints(points, 3 /* maxPointCount */);
+  TEST_EQUAL(points, expectedPoints, ());
+}
+
+UNIT_TEST(DownsampleChartPoints_Test)
+{
+  vector<m2::PointD> points;
+  for (size_t i = 0; i < 100; ++i)
+    points.emplace_back(static_cast<double>(i), static_cast<double>(i));
+
+  maps::DownsampleChartPoints(points, 5 /* maxPointCount */);
+  TEST_EQUAL(points.size(), 5, ());
+  TEST_EQUAL(points.front(), m2::PointD(0.0, 0.0), ());
+  TEST_EQUAL(points.back(), m2::PointD(99.0, 99.0), ());
+  for (size_t i = 1; i < points.size(); ++i)
+    TEST_LESS(points[i - 1].x, points[i].x, ());
+}
+
 UNIT_TEST(NormalizeChartData_SmokeTest)
 {
   vector<double> const distanceDataM = {0.0, 0.0, 0.0};
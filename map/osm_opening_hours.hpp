@@ -1,5 +1,7 @@
 #pragma once
 
+#include "indexer/opening_hours_cache.hpp"
+
 #include "3party/opening_hours/opening_hours.hpp"
 
 #include "std/chrono.hpp"
@@ -31,7 +33,7 @@ inline string DebugPrint(EPlaceState state)
 
 inline EPlaceState PlaceStateCheck(string const & openingHours, time_t timestamp)
 {
-  osmoh::OpeningHours oh(openingHours);
+  auto const oh = GetCachedOpeningHours(openingHours);
 
   auto future = system_clock::from_time_t(timestamp);
   future += minutes(15);
@@ -43,10 +45,10 @@ inline EPlaceState PlaceStateCheck(string const & openingHours, time_t timestamp
 
   // TODO(mgsergio): Switch to three-stated model instead of two-staed
   // I.e. set unknown if we can't parse or can't answer whether it's open.
-  if (oh.IsValid())
+  if (oh->IsValid())
   {
-    nowState = oh.IsOpen(timestamp) ? OPEN : CLOSED;
-    futureState = oh.IsOpen(system_clock::to_time_t(future)) ? OPEN : CLOSED;
+    nowState = oh->IsOpen(timestamp) ? OPEN : CLOSED;
+    futureState = oh->IsOpen(system_clock::to_time_t(future)) ? OPEN : CLOSED;
   }
 
   EPlaceState state[2][2] = {{EPlaceState::Open, EPlaceState::CloseSoon},
@@ -10,6 +10,8 @@
 
 #include "geometry/mercator.hpp"
 
+#include "coding/zlib.hpp"
+
 #include "platform/platform.hpp"
 
 #include "3party/Alohalytics/src/alohalytics.h"
@@ -232,6 +234,10 @@ void TrafficManager::UpdateViewport(ScreenBase const & screen)
 
 void TrafficManager::ThreadRoutine()
 {
+  // One inflater for the whole polling loop: traffic payloads arrive
+  // every update interval for every active mwm.
+  coding::ZLib::Inflater inflater;
+
   vector<MwmSet::MwmId> mwms;
   while (WaitForRequest(mwms))
   {
@@ -249,7 +255,7 @@ void TrafficManager::ThreadRoutine()
         tag = m_trafficETags[mwm];
       }
 
-      if (info.ReceiveTrafficData(tag))
+      if (info.ReceiveTrafficData(tag, inflater))
       {
         OnTrafficDataResponse(move(info));
       }
@@ -378,11 +384,11 @@ void TrafficManager::OnTrafficDataResponse(traffic::TrafficInfo && info)
     it->second.m_isWaitingForResponse = false;
     it->second.m_lastAvailability = info.GetAvailability();
 
-    if (!info.GetColoring().empty())
+    if (info.GetNumColoredSegments() != 0)
     {
       // Update cache.
       size_t constexpr kElementSize = sizeof(traffic::TrafficInfo::RoadSegmentId) + sizeof(traffic::SpeedGroup);
-      size_t const dataSize = info.GetColoring().size() * kElementSize;
+      size_t const dataSize = info.GetNumColoredSegments() * kElementSize;
       m_currentCacheSizeBytes += (dataSize - it->second.m_dataSize);
       it->second.m_dataSize = dataSize;
       ShrinkCacheToAllowableSize();
@@ -391,7 +397,7 @@ void TrafficManager::OnTrafficDataResponse(traffic::TrafficInfo && info)
     UpdateState();
   }
 
-  if (!info.GetColoring().empty())
+  if (info.GetNumColoredSegments() != 0)
   {
     m_drapeEngine->UpdateTraffic(info);
 
@@ -17,7 +17,7 @@ namespace
 class FindMarkFunctor
 {
 public:
-  FindMarkFunctor(UserMark ** mark, double & minD, m2::AnyRectD const & rect)
+  FindMarkFunctor(UserMark const ** mark, double & minD, m2::AnyRectD const & rect)
     : m_mark(mark)
     , m_minD(minD)
     , m_rect(rect)
@@ -25,7 +25,7 @@ public:
     m_globalCenter = rect.GlobalCenter();
   }
 
-  void operator()(UserMark * mark)
+  void operator()(UserMark const * mark)
   {
     m2::PointD const & org = mark->GetPivot();
     if (m_rect.IsPointInside(org))
@@ -39,7 +39,7 @@ public:
     }
   }
 
-  UserMark ** m_mark;
+  UserMark const ** m_mark;
   double & m_minD;
   m2::AnyRectD const & m_rect;
   m2::PointD m_globalCenter;
@@ -71,15 +71,12 @@ UserMarkContainer::~UserMarkContainer()
 
 UserMark const * UserMarkContainer::FindMarkInRect(m2::AnyRectD const & rect, double & d) const
 {
-  UserMark * mark = nullptr;
+  UserMark const * mark = nullptr;
   if (IsVisible())
   {
     FindMarkFunctor f(&mark, d, rect);
-    for (size_t i = 0; i < m_userMarks.size(); ++i)
-    {
-      if (rect.IsPointInside(m_userMarks[i]->GetPivot()))
-         f(m_userMarks[i].get());
-    }
+    m_marksIndex.ForEachInRect(rect.GetGlobalRect(),
+                               [&f](UserMark const * mark) { f(mark); });
   }
   return mark;
 }
@@ -178,8 +175,9 @@ bool UserMarkContainer::IsDrawable() const
 UserMark * UserMarkContainer::CreateUserMark(m2::PointD const & ptOrg)
 {
   // Push front an user mark.
-  SetDirty();
+  SetDirty(ptOrg);
   m_userMarks.push_front(unique_ptr<UserMark>(AllocateUserMark(ptOrg)));
+  m_marksIndex.Add(m_userMarks.front().get());
   return m_userMarks.front().get();
 }
 
@@ -211,6 +209,10 @@ void UserMarkContainer::Clear(size_t skipCount/* = 0*/)
   SetDirty();
   if (skipCount < m_userMarks.size())
     m_userMarks.erase(m_userMarks.begin(), m_userMarks.end() - skipCount);
+
+  m_marksIndex.Clear();
+  for (auto const & mark : m_userMarks)
+    m_marksIndex.Add(mark.get());
 }
 
 void UserMarkContainer::SetIsDrawable(bool isDrawable)
@@ -250,10 +252,13 @@ template <class T> void DeleteItem(vector<T> & v, size_t i)
 
 void UserMarkContainer::DeleteUserMark(size_t index)
 {
-  SetDirty();
   ASSERT_LESS(index, m_userMarks.size(), ());
   if (index < m_userMarks.size())
+  {
+    SetDirty(m_userMarks[index]->GetPivot());
+    m_marksIndex.Erase(m_userMarks[index].get());
     m_userMarks.erase(m_userMarks.begin() + index);
+  }
   else
     LOG(LWARNING, ("Trying to delete non-existing item at index", index));
 }
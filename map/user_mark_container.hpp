@@ -7,6 +7,7 @@
 #include "geometry/point2d.hpp"
 #include "geometry/rect2d.hpp"
 #include "geometry/any_rect2d.hpp"
+#include "geometry/tree4d.hpp"
 
 #include "std/deque.hpp"
 #include "std/bitset.hpp"
@@ -93,9 +94,21 @@ protected:
   Framework & m_framework;
 
 private:
+  struct MarkIndexTraits
+  {
+    m2::RectD const LimitRect(UserMark const * mark) const
+    {
+      return m2::RectD(mark->GetPivot(), mark->GetPivot());
+    }
+  };
+
   bitset<4> m_flags;
   double m_layerDepth;
   TUserMarksList m_userMarks;
+  // Spatial index over the marks for fast hit-testing. Pivots of the
+  // contained marks never change, so the index is maintained only on
+  // mark creation and deletion.
+  m4::Tree<UserMark const *, MarkIndexTraits> m_marksIndex;
   UserMarkType m_type;
 };
 
@@ -15,6 +15,11 @@
 #pragma mark Define options
 //----------------------------------------------------------------------------------------
 DEFINE_bool(c, false, "Read places from stdin");
+DEFINE_bool(daemon, false,
+            "Serve render requests from stdin reusing one initialized Framework. "
+            "Requests have the format \"lat;lon;zoom[;width;height]\", one per line; "
+            "after each frame a response line (\"OK <filename>\" or \"ERROR <message>\") "
+            "is written to stdout. Malformed requests are reported without exiting.");
 DEFINE_string(place, "", "Define place in format \"lat;lon;zoom\"");
 DEFINE_string(outpath, "./", "Path for output files");
 DEFINE_string(datapath, "", "Path to data directory");
@@ -34,21 +39,36 @@ struct Place
   int height;
 };
 
-Place ParsePlace(string const & src)
+bool TryParsePlace(string const & src, Place & p)
 {
-  Place p;
   try
   {
     strings::SimpleTokenizer token(src, ";");
     p.lat = stod(*token);
     p.lon = stod(*(++token));
     p.zoom = static_cast<int>(stoi(*(++token)));
+    // Optional per-request image size, defaults are taken from the flags.
+    if (++token)
+    {
+      p.width = static_cast<int>(stoi(*token));
+      p.height = static_cast<int>(stoi(*(++token)));
+    }
   }
   catch (exception & e)
   {
     cerr << "Error in [" << src << "]: " << e.what() << endl;
-    exit(1);
+    return false;
   }
+  return true;
+}
+
+Place ParsePlace(string const & src)
+{
+  Place p;
+  p.width = FLAGS_width;
+  p.height = FLAGS_height;
+  if (!TryParsePlace(src, p))
+    exit(1);
   return p;
 }
 
@@ -85,9 +105,9 @@ int main(int argc, char * argv[])
       "Generate screenshots of MAPS.ME maps in chosen places, specified by coordinates and zoom.");
   google::ParseCommandLineFlags(&argc, &argv, true);
 
-  if (!FLAGS_c && FLAGS_place.empty())
+  if (!FLAGS_c && !FLAGS_daemon && FLAGS_place.empty())
   {
-    cerr << "Either -c or -place must be set" << endl;
+    cerr << "Either -c, -daemon or -place must be set" << endl;
     return 1;
   }
 
@@ -104,8 +124,6 @@ int main(int argc, char * argv[])
     auto processPlace = [&](string const & place)
     {
       Place p = ParsePlace(place);
-      p.width = FLAGS_width;
-      p.height = FLAGS_height;
       string const & filename = FilenameSeq(FLAGS_outpath);
       RenderPlace(f, p, filename);
       cout << "Rendering " << place << " into " << filename << " is finished." << endl;
@@ -125,6 +143,38 @@ int main(int argc, char * argv[])
         processPlace(line);
     }
 
+    if (FLAGS_daemon)
+    {
+      // Batch mode for nightly image generation: the Framework with its
+      // registered mwms and render caches is initialized once above, and the
+      // driving process pipes requests in and waits for the response line.
+      for (string line; getline(cin, line);)
+      {
+        if (line.empty())
+          continue;
+
+        Place p;
+        p.width = FLAGS_width;
+        p.height = FLAGS_height;
+        if (!TryParsePlace(line, p))
+        {
+          cout << "ERROR cannot parse request [" << line << "]" << endl;
+          continue;
+        }
+
+        string const & filename = FilenameSeq(FLAGS_outpath);
+        try
+        {
+          RenderPlace(f, p, filename);
+          cout << "OK " << filename << endl;
+        }
+        catch (exception & e)
+        {
+          cout << "ERROR " << e.what() << endl;
+        }
+      }
+    }
+
     f.ReleaseWatchFrameRenderer();
     return 0;
   }
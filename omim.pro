@@ -111,10 +111,12 @@ SUBDIRS = 3party base coding geometry editor indexer routing routing_common sear
 
     search_quality_tool.subdir = search/search_quality/search_quality_tool
     search_quality_tool.depends = $$SUBDIRS
+    search_benchmark_tool.subdir = search/search_quality/search_benchmark_tool
+    search_benchmark_tool.depends = $$SUBDIRS
 
     features_collector_tool.subdir = search/search_quality/features_collector_tool
     features_collector_tool.depends = $$SUBDIRS
-    SUBDIRS *= features_collector_tool search_quality_tool
+    SUBDIRS *= features_collector_tool search_quality_tool search_benchmark_tool
   }
 
   CONFIG(desktop):!CONFIG(no-tests) {
@@ -15,6 +15,7 @@
 #include "indexer/classificator.hpp"
 #include "indexer/index.hpp"
 
+#include "geometry/mercator.hpp"
 #include "geometry/polyline2d.hpp"
 
 #include "base/logging.hpp"
@@ -32,6 +33,10 @@ namespace
 {
 size_t constexpr kCacheLineSize = 64;
 
+// How far from a location reference point a candidate path may deviate;
+// matches the router's distance accuracy.
+double constexpr kPrefetchPaddingM = 1000.0;
+
 struct alignas(kCacheLineSize) Stats
 {
   void Add(Stats const & rhs)
@@ -108,8 +113,8 @@ bool OpenLRSimpleDecoder::SegmentsFilter::Matches(LinearSegment const & segment)
 // static
 int const OpenLRSimpleDecoder::kHandleAllSegments = -1;
 
-OpenLRSimpleDecoder::OpenLRSimpleDecoder(string const & dataFilename, vector<Index> const & indexes)
-  : m_indexes(indexes)
+OpenLRSimpleDecoder::OpenLRSimpleDecoder(string const & dataFilename, Index const & index)
+  : m_index(index)
 {
   auto const load_result = m_document.load_file(dataFilename.data());
   if (!load_result)
@@ -145,10 +150,12 @@ void OpenLRSimpleDecoder::Decode(string const & outputFilename, int const segmen
   size_t constexpr kProgressFrequency = 100;
 
   auto worker = [&segments, &paths, kBatchSize, kProgressFrequency, numThreads, this](
-      size_t threadNum, Index const & index, Stats & stats) {
-    FeaturesRoadGraph roadGraph(index, IRoadGraph::Mode::ObeyOnewayTag,
+      size_t threadNum, Stats & stats) {
+    // The index is read-only and shared; the graph and the road info
+    // caches are per-worker, so the workers never synchronize on them.
+    FeaturesRoadGraph roadGraph(m_index, IRoadGraph::Mode::ObeyOnewayTag,
                                 make_unique<CarModelFactory>());
-    RoadInfoGetter roadInfoGetter(index);
+    RoadInfoGetter roadInfoGetter(m_index);
     Router router(roadGraph, roadInfoGetter);
 
     size_t const numSegments = segments.size();
@@ -166,6 +173,19 @@ void OpenLRSimpleDecoder::Decode(string const & outputFilename, int const segmen
         for (auto const & point : ref.m_points)
           points.emplace_back(point);
 
+        // Prefetch the features along the reference in one index pass:
+        // the router's vicinity queries then hit warm caches instead of
+        // loading features one by one.
+        {
+          m2::RectD rect;
+          for (auto const & point : ref.m_points)
+          {
+            rect.Add(MercatorBounds::RectByCenterXYAndSizeInMeters(
+                MercatorBounds::FromLatLon(point.m_latLon), kPrefetchPaddingM));
+          }
+          roadInfoGetter.Prefetch(rect);
+        }
+
         auto positiveOffsetM = ref.m_positiveOffsetMeters;
         if (positiveOffsetM >= points[0].m_distanceToNextPointM)
         {
@@ -209,8 +229,8 @@ void OpenLRSimpleDecoder::Decode(string const & outputFilename, int const segmen
   vector<Stats> stats(numThreads);
   vector<thread> workers;
   for (size_t i = 1; i < numThreads; ++i)
-    workers.emplace_back(worker, i, ref(m_indexes[i]), ref(stats[i]));
-  worker(0 /* threadNum */, m_indexes[0], stats[0]);
+    workers.emplace_back(worker, i, ref(stats[i]));
+  worker(0 /* threadNum */, stats[0]);
   for (auto & worker : workers)
     worker.join();
 
@@ -35,13 +35,16 @@ public:
 
   static int const kHandleAllSegments;
 
-  OpenLRSimpleDecoder(std::string const & dataFilename, std::vector<Index> const & indexes);
+  // The index is shared between the worker threads in read-only mode;
+  // every worker builds its own road graph and road info contexts on
+  // top of it.
+  OpenLRSimpleDecoder(std::string const & dataFilename, Index const & index);
 
   void Decode(std::string const & outputFilename, int segmentsToHandle,
               SegmentsFilter const & filter, uint32_t numThreads);
 
 private:
-  std::vector<Index> const & m_indexes;
+  Index const & m_index;
   pugi::xml_document m_document;
 };
 }  // namespace openlr
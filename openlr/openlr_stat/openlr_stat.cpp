@@ -30,7 +30,7 @@ namespace
 const int32_t kMinNumThreads = 1;
 const int32_t kMaxNumThreads = 128;
 
-void LoadIndexes(string const & pathToMWMFolder, vector<Index> & indexes)
+void LoadIndex(string const & pathToMWMFolder, Index & index)
 {
   Platform::FilesList files;
   Platform::GetFilesByRegExp(pathToMWMFolder, string(".*\\") + DATA_FILE_EXTENSION, files);
@@ -46,11 +46,8 @@ void LoadIndexes(string const & pathToMWMFolder, vector<Index> & indexes)
     try
     {
       localFile.SyncWithDisk();
-      for (auto & index : indexes)
-      {
-        CHECK_EQUAL(index.RegisterMap(localFile).second, MwmSet::RegResult::Success,
-                    ("Can't register mwm:", localFile));
-      }
+      CHECK_EQUAL(index.RegisterMap(localFile).second, MwmSet::RegResult::Success,
+                  ("Can't register mwm:", localFile));
     }
     catch (RootException const & ex)
     {
@@ -110,11 +107,13 @@ int main(int argc, char * argv[])
 
   auto const numThreads = static_cast<uint32_t>(FLAGS_num_threads);
 
-  vector<Index> indexes(numThreads);
-  LoadIndexes(FLAGS_mwms_path, indexes);
+  // One read-only index is shared between the decoding threads; there
+  // is no point in keeping a copy of all mwm handles per thread.
+  Index index;
+  LoadIndex(FLAGS_mwms_path, index);
 
   OpenLRSimpleDecoder::SegmentsFilter filter(FLAGS_ids_path, FLAGS_multipoints_only);
-  OpenLRSimpleDecoder decoder(FLAGS_input, indexes);
+  OpenLRSimpleDecoder decoder(FLAGS_input, index);
   decoder.Decode(FLAGS_output, FLAGS_limit, filter, numThreads);
 
   return 0;
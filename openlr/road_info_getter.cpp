@@ -3,6 +3,7 @@
 #include "indexer/classificator.hpp"
 #include "indexer/feature.hpp"
 #include "indexer/index.hpp"
+#include "indexer/scales.hpp"
 
 #include "base/assert.hpp"
 
@@ -30,6 +31,26 @@ RoadInfoGetter::RoadInfo RoadInfoGetter::Get(FeatureID const & fid)
   return it->second;
 }
 
+void RoadInfoGetter::Prefetch(m2::RectD const & rect)
+{
+  m_index.ForEachInRect(
+      [this](FeatureType const & ft) {
+        if (ft.GetFeatureType() != feature::GEOM_LINE)
+          return;
+
+        auto const fid = ft.GetID();
+        if (m_cache.find(fid) != m_cache.end())
+          return;
+
+        feature::TypesHolder const types(ft);
+        RoadInfo info;
+        info.m_frc = GetFunctionalRoadClass(types);
+        info.m_fow = GetFormOfWay(types);
+        m_cache.emplace(fid, info);
+      },
+      rect, scales::GetUpperScale());
+}
+
 FunctionalRoadClass RoadInfoGetter::GetFunctionalRoadClass(feature::TypesHolder const & types) const
 {
   if (m_trunkChecker(types))
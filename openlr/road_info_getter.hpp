@@ -5,6 +5,8 @@
 
 #include "indexer/feature_data.hpp"
 
+#include "geometry/rect2d.hpp"
+
 #include "std/map.hpp"
 
 class Classificator;
@@ -32,6 +34,12 @@ public:
 
   RoadInfo Get(FeatureID const & fid);
 
+  // Classifies all linear features in |rect| in a single index pass and
+  // fills the cache with the results. Per-feature Get() calls made while
+  // decoding a location reference inside |rect| then do not touch the
+  // index at all.
+  void Prefetch(m2::RectD const & rect);
+
  private:
   FunctionalRoadClass GetFunctionalRoadClass(feature::TypesHolder const & types) const;
   FormOfWay GetFormOfWay(feature::TypesHolder const & types) const;
@@ -12,11 +12,16 @@
 namespace downloader
 {
 
-ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls)
+ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls, size_t connectionsCount)
 {
-  // init servers list
-  for (size_t i = 0; i < urls.size(); ++i)
-    m_servers.push_back(ServerT(urls[i], SERVER_READY));
+  if (urls.empty())
+    return;
+
+  // Init connection slots. Every slot downloads its own chunk stream, so
+  // there can be more slots than servers.
+  size_t const slotsCount = max(connectionsCount, urls.size());
+  for (size_t i = 0; i < slotsCount; ++i)
+    m_servers.push_back(ServerT(urls[i % urls.size()], SERVER_READY));
 }
 
 pair<ChunksDownloadStrategy::ChunkT *, int>
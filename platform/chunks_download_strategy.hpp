@@ -58,7 +58,11 @@ private:
   pair<ChunkT *, int> GetChunk(RangeT const & range);
 
 public:
-  ChunksDownloadStrategy(vector<string> const & urls);
+  /// @param[in] connectionsCount Desired number of parallel connections.
+  /// Servers are assigned to connections in a round-robin manner, so one
+  /// server can serve several chunk streams at once. 0 means one
+  /// connection per server.
+  explicit ChunksDownloadStrategy(vector<string> const & urls, size_t connectionsCount = 0);
 
   /// Init chunks vector for fileSize.
   void InitChunks(int64_t fileSize, int64_t chunkSize, ChunkStatusT status = CHUNK_FREE);
@@ -295,6 +295,34 @@ UNIT_TEST(ChunksDownloadStrategy)
   TEST_EQUAL(strategy.NextChunk(sEmpty, rEmpty), ChunksDownloadStrategy::EDownloadSucceeded, ());
 }
 
+UNIT_TEST(ChunksDownloadStrategyParallelConnections)
+{
+  string const S1 = "UrlOfServer1";
+
+  typedef pair<int64_t, int64_t> RangeT;
+
+  vector<string> servers;
+  servers.push_back(S1);
+
+  int64_t const FILE_SIZE = 800;
+  int64_t const CHUNK_SIZE = 250;
+  ChunksDownloadStrategy strategy(servers, 3 /* connectionsCount */);
+  strategy.InitChunks(FILE_SIZE, CHUNK_SIZE);
+
+  // One server should serve three parallel chunk streams.
+  string s1, s2, s3, sEmpty;
+  RangeT r1, r2, r3, rEmpty;
+  TEST_EQUAL(strategy.NextChunk(s1, r1), ChunksDownloadStrategy::ENextChunk, ());
+  TEST_EQUAL(strategy.NextChunk(s2, r2), ChunksDownloadStrategy::ENextChunk, ());
+  TEST_EQUAL(strategy.NextChunk(s3, r3), ChunksDownloadStrategy::ENextChunk, ());
+  TEST_EQUAL(strategy.NextChunk(sEmpty, rEmpty), ChunksDownloadStrategy::ENoFreeServers, ());
+
+  TEST_EQUAL(s1, S1, ());
+  TEST_EQUAL(s2, S1, ());
+  TEST_EQUAL(s3, S1, ());
+  TEST(r1 != r2 && r2 != r3 && r3 != r1, (r1, r2, r3));
+}
+
 UNIT_TEST(ChunksDownloadStrategyFAIL)
 {
   string const S1 = "UrlOfServer1";
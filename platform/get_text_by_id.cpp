@@ -8,6 +8,8 @@
 #include "3party/jansson/myjansson.hpp"
 
 #include "std/algorithm.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/target_os.hpp"
 
 namespace
@@ -64,15 +66,39 @@ TGetTextByIdPtr MakeGetTextById(string const & jsonBuffer, string const & locale
 
 TGetTextByIdPtr GetTextByIdFactory(TextSource textSource, string const & localeName)
 {
+  // Parsing a localization file is too expensive to repeat for every
+  // factory call (turn notifications create instances on the routing
+  // thread), so parsed instances are shared. They are immutable, and
+  // the instance is cached under the requested locale even if the
+  // default language was loaded instead, so a missing file is not
+  // probed again.
+  static mutex kCacheMutex;
+  static map<string, TGetTextByIdPtr> kLoadedTexts;
+
+  string const cacheKey = GetTextSourceString(textSource) + "|" + localeName;
+  {
+    lock_guard<mutex> lock(kCacheMutex);
+    auto const it = kLoadedTexts.find(cacheKey);
+    if (it != kLoadedTexts.end())
+      return it->second;
+  }
+
+  TGetTextByIdPtr result;
   string jsonBuffer;
   if (GetJsonBuffer(textSource, localeName, jsonBuffer))
-    return MakeGetTextById(jsonBuffer, localeName);
+    result = MakeGetTextById(jsonBuffer, localeName);
+  else if (GetJsonBuffer(textSource, kDefaultLanguage, jsonBuffer))
+    result = MakeGetTextById(jsonBuffer, kDefaultLanguage);
 
-  if (GetJsonBuffer(textSource, kDefaultLanguage, jsonBuffer))
-    return MakeGetTextById(jsonBuffer, kDefaultLanguage);
+  if (!result)
+  {
+    ASSERT(false, ("Can't find translate for default language. (Lang:", localeName, ")"));
+    return nullptr;
+  }
 
-  ASSERT(false, ("Can't find translate for default language. (Lang:", localeName, ")"));
-  return nullptr;
+  lock_guard<mutex> lock(kCacheMutex);
+  kLoadedTexts[cacheKey] = result;
+  return result;
 }
 
 TGetTextByIdPtr ForTestingGetTextByIdFactory(string const & jsonBuffer, string const & localeName)
@@ -1,7 +1,7 @@
 #pragma once
 
+#include "std/shared_ptr.hpp"
 #include "std/string.hpp"
-#include "std/unique_ptr.hpp"
 #include "std/unordered_map.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
@@ -18,7 +18,9 @@ enum class TextSource
 };
 
 class GetTextById;
-using TGetTextByIdPtr = unique_ptr<GetTextById>;
+/// Instances are immutable after construction, so the same instance is
+/// shared between all the users of a (text source, locale) pair.
+using TGetTextByIdPtr = shared_ptr<GetTextById>;
 using TTranslations = vector<pair<string, string>>;
 
 /// GetTextById represents text messages which are saved in textsDir
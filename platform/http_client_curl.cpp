@@ -129,6 +129,14 @@ Headers ParseHeaders(string const & raw)
     if (cr != string::npos)
       line.erase(cr);
 
+    // When redirects are followed, curl dumps headers of every response
+    // in the chain. Only the headers of the final response matter.
+    if (line.compare(0, 5, "HTTP/") == 0)
+    {
+      headers.clear();
+      continue;
+    }
+
     auto const delims = line.find(": ");
     if (delims != string::npos)
       headers.emplace_back(line.substr(0, delims), line.substr(delims + 2));
@@ -167,21 +175,29 @@ std::string Decompress(std::string const & compressed, std::string const & encod
 namespace platform
 {
 // Extract HTTP headers via temporary file with -D switch.
-// HTTP status code is extracted from curl output (-w switches).
-// Redirects are handled recursively. TODO(AlexZ): avoid infinite redirects loop.
+// HTTP status code and the final url are extracted from curl output (-w switches).
+// Redirects are followed by the same curl process (-L): it reuses the
+// established connection for same-host hops instead of paying a process
+// spawn and a TLS handshake per redirect as the former recursive
+// implementation did.
 bool HttpClient::RunHttpRequest()
 {
   ScopedRemoveFile headers_deleter(GetTmpFileName());
+  ScopedRemoveFile cookie_jar_deleter(GetTmpFileName());
   ScopedRemoveFile body_deleter;
   ScopedRemoveFile received_file_deleter;
 
-  string cmd = "curl -s -w '%{http_code}' -X " + m_httpMethod + " -D '" + headers_deleter.m_fileName + "' ";
+  string cmd = "curl -s -w '%{http_code} %{url_effective}' -X " + m_httpMethod + " -D '" +
+               headers_deleter.m_fileName + "' -L --max-redirs 10 ";
 
   for (auto const & header : m_headers)
   {
     cmd += "-H '" + header.first + ": " + header.second + "' ";
   }
 
+  // The cookie jar enables curl's cookie engine, so cookies set by
+  // intermediate redirect responses are passed to the next hop.
+  cmd += "-c '" + cookie_jar_deleter.m_fileName + "' ";
   if (!m_cookies.empty())
     cmd += "-b '" + m_cookies + "' ";
 
@@ -214,7 +230,12 @@ bool HttpClient::RunHttpRequest()
 
   try
   {
-    m_errorCode = stoi(RunCurl(cmd));
+    string const output = RunCurl(cmd);
+    size_t statusEnd = 0;
+    m_errorCode = stoi(output, &statusEnd);
+    while (statusEnd < output.size() && output[statusEnd] == ' ')
+      ++statusEnd;
+    m_urlReceived = output.substr(statusEnd);
   }
   catch (RootException const & ex)
   {
@@ -232,49 +253,22 @@ bool HttpClient::RunHttpRequest()
     {
       serverCookies += header.second + ", ";
     }
-    else
+    else if (m_loadHeaders)
     {
-      if (header.first == "Location")
-        m_urlReceived = header.second;
-
-      if (m_loadHeaders)
-      {
-        headerKey = header.first;
-        strings::AsciiToLower(headerKey);
-        m_headers.emplace(headerKey, header.second);
-      }
+      headerKey = header.first;
+      strings::AsciiToLower(headerKey);
+      m_headers.emplace(headerKey, header.second);
     }
   }
   m_headers.emplace("Set-Cookie", NormalizeServerCookies(move(serverCookies)));
 
   if (m_urlReceived.empty())
-  {
     m_urlReceived = m_urlRequested;
-    // Load body contents in final request only (skip redirects).
-    // Sometimes server can reply with empty body, and it's ok.
-    if (m_outputFile.empty())
-      m_serverResponse = ReadFileAsString(rfile);
-  }
-  else
-  {
-    // Handle HTTP redirect.
-    // TODO(AlexZ): Should we check HTTP redirect code here?
-    LOG(LDEBUG, ("HTTP redirect", m_errorCode, "to", m_urlReceived));
 
-    HttpClient redirect(m_urlReceived);
-    redirect.SetCookies(CombinedCookies());
-
-    if (!redirect.RunHttpRequest())
-    {
-      m_errorCode = -1;
-      return false;
-    }
-
-    m_errorCode = redirect.ErrorCode();
-    m_urlReceived = redirect.UrlReceived();
-    m_headers = move(redirect.m_headers);
-    m_serverResponse = move(redirect.m_serverResponse);
-  }
+  // Load body contents of the final response only (redirects are
+  // followed by curl). Sometimes server can reply with empty body, and it's ok.
+  if (m_outputFile.empty())
+    m_serverResponse = ReadFileAsString(rfile);
 
   auto const it = m_headers.find("content-encoding");
   if (it != m_headers.end())
@@ -15,8 +15,12 @@
 #include "base/logging.hpp"
 #include "base/string_utils.hpp"
 
+#include "std/limits.hpp"
 #include "std/list.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/unique_ptr.hpp"
+#include "std/vector.hpp"
 
 #include "3party/Alohalytics/src/alohalytics.h"
 
@@ -81,6 +85,46 @@ HttpThread * CreateNativeHttpThread(string const & url,
                                     string const & postBody = string());
 void DeleteNativeHttpThread(HttpThread * thread);
 
+namespace
+{
+// Active request counters and throughput stats per priority class,
+// shared by all requests. See DownloadPriority comment in the header.
+mutex g_downloadClassesMutex;
+size_t g_activeRequests[2] = {0, 0};
+HttpRequest::ClassStats g_classStats[2];
+
+size_t ClassIndex(DownloadPriority priority)
+{
+  return priority == DownloadPriority::Foreground ? 0 : 1;
+}
+
+void RegisterRequest(DownloadPriority priority)
+{
+  lock_guard<mutex> lock(g_downloadClassesMutex);
+  ++g_activeRequests[ClassIndex(priority)];
+  ++g_classStats[ClassIndex(priority)].m_requestsStarted;
+}
+
+void UnregisterRequest(DownloadPriority priority)
+{
+  lock_guard<mutex> lock(g_downloadClassesMutex);
+  ASSERT_GREATER(g_activeRequests[ClassIndex(priority)], 0, ());
+  --g_activeRequests[ClassIndex(priority)];
+}
+
+void RegisterTraffic(DownloadPriority priority, uint64_t bytes)
+{
+  lock_guard<mutex> lock(g_downloadClassesMutex);
+  g_classStats[ClassIndex(priority)].m_bytesDownloaded += bytes;
+}
+
+bool IsForegroundDownloadActive()
+{
+  lock_guard<mutex> lock(g_downloadClassesMutex);
+  return g_activeRequests[ClassIndex(DownloadPriority::Foreground)] != 0;
+}
+}  // namespace
+
 //////////////////////////////////////////////////////////////////////////////////////////
 /// Stores server response into the memory
 class MemoryHttpRequest : public HttpRequest, public IHttpThreadCallback
@@ -95,6 +139,7 @@ class MemoryHttpRequest : public HttpRequest, public IHttpThreadCallback
   {
     m_writer.Write(buffer, size);
     m_progress.first += size;
+    RegisterTraffic(m_priority, size);
     if (m_onProgress)
       m_onProgress(*this);
     return true;
@@ -117,16 +162,17 @@ class MemoryHttpRequest : public HttpRequest, public IHttpThreadCallback
   }
 
 public:
-  MemoryHttpRequest(string const & url, CallbackT const & onFinish, CallbackT const & onProgress)
-    : HttpRequest(onFinish, onProgress), m_requestUrl(url), m_writer(m_downloadedData)
+  MemoryHttpRequest(string const & url, CallbackT const & onFinish, CallbackT const & onProgress,
+                    DownloadPriority priority)
+    : HttpRequest(onFinish, onProgress, priority), m_requestUrl(url), m_writer(m_downloadedData)
   {
     m_thread = CreateNativeHttpThread(url, *this);
     ASSERT ( m_thread, () );
   }
 
   MemoryHttpRequest(string const & url, string const & postData,
-                    CallbackT onFinish, CallbackT onProgress)
-    : HttpRequest(onFinish, onProgress), m_writer(m_downloadedData)
+                    CallbackT onFinish, CallbackT onProgress, DownloadPriority priority)
+    : HttpRequest(onFinish, onProgress, priority), m_writer(m_downloadedData)
   {
     m_thread = CreateNativeHttpThread(url, *this, 0, -1, -1, postData);
     ASSERT ( m_thread, () );
@@ -154,19 +200,47 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
   string m_filePath;
   unique_ptr<FileWriter> m_writer;
 
+  // With several parallel streams their writes interleave, and pushing
+  // every small piece through seek+write would flush the writer on each
+  // one. Instead every chunk is staged in memory and written to its file
+  // position with a single write when the chunk completes.
+  struct ChunkBuffer
+  {
+    int64_t m_nextOffset;
+    vector<uint8_t> m_data;
+  };
+  map<int64_t, ChunkBuffer> m_chunkBuffers;  ///< Key is the chunk beginning offset.
+
   size_t m_goodChunksCount;
   bool m_doCleanProgressFiles;
 
+  /// @return the number of chunk streams the request may run right now.
+  /// Background downloads yield the link to foreground requests by
+  /// keeping a single stream; preemption is at chunk granularity, the
+  /// running chunks are always completed.
+  size_t MaxChunkStreams() const
+  {
+    if (m_priority == DownloadPriority::Background && IsForegroundDownloadActive())
+      return 1;
+    return numeric_limits<size_t>::max();
+  }
+
   ChunksDownloadStrategy::ResultT StartThreads()
   {
     string url;
     pair<int64_t, int64_t> range;
-    ChunksDownloadStrategy::ResultT result;
-    while ((result = m_strategy.NextChunk(url, range)) == ChunksDownloadStrategy::ENextChunk)
+    ChunksDownloadStrategy::ResultT result = ChunksDownloadStrategy::ENoFreeServers;
+    while (m_threads.size() < MaxChunkStreams() &&
+           (result = m_strategy.NextChunk(url, range)) == ChunksDownloadStrategy::ENextChunk)
     {
       HttpThread * p = CreateNativeHttpThread(url, *this, range.first, range.second, m_progress.second);
       ASSERT ( p, () );
       m_threads.push_back(make_pair(p, range.first));
+
+      ChunkBuffer & buffer = m_chunkBuffers[range.first];
+      buffer.m_nextOffset = range.first;
+      buffer.m_data.clear();
+      buffer.m_data.reserve(range.second - range.first + 1);
     }
     return result;
   }
@@ -203,15 +277,43 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     ASSERT_EQUAL(id, threads::GetCurrentThreadID(), ("OnWrite called from different threads"));
 #endif
 
+    // Append the piece to the chunk it continues.
+    for (auto & entry : m_chunkBuffers)
+    {
+      ChunkBuffer & chunk = entry.second;
+      if (chunk.m_nextOffset == offset)
+      {
+        uint8_t const * bytes = static_cast<uint8_t const *>(buffer);
+        chunk.m_data.insert(chunk.m_data.end(), bytes, bytes + size);
+        chunk.m_nextOffset += size;
+        RegisterTraffic(m_priority, size);
+        return true;
+      }
+    }
+
+    LOG(LWARNING, ("Unexpected offset", offset, "in downloaded data"));
+    return false;
+  }
+
+  bool WriteChunk(int64_t begRange)
+  {
+    auto const it = m_chunkBuffers.find(begRange);
+    if (it == m_chunkBuffers.end())
+    {
+      LOG(LERROR, ("No downloaded data for chunk at position", begRange));
+      return false;
+    }
+
     try
     {
-      m_writer->Seek(offset);
-      m_writer->Write(buffer, size);
+      m_writer->Seek(begRange);
+      if (!it->second.m_data.empty())
+        m_writer->Write(it->second.m_data.data(), it->second.m_data.size());
       return true;
     }
     catch (Writer::Exception const & e)
     {
-      LOG(LWARNING, ("Can't write buffer for size", size, e.Msg()));
+      LOG(LWARNING, ("Can't write chunk with size", it->second.m_data.size(), e.Msg()));
       return false;
     }
   }
@@ -239,7 +341,11 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     ASSERT_EQUAL(id, threads::GetCurrentThreadID(), ("OnFinish called from different threads"));
 #endif
 
-    bool const isChunkOk = (httpCode == 200);
+    bool isChunkOk = (httpCode == 200);
+    if (isChunkOk)
+      isChunkOk = WriteChunk(begRange);
+    m_chunkBuffers.erase(begRange);
+
     string const urlError = m_strategy.ChunkFinished(isChunkOk, make_pair(begRange, endRange));
 
     // remove completed chunk from the list, beg is the key
@@ -321,9 +427,10 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 public:
   FileHttpRequest(vector<string> const & urls, string const & filePath, int64_t fileSize,
                   CallbackT const & onFinish, CallbackT const & onProgress,
-                  int64_t chunkSize, bool doCleanProgressFiles)
-    : HttpRequest(onFinish, onProgress), m_strategy(urls), m_filePath(filePath),
-      m_goodChunksCount(0), m_doCleanProgressFiles(doCleanProgressFiles)
+                  int64_t chunkSize, bool doCleanProgressFiles, size_t connectionsCount,
+                  DownloadPriority priority)
+    : HttpRequest(onFinish, onProgress, priority), m_strategy(urls, connectionsCount),
+      m_filePath(filePath), m_goodChunksCount(0), m_doCleanProgressFiles(doCleanProgressFiles)
   {
     ASSERT ( !urls.empty(), () );
 
@@ -389,35 +496,42 @@ public:
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
-HttpRequest::HttpRequest(CallbackT const & onFinish, CallbackT const & onProgress)
+HttpRequest::HttpRequest(CallbackT const & onFinish, CallbackT const & onProgress,
+                         DownloadPriority priority)
   : m_status(EInProgress), m_progress(make_pair(0, -1)),
-    m_onFinish(onFinish), m_onProgress(onProgress)
+    m_onFinish(onFinish), m_onProgress(onProgress), m_priority(priority)
 {
+  RegisterRequest(m_priority);
 }
 
 HttpRequest::~HttpRequest()
 {
+  UnregisterRequest(m_priority);
 }
 
-HttpRequest * HttpRequest::Get(string const & url, CallbackT const & onFinish, CallbackT const & onProgress)
+HttpRequest * HttpRequest::Get(string const & url, CallbackT const & onFinish,
+                               CallbackT const & onProgress, DownloadPriority priority)
 {
-  return new MemoryHttpRequest(url, onFinish, onProgress);
+  return new MemoryHttpRequest(url, onFinish, onProgress, priority);
 }
 
 HttpRequest * HttpRequest::PostJson(string const & url, string const & postData,
-                                    CallbackT const & onFinish, CallbackT const & onProgress)
+                                    CallbackT const & onFinish, CallbackT const & onProgress,
+                                    DownloadPriority priority)
 {
-  return new MemoryHttpRequest(url, postData, onFinish, onProgress);
+  return new MemoryHttpRequest(url, postData, onFinish, onProgress, priority);
 }
 
 HttpRequest * HttpRequest::GetFile(vector<string> const & urls,
                                    string const & filePath, int64_t fileSize,
                                    CallbackT const & onFinish, CallbackT const & onProgress,
-                                   int64_t chunkSize, bool doCleanOnCancel)
+                                   int64_t chunkSize, bool doCleanOnCancel,
+                                   size_t connectionsCount, DownloadPriority priority)
 {
   try
   {
-    return new FileHttpRequest(urls, filePath, fileSize, onFinish, onProgress, chunkSize, doCleanOnCancel);
+    return new FileHttpRequest(urls, filePath, fileSize, onFinish, onProgress, chunkSize,
+                               doCleanOnCancel, connectionsCount, priority);
   }
   catch (FileWriter::Exception const & e)
   {
@@ -427,4 +541,11 @@ HttpRequest * HttpRequest::GetFile(vector<string> const & urls,
   return nullptr;
 }
 
+// static
+HttpRequest::ClassStats HttpRequest::GetClassStats(DownloadPriority priority)
+{
+  lock_guard<mutex> lock(g_downloadClassesMutex);
+  return g_classStats[ClassIndex(priority)];
+}
+
 } // namespace downloader
@@ -9,6 +9,17 @@
 namespace downloader
 {
 
+/// Priority class of a download. Foreground requests are small and
+/// latency-sensitive (server lists, online fetchers); background ones
+/// are bulk transfers (map files) which yield the link to foreground
+/// requests by keeping at most one chunk stream while any foreground
+/// request is in progress.
+enum class DownloadPriority
+{
+  Foreground,
+  Background
+};
+
 /// Request in progress will be canceled on delete
 class HttpRequest
 {
@@ -24,13 +35,22 @@ public:
   typedef pair<int64_t, int64_t> ProgressT;
   typedef function<void (HttpRequest &)> CallbackT;
 
+  /// Started requests and downloaded bytes of a priority class.
+  struct ClassStats
+  {
+    uint64_t m_requestsStarted = 0;
+    uint64_t m_bytesDownloaded = 0;
+  };
+
 protected:
   StatusT m_status;
   ProgressT m_progress;
   CallbackT m_onFinish;
   CallbackT m_onProgress;
+  DownloadPriority m_priority;
 
-  explicit HttpRequest(CallbackT const & onFinish, CallbackT const & onProgress);
+  HttpRequest(CallbackT const & onFinish, CallbackT const & onProgress,
+              DownloadPriority priority = DownloadPriority::Foreground);
 
 public:
   virtual ~HttpRequest() = 0;
@@ -43,21 +63,31 @@ public:
   /// Response saved to memory buffer and retrieved with Data()
   static HttpRequest * Get(string const & url,
                            CallbackT const & onFinish,
-                           CallbackT const & onProgress = CallbackT());
+                           CallbackT const & onProgress = CallbackT(),
+                           DownloadPriority priority = DownloadPriority::Foreground);
 
   /// Content-type for request is always "application/json"
   static HttpRequest * PostJson(string const & url, string const & postData,
                                 CallbackT const & onFinish,
-                                CallbackT const & onProgress = CallbackT());
+                                CallbackT const & onProgress = CallbackT(),
+                                DownloadPriority priority = DownloadPriority::Foreground);
 
   /// Download file to filePath.
   /// @param[in]  fileSize  Correct file size (needed for resuming and reserving).
+  /// @param[in]  connectionsCount  Desired number of parallel chunk streams,
+  ///                               one server can serve several of them.
   static HttpRequest * GetFile(vector<string> const & urls,
                                string const & filePath, int64_t fileSize,
                                CallbackT const & onFinish,
                                CallbackT const & onProgress = CallbackT(),
                                int64_t chunkSize = 512 * 1024,
-                               bool doCleanOnCancel = true);
+                               bool doCleanOnCancel = true,
+                               size_t connectionsCount = 4,
+                               DownloadPriority priority = DownloadPriority::Foreground);
+
+  /// @return per-class throughput counters accumulated since the
+  /// application start.
+  static ClassStats GetClassStats(DownloadPriority priority);
 };
 
 } // namespace downloader
@@ -15,6 +15,7 @@
 
 #include "std/algorithm.hpp"
 #include "std/cctype.hpp"
+#include "std/ctime.hpp"
 #include "std/regex.hpp"
 #include "std/sstream.hpp"
 #include "std/unique_ptr.hpp"
@@ -138,6 +139,142 @@ inline string GetDataDirFullPath(string const & dataDir)
   return dataDir.empty() ? platform.WritableDir()
                          : my::JoinFoldersToPath(platform.WritableDir(), dataDir);
 }
+
+char const kLocalMapsSnapshotFile[] = "local_maps_snapshot.txt";
+uint32_t constexpr kLocalMapsSnapshotFormat = 1;
+
+inline string GetLocalMapsSnapshotPath(string const & dir)
+{
+  return my::JoinFoldersToPath(dir, kLocalMapsSnapshotFile);
+}
+
+inline string GetVersionDirectory(string const & dir, int64_t version)
+{
+  return version == 0 ? dir : my::JoinFoldersToPath(dir, strings::to_string(version));
+}
+
+// Restores the result of the previous scan of |dir| if neither |dir|
+// nor any of its version subdirectories were modified since the
+// snapshot was written. Returns false if the snapshot is absent,
+// written for another data version or stale; in this case a full scan
+// is needed.
+bool LoadLocalMapsSnapshot(string const & dir, int64_t latestVersion,
+                           vector<LocalCountryFile> & localFiles)
+{
+  string content;
+  try
+  {
+    ModelReaderPtr reader(GetPlatform().GetReader(GetLocalMapsSnapshotPath(dir), "f"));
+    reader.ReadAsString(content);
+  }
+  catch (RootException const &)
+  {
+    return false;  // No snapshot yet.
+  }
+
+  istringstream is(content);
+  uint32_t format = 0;
+  uint64_t saveTime = 0;
+  int64_t snapshotLatestVersion = 0;
+  is >> format >> saveTime >> snapshotLatestVersion;
+  if (!is || format != kLocalMapsSnapshotFormat || snapshotLatestVersion != latestVersion)
+    return false;
+
+  vector<LocalCountryFile> files;
+  string record;
+  while (is >> record)
+  {
+    if (record == "d")
+    {
+      int64_t version;
+      uint64_t snapshotMtime;
+      if (!(is >> version >> snapshotMtime))
+        return false;
+      uint64_t mtime;
+      if (!Platform::GetFileModificationTime(GetVersionDirectory(dir, version), mtime))
+        return false;
+      // A directory modified during the same second the snapshot was
+      // saved can be modified again without changing its mtime.
+      if (mtime != snapshotMtime || mtime >= saveTime)
+        return false;
+    }
+    else if (record == "f")
+    {
+      int64_t version;
+      string name;
+      uint64_t size, mtime;
+      if (!(is >> version >> name >> size >> mtime))
+        return false;
+      files.push_back(
+          LocalCountryFile(GetVersionDirectory(dir, version), CountryFile(name), version));
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  localFiles.insert(localFiles.end(), files.begin(), files.end());
+  return true;
+}
+
+// Saves the results of a completed scan of |dir|. Directory mtimes
+// are recorded to let the next FindAllLocalMapsAndCleanup() call skip
+// the scan when nothing has changed, see LoadLocalMapsSnapshot().
+void SaveLocalMapsSnapshot(string const & dir, int64_t latestVersion,
+                           vector<LocalCountryFile> const & localFiles)
+{
+  string const path = GetLocalMapsSnapshotPath(dir);
+  try
+  {
+    // Create the file before directory mtimes are recorded: the
+    // creation changes the mtime of |dir| while in-place rewrites
+    // don't.
+    if (!Platform::IsFileExistsByFullPath(path))
+      my::FileData(path, my::FileData::OP_WRITE_TRUNCATE);
+
+    ostringstream os;
+    os << kLocalMapsSnapshotFormat << " " << static_cast<uint64_t>(time(nullptr)) << " "
+       << latestVersion << "\n";
+
+    uint64_t mtime;
+    if (!Platform::GetFileModificationTime(dir, mtime))
+      return;
+    os << "d 0 " << mtime << "\n";
+
+    Platform::TFilesWithType fwts;
+    Platform::GetFilesByType(dir, Platform::FILE_TYPE_DIRECTORY, fwts);
+    for (auto const & fwt : fwts)
+    {
+      int64_t version;
+      if (!ParseVersion(fwt.first, version))
+        continue;
+      if (!Platform::GetFileModificationTime(my::JoinFoldersToPath(dir, fwt.first), mtime))
+        return;
+      os << "d " << version << " " << mtime << "\n";
+    }
+
+    for (LocalCountryFile const & localFile : localFiles)
+    {
+      string const filePath = my::JoinFoldersToPath(
+          localFile.GetDirectory(), localFile.GetCountryName() + DATA_FILE_EXTENSION);
+      uint64_t size = 0;
+      mtime = 0;
+      Platform::GetFileSizeByFullPath(filePath, size);
+      Platform::GetFileModificationTime(filePath, mtime);
+      os << "f " << localFile.GetVersion() << " " << localFile.GetCountryName() << " " << size
+         << " " << mtime << "\n";
+    }
+
+    string const content = os.str();
+    my::FileData file(path, my::FileData::OP_WRITE_TRUNCATE);
+    file.Write(content.data(), content.size());
+  }
+  catch (RootException const & ex)
+  {
+    LOG(LWARNING, ("Can't save local maps snapshot:", path, ex.Msg()));
+  }
+}
 }  // namespace
 
 void DeleteDownloaderFilesForCountry(int64_t version, CountryFile const & countryFile)
@@ -233,22 +370,37 @@ void FindAllLocalMapsAndCleanup(int64_t latestVersion, string const & dataDir,
                                 vector<LocalCountryFile> & localFiles)
 {
   string const dir = GetDataDirFullPath(dataDir);
-  FindAllLocalMapsInDirectoryAndCleanup(dir, 0 /* version */, latestVersion, localFiles);
 
-  Platform::TFilesWithType fwts;
-  Platform::GetFilesByType(dir, Platform::FILE_TYPE_DIRECTORY, fwts);
-  for (auto const & fwt : fwts)
+  // With a lot of maps on slow flash the scan below dominates the
+  // startup time, so its result is snapshotted. When the snapshot is
+  // valid, the previous scan found nothing left to cleanup and the
+  // directories were not modified since, so the cleanup is not needed
+  // either.
+  if (!LoadLocalMapsSnapshot(dir, latestVersion, localFiles))
   {
-    string const & subdir = fwt.first;
-    int64_t version;
-    if (!ParseVersion(subdir, version) || version > latestVersion)
-      continue;
+    size_t const scanStart = localFiles.size();
+
+    FindAllLocalMapsInDirectoryAndCleanup(dir, 0 /* version */, latestVersion, localFiles);
+
+    Platform::TFilesWithType fwts;
+    Platform::GetFilesByType(dir, Platform::FILE_TYPE_DIRECTORY, fwts);
+    for (auto const & fwt : fwts)
+    {
+      string const & subdir = fwt.first;
+      int64_t version;
+      if (!ParseVersion(subdir, version) || version > latestVersion)
+        continue;
+
+      string const fullPath = my::JoinFoldersToPath(dir, subdir);
+      FindAllLocalMapsInDirectoryAndCleanup(fullPath, version, latestVersion, localFiles);
+      Platform::EError err = Platform::RmDir(fullPath);
+      if (err != Platform::ERR_OK && err != Platform::ERR_DIRECTORY_NOT_EMPTY)
+        LOG(LWARNING, ("Can't remove directory:", fullPath, err));
+    }
 
-    string const fullPath = my::JoinFoldersToPath(dir, subdir);
-    FindAllLocalMapsInDirectoryAndCleanup(fullPath, version, latestVersion, localFiles);
-    Platform::EError err = Platform::RmDir(fullPath);
-    if (err != Platform::ERR_OK && err != Platform::ERR_DIRECTORY_NOT_EMPTY)
-      LOG(LWARNING, ("Can't remove directory:", fullPath, err));
+    SaveLocalMapsSnapshot(
+        dir, latestVersion,
+        vector<LocalCountryFile>(localFiles.begin() + scanStart, localFiles.end()));
   }
 
   // World and WorldCoasts can be stored in app bundle or in resources
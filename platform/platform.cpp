@@ -9,6 +9,8 @@
 #include "base/logging.hpp"
 #include "base/string_utils.hpp"
 
+#include "std/algorithm.hpp"
+#include "std/bind.hpp"
 #include "std/target_os.hpp"
 #include "std/thread.hpp"
 
@@ -199,6 +201,67 @@ unsigned Platform::CpuCores() const
   return cores > 0 ? cores : 1;
 }
 
+void Platform::RunOnGuiThread(TFunctor const & fn)
+{
+  RunOnGuiThread(fn, "default" /* source */);
+}
+
+void Platform::RunOnGuiThread(TFunctor const & fn, string const & source)
+{
+  bool needWakeup = false;
+  {
+    lock_guard<mutex> lock(m_guiThreadTasksMutex);
+    m_guiThreadTasks.push_back({fn, m_guiThreadTimer.ElapsedSeconds(), source});
+
+    GuiThreadStats & stats = m_guiThreadStats[source];
+    ++stats.m_tasksPosted;
+    stats.m_maxQueueDepth = max(stats.m_maxQueueDepth, m_guiThreadTasks.size());
+
+    if (!m_guiThreadFlushPending)
+    {
+      m_guiThreadFlushPending = true;
+      ++stats.m_wakeups;
+      needWakeup = true;
+    }
+  }
+
+  // Posted outside of the lock: stub implementations of
+  // PostGuiThreadTask invoke the task synchronously.
+  if (needWakeup)
+    PostGuiThreadTask(bind(&Platform::FlushGuiThreadTasks, this));
+}
+
+void Platform::FlushGuiThreadTasks()
+{
+  vector<GuiThreadTask> tasks;
+  {
+    lock_guard<mutex> lock(m_guiThreadTasksMutex);
+    tasks.swap(m_guiThreadTasks);
+    m_guiThreadFlushPending = false;
+  }
+
+  double const now = m_guiThreadTimer.ElapsedSeconds();
+  {
+    lock_guard<mutex> lock(m_guiThreadTasksMutex);
+    for (auto const & task : tasks)
+    {
+      GuiThreadStats & stats = m_guiThreadStats[task.m_source];
+      double const latency = now - task.m_postTime;
+      stats.m_totalLatencySec += latency;
+      stats.m_maxLatencySec = max(stats.m_maxLatencySec, latency);
+    }
+  }
+
+  for (auto const & task : tasks)
+    task.m_fn();
+}
+
+map<string, Platform::GuiThreadStats> Platform::GetGuiThreadStats() const
+{
+  lock_guard<mutex> lock(m_guiThreadTasksMutex);
+  return m_guiThreadStats;
+}
+
 string DebugPrint(Platform::EError err)
 {
   switch (err)
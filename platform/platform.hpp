@@ -7,9 +7,12 @@
 
 #include "base/exception.hpp"
 
+#include "base/timer.hpp"
+
 #include "std/bitset.hpp"
 #include "std/function.hpp"
 #include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/string.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
@@ -167,6 +170,9 @@ public:
   /// @return false if file is not exist
   /// @note Try do not use in client production code
   static bool GetFileSizeByFullPath(string const & filePath, uint64_t & size);
+  /// @return false if file (or directory) does not exist
+  /// @note Modification time is in seconds since the Unix epoch.
+  static bool GetFileModificationTime(string const & path, uint64_t & mtime);
   //@}
 
   /// Used to check available free storage space for downloading.
@@ -182,7 +188,28 @@ public:
   /// @name Functions for concurrent tasks.
   //@{
   typedef function<void()> TFunctor;
+
+  /// Statistics of RunOnGuiThread usage gathered per posting source.
+  struct GuiThreadStats
+  {
+    uint64_t m_tasksPosted = 0;
+    /// Cross-thread wakeups actually paid. Tasks posted while a flush
+    /// is pending ride along with it for free.
+    uint64_t m_wakeups = 0;
+    size_t m_maxQueueDepth = 0;
+    double m_totalLatencySec = 0.0;
+    double m_maxLatencySec = 0.0;
+  };
+
+  /// Posts |fn| for execution on the gui thread. Tasks posted before
+  /// the gui thread pumps its queue are coalesced into a single
+  /// cross-thread wakeup and are executed in the posting order.
+  /// |source| tags the post in GetGuiThreadStats for debugging.
   void RunOnGuiThread(TFunctor const & fn);
+  void RunOnGuiThread(TFunctor const & fn, string const & source);
+
+  map<string, GuiThreadStats> GetGuiThreadStats() const;
+
   enum Priority
   {
     EPriorityBackground,
@@ -232,6 +259,26 @@ public:
 
 private:
   void GetSystemFontNames(FilesList & res) const;
+
+  /// Platform-dependent single-wakeup primitive used by RunOnGuiThread.
+  /// Implementations must call |fn| exactly once on the gui thread.
+  void PostGuiThreadTask(TFunctor const & fn);
+
+  /// Runs all the coalesced tasks on the gui thread.
+  void FlushGuiThreadTasks();
+
+  struct GuiThreadTask
+  {
+    TFunctor m_fn;
+    double m_postTime;
+    string m_source;
+  };
+
+  vector<GuiThreadTask> m_guiThreadTasks;
+  bool m_guiThreadFlushPending = false;
+  map<string, GuiThreadStats> m_guiThreadStats;
+  my::Timer m_guiThreadTimer;
+  mutable mutex m_guiThreadTasksMutex;
 };
 
 extern Platform & GetPlatform();
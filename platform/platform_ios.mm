@@ -127,7 +127,7 @@ string Platform::GetMemoryInfo() const
   return ss.str();
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   dispatch_async_f(dispatch_get_main_queue(), new TFunctor(fn), &PerformImpl);
 }
@@ -95,7 +95,7 @@ static void PerformImpl(void * obj)
   delete f;
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   dispatch_async_f(dispatch_get_main_queue(), new TFunctor(fn), &PerformImpl);
 }
@@ -83,7 +83,7 @@ void Platform::SetupMeasurementSystem() const
 }
 
 #if defined(OMIM_OS_LINUX)
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   // Following hack is used to post on main message loop |fn| when
   // |source| is destroyed (at the exit of the code block).
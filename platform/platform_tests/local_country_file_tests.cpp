@@ -308,6 +308,41 @@ UNIT_TEST(LocalCountryFile_AllLocalFilesLookup)
   TEST_EQUAL(1, localFilesSet.count(expectedItalyFile), (localFiles));
 }
 
+UNIT_TEST(LocalCountryFile_SnapshotLookup)
+{
+  CountryFile const italyFile("Italy");
+  CountryFile const franceFile("France");
+
+  ScopedDir testDir("10101");
+
+  settings::Delete("LastMigration");
+
+  string const snapshotPath =
+      my::JoinFoldersToPath(GetPlatform().WritableDir(), "local_maps_snapshot.txt");
+  my::DeleteFileX(snapshotPath);
+  MY_SCOPE_GUARD(snapshotGuard, bind(&my::DeleteFileX, snapshotPath));
+
+  ScopedFile testItalyMapFile(testDir, italyFile, MapOptions::Map, "Italy-map");
+
+  vector<LocalCountryFile> localFiles;
+  FindAllLocalMapsAndCleanup(10101 /* latestVersion */, localFiles);
+  TEST(Platform::IsFileExistsByFullPath(snapshotPath), ());
+  LocalCountryFile const expectedItalyFile(testDir.GetFullPath(), italyFile, 10101);
+  TEST(Contains(localFiles, expectedItalyFile), (localFiles));
+
+  // A repeated lookup, snapshotted or not, returns the same maps.
+  vector<LocalCountryFile> cachedFiles;
+  FindAllLocalMapsAndCleanup(10101 /* latestVersion */, cachedFiles);
+  TEST_EQUAL(localFiles, cachedFiles, ());
+
+  // A map added after the snapshot was written must be found.
+  ScopedFile testFranceMapFile(testDir, franceFile, MapOptions::Map, "France-map");
+  vector<LocalCountryFile> updatedFiles;
+  FindAllLocalMapsAndCleanup(10101 /* latestVersion */, updatedFiles);
+  LocalCountryFile const expectedFranceFile(testDir.GetFullPath(), franceFile, 10101);
+  TEST(Contains(updatedFiles, expectedFranceFile), (updatedFiles));
+}
+
 UNIT_TEST(LocalCountryFile_PreparePlaceForCountryFiles)
 {
   Platform & platform = GetPlatform();
@@ -54,7 +54,7 @@ string Platform::UniqueClientId() const
   return FromTizenString(pApp->GetAppId());
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   /// @todo
   fn();
@@ -184,6 +184,16 @@ bool Platform::GetFileSizeByFullPath(string const & filePath, uint64_t & size)
   else return false;
 }
 
+// static
+bool Platform::GetFileModificationTime(string const & path, uint64_t & mtime)
+{
+  struct stat s;
+  if (stat(path.c_str(), &s) != 0)
+    return false;
+  mtime = static_cast<uint64_t>(s.st_mtime);
+  return true;
+}
+
 Platform::TStorageStatus Platform::GetWritableStorageStatus(uint64_t neededSize) const
 {
   struct statfs st;
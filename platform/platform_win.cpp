@@ -123,7 +123,7 @@ string Platform::UniqueClientId() const
   return "@TODO";
 }
 
-void Platform::RunOnGuiThread(TFunctor const & fn)
+void Platform::PostGuiThreadTask(TFunctor const & fn)
 {
   /// @todo
   fn();
@@ -176,3 +176,13 @@ bool Platform::GetFileSizeByFullPath(string const & filePath, uint64_t & size)
   }
   return false;
 }
+
+// static
+bool Platform::GetFileModificationTime(string const & path, uint64_t & mtime)
+{
+  struct _stat32 stats;
+  if (_stat32(path.c_str(), &stats) != 0)
+    return false;
+  mtime = static_cast<uint64_t>(stats.st_mtime);
+  return true;
+}
@@ -7,6 +7,7 @@
 #include "coding/reader_streambuf.hpp"
 #include "coding/file_writer.hpp"
 #include "coding/file_reader.hpp"
+#include "coding/internal/file_data.hpp"
 
 #include "geometry/rect2d.hpp"
 #include "geometry/any_rect2d.hpp"
@@ -20,6 +21,9 @@
 namespace
 {
 constexpr char kDelimChar = '=';
+// Changed values are appended to the settings file as a log; the file
+// is compacted by a full rewrite after this number of appended records.
+size_t constexpr kOpsPerCompaction = 100;
 }  // namespace
 
 namespace settings
@@ -48,7 +52,13 @@ StringStorage::StringStorage()
 
       string const key = line.substr(0, delimPos);
       string const value = line.substr(delimPos + 1);
-      if (!key.empty() && !value.empty())
+      if (key.empty())
+        continue;
+
+      // An empty value is a key deletion record in the append log.
+      if (value.empty())
+        m_values.erase(key);
+      else
         m_values[key] = value;
     }
   }
@@ -79,6 +89,32 @@ void StringStorage::Save() const
   }
 }
 
+void StringStorage::AppendRecord(string const & key, string const & value)
+{
+  if (++m_appendedRecords >= kOpsPerCompaction)
+  {
+    m_appendedRecords = 0;
+    Save();
+    return;
+  }
+
+  try
+  {
+    my::FileData file(GetPlatform().SettingsPathForFile(SETTINGS_FILE_NAME),
+                      my::FileData::OP_APPEND);
+    string line(key);
+    line += kDelimChar;
+    line += value;
+    line += '\n';
+    file.Write(line.data(), line.size());
+  }
+  catch (RootException const & ex)
+  {
+    // Ignore all settings saving exceptions.
+    LOG(LWARNING, ("Saving settings:", ex.Msg()));
+  }
+}
+
 StringStorage & StringStorage::Instance()
 {
   static StringStorage inst;
@@ -89,6 +125,7 @@ void StringStorage::Clear()
 {
   lock_guard<mutex> guard(m_mutex);
   m_values.clear();
+  m_appendedRecords = 0;
   Save();
 }
 
@@ -109,7 +146,7 @@ void StringStorage::SetValue(string const & key, string && value)
   lock_guard<mutex> guard(m_mutex);
 
   m_values[key] = move(value);
-  Save();
+  AppendRecord(key, m_values[key]);
 }
 
 void StringStorage::DeleteKeyAndValue(string const & key)
@@ -120,7 +157,7 @@ void StringStorage::DeleteKeyAndValue(string const & key)
   if (found != m_values.end())
   {
     m_values.erase(found);
-    Save();
+    AppendRecord(key, string() /* value */);
   }
 }
 
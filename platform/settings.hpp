@@ -24,7 +24,14 @@ class StringStorage
   mutable mutex m_mutex;
 
   StringStorage();
+  /// Rewrites the whole settings file (compaction).
   void Save() const;
+  /// Appends one "key=value" record to the settings file instead of
+  /// rewriting it. An empty |value| marks the key as deleted. The file
+  /// is compacted after kOpsPerCompaction appended records.
+  void AppendRecord(string const & key, string const & value);
+
+  size_t m_appendedRecords = 0;
 
 public:
   static StringStorage & Instance();
@@ -12,6 +12,8 @@
 
 #include "openlr/openlr_sample.hpp"
 
+#include "drape/frame_profiler.hpp"
+
 #include "platform/settings.hpp"
 #include "platform/platform.hpp"
 
@@ -156,6 +158,11 @@ MainWindow::MainWindow(Framework & framework)
   connect(m_quitTrafficModeAction, SIGNAL(triggered()), this, SLOT(OnQuitTrafficMode()));
   trafficMarkup->addAction(m_quitTrafficModeAction);
 
+  QMenu * debugMenu = new QMenu(tr("Debug"), this);
+  menuBar()->addMenu(debugMenu);
+  debugMenu->addAction(tr("Dump frame profile"), this, SLOT(OnDumpFrameProfile()));
+  debugMenu->addAction(tr("Dump mwm section stats"), this, SLOT(OnDumpMwmSectionStats()));
+
 #ifndef OMIM_OS_WINDOWS
   QMenu * helpMenu = new QMenu(tr("Help"), this);
   menuBar()->addMenu(helpMenu);
@@ -681,4 +688,14 @@ void MainWindow::OnQuitTrafficMode()
   DestroyTrafficPanel();
   m_trafficMode = nullptr;
 }
+
+void MainWindow::OnDumpFrameProfile()
+{
+  LOG(LINFO, (dp::FrameProfiler::Instance().Dump()));
+}
+
+void MainWindow::OnDumpMwmSectionStats()
+{
+  LOG(LINFO, (m_pDrawWidget->GetFramework().GetMwmSectionStats()));
+}
 }  // namespace qt
@@ -107,5 +107,8 @@ namespace qt
     void OnOpenTrafficSample();
     void OnSaveTrafficSample();
     void OnQuitTrafficMode();
+
+    void OnDumpFrameProfile();
+    void OnDumpMwmSectionStats();
   };
 }
@@ -128,6 +128,7 @@ AsyncRouter::~AsyncRouter()
     unique_lock<mutex> ul(m_guard);
 
     ResetDelegate();
+    CancelSpeculation();
 
     m_threadExit = true;
     m_threadCondVar.notify_one();
@@ -146,6 +147,14 @@ void AsyncRouter::SetRouter(unique_ptr<IRouter> && router, unique_ptr<IOnlineFet
   m_absentFetcher = move(fetcher);
 }
 
+void AsyncRouter::SetSecondaryRouter(unique_ptr<IRouter> && router)
+{
+  unique_lock<mutex> ul(m_guard);
+
+  CancelSpeculation();
+  m_secondaryRouter = move(router);
+}
+
 void AsyncRouter::CalculateRoute(m2::PointD const & startPoint, m2::PointD const & direction,
                                  m2::PointD const & finalPoint, TReadyCallback const & readyCallback,
                                  RouterDelegate::TProgressCallback const & progressCallback,
@@ -153,11 +162,16 @@ void AsyncRouter::CalculateRoute(m2::PointD const & startPoint, m2::PointD const
 {
   unique_lock<mutex> ul(m_guard);
 
+  // Cached routes are valid for the previous points only.
+  if (!(startPoint == m_startPoint) || !(finalPoint == m_finalPoint))
+    m_routeCache.clear();
+
   m_startPoint = startPoint;
   m_startDirection = direction;
   m_finalPoint = finalPoint;
 
   ResetDelegate();
+  CancelSpeculation();
 
   m_delegate = make_shared<RouterDelegateProxy>(readyCallback, m_pointCheckCallback, progressCallback, timeoutSec);
 
@@ -173,6 +187,7 @@ void AsyncRouter::ClearState()
   m_threadCondVar.notify_one();
 
   ResetDelegate();
+  CancelSpeculation();
 }
 
 void AsyncRouter::LogCode(IRouter::ResultCode code, double const elapsedSec)
@@ -228,6 +243,15 @@ void AsyncRouter::ResetDelegate()
   }
 }
 
+void AsyncRouter::CancelSpeculation()
+{
+  if (m_speculativeDelegate)
+  {
+    m_speculativeDelegate->Cancel();
+    m_speculativeDelegate.reset();
+  }
+}
+
 void AsyncRouter::ThreadFunc()
 {
   while (true)
@@ -250,6 +274,7 @@ void AsyncRouter::ThreadFunc()
     }
 
     CalculateRoute();
+    CalculateSpeculativeRoute();
   }
 }
 
@@ -259,6 +284,7 @@ void AsyncRouter::CalculateRoute()
   m2::PointD startPoint, finalPoint, startDirection;
   shared_ptr<IOnlineFetcher> absentFetcher;
   shared_ptr<IRouter> router;
+  unique_ptr<Route> cachedRoute;
 
   {
     unique_lock<mutex> ul(m_guard);
@@ -278,6 +304,22 @@ void AsyncRouter::CalculateRoute()
     delegate = m_delegate;
     router = m_router;
     absentFetcher = m_absentFetcher;
+
+    auto const it = m_routeCache.find(router->GetName());
+    if (it != m_routeCache.end())
+    {
+      cachedRoute = move(it->second);
+      m_routeCache.erase(it);
+    }
+  }
+
+  if (cachedRoute)
+  {
+    // The same request has already been calculated with this router
+    // (speculatively or before a profile toggle) - no need to do it again.
+    LOG(LINFO, ("Route served from the speculative route cache."));
+    delegate->OnReady(*cachedRoute, IRouter::NoError);
+    return;
   }
 
   Route route(router->GetName());
@@ -310,9 +352,19 @@ void AsyncRouter::CalculateRoute()
 
   SendStatistics(startPoint, startDirection, finalPoint, code, route, elapsedSec);
 
-  // Draw route without waiting network latency.
   if (code == IRouter::NoError)
+  {
+    {
+      unique_lock<mutex> ul(m_guard);
+      // Keep a copy for an instant answer in case the user toggles the
+      // profile back without changing the points.
+      if (startPoint == m_startPoint && finalPoint == m_finalPoint)
+        m_routeCache[router->GetName()] = make_unique<Route>(route);
+    }
+
+    // Draw route without waiting network latency.
     delegate->OnReady(route, code);
+  }
 
   bool const needFetchAbsent = (code != IRouter::Cancelled);
 
@@ -336,6 +388,67 @@ void AsyncRouter::CalculateRoute()
     delegate->OnReady(route, code);
 }
 
+void AsyncRouter::CalculateSpeculativeRoute()
+{
+  shared_ptr<RouterDelegateProxy> delegate;
+  m2::PointD startPoint, finalPoint, startDirection;
+  shared_ptr<IRouter> router;
+
+  {
+    unique_lock<mutex> ul(m_guard);
+
+    if (m_threadExit || m_hasRequest || m_clearState || !m_secondaryRouter)
+      return;
+    // The secondary route is already in the cache.
+    if (m_routeCache.count(m_secondaryRouter->GetName()) != 0)
+      return;
+
+    startPoint = m_startPoint;
+    finalPoint = m_finalPoint;
+    startDirection = m_startDirection;
+    router = m_secondaryRouter;
+    // No callbacks: the result goes to the route cache only. The
+    // delegate is kept to cancel the calculation when a real request
+    // arrives.
+    m_speculativeDelegate = make_shared<RouterDelegateProxy>(
+        nullptr /* onReady */, nullptr /* onPointCheck */, nullptr /* onProgress */,
+        0 /* timeoutSec */);
+    delegate = m_speculativeDelegate;
+  }
+
+  Route route(router->GetName());
+  IRouter::ResultCode code = IRouter::InternalError;
+
+  my::Timer timer;
+  try
+  {
+    LOG(LDEBUG, ("Speculatively calculating the", router->GetName(), "route from", startPoint,
+                 "to", finalPoint));
+    code = router->CalculateRoute(startPoint, startDirection, finalPoint, delegate->GetDelegate(),
+                                  route);
+  }
+  catch (RootException const & e)
+  {
+    LOG(LWARNING, ("Exception happened while calculating speculative route:", e.Msg()));
+  }
+
+  unique_lock<mutex> ul(m_guard);
+
+  if (delegate == m_speculativeDelegate)
+    m_speculativeDelegate.reset();
+
+  if (code != IRouter::NoError || delegate->GetDelegate().IsCancelled())
+    return;
+
+  // The request could have changed while the route was being calculated.
+  if (startPoint == m_startPoint && finalPoint == m_finalPoint && router == m_secondaryRouter)
+  {
+    LOG(LINFO, ("Speculative", router->GetName(), "route found, elapsed seconds:",
+                timer.ElapsedSeconds()));
+    m_routeCache[router->GetName()] = make_unique<Route>(route);
+  }
+}
+
 void AsyncRouter::SendStatistics(m2::PointD const & startPoint, m2::PointD const & startDirection,
                                  m2::PointD const & finalPoint,
                                  IRouter::ResultCode resultCode,
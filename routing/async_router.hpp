@@ -37,6 +37,13 @@ public:
   /// @param fetcher pointer to a online fetcher
   void SetRouter(unique_ptr<IRouter> && router, unique_ptr<IOnlineFetcher> && fetcher);
 
+  /// Sets an optional router for the secondary profile (nullptr disables
+  /// speculation). When set, after each completed request the same
+  /// request is calculated with this router while the worker is idle and
+  /// the result is kept in the route cache, so switching the profile
+  /// without changing the points delivers the alternate route instantly.
+  void SetSecondaryRouter(unique_ptr<IRouter> && router);
+
   /// Main method to calulate new route from startPt to finalPt with start direction
   /// Processed result will be passed to callback. Callback will called at GUI thread.
   ///
@@ -61,7 +68,12 @@ private:
   /// This function is called in worker thread
   void CalculateRoute();
 
+  /// Calculates the current request with the secondary router while the
+  /// worker is idle. Called in worker thread.
+  void CalculateSpeculativeRoute();
+
   void ResetDelegate();
+  void CancelSpeculation();
 
   /// These functions are called to send statistics about the routing
   void SendStatistics(m2::PointD const & startPoint, m2::PointD const & startDirection,
@@ -117,6 +129,18 @@ private:
   shared_ptr<RouterDelegateProxy> m_delegate;
   shared_ptr<IOnlineFetcher> m_absentFetcher;
   shared_ptr<IRouter> m_router;
+  shared_ptr<IRouter> m_secondaryRouter;
+
+  /// Delegate of the speculative calculation; used only to cancel it
+  /// when a real request arrives.
+  shared_ptr<RouterDelegateProxy> m_speculativeDelegate;
+
+  /// Successful routes for the current m_startPoint/m_finalPoint pair
+  /// keyed by router name: the last primary result and the speculative
+  /// secondary one. Entries are served one-shot instead of a
+  /// recalculation when the profile is toggled with the same points;
+  /// the cache is dropped as soon as the points change.
+  map<string, unique_ptr<Route>> m_routeCache;
 
   TRoutingStatisticsCallback const m_routingStatisticsCallback;
   RouterDelegate::TPointCheckCallback const m_pointCheckCallback;
@@ -3,10 +3,14 @@
 #include "base/assert.hpp"
 #include "base/cancellable.hpp"
 #include "std/algorithm.hpp"
+#include "std/atomic.hpp"
 #include "std/functional.hpp"
 #include "std/iostream.hpp"
+#include "std/limits.hpp"
 #include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/queue.hpp"
+#include "std/thread.hpp"
 #include "std/vector.hpp"
 
 namespace routing
@@ -77,6 +81,16 @@ public:
                                my::Cancellable const & cancellable = my::Cancellable(),
                                TOnVisitedVertexCallback onVisitedVertexCallback = nullptr) const;
 
+  // Same as FindPathBidirectional but the forward and the backward waves run on their
+  // own threads and prune each other through a lock-free shared best-path bound.
+  // |graph| edge getters and heuristic have to be thread-safe: the waves call them
+  // concurrently. The only cross-thread data are the visited vertices maps which are
+  // guarded by per-wave mutexes, the shared bound is a plain atomic.
+  Result FindPathBidirectionalParallel(
+      TGraphType & graph, TVertexType const & startVertex, TVertexType const & finalVertex,
+      RoutingResult<TVertexType> & result, my::Cancellable const & cancellable = my::Cancellable(),
+      TOnVisitedVertexCallback onVisitedVertexCallback = nullptr) const;
+
 private:
   // Periodicy of checking is cancellable cancelled.
   static uint32_t constexpr kCancelledPollPeriod = 128;
@@ -425,6 +439,157 @@ typename AStarAlgorithm<TGraph>::Result AStarAlgorithm<TGraph>::FindPathBidirect
   return Result::NoPath;
 }
 
+template <typename TGraph>
+typename AStarAlgorithm<TGraph>::Result AStarAlgorithm<TGraph>::FindPathBidirectionalParallel(
+    TGraphType & graph, TVertexType const & startVertex, TVertexType const & finalVertex,
+    RoutingResult<TVertexType> & result, my::Cancellable const & cancellable,
+    TOnVisitedVertexCallback onVisitedVertexCallback) const
+{
+  if (nullptr == onVisitedVertexCallback)
+    onVisitedVertexCallback = [](TVertexType const &, TVertexType const &){};
+
+  BidirectionalStepContext forward(true /* forward */, startVertex, finalVertex, graph);
+  BidirectionalStepContext backward(false /* forward */, startVertex, finalVertex, graph);
+
+  forward.bestDistance[startVertex] = 0.0;
+  forward.queue.push(State(startVertex, 0.0 /* distance */));
+
+  backward.bestDistance[finalVertex] = 0.0;
+  backward.queue.push(State(finalVertex, 0.0 /* distance */));
+
+  // The lock-free shared bound: both waves read it on every settled vertex
+  // to prune and to decide on termination.
+  atomic<double> bestPathReducedLength(numeric_limits<double>::max());
+  atomic<bool> foundAnyPath(false);
+  atomic<bool> finished(false);
+  atomic<bool> cancelled(false);
+  // Reduced distance of the last settled vertex of each wave. It grows monotonically,
+  // a lagging value only delays the termination, never breaks it.
+  atomic<double> topDistance[2] = {{0.0}, {0.0}};
+
+  // Guards bestDistance and parent of the corresponding wave: they are written
+  // by the own thread and read by the opposite one on the meeting check.
+  mutex contextMutex[2];
+  // Guards the best path snapshot: meeting vertices and the real path length.
+  mutex bestPathMutex;
+  double bestPathRealLength = 0.0;
+
+  auto wave = [&](BidirectionalStepContext * cur, BidirectionalStepContext * nxt, size_t dir) {
+    vector<TEdgeType> adj;
+    uint32_t steps = 0;
+
+    while (!finished && !cur->queue.empty())
+    {
+      ++steps;
+
+      if (steps % kCancelledPollPeriod == 0 && cancellable.IsCancelled())
+      {
+        cancelled = true;
+        finished = true;
+        return;
+      }
+
+      State const stateV = cur->queue.top();
+      cur->queue.pop();
+
+      // Reading the own map needs no lock: the opposite thread never writes it.
+      if (stateV.distance > cur->bestDistance[stateV.vertex])
+        continue;
+
+      topDistance[dir] = stateV.distance;
+
+      if (foundAnyPath &&
+          stateV.distance + topDistance[1 - dir] >= bestPathReducedLength - kEpsilon)
+      {
+        finished = true;
+        return;
+      }
+
+      if (dir == 0 && steps % kVisitedVerticesPeriod == 0)
+        onVisitedVertexCallback(stateV.vertex, cur->forward ? cur->finalVertex : cur->startVertex);
+
+      cur->GetAdjacencyList(stateV.vertex, adj);
+      for (auto const & edge : adj)
+      {
+        State stateW(edge.GetTarget(), 0.0);
+        if (stateV.vertex == stateW.vertex)
+          continue;
+
+        double const len = edge.GetWeight();
+        double const pV = cur->ConsistentHeuristic(stateV.vertex);
+        double const pW = cur->ConsistentHeuristic(stateW.vertex);
+        double const reducedLen = len + pW - pV;
+
+        CHECK(reducedLen >= -kEpsilon, ("Invariant violated:", reducedLen, "<", -kEpsilon));
+        double const newReducedDist = stateV.distance + max(reducedLen, 0.0);
+
+        auto const itCur = cur->bestDistance.find(stateW.vertex);
+        if (itCur != cur->bestDistance.end() && newReducedDist >= itCur->second - kEpsilon)
+          continue;
+
+        bool foundMeeting = false;
+        double distW = 0.0;
+        {
+          lock_guard<mutex> guard(contextMutex[1 - dir]);
+          auto const itNxt = nxt->bestDistance.find(stateW.vertex);
+          if (itNxt != nxt->bestDistance.end())
+          {
+            foundMeeting = true;
+            distW = itNxt->second;
+          }
+        }
+
+        if (foundMeeting)
+        {
+          double const curPathReducedLength = newReducedDist + distW;
+          if (curPathReducedLength < bestPathReducedLength)
+          {
+            lock_guard<mutex> guard(bestPathMutex);
+            // Repeat the check under the mutex: the bound could be improved meanwhile.
+            if (curPathReducedLength < bestPathReducedLength)
+            {
+              bestPathRealLength = stateV.distance + len + distW;
+              bestPathRealLength += cur->pS - pV;
+              bestPathRealLength += nxt->pS - nxt->ConsistentHeuristic(stateW.vertex);
+
+              cur->bestVertex = stateV.vertex;
+              nxt->bestVertex = stateW.vertex;
+              bestPathReducedLength = curPathReducedLength;
+              foundAnyPath = true;
+            }
+          }
+        }
+
+        stateW.distance = newReducedDist;
+        {
+          lock_guard<mutex> guard(contextMutex[dir]);
+          cur->bestDistance[stateW.vertex] = newReducedDist;
+          cur->parent[stateW.vertex] = stateV.vertex;
+        }
+        cur->queue.push(stateW);
+      }
+    }
+
+    finished = true;
+  };
+
+  thread backwardThread(wave, &backward, &forward, 1 /* dir */);
+  wave(&forward, &backward, 0 /* dir */);
+  backwardThread.join();
+
+  if (cancelled)
+    return Result::Cancelled;
+
+  if (!foundAnyPath)
+    return Result::NoPath;
+
+  ReconstructPathBidirectional(forward.bestVertex, backward.bestVertex, forward.parent,
+                               backward.parent, result.path);
+  result.distance = bestPathRealLength;
+  CHECK(!result.path.empty(), ());
+  return Result::OK;
+}
+
 // static
 template <typename TGraph>
 void AStarAlgorithm<TGraph>::ReconstructPath(TVertexType const & v,
@@ -2,6 +2,15 @@
 
 namespace routing
 {
+namespace
+{
+// Number of segments after the current position checked first by
+// GetClosestProjection. At 1 Hz a position fix advances the projection
+// by a few segments at most, so almost every update is served by this
+// small window; the scan up to the route end runs only when the window
+// has no match (e.g. after a tunnel or a long pause).
+size_t constexpr kForwardSegmentsWindow = 32;
+}  // namespace
 
 using Iter = routing::FollowedPolyline::Iter;
 
@@ -73,7 +82,8 @@ void FollowedPolyline::Swap(FollowedPolyline & rhs)
 {
   m_poly.Swap(rhs.m_poly);
   m_segDistance.swap(rhs.m_segDistance);
-  m_segProj.swap(rhs.m_segProj);
+  m_segDistanceMerc.swap(rhs.m_segDistanceMerc);
+  m_segProj.Swap(rhs.m_segProj);
   swap(m_current, rhs.m_current);
 }
 
@@ -84,18 +94,17 @@ void FollowedPolyline::Update()
   --n;
 
   m_segDistance.resize(n);
-  m_segProj.resize(n);
+  m_segDistanceMerc.resize(n);
+  m_segProj.Assign(m_poly.GetPoints());
 
   double dist = 0.0;
+  double distMerc = 0.0;
   for (size_t i = 0; i < n; ++i)
   {
-    m2::PointD const & p1 = m_poly.GetPoint(i);
-    m2::PointD const & p2 = m_poly.GetPoint(i + 1);
-
-    dist += MercatorBounds::DistanceOnEarth(p1, p2);
-
+    dist += MercatorBounds::DistanceOnEarth(m_poly.GetPoint(i), m_poly.GetPoint(i + 1));
     m_segDistance[i] = dist;
-    m_segProj[i].SetBounds(p1, p2);
+    distMerc += m_poly.GetPoint(i).Length(m_poly.GetPoint(i + 1));
+    m_segDistanceMerc[i] = distMerc;
   }
 
   m_current = Iter(m_poly.Front(), 0);
@@ -104,15 +113,31 @@ void FollowedPolyline::Update()
 template <class DistanceFn>
 Iter FollowedPolyline::GetClosestProjection(m2::RectD const & posRect,
                                             DistanceFn const & distFn) const
+{
+  size_t const count = m_poly.GetSize() - 1;
+  size_t const start = m_current.m_ind;
+  size_t const windowEnd = min(start + kForwardSegmentsWindow, count);
+
+  Iter res = GetClosestProjectionInInterval(posRect, distFn, start, windowEnd);
+  if (!res.IsValid() && windowEnd != count)
+    res = GetClosestProjectionInInterval(posRect, distFn, windowEnd, count);
+  return res;
+}
+
+template <class DistanceFn>
+Iter FollowedPolyline::GetClosestProjectionInInterval(m2::RectD const & posRect,
+                                                      DistanceFn const & distFn, size_t start,
+                                                      size_t end) const
 {
   Iter res;
   double minDist = numeric_limits<double>::max();
 
   m2::PointD const currPos = posRect.Center();
-  size_t const count = m_poly.GetSize() - 1;
-  for (size_t i = m_current.m_ind; i < count; ++i)
+  m_segProj.ProjectPoint(currPos, start, end, m_projX, m_projY, m_projDistSq);
+
+  for (size_t i = start; i < end; ++i)
   {
-    m2::PointD const pt = m_segProj[i](currPos);
+    m2::PointD const pt(m_projX[i - start], m_projY[i - start]);
 
     if (!posRect.IsPointInside(pt))
       continue;
@@ -171,10 +196,8 @@ double FollowedPolyline::GetMercatorDistanceFromBegin() const
   double distance = 0.0;
   if (m_current.IsValid())
   {
-    for (size_t i = 1; i <= m_current.m_ind; i++)
-      distance += m_poly.GetPoint(i).Length(m_poly.GetPoint(i - 1));
-
-    distance += m_poly.GetPoint(m_current.m_ind).Length(m_current.m_pt);
+    distance = (m_current.m_ind > 0 ? m_segDistanceMerc[m_current.m_ind - 1] : 0.0) +
+               m_poly.GetPoint(m_current.m_ind).Length(m_current.m_pt);
   }
 
   return distance;
@@ -2,6 +2,7 @@
 
 #include "geometry/mercator.hpp"
 
+#include "geometry/packed_segments.hpp"
 #include "geometry/point2d.hpp"
 #include "geometry/polyline2d.hpp"
 
@@ -74,16 +75,24 @@ private:
   template <class DistanceFn>
   Iter GetClosestProjection(m2::RectD const & posRect, DistanceFn const & distFn) const;
 
+  template <class DistanceFn>
+  Iter GetClosestProjectionInInterval(m2::RectD const & posRect, DistanceFn const & distFn,
+                                      size_t start, size_t end) const;
+
   void Update();
 
   m2::PolylineD m_poly;
 
   /// Iterator with the current position. Position sets with UpdateProjection methods.
   mutable Iter m_current;
-  /// Precalculated info for fast projection finding.
-  vector<m2::ProjectionToSection<m2::PointD>> m_segProj;
+  /// Precalculated packed segments for fast batch projection.
+  m2::PackedSegments m_segProj;
+  /// Scratch buffers of GetClosestProjection, reused to avoid reallocations.
+  mutable vector<double> m_projX, m_projY, m_projDistSq;
   /// Accumulated cache of segments length in meters.
   vector<double> m_segDistance;
+  /// Accumulated cache of segments length in mercator units.
+  vector<double> m_segDistanceMerc;
 };
 
 }  // namespace routing
@@ -97,6 +97,7 @@ void BicycleDirectionsEngine::Generate(RoadGraphBase const & graph, vector<Junct
   times.clear();
   turns.clear();
   routeGeometry.clear();
+  m_attrsCache.clear();
   m_adjacentEdges.clear();
   m_pathSegments.clear();
   trafficSegs.clear();
@@ -163,15 +164,12 @@ void BicycleDirectionsEngine::Generate(RoadGraphBase const & graph, vector<Junct
       if (!outFeatureId.IsValid())
         continue;
 
-      FeatureType ft;
-      if (!GetLoader(outFeatureId.m_mwmId).GetFeatureByIndex(outFeatureId.m_index, ft))
+      RoadAttrs const & attrs = GetRoadAttrs(outFeatureId);
+      if (!attrs.m_isValid)
         continue;
 
-      auto const highwayClass = ftypes::GetHighwayClass(ft);
-      ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Error, ());
-      ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Undefined, ());
       adjacentEdges.m_outgoingTurns.candidates.emplace_back(0.0 /* angle */, uniNodeId,
-                                                            highwayClass);
+                                                            attrs.m_highwayClass);
     }
 
     LoadedPathSegment pathSegment(UniNodeId::Type::Mwm);
@@ -222,6 +220,31 @@ Index::FeaturesLoaderGuard & BicycleDirectionsEngine::GetLoader(MwmSet::MwmId co
   return *m_loader;
 }
 
+BicycleDirectionsEngine::RoadAttrs const & BicycleDirectionsEngine::GetRoadAttrs(
+    FeatureID const & featureId)
+{
+  auto const it = m_attrsCache.find(featureId);
+  if (it != m_attrsCache.cend())
+    return it->second;
+
+  RoadAttrs & attrs = m_attrsCache[featureId];
+
+  FeatureType ft;
+  if (!GetLoader(featureId.m_mwmId).GetFeatureByIndex(featureId.m_index, ft))
+    return attrs;
+
+  attrs.m_highwayClass = ftypes::GetHighwayClass(ft);
+  ASSERT_NOT_EQUAL(attrs.m_highwayClass, ftypes::HighwayClass::Error, ());
+  ASSERT_NOT_EQUAL(attrs.m_highwayClass, ftypes::HighwayClass::Undefined, ());
+
+  attrs.m_isLink = ftypes::IsLinkChecker::Instance()(ft);
+  attrs.m_onRoundabout = ftypes::IsRoundAboutChecker::Instance()(ft);
+  ft.GetName(FeatureType::DEFAULT_LANG, attrs.m_name);
+  attrs.m_isValid = true;
+
+  return attrs;
+}
+
 void BicycleDirectionsEngine::LoadPathGeometry(UniNodeId const & uniNodeId,
                                                vector<Junction> const & path,
                                                LoadedPathSegment & pathSegment)
@@ -234,26 +257,23 @@ void BicycleDirectionsEngine::LoadPathGeometry(UniNodeId const & uniNodeId,
     return;
   }
 
-  FeatureType ft;
-  if (!GetLoader(uniNodeId.GetFeature().m_mwmId)
-           .GetFeatureByIndex(uniNodeId.GetFeature().m_index, ft))
+  // The path geometry comes from |path| (junctions of the route graph
+  // that are already in memory), so only road attributes are taken
+  // from the feature here.
+  RoadAttrs const & attrs = GetRoadAttrs(uniNodeId.GetFeature());
+  if (!attrs.m_isValid)
   {
     // The feature can't be read, therefore path geometry can't be
     // loaded.
     return;
   }
 
-  auto const highwayClass = ftypes::GetHighwayClass(ft);
-  ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Error, ());
-  ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Undefined, ());
-
-  pathSegment.m_highwayClass = highwayClass;
-  pathSegment.m_isLink = ftypes::IsLinkChecker::Instance()(ft);
-
-  ft.GetName(FeatureType::DEFAULT_LANG, pathSegment.m_name);
+  pathSegment.m_highwayClass = attrs.m_highwayClass;
+  pathSegment.m_isLink = attrs.m_isLink;
+  pathSegment.m_name = attrs.m_name;
 
   pathSegment.m_nodeId = uniNodeId;
-  pathSegment.m_onRoundabout = ftypes::IsRoundAboutChecker::Instance()(ft);
+  pathSegment.m_onRoundabout = attrs.m_onRoundabout;
   pathSegment.m_path = path;
   // @TODO(bykoianko) It's better to fill pathSegment.m_weight.
 }
@@ -4,8 +4,11 @@
 #include "routing/loaded_path_segment.hpp"
 #include "routing/turn_candidate.hpp"
 
+#include "indexer/ftypes_matcher.hpp"
+
 #include <map>
 #include <memory>
+#include <string>
 
 class Index;
 
@@ -32,10 +35,27 @@ public:
                 vector<Junction> & routeGeometry, vector<Segment> & trafficSegs) override;
 
 private:
+  // Feature attributes needed for turn generation. The route geometry
+  // itself comes from the road graph which is already in memory, so
+  // these are the only values that still require a feature read; they
+  // are cached because a route visits the same feature once per
+  // passed junction and once per outgoing edge of nearby junctions.
+  struct RoadAttrs
+  {
+    std::string m_name;
+    ftypes::HighwayClass m_highwayClass = ftypes::HighwayClass::Undefined;
+    bool m_isLink = false;
+    bool m_onRoundabout = false;
+    // False when the feature could not be read.
+    bool m_isValid = false;
+  };
+
   Index::FeaturesLoaderGuard & GetLoader(MwmSet::MwmId const & id);
+  RoadAttrs const & GetRoadAttrs(FeatureID const & featureId);
   void LoadPathGeometry(UniNodeId const & uniNodeId, vector<Junction> const & path,
                         LoadedPathSegment & pathSegment);
 
+  std::map<FeatureID, RoadAttrs> m_attrsCache;
   AdjacentEdgesMap m_adjacentEdges;
   TUnpackedPathSegments m_pathSegments;
   Index const & m_index;
@@ -3,6 +3,11 @@
 namespace
 {
 uint32_t constexpr kFakeId = std::numeric_limits<uint32_t>::max();
+
+// Limit on the number of cached edge lists per direction. A search
+// touches a bounded set of transitions of one mwm, so the caches stay
+// small; overflowing them just drops the accumulated lists.
+size_t constexpr kMaxCachedEdgeLists = 64;
 }  // namespace
 
 namespace routing
@@ -70,21 +75,69 @@ void CrossMwmConnector::GetEdgeList(Segment const & segment, bool isOutgoing,
   if (isOutgoing)
   {
     ASSERT_NOT_EQUAL(transition.m_enterIdx, kFakeId, ());
-    for (size_t exitIdx = 0; exitIdx < m_exits.size(); ++exitIdx)
-    {
-      Weight const weight = GetWeight(base::asserted_cast<size_t>(transition.m_enterIdx), exitIdx);
-      AddEdge(m_exits[exitIdx], weight, edges);
-    }
+    std::vector<SegmentEdge> const & cached = GetOutgoingEdges(transition.m_enterIdx);
+    edges.insert(edges.end(), cached.cbegin(), cached.cend());
   }
   else
   {
     ASSERT_NOT_EQUAL(transition.m_exitIdx, kFakeId, ());
-    for (size_t enterIdx = 0; enterIdx < m_enters.size(); ++enterIdx)
+    std::vector<SegmentEdge> const & cached = GetIncomingEdges(transition.m_exitIdx);
+    edges.insert(edges.end(), cached.cbegin(), cached.cend());
+  }
+}
+
+std::vector<SegmentEdge> const & CrossMwmConnector::GetOutgoingEdges(uint32_t enterIdx) const
+{
+  auto const it = m_outgoingEdgesCache.find(enterIdx);
+  if (it != m_outgoingEdgesCache.cend())
+    return it->second;
+
+  if (m_outgoingEdgesCache.size() >= kMaxCachedEdgeLists)
+    m_outgoingEdgesCache.clear();
+
+  std::vector<SegmentEdge> & edges = m_outgoingEdgesCache[enterIdx];
+  // A row of the weight matrix: sequential access.
+  for (size_t exitIdx = 0; exitIdx < m_exits.size(); ++exitIdx)
+    AddEdge(m_exits[exitIdx], GetWeight(base::asserted_cast<size_t>(enterIdx), exitIdx), edges);
+  return edges;
+}
+
+std::vector<SegmentEdge> const & CrossMwmConnector::GetIncomingEdges(uint32_t exitIdx) const
+{
+  auto const it = m_incomingEdgesCache.find(exitIdx);
+  if (it != m_incomingEdgesCache.cend())
+    return it->second;
+
+  if (m_incomingEdgesCache.size() >= kMaxCachedEdgeLists)
+    m_incomingEdgesCache.clear();
+
+  size_t const numEnters = m_enters.size();
+  size_t const numExits = m_exits.size();
+
+  if (m_weightsTransposed.empty() && !m_weights.empty())
+  {
+    m_weightsTransposed.resize(m_weights.size());
+    for (size_t enter = 0; enter < numEnters; ++enter)
     {
-      Weight const weight = GetWeight(enterIdx, base::asserted_cast<size_t>(transition.m_exitIdx));
-      AddEdge(m_enters[enterIdx], weight, edges);
+      for (size_t exit = 0; exit < numExits; ++exit)
+        m_weightsTransposed[exit * numEnters + enter] = m_weights[enter * numExits + exit];
     }
   }
+
+  std::vector<SegmentEdge> & edges = m_incomingEdgesCache[exitIdx];
+  if (m_weightsTransposed.empty())
+  {
+    for (size_t enterIdx = 0; enterIdx < numEnters; ++enterIdx)
+      AddEdge(m_enters[enterIdx], GetWeight(enterIdx, base::asserted_cast<size_t>(exitIdx)), edges);
+  }
+  else
+  {
+    // A row of the transposed matrix: sequential access.
+    Weight const * column = &m_weightsTransposed[static_cast<size_t>(exitIdx) * numEnters];
+    for (size_t enterIdx = 0; enterIdx < numEnters; ++enterIdx)
+      AddEdge(m_enters[enterIdx], column[enterIdx], edges);
+  }
+  return edges;
 }
 
 bool CrossMwmConnector::WeightsWereLoaded() const
@@ -140,6 +140,10 @@ private:
   void AddEdge(Segment const & segment, Weight weight, std::vector<SegmentEdge> & edges) const;
   Transition const & GetTransition(Segment const & segment) const;
   Weight GetWeight(size_t enterIdx, size_t exitIdx) const;
+  // Materialized edge list of a transition, built once per enter/exit
+  // index and reused for the rest of the search.
+  std::vector<SegmentEdge> const & GetOutgoingEdges(uint32_t enterIdx) const;
+  std::vector<SegmentEdge> const & GetIncomingEdges(uint32_t exitIdx) const;
 
   NumMwmId const m_mwmId;
   std::vector<Segment> m_enters;
@@ -148,5 +152,14 @@ private:
   WeightsLoadState m_weightsLoadState = WeightsLoadState::Unknown;
   uint64_t m_weightsOffset = 0;
   std::vector<Weight> m_weights;
+  // Transposed copy of m_weights (indexed by exitIdx * enters + enterIdx),
+  // built lazily on the first incoming query. The backward wave of the
+  // bidirectional search reads columns of m_weights, i.e. with a stride
+  // of m_exits.size(); the transposed copy makes these reads sequential.
+  mutable std::vector<Weight> m_weightsTransposed;
+  // Bounded caches of materialized edge lists keyed by enter/exit index:
+  // one bidirectional search queries the same transitions repeatedly.
+  mutable std::unordered_map<uint32_t, std::vector<SegmentEdge>> m_outgoingEdgesCache;
+  mutable std::unordered_map<uint32_t, std::vector<SegmentEdge>> m_incomingEdgesCache;
 };
 }  // namespace routing
@@ -137,7 +137,16 @@ CrossMwmIndexGraph::CrossMwmIndexGraph(shared_ptr<NumMwmIds> numMwmIds,
   ResetCrossMwmGraph();
 }
 
-CrossMwmIndexGraph::~CrossMwmIndexGraph() {}
+CrossMwmIndexGraph::~CrossMwmIndexGraph()
+{
+  {
+    lock_guard<mutex> lock(m_prefetchMutex);
+    m_prefetchFinished = true;
+  }
+  m_prefetchCondition.notify_one();
+  if (m_prefetchThread.joinable())
+    m_prefetchThread.join();
+}
 
 bool CrossMwmIndexGraph::IsTransition(Segment const & s, bool isOutgoing)
 {
@@ -288,12 +297,61 @@ void CrossMwmIndexGraph::InsertWholeMwmTransitionSegments(NumMwmId numMwmId)
     UNUSED_VALUE(p);
     ASSERT(p.second, ("Mwm num id:", numMwmId, "has been inserted before. Country file name:",
                       mapping->GetCountryName()));
+
+    // The wave has entered the mwm: warm the cross contexts of its neighbors up
+    // so the next border transition does not stall on loading one.
+    PrefetchNeighbors(mapping->m_crossContext.GetNeighboringMwmList());
   };
 
   if (!LoadWith(numMwmId, fillAllTransitionSegments))
     m_transitionCache.emplace(numMwmId, TransitionSegments());
 }
 
+void CrossMwmIndexGraph::PrefetchNeighbors(vector<string> const & neighbors)
+{
+  lock_guard<mutex> lock(m_prefetchMutex);
+
+  bool scheduled = false;
+  for (string const & name : neighbors)
+  {
+    if (!m_prefetchedMwms.insert(name).second)
+      continue;
+    m_prefetchQueue.push_back(name);
+    scheduled = true;
+  }
+
+  if (!scheduled)
+    return;
+
+  if (!m_prefetchThread.joinable())
+    m_prefetchThread = thread(&CrossMwmIndexGraph::PrefetchWorker, this);
+  m_prefetchCondition.notify_one();
+}
+
+void CrossMwmIndexGraph::PrefetchWorker()
+{
+  while (true)
+  {
+    string name;
+    {
+      unique_lock<mutex> lock(m_prefetchMutex);
+      m_prefetchCondition.wait(
+          lock, [this] { return m_prefetchFinished || !m_prefetchQueue.empty(); });
+      if (m_prefetchFinished)
+        return;
+      name = move(m_prefetchQueue.front());
+      m_prefetchQueue.pop_front();
+    }
+
+    TRoutingMappingPtr mapping = m_indexManager.GetMappingByName(name);
+    if (!mapping || !mapping->IsValid())
+      continue;  // mwm was not downloaded.
+
+    lock_guard<mutex> lock(m_loadMutex);
+    mapping->LoadCrossContext();
+  }
+}
+
 void CrossMwmIndexGraph::GetBorderCross(TRoutingMappingPtr const & mapping, Segment const & s,
                                         bool isOutgoing, vector<BorderCross> & borderCrosses)
 {
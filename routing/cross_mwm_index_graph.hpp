@@ -10,8 +10,14 @@
 
 #include "base/math.hpp"
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace routing
@@ -90,6 +96,13 @@ private:
   /// to |m_transitionCache|.
   void InsertWholeMwmTransitionSegments(NumMwmId numMwmId);
 
+  /// \brief Schedules loading cross contexts of |neighbors| on the worker thread.
+  /// Loading a cross context synchronously stalls the A* wave at every mwm border,
+  /// so contexts of neighboring mwms are warmed up in advance as soon as the wave
+  /// enters an mwm and its neighbor list gets known.
+  void PrefetchNeighbors(std::vector<std::string> const & neighbors);
+  void PrefetchWorker();
+
   /// \brief Fills |borderCrosses| of mwm with |mapping| according to |s|.
   /// \param mapping if |isOutgoing| == true |mapping| is mapping ingoing (from) border cross.
   /// If |isOutgoing| == false |mapping| is mapping outgoing (to) border cross.
@@ -113,11 +126,16 @@ private:
     if (!mapping->IsValid())
       return false; // mwm was not loaded.
 
-    auto const it = m_mappingGuards.find(numMwmId);
-    if (it == m_mappingGuards.cend())
     {
-      m_mappingGuards[numMwmId] = make_unique<MappingGuard>(mapping);
-      mapping->LoadCrossContext();
+      // The worker thread may be loading a cross context at the moment,
+      // see PrefetchNeighbors().
+      std::lock_guard<std::mutex> lock(m_loadMutex);
+      auto const it = m_mappingGuards.find(numMwmId);
+      if (it == m_mappingGuards.cend())
+      {
+        m_mappingGuards[numMwmId] = make_unique<MappingGuard>(mapping);
+        mapping->LoadCrossContext();
+      }
     }
 
     fn(mapping);
@@ -134,5 +152,18 @@ private:
   std::map<NumMwmId, TransitionSegments> m_transitionCache;
 
   std::map<NumMwmId, std::unique_ptr<MappingGuard>> m_mappingGuards;
+
+  /// Guards LoadCrossContext() calls: the prefetcher loads contexts of
+  /// neighboring mwms while the search thread may load one itself.
+  std::mutex m_loadMutex;
+
+  /// Prefetcher state guarded by |m_prefetchMutex|. The worker thread is
+  /// started lazily on the first prefetch request and lives as long as *this.
+  std::mutex m_prefetchMutex;
+  std::condition_variable m_prefetchCondition;
+  std::deque<std::string> m_prefetchQueue;
+  std::set<std::string> m_prefetchedMwms;
+  std::thread m_prefetchThread;
+  bool m_prefetchFinished = false;
 };
 }  // routing
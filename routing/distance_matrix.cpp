@@ -0,0 +1,85 @@
+#include "routing/distance_matrix.hpp"
+
+#include "routing/base/astar_algorithm.hpp"
+
+#include "std/map.hpp"
+#include "std/set.hpp"
+
+namespace
+{
+using namespace routing;
+
+// Adapts WorldGraph to the AStarAlgorithm interface for plain dijkstra waves.
+class WorldGraphWrapper final
+{
+public:
+  // AStarAlgorithm types aliases:
+  using TVertexType = Segment;
+  using TEdgeType = SegmentEdge;
+
+  explicit WorldGraphWrapper(WorldGraph & graph) : m_graph(graph) {}
+
+  void GetOutgoingEdgesList(TVertexType const & vertex, vector<TEdgeType> & edges)
+  {
+    edges.clear();
+    m_graph.GetEdgeList(vertex, true /* isOutgoing */, false /* isLeap */, edges);
+  }
+
+  void GetIngoingEdgesList(TVertexType const & vertex, vector<TEdgeType> & edges)
+  {
+    edges.clear();
+    m_graph.GetEdgeList(vertex, false /* isOutgoing */, false /* isLeap */, edges);
+  }
+
+  double HeuristicCostEstimate(TVertexType const & /* from */, TVertexType const & /* to */)
+  {
+    return 0.0;
+  }
+
+private:
+  WorldGraph & m_graph;
+};
+}  // namespace
+
+namespace routing
+{
+bool CalculateDistanceMatrix(WorldGraph & graph, vector<Segment> const & origins,
+                             vector<Segment> const & destinations,
+                             my::Cancellable const & cancellable,
+                             vector<vector<double>> & matrix)
+{
+  matrix.assign(origins.size(), vector<double>(destinations.size(), kUnreachableWeight));
+
+  WorldGraphWrapper wrapper(graph);
+  AStarAlgorithm<WorldGraphWrapper> astar;
+
+  for (size_t i = 0; i < origins.size(); ++i)
+  {
+    if (cancellable.IsCancelled())
+      return false;
+
+    set<Segment> remaining(destinations.cbegin(), destinations.cend());
+
+    map<Segment, double> distances;
+    astar.PropagateWave(
+        wrapper, origins[i],
+        [&](Segment const & vertex) {
+          // The wave stops as soon as all destinations are settled.
+          remaining.erase(vertex);
+          return remaining.empty() || cancellable.IsCancelled();
+        },
+        [](Segment const & /* vertex */, SegmentEdge const & edge) { return edge.GetWeight(); },
+        [](Segment const & /* from */, Segment const & /* to */) {} /* putToParents */,
+        distances);
+
+    for (size_t j = 0; j < destinations.size(); ++j)
+    {
+      auto const it = distances.find(destinations[j]);
+      if (it != distances.end())
+        matrix[i][j] = it->second;
+    }
+  }
+
+  return !cancellable.IsCancelled();
+}
+}  // namespace routing
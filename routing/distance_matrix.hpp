@@ -0,0 +1,28 @@
+#pragma once
+
+#include "routing/segment.hpp"
+#include "routing/world_graph.hpp"
+
+#include "base/cancellable.hpp"
+
+#include "std/vector.hpp"
+
+namespace routing
+{
+// Weight of an unreachable origin-destination pair.
+double constexpr kUnreachableWeight = -1.0;
+
+// Computes the |origins| x |destinations| weight matrix over |graph|
+// running one multi-target forward search per origin. Weights are route
+// times in seconds, no route geometry is reconstructed. The loaded index
+// graphs and the estimator are shared across all pairs, so the cost is
+// O(origins) searches instead of O(origins x destinations).
+//
+// Origins and destinations are segments the dispatch points are attached to,
+// see IndexRouter::FindClosestEdge for the attachment.
+// Returns false if the calculation was cancelled.
+bool CalculateDistanceMatrix(WorldGraph & graph, vector<Segment> const & origins,
+                             vector<Segment> const & destinations,
+                             my::Cancellable const & cancellable,
+                             vector<vector<double>> & matrix);
+}  // namespace routing
@@ -42,6 +42,7 @@ public:
 
   // EdgeEstimator overrides:
   double CalcSegmentWeight(Segment const & segment, RoadGeometry const & road) const override;
+  double GetTrafficFactor(Segment const & segment) const override;
   double CalcHeuristic(m2::PointD const & from, m2::PointD const & to) const override;
   double GetUTurnPenalty() const override;
   bool LeapIsAllowed(NumMwmId mwmId) const override;
@@ -69,27 +70,30 @@ double CarEdgeEstimator::CalcSegmentWeight(Segment const & segment, RoadGeometry
   double constexpr kTimePenalty = 1.8;
 
   double const speedMPS = road.GetSpeed() * kKMPH2MPS;
-  double result = TimeBetweenSec(road.GetPoint(segment.GetPointId(false /* front */)),
-                                 road.GetPoint(segment.GetPointId(true /* front */)), speedMPS) *
-                  kTimePenalty;
-
-  if (m_trafficStash)
-  {
-    auto const * trafficColoring = m_trafficStash->Get(segment.GetMwmId());
-    if (trafficColoring)
-    {
-      auto const dir = segment.IsForward() ? TrafficInfo::RoadSegmentId::kForwardDirection
-                                           : TrafficInfo::RoadSegmentId::kReverseDirection;
-      auto const it = trafficColoring->find(
-          TrafficInfo::RoadSegmentId(segment.GetFeatureId(), segment.GetSegmentIdx(), dir));
-      SpeedGroup const speedGroup =
-          (it == trafficColoring->cend()) ? SpeedGroup::Unknown : it->second;
-      ASSERT_LESS(speedGroup, SpeedGroup::Count, ());
-      result *= CalcTrafficFactor(speedGroup);
-    }
-  }
-
-  return result;
+  double const result = TimeBetweenSec(road.GetPoint(segment.GetPointId(false /* front */)),
+                                       road.GetPoint(segment.GetPointId(true /* front */)),
+                                       speedMPS) *
+                        kTimePenalty;
+
+  return result * GetTrafficFactor(segment);
+}
+
+double CarEdgeEstimator::GetTrafficFactor(Segment const & segment) const
+{
+  if (!m_trafficStash)
+    return 1.0;
+
+  auto const * trafficColoring = m_trafficStash->Get(segment.GetMwmId());
+  if (!trafficColoring)
+    return 1.0;
+
+  auto const dir = segment.IsForward() ? TrafficInfo::RoadSegmentId::kForwardDirection
+                                       : TrafficInfo::RoadSegmentId::kReverseDirection;
+  auto const it = trafficColoring->find(
+      TrafficInfo::RoadSegmentId(segment.GetFeatureId(), segment.GetSegmentIdx(), dir));
+  SpeedGroup const speedGroup = (it == trafficColoring->cend()) ? SpeedGroup::Unknown : it->second;
+  ASSERT_LESS(speedGroup, SpeedGroup::Count, ());
+  return CalcTrafficFactor(speedGroup);
 }
 
 double CarEdgeEstimator::CalcHeuristic(m2::PointD const & from, m2::PointD const & to) const
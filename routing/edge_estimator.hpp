@@ -24,6 +24,9 @@ public:
   virtual ~EdgeEstimator() = default;
 
   virtual double CalcSegmentWeight(Segment const & segment, RoadGeometry const & road) const = 0;
+  // Returns the live traffic factor a baked segment weight should be multiplied by.
+  // It is the same factor CalcSegmentWeight applies to the freshly estimated weight.
+  virtual double GetTrafficFactor(Segment const & /* segment */) const { return 1.0; }
   virtual double CalcHeuristic(m2::PointD const & from, m2::PointD const & to) const = 0;
   virtual double GetUTurnPenalty() const = 0;
   // The leap is the shortcut edge from mwm border enter to exit.
@@ -14,17 +14,25 @@
 #include "base/logging.hpp"
 #include "base/macros.hpp"
 
+#include "std/algorithm.hpp"
+#include "std/set.hpp"
+#include "std/typeinfo.hpp"
+
 namespace routing
 {
 
 namespace
 {
-uint32_t constexpr kPowOfTwoForFeatureCacheSize = 10; // cache contains 2 ^ kPowOfTwoForFeatureCacheSize elements
-
 double constexpr kMwmRoadCrossingRadiusMeters = 2.0;
 
 double constexpr kMwmCrossingNodeEqualityRadiusMeters = 100.0;
 
+// Radius of the first ring of the expanding-ring search in
+// FindClosestEdges. It doubles until kMwmCrossingNodeEqualityRadiusMeters
+// is reached, so almost all snap points are served by the first, small
+// rect instead of a full scan of the maximum one.
+double constexpr kMinSnapRadiusMeters = 12.5;
+
 string GetFeatureCountryName(FeatureID const featureId)
 {
   /// @todo Rework this function when storage will provide information about mwm's country
@@ -96,21 +104,83 @@ void FeaturesRoadGraph::CrossCountryVehicleModel::Clear()
 }
 
 
-IRoadGraph::RoadInfo & FeaturesRoadGraph::RoadInfoCache::Find(FeatureID const & featureId, bool & found)
+// static
+FeaturesRoadGraph::RoadInfoCache & FeaturesRoadGraph::RoadInfoCache::ForVehicleModel(
+    IVehicleModel const & model)
+{
+  // The registry is never destroyed: shared caches must outlive every
+  // router instance, and routers may be torn down at shutdown in an
+  // arbitrary order.
+  static mutex instancesMutex;
+  static map<string, unique_ptr<RoadInfoCache>> * instances =
+      new map<string, unique_ptr<RoadInfoCache>>();
+
+  lock_guard<mutex> lock(instancesMutex);
+  unique_ptr<RoadInfoCache> & instance = (*instances)[typeid(model).name()];
+  if (!instance)
+    instance.reset(new RoadInfoCache());
+  return *instance;
+}
+
+FeaturesRoadGraph::RoadInfoCache::TMwmFeatureCache & FeaturesRoadGraph::RoadInfoCache::GetMwmCache(
+    MwmSet::MwmId const & mwmId)
+{
+  lock_guard<mutex> lock(m_mutex);
+
+  unique_ptr<TMwmFeatureCache> & entry = m_cache[mwmId];
+  if (!entry)
+  {
+    // Keep the number of per-mwm sub-caches within the budget. Dead mwms
+    // go first; if that's not enough, arbitrary live ones are dropped.
+    // Erasing other keys does not invalidate the |entry| map node.
+    if (m_cache.size() > kMaxCachedMwms)
+    {
+      for (auto it = m_cache.begin(); it != m_cache.end() && m_cache.size() > kMaxCachedMwms;)
+      {
+        if (it->first != mwmId && !it->first.IsAlive())
+          it = m_cache.erase(it);
+        else
+          ++it;
+      }
+      for (auto it = m_cache.begin(); it != m_cache.end() && m_cache.size() > kMaxCachedMwms;)
+      {
+        if (it->first != mwmId)
+          it = m_cache.erase(it);
+        else
+          ++it;
+      }
+    }
+
+    entry.reset(new TMwmFeatureCache());
+    entry->Init(kPowOfTwoForFeatureCacheSize);
+  }
+  return *entry;
+}
+
+void FeaturesRoadGraph::RoadInfoCache::EvictDeadMwms()
 {
-  auto res = m_cache.insert(make_pair(featureId.m_mwmId, TMwmFeatureCache()));
-  if (res.second)
-    res.first->second.Init(kPowOfTwoForFeatureCacheSize);
-  return res.first->second.Find(featureId.m_index, found);
+  lock_guard<mutex> lock(m_mutex);
+  for (auto it = m_cache.begin(); it != m_cache.end();)
+  {
+    if (it->first.IsAlive())
+      ++it;
+    else
+      it = m_cache.erase(it);
+  }
 }
 
 void FeaturesRoadGraph::RoadInfoCache::Clear()
 {
+  lock_guard<mutex> lock(m_mutex);
   m_cache.clear();
 }
+
 FeaturesRoadGraph::FeaturesRoadGraph(Index const & index, IRoadGraph::Mode mode,
                                      shared_ptr<VehicleModelFactory> vehicleModelFactory)
-  : m_index(index), m_mode(mode), m_vehicleModel(vehicleModelFactory)
+  : m_index(index)
+  , m_mode(mode)
+  , m_cache(RoadInfoCache::ForVehicleModel(*vehicleModelFactory->GetVehicleModel()))
+  , m_vehicleModel(vehicleModelFactory)
 {
 }
 
@@ -176,7 +246,8 @@ void FeaturesRoadGraph::FindClosestEdges(m2::PointD const & point, uint32_t coun
 {
   NearestEdgeFinder finder(point);
 
-  auto const f = [&finder, this](FeatureType & ft)
+  set<FeatureID> visited;
+  auto const f = [&finder, &visited, this](FeatureType & ft)
   {
     if (!m_vehicleModel.IsRoad(ft))
       return;
@@ -187,14 +258,35 @@ void FeaturesRoadGraph::FindClosestEdges(m2::PointD const & point, uint32_t coun
 
     FeatureID const featureId = ft.GetID();
 
+    // Larger rings rescan the features of the smaller ones.
+    if (!visited.insert(featureId).second)
+      return;
+
     IRoadGraph::RoadInfo const & roadInfo = GetCachedRoadInfo(featureId, ft, speedKMPH);
 
     finder.AddInformationSource(featureId, roadInfo);
   };
 
-  m_index.ForEachInRect(
-      f, MercatorBounds::RectByCenterXYAndSizeInMeters(point, kMwmCrossingNodeEqualityRadiusMeters),
-      GetStreetReadScale());
+  // Expanding-ring search. A candidate projected within the current
+  // ring radius cannot be beaten by any feature outside the scanned
+  // rect, so as soon as |count| such candidates are found the result
+  // equals that of the full kMwmCrossingNodeEqualityRadiusMeters scan.
+  for (double radiusM = kMinSnapRadiusMeters;; radiusM *= 2.0)
+  {
+    bool const lastRing = radiusM >= kMwmCrossingNodeEqualityRadiusMeters;
+    if (lastRing)
+      radiusM = kMwmCrossingNodeEqualityRadiusMeters;
+
+    m2::RectD const rect = MercatorBounds::RectByCenterXYAndSizeInMeters(point, radiusM);
+    m_index.ForEachInRect(f, rect, GetStreetReadScale());
+
+    if (lastRing)
+      break;
+
+    double const radiusMercator = min(rect.SizeX(), rect.SizeY()) / 2.0;
+    if (finder.HasCandidates(count, radiusMercator * radiusMercator))
+      break;
+  }
 
   finder.MakeResult(vicinities, count);
 }
@@ -243,7 +335,10 @@ IRoadGraph::Mode FeaturesRoadGraph::GetMode() const
 
 void FeaturesRoadGraph::ClearState()
 {
-  m_cache.Clear();
+  // |m_cache| is shared with other road graph instances of the same
+  // vehicle model and survives rerouting; only entries of unregistered
+  // mwms are dropped here.
+  m_cache.EvictDeadMwms();
   m_vehicleModel.Clear();
   m_mwmLocks.clear();
 }
@@ -293,41 +388,33 @@ void FeaturesRoadGraph::ExtractRoadInfo(FeatureID const & featureId, FeatureType
     ri.m_junctions[i] = Junction(ft.GetPoint(i), altitudes[i]);
 }
 
-IRoadGraph::RoadInfo const & FeaturesRoadGraph::GetCachedRoadInfo(FeatureID const & featureId) const
+IRoadGraph::RoadInfo FeaturesRoadGraph::GetCachedRoadInfo(FeatureID const & featureId) const
 {
-  bool found = false;
-  RoadInfo & ri = m_cache.Find(featureId, found);
-
-  if (found)
-    return ri;
-
-  FeatureType ft;
+  return m_cache.Get(featureId, [&] (RoadInfo & ri)
+  {
+    FeatureType ft;
 
-  Index::FeaturesLoaderGuard loader(m_index, featureId.m_mwmId);
+    Index::FeaturesLoaderGuard loader(m_index, featureId.m_mwmId);
 
-  if (!loader.GetFeatureByIndex(featureId.m_index, ft))
-    return ri;
+    if (!loader.GetFeatureByIndex(featureId.m_index, ft))
+      return;
 
-  ASSERT_EQUAL(ft.GetFeatureType(), feature::GEOM_LINE, ());
+    ASSERT_EQUAL(ft.GetFeatureType(), feature::GEOM_LINE, ());
 
-  ExtractRoadInfo(featureId, ft, GetSpeedKMPHFromFt(ft), ri);
-  return ri;
+    ExtractRoadInfo(featureId, ft, GetSpeedKMPHFromFt(ft), ri);
+  });
 }
 
-IRoadGraph::RoadInfo const & FeaturesRoadGraph::GetCachedRoadInfo(FeatureID const & featureId,
-                                                                  FeatureType const & ft,
-                                                                  double speedKMPH) const
+IRoadGraph::RoadInfo FeaturesRoadGraph::GetCachedRoadInfo(FeatureID const & featureId,
+                                                          FeatureType const & ft,
+                                                          double speedKMPH) const
 {
-  bool found = false;
-  RoadInfo & ri = m_cache.Find(featureId, found);
-
-  if (found)
-    return ri;
-
-  // ft must be set
-  ASSERT_EQUAL(featureId, ft.GetID(), ());
-  ExtractRoadInfo(featureId, ft, speedKMPH, ri);
-  return ri;
+  return m_cache.Get(featureId, [&] (RoadInfo & ri)
+  {
+    // ft must be set
+    ASSERT_EQUAL(featureId, ft.GetID(), ());
+    ExtractRoadInfo(featureId, ft, speedKMPH, ri);
+  });
 }
 
 FeaturesRoadGraph::Value const & FeaturesRoadGraph::LockMwm(MwmSet::MwmId const & mwmId) const
@@ -13,7 +13,9 @@
 #include "base/cache.hpp"
 
 #include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/unique_ptr.hpp"
+#include "std/utility.hpp"
 #include "std/vector.hpp"
 
 class Index;
@@ -47,16 +49,53 @@ private:
     mutable map<MwmSet::MwmId, shared_ptr<IVehicleModel>> m_cache;
   };
 
+  // Thread-safe cache of road infos: per-feature lookups go through a striped
+  // lock cache, so router worker threads do not serialize on a single mutex.
+  //
+  // The cache outlives the road graph: instances are shared process-wide,
+  // one per vehicle model type (RoadInfo speeds depend on the model, so
+  // pedestrian and bicycle routers must not see each other's entries).
+  // Entries are keyed by MwmId, and a re-registered (updated) mwm gets a
+  // fresh MwmId, so stale road infos can never be returned.
   class RoadInfoCache
   {
   public:
-    RoadInfo & Find(FeatureID const & featureId, bool & found);
+    // Returns the shared cache for the dynamic type of |model|.
+    // The returned reference stays valid for the lifetime of the process.
+    static RoadInfoCache & ForVehicleModel(IVehicleModel const & model);
+
+    // Returns a copy of the cached road info for @featureId. On a cache miss
+    // fills the cache slot with fillRoadInfo(ri) first.
+    template <typename TFillRoadInfo>
+    RoadInfo Get(FeatureID const & featureId, TFillRoadInfo && fillRoadInfo)
+    {
+      RoadInfo ri;
+      GetMwmCache(featureId.m_mwmId)
+          .Get(featureId.m_index, forward<TFillRoadInfo>(fillRoadInfo), ri);
+      return ri;
+    }
+
+    // Drops sub-caches of mwms which are not registered in the index
+    // anymore. Called instead of Clear() between routes, so road infos of
+    // live mwms survive rerouting.
+    void EvictDeadMwms();
 
     void Clear();
 
   private:
-    using TMwmFeatureCache = my::Cache<uint32_t, RoadInfo>;
-    map<MwmSet::MwmId, TMwmFeatureCache> m_cache;
+    // Cache contains 2 ^ kPowOfTwoForFeatureCacheSize elements.
+    static uint32_t constexpr kPowOfTwoForFeatureCacheSize = 10;
+
+    // Memory budget: at most this many per-mwm sub-caches are kept;
+    // each sub-cache is a fixed-size striped cache (see above).
+    static size_t constexpr kMaxCachedMwms = 32;
+
+    using TMwmFeatureCache = my::StripedCache<uint32_t, RoadInfo>;
+
+    TMwmFeatureCache & GetMwmCache(MwmSet::MwmId const & mwmId);
+
+    mutex m_mutex;
+    map<MwmSet::MwmId, unique_ptr<TMwmFeatureCache>> m_cache;
   };
 
 public:
@@ -99,11 +138,11 @@ private:
 
   // Searches a feature RoadInfo in the cache, and if does not find then
   // loads feature from the index and takes speed for the feature from the vehicle model.
-  RoadInfo const & GetCachedRoadInfo(FeatureID const & featureId) const;
+  RoadInfo GetCachedRoadInfo(FeatureID const & featureId) const;
   // Searches a feature RoadInfo in the cache, and if does not find then takes passed feature and speed.
   // This version is used to prevent redundant feature loading when feature speed is known.
-  RoadInfo const & GetCachedRoadInfo(FeatureID const & featureId, FeatureType const & ft,
-                                     double speedKMPH) const;
+  RoadInfo GetCachedRoadInfo(FeatureID const & featureId, FeatureType const & ft,
+                             double speedKMPH) const;
   void ExtractRoadInfo(FeatureID const & featureId, FeatureType const & ft, double speedKMPH,
                        RoadInfo & ri) const;
 
@@ -111,7 +150,7 @@ private:
 
   Index const & m_index;
   IRoadGraph::Mode const m_mode;
-  mutable RoadInfoCache m_cache;
+  RoadInfoCache & m_cache;
   mutable CrossCountryVehicleModel m_vehicleModel;
   mutable map<MwmSet::MwmId, Value> m_mwmLocks;
 };
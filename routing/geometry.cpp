@@ -6,6 +6,7 @@
 
 #include "base/assert.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/string.hpp"
 
 using namespace routing;
@@ -80,6 +81,23 @@ void FileGeometryLoader::Load(uint32_t featureId, RoadGeometry & road) const
 
 namespace routing
 {
+// GeometryArena -----------------------------------------------------------------------------------
+size_t constexpr GeometryArena::kBlockSize;
+
+m2::PointD const * GeometryArena::Add(m2::PointD const * points, size_t count)
+{
+  if (m_blocks.empty() || m_blocks.back().size() + count > m_blocks.back().capacity())
+  {
+    m_blocks.emplace_back();
+    m_blocks.back().reserve(std::max(kBlockSize, count));
+  }
+
+  auto & block = m_blocks.back();
+  m2::PointD const * begin = block.data() + block.size();
+  block.insert(block.end(), points, points + count);
+  return begin;
+}
+
 // RoadGeometry ------------------------------------------------------------------------------------
 RoadGeometry::RoadGeometry(bool oneWay, double speed, Points const & points)
   : m_points(points), m_speed(speed), m_isOneWay(oneWay), m_valid(true)
@@ -98,6 +116,9 @@ void RoadGeometry::Load(IVehicleModel const & vehicleModel, FeatureType const &
   for (size_t i = 0; i < feature.GetPointsCount(); ++i)
     m_points.emplace_back(feature.GetPoint(i));
 
+  m_pointsRef = nullptr;
+  m_pointsCount = 0;
+
   if (m_valid && m_speed <= 0.0)
   {
     auto const & id = feature.GetID();
@@ -110,6 +131,13 @@ void RoadGeometry::Load(IVehicleModel const & vehicleModel, FeatureType const &
   }
 }
 
+void RoadGeometry::MovePointsToArena(GeometryArena & arena)
+{
+  m_pointsCount = static_cast<uint32_t>(m_points.size());
+  m_pointsRef = arena.Add(m_points.data(), m_points.size());
+  m_points.clear();
+}
+
 // Geometry ----------------------------------------------------------------------------------------
 Geometry::Geometry(unique_ptr<GeometryLoader> loader) : m_loader(move(loader))
 {
@@ -118,12 +146,33 @@ Geometry::Geometry(unique_ptr<GeometryLoader> loader) : m_loader(move(loader))
 
 RoadGeometry const & Geometry::GetRoad(uint32_t featureId)
 {
+  // References into |m_roads| stay valid on inserts, so they may be
+  // returned to concurrent callers.
+  std::lock_guard<std::mutex> lock(m_mutex);
+
   auto const & it = m_roads.find(featureId);
   if (it != m_roads.cend())
     return it->second;
 
+  return LoadRoad(featureId);
+}
+
+void Geometry::PrefetchRoads(buffer_vector<uint32_t, 8> const & featureIds)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (uint32_t const featureId : featureIds)
+  {
+    if (m_roads.find(featureId) == m_roads.cend())
+      LoadRoad(featureId);
+  }
+}
+
+RoadGeometry & Geometry::LoadRoad(uint32_t featureId)
+{
   RoadGeometry & road = m_roads[featureId];
   m_loader->Load(featureId, road);
+  road.MovePointsToArena(m_arena);
   return road;
 }
 
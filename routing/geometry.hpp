@@ -12,11 +12,31 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace routing
 {
+// Contiguous backing store for points of loaded roads. Roads loaded together
+// land next to each other, so walking a road during edge weight evaluation
+// scans one array instead of chasing per-RoadGeometry heap allocations.
+class GeometryArena final
+{
+public:
+  // Copies |count| points into the arena and returns their stable address.
+  m2::PointD const * Add(m2::PointD const * points, size_t count);
+
+private:
+  // Points per block. A longer road gets a dedicated block.
+  static size_t constexpr kBlockSize = 16 * 1024;
+
+  // Block capacity is reserved up front and blocks are never reallocated,
+  // so the returned addresses stay valid.
+  std::vector<std::vector<m2::PointD>> m_blocks;
+};
+
 class RoadGeometry final
 {
 public:
@@ -27,16 +47,22 @@ public:
 
   void Load(IVehicleModel const & vehicleModel, FeatureType const & feature);
 
+  // Moves the points into |arena| leaving the road as a view into it.
+  void MovePointsToArena(GeometryArena & arena);
+
   bool IsOneWay() const { return m_isOneWay; }
   // Kilometers per hour.
   double GetSpeed() const { return m_speed; }
   m2::PointD const & GetPoint(uint32_t pointId) const
   {
-    ASSERT_LESS(pointId, m_points.size(), ());
-    return m_points[pointId];
+    ASSERT_LESS(pointId, GetPointsCount(), ());
+    return m_pointsRef ? m_pointsRef[pointId] : m_points[pointId];
   }
 
-  uint32_t GetPointsCount() const { return static_cast<uint32_t>(m_points.size()); }
+  uint32_t GetPointsCount() const
+  {
+    return m_pointsRef ? m_pointsCount : static_cast<uint32_t>(m_points.size());
+  }
 
   // Note. It's possible that car_model was changed after the map was built.
   // For example, the map from 12.2016 contained highway=pedestrian
@@ -46,12 +72,15 @@ public:
 
   bool IsEndPointId(uint32_t pointId) const
   {
-    ASSERT_LESS(pointId, m_points.size(), ());
+    ASSERT_LESS(pointId, GetPointsCount(), ());
     return pointId == 0 || pointId + 1 == GetPointsCount();
   }
 
 private:
   Points m_points;
+  // Set instead of |m_points| when the points live in a GeometryArena.
+  m2::PointD const * m_pointsRef = nullptr;
+  uint32_t m_pointsCount = 0;
   double m_speed = 0.0;
   bool m_isOneWay = false;
   bool m_valid = false;
@@ -80,16 +109,30 @@ public:
   Geometry() = default;
   explicit Geometry(std::unique_ptr<GeometryLoader> loader);
 
+  // The method is thread-safe: the parallel bidirectional waves of
+  // AStarAlgorithm share one Geometry instance.
   RoadGeometry const & GetRoad(uint32_t featureId);
 
+  // Batch-loads the roads which are not in the storage yet. Grouping the
+  // loads of all roads around a joint takes the lock once and lays their
+  // points out next to each other in the arena.
+  void PrefetchRoads(buffer_vector<uint32_t, 8> const & featureIds);
+
   m2::PointD const & GetPoint(RoadPoint const & rp)
   {
     return GetRoad(rp.GetFeatureId()).GetPoint(rp.GetPointId());
   }
 
 private:
+  // Loads the road and moves its points to |m_arena|.
+  // |m_mutex| should be taken before.
+  RoadGeometry & LoadRoad(uint32_t featureId);
+
+  // Guards |m_roads| and |m_arena| which are filled lazily on GetRoad calls.
+  std::mutex m_mutex;
   // Feature id to RoadGeometry map.
   std::unordered_map<uint32_t, RoadGeometry> m_roads;
+  GeometryArena m_arena;
   std::unique_ptr<GeometryLoader> m_loader;
 };
 }  // namespace routing
@@ -21,17 +21,14 @@ bool IsUTurn(Segment const & u, Segment const & v)
          u.IsForward() != v.IsForward();
 }
 
-bool IsRestricted(RestrictionVec const & restrictions, Segment const & u, Segment const & v,
+bool IsRestricted(RestrictionIndex const & restrictions, Segment const & u, Segment const & v,
                   bool isOutgoing)
 {
   uint32_t const featureIdFrom = isOutgoing ? u.GetFeatureId() : v.GetFeatureId();
   uint32_t const featureIdTo = isOutgoing ? v.GetFeatureId() : u.GetFeatureId();
 
-  if (!binary_search(restrictions.cbegin(), restrictions.cend(),
-                     Restriction(Restriction::Type::No, {featureIdFrom, featureIdTo})))
-  {
+  if (!restrictions.IsRestricted(featureIdFrom, featureIdTo))
     return false;
-  }
 
   if (featureIdFrom != featureIdTo)
     return true;
@@ -70,6 +67,13 @@ void IndexGraph::GetEdgeList(Segment const & segment, bool isOutgoing, vector<Se
 
   if (jointId != Joint::kInvalidId)
   {
+    // Warm the geometry of all roads meeting the joint in one batch:
+    // the neighboring edges loop below touches each of them.
+    buffer_vector<uint32_t, 8> features;
+    m_jointIndex.ForEachPoint(jointId,
+                              [&](RoadPoint const & rp) { features.push_back(rp.GetFeatureId()); });
+    m_geometry.PrefetchRoads(features);
+
     m_jointIndex.ForEachPoint(jointId, [&](RoadPoint const & rp) {
       GetNeighboringEdges(segment, rp, isOutgoing, edges);
     });
@@ -91,12 +95,20 @@ void IndexGraph::Import(vector<Joint> const & joints)
 
 void IndexGraph::SetRestrictions(RestrictionVec && restrictions)
 {
-  ASSERT(is_sorted(restrictions.cbegin(), restrictions.cend()), ());
-  m_restrictions = move(restrictions);
+  m_restrictions.Build(restrictions);
 }
 
 double IndexGraph::CalcSegmentWeight(Segment const & segment)
 {
+  if (m_segmentWeights)
+  {
+    // The baked weight keeps the distance math out of the hot loop,
+    // live traffic is applied as a multiplier only.
+    double weight;
+    if (m_segmentWeights->Get(segment.GetFeatureId(), segment.GetSegmentIdx(), weight))
+      return weight * m_estimator->GetTrafficFactor(segment);
+  }
+
   return m_estimator->CalcSegmentWeight(segment, m_geometry.GetRoad(segment.GetFeatureId()));
 }
 
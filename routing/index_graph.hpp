@@ -3,11 +3,14 @@
 #include "routing/edge_estimator.hpp"
 #include "routing/geometry.hpp"
 #include "routing/joint.hpp"
+#include "routing/joint_hierarchy.hpp"
 #include "routing/joint_index.hpp"
+#include "routing/restriction_index.hpp"
 #include "routing/restrictions_serialization.hpp"
 #include "routing/road_index.hpp"
 #include "routing/road_point.hpp"
 #include "routing/segment.hpp"
+#include "routing/segment_weights.hpp"
 
 #include "geometry/point2d.hpp"
 
@@ -31,6 +34,12 @@ public:
   Joint::Id GetJointId(RoadPoint const & rp) const { return m_roadIndex.GetJointId(rp); }
 
   Geometry & GetGeometry() { return m_geometry; }
+  EdgeEstimator const & GetEstimator() const
+  {
+    ASSERT(m_estimator, ());
+    return *m_estimator;
+  }
+
   bool IsRoad(uint32_t featureId) const { return m_roadIndex.IsRoad(featureId); }
   RoadJointIds const & GetRoad(uint32_t featureId) const { return m_roadIndex.GetRoad(featureId); }
 
@@ -43,6 +52,19 @@ public:
 
   void SetRestrictions(RestrictionVec && restrictions);
 
+  void SetJointHierarchy(unique_ptr<JointHierarchy> hierarchy)
+  {
+    m_jointHierarchy = move(hierarchy);
+  }
+
+  // Returns nullptr if the mwm has no joint hierarchy section.
+  JointHierarchy const * GetJointHierarchy() const { return m_jointHierarchy.get(); }
+
+  void SetSegmentWeights(unique_ptr<SegmentWeights> weights)
+  {
+    m_segmentWeights = move(weights);
+  }
+
   void PushFromSerializer(Joint::Id jointId, RoadPoint const & rp)
   {
     m_roadIndex.PushFromSerializer(jointId, rp);
@@ -72,6 +94,9 @@ private:
   shared_ptr<EdgeEstimator> m_estimator;
   RoadIndex m_roadIndex;
   JointIndex m_jointIndex;
-  RestrictionVec m_restrictions;
+  RestrictionIndex m_restrictions;
+  unique_ptr<JointHierarchy> m_jointHierarchy;
+  // Baked segment weights or nullptr if the mwm has no segment weights section.
+  unique_ptr<SegmentWeights> m_segmentWeights;
 };
 }  // namespace routing
@@ -0,0 +1,110 @@
+#include "routing/index_graph_cache.hpp"
+
+#include "routing/index_graph.hpp"
+
+#include "base/assert.hpp"
+#include "base/logging.hpp"
+
+namespace routing
+{
+size_t constexpr IndexGraphCache::kDefaultBudgetBytes;
+
+// static
+IndexGraphCache & IndexGraphCache::Instance()
+{
+  static IndexGraphCache instance;
+  return instance;
+}
+
+void IndexGraphCache::SetBudget(size_t bytes)
+{
+  lock_guard<mutex> lock(m_mutex);
+  m_budget = bytes;
+  EvictToBudget();
+}
+
+shared_ptr<IndexGraph> IndexGraphCache::Get(NumMwmId numMwmId, int64_t version)
+{
+  lock_guard<mutex> lock(m_mutex);
+
+  auto const it = m_entries.find(numMwmId);
+  if (it == m_entries.end())
+  {
+    ++m_stats.m_misses;
+    return nullptr;
+  }
+
+  if (it->second.m_version != version)
+  {
+    // The mwm was updated: the cached graph is stale.
+    Erase(numMwmId);
+    ++m_stats.m_misses;
+    return nullptr;
+  }
+
+  m_lru.erase(it->second.m_lruIt);
+  m_lru.push_front(numMwmId);
+  it->second.m_lruIt = m_lru.begin();
+
+  ++m_stats.m_hits;
+  return it->second.m_graph;
+}
+
+void IndexGraphCache::Put(NumMwmId numMwmId, int64_t version, shared_ptr<IndexGraph> graph,
+                          size_t sizeInBytes)
+{
+  CHECK(graph, ());
+
+  lock_guard<mutex> lock(m_mutex);
+
+  auto const it = m_entries.find(numMwmId);
+  if (it != m_entries.end())
+    Erase(numMwmId);
+
+  m_lru.push_front(numMwmId);
+
+  Entry entry;
+  entry.m_graph = move(graph);
+  entry.m_version = version;
+  entry.m_size = sizeInBytes;
+  entry.m_lruIt = m_lru.begin();
+  m_entries[numMwmId] = move(entry);
+
+  m_stats.m_bytes += sizeInBytes;
+  EvictToBudget();
+}
+
+void IndexGraphCache::Clear()
+{
+  lock_guard<mutex> lock(m_mutex);
+  m_entries.clear();
+  m_lru.clear();
+  m_stats.m_bytes = 0;
+}
+
+IndexGraphCache::Stats IndexGraphCache::GetStats() const
+{
+  lock_guard<mutex> lock(m_mutex);
+  return m_stats;
+}
+
+void IndexGraphCache::EvictToBudget()
+{
+  while (m_stats.m_bytes > m_budget && !m_lru.empty())
+  {
+    NumMwmId const victim = m_lru.back();
+    Erase(victim);
+    ++m_stats.m_evictions;
+  }
+}
+
+void IndexGraphCache::Erase(NumMwmId numMwmId)
+{
+  auto const it = m_entries.find(numMwmId);
+  CHECK(it != m_entries.end(), ());
+
+  m_stats.m_bytes -= it->second.m_size;
+  m_lru.erase(it->second.m_lruIt);
+  m_entries.erase(it);
+}
+}  // namespace routing
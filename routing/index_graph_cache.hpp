@@ -0,0 +1,76 @@
+#pragma once
+
+#include "routing/num_mwm_id.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/list.hpp"
+#include "std/mutex.hpp"
+#include "std/shared_ptr.hpp"
+#include "std/unordered_map.hpp"
+
+namespace routing
+{
+class IndexGraph;
+
+// Process-wide LRU cache of deserialized IndexGraph instances.
+//
+// Deserializing the routing section and rebuilding road geometry dominates the
+// cost of repeat routes in the same region, so graphs are kept across
+// CalculateRoute calls and across IndexRouter instances under an explicit byte
+// budget. The size of an entry is an estimation made by the loader.
+//
+// Note. Entries are keyed by NumMwmId and mwm version. The cache assumes one
+// vehicle model per process which holds for IndexRouter: it is created for car
+// routing only.
+class IndexGraphCache final
+{
+public:
+  struct Stats
+  {
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_evictions = 0;
+    size_t m_bytes = 0;
+  };
+
+  static IndexGraphCache & Instance();
+
+  // Sets the cache byte budget, evicting least recently used entries if needed.
+  void SetBudget(size_t bytes);
+
+  // Returns the cached graph or nullptr. |version| guards against
+  // reading a graph of an updated mwm.
+  shared_ptr<IndexGraph> Get(NumMwmId numMwmId, int64_t version);
+
+  void Put(NumMwmId numMwmId, int64_t version, shared_ptr<IndexGraph> graph, size_t sizeInBytes);
+
+  void Clear();
+
+  Stats GetStats() const;
+
+private:
+  static size_t constexpr kDefaultBudgetBytes = 256 * 1024 * 1024;
+
+  struct Entry
+  {
+    shared_ptr<IndexGraph> m_graph;
+    int64_t m_version = 0;
+    size_t m_size = 0;
+    list<NumMwmId>::iterator m_lruIt;
+  };
+
+  IndexGraphCache() = default;
+
+  // Evicts least recently used entries until the budget is met.
+  // |m_mutex| should be taken before.
+  void EvictToBudget();
+  void Erase(NumMwmId numMwmId);
+
+  mutable mutex m_mutex;
+  size_t m_budget = kDefaultBudgetBytes;
+  // Most recently used ids are in the front.
+  list<NumMwmId> m_lru;
+  unordered_map<NumMwmId, Entry> m_entries;
+  Stats m_stats;
+};
+}  // namespace routing
@@ -1,6 +1,8 @@
 #include "routing/index_graph_loader.hpp"
 
+#include "routing/index_graph_cache.hpp"
 #include "routing/index_graph_serialization.hpp"
+#include "routing/joint_hierarchy.hpp"
 #include "routing/restriction_loader.hpp"
 #include "routing/routing_exceptions.hpp"
 
@@ -14,6 +16,15 @@ namespace
 using namespace routing;
 using namespace std;
 
+// A rough estimation of the resident size of a deserialized graph
+// for the IndexGraphCache accounting.
+size_t EstimateGraphSize(IndexGraph const & graph)
+{
+  size_t constexpr kBytesPerPoint = sizeof(RoadPoint) + sizeof(Joint::Id);
+  size_t constexpr kBytesPerRoad = 64;
+  return graph.GetNumPoints() * kBytesPerPoint + graph.GetNumRoads() * kBytesPerRoad;
+}
+
 class IndexGraphLoaderImpl final : public IndexGraphLoader
 {
 public:
@@ -32,7 +43,7 @@ private:
   shared_ptr<NumMwmIds> m_numMwmIds;
   shared_ptr<VehicleModelFactory> m_vehicleModelFactory;
   shared_ptr<EdgeEstimator> m_estimator;
-  unordered_map<NumMwmId, unique_ptr<IndexGraph>> m_graphs;
+  unordered_map<NumMwmId, shared_ptr<IndexGraph>> m_graphs;
 };
 
 IndexGraphLoaderImpl::IndexGraphLoaderImpl(shared_ptr<NumMwmIds> numMwmIds,
@@ -64,23 +75,36 @@ IndexGraph & IndexGraphLoaderImpl::Load(NumMwmId numMwmId)
   if (!handle.IsAlive())
     MYTHROW(RoutingException, ("Can't get mwm handle for", file));
 
+  int64_t const version = handle.GetInfo()->GetVersion();
+
+  auto & cache = IndexGraphCache::Instance();
+  if (auto cached = cache.Get(numMwmId, version))
+  {
+    IndexGraph & graph = *cached;
+    m_graphs[numMwmId] = move(cached);
+    return graph;
+  }
+
   shared_ptr<IVehicleModel> vehicleModel =
       m_vehicleModelFactory->GetVehicleModelForCountry(file.GetName());
 
   auto const mwmId = MwmSet::MwmId(handle.GetInfo());
   auto graphPtr =
-      make_unique<IndexGraph>(GeometryLoader::Create(m_index, mwmId, vehicleModel), m_estimator);
+      make_shared<IndexGraph>(GeometryLoader::Create(m_index, mwmId, vehicleModel), m_estimator);
   IndexGraph & graph = *graphPtr;
 
   my::Timer timer;
   MwmValue const & mwmValue = *handle.GetValue<MwmValue>();
   DeserializeIndexGraph(mwmValue, graph);
+  cache.Put(numMwmId, version, graphPtr, EstimateGraphSize(graph));
   m_graphs[numMwmId] = move(graphPtr);
   LOG(LINFO, (ROUTING_FILE_TAG, "section for", file.GetName(), "loaded in", timer.ElapsedSeconds(),
               "seconds"));
   return graph;
 }
 
+// Drops the loader references only: graphs stay in IndexGraphCache
+// under its byte budget.
 void IndexGraphLoaderImpl::Clear() { m_graphs.clear(); }
 }  // namespace
 
@@ -96,11 +120,53 @@ unique_ptr<IndexGraphLoader> IndexGraphLoader::Create(
 
 void DeserializeIndexGraph(MwmValue const & mwmValue, IndexGraph & graph)
 {
-  FilesContainerR::TReader reader(mwmValue.m_cont.GetReader(ROUTING_FILE_TAG));
-  ReaderSource<FilesContainerR::TReader> src(reader);
-  IndexGraphSerializer::Deserialize(graph, src, kCarMask);
+  // Decode the routing section directly over the mmapped mwm: it saves
+  // the copy of the whole section through the buffered FileReader path.
+  // Fall back to the regular reader if mapping is not available,
+  // e.g. for mwms inside apk on Android.
+  bool deserialized = false;
+  try
+  {
+    FilesMappingContainer mappingCont;
+    mappingCont.Open(mwmValue.m_file.GetPath(MapOptions::Map));
+    FilesMappingContainer::Handle handle = mappingCont.Map(ROUTING_FILE_TAG);
+    MemReader reader(handle.GetData<char>(), static_cast<size_t>(handle.GetSize()));
+    ReaderSource<MemReader> src(reader);
+    IndexGraphSerializer::Deserialize(graph, src, kCarMask);
+    deserialized = true;
+  }
+  catch (Reader::OpenException const & e)
+  {
+    LOG(LWARNING, ("Can't map", ROUTING_FILE_TAG, "section for",
+                   mwmValue.GetCountryFileName(), ":", e.Msg()));
+  }
+
+  if (!deserialized)
+  {
+    FilesContainerR::TReader reader(mwmValue.m_cont.GetReader(ROUTING_FILE_TAG));
+    ReaderSource<FilesContainerR::TReader> src(reader);
+    IndexGraphSerializer::Deserialize(graph, src, kCarMask);
+  }
   RestrictionLoader restrictionLoader(mwmValue, graph);
   if (restrictionLoader.HasRestrictions())
     graph.SetRestrictions(restrictionLoader.StealRestrictions());
+
+  if (mwmValue.m_cont.IsExist(SEGMENT_WEIGHTS_FILE_TAG))
+  {
+    auto weights = make_unique<SegmentWeights>();
+    FilesContainerR::TReader weightsReader(mwmValue.m_cont.GetReader(SEGMENT_WEIGHTS_FILE_TAG));
+    ReaderSource<FilesContainerR::TReader> weightsSrc(weightsReader);
+    weights->Deserialize(weightsSrc);
+    graph.SetSegmentWeights(move(weights));
+  }
+
+  if (mwmValue.m_cont.IsExist(JOINT_HIERARCHY_FILE_TAG))
+  {
+    auto hierarchy = make_unique<JointHierarchy>();
+    FilesContainerR::TReader hierarchyReader(mwmValue.m_cont.GetReader(JOINT_HIERARCHY_FILE_TAG));
+    ReaderSource<FilesContainerR::TReader> hierarchySrc(hierarchyReader);
+    hierarchy->Deserialize(hierarchySrc);
+    graph.SetJointHierarchy(move(hierarchy));
+  }
 }
 }  // namespace routing
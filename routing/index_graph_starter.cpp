@@ -12,6 +12,8 @@ IndexGraphStarter::IndexGraphStarter(FakeVertex const & start, FakeVertex const
                                      WorldGraph & graph)
   : m_graph(graph), m_start(start), m_finish(finish)
 {
+  GetFakeToNormalEdges(m_start, m_startEdges);
+  GetFakeToNormalEdges(m_finish, m_finishEdges);
 }
 
 m2::PointD const & IndexGraphStarter::GetPoint(Segment const & segment, bool front)
@@ -54,13 +56,13 @@ void IndexGraphStarter::GetEdgesList(Segment const & segment, bool isOutgoing,
 
   if (segment == kStartFakeSegment)
   {
-    GetFakeToNormalEdges(m_start, edges);
+    edges.assign(m_startEdges.begin(), m_startEdges.end());
     return;
   }
 
   if (segment == kFinishFakeSegment)
   {
-    GetFakeToNormalEdges(m_finish, edges);
+    edges.assign(m_finishEdges.begin(), m_finishEdges.end());
     return;
   }
 
@@ -59,6 +59,8 @@ public:
   WorldGraph & GetGraph() { return m_graph; }
   Segment const & GetStart() const { return kStartFakeSegment; }
   Segment const & GetFinish() const { return kFinishFakeSegment; }
+  FakeVertex const & GetStartVertex() const { return m_start; }
+  FakeVertex const & GetFinishVertex() const { return m_finish; }
   m2::PointD const & GetPoint(Segment const & segment, bool front);
 
   static size_t GetRouteNumPoints(vector<Segment> const & route);
@@ -117,5 +119,10 @@ private:
   WorldGraph & m_graph;
   FakeVertex const m_start;
   FakeVertex const m_finish;
+  // Edges of the fake start and finish vertexes. The projections do not
+  // change during the query, so the edges are built once in the
+  // constructor instead of on each GetEdgesList call.
+  vector<SegmentEdge> m_startEdges;
+  vector<SegmentEdge> m_finishEdges;
 };
 }  // namespace routing
@@ -24,9 +24,12 @@
 #include "geometry/mercator.hpp"
 #include "geometry/point2d.hpp"
 
+#include "base/alloc_tracker.hpp"
 #include "base/exception.hpp"
 
 #include <algorithm>
+#include <map>
+#include <set>
 
 using namespace routing;
 
@@ -35,6 +38,126 @@ namespace
 size_t constexpr kMaxRoadCandidates = 6;
 float constexpr kProgressInterval = 2;
 uint32_t constexpr kDrawPointsPeriod = 10;
+
+// Collects joints reachable from |vertex| along its feature together with
+// the segments leading to them. |entries| and |runs| are parallel vectors.
+bool CollectHierarchyEntries(IndexGraph & graph, IndexGraphStarter::FakeVertex const & vertex,
+                             bool isStart, vector<JointHierarchy::EntryPoint> & entries,
+                             vector<vector<Segment>> & runs)
+{
+  uint32_t const featureId = vertex.GetFeatureId();
+  if (!graph.IsRoad(featureId))
+    return false;
+
+  RoadJointIds const & road = graph.GetRoad(featureId);
+  RoadGeometry const & geometry = graph.GetGeometry().GetRoad(featureId);
+  if (!geometry.IsValid())
+    return false;
+
+  NumMwmId const mwmId = vertex.GetMwmId();
+  EdgeEstimator const & estimator = graph.GetEstimator();
+  uint32_t const segmentIdx = vertex.GetSegmentIdx();
+
+  auto addRun = [&](Joint::Id jointId, uint32_t fromIdx, uint32_t toIdx, bool forward) {
+    vector<Segment> run;
+    double weight = 0.0;
+    if (forward)
+    {
+      for (uint32_t idx = fromIdx; idx <= toIdx; ++idx)
+      {
+        run.emplace_back(mwmId, featureId, idx, true /* forward */);
+        weight += estimator.CalcSegmentWeight(run.back(), geometry);
+      }
+    }
+    else
+    {
+      for (uint32_t idx = fromIdx; idx >= toIdx && idx != numeric_limits<uint32_t>::max(); --idx)
+      {
+        run.emplace_back(mwmId, featureId, idx, false /* forward */);
+        weight += estimator.CalcSegmentWeight(run.back(), geometry);
+      }
+    }
+
+    entries.emplace_back(jointId, weight);
+    runs.push_back(move(run));
+  };
+
+  if (isStart)
+  {
+    // Going along the feature: the nearest joint at segmentIdx + 1 or farther.
+    Joint::Id jointId = road.GetJointId(segmentIdx + 1);
+    uint32_t jointPointId = segmentIdx + 1;
+    if (jointId == Joint::kInvalidId)
+    {
+      auto const neighbor = road.FindNeighbor(segmentIdx + 1, true /* forward */);
+      jointId = neighbor.first;
+      jointPointId = neighbor.second;
+    }
+    if (jointId != Joint::kInvalidId)
+      addRun(jointId, segmentIdx, jointPointId - 1, true /* forward */);
+
+    if (!geometry.IsOneWay())
+    {
+      jointId = road.GetJointId(segmentIdx);
+      jointPointId = segmentIdx;
+      if (jointId == Joint::kInvalidId)
+      {
+        auto const neighbor = road.FindNeighbor(segmentIdx, false /* forward */);
+        jointId = neighbor.first;
+        jointPointId = neighbor.second;
+      }
+      if (jointId != Joint::kInvalidId)
+        addRun(jointId, segmentIdx, jointPointId, false /* forward */);
+    }
+  }
+  else
+  {
+    // Arriving along the feature: the nearest joint at segmentIdx or before.
+    Joint::Id jointId = road.GetJointId(segmentIdx);
+    uint32_t jointPointId = segmentIdx;
+    if (jointId == Joint::kInvalidId)
+    {
+      auto const neighbor = road.FindNeighbor(segmentIdx, false /* forward */);
+      jointId = neighbor.first;
+      jointPointId = neighbor.second;
+    }
+    if (jointId != Joint::kInvalidId)
+      addRun(jointId, jointPointId, segmentIdx, true /* forward */);
+
+    if (!geometry.IsOneWay())
+    {
+      jointId = road.GetJointId(segmentIdx + 1);
+      jointPointId = segmentIdx + 1;
+      if (jointId == Joint::kInvalidId)
+      {
+        auto const neighbor = road.FindNeighbor(segmentIdx + 1, true /* forward */);
+        jointId = neighbor.first;
+        jointPointId = neighbor.second;
+      }
+      if (jointId != Joint::kInvalidId)
+        addRun(jointId, jointPointId - 1, segmentIdx, false /* forward */);
+    }
+  }
+
+  return !entries.empty();
+}
+
+// Returns the run matching |jointId| with the minimal entry weight.
+vector<Segment> const & GetRunForJoint(vector<JointHierarchy::EntryPoint> const & entries,
+                                       vector<vector<Segment>> const & runs, Joint::Id jointId)
+{
+  size_t best = entries.size();
+  for (size_t i = 0; i < entries.size(); ++i)
+  {
+    if (entries[i].m_jointId != jointId)
+      continue;
+    if (best == entries.size() || entries[i].m_weight < entries[best].m_weight)
+      best = i;
+  }
+
+  CHECK_LESS(best, entries.size(), ("No entry for joint", jointId));
+  return runs[best];
+}
 }  // namespace
 
 namespace routing
@@ -89,6 +212,8 @@ IRouter::ResultCode IndexRouter::CalculateRoute(string const & startCountry,
                                                 m2::PointD const & finalPoint,
                                                 RouterDelegate const & delegate, Route & route)
 {
+  TRACK_ALLOCATIONS_SCOPE(my::AllocTracker::SubsystemRouting);
+
   try
   {
     return DoCalculateRoute(startCountry, finishCountry, forSingleMwm, startPoint, startDirection,
@@ -136,6 +261,37 @@ IRouter::ResultCode IndexRouter::DoCalculateRoute(string const & startCountry,
 
   IndexGraphStarter starter(start, finish, graph);
 
+  if (!forSingleMwm && m_lastRoute && m_lastRoute->m_finish == finalPoint)
+  {
+    // The driver deviated from the route to the same finish: try to rejoin
+    // the old route with a small local search instead of a full rebuild.
+    vector<Segment> segments;
+    if (TryIncrementalRebuild(starter, delegate, segments))
+    {
+      if (!RedressRoute(segments, delegate, forSingleMwm, starter, route))
+        return IRouter::InternalError;
+      if (delegate.IsCancelled())
+        return IRouter::Cancelled;
+      SaveLastRoute(finalPoint, segments);
+      return IRouter::NoError;
+    }
+  }
+
+  if (start.GetMwmId() == finish.GetMwmId())
+  {
+    vector<Segment> segments;
+    if (TryHierarchyRoute(starter, segments))
+    {
+      if (!RedressRoute(segments, delegate, forSingleMwm, starter, route))
+        return IRouter::InternalError;
+      if (delegate.IsCancelled())
+        return IRouter::Cancelled;
+      if (!forSingleMwm)
+        SaveLastRoute(finalPoint, segments);
+      return IRouter::NoError;
+    }
+  }
+
   AStarProgress progress(0, 100);
   progress.Initialize(startPoint, finalPoint);
 
@@ -155,12 +311,26 @@ IRouter::ResultCode IndexRouter::DoCalculateRoute(string const & startCountry,
   AStarAlgorithm<IndexGraphStarter> algorithm;
 
   RoutingResult<Segment> routingResult;
-  auto const resultCode = algorithm.FindPathBidirectional(
-      starter, starter.GetStart(), starter.GetFinish(), routingResult, delegate, onVisitJunction);
+  AStarAlgorithm<IndexGraphStarter>::Result resultCode;
+  if (forSingleMwm)
+  {
+    // Preload the graph: the parallel waves must not race on the mwm registry.
+    graph.GetIndexGraph(start.GetMwmId());
+    resultCode = algorithm.FindPathBidirectionalParallel(
+        starter, starter.GetStart(), starter.GetFinish(), routingResult, delegate,
+        onVisitJunction);
+  }
+  else
+  {
+    resultCode = algorithm.FindPathBidirectional(starter, starter.GetStart(), starter.GetFinish(),
+                                                 routingResult, delegate, onVisitJunction);
+  }
 
   switch (resultCode)
   {
-  case AStarAlgorithm<IndexGraphStarter>::Result::NoPath: return IRouter::RouteNotFound;
+  case AStarAlgorithm<IndexGraphStarter>::Result::NoPath:
+    m_lastRoute.reset();
+    return IRouter::RouteNotFound;
   case AStarAlgorithm<IndexGraphStarter>::Result::Cancelled: return IRouter::Cancelled;
   case AStarAlgorithm<IndexGraphStarter>::Result::OK:
     vector<Segment> segments;
@@ -175,6 +345,8 @@ IRouter::ResultCode IndexRouter::DoCalculateRoute(string const & startCountry,
       return IRouter::InternalError;
     if (delegate.IsCancelled())
       return IRouter::Cancelled;
+    if (!forSingleMwm)
+      SaveLastRoute(finalPoint, segments);
     return IRouter::NoError;
   }
 }
@@ -217,6 +389,137 @@ bool IndexRouter::FindClosestEdge(platform::CountryFile const & file, m2::PointD
   return true;
 }
 
+bool IndexRouter::TryHierarchyRoute(IndexGraphStarter & starter, vector<Segment> & segments) const
+{
+  IndexGraphStarter::FakeVertex const & start = starter.GetStartVertex();
+  IndexGraphStarter::FakeVertex const & finish = starter.GetFinishVertex();
+
+  if (start.GetMwmId() != finish.GetMwmId())
+    return false;
+
+  // A short route along a single feature is cheap for A* anyway and
+  // the hierarchy query through the nearest joints may give a detour here.
+  if (start.GetFeatureId() == finish.GetFeatureId())
+    return false;
+
+  IndexGraph & graph = starter.GetGraph().GetIndexGraph(start.GetMwmId());
+  JointHierarchy const * hierarchy = graph.GetJointHierarchy();
+  if (hierarchy == nullptr || !hierarchy->IsValid())
+    return false;
+
+  vector<JointHierarchy::EntryPoint> starts;
+  vector<vector<Segment>> startRuns;
+  if (!CollectHierarchyEntries(graph, start, true /* isStart */, starts, startRuns))
+    return false;
+
+  vector<JointHierarchy::EntryPoint> finishes;
+  vector<vector<Segment>> finishRuns;
+  if (!CollectHierarchyEntries(graph, finish, false /* isStart */, finishes, finishRuns))
+    return false;
+
+  vector<Segment> core;
+  Joint::Id startJoint = Joint::kInvalidId;
+  Joint::Id finishJoint = Joint::kInvalidId;
+  if (!hierarchy->FindPath(starts, finishes, start.GetMwmId(), core, startJoint, finishJoint))
+    return false;
+
+  segments.clear();
+  segments.push_back(starter.GetStart());
+
+  vector<Segment> const & startRun = GetRunForJoint(starts, startRuns, startJoint);
+  segments.insert(segments.end(), startRun.begin(), startRun.end());
+  segments.insert(segments.end(), core.begin(), core.end());
+  vector<Segment> const & finishRun = GetRunForJoint(finishes, finishRuns, finishJoint);
+  segments.insert(segments.end(), finishRun.begin(), finishRun.end());
+
+  segments.push_back(starter.GetFinish());
+  return true;
+}
+
+bool IndexRouter::TryIncrementalRebuild(IndexGraphStarter & starter,
+                                        RouterDelegate const & delegate,
+                                        vector<Segment> & segments) const
+{
+  // Bound of the repair wave. If the driver went that far from the old route
+  // the full rebuild is not much more expensive than the repair.
+  size_t constexpr kMaxRepairSettledVertices = 10000;
+
+  CHECK(m_lastRoute, ());
+  set<Segment> const onRoute(m_lastRoute->m_segments.cbegin(), m_lastRoute->m_segments.cend());
+  if (onRoute.empty())
+    return false;
+
+  WorldGraph & graph = starter.GetGraph();
+  WorldGraph::Mode const mode = graph.GetMode();
+  // The old route consists of real segments only, so the rejoin wave
+  // should not generate leap edges.
+  graph.SetMode(starter.GetStartVertex().GetMwmId() == starter.GetFinishVertex().GetMwmId()
+                    ? WorldGraph::Mode::SingleMwm
+                    : WorldGraph::Mode::WorldWithoutLeaps);
+
+  AStarAlgorithm<IndexGraphStarter> algorithm;
+  map<Segment, double> distances;
+  map<Segment, Segment> parents;
+  Segment joinSegment;
+  bool found = false;
+  size_t settled = 0;
+
+  algorithm.PropagateWave(
+      starter, starter.GetStart(),
+      [&](Segment const & vertex) {
+        if (onRoute.find(vertex) != onRoute.cend())
+        {
+          joinSegment = vertex;
+          found = true;
+          return true;
+        }
+        return ++settled > kMaxRepairSettledVertices || delegate.IsCancelled();
+      },
+      [](Segment const & /* vertex */, SegmentEdge const & edge) { return edge.GetWeight(); },
+      [&](Segment const & vertex, Segment const & parent) { parents[vertex] = parent; },
+      distances);
+
+  graph.SetMode(mode);
+
+  if (!found || delegate.IsCancelled())
+    return false;
+
+  // The wave starts from the fake start segment, so the head of the repaired
+  // route from the fake start to |joinSegment| is unwound from the parents.
+  segments.clear();
+  for (Segment vertex = joinSegment;;)
+  {
+    segments.push_back(vertex);
+    auto const it = parents.find(vertex);
+    if (it == parents.cend())
+      break;
+    vertex = it->second;
+  }
+  reverse(segments.begin(), segments.end());
+
+  auto const tail =
+      find(m_lastRoute->m_segments.cbegin(), m_lastRoute->m_segments.cend(), joinSegment);
+  CHECK(tail != m_lastRoute->m_segments.cend(), ());
+  segments.insert(segments.end(), tail + 1, m_lastRoute->m_segments.cend());
+  segments.push_back(starter.GetFinish());
+
+  LOG(LINFO, ("Rejoined the old route after", settled, "settled vertices, reused",
+              distance(tail, m_lastRoute->m_segments.cend()), "segments"));
+  return true;
+}
+
+void IndexRouter::SaveLastRoute(m2::PointD const & finalPoint, vector<Segment> const & segments)
+{
+  m_lastRoute = make_unique<LastRoute>();
+  m_lastRoute->m_finish = finalPoint;
+  m_lastRoute->m_segments.reserve(segments.size());
+  for (Segment const & segment : segments)
+  {
+    if (!IndexGraphStarter::IsFakeSegment(segment))
+      m_lastRoute->m_segments.push_back(segment);
+  }
+}
+
 IRouter::ResultCode IndexRouter::ProcessLeaps(vector<Segment> const & input,
                                               RouterDelegate const & delegate,
                                               IndexGraphStarter & starter, vector<Segment> & output)
@@ -250,10 +553,12 @@ IRouter::ResultCode IndexRouter::ProcessLeaps(vector<Segment> const & input,
     // Clear previous loaded graphs.
     // Dont spend too much memory at one time.
     worldGraph.ClearIndexGraphs();
+    // Preload the graph for the parallel waves.
+    worldGraph.GetIndexGraph(current.GetMwmId());
 
     AStarAlgorithm<IndexGraphStarter> algorithm;
     RoutingResult<Segment> routingResult;
-    auto const resultCode = algorithm.FindPathBidirectional(
+    auto const resultCode = algorithm.FindPathBidirectionalParallel(
         leapStarter, leapStarter.GetStart(), leapStarter.GetFinish(), routingResult, delegate, {});
 
     switch (resultCode)
@@ -65,6 +65,18 @@ private:
                                        RouterDelegate const & delegate, Route & route);
   bool FindClosestEdge(platform::CountryFile const & file, m2::PointD const & point,
                        Edge & closestEdge) const;
+  // Tries to calculate the route over the joint hierarchy section.
+  // Returns false if the mwm has no hierarchy or the endpoints can't be attached to it:
+  // the caller falls back to bidirectional A* in this case.
+  bool TryHierarchyRoute(IndexGraphStarter & starter, vector<Segment> & segments) const;
+  // Tries to repair the previous route instead of a full rebuild: searches from
+  // the deviation point back onto the old route and reuses its unchanged tail.
+  // Returns false if the old route can't be rejoined cheaply: the caller falls
+  // back to the full search in this case.
+  bool TryIncrementalRebuild(IndexGraphStarter & starter, RouterDelegate const & delegate,
+                             vector<Segment> & segments) const;
+  // Remembers the route for incremental rebuilds on deviation.
+  void SaveLastRoute(m2::PointD const & finalPoint, vector<Segment> const & segments);
   // Input route may contains 'leaps': shortcut edges from mwm border enter to exit.
   // ProcessLeaps replaces each leap with calculated route through mwm.
   IRouter::ResultCode ProcessLeaps(vector<Segment> const & input, RouterDelegate const & delegate,
@@ -82,5 +94,15 @@ private:
   shared_ptr<VehicleModelFactory> m_vehicleModelFactory;
   shared_ptr<EdgeEstimator> m_estimator;
   unique_ptr<IDirectionsEngine> m_directionsEngine;
+
+  // The last successfully built route. Kept to rejoin it with a small
+  // local search when the driver deviates, instead of a full restart.
+  struct LastRoute
+  {
+    m2::PointD m_finish;
+    // Real (non-fake) segments of the route.
+    vector<Segment> m_segments;
+  };
+  unique_ptr<LastRoute> m_lastRoute;
 };
 }  // namespace routing
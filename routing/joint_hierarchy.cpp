@@ -0,0 +1,472 @@
+#include "routing/joint_hierarchy.hpp"
+
+#include "routing/index_graph.hpp"
+
+#include "base/assert.hpp"
+#include "base/logging.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/map.hpp"
+#include "std/queue.hpp"
+#include "std/unordered_map.hpp"
+
+namespace
+{
+using namespace routing;
+
+double constexpr kInfiniteDistance = numeric_limits<double>::max();
+// Witness dijkstra is limited to keep contraction time sane:
+// a missed witness only leads to a redundant shortcut, not to a wrong route.
+size_t constexpr kMaxWitnessSettled = 64;
+
+using QueueItem = pair<double, Joint::Id>;
+using Queue = priority_queue<QueueItem, vector<QueueItem>, greater<QueueItem>>;
+
+// Working graph of the contraction. Adjacency lists only grow:
+// contracted joints are skipped by lookups instead of being removed.
+struct ContractionGraph
+{
+  explicit ContractionGraph(uint32_t numJoints)
+    : m_out(numJoints), m_in(numJoints), m_contracted(numJoints, false)
+  {
+  }
+
+  vector<vector<JointHierarchy::Edge>> m_out;
+  vector<vector<JointHierarchy::Edge>> m_in;
+  vector<bool> m_contracted;
+};
+
+// One-to-many dijkstra from |from| ignoring |skip| and contracted joints,
+// limited by |maxDistance| and kMaxWitnessSettled.
+void FindWitnesses(ContractionGraph const & graph, Joint::Id from, Joint::Id skip,
+                   double maxDistance, unordered_map<Joint::Id, double> & distances)
+{
+  Queue queue;
+  queue.emplace(0.0, from);
+  distances[from] = 0.0;
+
+  size_t settled = 0;
+  while (!queue.empty() && settled < kMaxWitnessSettled)
+  {
+    auto const item = queue.top();
+    queue.pop();
+
+    if (item.first > distances[item.second])
+      continue;
+
+    ++settled;
+    for (auto const & edge : graph.m_out[item.second])
+    {
+      Joint::Id const target = edge.GetTarget();
+      if (target == skip || graph.m_contracted[target])
+        continue;
+
+      double const distance = item.first + edge.GetWeight();
+      if (distance > maxDistance)
+        continue;
+
+      auto const it = distances.find(target);
+      if (it == distances.end() || distance < it->second)
+      {
+        distances[target] = distance;
+        queue.emplace(distance, target);
+      }
+    }
+  }
+}
+
+// Collects minimal weights to non-contracted neighbors of |u|.
+void GetNeighbors(vector<JointHierarchy::Edge> const & edges, vector<bool> const & contracted,
+                  Joint::Id u, map<Joint::Id, double> & neighbors)
+{
+  for (auto const & edge : edges)
+  {
+    Joint::Id const target = edge.GetTarget();
+    if (target == u || contracted[target])
+      continue;
+
+    auto const it = neighbors.find(target);
+    if (it == neighbors.end() || edge.GetWeight() < it->second)
+      neighbors[target] = edge.GetWeight();
+  }
+}
+
+// Returns the number of shortcuts the contraction of |u| requires.
+// If |contract| is set, inserts these shortcuts into the graph.
+size_t ContractJoint(ContractionGraph & graph, Joint::Id u, bool contract)
+{
+  map<Joint::Id, double> inNeighbors;
+  map<Joint::Id, double> outNeighbors;
+  GetNeighbors(graph.m_in[u], graph.m_contracted, u, inNeighbors);
+  GetNeighbors(graph.m_out[u], graph.m_contracted, u, outNeighbors);
+
+  if (inNeighbors.empty() || outNeighbors.empty())
+    return 0;
+
+  double maxOut = 0.0;
+  for (auto const & out : outNeighbors)
+    maxOut = max(maxOut, out.second);
+
+  size_t shortcuts = 0;
+  for (auto const & in : inNeighbors)
+  {
+    unordered_map<Joint::Id, double> witnesses;
+    FindWitnesses(graph, in.first, u, in.second + maxOut, witnesses);
+
+    for (auto const & out : outNeighbors)
+    {
+      if (out.first == in.first)
+        continue;
+
+      double const viaWeight = in.second + out.second;
+      auto const it = witnesses.find(out.first);
+      if (it != witnesses.end() && it->second <= viaWeight)
+        continue;
+
+      ++shortcuts;
+      if (contract)
+      {
+        graph.m_out[in.first].emplace_back(out.first, viaWeight, u /* via */);
+        graph.m_in[out.first].emplace_back(in.first, viaWeight, u /* via */);
+      }
+    }
+  }
+
+  return shortcuts;
+}
+
+size_t GetDegree(ContractionGraph const & graph, Joint::Id u)
+{
+  size_t degree = 0;
+  for (auto const & edge : graph.m_out[u])
+  {
+    if (!graph.m_contracted[edge.GetTarget()])
+      ++degree;
+  }
+  for (auto const & edge : graph.m_in[u])
+  {
+    if (!graph.m_contracted[edge.GetTarget()])
+      ++degree;
+  }
+  return degree;
+}
+
+double CalcPriority(ContractionGraph & graph, Joint::Id u, uint32_t contractedNeighbors)
+{
+  size_t const shortcuts = ContractJoint(graph, u, false /* contract */);
+  return 2.0 * shortcuts - static_cast<double>(GetDegree(graph, u)) + contractedNeighbors;
+}
+
+void BuildFeatureEdges(IndexGraph & graph, ContractionGraph & contraction)
+{
+  EdgeEstimator const & estimator = graph.GetEstimator();
+
+  graph.ForEachRoad([&](uint32_t featureId, RoadJointIds const & road) {
+    RoadGeometry const & geometry = graph.GetGeometry().GetRoad(featureId);
+    if (!geometry.IsValid())
+      return;
+
+    Joint::Id prevJoint = Joint::kInvalidId;
+    uint32_t prevPointId = 0;
+
+    road.ForEachJoint([&](uint32_t pointId, Joint::Id jointId) {
+      if (prevJoint != Joint::kInvalidId)
+      {
+        double weight = 0.0;
+        for (uint32_t i = prevPointId; i < pointId; ++i)
+        {
+          weight += estimator.CalcSegmentWeight(
+              Segment(kFakeNumMwmId, featureId, i, true /* forward */), geometry);
+        }
+
+        contraction.m_out[prevJoint].emplace_back(jointId, weight, featureId, prevPointId,
+                                                  pointId);
+        contraction.m_in[jointId].emplace_back(prevJoint, weight, featureId, prevPointId,
+                                               pointId);
+        if (!geometry.IsOneWay())
+        {
+          contraction.m_out[jointId].emplace_back(prevJoint, weight, featureId, pointId,
+                                                  prevPointId);
+          contraction.m_in[prevJoint].emplace_back(jointId, weight, featureId, pointId,
+                                                   prevPointId);
+        }
+      }
+
+      prevJoint = jointId;
+      prevPointId = pointId;
+    });
+  });
+}
+
+void AppendFeatureEdge(JointHierarchy::Edge const & edge, NumMwmId mwmId, vector<Segment> & path)
+{
+  uint32_t const from = edge.GetFromPointId();
+  uint32_t const to = edge.GetToPointId();
+  CHECK_NOT_EQUAL(from, to, ());
+
+  if (from < to)
+  {
+    for (uint32_t i = from; i < to; ++i)
+      path.emplace_back(mwmId, edge.GetFeatureId(), i, true /* forward */);
+  }
+  else
+  {
+    for (uint32_t i = from - 1; i >= to && i != numeric_limits<uint32_t>::max(); --i)
+      path.emplace_back(mwmId, edge.GetFeatureId(), i, false /* forward */);
+  }
+}
+
+struct VisitedState
+{
+  double m_distance = kInfiniteDistance;
+  Joint::Id m_parent = Joint::kInvalidId;
+  JointHierarchy::Edge const * m_edge = nullptr;
+};
+}  // namespace
+
+namespace routing
+{
+uint8_t constexpr JointHierarchy::kLastVersion;
+double constexpr JointHierarchy::kWeightScale;
+
+void JointHierarchy::Build(IndexGraph & graph)
+{
+  uint32_t const numJoints = graph.GetNumJoints();
+  ContractionGraph contraction(numJoints);
+  BuildFeatureEdges(graph, contraction);
+
+  Queue queue;
+  vector<uint32_t> contractedNeighbors(numJoints, 0);
+  for (Joint::Id u = 0; u < numJoints; ++u)
+    queue.emplace(CalcPriority(contraction, u, 0), u);
+
+  m_ranks.assign(numJoints, 0);
+  uint32_t rank = 0;
+
+  while (!queue.empty())
+  {
+    Joint::Id const u = queue.top().second;
+    queue.pop();
+
+    if (contraction.m_contracted[u])
+      continue;
+
+    // Lazy update: requeue the joint if its priority got worse than the next candidate.
+    double const priority = CalcPriority(contraction, u, contractedNeighbors[u]);
+    if (!queue.empty() && priority > queue.top().first)
+    {
+      queue.emplace(priority, u);
+      continue;
+    }
+
+    ContractJoint(contraction, u, true /* contract */);
+    contraction.m_contracted[u] = true;
+    m_ranks[u] = rank++;
+
+    for (auto const & edge : contraction.m_out[u])
+    {
+      if (!contraction.m_contracted[edge.GetTarget()])
+        ++contractedNeighbors[edge.GetTarget()];
+    }
+    for (auto const & edge : contraction.m_in[u])
+    {
+      if (!contraction.m_contracted[edge.GetTarget()])
+        ++contractedNeighbors[edge.GetTarget()];
+    }
+  }
+
+  // Keep upward edges only: every original or shortcut edge lands either
+  // into the forward list of its tail or into the backward list of its head.
+  m_forward.clear();
+  m_forwardOffsets.assign(numJoints + 1, 0);
+  m_backward.clear();
+  m_backwardOffsets.assign(numJoints + 1, 0);
+  m_numShortcuts = 0;
+
+  for (Joint::Id u = 0; u < numJoints; ++u)
+  {
+    m_forwardOffsets[u] = base::asserted_cast<uint32_t>(m_forward.size());
+    for (auto const & edge : contraction.m_out[u])
+    {
+      if (m_ranks[edge.GetTarget()] > m_ranks[u])
+      {
+        m_forward.push_back(edge);
+        if (edge.IsShortcut())
+          ++m_numShortcuts;
+      }
+    }
+
+    m_backwardOffsets[u] = base::asserted_cast<uint32_t>(m_backward.size());
+    for (auto const & edge : contraction.m_in[u])
+    {
+      if (m_ranks[edge.GetTarget()] > m_ranks[u])
+      {
+        m_backward.push_back(edge);
+        if (edge.IsShortcut())
+          ++m_numShortcuts;
+      }
+    }
+  }
+
+  m_forwardOffsets[numJoints] = base::asserted_cast<uint32_t>(m_forward.size());
+  m_backwardOffsets[numJoints] = base::asserted_cast<uint32_t>(m_backward.size());
+
+  LOG(LINFO, ("Joint hierarchy built:", numJoints, "joints,", m_forward.size(), "forward edges,",
+              m_backward.size(), "backward edges,", m_numShortcuts, "shortcuts"));
+}
+
+bool JointHierarchy::FindPath(vector<EntryPoint> const & starts,
+                              vector<EntryPoint> const & finishes, NumMwmId mwmId,
+                              vector<Segment> & path, Joint::Id & startJoint,
+                              Joint::Id & finishJoint) const
+{
+  CHECK(IsValid(), ());
+
+  // 0 is the forward search from starts, 1 is the backward search from finishes.
+  Queue queues[2];
+  unordered_map<Joint::Id, VisitedState> visited[2];
+
+  auto seed = [&](vector<EntryPoint> const & entries, size_t dir) {
+    for (auto const & entry : entries)
+    {
+      CHECK_LESS(entry.m_jointId, GetNumJoints(), ());
+      auto & state = visited[dir][entry.m_jointId];
+      if (entry.m_weight < state.m_distance)
+      {
+        state.m_distance = entry.m_weight;
+        queues[dir].emplace(entry.m_weight, entry.m_jointId);
+      }
+    }
+  };
+
+  seed(starts, 0);
+  seed(finishes, 1);
+
+  double bestDistance = kInfiniteDistance;
+  Joint::Id meetJoint = Joint::kInvalidId;
+
+  while (true)
+  {
+    bool expanded = false;
+    for (size_t dir = 0; dir < 2; ++dir)
+    {
+      if (queues[dir].empty() || queues[dir].top().first >= bestDistance)
+        continue;
+
+      expanded = true;
+      auto const item = queues[dir].top();
+      queues[dir].pop();
+
+      auto const & state = visited[dir][item.second];
+      if (item.first > state.m_distance)
+        continue;
+
+      auto const other = visited[1 - dir].find(item.second);
+      if (other != visited[1 - dir].end() &&
+          item.first + other->second.m_distance < bestDistance)
+      {
+        bestDistance = item.first + other->second.m_distance;
+        meetJoint = item.second;
+      }
+
+      auto const & edges = dir == 0 ? m_forward : m_backward;
+      auto const & offsets = dir == 0 ? m_forwardOffsets : m_backwardOffsets;
+      for (uint32_t i = offsets[item.second]; i < offsets[item.second + 1]; ++i)
+      {
+        Edge const & edge = edges[i];
+        double const distance = item.first + edge.GetWeight();
+        auto & targetState = visited[dir][edge.GetTarget()];
+        if (distance < targetState.m_distance)
+        {
+          targetState.m_distance = distance;
+          targetState.m_parent = item.second;
+          targetState.m_edge = &edge;
+          queues[dir].emplace(distance, edge.GetTarget());
+        }
+      }
+    }
+
+    if (!expanded)
+      break;
+  }
+
+  if (meetJoint == Joint::kInvalidId)
+    return false;
+
+  // Unwind the forward part in reverse order, then the backward part straight.
+  vector<Edge const *> featureEdges;
+  {
+    vector<pair<Joint::Id, Edge const *>> forwardChain;
+    Joint::Id joint = meetJoint;
+    while (true)
+    {
+      auto const & state = visited[0].at(joint);
+      if (state.m_edge == nullptr)
+        break;
+      forwardChain.emplace_back(state.m_parent, state.m_edge);
+      joint = state.m_parent;
+    }
+    startJoint = joint;
+
+    for (size_t i = forwardChain.size(); i > 0; --i)
+    {
+      auto const & link = forwardChain[i - 1];
+      UnpackEdge(link.first, link.second->GetTarget(), *link.second, featureEdges);
+    }
+  }
+  {
+    Joint::Id joint = meetJoint;
+    while (true)
+    {
+      auto const & state = visited[1].at(joint);
+      if (state.m_edge == nullptr)
+        break;
+      // Backward edges keep the travel direction: |joint| to its parent.
+      UnpackEdge(state.m_edge->GetTarget(), state.m_parent, *state.m_edge, featureEdges);
+      joint = state.m_parent;
+    }
+    finishJoint = joint;
+  }
+
+  path.clear();
+  for (Edge const * edge : featureEdges)
+    AppendFeatureEdge(*edge, mwmId, path);
+
+  return true;
+}
+
+JointHierarchy::Edge const * JointHierarchy::FindEdge(vector<Edge> const & edges,
+                                                      vector<uint32_t> const & offsets,
+                                                      Joint::Id owner, Joint::Id target) const
+{
+  Edge const * result = nullptr;
+  for (uint32_t i = offsets[owner]; i < offsets[owner + 1]; ++i)
+  {
+    Edge const & edge = edges[i];
+    if (edge.GetTarget() == target && (result == nullptr || edge.GetWeight() < result->GetWeight()))
+      result = &edge;
+  }
+  return result;
+}
+
+void JointHierarchy::UnpackEdge(Joint::Id from, Joint::Id to, Edge const & edge,
+                                vector<Edge const *> & featureEdges) const
+{
+  if (!edge.IsShortcut())
+  {
+    featureEdges.push_back(&edge);
+    return;
+  }
+
+  // The contracted joint is ranked below both shortcut ends,
+  // so both halves are reachable from its upward lists.
+  Joint::Id const via = edge.GetVia();
+  Edge const * first = FindEdge(m_backward, m_backwardOffsets, via, from);
+  Edge const * second = FindEdge(m_forward, m_forwardOffsets, via, to);
+  CHECK(first != nullptr, ("Can't unpack shortcut", from, "->", to, "via", via));
+  CHECK(second != nullptr, ("Can't unpack shortcut", from, "->", to, "via", via));
+
+  UnpackEdge(from, via, *first, featureEdges);
+  UnpackEdge(via, to, *second, featureEdges);
+}
+}  // namespace routing
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "routing/joint.hpp"
+#include "routing/num_mwm_id.hpp"
+#include "routing/routing_exceptions.hpp"
+#include "routing/segment.hpp"
+
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/assert.hpp"
+#include "base/checked_cast.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/limits.hpp"
+#include "std/utility.hpp"
+#include "std/vector.hpp"
+
+namespace routing
+{
+class IndexGraph;
+
+// JointHierarchy is an offline contraction hierarchy built over IndexGraph joints.
+//
+// Build contracts joints one by one following a lazily updated edge difference
+// heuristic and inserts shortcut edges between neighbors of a contracted joint
+// when no witness path survives the contraction. The query is a bidirectional
+// upward dijkstra over the hierarchy, it expands orders of magnitude less
+// vertices than plain A* on long routes.
+//
+// Note. The hierarchy is built over road geometry only: turn restrictions and
+// turn penalties are not taken into account, the same way as leap edges ignore
+// them. IndexRouter uses the hierarchy only when the section is present in mwm
+// and falls back to bidirectional A* otherwise.
+class JointHierarchy final
+{
+public:
+  class Edge final
+  {
+  public:
+    Edge() = default;
+
+    // Edge along a road feature connecting two neighboring joints.
+    Edge(Joint::Id target, double weight, uint32_t featureId, uint32_t fromPointId,
+         uint32_t toPointId)
+      : m_target(target)
+      , m_weight(weight)
+      , m_featureId(featureId)
+      , m_fromPointId(fromPointId)
+      , m_toPointId(toPointId)
+    {
+    }
+
+    // Shortcut edge replacing two edges incident to the contracted joint |via|.
+    Edge(Joint::Id target, double weight, Joint::Id via)
+      : m_target(target), m_weight(weight), m_via(via)
+    {
+    }
+
+    bool IsShortcut() const { return m_via != Joint::kInvalidId; }
+
+    Joint::Id GetTarget() const { return m_target; }
+    double GetWeight() const { return m_weight; }
+    Joint::Id GetVia() const { return m_via; }
+    uint32_t GetFeatureId() const { return m_featureId; }
+    uint32_t GetFromPointId() const { return m_fromPointId; }
+    uint32_t GetToPointId() const { return m_toPointId; }
+
+  private:
+    Joint::Id m_target = Joint::kInvalidId;
+    double m_weight = 0.0;
+    // Fields of an edge along a feature. Valid if m_via == Joint::kInvalidId.
+    uint32_t m_featureId = 0;
+    uint32_t m_fromPointId = 0;
+    uint32_t m_toPointId = 0;
+    // Contracted joint of a shortcut, Joint::kInvalidId for feature edges.
+    Joint::Id m_via = Joint::kInvalidId;
+  };
+
+  // Entry (exit) joint with the weight of reaching it from the route start (finish).
+  struct EntryPoint
+  {
+    EntryPoint(Joint::Id jointId, double weight) : m_jointId(jointId), m_weight(weight) {}
+
+    Joint::Id m_jointId = Joint::kInvalidId;
+    double m_weight = 0.0;
+  };
+
+  bool IsValid() const { return !m_ranks.empty(); }
+  uint32_t GetNumJoints() const { return base::asserted_cast<uint32_t>(m_ranks.size()); }
+  uint32_t GetNumShortcuts() const { return m_numShortcuts; }
+
+  // Builds the hierarchy over |graph| joints. Used by generator_tool.
+  void Build(IndexGraph & graph);
+
+  // Finds the shortest path from any of |starts| to any of |finishes|.
+  // Fills |path| with segments between the used entry and exit joints and returns
+  // these joints in |startJoint| and |finishJoint|.
+  bool FindPath(vector<EntryPoint> const & starts, vector<EntryPoint> const & finishes,
+                NumMwmId mwmId, vector<Segment> & path, Joint::Id & startJoint,
+                Joint::Id & finishJoint) const;
+
+  template <class Sink>
+  void Serialize(Sink & sink) const
+  {
+    WriteToSink(sink, kLastVersion);
+    WriteToSink(sink, GetNumJoints());
+
+    for (uint32_t const rank : m_ranks)
+      WriteVarUint(sink, rank);
+
+    SerializeEdges(m_forward, m_forwardOffsets, sink);
+    SerializeEdges(m_backward, m_backwardOffsets, sink);
+  }
+
+  template <class Source>
+  void Deserialize(Source & src)
+  {
+    auto const version = ReadPrimitiveFromSource<uint8_t>(src);
+    if (version != kLastVersion)
+    {
+      MYTHROW(CorruptedDataException,
+              ("Unknown joint hierarchy version", version, ", current version", kLastVersion));
+    }
+
+    auto const numJoints = ReadPrimitiveFromSource<uint32_t>(src);
+    m_ranks.resize(numJoints);
+    for (uint32_t i = 0; i < numJoints; ++i)
+      m_ranks[i] = ReadVarUint<uint32_t>(src);
+
+    DeserializeEdges(m_forward, m_forwardOffsets, numJoints, src);
+    DeserializeEdges(m_backward, m_backwardOffsets, numJoints, src);
+  }
+
+private:
+  static uint8_t constexpr kLastVersion = 0;
+  // Weights are serialized as centiseconds.
+  static double constexpr kWeightScale = 100.0;
+
+  template <class Sink>
+  static void SerializeEdges(vector<Edge> const & edges, vector<uint32_t> const & offsets,
+                             Sink & sink)
+  {
+    for (size_t joint = 0; joint + 1 < offsets.size(); ++joint)
+    {
+      WriteVarUint(sink, offsets[joint + 1] - offsets[joint]);
+      for (uint32_t i = offsets[joint]; i < offsets[joint + 1]; ++i)
+      {
+        Edge const & edge = edges[i];
+        WriteVarUint(sink, edge.GetTarget());
+        WriteVarUint(sink, static_cast<uint32_t>(edge.GetWeight() * kWeightScale + 0.5));
+        // 0 is a feature edge marker, via + 1 otherwise.
+        WriteVarUint(sink, edge.IsShortcut() ? edge.GetVia() + 1 : 0);
+        if (edge.IsShortcut())
+          continue;
+
+        WriteVarUint(sink, edge.GetFeatureId());
+        WriteVarUint(sink, edge.GetFromPointId());
+        WriteVarUint(sink, edge.GetToPointId());
+      }
+    }
+  }
+
+  template <class Source>
+  void DeserializeEdges(vector<Edge> & edges, vector<uint32_t> & offsets, uint32_t numJoints,
+                        Source & src)
+  {
+    edges.clear();
+    offsets.assign(numJoints + 1, 0);
+
+    for (uint32_t joint = 0; joint < numJoints; ++joint)
+    {
+      offsets[joint] = base::asserted_cast<uint32_t>(edges.size());
+      uint32_t const count = ReadVarUint<uint32_t>(src);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        Joint::Id const target = ReadVarUint<uint32_t>(src);
+        if (target >= numJoints)
+          MYTHROW(CorruptedDataException, ("Invalid edge target", target, ", joints", numJoints));
+
+        double const weight = ReadVarUint<uint32_t>(src) / kWeightScale;
+        uint32_t const via = ReadVarUint<uint32_t>(src);
+        if (via != 0)
+        {
+          edges.emplace_back(target, weight, via - 1 /* via */);
+          ++m_numShortcuts;
+          continue;
+        }
+
+        uint32_t const featureId = ReadVarUint<uint32_t>(src);
+        uint32_t const fromPointId = ReadVarUint<uint32_t>(src);
+        uint32_t const toPointId = ReadVarUint<uint32_t>(src);
+        edges.emplace_back(target, weight, featureId, fromPointId, toPointId);
+      }
+    }
+
+    offsets[numJoints] = base::asserted_cast<uint32_t>(edges.size());
+  }
+
+  Edge const * FindEdge(vector<Edge> const & edges, vector<uint32_t> const & offsets,
+                        Joint::Id owner, Joint::Id target) const;
+  void UnpackEdge(Joint::Id from, Joint::Id to, Edge const & edge,
+                  vector<Edge const *> & featureEdges) const;
+
+  // Contraction order of each joint: the higher the rank, the more important the joint.
+  vector<uint32_t> m_ranks;
+  // Edges leading to higher ranked joints, flattened by source joint.
+  vector<Edge> m_forward;
+  vector<uint32_t> m_forwardOffsets;
+  // Edges coming from higher ranked joints, flattened by target joint.
+  // Edge target here is the joint the edge starts from.
+  vector<Edge> m_backward;
+  vector<uint32_t> m_backwardOffsets;
+  uint32_t m_numShortcuts = 0;
+};
+}  // namespace routing
@@ -68,6 +68,17 @@ void NearestEdgeFinder::AddInformationSource(FeatureID const & featureId, IRoadG
     m_candidates.push_back(res);
 }
 
+bool NearestEdgeFinder::HasCandidates(size_t count, double squaredDist) const
+{
+  size_t found = 0;
+  for (Candidate const & candidate : m_candidates)
+  {
+    if (candidate.m_dist <= squaredDist && ++found == count)
+      return true;
+  }
+  return false;
+}
+
 void NearestEdgeFinder::MakeResult(vector<pair<Edge, Junction>> & res,
                                    size_t const maxCountFeatures)
 {
@@ -42,6 +42,11 @@ public:
 
   inline bool HasCandidates() const { return !m_candidates.empty(); }
 
+  /// Returns true iff at least |count| candidates with squared
+  /// (mercator) distance to the point not greater than |squaredDist|
+  /// have been added.
+  bool HasCandidates(size_t count, double squaredDist) const;
+
   void AddInformationSource(FeatureID const & featureId, IRoadGraph::RoadInfo const & roadInfo);
 
   void MakeResult(vector<pair<Edge, Junction>> & res, size_t const maxCountFeatures);
@@ -0,0 +1,55 @@
+#include "routing/restriction_index.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/utility.hpp"
+
+namespace routing
+{
+void RestrictionIndex::Build(RestrictionVec const & restrictions)
+{
+  vector<pair<uint32_t, uint32_t>> pairs;
+  pairs.reserve(restrictions.size());
+  for (Restriction const & restriction : restrictions)
+  {
+    // Restrictions with more than two links are not matched on edge
+    // expansion, see IsRestricted() in index_graph.cpp, so there's no
+    // point in keeping them resident.
+    if (restriction.m_type != Restriction::Type::No || restriction.m_featureIds.size() != 2)
+      continue;
+    pairs.emplace_back(restriction.m_featureIds[0], restriction.m_featureIds[1]);
+  }
+
+  sort(pairs.begin(), pairs.end());
+  pairs.erase(unique(pairs.begin(), pairs.end()), pairs.end());
+
+  m_from.clear();
+  m_to.clear();
+  m_from.reserve(pairs.size());
+  m_to.reserve(pairs.size());
+
+  vector<uint64_t> bitPositions;
+  for (auto const & p : pairs)
+  {
+    m_from.push_back(p.first);
+    m_to.push_back(p.second);
+    if (bitPositions.empty() || bitPositions.back() != p.first)
+      bitPositions.push_back(p.first);
+  }
+
+  if (pairs.empty())
+    m_fromBits.reset();
+  else
+    m_fromBits = coding::CompressedBitVectorBuilder::FromBitPositions(move(bitPositions));
+}
+
+bool RestrictionIndex::IsRestricted(uint32_t featureIdFrom, uint32_t featureIdTo) const
+{
+  if (!m_fromBits || !m_fromBits->GetBit(featureIdFrom))
+    return false;
+
+  auto const range = equal_range(m_from.cbegin(), m_from.cend(), featureIdFrom);
+  size_t const lo = distance(m_from.cbegin(), range.first);
+  size_t const hi = distance(m_from.cbegin(), range.second);
+  return binary_search(m_to.cbegin() + lo, m_to.cbegin() + hi, featureIdTo);
+}
+}  // namespace routing
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "routing/restrictions_serialization.hpp"
+
+#include "coding/compressed_bit_vector.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/unique_ptr.hpp"
+#include "std/vector.hpp"
+
+namespace routing
+{
+// Succinct in-memory form of pairwise "No" restrictions.
+//
+// RestrictionVec keeps a heap allocated vector of links per restriction which
+// costs tens of MB for restriction-dense European maps. Only pairwise "No"
+// restrictions are matched on edge expansion ("Only" ones are converted to
+// pairwise "No" by the restriction loader), so the index keeps them as two
+// parallel sorted id arrays plus a compressed bit vector over the first
+// feature ids which skips the binary search for the vast majority of edges.
+class RestrictionIndex final
+{
+public:
+  void Build(RestrictionVec const & restrictions);
+
+  bool IsRestricted(uint32_t featureIdFrom, uint32_t featureIdTo) const;
+
+  bool IsEmpty() const { return m_from.empty(); }
+  size_t GetNumRestrictions() const { return m_from.size(); }
+
+private:
+  // Parallel arrays of restriction pairs sorted by (from, to).
+  vector<uint32_t> m_from;
+  vector<uint32_t> m_to;
+  // Membership of feature ids in |m_from| or nullptr if the index is empty.
+  unique_ptr<coding::CompressedBitVector> m_fromBits;
+};
+}  // namespace routing
@@ -1,9 +1,45 @@
 #include "routing/road_access.hpp"
 
+#include "base/assert.hpp"
+
+#include <algorithm>
 #include <sstream>
+#include <utility>
 
 namespace routing
 {
+void RoadAccess::SetPrivateRoads(std::vector<uint32_t> && v)
+{
+  ASSERT(std::is_sorted(v.cbegin(), v.cend()), ());
+  m_privateRoads = std::move(v);
+
+  if (m_privateRoads.empty())
+  {
+    m_privateRoadsBits.reset();
+    return;
+  }
+
+  std::vector<uint64_t> bitPositions(m_privateRoads.cbegin(), m_privateRoads.cend());
+  m_privateRoadsBits = coding::CompressedBitVectorBuilder::FromBitPositions(move(bitPositions));
+}
+
+bool RoadAccess::IsPrivateRoad(uint32_t featureId) const
+{
+  return m_privateRoadsBits && m_privateRoadsBits->GetBit(featureId);
+}
+
+void RoadAccess::Clear()
+{
+  m_privateRoads.clear();
+  m_privateRoadsBits.reset();
+}
+
+void RoadAccess::Swap(RoadAccess & rhs)
+{
+  m_privateRoads.swap(rhs.m_privateRoads);
+  m_privateRoadsBits.swap(rhs.m_privateRoadsBits);
+}
+
 std::string DebugPrint(RoadAccess const & r)
 {
   size_t const kMaxIdsToShow = 10;
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "coding/compressed_bit_vector.hpp"
+
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,18 +17,25 @@ class RoadAccess final
 public:
   std::vector<uint32_t> const & GetPrivateRoads() const { return m_privateRoads; }
 
-  template <typename V>
-  void SetPrivateRoads(V && v) { m_privateRoads = std::forward<V>(v); }
+  // |v| should be sorted.
+  void SetPrivateRoads(std::vector<uint32_t> && v);
+
+  // Returns true if the feature is not allowed for through passage.
+  bool IsPrivateRoad(uint32_t featureId) const;
 
-  void Clear() { m_privateRoads.clear(); }
+  void Clear();
 
-  void Swap(RoadAccess & rhs) { m_privateRoads.swap(rhs.m_privateRoads); }
+  void Swap(RoadAccess & rhs);
 
   bool operator==(RoadAccess const & rhs) const { return m_privateRoads == rhs.m_privateRoads; }
 
 private:
-  // Feature ids of blocked features in the corresponding mwm.
+  // Sorted feature ids of blocked features in the corresponding mwm.
+  // The source for serialization.
   std::vector<uint32_t> m_privateRoads;
+  // Membership structure over |m_privateRoads| for queries on edge expansion,
+  // nullptr if there are no private roads.
+  std::unique_ptr<coding::CompressedBitVector> m_privateRoadsBits;
 };
 
 std::string DebugPrint(RoadAccess const & r);
@@ -0,0 +1,76 @@
+#include "routing/route_corpus.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+char const kRecordEnvVar[] = "MWM_ROUTE_CORPUS_RECORD";
+
+bool ParseRouteRequestRecord(std::string const & line, routing::RouteRequestRecord & record)
+{
+  strings::SimpleTokenizer iter(line, " \t");
+  if (!iter)
+    return false;
+
+  record.m_profile = *iter;
+  if (record.m_profile.empty() || record.m_profile[0] == '#')
+    return false;
+
+  double coords[4];
+  for (size_t i = 0; i < 4; ++i)
+  {
+    if (!++iter || !strings::to_double(*iter, coords[i]))
+      return false;
+  }
+
+  record.m_start = m2::PointD(coords[0], coords[1]);
+  record.m_finish = m2::PointD(coords[2], coords[3]);
+  return true;
+}
+}  // namespace
+
+namespace routing
+{
+bool LoadRouteRequestCorpus(std::string const & filePath, std::vector<RouteRequestRecord> & records)
+{
+  std::ifstream stream(filePath);
+  if (!stream.is_open())
+    return false;
+
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    RouteRequestRecord record;
+    if (ParseRouteRequestRecord(line, record))
+      records.push_back(record);
+  }
+  return true;
+}
+
+bool SaveRouteRequestRecord(std::string const & filePath, RouteRequestRecord const & record)
+{
+  std::ofstream stream(filePath, std::ios::app);
+  if (!stream.is_open())
+    return false;
+
+  stream << record.m_profile << " " << std::setprecision(17) << record.m_start.x << " "
+         << record.m_start.y << " " << record.m_finish.x << " " << record.m_finish.y << "\n";
+  return static_cast<bool>(stream);
+}
+
+void RecordRouteRequest(RouteRequestRecord const & record)
+{
+  char const * filePath = std::getenv(kRecordEnvVar);
+  if (filePath == nullptr)
+    return;
+
+  if (!SaveRouteRequestRecord(filePath, record))
+    LOG(LWARNING, ("Can't record a route request to", filePath));
+}
+}  // namespace routing
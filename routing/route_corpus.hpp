@@ -0,0 +1,42 @@
+#pragma once
+
+#include "geometry/point2d.hpp"
+
+#include <string>
+#include <vector>
+
+namespace routing
+{
+// One anonymized route request: endpoints in mercator and the profile
+// name (see ToString(RouterType)). No user id, no timestamp, nothing
+// else is ever written.
+struct RouteRequestRecord
+{
+  RouteRequestRecord() = default;
+
+  RouteRequestRecord(m2::PointD const & start, m2::PointD const & finish,
+                     std::string const & profile)
+    : m_start(start), m_finish(finish), m_profile(profile)
+  {
+  }
+
+  m2::PointD m_start = m2::PointD::Zero();
+  m2::PointD m_finish = m2::PointD::Zero();
+  std::string m_profile;
+};
+
+// A corpus is a plain text file with one record per line:
+//   <profile> <startX> <startY> <finishX> <finishY>
+// Lines which can't be parsed (including comments starting with '#')
+// are skipped on load, so corpora from different app versions stay
+// replayable.
+bool LoadRouteRequestCorpus(std::string const & filePath,
+                            std::vector<RouteRequestRecord> & records);
+bool SaveRouteRequestRecord(std::string const & filePath, RouteRequestRecord const & record);
+
+// Appends |record| to the corpus file named by the MWM_ROUTE_CORPUS_RECORD
+// environment variable. Does nothing if the variable is not set, so the
+// call is free on user devices; the file is replayed by the
+// routing_benchmarks corpus runner.
+void RecordRouteRequest(RouteRequestRecord const & record);
+}  // namespace routing
@@ -24,16 +24,19 @@ SOURCES += \
     cross_mwm_router.cpp \
     cross_routing_context.cpp \
     directions_engine.cpp \
+    distance_matrix.cpp \
     edge_estimator.cpp \
     features_road_graph.cpp \
     geometry.cpp \
     index_graph.cpp \
+    index_graph_cache.cpp \
     index_graph_loader.cpp \
     index_graph_serialization.cpp \
     index_graph_starter.cpp \
     index_road_graph.cpp \
     index_router.cpp \
     joint.cpp \
+    joint_hierarchy.cpp \
     joint_index.cpp \
     nearest_edge_finder.cpp \
     online_absent_fetcher.cpp \
@@ -45,18 +48,21 @@ SOURCES += \
     pedestrian_directions.cpp \
     road_access.cpp \
     road_access_serialization.cpp \
+    restriction_index.cpp \
     restriction_loader.cpp \
     restrictions_serialization.cpp \
     road_graph.cpp \
     road_graph_router.cpp \
     road_index.cpp \
     route.cpp \
+    route_corpus.cpp \
     router.cpp \
     router_delegate.cpp \
     routing_algorithm.cpp \
     routing_helpers.cpp \
     routing_mapping.cpp \
     routing_session.cpp \
+    segment_weights.cpp \
     speed_camera.cpp \
     turns.cpp \
     turns_generator.cpp \
@@ -78,16 +84,19 @@ HEADERS += \
     cross_mwm_router.hpp \
     cross_routing_context.hpp \
     directions_engine.hpp \
+    distance_matrix.hpp \
     edge_estimator.hpp \
     features_road_graph.hpp \
     geometry.hpp \
     index_graph.hpp \
+    index_graph_cache.hpp \
     index_graph_loader.hpp \
     index_graph_serialization.hpp \
     index_graph_starter.hpp \
     index_road_graph.hpp \
     index_router.hpp \
     joint.hpp \
+    joint_hierarchy.hpp \
     joint_index.hpp \
     loaded_path_segment.hpp \
     nearest_edge_finder.hpp \
@@ -100,6 +109,7 @@ HEADERS += \
     osrm_helpers.hpp \
     osrm_path_segment_factory.hpp \
     pedestrian_directions.hpp \
+    restriction_index.hpp \
     restriction_loader.hpp \
     restrictions_serialization.hpp \
     road_access.hpp \
@@ -109,6 +119,7 @@ HEADERS += \
     road_index.hpp \
     road_point.hpp \
     route.hpp \
+    route_corpus.hpp \
     route_point.hpp \
     router.hpp \
     router_delegate.hpp \
@@ -120,6 +131,7 @@ HEADERS += \
     routing_session.hpp \
     routing_settings.hpp \
     segment.hpp \
+    segment_weights.hpp \
     speed_camera.hpp \
     traffic_stash.hpp \
     turn_candidate.hpp \
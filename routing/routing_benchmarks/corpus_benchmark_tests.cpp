@@ -0,0 +1,294 @@
+#include "testing/testing.hpp"
+
+#include "routing/features_road_graph.hpp"
+#include "routing/road_graph.hpp"
+#include "routing/road_graph_router.hpp"
+#include "routing/route.hpp"
+#include "routing/route_corpus.hpp"
+#include "routing/router.hpp"
+#include "routing/router_delegate.hpp"
+
+#include "routing_common/bicycle_model.hpp"
+#include "routing_common/pedestrian_model.hpp"
+
+#include "storage/country_info_getter.hpp"
+
+#include "indexer/classificator_loader.hpp"
+#include "indexer/index.hpp"
+
+#include "platform/local_country_file.hpp"
+#include "platform/local_country_file_utils.hpp"
+#include "platform/platform.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+#include "base/timer.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/cstdlib.hpp"
+#include "std/fstream.hpp"
+#include "std/limits.hpp"
+#include "std/map.hpp"
+#include "std/sstream.hpp"
+#include "std/string.hpp"
+#include "std/unique_ptr.hpp"
+#include "std/utility.hpp"
+#include "std/vector.hpp"
+
+using namespace routing;
+
+namespace
+{
+// Test preconditions: the MWM_ROUTE_CORPUS environment variable names a
+// corpus file recorded by the app (see routing/route_corpus.hpp) and
+// the mwm files covering the recorded requests are placed in omim/data.
+// Optionally MWM_ROUTE_CORPUS_RESULTS names a file to write per-request
+// timings to and MWM_ROUTE_CORPUS_BASELINE names such a file written by
+// another build to compare against.
+char const kCorpusEnvVar[] = "MWM_ROUTE_CORPUS";
+char const kResultsEnvVar[] = "MWM_ROUTE_CORPUS_RESULTS";
+char const kBaselineEnvVar[] = "MWM_ROUTE_CORPUS_BASELINE";
+
+struct ReplayResult
+{
+  size_t m_index = 0;
+  string m_profile;
+  bool m_success = false;
+  double m_snapSec = 0.0;   // Snapping both endpoints to the road graph.
+  double m_routeSec = 0.0;  // Route search, reconstruction and turn generation.
+};
+
+double Percentile(vector<double> const & sorted, double percent)
+{
+  ASSERT(!sorted.empty(), ());
+  size_t const i = static_cast<size_t>(percent * (sorted.size() - 1) / 100.0 + 0.5);
+  return sorted[min(i, sorted.size() - 1)];
+}
+
+void ReportPercentiles(string const & phase, vector<double> timings)
+{
+  if (timings.empty())
+    return;
+  sort(timings.begin(), timings.end());
+  LOG(LINFO, (phase, "seconds, count:", timings.size(), "p50:", Percentile(timings, 50.0),
+              "p90:", Percentile(timings, 90.0), "p95:", Percentile(timings, 95.0),
+              "p99:", Percentile(timings, 99.0), "max:", timings.back()));
+}
+
+// Runs recorded route requests against all locally available maps with
+// the same routers the app uses. Routers and road graphs are reused
+// between requests, as in a live session.
+class CorpusRunner
+{
+public:
+  CorpusRunner()
+  {
+    classificator::Load();
+
+    Platform & platform = GetPlatform();
+    m_cig = storage::CountryInfoReader::CreateCountryInfoReader(platform);
+
+    vector<platform::LocalCountryFile> localFiles;
+    platform::FindAllLocalMapsAndCleanup(numeric_limits<int64_t>::max(), localFiles);
+    for (auto const & localFile : localFiles)
+      UNUSED_VALUE(m_index.RegisterMap(localFile));
+    TEST(!localFiles.empty(), ("Corpus replay needs mwm files in omim/data."));
+  }
+
+  void Replay(vector<RouteRequestRecord> const & records, vector<ReplayResult> & results)
+  {
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+      RouteRequestRecord const & record = records[i];
+
+      ReplayResult result;
+      result.m_index = i;
+      result.m_profile = strings::MakeLowerCase(record.m_profile);
+
+      IRouter * router = GetRouter(result.m_profile);
+      if (router == nullptr)
+      {
+        LOG(LINFO, ("Skipping record", i, "with unsupported profile:", record.m_profile));
+        continue;
+      }
+
+      {
+        my::Timer timer;
+        vector<pair<Edge, Junction>> edges;
+        m_graphs[result.m_profile]->FindClosestEdges(record.m_start, 1 /* count */, edges);
+        edges.clear();
+        m_graphs[result.m_profile]->FindClosestEdges(record.m_finish, 1 /* count */, edges);
+        result.m_snapSec = timer.ElapsedSeconds();
+      }
+
+      {
+        RouterDelegate delegate;
+        Route route("");
+        my::Timer timer;
+        IRouter::ResultCode const code = router->CalculateRoute(
+            record.m_start, m2::PointD::Zero() /* startDirection */, record.m_finish, delegate,
+            route);
+        result.m_routeSec = timer.ElapsedSeconds();
+        result.m_success = (code == IRouter::NoError);
+        if (!result.m_success)
+          LOG(LINFO, ("Record", i, "failed with code:", code));
+      }
+
+      results.push_back(result);
+    }
+  }
+
+private:
+  // Returns a router for |profile| or nullptr if the profile can't be
+  // replayed in this suite. Car routing needs OSRM data files, so only
+  // the road graph profiles are supported here.
+  IRouter * GetRouter(string const & profile)
+  {
+    auto const it = m_routers.find(profile);
+    if (it != m_routers.end())
+      return it->second.get();
+
+    auto countryFileGetter = [this](m2::PointD const & pt) {
+      return m_cig->GetRegionCountryId(pt);
+    };
+
+    unique_ptr<IRouter> router;
+    unique_ptr<FeaturesRoadGraph> graph;
+    if (profile == "pedestrian")
+    {
+      router = CreatePedestrianAStarBidirectionalRouter(m_index, countryFileGetter);
+      graph.reset(new FeaturesRoadGraph(m_index, IRoadGraph::Mode::IgnoreOnewayTag,
+                                        make_unique<PedestrianModelFactory>()));
+    }
+    else if (profile == "bicycle")
+    {
+      router = CreateBicycleAStarBidirectionalRouter(m_index, countryFileGetter);
+      graph.reset(new FeaturesRoadGraph(m_index, IRoadGraph::Mode::ObeyOnewayTag,
+                                        make_unique<BicycleModelFactory>()));
+    }
+
+    if (!router)
+      return nullptr;
+
+    m_graphs[profile] = move(graph);
+    return (m_routers[profile] = move(router)).get();
+  }
+
+  Index m_index;
+  unique_ptr<storage::CountryInfoGetter> m_cig;
+  map<string, unique_ptr<IRouter>> m_routers;
+  map<string, unique_ptr<FeaturesRoadGraph>> m_graphs;
+};
+
+void SaveResults(string const & filePath, vector<ReplayResult> const & results)
+{
+  ofstream stream(filePath);
+  TEST(stream.is_open(), ("Can't write the results file", filePath));
+  for (auto const & result : results)
+  {
+    stream << result.m_index << " " << result.m_profile << " " << (result.m_success ? 1 : 0)
+           << " " << result.m_snapSec << " " << result.m_routeSec << "\n";
+  }
+}
+
+bool ParseResultLine(string const & line, ReplayResult & result)
+{
+  istringstream stream(line);
+  int success = 0;
+  if (!(stream >> result.m_index >> result.m_profile >> success >> result.m_snapSec >>
+        result.m_routeSec))
+    return false;
+  result.m_success = (success != 0);
+  return true;
+}
+
+// Compares timings against a results file written by another build.
+// Only requests successful in both runs are compared.
+void CompareWithBaseline(string const & filePath, vector<ReplayResult> const & results)
+{
+  map<pair<size_t, string>, ReplayResult> baseline;
+  {
+    ifstream stream(filePath);
+    TEST(stream.is_open(), ("Can't read the baseline file", filePath));
+    string line;
+    while (getline(stream, line))
+    {
+      ReplayResult result;
+      if (ParseResultLine(line, result))
+        baseline[make_pair(result.m_index, result.m_profile)] = result;
+    }
+  }
+
+  vector<double> snap, route, baselineSnap, baselineRoute;
+  double totalSec = 0.0;
+  double baselineTotalSec = 0.0;
+  for (auto const & result : results)
+  {
+    auto const it = baseline.find(make_pair(result.m_index, result.m_profile));
+    if (it == baseline.end() || !result.m_success || !it->second.m_success)
+      continue;
+    snap.push_back(result.m_snapSec);
+    route.push_back(result.m_routeSec);
+    baselineSnap.push_back(it->second.m_snapSec);
+    baselineRoute.push_back(it->second.m_routeSec);
+    totalSec += result.m_snapSec + result.m_routeSec;
+    baselineTotalSec += it->second.m_snapSec + it->second.m_routeSec;
+  }
+
+  LOG(LINFO, ("Comparing", snap.size(), "requests against the baseline", filePath));
+  if (snap.empty())
+    return;
+  ReportPercentiles("Baseline snap", baselineSnap);
+  ReportPercentiles("Current snap", snap);
+  ReportPercentiles("Baseline route", baselineRoute);
+  ReportPercentiles("Current route", route);
+  LOG(LINFO, ("Total seconds, baseline:", baselineTotalSec, "current:", totalSec,
+              "ratio:", totalSec / baselineTotalSec));
+}
+}  // namespace
+
+UNIT_TEST(RouteCorpusBenchmark)
+{
+  char const * corpusPath = getenv(kCorpusEnvVar);
+  if (corpusPath == nullptr)
+  {
+    LOG(LINFO, ("Set", kCorpusEnvVar, "to a recorded corpus file to run the benchmark. Skipped."));
+    return;
+  }
+
+  vector<RouteRequestRecord> records;
+  TEST(LoadRouteRequestCorpus(corpusPath, records), ("Can't read the corpus file", corpusPath));
+  TEST(!records.empty(), ("The corpus file is empty:", corpusPath));
+  LOG(LINFO, ("Replaying", records.size(), "recorded route requests from", corpusPath));
+
+  CorpusRunner runner;
+  vector<ReplayResult> results;
+  runner.Replay(records, results);
+
+  map<string, vector<double>> snapByProfile, routeByProfile;
+  size_t failures = 0;
+  for (auto const & result : results)
+  {
+    if (!result.m_success)
+    {
+      ++failures;
+      continue;
+    }
+    snapByProfile[result.m_profile].push_back(result.m_snapSec);
+    routeByProfile[result.m_profile].push_back(result.m_routeSec);
+  }
+
+  LOG(LINFO, ("Replayed:", results.size(), "failed:", failures));
+  for (auto const & profileTimings : snapByProfile)
+    ReportPercentiles(profileTimings.first + " snap", profileTimings.second);
+  for (auto const & profileTimings : routeByProfile)
+    ReportPercentiles(profileTimings.first + " route", profileTimings.second);
+
+  char const * resultsPath = getenv(kResultsEnvVar);
+  if (resultsPath != nullptr)
+    SaveResults(resultsPath, results);
+
+  char const * baselinePath = getenv(kBaselineEnvVar);
+  if (baselinePath != nullptr)
+    CompareWithBaseline(baselinePath, results);
+}
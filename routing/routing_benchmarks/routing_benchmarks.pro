@@ -24,6 +24,7 @@ win32*|linux* {
 SOURCES += \
   ../../testing/testingmain.cpp \
   bicycle_routing_tests.cpp \
+  corpus_benchmark_tests.cpp \
   helpers.cpp \
   pedestrian_routing_tests.cpp \
 
@@ -174,6 +174,7 @@ void RoutingSession::Reset()
   m_lastWarnedSpeedCameraIndex = 0;
   m_lastCheckedSpeedCameraIndex = 0;
   m_lastFoundCamera = SpeedCameraRestriction();
+  m_speedCameraIndex.Clear();
   m_speedWarningSignal = false;
   m_isFollowing = false;
   m_lastCompletionPercent = 0;
@@ -417,6 +418,7 @@ void RoutingSession::AssignRoute(Route & route, IRouter::ResultCode e)
   m_lastWarnedSpeedCameraIndex = 0;
   m_lastCheckedSpeedCameraIndex = 0;
   m_lastFoundCamera = SpeedCameraRestriction();
+  m_speedCameraIndex.Clear();
 }
 
 void RoutingSession::SetRouter(unique_ptr<IRouter> && router,
@@ -427,6 +429,12 @@ void RoutingSession::SetRouter(unique_ptr<IRouter> && router,
   m_router->SetRouter(move(router), move(fetcher));
 }
 
+void RoutingSession::SetSecondaryRouter(unique_ptr<IRouter> && router)
+{
+  ASSERT(m_router != nullptr, ());
+  m_router->SetSecondaryRouter(move(router));
+}
+
 void RoutingSession::MatchLocationToRoute(location::GpsInfo & location,
                                           location::RouteMatchingInfo & routeMatchingInfo) const
 {
@@ -566,7 +574,8 @@ double RoutingSession::GetDistanceToCurrentCamM(SpeedCameraRestriction & camera,
   size_t const upperBound = min(m_poly.GetPolyline().GetSize(), currentIndex + kSpeedCameraLookAheadCount);
   for (m_lastCheckedSpeedCameraIndex = currentIndex; m_lastCheckedSpeedCameraIndex < upperBound; ++m_lastCheckedSpeedCameraIndex)
   {
-    uint8_t speed = CheckCameraInPoint(m_poly.GetPolyline().GetPoint(m_lastCheckedSpeedCameraIndex), index);
+    uint8_t speed = m_speedCameraIndex.CheckCameraInPoint(
+        m_poly.GetPolyline().GetPoint(m_lastCheckedSpeedCameraIndex), index);
     if (speed != kNoSpeedCamera)
     {
       camera = SpeedCameraRestriction(static_cast<uint32_t>(m_lastCheckedSpeedCameraIndex), speed);
@@ -651,14 +660,14 @@ void RoutingSession::OnTrafficInfoAdded(TrafficInfo && info)
   // The code below is memory optimization. Edges with traffic SpeedGroup::G5 and
   // SpeedGroup::Unknown constitute a large part of all edges but they are not used in routing now.
   // So we don't need to keep the information in TrafficCache.
-  TrafficInfo::Coloring const & fullColoring = info.GetColoring();
   TrafficInfo::Coloring coloring;
-  for (auto const & kv : fullColoring)
-  {
-    ASSERT_NOT_EQUAL(kv.second, SpeedGroup::Unknown, ());
-    if (kv.second != SpeedGroup::G5)
-      coloring.insert(kv);
-  }
+  info.ForEachColoredSegment(
+      [&coloring](TrafficInfo::RoadSegmentId const & id, SpeedGroup group) {
+        ASSERT_NOT_EQUAL(group, SpeedGroup::Unknown, ());
+        // The segments are enumerated in the increasing order of keys.
+        if (group != SpeedGroup::G5)
+          coloring.emplace_hint(coloring.end(), id, group);
+      });
 
   {
     threads::MutexGuard guard(m_routingSessionMutex);
@@ -678,19 +687,6 @@ void RoutingSession::OnTrafficInfoRemoved(MwmSet::MwmId const & mwmId)
   RebuildRouteOnTrafficUpdate();
 }
 
-shared_ptr<TrafficInfo::Coloring> RoutingSession::GetTrafficInfo(MwmSet::MwmId const & mwmId) const
-{
-  threads::MutexGuard guard(m_routingSessionMutex);
-  UNUSED_VALUE(guard);
-  return TrafficCache::GetTrafficInfo(mwmId);
-}
-
-void RoutingSession::CopyTraffic(std::map<MwmSet::MwmId, std::shared_ptr<traffic::TrafficInfo::Coloring>> & trafficColoring) const
-{
-  threads::MutexGuard guard(m_routingSessionMutex);
-  TrafficCache::CopyTraffic(trafficColoring);
-}
-
 string DebugPrint(RoutingSession::State state)
 {
   switch (state)
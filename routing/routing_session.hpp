@@ -3,6 +3,7 @@
 #include "routing/async_router.hpp"
 #include "routing/route.hpp"
 #include "routing/router.hpp"
+#include "routing/speed_camera.hpp"
 #include "routing/turns.hpp"
 #include "routing/turns_notification_manager.hpp"
 
@@ -84,6 +85,9 @@ public:
             RouterDelegate::TPointCheckCallback const & pointCheckCallback);
 
   void SetRouter(unique_ptr<IRouter> && router, unique_ptr<OnlineAbsentCountriesFetcher> && fetcher);
+  /// Sets an optional router used to speculatively calculate the same request
+  /// for the secondary profile. See AsyncRouter::SetSecondaryRouter.
+  void SetSecondaryRouter(unique_ptr<IRouter> && router);
 
   /// @param[in] startPoint and endPoint in mercator
   /// @param[in] timeoutSec timeout in seconds, if zero then there is no timeout
@@ -164,10 +168,6 @@ public:
   void OnTrafficInfoAdded(traffic::TrafficInfo && info) override;
   void OnTrafficInfoRemoved(MwmSet::MwmId const & mwmId) override;
 
-  // TrafficCache overrides:
-  shared_ptr<traffic::TrafficInfo::Coloring> GetTrafficInfo(MwmSet::MwmId const & mwmId) const override;
-  void CopyTraffic(std::map<MwmSet::MwmId, std::shared_ptr<traffic::TrafficInfo::Coloring>> & trafficColoring) const override;
-
 private:
   struct DoReadyCallback
   {
@@ -208,6 +208,8 @@ private:
   SpeedCameraRestriction m_lastFoundCamera;
   // Index of a last point on a route checked for a speed camera.
   size_t m_lastCheckedSpeedCameraIndex;
+  // Block-wise cache of speed cameras around the route.
+  SpeedCameraIndex m_speedCameraIndex;
 
   // TODO (ldragunov) Rewrite UI interop to message queue and avoid mutable.
   /// This field is mutable because it's modified in a constant getter. Note that the notification
@@ -72,6 +72,12 @@ void TestAStar(UndirectedGraph & graph, vector<unsigned> const & expectedRoute,
   TEST_EQUAL(TAlgorithm::Result::OK, algo.FindPathBidirectional(graph, 0u, 4u, actualRoute), ());
   TEST_EQUAL(expectedRoute, actualRoute.path, ());
   TEST_ALMOST_EQUAL_ULPS(expectedDistance, actualRoute.distance, ());
+
+  actualRoute.path.clear();
+  TEST_EQUAL(TAlgorithm::Result::OK,
+             algo.FindPathBidirectionalParallel(graph, 0u, 4u, actualRoute), ());
+  TEST_EQUAL(expectedRoute, actualRoute.path, ());
+  TEST_ALMOST_EQUAL_ULPS(expectedDistance, actualRoute.distance, ());
 }
 
 UNIT_TEST(AStarAlgorithm_Sample)
@@ -0,0 +1,27 @@
+#include "routing/segment_weights.hpp"
+
+namespace routing
+{
+double constexpr SegmentWeights::kWeightScale;
+uint8_t constexpr SegmentWeights::kLastVersion;
+
+void SegmentWeights::AddRoad(uint32_t featureId, vector<uint32_t> && weights)
+{
+  ASSERT(!weights.empty(), ("featureId:", featureId));
+  ASSERT(m_weights.find(featureId) == m_weights.cend(), ("featureId:", featureId));
+  m_weights[featureId] = move(weights);
+}
+
+bool SegmentWeights::Get(uint32_t featureId, uint32_t segmentIdx, double & weight) const
+{
+  auto const it = m_weights.find(featureId);
+  if (it == m_weights.cend())
+    return false;
+
+  if (segmentIdx >= it->second.size())
+    return false;
+
+  weight = it->second[segmentIdx] / kWeightScale;
+  return true;
+}
+}  // namespace routing
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "routing/routing_exceptions.hpp"
+
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/assert.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/cstdint.hpp"
+#include "std/unordered_map.hpp"
+#include "std/vector.hpp"
+
+namespace routing
+{
+// Per-segment traversal times baked into the mwm at generation time.
+//
+// The estimator recomputes DistanceOnEarth per segment per wave expansion —
+// trigonometry in the innermost search loop. Baked weights replace it with a
+// table lookup; live traffic is applied on top as a multiplier only, see
+// IndexGraph::CalcSegmentWeight.
+//
+// Weights are quantized to centiseconds which is well below the accuracy of
+// the estimation itself.
+class SegmentWeights final
+{
+public:
+  // Adds baked weights for all segments of the feature, in segment order.
+  void AddRoad(uint32_t featureId, vector<uint32_t> && weights);
+
+  // Returns false if there is no baked weight for the segment.
+  // |weight| is the traversal time in seconds.
+  bool Get(uint32_t featureId, uint32_t segmentIdx, double & weight) const;
+
+  bool IsEmpty() const { return m_weights.empty(); }
+  size_t GetNumRoads() const { return m_weights.size(); }
+
+  static uint32_t QuantizeWeight(double seconds)
+  {
+    return static_cast<uint32_t>(seconds * kWeightScale + 0.5);
+  }
+
+  template <class Sink>
+  void Serialize(Sink & sink) const
+  {
+    WriteToSink(sink, kLastVersion);
+
+    vector<uint32_t> featureIds;
+    featureIds.reserve(m_weights.size());
+    for (auto const & road : m_weights)
+      featureIds.push_back(road.first);
+    sort(featureIds.begin(), featureIds.end());
+
+    WriteVarUint(sink, static_cast<uint32_t>(featureIds.size()));
+    uint32_t prevId = 0;
+    for (uint32_t const featureId : featureIds)
+    {
+      WriteVarUint(sink, featureId - prevId);
+      prevId = featureId;
+
+      auto const & weights = m_weights.at(featureId);
+      WriteVarUint(sink, static_cast<uint32_t>(weights.size()));
+      for (uint32_t const weight : weights)
+        WriteVarUint(sink, weight);
+    }
+  }
+
+  template <class Source>
+  void Deserialize(Source & src)
+  {
+    uint8_t const version = ReadPrimitiveFromSource<uint8_t>(src);
+    if (version != kLastVersion)
+    {
+      MYTHROW(CorruptedDataException,
+              ("Unknown segment weights version", version, ", expected", kLastVersion));
+    }
+
+    uint32_t const numRoads = ReadVarUint<uint32_t>(src);
+    m_weights.reserve(numRoads);
+
+    uint32_t featureId = 0;
+    for (uint32_t i = 0; i < numRoads; ++i)
+    {
+      featureId += ReadVarUint<uint32_t>(src);
+
+      uint32_t const numSegments = ReadVarUint<uint32_t>(src);
+      vector<uint32_t> weights(numSegments);
+      for (uint32_t j = 0; j < numSegments; ++j)
+        weights[j] = ReadVarUint<uint32_t>(src);
+
+      m_weights[featureId] = move(weights);
+    }
+  }
+
+private:
+  // Weights are stored in centiseconds.
+  static double constexpr kWeightScale = 100.0;
+  static uint8_t constexpr kLastVersion = 0;
+
+  // Feature id to baked segment weights, one per segment.
+  unordered_map<uint32_t, vector<uint32_t>> m_weights;
+};
+}  // namespace routing
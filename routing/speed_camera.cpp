@@ -12,17 +12,20 @@
 #include "base/string_utils.hpp"
 #include "base/math.hpp"
 
+#include "std/cmath.hpp"
 #include "std/limits.hpp"
 
 namespace
 {
-double constexpr kCameraCheckRadiusMeters = 2.0;
 double constexpr kCoordinateEqualityDelta = 0.000001;
-}  // namespace
 
-namespace routing
-{
-uint8_t const kNoSpeedCamera = numeric_limits<uint8_t>::max();
+// Side of a camera grid block in mercator units (~1 km). One
+// ForEachInRect query per block replaces a query per route point.
+double constexpr kBlockSizeMercator = 0.01;
+
+// Soft limit on the number of cached blocks. Navigation moves on, so
+// when the limit is hit the already passed blocks are just dropped.
+size_t constexpr kMaxCachedBlocks = 64;
 
 uint8_t ReadCameraRestriction(FeatureType & ft)
 {
@@ -36,12 +39,49 @@ uint8_t ReadCameraRestriction(FeatureType & ft)
     return result;
   return 0;
 }
+}  // namespace
 
-uint8_t CheckCameraInPoint(m2::PointD const & point, Index const & index)
+namespace routing
 {
-  uint32_t speedLimit = kNoSpeedCamera;
+uint8_t const kNoSpeedCamera = numeric_limits<uint8_t>::max();
+
+uint8_t SpeedCameraIndex::CheckCameraInPoint(m2::PointD const & point, Index const & index)
+{
+  TBlockKey const key(static_cast<int32_t>(floor(point.x / kBlockSizeMercator)),
+                      static_cast<int32_t>(floor(point.y / kBlockSizeMercator)));
+
+  for (Camera const & camera : GetBlock(key, index))
+  {
+    if (my::AlmostEqualAbs(camera.m_center.x, point.x, kCoordinateEqualityDelta) &&
+        my::AlmostEqualAbs(camera.m_center.y, point.y, kCoordinateEqualityDelta))
+      return camera.m_maxSpeedKmH;
+  }
+  return kNoSpeedCamera;
+}
+
+void SpeedCameraIndex::Clear()
+{
+  m_blocks.clear();
+}
+
+vector<SpeedCameraIndex::Camera> const & SpeedCameraIndex::GetBlock(TBlockKey const & key,
+                                                                    Index const & index)
+{
+  auto const it = m_blocks.find(key);
+  if (it != m_blocks.end())
+    return it->second;
+
+  if (m_blocks.size() >= kMaxCachedBlocks)
+    m_blocks.clear();
+
+  vector<Camera> & cameras = m_blocks[key];
+
+  m2::RectD rect(key.first * kBlockSizeMercator, key.second * kBlockSizeMercator,
+                 (key.first + 1) * kBlockSizeMercator, (key.second + 1) * kBlockSizeMercator);
+  // A point near the block border may match a camera right outside of it.
+  rect.Inflate(kCoordinateEqualityDelta, kCoordinateEqualityDelta);
 
-  auto const f = [&point, &speedLimit](FeatureType & ft)
+  auto const f = [&cameras](FeatureType & ft)
   {
     if (ft.GetFeatureType() != feature::GEOM_POINT)
       return;
@@ -50,15 +90,10 @@ uint8_t CheckCameraInPoint(m2::PointD const & point, Index const & index)
     if (!ftypes::IsSpeedCamChecker::Instance()(hl))
       return;
 
-    if (my::AlmostEqualAbs(ft.GetCenter().x, point.x, kCoordinateEqualityDelta) &&
-        my::AlmostEqualAbs(ft.GetCenter().y, point.y, kCoordinateEqualityDelta))
-      speedLimit = ReadCameraRestriction(ft);
+    cameras.push_back({ft.GetCenter(), ReadCameraRestriction(ft)});
   };
 
-  index.ForEachInRect(f,
-                      MercatorBounds::RectByCenterXYAndSizeInMeters(point,
-                                                                    kCameraCheckRadiusMeters),
-                      scales::GetUpperScale());
-  return speedLimit;
+  index.ForEachInRect(f, rect, scales::GetUpperScale());
+  return cameras;
 }
 }  // namespace routing
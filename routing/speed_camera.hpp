@@ -3,6 +3,9 @@
 #include "geometry/point2d.hpp"
 
 #include "std/cstdint.hpp"
+#include "std/map.hpp"
+#include "std/utility.hpp"
+#include "std/vector.hpp"
 
 class Index;
 
@@ -10,5 +13,38 @@ namespace routing
 {
 extern uint8_t const kNoSpeedCamera;
 
-uint8_t CheckCameraInPoint(m2::PointD const & point, Index const & index);
+/// Lazily built spatial-hash grid of speed cameras.
+///
+/// During navigation every point of the route polyline is checked for a
+/// camera. Instead of issuing a tiny ForEachInRect query per point, the
+/// cache scans a whole grid block (~1 km) with one query on first touch
+/// and serves all further lookups inside the block from memory, so a
+/// check costs a single hash probe on the hot path.
+///
+/// The cache holds plain coordinates and speed limits, no mwm handles;
+/// it is dropped together with the rest of the per-route camera state
+/// when a route is (re)built, which also covers mwm updates.
+class SpeedCameraIndex
+{
+public:
+  /// @returns max speed in km/h (0 if it's unknown) if there is a speed
+  /// camera in |point| and kNoSpeedCamera otherwise.
+  uint8_t CheckCameraInPoint(m2::PointD const & point, Index const & index);
+
+  void Clear();
+
+private:
+  struct Camera
+  {
+    m2::PointD m_center;
+    uint8_t m_maxSpeedKmH;
+  };
+
+  /// Integer coordinates of a grid block.
+  using TBlockKey = pair<int32_t, int32_t>;
+
+  vector<Camera> const & GetBlock(TBlockKey const & key, Index const & index);
+
+  map<TBlockKey, vector<Camera>> m_blocks;
+};
 }  // namespace routing
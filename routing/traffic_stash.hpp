@@ -51,9 +51,10 @@ public:
 private:
   void CopyTraffic()
   {
-    std::map<MwmSet::MwmId, std::shared_ptr<traffic::TrafficInfo::Coloring>> copy;
-    m_source.CopyTraffic(copy);
-    for (auto it : copy)
+    // The snapshot is immutable and shared with the cache: no map copy,
+    // only shared pointers to the per-mwm colorings are taken.
+    auto const coloring = m_source.GetTrafficSnapshot();
+    for (auto const & it : *coloring)
     {
       auto const numMwmId = m_numMwmIds->GetId(it.first.GetInfo()->GetLocalFile().GetCountryFile());
       SetColoring(numMwmId, it.second);
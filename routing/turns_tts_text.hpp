@@ -3,7 +3,6 @@
 #include "platform/get_text_by_id.hpp"
 
 #include "std/string.hpp"
-#include "std/unique_ptr.hpp"
 
 namespace routing
 {
@@ -35,7 +34,7 @@ public:
 private:
   string GetTextById(string const & textId) const;
 
-  unique_ptr<platform::GetTextById> m_getCurLang;
+  platform::TGetTextByIdPtr m_getCurLang;
 };
 
 /// Generates text message id about the distance of the notification. For example: In 300 meters.
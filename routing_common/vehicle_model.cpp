@@ -12,12 +12,6 @@
 
 namespace routing
 {
-VehicleModel::AdditionalRoadType::AdditionalRoadType(Classificator const & c,
-                                                     AdditionalRoadTags const & tag)
-  : m_type(c.GetTypeByPath(tag.m_hwtag)), m_speedKMpH(tag.m_speedKMpH)
-{
-}
-
 VehicleModel::VehicleModel(Classificator const & c, InitListT const & speedLimits)
   : m_maxSpeedKMpH(0),
     m_onewayType(c.GetTypeByPath({ "hwtag", "oneway" }))
@@ -34,7 +28,7 @@ void VehicleModel::SetAdditionalRoadTypes(Classificator const & c,
 {
   for (auto const & tag : additionalTags)
   {
-    m_addRoadTypes.emplace_back(c, tag);
+    m_types[c.GetTypeByPath(tag.m_hwtag)] = tag.m_speedKMpH;
     m_maxSpeedKMpH = max(m_maxSpeedKMpH, tag.m_speedKMpH);
   }
 }
@@ -46,8 +40,11 @@ double VehicleModel::GetSpeed(FeatureType const & f) const
   RoadAvailability const restriction = GetRoadAvailability(types);
   if (restriction == RoadAvailability::Available)
     return GetMaxSpeed();
-  if (restriction != RoadAvailability::NotAvailable && HasRoadType(types))
+  if (restriction != RoadAvailability::NotAvailable)
+  {
+    // GetMinTypeSpeed() returns 0.0 if |types| has no road types.
     return GetMinTypeSpeed(types);
+  }
 
   return 0.0 /* Speed */;
 }
@@ -57,14 +54,9 @@ double VehicleModel::GetMinTypeSpeed(feature::TypesHolder const & types) const
   double speed = m_maxSpeedKMpH * 2;
   for (uint32_t t : types)
   {
-    uint32_t const type = ftypes::BaseChecker::PrepareToMatch(t, 2);
-    auto it = m_types.find(type);
-    if (it != m_types.end())
+    auto const it = FindRoadSpeed(t);
+    if (it != m_types.cend())
       speed = min(speed, it->second);
-
-    auto const addRoadInfoIter = FindRoadType(t);
-    if (addRoadInfoIter != m_addRoadTypes.cend())
-      speed = min(speed, addRoadInfoIter->m_speedKMpH);
   }
   if (speed <= m_maxSpeedKMpH)
     return speed;
@@ -106,8 +98,7 @@ bool VehicleModel::IsRoad(FeatureType const & f) const
 
 bool VehicleModel::IsRoadType(uint32_t type) const
 {
-  return FindRoadType(type) != m_addRoadTypes.cend() ||
-         m_types.find(ftypes::BaseChecker::PrepareToMatch(type, 2)) != m_types.end();
+  return FindRoadSpeed(type) != m_types.cend();
 }
 
 IVehicleModel::RoadAvailability VehicleModel::GetRoadAvailability(feature::TypesHolder const & /* types */) const
@@ -115,11 +106,13 @@ IVehicleModel::RoadAvailability VehicleModel::GetRoadAvailability(feature::Types
   return RoadAvailability::Unknown;
 }
 
-vector<VehicleModel::AdditionalRoadType>::const_iterator VehicleModel::FindRoadType(
-    uint32_t type) const
+VehicleModel::TSpeedMap::const_iterator VehicleModel::FindRoadSpeed(uint32_t type) const
 {
-  return find_if(m_addRoadTypes.begin(), m_addRoadTypes.cend(),
-                 [&type](AdditionalRoadType const & t) { return t.m_type == type; });
+  uint32_t const prepared = ftypes::BaseChecker::PrepareToMatch(type, 2);
+  auto const it = m_types.find(prepared);
+  if (it != m_types.cend() || prepared == type)
+    return it;
+  return m_types.find(type);
 }
 
 string DebugPrint(IVehicleModel::RoadAvailability const l)
@@ -74,7 +74,7 @@ public:
 
 public:
 
-  /// @returns true if |m_types| or |m_addRoadTypes| contains |type| and false otherwise.
+  /// @returns true if |m_types| contains |type| and false otherwise.
   bool IsRoadType(uint32_t type) const;
 
   template <class TList>
@@ -114,20 +114,18 @@ protected:
   double m_maxSpeedKMpH;
 
 private:
-  struct AdditionalRoadType
-  {
-    AdditionalRoadType(Classificator const & c, AdditionalRoadTags const & tag);
-
-    bool operator==(AdditionalRoadType const & rhs) const { return m_type == rhs.m_type; }
-    uint32_t const m_type;
-    double const m_speedKMpH;
-  };
+  using TSpeedMap = unordered_map<uint32_t, double>;
 
-  vector<AdditionalRoadType>::const_iterator FindRoadType(uint32_t type) const;
+  // Looks up the speed for a feature type with at most two probes:
+  // by the 2-arity truncation of |type| (road types from the speed limits
+  // list) and, if the truncation differs, by |type| itself (additional
+  // road types are stored by their exact type).
+  TSpeedMap::const_iterator FindRoadSpeed(uint32_t type) const;
 
-  unordered_map<uint32_t, double> m_types;
+  // Precomputed classificator-type -> speed table. All types are known
+  // at model construction, so per-feature lookups need no linear scans.
+  TSpeedMap m_types;
 
-  vector<AdditionalRoadType> m_addRoadTypes;
   uint32_t m_onewayType;
 };
 
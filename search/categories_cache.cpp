@@ -4,6 +4,7 @@
 #include "search/query_params.hpp"
 #include "search/retrieval.hpp"
 
+#include "indexer/categories_cbv.hpp"
 #include "indexer/classificator.hpp"
 #include "indexer/ftypes_matcher.hpp"
 #include "indexer/search_string_utils.hpp"
@@ -38,6 +39,21 @@ CBV CategoriesCache::Load(MwmContext const & context)
 
   auto const & c = classif();
 
+  // Fast path: mwms generated with the categories section carry
+  // precomputed per-type bit vectors which hold exactly the features
+  // the trie would return for the corresponding category tokens, so
+  // the whole trie retrieval can be skipped.
+  if (auto cbvs = CategoriesCBV::Load(context.m_value.m_cont))
+  {
+    CBV result;
+    m_categories.ForEach([&result, &cbvs, &c](uint32_t const type) {
+      auto cbv = cbvs->Take(c.GetIndexForType(type));
+      if (cbv)
+        result = result.Union(CBV(move(cbv)));
+    });
+    return result;
+  }
+
   SearchTrieRequest<strings::LevenshteinDFA> request;
 
   m_categories.ForEach([&request, &c](uint32_t const type) {
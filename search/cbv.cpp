@@ -1,5 +1,8 @@
 #include "search/cbv.hpp"
 
+#include "coding/reader.hpp"
+#include "coding/writer.hpp"
+
 #include "std/limits.hpp"
 #include "std/vector.hpp"
 
@@ -103,6 +106,28 @@ CBV CBV::Take(uint64_t n) const
   return CBV(m_p->LeaveFirstSetNBits(n));
 }
 
+void CBV::Serialize(vector<uint8_t> & buffer) const
+{
+  ASSERT(!IsFull(), ());
+
+  buffer.clear();
+  if (m_p.Get() == nullptr)
+    return;
+
+  MemWriter<vector<uint8_t>> writer(buffer);
+  m_p->Serialize(writer);
+}
+
+// static
+CBV CBV::Deserialize(vector<uint8_t> const & buffer)
+{
+  if (buffer.empty())
+    return CBV();
+
+  MemReader reader(buffer.data(), buffer.size());
+  return CBV(coding::CompressedBitVectorBuilder::DeserializeFromReader(reader));
+}
+
 uint64_t CBV::Hash() const
 {
   if (IsEmpty())
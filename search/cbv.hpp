@@ -6,6 +6,7 @@
 
 #include "std/function.hpp"
 #include "std/utility.hpp"
+#include "std/vector.hpp"
 
 namespace search
 {
@@ -50,6 +51,16 @@ public:
 
   uint64_t Hash() const;
 
+  // Serializes the underlying bit vector into |buffer| (see
+  // coding::CompressedBitVector::Serialize for the format). An empty
+  // bit vector produces an empty buffer.
+  //
+  // @precondition !IsFull()
+  void Serialize(vector<uint8_t> & buffer) const;
+
+  // Restores a bit vector previously saved by Serialize().
+  static CBV Deserialize(vector<uint8_t> const & buffer);
+
 private:
   my::RefCountPtr<coding::CompressedBitVector> m_p;
 
@@ -0,0 +1,24 @@
+#include "search/centers_table_cache.hpp"
+
+#include "indexer/index.hpp"
+
+namespace search
+{
+LazyCentersTable * CentersTableCache::Get(Index const & index, TId const & mwmId)
+{
+  auto const it = m_tables.find(TKey(mwmId));
+  if (it != m_tables.end())
+    return it->second.get();
+
+  TKey handle(index.GetMwmHandleById(mwmId));
+  unique_ptr<LazyCentersTable> table;
+  if (handle.IsAlive())
+    table = make_unique<LazyCentersTable>(*handle.GetValue<MwmValue>());
+
+  return m_tables.emplace(move(handle), move(table)).first->second.get();
+}
+
+void CentersTableCache::Remove(TId const & id) { m_tables.erase(TKey(id)); }
+
+void CentersTableCache::Clear() { m_tables.clear(); }
+}  // namespace search
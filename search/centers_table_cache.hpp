@@ -0,0 +1,50 @@
+#pragma once
+
+#include "search/lazy_centers_table.hpp"
+
+#include "indexer/index.hpp"
+
+#include "base/macros.hpp"
+
+#include "std/map.hpp"
+#include "std/unique_ptr.hpp"
+
+namespace search
+{
+// Cache of per-mwm centers tables. A centers table decodes centers in
+// blocks and keeps the decoded blocks, so one instance must be reused
+// across result batches and queries - otherwise the same blocks are
+// decoded again and again.
+class CentersTableCache
+{
+  using TId = MwmSet::MwmId;
+
+  struct TKey : public MwmSet::MwmHandle
+  {
+    TKey() = default;
+    TKey(TKey &&) = default;
+
+    explicit TKey(TId const & id) { this->m_mwmId = id; }
+    explicit TKey(MwmSet::MwmHandle && handle) : MwmSet::MwmHandle(move(handle)) {}
+  };
+
+public:
+  CentersTableCache() = default;
+
+  /// @returns nullptr when the mwm is not alive.
+  LazyCentersTable * Get(Index const & index, TId const & mwmId);
+
+  void Remove(TId const & id);
+  void Clear();
+
+private:
+  struct Compare
+  {
+    bool operator()(TKey const & r1, TKey const & r2) const { return (r1.GetId() < r2.GetId()); }
+  };
+
+  map<TKey, unique_ptr<LazyCentersTable>, Compare> m_tables;
+
+  DISALLOW_COPY_AND_MOVE(CentersTableCache);
+};
+}  // namespace search
@@ -4,9 +4,23 @@
 #include "search/search_params.hpp"
 
 #include "base/logging.hpp"
+#include "base/timer.hpp"
+
+#include "std/algorithm.hpp"
 
 namespace search
 {
+// Emit at most once per this period while the query is still running.
+// Every delivery hands the listener a full snapshot of the accumulated
+// results (usually copied to the UI thread), so frequent emissions of
+// nearly identical lists are pure overhead.
+double constexpr kMinEmitPeriodSec = 0.1;
+
+// The emit period grows with the time the listener spends consuming a
+// snapshot, so slow consumers (large result lists, busy UI thread)
+// automatically get fewer intermediate updates.
+double constexpr kEmitDeliveryCostFactor = 10.0;
+
 class Emitter
 {
 public:
@@ -14,21 +28,54 @@ public:
   {
     m_onResults = onResults;
     m_results.Clear();
+    m_revision = 0;
+    m_emittedRevision = 0;
+    // The first batch is delivered as soon as it is ready.
+    m_emitPeriodSec = 0.0;
+    m_timer.Reset();
+  }
+
+  inline bool AddResult(Result && res)
+  {
+    if (!m_results.AddResult(move(res)))
+      return false;
+    ++m_revision;
+    return true;
   }
 
-  inline bool AddResult(Result && res) { return m_results.AddResult(move(res)); }
-  inline void AddResultNoChecks(Result && res) { m_results.AddResultNoChecks(move(res)); }
+  inline void AddResultNoChecks(Result && res)
+  {
+    m_results.AddResultNoChecks(move(res));
+    ++m_revision;
+  }
 
+  // Delivers the accumulated results to the listener. Emissions that
+  // have no new results since the previous delivery are skipped, and
+  // intermediate deliveries are rate-limited (see constants above).
+  // The pending results are never lost: they go out with the next
+  // successful Emit() or with Finish().
   inline void Emit()
   {
-    if (m_onResults)
-      m_onResults(m_results);
-    else
+    if (!m_onResults)
+    {
       LOG(LERROR, ("OnResults is not set."));
+      return;
+    }
+
+    if (m_revision == m_emittedRevision || m_timer.ElapsedSeconds() < m_emitPeriodSec)
+      return;
+
+    my::Timer deliveryTimer;
+    m_onResults(m_results);
+
+    m_emittedRevision = m_revision;
+    m_emitPeriodSec = max(kMinEmitPeriodSec, deliveryTimer.ElapsedSeconds() * kEmitDeliveryCostFactor);
+    m_timer.Reset();
   }
 
   inline Results const & GetResults() const { return m_results; }
 
+  // The final delivery is neither skipped nor rate-limited.
   inline void Finish(bool cancelled)
   {
     m_results.SetEndMarker(cancelled);
@@ -41,5 +88,13 @@ public:
 private:
   SearchParams::TOnResults m_onResults;
   Results m_results;
+
+  // Number of results added since Init(); used to skip emissions with
+  // nothing new to show.
+  uint64_t m_revision = 0;
+  uint64_t m_emittedRevision = 0;
+
+  my::Timer m_timer;
+  double m_emitPeriodSec = 0.0;
 };
 }  // namespace search
@@ -1,6 +1,7 @@
 #include "search/engine.hpp"
 
 #include "search/geometry_utils.hpp"
+#include "search/hotels_filter.hpp"
 #include "search/processor.hpp"
 #include "search/search_params.hpp"
 
@@ -93,7 +94,7 @@ Engine::Params::Params(string const & locale, size_t numThreads)
 Engine::Engine(Index & index, CategoriesHolder const & categories,
                storage::CountryInfoGetter const & infoGetter, unique_ptr<ProcessorFactory> factory,
                Params const & params)
-  : m_shutdown(false)
+  : m_shutdown(false), m_viewportPolicy(params.m_viewportPolicy)
 {
   InitSuggestions doInit;
   categories.ForEachName(bind<void>(ref(doInit), _1));
@@ -126,10 +127,52 @@ Engine::~Engine()
 
 weak_ptr<ProcessorHandle> Engine::Search(SearchParams const & params, m2::RectD const & viewport)
 {
+  bool debounce = false;
+  if (params.m_mode == Mode::Viewport && !params.m_forceSearch)
+  {
+    {
+      lock_guard<mutex> lock(m_mu);
+      if (!m_lastViewportParamsValid || !m_lastViewportParams.IsEqualCommon(params) ||
+          !hotels_filter::Rule::IsIdentical(m_lastViewportParams.m_hotelsFilter,
+                                            params.m_hotelsFilter))
+      {
+        m_viewportPolicy.Reset();
+      }
+      m_lastViewportParams = params;
+      m_lastViewportParamsValid = true;
+    }
+
+    switch (m_viewportPolicy.OnQueryPosted(viewport))
+    {
+    case ViewportSearchPolicy::Action::Reuse:
+      // Previous results still cover the viewport, there is nothing to
+      // recompute and the client keeps what it has.
+      return weak_ptr<ProcessorHandle>();
+    case ViewportSearchPolicy::Action::Debounce: debounce = true; break;
+    case ViewportSearchPolicy::Action::Process: break;
+    }
+  }
+
   shared_ptr<ProcessorHandle> handle(new ProcessorHandle());
-  PostMessage(Message::TYPE_TASK, [this, params, viewport, handle](Processor & processor)
+
+  uint64_t generation = 0;
+  {
+    lock_guard<mutex> lock(m_mu);
+    auto & slot = m_querySlots[params.m_mode];
+    generation = ++slot.m_generation;
+
+    // The new query supersedes the previous one of the same mode -
+    // interrupt it right away instead of waiting for the client to
+    // cancel its handle.
+    if (auto prev = slot.m_handle.lock())
+      prev->Cancel();
+    slot.m_handle = handle;
+  }
+
+  PostMessage(Message::TYPE_TASK,
+              [this, params, viewport, handle, generation, debounce](Processor & processor)
               {
-                DoSearch(params, viewport, handle, processor);
+                DoSearch(params, viewport, handle, generation, debounce, processor);
               });
   return handle;
 }
@@ -224,11 +267,25 @@ void Engine::PostMessage(TArgs &&... args)
   m_cv.notify_one();
 }
 
+bool Engine::IsSuperseded(Mode mode, uint64_t generation)
+{
+  lock_guard<mutex> lock(m_mu);
+  auto const it = m_querySlots.find(mode);
+  return it != m_querySlots.end() && it->second.m_generation != generation;
+}
+
 void Engine::DoSearch(SearchParams const & params, m2::RectD const & viewport,
-                      shared_ptr<ProcessorHandle> handle, Processor & processor)
+                      shared_ptr<ProcessorHandle> handle, uint64_t generation, bool debounce,
+                      Processor & processor)
 {
   bool const viewportSearch = params.m_mode == Mode::Viewport;
 
+  // A debounced query was posted while the viewport was still moving
+  // fast. Wait for the movement to settle: if a newer query arrives
+  // during the pause, this one is dropped by the supersession check.
+  if (debounce)
+    threads::Sleep(m_viewportPolicy.GetDebounceIntervalMs());
+
   processor.Reset();
   processor.Init(viewportSearch);
   handle->Attach(processor);
@@ -237,8 +294,9 @@ void Engine::DoSearch(SearchParams const & params, m2::RectD const & viewport,
                    handle->Detach();
                  });
 
-  // Early exit when query processing is cancelled.
-  if (processor.IsCancelled())
+  // Early exit when query processing is cancelled or the query was
+  // superseded by a newer one while waiting in the queue.
+  if (IsSuperseded(params.m_mode, generation) || processor.IsCancelled())
   {
     Results results;
     results.SetEndMarker(true /* isCancelled */);
@@ -251,5 +309,8 @@ void Engine::DoSearch(SearchParams const & params, m2::RectD const & viewport,
   }
 
   processor.Search(params, viewport);
+
+  if (viewportSearch && !processor.IsCancelled())
+    m_viewportPolicy.OnQueryProcessed(viewport);
 }
 }  // namespace search
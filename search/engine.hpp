@@ -1,9 +1,11 @@
 #pragma once
 
+#include "search/mode.hpp"
 #include "search/processor_factory.hpp"
 #include "search/result.hpp"
 #include "search/search_params.hpp"
 #include "search/suggest.hpp"
+#include "search/viewport_search_policy.hpp"
 
 #include "indexer/categories_holder.hpp"
 
@@ -18,6 +20,7 @@
 #include "std/atomic.hpp"
 #include "std/condition_variable.hpp"
 #include "std/function.hpp"
+#include "std/map.hpp"
 #include "std/mutex.hpp"
 #include "std/queue.hpp"
 #include "std/string.hpp"
@@ -89,6 +92,9 @@ public:
     // to process queries. Use this field wisely as large values may
     // negatively affect performance due to false sharing.
     size_t m_numThreads;
+
+    // Controls throttling of viewport-driven search requests.
+    ViewportSearchPolicy::Params m_viewportPolicy;
   };
 
   // Doesn't take ownership of index and categories.
@@ -143,6 +149,16 @@ private:
     unique_ptr<Processor> m_processor;
   };
 
+  // The most recent query for each search mode. Posting a new query
+  // supersedes the previous one of the same mode: the in-flight
+  // processor is cancelled right away, and a still-queued task skips
+  // all processing when its turn comes.
+  struct QuerySlot
+  {
+    uint64_t m_generation = 0;
+    weak_ptr<ProcessorHandle> m_handle;
+  };
+
   // *ALL* following methods are executed on the m_threads threads.
 
   // This method executes tasks from a common pool (|tasks|) in a FIFO
@@ -155,7 +171,12 @@ private:
   void PostMessage(TArgs &&... args);
 
   void DoSearch(SearchParams const & params, m2::RectD const & viewport,
-                shared_ptr<ProcessorHandle> handle, Processor & processor);
+                shared_ptr<ProcessorHandle> handle, uint64_t generation, bool debounce,
+                Processor & processor);
+
+  // Returns true iff a newer query of the same |mode| was posted after
+  // the query denoted by |generation|.
+  bool IsSuperseded(Mode mode, uint64_t generation);
 
   vector<Suggest> m_suggests;
 
@@ -166,5 +187,15 @@ private:
   queue<Message> m_messages;
   vector<Context> m_contexts;
   vector<threads::SimpleThread> m_threads;
+
+  // Guarded by |m_mu|.
+  map<Mode, QuerySlot> m_querySlots;
+
+  ViewportSearchPolicy m_viewportPolicy;
+
+  // The last posted viewport query, used to detect when previous
+  // results become unusable. Guarded by |m_mu|.
+  SearchParams m_lastViewportParams;
+  bool m_lastViewportParamsValid = false;
 };
 }  // namespace search
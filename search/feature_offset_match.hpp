@@ -49,50 +49,79 @@ bool FindLangIndex(trie::Iterator<ValueList<Value>> const & trieRoot, uint8_t la
 }
 }  // namespace
 
+// Matches all |dfas| in a single pass over the trie. A node is parsed (and
+// its value list decoded) exactly once, no matter how many DFAs are still
+// alive on it, and a subtree is skipped as soon as every DFA rejects it.
+// The one-traversal-per-DFA approach used to dominate allocation profiles
+// of prefix queries: every traversal re-created a node object and decoded
+// the same value bit vectors again.
 template <typename Value, typename DFA, typename ToDo>
 bool MatchInTrie(trie::Iterator<ValueList<Value>> const & trieRoot,
-                 strings::UniChar const * rootPrefix, size_t rootPrefixSize, DFA const & dfa,
-                 ToDo && toDo)
+                 strings::UniChar const * rootPrefix, size_t rootPrefixSize,
+                 vector<DFA> const & dfas, ToDo && toDo)
 {
-  using TrieDFAIt = shared_ptr<trie::Iterator<ValueList<Value>>>;
+  using TrieIt = trie::Iterator<ValueList<Value>>;
   using DFAIt = typename DFA::Iterator;
-  using State = pair<TrieDFAIt, DFAIt>;
+
+  struct State
+  {
+    // nullptr for the root state - the root node is borrowed from the
+    // caller instead of being cloned, as cloning it copies its value list.
+    unique_ptr<TrieIt> m_trieIt;
+    vector<DFAIt> m_dfaIts;
+  };
 
   queue<State> q;
 
   {
-    auto it = dfa.Begin();
-    DFAMove(it, rootPrefix, rootPrefix + rootPrefixSize);
-    if (it.Rejects())
+    State root;
+    for (auto const & dfa : dfas)
+    {
+      auto it = dfa.Begin();
+      DFAMove(it, rootPrefix, rootPrefix + rootPrefixSize);
+      if (!it.Rejects())
+        root.m_dfaIts.push_back(it);
+    }
+    if (root.m_dfaIts.empty())
       return false;
-    q.emplace(trieRoot.Clone(), it);
+    q.push(move(root));
   }
 
   bool found = false;
 
   while (!q.empty())
   {
-    auto const p = q.front();
+    State const state = move(q.front());
     q.pop();
 
-    auto const & trieIt = p.first;
-    auto const & dfaIt = p.second;
+    TrieIt const & trieIt = state.m_trieIt ? *state.m_trieIt : trieRoot;
 
-    if (dfaIt.Accepts())
+    bool const accepts = any_of(state.m_dfaIts.begin(), state.m_dfaIts.end(),
+                                [](DFAIt const & it) { return it.Accepts(); });
+    if (accepts)
     {
-      trieIt->m_valueList.ForEach(toDo);
+      trieIt.m_valueList.ForEach(toDo);
       found = true;
     }
 
-    size_t const numEdges = trieIt->m_edge.size();
+    size_t const numEdges = trieIt.m_edge.size();
     for (size_t i = 0; i < numEdges; ++i)
     {
-      auto const & edge = trieIt->m_edge[i];
-
-      auto curIt = dfaIt;
-      strings::DFAMove(curIt, edge.m_label.begin(), edge.m_label.end());
-      if (!curIt.Rejects())
-        q.emplace(trieIt->GoToEdge(i), curIt);
+      auto const & edge = trieIt.m_edge[i];
+
+      State next;
+      for (auto const & dfaIt : state.m_dfaIts)
+      {
+        auto curIt = dfaIt;
+        strings::DFAMove(curIt, edge.m_label.begin(), edge.m_label.end());
+        if (!curIt.Rejects())
+          next.m_dfaIts.push_back(curIt);
+      }
+      if (next.m_dfaIts.empty())
+        continue;
+
+      next.m_trieIt = trieIt.GoToEdge(i);
+      q.push(move(next));
     }
   }
 
@@ -227,8 +256,7 @@ struct SearchTrieRequest
 template <typename DFA, typename Value, typename ToDo>
 void MatchInTrie(vector<DFA> const & dfas, TrieRootPrefix<Value> const & trieRoot, ToDo && toDo)
 {
-  for (auto const & dfa : dfas)
-    impl::MatchInTrie(trieRoot.m_root, trieRoot.m_prefix, trieRoot.m_prefixSize, dfa, toDo);
+  impl::MatchInTrie(trieRoot.m_root, trieRoot.m_prefix, trieRoot.m_prefixSize, dfas, toDo);
 }
 
 // Calls |toDo| for each feature in categories branch matching to |request|.
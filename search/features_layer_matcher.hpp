@@ -153,9 +153,8 @@ private:
     // |buildings| doesn't contain buildings matching by house number,
     // so following code reads buildings in POIs vicinities and checks
     // house numbers.
-    vector<house_numbers::Token> queryParse;
-    ParseQuery(parent.m_subQuery, parent.m_lastTokenIsPrefix, queryParse);
-    if (queryParse.empty())
+    house_numbers::HouseNumbersMatcher matcher(parent.m_subQuery, parent.m_lastTokenIsPrefix);
+    if (matcher.Empty())
       return;
 
     for (size_t i = 0; i < pois.size(); ++i)
@@ -166,8 +165,7 @@ private:
           {
             if (m_postcodes && !m_postcodes->HasBit(ft.GetID().m_index))
               return;
-            if (house_numbers::HouseNumbersMatch(strings::MakeUniString(ft.GetHouseNumber()),
-                                                 queryParse))
+            if (matcher.Matches(strings::MakeUniString(ft.GetHouseNumber())))
             {
               double const distanceM =
                   MercatorBounds::DistanceOnEarth(feature::GetCenter(ft), poiCenters[i]);
@@ -238,8 +236,7 @@ private:
       return;
     }
 
-    vector<house_numbers::Token> queryParse;
-    ParseQuery(child.m_subQuery, child.m_lastTokenIsPrefix, queryParse);
+    house_numbers::HouseNumbersMatcher matcher(child.m_subQuery, child.m_lastTokenIsPrefix);
 
     uint32_t numFilterInvocations = 0;
     auto houseNumberFilter = [&](uint32_t id, FeatureType & feature, bool & loaded) -> bool
@@ -263,8 +260,7 @@ private:
       if (!child.m_hasDelayedFeatures)
         return false;
 
-      strings::UniString const houseNumber(strings::MakeUniString(feature.GetHouseNumber()));
-      return house_numbers::HouseNumbersMatch(houseNumber, queryParse);
+      return matcher.Matches(strings::MakeUniString(feature.GetHouseNumber()));
     };
 
     unordered_map<uint32_t, bool> cache;
@@ -286,8 +282,6 @@ private:
       if (street.IsEmpty())
         continue;
 
-      auto const & calculator = *street.m_calculator;
-
       for (uint32_t houseId : street.m_features)
       {
         FeatureType feature;
@@ -295,23 +289,21 @@ private:
         if (!cachingHouseNumberFilter(houseId, feature, loaded))
           continue;
 
-        if (!loaded)
-          GetByIndex(houseId, feature);
-
-        // Best geometry is used here as feature::GetCenter(feature)
-        // actually modifies internal state of a |feature| by caching
-        // it's geometry. So, when GetMatchingStreet(houseId, feature)
-        // is called, high precision geometry is used again to compute
-        // |feature|'s center, and this is a right behavior as
-        // house-to-street table was generated by using high-precision
-        // centers of features.
-        m2::PointD const center = feature::GetCenter(feature);
-        if (calculator.GetProjection(center, proj) &&
-            proj.m_distMeters <= ReverseGeocoder::kLookupRadiusM &&
-            GetMatchingStreet(houseId, feature) == streetId)
+        // The loader computes the projection from the house's best
+        // geometry center, as house-to-street table was generated by
+        // using high-precision centers of features, and caches the
+        // result in the street, so next queries against the same mwm
+        // won't recompute it.
+        if (!m_loader.GetProjection(streetId, houseId, proj) ||
+            proj.m_distMeters > ReverseGeocoder::kLookupRadiusM)
         {
-          fn(houseId, streetId);
+          continue;
         }
+
+        uint32_t const matchingStreetId =
+            loaded ? GetMatchingStreet(houseId, feature) : GetMatchingStreet(houseId);
+        if (matchingStreetId == streetId)
+          fn(houseId, streetId);
       }
     }
   }
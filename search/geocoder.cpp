@@ -9,6 +9,7 @@
 #include "search/pre_ranker.hpp"
 #include "search/processor.hpp"
 #include "search/retrieval.hpp"
+#include "search/stage_timer.hpp"
 #include "search/token_slice.hpp"
 #include "search/utils.hpp"
 
@@ -180,6 +181,52 @@ private:
   LazyRankTable m_ranks;
 };
 
+// Wraps a LocalityScorer::Delegate and memoizes its results in a
+// Geocoder::LocalityScorerCache, which outlives a single query.
+// Cached names are dropped when the query languages change, as the
+// underlying delegate extracts names for the current languages only.
+class CachingLocalityScorerDelegate : public LocalityScorer::Delegate
+{
+public:
+  CachingLocalityScorerDelegate(LocalityScorer::Delegate const & delegate,
+                                Geocoder::LocalityScorerCache & cache,
+                                QueryParams::Langs const & langs)
+    : m_delegate(delegate), m_cache(cache)
+  {
+    vector<int8_t> ls(langs.begin(), langs.end());
+    if (m_cache.m_langs != ls)
+    {
+      m_cache.m_names.clear();
+      m_cache.m_langs = move(ls);
+    }
+  }
+
+  // LocalityScorer::Delegate overrides:
+  void GetNames(uint32_t featureId, vector<string> & names) const override
+  {
+    auto it = m_cache.m_names.find(featureId);
+    if (it == m_cache.m_names.end())
+    {
+      vector<string> loaded;
+      m_delegate.GetNames(featureId, loaded);
+      it = m_cache.m_names.emplace(featureId, move(loaded)).first;
+    }
+    names.insert(names.end(), it->second.begin(), it->second.end());
+  }
+
+  uint8_t GetRank(uint32_t featureId) const override
+  {
+    auto it = m_cache.m_ranks.find(featureId);
+    if (it == m_cache.m_ranks.end())
+      it = m_cache.m_ranks.emplace(featureId, m_delegate.GetRank(featureId)).first;
+    return it->second;
+  }
+
+private:
+  LocalityScorer::Delegate const & m_delegate;
+  Geocoder::LocalityScorerCache & m_cache;
+};
+
 void JoinQueryTokens(QueryParams const & params, TokenRange const & range, UniString const & sep,
                      UniString & res)
 {
@@ -379,6 +426,10 @@ void Geocoder::SetParams(Params const & params)
     }
   }
 
+  m_tokenCacheKeys.clear();
+  for (size_t i = 0; i < m_params.GetNumTokens(); ++i)
+    m_tokenCacheKeys.push_back(MakeTokenCacheKey(i));
+
   LOG(LDEBUG, (static_cast<QueryParams const &>(m_params)));
 }
 
@@ -425,6 +476,7 @@ void Geocoder::GoInViewport()
 
 void Geocoder::GoImpl(vector<shared_ptr<MwmInfo>> & infos, bool inViewport)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageGeocoding);
 #if defined(USE_GOOGLE_PROFILER) && defined(OMIM_OS_LINUX)
   ProfilerStart("/tmp/geocoder.prof");
   MY_SCOPE_GUARD(profilerStop, []() { ProfilerStop(); });
@@ -432,29 +484,41 @@ void Geocoder::GoImpl(vector<shared_ptr<MwmInfo>> & infos, bool inViewport)
 
   try
   {
-    // Tries to find world and fill localities table.
+    // Tries to find world and fill localities table. The table depends
+    // only on the query and on the World mwm, so when both are unchanged
+    // (e.g. viewport search after a map move) the previous table is
+    // reused and World is not matched again.
     {
-      m_cities.clear();
-      for (auto & regions : m_regions)
-        regions.clear();
       MwmSet::MwmHandle handle = FindWorld(m_index, infos);
-      if (handle.IsAlive())
-      {
-        auto & value = *handle.GetValue<MwmValue>();
+      string const localitiesKey = MakeLocalitiesCacheKey();
 
-        // All MwmIds are unique during the application lifetime, so
-        // it's ok to save MwmId.
-        m_worldId = handle.GetId();
-        m_context = make_unique<MwmContext>(move(handle));
+      if (!handle.IsAlive() || handle.GetId() != m_worldId ||
+          localitiesKey != m_localitiesCacheKey)
+      {
+        m_localitiesCacheKey.clear();
+        m_cities.clear();
+        for (auto & regions : m_regions)
+          regions.clear();
 
-        if (value.HasSearchIndex())
+        if (handle.IsAlive())
         {
-          BaseContext ctx;
-          InitBaseContext(ctx);
-          FillLocalitiesTable(ctx);
+          auto & value = *handle.GetValue<MwmValue>();
+
+          // All MwmIds are unique during the application lifetime, so
+          // it's ok to save MwmId.
+          m_worldId = handle.GetId();
+          m_context = make_unique<MwmContext>(move(handle));
+
+          if (value.HasSearchIndex())
+          {
+            BaseContext ctx;
+            InitBaseContext(ctx);
+            FillLocalitiesTable(ctx);
+            m_localitiesCacheKey = localitiesKey;
+          }
+
+          m_context.reset();
         }
-
-        m_context.reset();
       }
     }
 
@@ -471,6 +535,11 @@ void Geocoder::GoImpl(vector<shared_ptr<MwmInfo>> & infos, bool inViewport)
     // found.
     size_t const numIntersectingMaps = OrderCountries(m_params.m_pivot, infos);
 
+    // Worker threads compute the token features of the countries ahead
+    // of the main matching thread.
+    StartFeaturesPrefetch(infos);
+    MY_SCOPE_GUARD(stopPrefetch, [this]() { StopFeaturesPrefetch(); });
+
     // MatchAroundPivot() should always be matched in mwms
     // intersecting with position and viewport.
     auto processCountry = [&](size_t index, unique_ptr<MwmContext> context)
@@ -542,25 +611,213 @@ void Geocoder::ClearCaches()
   m_localityRectsCache.Clear();
 
   m_matchersCache.clear();
+  m_localityScorerCaches.clear();
+  {
+    lock_guard<mutex> lock(m_tokenCacheMutex);
+    m_tokenCache.clear();
+  }
   m_streetsCache.Clear();
   m_hotelsCache.Clear();
   m_hotelsFilter.ClearCaches();
   m_postcodes.Clear();
+
+  m_cities.clear();
+  for (auto & regions : m_regions)
+    regions.clear();
+  m_localitiesCacheKey.clear();
 }
 
 void Geocoder::InitBaseContext(BaseContext & ctx)
 {
   ctx.m_usedTokens.assign(m_params.GetNumTokens(), false);
   ctx.m_numTokens = m_params.GetNumTokens();
-  ctx.m_features.resize(ctx.m_numTokens);
-  for (size_t i = 0; i < ctx.m_features.size(); ++i)
+  if (!GetPrefetchedFeatures(m_context->GetId(), ctx.m_features))
+    RetrieveTokenFeatures(*m_context, ctx.m_features);
+  ctx.m_hotelsFilter = m_hotelsFilter.MakeScopedFilter(*m_context, m_params.m_hotelsFilter);
+}
+
+void Geocoder::RetrieveTokenFeatures(MwmContext const & context, vector<CBV> & features)
+{
+  features.resize(m_params.GetNumTokens());
+  for (size_t i = 0; i < features.size(); ++i)
   {
+    if (GetCachedTokenFeatures(context.GetId(), m_tokenCacheKeys[i], features[i]))
+      continue;
+
+    unique_ptr<coding::CompressedBitVector> cbv;
     if (m_params.IsPrefixToken(i))
-      ctx.m_features[i] = RetrieveAddressFeatures(*m_context, m_cancellable, m_prefixTokenRequest);
+      cbv = RetrieveAddressFeatures(context, m_cancellable, m_prefixTokenRequest);
     else
-      ctx.m_features[i] = RetrieveAddressFeatures(*m_context, m_cancellable, m_tokenRequests[i]);
+      cbv = RetrieveAddressFeatures(context, m_cancellable, m_tokenRequests[i]);
+    PutCachedTokenFeatures(context.GetId(), m_tokenCacheKeys[i], cbv);
+    features[i] = move(cbv);
+  }
+}
+
+string Geocoder::MakeTokenCacheKey(size_t i) const
+{
+  ostringstream os;
+  os << (m_params.IsPrefixToken(i) ? 'p' : 't');
+  m_params.GetToken(i).ForEach([&os](strings::UniString const & s) {
+    os << strings::ToUtf8(s) << '\0';
+  });
+  os << '\1';
+  for (auto const & index : m_params.GetTypeIndices(i))
+    os << index << ',';
+  os << '\1';
+  for (auto const & lang : m_params.GetLangs())
+    os << lang << ',';
+  return os.str();
+}
+
+string Geocoder::MakeLocalitiesCacheKey() const
+{
+  ostringstream os;
+  for (auto const & key : m_tokenCacheKeys)
+    os << key << '\2';
+  return os.str();
+}
+
+bool Geocoder::GetCachedTokenFeatures(MwmSet::MwmId const & mwmId, string const & key,
+                                      CBV & features)
+{
+  lock_guard<mutex> lock(m_tokenCacheMutex);
+  auto const mwmIt = m_tokenCache.find(mwmId);
+  if (mwmIt == m_tokenCache.end())
+    return false;
+  auto const it = mwmIt->second.find(key);
+  if (it == mwmIt->second.end())
+    return false;
+  features = it->second ? CBV(it->second->Clone()) : CBV();
+  return true;
+}
+
+void Geocoder::PutCachedTokenFeatures(MwmSet::MwmId const & mwmId, string const & key,
+                                      unique_ptr<coding::CompressedBitVector> const & features)
+{
+  lock_guard<mutex> lock(m_tokenCacheMutex);
+  m_tokenCache[mwmId][key] = features ? features->Clone() : nullptr;
+}
+
+void Geocoder::StartFeaturesPrefetch(vector<shared_ptr<MwmInfo>> const & infos)
+{
+  size_t const numCores = thread::hardware_concurrency();
+  if (numCores < 2)
+    return;
+
+  size_t numMwms = 0;
+  {
+    lock_guard<mutex> lock(m_prefetchMutex);
+    m_prefetchStop = false;
+    m_prefetchQueue.clear();
+    m_prefetchedFeatures.clear();
+    for (auto const & info : infos)
+    {
+      if (info->GetType() != MwmInfo::COUNTRY || m_params.m_mode == Mode::Downloader)
+        continue;
+      m_prefetchQueue.push_back(MwmSet::MwmId(info));
+    }
+    numMwms = m_prefetchQueue.size();
+  }
+
+  if (numMwms == 0)
+    return;
+
+  // One core is left to the main matching thread.
+  size_t const numWorkers = min(min(numCores - 1, numMwms), size_t(3));
+  for (size_t i = 0; i < numWorkers; ++i)
+    m_prefetchThreads.emplace_back(&Geocoder::FeaturesPrefetchWorker, this);
+}
+
+void Geocoder::StopFeaturesPrefetch()
+{
+  {
+    lock_guard<mutex> lock(m_prefetchMutex);
+    m_prefetchStop = true;
+    m_prefetchQueue.clear();
+  }
+  m_prefetchCondition.notify_all();
+
+  for (auto & t : m_prefetchThreads)
+    t.join();
+  m_prefetchThreads.clear();
+
+  lock_guard<mutex> lock(m_prefetchMutex);
+  m_prefetchedFeatures.clear();
+}
+
+bool Geocoder::GetPrefetchedFeatures(MwmSet::MwmId const & mwmId, vector<CBV> & features)
+{
+  unique_lock<mutex> lock(m_prefetchMutex);
+  if (m_prefetchThreads.empty())
+    return false;
+
+  // Claim the mwm so that no worker starts it while the main thread
+  // computes the features itself.
+  auto const queueIt = find(m_prefetchQueue.begin(), m_prefetchQueue.end(), mwmId);
+  if (queueIt != m_prefetchQueue.end())
+  {
+    m_prefetchQueue.erase(queueIt);
+    return false;
+  }
+
+  m_prefetchCondition.wait(lock, [&]() { return m_prefetchInFlight.count(mwmId) == 0; });
+
+  auto const it = m_prefetchedFeatures.find(mwmId);
+  if (it == m_prefetchedFeatures.end())
+    return false;
+
+  features = move(it->second);
+  m_prefetchedFeatures.erase(it);
+  return true;
+}
+
+void Geocoder::FeaturesPrefetchWorker()
+{
+  while (true)
+  {
+    MwmSet::MwmId mwmId;
+    {
+      unique_lock<mutex> lock(m_prefetchMutex);
+      m_prefetchCondition.wait(lock,
+                               [this]() { return m_prefetchStop || !m_prefetchQueue.empty(); });
+      if (m_prefetchStop)
+        return;
+      mwmId = m_prefetchQueue.front();
+      m_prefetchQueue.pop_front();
+      m_prefetchInFlight.insert(mwmId);
+    }
+
+    vector<CBV> features;
+    bool ready = false;
+    try
+    {
+      auto handle = m_index.GetMwmHandleById(mwmId);
+      if (handle.IsAlive() && !m_cancellable.IsCancelled())
+      {
+        auto & value = *handle.GetValue<MwmValue>();
+        if (value.HasSearchIndex() && value.HasGeometryIndex())
+        {
+          MwmContext const context(move(handle));
+          RetrieveTokenFeatures(context, features);
+          ready = true;
+        }
+      }
+    }
+    catch (RootException const &)
+    {
+      // The result is dropped and the main thread recomputes the
+      // features itself. Covers CancelException as well.
+    }
+
+    {
+      lock_guard<mutex> lock(m_prefetchMutex);
+      if (ready)
+        m_prefetchedFeatures[mwmId] = move(features);
+      m_prefetchInFlight.erase(mwmId);
+    }
+    m_prefetchCondition.notify_all();
   }
-  ctx.m_hotelsFilter = m_hotelsFilter.MakeScopedFilter(*m_context, m_params.m_hotelsFilter);
 }
 
 void Geocoder::InitLayer(SearchModel::SearchType type, TokenRange const & tokenRange,
@@ -580,7 +837,9 @@ void Geocoder::FillLocalityCandidates(BaseContext const & ctx, CBV const & filte
                                       vector<Locality> & preLocalities)
 {
   LocalityScorerDelegate delegate(*m_context, m_params);
-  LocalityScorer scorer(m_params, delegate);
+  CachingLocalityScorerDelegate cachingDelegate(delegate, m_localityScorerCaches[m_context->GetId()],
+                                                m_params.GetLangs());
+  LocalityScorer scorer(m_params, cachingDelegate);
   scorer.GetTopLocalities(m_context->GetId(), ctx, filter, maxNumLocalities, preLocalities);
 }
 
@@ -756,6 +1015,8 @@ void Geocoder::MatchRegions(BaseContext & ctx, Region::Type type)
 
     for (auto const & region : p.second)
     {
+      BailIfCancelled();
+
       bool matches = false;
 
       // On the World.mwm we need to check that CITY - STATE - COUNTRY
@@ -36,9 +36,14 @@
 #include "base/macros.hpp"
 #include "base/string_utils.hpp"
 
+#include "std/condition_variable.hpp"
+#include "std/deque.hpp"
 #include "std/limits.hpp"
+#include "std/map.hpp"
+#include "std/mutex.hpp"
 #include "std/set.hpp"
 #include "std/string.hpp"
+#include "std/thread.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/unordered_map.hpp"
 #include "std/vector.hpp"
@@ -87,6 +92,19 @@ public:
     shared_ptr<hotels_filter::Rule> m_hotelsFilter;
   };
 
+  // Cached locality names and ranks used by the locality scorer, so
+  // repeated queries in the same region skip feature reads and rank
+  // table lookups. Keyed by MwmId in the geocoder; all MwmIds are
+  // unique during the application lifetime, so an updated mwm always
+  // gets a fresh cache.
+  struct LocalityScorerCache
+  {
+    // Languages for which |m_names| were extracted.
+    vector<int8_t> m_langs;
+    unordered_map<uint32_t, vector<string>> m_names;
+    unordered_map<uint32_t, uint8_t> m_ranks;
+  };
+
   Geocoder(Index const & index, storage::CountryInfoGetter const & infoGetter,
            PreRanker & preRanker, VillagesCache & villagesCache,
            my::Cancellable const & cancellable);
@@ -134,6 +152,31 @@ private:
   // for each token and saves it to m_addressFeatures.
   void InitBaseContext(BaseContext & ctx);
 
+  // Computes the per-token posting lists of |context|.
+  void RetrieveTokenFeatures(MwmContext const & context, vector<CBV> & features);
+
+  // Builds a key that identifies the retrieval result of the |i|-th token:
+  // token strings with synonyms, category types, languages and the prefix flag.
+  string MakeTokenCacheKey(size_t i) const;
+  // Builds a key that identifies the query for the localities table:
+  // the concatenation of all token cache keys.
+  string MakeLocalitiesCacheKey() const;
+  bool GetCachedTokenFeatures(MwmSet::MwmId const & mwmId, string const & key, CBV & features);
+  void PutCachedTokenFeatures(MwmSet::MwmId const & mwmId, string const & key,
+                              unique_ptr<coding::CompressedBitVector> const & features);
+
+  // Token features prefetcher. While the current mwm is being matched on the
+  // main thread, worker threads compute the token features of the mwms to
+  // follow — the most expensive independent part of per-mwm geocoding.
+  // Every mwm is touched by one thread at a time: the main thread either takes
+  // a finished result, waits for an in-flight one or claims the mwm for itself.
+  void StartFeaturesPrefetch(vector<shared_ptr<MwmInfo>> const & infos);
+  void StopFeaturesPrefetch();
+  // Returns false if |mwmId| is not prefetched: the caller computes the
+  // features synchronously in this case.
+  bool GetPrefetchedFeatures(MwmSet::MwmId const & mwmId, vector<CBV> & features);
+  void FeaturesPrefetchWorker();
+
   void InitLayer(SearchModel::SearchType type, TokenRange const & tokenRange,
                  FeaturesLayer & layer);
 
@@ -248,6 +291,12 @@ private:
   LocalitiesCache<City> m_cities;
   LocalitiesCache<Region> m_regions[Region::TYPE_COUNT];
 
+  // Signature of the query the current m_cities/m_regions were built
+  // for. The table depends only on the World mwm and the query, so
+  // viewport searches following a map move reuse it instead of
+  // re-matching World on every gesture.
+  string m_localitiesCacheKey;
+
   // Caches of features in rects. These caches are separated from
   // TLocalitiesCache because the latter are quite lightweight and not
   // all of them are needed.
@@ -264,6 +313,9 @@ private:
   map<MwmSet::MwmId, unique_ptr<FeaturesLayerMatcher>> m_matchersCache;
   FeaturesLayerMatcher * m_matcher;
 
+  // Locality names and ranks for the locality scorer.
+  map<MwmSet::MwmId, LocalityScorerCache> m_localityScorerCaches;
+
   // Path finder for interpretations.
   FeaturesLayerPathFinder m_finder;
 
@@ -271,6 +323,26 @@ private:
   vector<SearchTrieRequest<strings::LevenshteinDFA>> m_tokenRequests;
   SearchTrieRequest<strings::PrefixDFAModifier<strings::LevenshteinDFA>> m_prefixTokenRequest;
 
+  // Per-(mwm, token) retrieval cache. Consecutive queries share all but the
+  // last token, so most posting lists survive a keystroke and only the token
+  // being typed is re-retrieved from the trie. The cached vectors are deep
+  // copies: CBV reference counting is not thread-safe and the prefetch
+  // workers use this cache too. Guarded by m_tokenCacheMutex.
+  mutex m_tokenCacheMutex;
+  map<MwmSet::MwmId, unordered_map<string, unique_ptr<coding::CompressedBitVector>>> m_tokenCache;
+  // Cache keys of the current query tokens, built by SetParams().
+  vector<string> m_tokenCacheKeys;
+
+  // Guards the prefetcher state below.
+  mutex m_prefetchMutex;
+  condition_variable m_prefetchCondition;
+  // Mwms the workers have not started yet, in the processing order.
+  deque<MwmSet::MwmId> m_prefetchQueue;
+  set<MwmSet::MwmId> m_prefetchInFlight;
+  map<MwmSet::MwmId, vector<CBV>> m_prefetchedFeatures;
+  vector<thread> m_prefetchThreads;
+  bool m_prefetchStop = false;
+
   PreRanker & m_preRanker;
 };
 }  // namespace search
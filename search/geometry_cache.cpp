@@ -6,11 +6,20 @@
 
 #include "geometry/mercator.hpp"
 
+#include "base/logging.hpp"
+#include "base/stl_helpers.hpp"
+#include "base/timer.hpp"
+
 namespace search
 {
 namespace
 {
 double constexpr kCellEps = MercatorBounds::GetCellID2PointAbsEpsilon();
+
+// Per-mwm capacity of the warm tier, relative to the hot tier.
+// Serialized bit vectors are small, so the warm tier can afford to be
+// noticeably larger than the decoded one.
+size_t constexpr kWarmTierCapacityFactor = 4;
 }  // namespace
 
 // GeometryCache -----------------------------------------------------------------------------------
@@ -20,12 +29,57 @@ GeometryCache::GeometryCache(size_t maxNumEntries, my::Cancellable const & cance
   CHECK_GREATER(m_maxNumEntries, 0, ());
 }
 
+void GeometryCache::Clear()
+{
+  size_t const numLookups = m_numHotHits + m_numWarmHits + m_numMisses;
+  if (numLookups != 0)
+  {
+    LOG(LDEBUG, ("GeometryCache lookups:", numLookups, "hot hits:", m_numHotHits,
+                 "warm hits:", m_numWarmHits, "misses:", m_numMisses));
+  }
+
+  m_entries.clear();
+  m_warmEntries.clear();
+  m_numHotHits = 0;
+  m_numWarmHits = 0;
+  m_numMisses = 0;
+}
+
 void GeometryCache::InitEntry(MwmContext const & context, m2::RectD const & rect, int scale,
                               Entry & entry)
 {
+  my::Timer timer;
   entry.m_rect = rect;
   entry.m_cbv = RetrieveGeometryFeatures(context, m_cancellable, rect, scale);
   entry.m_scale = scale;
+  entry.m_buildTimeSec = timer.ElapsedSeconds();
+}
+
+void GeometryCache::Demote(MwmSet::MwmId const & id, Entry const & entry)
+{
+  auto & warmEntries = m_warmEntries[id];
+
+  warmEntries.emplace_back();
+  WarmEntry & warmEntry = warmEntries.back();
+  warmEntry.m_rect = entry.m_rect;
+  warmEntry.m_scale = entry.m_scale;
+  warmEntry.m_buildTimeSec = entry.m_buildTimeSec;
+  entry.m_cbv.Serialize(warmEntry.m_blob);
+
+  if (warmEntries.size() > kWarmTierCapacityFactor * m_maxNumEntries)
+  {
+    auto const it =
+        min_element(warmEntries.begin(), warmEntries.end(), my::LessBy(&WarmEntry::m_buildTimeSec));
+    warmEntries.erase(it);
+  }
+}
+
+void GeometryCache::Promote(WarmEntry const & warmEntry, Entry & entry)
+{
+  entry.m_rect = warmEntry.m_rect;
+  entry.m_cbv = CBV::Deserialize(warmEntry.m_blob);
+  entry.m_scale = warmEntry.m_scale;
+  entry.m_buildTimeSec = warmEntry.m_buildTimeSec;
 }
 
 // PivotRectsCache ---------------------------------------------------------------------------------
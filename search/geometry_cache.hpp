@@ -14,6 +14,7 @@
 #include "std/map.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/utility.hpp"
+#include "std/vector.hpp"
 
 namespace my
 {
@@ -24,7 +25,11 @@ namespace search
 {
 class MwmContext;
 
-// This class represents a simple cache of features in rects for all mwms.
+// This class represents a two-tiered cache of features in rects for
+// all mwms. The hot tier keeps a few decoded bit vectors ready for
+// use; entries evicted from it are demoted to a larger warm tier in
+// serialized (compressed) form, from where they can be restored much
+// cheaper than by re-retrieving them from the geometry index.
 //
 // *NOTE* This class is not thread-safe.
 class GeometryCache
@@ -37,7 +42,7 @@ public:
   // this method.
   virtual CBV Get(MwmContext const & context, m2::RectD const & rect, int scale) = 0;
 
-  inline void Clear() { m_entries.clear(); }
+  void Clear();
 
 protected:
   struct Entry
@@ -45,19 +50,31 @@ protected:
     m2::RectD m_rect;
     CBV m_cbv;
     int m_scale = 0;
+
+    // Time spent to retrieve m_cbv from the geometry index; used for
+    // cost-aware eviction from the warm tier.
+    double m_buildTimeSec = 0.0;
+  };
+
+  // An entry demoted from the hot tier: same key, but the bit vector
+  // is kept in serialized form.
+  struct WarmEntry : public Entry
+  {
+    vector<uint8_t> m_blob;
   };
 
-  // |maxNumEntries| denotes the maximum number of rectangles that
-  // will be cached for each mwm individually.
+  // |maxNumEntries| denotes the maximum number of decoded rectangles
+  // that will be cached for each mwm individually.
   GeometryCache(size_t maxNumEntries, my::Cancellable const & cancellable);
 
   template <typename TPred>
   pair<Entry &, bool> FindOrCreateEntry(MwmSet::MwmId const & id, TPred && pred)
   {
     auto & entries = m_entries[id];
-    auto it = find_if(entries.begin(), entries.end(), forward<TPred>(pred));
+    auto it = find_if(entries.begin(), entries.end(), pred);
     if (it != entries.end())
     {
+      ++m_numHotHits;
       if (it != entries.begin())
         iter_swap(entries.begin(), it);
       return pair<Entry &, bool>(entries.front(), false);
@@ -65,11 +82,28 @@ protected:
 
     entries.emplace_front();
     if (entries.size() == m_maxNumEntries + 1)
+    {
+      Demote(id, entries.back());
       entries.pop_back();
+    }
 
     ASSERT_LESS_OR_EQUAL(entries.size(), m_maxNumEntries, ());
     ASSERT(!entries.empty(), ());
-    return pair<Entry &, bool>(entries.front(), true);
+
+    Entry & entry = entries.front();
+
+    auto & warmEntries = m_warmEntries[id];
+    auto wit = find_if(warmEntries.begin(), warmEntries.end(), pred);
+    if (wit != warmEntries.end())
+    {
+      ++m_numWarmHits;
+      Promote(*wit, entry);
+      warmEntries.erase(wit);
+      return pair<Entry &, bool>(entry, false);
+    }
+
+    ++m_numMisses;
+    return pair<Entry &, bool>(entry, true);
   }
 
   void InitEntry(MwmContext const & context, m2::RectD const & rect, int scale, Entry & entry);
@@ -77,6 +111,22 @@ protected:
   map<MwmSet::MwmId, deque<Entry>> m_entries;
   size_t const m_maxNumEntries;
   my::Cancellable const & m_cancellable;
+
+private:
+  // Serializes |entry| into the warm tier of |id|. When the tier is
+  // full, the entry that is cheapest to rebuild from the geometry
+  // index is dropped.
+  void Demote(MwmSet::MwmId const & id, Entry const & entry);
+
+  // Restores a decoded |entry| from |warmEntry|.
+  void Promote(WarmEntry const & warmEntry, Entry & entry);
+
+  map<MwmSet::MwmId, deque<WarmEntry>> m_warmEntries;
+
+  // Hit rate counters, reported on Clear().
+  size_t m_numHotHits = 0;
+  size_t m_numWarmHits = 0;
+  size_t m_numMisses = 0;
 };
 
 class PivotRectsCache : public GeometryCache
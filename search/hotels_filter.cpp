@@ -25,7 +25,7 @@ void Description::FromFeature(FeatureType & ft)
   m_rating = Rating::kDefault;
   m_priceRate = PriceRate::kDefault;
 
-  auto const & metadata = ft.GetMetadata();
+  auto const & metadata = ft.GetHotMetadata();
 
   if (metadata.Has(feature::Metadata::FMD_RATING))
   {
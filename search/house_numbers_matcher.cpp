@@ -347,6 +347,22 @@ bool IsShortBuildingSynonym(UniString const & t)
   return false;
 }
 
+// Returns true when some parse from |parses| matches |queryParse|.
+bool AnyParseMatches(vector<vector<Token>> const & parses, vector<Token> const & queryParse)
+{
+  for (auto const & parse : parses)
+  {
+    if (parse.empty())
+      continue;
+    if (parse[0] == queryParse[0] &&
+        IsSubsequence(parse.begin() + 1, parse.end(), queryParse.begin() + 1, queryParse.end()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 template <typename TFn>
 void ForEachGroup(vector<Token> const & ts, TFn && fn)
 {
@@ -543,17 +559,7 @@ bool HouseNumbersMatch(strings::UniString const & houseNumber, vector<Token> con
   vector<vector<Token>> houseNumberParses;
   ParseHouseNumber(houseNumber, houseNumberParses);
 
-  for (auto & parse : houseNumberParses)
-  {
-    if (parse.empty())
-      continue;
-    if (parse[0] == queryParse[0] &&
-        IsSubsequence(parse.begin() + 1, parse.end(), queryParse.begin() + 1, queryParse.end()))
-    {
-      return true;
-    }
-  }
-  return false;
+  return AnyParseMatches(houseNumberParses, queryParse);
 }
 
 bool LooksLikeHouseNumber(strings::UniString const & s, bool isPrefix)
@@ -562,6 +568,31 @@ bool LooksLikeHouseNumber(strings::UniString const & s, bool isPrefix)
   return classifier.LooksGood(s, isPrefix);
 }
 
+// HouseNumbersMatcher -----------------------------------------------------------------------------
+HouseNumbersMatcher::HouseNumbersMatcher(strings::UniString const & query, bool queryIsPrefix)
+{
+  ParseQuery(query, queryIsPrefix, m_queryParse);
+}
+
+bool HouseNumbersMatcher::Matches(strings::UniString const & houseNumber)
+{
+  if (houseNumber.empty() || m_queryParse.empty())
+    return false;
+
+  // Fast pre-check, helps to early exit without complex house number
+  // parsing.
+  if (IsASCIIDigit(houseNumber[0]) && IsASCIIDigit(m_queryParse[0].m_value[0]) &&
+      houseNumber[0] != m_queryParse[0].m_value[0])
+  {
+    return false;
+  }
+
+  m_parses.clear();
+  ParseHouseNumber(houseNumber, m_parses);
+
+  return AnyParseMatches(m_parses, m_queryParse);
+}
+
 string DebugPrint(Token::Type type)
 {
   switch (type)
@@ -72,6 +72,32 @@ bool HouseNumbersMatch(strings::UniString const & houseNumber, vector<Token> con
 // Returns true if |s| looks like a house number.
 bool LooksLikeHouseNumber(strings::UniString const & s, bool isPrefix);
 
+// Matches house numbers of candidate buildings against a single part
+// of the search query. The query part is parsed once, in the
+// constructor, and scratch buffers for candidates' parses are reused
+// between Matches() calls, so build an instance once per query
+// instead of calling HouseNumbersMatch() per candidate.
+//
+// NOTE: this class *IS NOT* thread-safe.
+class HouseNumbersMatcher
+{
+public:
+  HouseNumbersMatcher(strings::UniString const & query, bool queryIsPrefix);
+
+  // Returns true when the query part parses to an empty token list,
+  // in which case Matches() always returns false.
+  inline bool Empty() const { return m_queryParse.empty(); }
+
+  // Returns true if |houseNumber| matches the query part.
+  bool Matches(strings::UniString const & houseNumber);
+
+private:
+  vector<Token> m_queryParse;
+
+  // Scratch buffer for candidates' parses.
+  vector<vector<Token>> m_parses;
+};
+
 string DebugPrint(Token::Type type);
 
 string DebugPrint(Token const & token);
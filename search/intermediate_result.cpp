@@ -9,6 +9,7 @@
 #include "indexer/feature.hpp"
 #include "indexer/feature_algo.hpp"
 #include "indexer/ftypes_matcher.hpp"
+#include "indexer/opening_hours_cache.hpp"
 #include "indexer/scales.hpp"
 
 #include "geometry/angles.hpp"
@@ -31,18 +32,20 @@ void ProcessMetadata(FeatureType const & ft, Result::Metadata & meta)
   if (meta.m_isInitialized)
     return;
 
-  feature::Metadata const & src = ft.GetMetadata();
+  // Hot metadata is enough here and skips decoding urls and other cold
+  // values for every ranked candidate.
+  feature::Metadata const & src = ft.GetHotMetadata();
 
   meta.m_cuisine = src.Get(feature::Metadata::FMD_CUISINE);
 
   string const openHours = src.Get(feature::Metadata::FMD_OPEN_HOURS);
   if (!openHours.empty())
   {
-    osmoh::OpeningHours const oh(openHours);
+    auto const oh = osm::GetCachedOpeningHours(openHours);
     // TODO: We should check closed/open time for specific feature's timezone.
     time_t const now = time(nullptr);
-    if (oh.IsValid() && !oh.IsUnknown(now))
-      meta.m_isOpenNow = oh.IsOpen(now) ? osm::Yes : osm::No;
+    if (oh->IsValid() && !oh->IsUnknown(now))
+      meta.m_isOpenNow = oh->IsOpen(now) ? osm::Yes : osm::No;
     // In else case value us osm::Unknown, it's set in preview's constructor.
   }
 
@@ -99,7 +102,7 @@ PreResult2::PreResult2(FeatureType const & f, m2::PointD const & center, m2::Poi
                        string const & displayName, string const & fileName)
   : m_id(f.GetID())
   , m_types(f)
-  , m_str(displayName)
+  , m_str(my::StringInternPool::Instance().Intern(displayName))
   , m_resultType(ftypes::IsBuildingChecker::Instance()(m_types) ? RESULT_BUILDING : RESULT_FEATURE)
   , m_geomType(f.GetFeatureType())
 {
@@ -115,7 +118,9 @@ PreResult2::PreResult2(FeatureType const & f, m2::PointD const & center, m2::Poi
 }
 
 PreResult2::PreResult2(double lat, double lon)
-  : m_str("(" + measurement_utils::FormatLatLon(lat, lon) + ")"), m_resultType(RESULT_LATLON)
+  : m_str(my::StringInternPool::Instance().Intern(
+        "(" + measurement_utils::FormatLatLon(lat, lon) + ")"))
+  , m_resultType(RESULT_LATLON)
 {
   m_region.SetParams(string(), MercatorBounds::FromLatLon(lat, lon));
 }
@@ -185,15 +190,27 @@ string FormatFullAddress(ReverseGeocoder::Address const & addr, string const & r
 }
 }  // namespace
 
+bool PreResult2::NeedAddress() const
+{
+  return m_str.IsEmpty() || ftypes::IsAddressObjectChecker::Instance()(m_types);
+}
+
 Result PreResult2::GenerateFinalResult(storage::CountryInfoGetter const & infoGetter,
                                        CategoriesHolder const * pCat,
                                        set<uint32_t> const * pTypes, int8_t locale,
-                                       ReverseGeocoder const * coder) const
+                                       ReverseGeocoder const * coder,
+                                       ReverseGeocoder::Address const * precomputedAddr) const
 {
   ReverseGeocoder::Address addr;
   bool addrComputed = false;
 
-  string name = m_str;
+  if (precomputedAddr)
+  {
+    addr = *precomputedAddr;
+    addrComputed = true;
+  }
+
+  string name = m_str.Get();
   if (coder && name.empty())
   {
     // Insert exact address (street and house number) instead of empty result name.
@@ -258,7 +275,7 @@ bool PreResult2::LessLinearTypesF::operator() (PreResult2 const & r1, PreResult2
     return (r1.m_geomType < r2.m_geomType);
 
   if (r1.m_str != r2.m_str)
-    return (r1.m_str < r2.m_str);
+    return (r1.m_str.Get() < r2.m_str.Get());
 
   uint32_t const t1 = r1.GetBestType();
   uint32_t const t2 = r2.GetBestType();
@@ -291,7 +308,7 @@ string PreResult2::DebugPrint() const
 {
   stringstream ss;
   ss << "{ IntermediateResult: " <<
-        "Name: " << m_str <<
+        "Name: " << m_str.Get() <<
         "; Type: " << GetBestType() <<
         "; Rank: " << static_cast<int>(m_info.m_rank) <<
         "; Distance: " << m_distance << " }";
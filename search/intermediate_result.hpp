@@ -4,9 +4,12 @@
 #include "search/ranking_info.hpp"
 #include "search/ranking_utils.hpp"
 #include "search/result.hpp"
+#include "search/reverse_geocoder.hpp"
 
 #include "indexer/feature_data.hpp"
 
+#include "base/interned_string.hpp"
+
 #include "std/set.hpp"
 
 class FeatureType;
@@ -20,8 +23,6 @@ struct CountryInfo;
 
 namespace search
 {
-class ReverseGeocoder;
-
 /// First pass results class. Objects are creating during search in trie.
 /// Works fast without feature loading and provide ranking.
 class PreResult1
@@ -74,14 +75,22 @@ public:
     m_info = forward<TInfo>(info);
   }
 
+  /// Returns true when GenerateFinalResult() will resolve a nearby
+  /// address for this result (to substitute an empty name or to
+  /// format the full address). Used by Ranker to batch-resolve
+  /// addresses for several results at once.
+  bool NeedAddress() const;
+
   /// @param[in]  infoGetter Need to get region for result.
   /// @param[in]  pCat    Categories need to display readable type string.
   /// @param[in]  pTypes  Set of preffered types that match input tokens by categories.
   /// @param[in]  lang    Current system language.
   /// @param[in]  coder   May be nullptr - no need to calculate address.
+  /// @param[in]  addr    Precomputed nearby address, may be nullptr - resolved on demand.
   Result GenerateFinalResult(storage::CountryInfoGetter const & infoGetter,
                              CategoriesHolder const * pCat, set<uint32_t> const * pTypes,
-                             int8_t locale, ReverseGeocoder const * coder) const;
+                             int8_t locale, ReverseGeocoder const * coder,
+                             ReverseGeocoder::Address const * addr) const;
 
   /// Filter equal features for different mwm's.
   class StrictEqualF
@@ -114,7 +123,7 @@ public:
   bool IsStreet() const;
 
   inline FeatureID const & GetID() const { return m_id; }
-  inline string const & GetName() const { return m_str; }
+  inline string const & GetName() const { return m_str.Get(); }
   inline feature::TypesHolder const & GetTypes() const { return m_types; }
   inline m2::PointD GetCenter() const { return m_region.m_point; }
 
@@ -126,7 +135,9 @@ private:
 
   uint32_t GetBestType(set<uint32_t> const * pPrefferedTypes = 0) const;
 
-  string m_str;
+  // The display name is interned: the same street or POI name shown in
+  // dozens of results shares one allocation.
+  my::InternedString m_str;
 
   struct RegionInfo
   {
@@ -23,6 +23,17 @@ public:
   // log(total number of intervals)).
   void Add(TInterval const & interval);
 
+  // Adds all |intervals| to the set at once. The intervals are
+  // pre-sorted and coalesced in a single pass first, so each maximal
+  // run of touching intervals costs one set modification instead of
+  // one per interval. Prefer this method to repeated Add() calls when
+  // the number of intervals is large.
+  //
+  // Complexity: O(n * log(n) + m * log(total number of intervals)),
+  // where n is the number of added intervals and m is the number of
+  // coalesced runs among them.
+  void AddIntervals(vector<TInterval> && intervals);
+
   // Subtracts set from an |interval| and appends result to
   // |difference|.
   //
@@ -95,6 +106,22 @@ void IntervalSet<TElem>::Add(TInterval const & interval)
   m_intervals.emplace(from, to);
 }
 
+template <typename TElem>
+void IntervalSet<TElem>::AddIntervals(vector<TInterval> && intervals)
+{
+  sort(intervals.begin(), intervals.end());
+
+  size_t i = 0;
+  while (i != intervals.size())
+  {
+    TElem const from = intervals[i].first;
+    TElem to = intervals[i].second;
+    for (++i; i != intervals.size() && intervals[i].first <= to; ++i)
+      to = max(to, intervals[i].second);
+    Add(make_pair(from, to));
+  }
+}
+
 template <typename TElem>
 void IntervalSet<TElem>::SubtractFrom(TInterval const & interval,
                                       vector<TInterval> & difference) const
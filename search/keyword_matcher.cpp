@@ -31,7 +31,7 @@ void KeywordMatcher::SetKeywords(StringT const * keywords, size_t count, StringT
 
 KeywordMatcher::ScoreT KeywordMatcher::Score(string const & name) const
 {
-  return Score(NormalizeAndSimplifyString(name));
+  return Score(NormalizeAndSimplifyStringCached(name));
 }
 
 KeywordMatcher::ScoreT KeywordMatcher::Score(StringT const & name) const
@@ -204,6 +204,7 @@ LocalityFinder::LocalityFinder(Index const & index, VillagesCache & villagesCach
   , m_cities(kMaxCityRadiusMeters)
   , m_villages(kMaxVillageRadiusMeters)
   , m_mapsLoaded(false)
+  , m_citiesLoaded(false)
 {
 }
 
@@ -221,7 +222,7 @@ void LocalityFinder::GetLocality(m2::PointD const & p, string & name)
   m2::RectD const crect = m_cities.GetRect(p);
   m2::RectD const vrect = m_villages.GetRect(p);
 
-  LoadVicinity(p, !m_cities.IsCovered(crect) /* loadCities */,
+  LoadVicinity(p, !m_citiesLoaded /* loadCities */,
                !m_villages.IsCovered(vrect) /* loadVillages */);
 
   LocalitySelector selector(name, p);
@@ -240,6 +241,7 @@ void LocalityFinder::ClearCache()
   m_mapsLoaded = false;
 
   m_loadedIds.clear();
+  m_citiesLoaded = false;
 }
 
 void LocalityFinder::LoadVicinity(m2::PointD const & p, bool loadCities, bool loadVillages)
@@ -248,7 +250,8 @@ void LocalityFinder::LoadVicinity(m2::PointD const & p, bool loadCities, bool lo
 
   if (loadCities)
   {
-    m2::RectD const crect = m_cities.GetDRect(p);
+    // Cities and towns are stored in the World mwm only, so the whole set is
+    // loaded at once: after that city queries never rescan the index.
     auto handle = m_index.GetMwmHandleById(m_worldId);
     if (handle.IsAlive())
     {
@@ -259,11 +262,10 @@ void LocalityFinder::LoadVicinity(m2::PointD const & p, bool loadCities, bool lo
         m_ranks = make_unique<DummyRankTable>();
 
       MwmContext ctx(move(handle));
-      ctx.ForEachIndex(crect,
+      ctx.ForEachIndex(MercatorBounds::FullRect(),
                        LocalitiesLoader(ctx, CityFilter(*m_ranks), m_lang, m_cities, m_loadedIds));
+      m_citiesLoaded = true;
     }
-
-    m_cities.SetCovered(p);
   }
 
   if (loadVillages)
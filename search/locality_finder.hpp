@@ -91,6 +91,11 @@ private:
   MwmSet::MwmId m_worldId;
   bool m_mapsLoaded;
 
+  // Cities and towns come from the World mwm only, and there are few enough
+  // of them to load the whole set at once. After the first load GetLocality()
+  // answers city queries from the in-memory tree without touching the mwm.
+  bool m_citiesLoaded;
+
   unique_ptr<RankTable> m_ranks;
 
   map<MwmSet::MwmId, unordered_set<uint32_t>> m_loadedIds;
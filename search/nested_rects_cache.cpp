@@ -2,6 +2,7 @@
 
 #include "search/ranking_info.hpp"
 
+#include "indexer/feature_covering.hpp"
 #include "indexer/index.hpp"
 
 #include "geometry/mercator.hpp"
@@ -20,7 +21,7 @@ double const kPositionToleranceMeters = 15.0;
 }  // namespace
 
 NestedRectsCache::NestedRectsCache(Index const & index)
-  : m_index(index), m_scale(0), m_position(0, 0), m_valid(false)
+  : m_index(index), m_scale(0), m_position(0, 0), m_valid(false), m_lastCells(), m_lastScale(-1)
 {
 }
 
@@ -68,6 +69,7 @@ void NestedRectsCache::Clear()
 {
   for (int scale = 0; scale != RECT_SCALE_COUNT; ++scale)
     m_buckets[scale].clear();
+  m_lastMwms.clear();
   m_valid = false;
 }
 
@@ -86,13 +88,44 @@ double NestedRectsCache::GetRadiusMeters(RectScale scale)
 
 void NestedRectsCache::Update()
 {
+  m2::RectD rects[RECT_SCALE_COUNT];
+  for (int scale = 0; scale != RECT_SCALE_COUNT; ++scale)
+  {
+    rects[scale] = MercatorBounds::RectByCenterXYAndSizeInMeters(
+        m_position, GetRadiusMeters(static_cast<RectScale>(scale)));
+  }
+
+  // ForEachFeatureIDInRect scans intervals that are fully determined
+  // by the covering cell containing the rect, so while the pivot
+  // stays inside the same cells for all rects and the set of
+  // registered mwms does not change, a rebuild would produce the same
+  // buckets and is skipped. Pivot moves during panning thus cause a
+  // rebuild only on cell boundary crossings. Note that features
+  // recently created in the Editor are refreshed on such crossings or
+  // on Clear() only, which is fine for ring-granular distances.
+  vector<shared_ptr<MwmInfo>> mwms;
+  m_index.GetMwmsInfo(mwms);
+
+  bool changed = !m_valid || m_scale != m_lastScale || mwms != m_lastMwms;
+  for (int scale = 0; scale != RECT_SCALE_COUNT; ++scale)
+  {
+    int64_t const cell = covering::GetRectIdAsIs(rects[scale]).ToInt64(RectId::DEPTH_LEVELS);
+    if (cell != m_lastCells[scale])
+      changed = true;
+    m_lastCells[scale] = cell;
+  }
+  if (!changed)
+    return;
+
+  m_lastScale = m_scale;
+  m_lastMwms = move(mwms);
+
   for (int scale = 0; scale != RECT_SCALE_COUNT; ++scale)
   {
     auto & bucket = m_buckets[scale];
     bucket.clear();
 
-    m2::RectD const rect = MercatorBounds::RectByCenterXYAndSizeInMeters(
-        m_position, GetRadiusMeters(static_cast<RectScale>(scale)));
+    m2::RectD const & rect = rects[scale];
 
     MwmSet::MwmId lastId;
     TFeatures * lastFeatures = nullptr;
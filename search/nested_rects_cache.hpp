@@ -5,6 +5,7 @@
 #include "geometry/point2d.hpp"
 
 #include "std/map.hpp"
+#include "std/shared_ptr.hpp"
 #include "std/vector.hpp"
 
 class Index;
@@ -42,6 +43,16 @@ private:
   m2::PointD m_position;
   bool m_valid;
 
+  // State of the last completed rebuild: containing covering cells of
+  // the rects, the scale and the registered mwms. The coverings used
+  // by the index queries are fully determined by the containing cells
+  // of the rects, so while the pivot stays inside the same cells and
+  // this state does not change, a rebuild is skipped as it would
+  // produce the same buckets (see Update()).
+  int64_t m_lastCells[RECT_SCALE_COUNT];
+  int m_lastScale;
+  vector<shared_ptr<MwmInfo>> m_lastMwms;
+
   using TFeatures = vector<uint32_t>;
   using TBucket = map<MwmSet::MwmId, TFeatures>;
 
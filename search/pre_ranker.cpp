@@ -1,14 +1,15 @@
 #include "search/pre_ranker.hpp"
 
-#include "search/dummy_rank_table.hpp"
 #include "search/lazy_centers_table.hpp"
 #include "search/nearby_points_sweeper.hpp"
 #include "search/pre_ranking_info.hpp"
+#include "search/stage_timer.hpp"
 
 #include "indexer/mwm_set.hpp"
 #include "indexer/rank_table.hpp"
 #include "indexer/scales.hpp"
 
+#include "base/limited_priority_queue.hpp"
 #include "base/random.hpp"
 #include "base/stl_helpers.hpp"
 
@@ -18,6 +19,11 @@ namespace search
 {
 namespace
 {
+// When the number of accumulated pre-results exceeds the batch size by this
+// factor, candidates are pre-selected on ranks and approximate distances
+// before the centers table is touched.
+size_t const kStreamedFilterScale = 4;
+
 struct LessFeatureID
 {
   using TValue = PreResult1;
@@ -82,31 +88,27 @@ void PreRanker::Init(Params const & params)
 void PreRanker::FillMissingFieldsInPreResults()
 {
   MwmSet::MwmId mwmId;
-  MwmSet::MwmHandle mwmHandle;
-  unique_ptr<RankTable> ranks = make_unique<DummyRankTable>();
-  unique_ptr<LazyCentersTable> centers;
+  RankTable const * ranks = nullptr;
+  LazyCentersTable * centers = nullptr;
 
   bool const fillCenters = (Size() > BatchSize());
 
   if (fillCenters)
     m_pivotFeatures.SetPosition(m_params.m_accuratePivotCenter, m_params.m_scale);
 
+  // Viewport search filters results by exact centers, so it always takes the
+  // full path.
+  if (!m_viewportSearch && Size() > kStreamedFilterScale * BatchSize())
+    SelectStreamedCandidates();
+
   ForEach([&](PreResult1 & r) {
     FeatureID const & id = r.GetId();
     PreRankingInfo & info = r.GetInfo();
-    if (id.m_mwmId != mwmId)
+    if (ranks == nullptr || id.m_mwmId != mwmId)
     {
       mwmId = id.m_mwmId;
-      mwmHandle = m_index.GetMwmHandleById(mwmId);
-      ranks.reset();
-      centers.reset();
-      if (mwmHandle.IsAlive())
-      {
-        ranks = RankTable::Load(mwmHandle.GetValue<MwmValue>()->m_cont);
-        centers = make_unique<LazyCentersTable>(*mwmHandle.GetValue<MwmValue>());
-      }
-      if (!ranks)
-        ranks = make_unique<DummyRankTable>();
+      ranks = &m_rankTables.Get(m_index, mwmId);
+      centers = m_centersTables.Get(m_index, mwmId);
     }
 
     info.m_rank = ranks->Get(id.m_index);
@@ -129,6 +131,41 @@ void PreRanker::FillMissingFieldsInPreResults()
   });
 }
 
+void PreRanker::SelectStreamedCandidates()
+{
+  MwmSet::MwmId mwmId;
+  RankTable const * ranks = nullptr;
+
+  using TLess = bool (*)(PreResult1 const &, PreResult1 const &);
+  my::limited_priority_queue<PreResult1, TLess> byDistance(BatchSize(),
+                                                           &PreResult1::LessDistance);
+  my::limited_priority_queue<PreResult1, TLess> byRank(BatchSize(), &PreResult1::LessRank);
+
+  ForEach([&](PreResult1 & r) {
+    FeatureID const & id = r.GetId();
+    PreRankingInfo & info = r.GetInfo();
+    if (ranks == nullptr || id.m_mwmId != mwmId)
+    {
+      mwmId = id.m_mwmId;
+      ranks = &m_rankTables.Get(m_index, mwmId);
+    }
+
+    // Ranks come from a plain in-memory table and the distance is estimated
+    // from the nested rects cache: both are cheap enough to compute for
+    // every accumulated result, unlike the centers.
+    info.m_rank = ranks->Get(id.m_index);
+    info.m_distanceToPivot = m_pivotFeatures.GetDistanceToFeatureMeters(id);
+
+    byDistance.push(r);
+    byRank.push(r);
+  });
+
+  // Filter() deduplicates the union by feature id.
+  vector<PreResult1> selected(byDistance.begin(), byDistance.end());
+  selected.insert(selected.end(), byRank.begin(), byRank.end());
+  m_results.swap(selected);
+}
+
 void PreRanker::Filter(bool viewportSearch)
 {
   using TSet = set<PreResult1, LessFeatureID>;
@@ -199,11 +236,14 @@ void PreRanker::Filter(bool viewportSearch)
 
 void PreRanker::UpdateResults(bool lastUpdate)
 {
-  FillMissingFieldsInPreResults();
-  Filter(m_viewportSearch);
-  m_numSentResults += m_results.size();
-  m_ranker.SetPreResults1(move(m_results));
-  m_results.clear();
+  {
+    StageTimer::ScopedStage stage(StageTimer::StagePreRanking);
+    FillMissingFieldsInPreResults();
+    Filter(m_viewportSearch);
+    m_numSentResults += m_results.size();
+    m_ranker.SetPreResults1(move(m_results));
+    m_results.clear();
+  }
   m_ranker.UpdateResults(lastUpdate);
 
   if (lastUpdate)
@@ -213,6 +253,8 @@ void PreRanker::UpdateResults(bool lastUpdate)
 void PreRanker::ClearCaches()
 {
   m_pivotFeatures.Clear();
+  m_rankTables.Clear();
+  m_centersTables.Clear();
   m_prevEmit.clear();
   m_currEmit.clear();
 }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "search/centers_table_cache.hpp"
 #include "search/intermediate_result.hpp"
 #include "search/nested_rects_cache.hpp"
+#include "search/rank_table_cache.hpp"
 #include "search/ranker.hpp"
 
 #include "indexer/index.hpp"
@@ -83,6 +85,12 @@ public:
   void ClearCaches();
 
 private:
+  // Shrinks m_results to the candidates that can survive Filter(): the best
+  // BatchSize() by rank and the best BatchSize() by approximate distance to
+  // the pivot. Used when the query matches many more features than a batch
+  // can hold, so that centers are loaded only for potential winners.
+  void SelectStreamedCandidates();
+
   void FilterForViewportSearch();
 
   Index const & m_index;
@@ -98,6 +106,16 @@ private:
   // Cache of nested rects used to estimate distance from a feature to the pivot.
   NestedRectsCache m_pivotFeatures;
 
+  // Cache of per-mwm rank tables. Ranks are looked up for every accumulated
+  // result in every batch, and loading a table pulls the whole ranks section
+  // in one sequential read, so it must not be repeated per batch.
+  RankTableCache m_rankTables;
+
+  // Cache of per-mwm centers tables. Tables decode centers in blocks and
+  // cache them, so they are kept across batches and queries just like the
+  // rank tables above.
+  CentersTableCache m_centersTables;
+
   // A set of ids for features that are emitted during the current search session.
   set<FeatureID> m_currEmit;
 
@@ -39,6 +39,7 @@
 #include "coding/multilang_utf8_string.hpp"
 #include "coding/reader_wrapper.hpp"
 
+#include "base/alloc_tracker.hpp"
 #include "base/assert.hpp"
 #include "base/logging.hpp"
 #include "base/macros.hpp"
@@ -255,7 +256,7 @@ void Processor::SetQuery(string const & query)
   // retrieve all tokens that start with a single hashtag and leave
   // them as is.
 
-  vector<strings::UniString> tokens;
+  buffer_vector<strings::UniString, 32> tokens;
   {
     search::DelimitersWithExceptions delims(vector<strings::UniChar>{'#'});
     SplitUniString(NormalizeAndSimplifyString(query), MakeBackInsertFunctor(tokens), delims);
@@ -423,6 +424,8 @@ void Processor::ForEachCategoryTypeFuzzy(StringSliceBase const & slice, ToDo &&
 
 void Processor::Search(SearchParams const & params, m2::RectD const & viewport)
 {
+  TRACK_ALLOCATIONS_SCOPE(my::AllocTracker::SubsystemSearch);
+
   SetMode(params.m_mode);
   bool const viewportSearch = m_mode == Mode::Viewport;
 
@@ -6,14 +6,16 @@
 
 namespace search
 {
-RankTable const & RankTableCache::Get(Index & index, TId const & mwmId)
+RankTable const & RankTableCache::Get(Index const & index, TId const & mwmId)
 {
   auto const it = m_ranks.find(TKey(mwmId));
   if (it != m_ranks.end())
     return *it->second;
 
   TKey handle(index.GetMwmHandleById(mwmId));
-  auto table = RankTable::Load(handle.GetValue<MwmValue>()->m_cont);
+  unique_ptr<RankTable> table;
+  if (handle.IsAlive())
+    table = RankTable::Load(handle.GetValue<MwmValue>()->m_cont);
   if (!table)
     table.reset(new DummyRankTable());
 
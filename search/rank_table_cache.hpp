@@ -27,7 +27,7 @@ class RankTableCache
 public:
   RankTableCache() = default;
 
-  RankTable const & Get(Index & index, TId const & mwmId);
+  RankTable const & Get(Index const & index, TId const & mwmId);
 
   void Remove(TId const & id);
   void Clear();
@@ -1,6 +1,7 @@
 #include "search/ranker.hpp"
 
 #include "search/emitter.hpp"
+#include "search/stage_timer.hpp"
 #include "search/string_intersection.hpp"
 #include "search/token_slice.hpp"
 #include "search/utils.hpp"
@@ -12,6 +13,7 @@
 
 #include "std/algorithm.hpp"
 #include "std/iterator.hpp"
+#include "std/numeric.hpp"
 #include "std/unique_ptr.hpp"
 
 namespace search
@@ -26,9 +28,8 @@ void UpdateNameScore(string const & name, TSlice const & slice, NameScore & best
     bestScore = score;
 }
 
-template <typename TSlice>
-void UpdateNameScore(vector<strings::UniString> const & tokens, TSlice const & slice,
-                     NameScore & bestScore)
+template <typename TTokens, typename TSlice>
+void UpdateNameScore(TTokens const & tokens, TSlice const & slice, NameScore & bestScore)
 {
   auto const score = GetNameScore(tokens, slice);
   if (score > bestScore)
@@ -42,12 +43,16 @@ NameScore GetNameScore(FeatureType const & ft, Geocoder::Params const & params,
   TokenSlice slice(params, range);
   TokenSliceNoCategories sliceNoCategories(params, range);
 
+  // Tokens of a single feature name fit into the inline buffer, so the
+  // whole per-language loop below does not allocate.
+  buffer_vector<strings::UniString, 8> tokens;
+
   for (auto const & lang : params.GetLangs())
   {
     string name;
     if (!ft.GetName(lang, name))
       continue;
-    vector<strings::UniString> tokens;
+    tokens.clear();
     PrepareStringForMatching(name, tokens);
 
     UpdateNameScore(tokens, slice, bestScore);
@@ -344,9 +349,25 @@ bool Ranker::IsResultExists(PreResult2 const & p, vector<IndexedValue> const & v
 void Ranker::MakePreResult2(Geocoder::Params const & geocoderParams, vector<IndexedValue> & cont)
 {
   PreResult2Maker maker(*this, m_index, m_infoGetter, geocoderParams);
-  for (auto const & r : m_preResults1)
+
+  // Results come in rank order, which is random access over the mwm
+  // files. Features are therefore loaded in ascending feature id order
+  // (sequential reads within each mwm, one loader per mwm), and the
+  // rank order is restored before filtering, so the duplicates filter
+  // below still prefers the higher-ranked result.
+  vector<size_t> order(m_preResults1.size());
+  iota(order.begin(), order.end(), 0);
+  sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs)
+       {
+         return m_preResults1[lhs].GetId() < m_preResults1[rhs].GetId();
+       });
+
+  vector<unique_ptr<PreResult2>> results(m_preResults1.size());
+  for (size_t i : order)
+    results[i] = maker(m_preResults1[i]);
+
+  for (auto & p : results)
   {
-    auto p = maker(r);
     if (!p)
       continue;
 
@@ -358,13 +379,13 @@ void Ranker::MakePreResult2(Geocoder::Params const & geocoderParams, vector<Inde
 
     if (!IsResultExists(*p, cont))
       cont.push_back(IndexedValue(move(p)));
-  };
+  }
 }
 
-Result Ranker::MakeResult(PreResult2 const & r) const
+Result Ranker::MakeResult(PreResult2 const & r, ReverseGeocoder::Address const * addr) const
 {
   Result res = r.GenerateFinalResult(m_infoGetter, &m_categories, &m_params.m_preferredTypes,
-                                     m_params.m_currentLocaleCode, &m_reverseGeocoder);
+                                     m_params.m_currentLocaleCode, &m_reverseGeocoder, addr);
   MakeResultHighlight(res);
   if (ftypes::IsLocalityChecker::Instance().GetType(r.GetTypes()) == ftypes::NONE)
   {
@@ -397,7 +418,7 @@ void Ranker::GetSuggestion(string const & name, string & suggest) const
 {
   // Splits result's name.
   search::Delimiters delims;
-  vector<strings::UniString> tokens;
+  buffer_vector<strings::UniString, 32> tokens;
   SplitUniString(NormalizeAndSimplifyString(name), MakeBackInsertFunctor(tokens), delims);
 
   // Finds tokens that are already present in the input query.
@@ -515,6 +536,8 @@ void Ranker::ProcessSuggestions(vector<IndexedValue> & vec) const
 
 void Ranker::UpdateResults(bool lastUpdate)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageRanking);
+
   BailIfCancelled();
 
   MakePreResult2(m_geocoderParams, m_tentativeResults);
@@ -534,6 +557,35 @@ void Ranker::UpdateResults(bool lastUpdate)
     ProcessSuggestions(m_tentativeResults);
   }
 
+  // Batch-resolve addresses for the results to be emitted, sharing
+  // loaded house -> street tables and street candidates between them
+  // instead of resolving one address per result.
+  vector<ReverseGeocoder::Address const *> addrs;
+  vector<ReverseGeocoder::Address> addrsStorage;
+  if (!m_params.m_viewportSearch)
+  {
+    size_t numResults = m_tentativeResults.size();
+    if (!lastUpdate)
+      numResults = min(numResults, kBatchSize);
+
+    vector<m2::PointD> centers;
+    vector<size_t> indexes;
+    for (size_t i = 0; i < numResults; ++i)
+    {
+      if ((*m_tentativeResults[i]).NeedAddress())
+      {
+        centers.push_back((*m_tentativeResults[i]).GetCenter());
+        indexes.push_back(i);
+      }
+    }
+
+    m_reverseGeocoder.GetNearbyAddresses(centers, addrsStorage);
+
+    addrs.assign(numResults, nullptr);
+    for (size_t i = 0; i < indexes.size(); ++i)
+      addrs[indexes[i]] = &addrsStorage[i];
+  }
+
   // Emit feature results.
   size_t count = m_emitter.GetResults().GetCount();
   size_t i = 0;
@@ -549,7 +601,8 @@ void Ranker::UpdateResults(bool lastUpdate)
           (*m_tentativeResults[i])
               .GenerateFinalResult(m_infoGetter, &m_categories, &m_params.m_preferredTypes,
                                    m_params.m_currentLocaleCode,
-                                   nullptr /* Viewport results don't need calculated address */));
+                                   nullptr /* Viewport results don't need calculated address */,
+                                   nullptr /* addr */));
     }
     else
     {
@@ -559,7 +612,7 @@ void Ranker::UpdateResults(bool lastUpdate)
       LOG(LDEBUG, (m_tentativeResults[i]));
 
       auto const & preResult2 = *m_tentativeResults[i];
-      if (m_emitter.AddResult(MakeResult(preResult2)))
+      if (m_emitter.AddResult(MakeResult(preResult2, i < addrs.size() ? addrs[i] : nullptr)))
         ++count;
     }
   }
@@ -574,5 +627,6 @@ void Ranker::UpdateResults(bool lastUpdate)
 void Ranker::ClearCaches()
 {
   m_localities.ClearCache();
+  m_reverseGeocoder.ClearCache();
 }
 }  // namespace search
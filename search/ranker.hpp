@@ -83,7 +83,8 @@ public:
 
   void MakePreResult2(Geocoder::Params const & params, vector<IndexedValue> & cont);
 
-  Result MakeResult(PreResult2 const & r) const;
+  Result MakeResult(PreResult2 const & r,
+                    ReverseGeocoder::Address const * addr = nullptr) const;
   void MakeResultHighlight(Result & res) const;
 
   void GetSuggestion(string const & name, string & suggest) const;
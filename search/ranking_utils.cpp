@@ -50,16 +50,6 @@ bool IsStopWord(UniString const & s)
   return kStopWords.count(s) > 0;
 }
 
-void PrepareStringForMatching(std::string const & name, std::vector<strings::UniString> & tokens)
-{
-  auto filter = [&tokens](strings::UniString const & token)
-  {
-    if (!IsStopWord(token))
-      tokens.push_back(token);
-  };
-  SplitUniString(NormalizeAndSimplifyString(name), filter, Delimiters());
-}
-
 string DebugPrint(NameScore score)
 {
   switch (score)
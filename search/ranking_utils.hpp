@@ -6,6 +6,7 @@
 #include "indexer/search_delimiters.hpp"
 #include "indexer/search_string_utils.hpp"
 
+#include "base/buffer_vector.hpp"
 #include "base/stl_add.hpp"
 #include "base/string_utils.hpp"
 
@@ -42,21 +43,21 @@ enum NameScore
 bool IsStopWord(strings::UniString const & s);
 
 // Normalizes, simplifies and splits string, removes stop-words.
-void PrepareStringForMatching(std::string const & name, std::vector<strings::UniString> & tokens);
-
-template <typename TSlice>
-NameScore GetNameScore(std::string const & name, TSlice const & slice)
+// |TTokens| may be any container of strings::UniString with push_back(),
+// e.g. a buffer_vector when the caller wants to avoid heap allocations.
+template <typename TTokens>
+void PrepareStringForMatching(std::string const & name, TTokens & tokens)
 {
-  if (slice.Empty())
-    return NAME_SCORE_ZERO;
-
-  std::vector<strings::UniString> tokens;
-  SplitUniString(NormalizeAndSimplifyString(name), MakeBackInsertFunctor(tokens), Delimiters());
-  return GetNameScore(tokens, slice);
+  auto filter = [&tokens](strings::UniString const & token)
+  {
+    if (!IsStopWord(token))
+      tokens.push_back(token);
+  };
+  SplitUniString(NormalizeAndSimplifyStringCached(name), filter, Delimiters());
 }
 
-template <typename TSlice>
-NameScore GetNameScore(std::vector<strings::UniString> const & tokens, TSlice const & slice)
+template <typename TTokens, typename TSlice>
+NameScore GetNameScore(TTokens const & tokens, TSlice const & slice)
 {
   if (slice.Empty())
     return NAME_SCORE_ZERO;
@@ -91,5 +92,19 @@ NameScore GetNameScore(std::vector<strings::UniString> const & tokens, TSlice co
   return score;
 }
 
+template <typename TSlice>
+NameScore GetNameScore(std::string const & name, TSlice const & slice)
+{
+  if (slice.Empty())
+    return NAME_SCORE_ZERO;
+
+  // Feature names are short, so tokens fit into the inline buffer
+  // and no allocation takes place here.
+  buffer_vector<strings::UniString, 8> tokens;
+  SplitUniString(NormalizeAndSimplifyStringCached(name), MakeBackInsertFunctor(tokens),
+                 Delimiters());
+  return GetNameScore(tokens, slice);
+}
+
 string DebugPrint(NameScore score);
 }  // namespace search
@@ -0,0 +1,200 @@
+#include "search/result_saver.hpp"
+#include "search/result.hpp"
+
+#include "platform/settings.hpp"
+
+#include "coding/base64.hpp"
+#include "coding/read_write_utils.hpp"
+#include "coding/reader.hpp"
+#include "coding/write_to_sink.hpp"
+#include "coding/writer.hpp"
+
+#include "base/logging.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/limits.hpp"
+
+namespace
+{
+char constexpr kSettingsKey[] = "UserSelectedResults";
+uint8_t constexpr kFormatVersion = 1;
+size_t constexpr kMaxSavedResultsCount = 10;
+
+// Reader from memory that throws exceptions, so corrupted settings data
+// can not read out of bounds (see the same approach in query_saver.cpp).
+class SecureMemReader : public Reader
+{
+  void CheckPosAndSize(uint64_t pos, uint64_t size) const
+  {
+    if (pos + size > m_size || size > numeric_limits<size_t>::max())
+      MYTHROW(SizeException, (pos, size, m_size));
+  }
+
+public:
+  SecureMemReader(void const * pData, size_t size)
+    : m_pData(static_cast<char const *>(pData)), m_size(size)
+  {
+  }
+
+  inline uint64_t Size() const override
+  {
+    return m_size;
+  }
+
+  inline void Read(uint64_t pos, void * p, size_t size) const override
+  {
+    CheckPosAndSize(pos, size);
+    memcpy(p, m_pData + pos, size);
+  }
+
+  inline unique_ptr<Reader> CreateSubReader(uint64_t pos, uint64_t size) const override
+  {
+    CheckPosAndSize(pos, size);
+    return make_unique<SecureMemReader>(m_pData + pos, static_cast<size_t>(size));
+  }
+
+private:
+  char const * m_pData;
+  size_t m_size;
+};
+
+template <class TSink>
+void WriteDouble(TSink & sink, double d)
+{
+  double const t = SwapIfBigEndian(d);
+  sink.Write(&t, sizeof(t));
+}
+}  // namespace
+
+namespace search
+{
+ResultSaver::ResultSaver()
+{
+  Load();
+}
+
+void ResultSaver::Add(Result const & result)
+{
+  if (result.GetResultType() != Result::RESULT_FEATURE)
+    return;
+
+  FeatureID const & id = result.GetFeatureID();
+
+  SavedResult saved;
+  saved.m_mwmName = id.GetMwmName();
+  saved.m_mwmVersion = id.GetMwmVersion();
+  saved.m_featureIndex = id.m_index;
+  saved.m_center = result.GetFeatureCenter();
+  saved.m_title = result.GetString();
+  saved.m_address = result.GetAddress();
+  saved.m_featureType = result.GetFeatureType();
+
+  Add(saved);
+}
+
+void ResultSaver::Add(SavedResult const & result)
+{
+  // Remove items if needed.
+  auto const it = find_if(m_results.begin(), m_results.end(), [&result](SavedResult const & r)
+  {
+    return result.IsSameFeature(r);
+  });
+  if (it != m_results.end())
+    m_results.erase(it);
+  else if (m_results.size() >= kMaxSavedResultsCount)
+    m_results.pop_back();
+
+  // Add new result and save it to drive.
+  m_results.push_front(result);
+  Save();
+}
+
+void ResultSaver::RemoveObsolete(TIsValidFn const & isValid)
+{
+  size_t const oldSize = m_results.size();
+  m_results.remove_if([&isValid](SavedResult const & r) { return !isValid(r); });
+  if (m_results.size() != oldSize)
+    Save();
+}
+
+void ResultSaver::Clear()
+{
+  m_results.clear();
+  settings::Delete(kSettingsKey);
+}
+
+void ResultSaver::Serialize(string & data) const
+{
+  vector<uint8_t> rawData;
+  MemWriter<vector<uint8_t>> writer(rawData);
+  WriteToSink(writer, kFormatVersion);
+  WriteToSink(writer, static_cast<uint32_t>(m_results.size()));
+  for (auto const & r : m_results)
+  {
+    rw::Write(writer, r.m_mwmName);
+    WriteToSink(writer, r.m_mwmVersion);
+    WriteToSink(writer, r.m_featureIndex);
+    WriteDouble(writer, r.m_center.x);
+    WriteDouble(writer, r.m_center.y);
+    rw::Write(writer, r.m_title);
+    rw::Write(writer, r.m_address);
+    rw::Write(writer, r.m_featureType);
+  }
+  data = base64::Encode(string(rawData.begin(), rawData.end()));
+}
+
+void ResultSaver::Deserialize(string const & data)
+{
+  string const decodedData = base64::Decode(data);
+  SecureMemReader rawReader(decodedData.c_str(), decodedData.size());
+  ReaderSource<SecureMemReader> reader(rawReader);
+
+  uint8_t const version = ReadPrimitiveFromSource<uint8_t>(reader);
+  if (version != kFormatVersion)
+  {
+    LOG(LWARNING, ("Unsupported saved results version:", version));
+    return;
+  }
+
+  uint32_t count = ReadPrimitiveFromSource<uint32_t>(reader);
+  count = min(count, static_cast<uint32_t>(kMaxSavedResultsCount));
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    SavedResult r;
+    rw::Read(reader, r.m_mwmName);
+    r.m_mwmVersion = ReadPrimitiveFromSource<int64_t>(reader);
+    r.m_featureIndex = ReadPrimitiveFromSource<uint32_t>(reader);
+    r.m_center.x = ReadPrimitiveFromSource<double>(reader);
+    r.m_center.y = ReadPrimitiveFromSource<double>(reader);
+    rw::Read(reader, r.m_title);
+    rw::Read(reader, r.m_address);
+    rw::Read(reader, r.m_featureType);
+    m_results.push_back(r);
+  }
+}
+
+void ResultSaver::Save()
+{
+  string data;
+  Serialize(data);
+  settings::Set(kSettingsKey, data);
+}
+
+void ResultSaver::Load()
+{
+  string data;
+  settings::Get(kSettingsKey, data);
+  if (data.empty())
+    return;
+  try
+  {
+    Deserialize(data);
+  }
+  catch (Reader::Exception const & /* exception */)
+  {
+    Clear();
+    LOG(LWARNING, ("Saved search results data corrupted! Creating new one."));
+  }
+}
+}  // namespace search
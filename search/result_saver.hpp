@@ -0,0 +1,69 @@
+#pragma once
+
+#include "geometry/point2d.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/function.hpp"
+#include "std/list.hpp"
+#include "std/string.hpp"
+
+namespace search
+{
+class Result;
+
+/// Saves the results the user has chosen so the zero-query search screen
+/// can be rendered straight from disk, without running the search engine.
+class ResultSaver
+{
+public:
+  struct SavedResult
+  {
+    /// Mwm the feature comes from and the mwm version the entry was saved
+    /// with. An entry becomes obsolete when the map is deleted or updated.
+    string m_mwmName;
+    int64_t m_mwmVersion = 0;
+    uint32_t m_featureIndex = 0;
+
+    m2::PointD m_center = m2::PointD(0.0, 0.0);
+
+    /// Display data copied from the chosen search result.
+    string m_title;
+    string m_address;
+    string m_featureType;
+
+    bool IsSameFeature(SavedResult const & r) const
+    {
+      return m_mwmName == r.m_mwmName && m_featureIndex == r.m_featureIndex;
+    }
+  };
+
+  using TIsValidFn = function<bool(SavedResult const &)>;
+
+  ResultSaver();
+
+  /// Saves a chosen result. Only results with a feature are saved.
+  void Add(Result const & result);
+  /// Returns saved results from the most recently to the least recently chosen.
+  /// @see kMaxSavedResultsCount in implementation file.
+  list<SavedResult> const & Get() const { return m_results; }
+  /// Drops the entries rejected by isValid (e.g. whose mwm was deleted
+  /// or updated since the entry was saved).
+  void RemoveObsolete(TIsValidFn const & isValid);
+  /// Clear saved results storage. All data will be lost.
+  void Clear();
+
+  /// This function is public for unit tests only.
+  /// You don't need to call it from client code.
+  void Add(SavedResult const & result);
+
+private:
+  friend void UnitTest_ResultSaverSerializerTest();
+  void Serialize(string & data) const;
+  void Deserialize(string const & data);
+
+  void Save();
+  void Load();
+
+  list<SavedResult> m_results;
+};
+}  // namespace search
@@ -5,6 +5,7 @@
 #include "search/interval_set.hpp"
 #include "search/mwm_context.hpp"
 #include "search/search_index_values.hpp"
+#include "search/stage_timer.hpp"
 #include "search/search_trie.hpp"
 #include "search/token_slice.hpp"
 
@@ -107,6 +108,27 @@ private:
 
 unique_ptr<coding::CompressedBitVector> SortFeaturesAndBuildCBV(vector<uint64_t> && features)
 {
+  if (!features.empty())
+  {
+    uint64_t const maxFeature = *max_element(features.begin(), features.end());
+
+    // When the collected set is dense enough for DenseCBV, accumulate
+    // it into a plain bitmap: setting bits is O(n) while sorting
+    // feature ids is O(n * log(n)), and duplicates just hit the same
+    // bit. The threshold mirrors the 30% density check of the CBV
+    // builder; it is estimated before deduplication, so the builder
+    // re-checks it on the real population count and falls back to a
+    // sparse representation when duplicates inflated the estimate.
+    if (features.size() * 10 >= (maxFeature + 1) * 3)
+    {
+      vector<uint64_t> bitGroups(maxFeature / coding::DenseCBV::kBlockSize + 1);
+      for (uint64_t const f : features)
+        bitGroups[f / coding::DenseCBV::kBlockSize] |= static_cast<uint64_t>(1)
+                                                       << (f % coding::DenseCBV::kBlockSize);
+      return coding::CompressedBitVectorBuilder::FromBitGroups(move(bitGroups));
+    }
+  }
+
   my::SortUnique(features);
   return coding::CompressedBitVectorBuilder::FromBitPositions(move(features));
 }
@@ -177,7 +199,7 @@ bool MatchFeatureByNameAndType(FeatureType const & ft, SearchTrieRequest<DFA> co
 
 bool MatchFeatureByPostcode(FeatureType const & ft, TokenSlice const & slice)
 {
-  string const postcode = ft.GetMetadata().Get(feature::Metadata::FMD_POSTCODE);
+  string const postcode = ft.GetHotMetadata().Get(feature::Metadata::FMD_POSTCODE);
   vector<UniString> tokens;
   NormalizeAndTokenizeString(postcode, tokens, Delimiters());
   if (slice.Size() > tokens.size())
@@ -337,6 +359,7 @@ unique_ptr<coding::CompressedBitVector> RetrieveAddressFeatures(
     MwmContext const & context, my::Cancellable const & cancellable,
     SearchTrieRequest<LevenshteinDFA> const & request)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageRetrieval);
   Selector<RetrieveAddressFeaturesAdaptor> selector;
   return selector(context, cancellable, request);
 }
@@ -345,6 +368,7 @@ unique_ptr<coding::CompressedBitVector> RetrieveAddressFeatures(
     MwmContext const & context, my::Cancellable const & cancellable,
     SearchTrieRequest<PrefixDFAModifier<LevenshteinDFA>> const & request)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageRetrieval);
   Selector<RetrieveAddressFeaturesAdaptor> selector;
   return selector(context, cancellable, request);
 }
@@ -352,6 +376,7 @@ unique_ptr<coding::CompressedBitVector> RetrieveAddressFeatures(
 unique_ptr<coding::CompressedBitVector> RetrievePostcodeFeatures(
     MwmContext const & context, my::Cancellable const & cancellable, TokenSlice const & slice)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageRetrieval);
   Selector<RetrievePostcodeFeaturesAdaptor> selector;
   return selector(context, cancellable, slice);
 }
@@ -360,6 +385,7 @@ unique_ptr<coding::CompressedBitVector> RetrieveGeometryFeatures(
     MwmContext const & context, my::Cancellable const & cancellable, m2::RectD const & rect,
     int scale)
 {
+  StageTimer::ScopedStage stage(StageTimer::StageRetrieval);
   return RetrieveGeometryFeaturesImpl(context, cancellable, rect, scale);
 }
 } // namespace search
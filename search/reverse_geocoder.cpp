@@ -21,6 +21,9 @@ size_t constexpr kSimilarityThresholdPercent = 10;
 int constexpr kQueryScale = scales::GetUpperScale();
 /// Max number of tries (nearest houses with housenumber) to check when getting point address.
 size_t constexpr kMaxNumTriesToApproxAddress = 10;
+/// Max number of cached street queries. The cache is dropped entirely when
+/// the limit is reached.
+size_t constexpr kMaxCachedStreetQueries = 512;
 } // namespace
 
 ReverseGeocoder::ReverseGeocoder(Index const & index) : m_index(index) {}
@@ -28,6 +31,19 @@ ReverseGeocoder::ReverseGeocoder(Index const & index) : m_index(index) {}
 void ReverseGeocoder::GetNearbyStreets(MwmSet::MwmId const & id, m2::PointD const & center,
                                        vector<Street> & streets) const
 {
+  {
+    auto const cacheIt = m_streetsCache.find(id);
+    if (cacheIt != m_streetsCache.end())
+    {
+      auto const it = cacheIt->second.find(center);
+      if (it != cacheIt->second.end())
+      {
+        streets = it->second;
+        return;
+      }
+    }
+  }
+
   m2::RectD const rect = GetLookupRect(center, kLookupRadiusM);
 
   auto const addStreet = [&](FeatureType & ft)
@@ -52,9 +68,20 @@ void ReverseGeocoder::GetNearbyStreets(MwmSet::MwmId const & id, m2::PointD cons
   {
     search::MwmContext(move(mwmHandle)).ForEachFeature(rect, addStreet);
     sort(streets.begin(), streets.end(), my::LessBy(&Street::m_distanceMeters));
+
+    if (m_numCachedQueries >= kMaxCachedStreetQueries)
+      ClearCache();
+    m_streetsCache[id].emplace(center, streets);
+    ++m_numCachedQueries;
   }
 }
 
+void ReverseGeocoder::ClearCache() const
+{
+  m_streetsCache.clear();
+  m_numCachedQueries = 0;
+}
+
 void ReverseGeocoder::GetNearbyStreets(FeatureType & ft, vector<Street> & streets) const
 {
   ASSERT(ft.GetID().IsValid(), ());
@@ -109,11 +136,36 @@ ReverseGeocoder::GetNearbyFeatureStreets(FeatureType & ft) const
 }
 
 void ReverseGeocoder::GetNearbyAddress(m2::PointD const & center, Address & addr) const
+{
+  HouseTable table(m_index);
+  GetNearbyAddress(table, center, addr);
+}
+
+void ReverseGeocoder::GetNearbyAddresses(vector<m2::PointD> const & centers,
+                                         vector<Address> & addrs) const
+{
+  addrs.clear();
+  addrs.resize(centers.size());
+
+  HouseTable table(m_index);
+  for (size_t i = 0; i < centers.size(); ++i)
+    GetNearbyAddress(table, centers[i], addrs[i]);
+}
+
+bool ReverseGeocoder::GetExactAddress(FeatureType const & ft, Address & addr) const
+{
+  if (ft.GetHouseNumber().empty())
+    return false;
+  HouseTable table(m_index);
+  return GetNearbyAddress(table, FromFeature(ft, 0.0 /* distMeters */), addr);
+}
+
+void ReverseGeocoder::GetNearbyAddress(HouseTable & table, m2::PointD const & center,
+                                       Address & addr) const
 {
   vector<Building> buildings;
   GetNearbyBuildings(center, buildings);
 
-  HouseTable table(m_index);
   size_t triesCount = 0;
 
   for (auto const & b : buildings)
@@ -125,14 +177,6 @@ void ReverseGeocoder::GetNearbyAddress(m2::PointD const & center, Address & addr
   }
 }
 
-bool ReverseGeocoder::GetExactAddress(FeatureType const & ft, Address & addr) const
-{
-  if (ft.GetHouseNumber().empty())
-    return false;
-  HouseTable table(m_index);
-  return GetNearbyAddress(table, FromFeature(ft, 0.0 /* distMeters */), addr);
-}
-
 bool ReverseGeocoder::GetNearbyAddress(HouseTable & table, Building const & bld,
                                        Address & addr) const
 {
@@ -191,18 +235,23 @@ m2::RectD ReverseGeocoder::GetLookupRect(m2::PointD const & center, double radiu
 
 bool ReverseGeocoder::HouseTable::Get(FeatureID const & fid, uint32_t & streetIndex)
 {
-  if (!m_table || m_handle.GetId() != fid.m_mwmId)
+  auto it = m_tables.find(fid.m_mwmId);
+  if (it == m_tables.end())
   {
-    m_handle = m_index.GetMwmHandleById(fid.m_mwmId);
-    if (!m_handle.IsAlive())
-    {
-      LOG(LWARNING, ("MWM", fid, "is dead"));
-      return false;
-    }
-    m_table = search::HouseToStreetTable::Load(*m_handle.GetValue<MwmValue>());
+    Entry entry;
+    entry.m_handle = m_index.GetMwmHandleById(fid.m_mwmId);
+    if (entry.m_handle.IsAlive())
+      entry.m_table = search::HouseToStreetTable::Load(*entry.m_handle.GetValue<MwmValue>());
+    it = m_tables.emplace(fid.m_mwmId, move(entry)).first;
+  }
+
+  if (!it->second.m_table)
+  {
+    LOG(LWARNING, ("MWM", fid, "is dead"));
+    return false;
   }
 
-  return m_table->Get(fid.m_index, streetIndex);
+  return it->second.m_table->Get(fid.m_index, streetIndex);
 }
 
 string DebugPrint(ReverseGeocoder::Object const & obj)
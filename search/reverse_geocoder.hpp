@@ -4,8 +4,11 @@
 
 #include "indexer/feature_decl.hpp"
 
+#include "geometry/point2d.hpp"
+
 #include "base/string_utils.hpp"
 
+#include "std/map.hpp"
 #include "std/string.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
@@ -89,6 +92,15 @@ public:
 
   /// @return The nearest exact address where building has house number and valid street match.
   void GetNearbyAddress(m2::PointD const & center, Address & addr) const;
+
+  /// Batch variant of GetNearbyAddress(): resolves addresses for all
+  /// |centers| in one pass, sharing loaded house -> street tables and
+  /// cached street candidates between the points. |addrs| is resized
+  /// to match |centers|, keeping the order.
+  void GetNearbyAddresses(vector<m2::PointD> const & centers, vector<Address> & addrs) const;
+
+  /// Drops all cached street queries.
+  void ClearCache() const;
   /// @param addr (out) the exact address of a feature.
   /// @returns false if  can't extruct address or ft have no house number.
   bool GetExactAddress(FeatureType const & ft, Address & addr) const;
@@ -96,18 +108,51 @@ public:
 private:
 
   /// Helper class to incapsulate house 2 street table reloading.
+  /// Loaded tables are kept per mwm, so a table shared between
+  /// several lookups (see GetNearbyAddresses()) is loaded at most
+  /// once per mwm.
   class HouseTable
   {
+    struct Entry
+    {
+      MwmSet::MwmHandle m_handle;
+      unique_ptr<search::HouseToStreetTable> m_table;
+    };
+
     Index const & m_index;
-    unique_ptr<search::HouseToStreetTable> m_table;
-    MwmSet::MwmHandle m_handle;
+    map<MwmSet::MwmId, Entry> m_tables;
   public:
     explicit HouseTable(Index const & index) : m_index(index) {}
     bool Get(FeatureID const & fid, uint32_t & streetIndex);
   };
 
+  void GetNearbyAddress(HouseTable & table, m2::PointD const & center, Address & addr) const;
   bool GetNearbyAddress(HouseTable & table, Building const & bld, Address & addr) const;
 
+  struct LessPoint
+  {
+    bool operator()(m2::PointD const & lhs, m2::PointD const & rhs) const
+    {
+      if (lhs.x != rhs.x)
+        return lhs.x < rhs.x;
+      return lhs.y < rhs.y;
+    }
+  };
+
+  /// Results of GetNearbyStreets() keyed by the query point. Query points are
+  /// feature centers, so repeated lookups around the same places (consecutive
+  /// GPS fixes, ranking of similar result sets) hit the cache instead of
+  /// rescanning features.
+  ///
+  /// *NOTE* The house -> street table stores indices into the street vector
+  /// exactly as it was produced at mwm generation time, so the cached value
+  /// must be the unmodified result of the scan: no truncation, reordering or
+  /// geometry simplification is allowed here.
+  using TStreetsCache = map<MwmSet::MwmId, map<m2::PointD, vector<Street>, LessPoint>>;
+
+  mutable TStreetsCache m_streetsCache;
+  mutable size_t m_numCachedQueries = 0;
+
   /// @return Sorted by distance houses vector with valid house number.
   void GetNearbyBuildings(m2::PointD const & center, vector<Building> & buildings) const;
 
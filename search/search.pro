@@ -15,6 +15,7 @@ HEADERS += \
     categories_cache.hpp \
     categories_set.hpp \
     cbv.hpp \
+    centers_table_cache.hpp \
     common.hpp \
     displayed_categories.hpp \
     downloader_search_callback.hpp \
@@ -64,6 +65,7 @@ HEADERS += \
     ranking_info.hpp \
     ranking_utils.hpp \
     result.hpp \
+    result_saver.hpp \
     retrieval.hpp \
     reverse_geocoder.hpp \
     search_index_values.hpp \
@@ -73,18 +75,21 @@ HEADERS += \
     street_vicinity_loader.hpp \
     streets_matcher.hpp \
     string_intersection.hpp \
+    stage_timer.hpp \
     suggest.hpp \
     token_range.hpp \
     token_slice.hpp \
     types_skipper.hpp \
     utils.hpp \
     viewport_search_callback.hpp \
-    viewport_search_params.hpp
+    viewport_search_params.hpp \
+    viewport_search_policy.hpp
 
 SOURCES += \
     approximate_string_match.cpp \
     categories_cache.cpp \
     cbv.cpp \
+    centers_table_cache.cpp \
     displayed_categories.cpp \
     downloader_search_callback.cpp \
     dummy_rank_table.cpp \
@@ -128,12 +133,15 @@ SOURCES += \
     ranking_info.cpp \
     ranking_utils.cpp \
     result.cpp \
+    result_saver.cpp \
     retrieval.cpp \
     reverse_geocoder.cpp \
     search_params.cpp \
+    stage_timer.cpp \
     street_vicinity_loader.cpp \
     streets_matcher.cpp \
     token_slice.cpp \
     types_skipper.cpp \
     utils.cpp \
-    viewport_search_callback.cpp
+    viewport_search_callback.cpp \
+    viewport_search_policy.cpp
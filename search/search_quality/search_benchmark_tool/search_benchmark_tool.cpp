@@ -0,0 +1,334 @@
+#include "search/processor_factory.hpp"
+#include "search/result.hpp"
+#include "search/search_params.hpp"
+#include "search/search_quality/helpers.hpp"
+#include "search/search_tests_support/test_search_engine.hpp"
+#include "search/search_tests_support/test_search_request.hpp"
+#include "search/stage_timer.hpp"
+
+#include "indexer/classificator_loader.hpp"
+
+#include "storage/country_info_getter.hpp"
+#include "storage/storage.hpp"
+
+#include "platform/country_file.hpp"
+#include "platform/local_country_file.hpp"
+#include "platform/local_country_file_utils.hpp"
+#include "platform/platform.hpp"
+
+#include "coding/file_name_utils.hpp"
+
+#include "geometry/rect2d.hpp"
+
+#include "base/logging.hpp"
+#include "base/macros.hpp"
+#include "base/stl_add.hpp"
+#include "base/string_utils.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/array.hpp"
+#include "std/chrono.hpp"
+#include "std/fstream.hpp"
+#include "std/iomanip.hpp"
+#include "std/iostream.hpp"
+#include "std/limits.hpp"
+#include "std/sstream.hpp"
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+#include "defines.hpp"
+
+#include "3party/gflags/src/gflags/gflags.h"
+
+using namespace search::tests_support;
+using namespace search;
+using namespace storage;
+
+// A latency benchmark replaying recorded (query, viewport, position)
+// tuples against local mwms. Complements the quality tooling next door:
+// quality answers "are the results right", this answers "how long did
+// every stage take". The per-stage breakdown comes from
+// search::StageTimer, which is reset around every request.
+//
+// Corpus format - one tab-separated request per line:
+//   <query>\t<minX> <minY> <maxX> <maxY>[\t<lat> <lon>]
+// The viewport is in mercator, the optional position is in degrees.
+//
+// To compare two binaries, run the old one with --report_path, then the
+// new one with the same corpus and --base_report pointing to the saved
+// report.
+
+DEFINE_string(data_path, "", "Path to data directory (resources dir)");
+DEFINE_string(locale, "en", "Locale of all the search queries");
+DEFINE_string(mwm_list_path, "",
+              "Path to a file containing the names of available mwms, one per line");
+DEFINE_string(mwm_path, "", "Path to mwm files (writable dir)");
+DEFINE_string(corpus_path, "", "Path to the file with recorded requests");
+DEFINE_int32(warmup, 1, "Number of untimed passes over the corpus to warm caches up");
+DEFINE_string(report_path, "", "File per-request timings will be written to");
+DEFINE_string(base_report, "", "Report saved by another binary to diff against");
+
+namespace
+{
+size_t const kNumTimings = StageTimer::StagesCount + 1;  // stages + total
+
+struct Request
+{
+  string m_query;
+  m2::RectD m_viewport;
+  bool m_hasPosition = false;
+  double m_lat = 0.0;
+  double m_lon = 0.0;
+};
+
+// Timings of one processed request, microseconds. The total comes
+// first, stages follow in the StageTimer::Stage order.
+using Timings = array<uint64_t, kNumTimings>;
+
+char const * GetTimingName(size_t index)
+{
+  if (index == 0)
+    return "Total";
+  return StageTimer::GetStageName(static_cast<StageTimer::Stage>(index - 1));
+}
+
+void DidDownload(TCountryId const & /* countryId */,
+                 shared_ptr<platform::LocalCountryFile> const & /* localFile */)
+{
+}
+
+bool WillDelete(TCountryId const & /* countryId */,
+                shared_ptr<platform::LocalCountryFile> const & /* localFile */)
+{
+  return false;
+}
+
+void ReadStringsFromFile(string const & path, vector<string> & result)
+{
+  ifstream stream(path.c_str());
+  CHECK(stream.is_open(), ("Can't open", path));
+
+  string s;
+  while (getline(stream, s))
+  {
+    strings::Trim(s);
+    if (!s.empty())
+      result.emplace_back(s);
+  }
+}
+
+bool ParseRequest(string const & line, Request & request)
+{
+  vector<string> parts;
+  istringstream iss(line);
+  string part;
+  while (getline(iss, part, '\t'))
+    parts.push_back(part);
+
+  if (parts.size() < 2 || parts.size() > 3)
+    return false;
+
+  request.m_query = parts[0];
+
+  double minX, minY, maxX, maxY;
+  {
+    istringstream vs(parts[1]);
+    if (!(vs >> minX >> minY >> maxX >> maxY))
+      return false;
+  }
+  request.m_viewport = m2::RectD(minX, minY, maxX, maxY);
+  if (!request.m_viewport.IsValid())
+    return false;
+
+  request.m_hasPosition = parts.size() == 3;
+  if (request.m_hasPosition)
+  {
+    istringstream ps(parts[2]);
+    if (!(ps >> request.m_lat >> request.m_lon))
+      return false;
+  }
+  return true;
+}
+
+Timings RunRequest(TestSearchEngine & engine, Request const & request)
+{
+  SearchParams params;
+  params.m_query = request.m_query;
+  params.m_inputLocale = FLAGS_locale;
+  params.m_mode = Mode::Everywhere;
+  // The engine must not skip or debounce replayed requests, otherwise
+  // the measurement is about the throttling policy, not the stages.
+  params.m_forceSearch = true;
+  params.m_suggestsEnabled = false;
+  if (request.m_hasPosition)
+    params.SetPosition(request.m_lat, request.m_lon);
+
+  auto & stages = StageTimer::Instance();
+  stages.Reset();
+
+  TestSearchRequest search(engine, params, request.m_viewport);
+  search.Run();
+
+  Timings timings;
+  timings[0] = duration_cast<std::chrono::microseconds>(search.ResponseTime()).count();
+  for (size_t stage = 0; stage < StageTimer::StagesCount; ++stage)
+    timings[stage + 1] = stages.Get(static_cast<StageTimer::Stage>(stage));
+  return timings;
+}
+
+uint64_t Percentile(vector<uint64_t> sorted, double p)
+{
+  CHECK(!sorted.empty(), ());
+  size_t const index =
+      min(sorted.size() - 1, static_cast<size_t>(p * static_cast<double>(sorted.size() - 1)));
+  return sorted[index];
+}
+
+// Prints p50/p90/p95/p99/max for every timing column, and when |base|
+// is non-empty - the same percentiles of the base report with deltas.
+void PrintReport(vector<Timings> const & current, vector<Timings> const & base)
+{
+  double const kPercentiles[] = {0.5, 0.9, 0.95, 0.99, 1.0};
+  char const * const kPercentileNames[] = {"p50", "p90", "p95", "p99", "max"};
+
+  cout << fixed << setprecision(1);
+  for (size_t col = 0; col < kNumTimings; ++col)
+  {
+    vector<uint64_t> currentCol, baseCol;
+    for (auto const & t : current)
+      currentCol.push_back(t[col]);
+    for (auto const & t : base)
+      baseCol.push_back(t[col]);
+    sort(currentCol.begin(), currentCol.end());
+    sort(baseCol.begin(), baseCol.end());
+
+    cout << GetTimingName(col) << ":" << endl;
+    for (size_t i = 0; i < ARRAY_SIZE(kPercentiles); ++i)
+    {
+      double const curMs = Percentile(currentCol, kPercentiles[i]) / 1000.0;
+      cout << "  " << kPercentileNames[i] << " " << setw(9) << curMs << " ms";
+      if (!baseCol.empty())
+      {
+        double const baseMs = Percentile(baseCol, kPercentiles[i]) / 1000.0;
+        cout << " (base " << setw(9) << baseMs << " ms, " << std::showpos
+             << curMs - baseMs << std::noshowpos << " ms)";
+      }
+      cout << endl;
+    }
+  }
+}
+
+void SaveReport(string const & path, vector<Timings> const & timings)
+{
+  ofstream stream(path.c_str());
+  CHECK(stream.is_open(), ("Can't open", path));
+  for (auto const & t : timings)
+  {
+    for (size_t col = 0; col < kNumTimings; ++col)
+      stream << (col == 0 ? "" : " ") << t[col];
+    stream << "\n";
+  }
+  CHECK(stream.good(), ("Can't write to", path));
+}
+
+void LoadReport(string const & path, vector<Timings> & timings)
+{
+  vector<string> lines;
+  ReadStringsFromFile(path, lines);
+  for (auto const & line : lines)
+  {
+    Timings t;
+    istringstream iss(line);
+    for (size_t col = 0; col < kNumTimings; ++col)
+      CHECK(iss >> t[col], ("Malformed report line:", line));
+    timings.push_back(t);
+  }
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  ChangeMaxNumberOfOpenFiles(kMaxOpenFiles);
+
+  ios_base::sync_with_stdio(false);
+  Platform & platform = GetPlatform();
+
+  google::SetUsageMessage("Search latency benchmark.");
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  CHECK(!FLAGS_corpus_path.empty(), ("Pass a corpus via --corpus_path."));
+
+  string countriesFile = COUNTRIES_FILE;
+  if (!FLAGS_data_path.empty())
+  {
+    platform.SetResourceDir(FLAGS_data_path);
+    countriesFile = my::JoinFoldersToPath(FLAGS_data_path, COUNTRIES_FILE);
+  }
+
+  if (!FLAGS_mwm_path.empty())
+    platform.SetWritableDirForTests(FLAGS_mwm_path);
+
+  LOG(LINFO, ("writable dir =", platform.WritableDir()));
+  LOG(LINFO, ("resources dir =", platform.ResourcesDir()));
+
+  Storage storage(countriesFile, FLAGS_mwm_path);
+  storage.Init(&DidDownload, &WillDelete);
+  auto infoGetter = CountryInfoReader::CreateCountryInfoReader(platform);
+  infoGetter->InitAffiliationsInfo(&storage.GetAffiliations());
+
+  classificator::Load();
+
+  TestSearchEngine engine(move(infoGetter), make_unique<ProcessorFactory>(), Engine::Params{});
+
+  vector<platform::LocalCountryFile> mwms;
+  if (!FLAGS_mwm_list_path.empty())
+  {
+    vector<string> availableMwms;
+    ReadStringsFromFile(FLAGS_mwm_list_path, availableMwms);
+    for (auto const & countryName : availableMwms)
+      mwms.emplace_back(platform.WritableDir(), platform::CountryFile(countryName), 0);
+  }
+  else
+  {
+    platform::FindAllLocalMapsAndCleanup(numeric_limits<int64_t>::max() /* the latest version */,
+                                         mwms);
+  }
+  for (auto & mwm : mwms)
+  {
+    mwm.SyncWithDisk();
+    engine.RegisterMap(mwm);
+  }
+
+  vector<string> lines;
+  ReadStringsFromFile(FLAGS_corpus_path, lines);
+
+  vector<Request> requests;
+  for (auto const & line : lines)
+  {
+    Request request;
+    CHECK(ParseRequest(line, request), ("Malformed corpus line:", line));
+    requests.push_back(request);
+  }
+  cout << "Replaying " << requests.size() << " requests over " << mwms.size() << " mwms" << endl;
+
+  for (int pass = 0; pass < FLAGS_warmup; ++pass)
+  {
+    for (auto const & request : requests)
+      RunRequest(engine, request);
+  }
+
+  vector<Timings> timings;
+  for (auto const & request : requests)
+    timings.push_back(RunRequest(engine, request));
+
+  vector<Timings> base;
+  if (!FLAGS_base_report.empty())
+    LoadReport(FLAGS_base_report, base);
+
+  PrintReport(timings, base);
+
+  if (!FLAGS_report_path.empty())
+    SaveReport(FLAGS_report_path, timings);
+
+  return 0;
+}
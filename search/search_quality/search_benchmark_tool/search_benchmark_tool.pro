@@ -0,0 +1,28 @@
+# Search latency benchmark tool.
+
+TARGET = search_benchmark_tool
+CONFIG += console warn_on
+CONFIG -= app_bundle
+TEMPLATE = app
+
+ROOT_DIR = ../../..
+DEPENDENCIES = map drape_frontend routing traffic routing_common search_tests_support search search_quality storage indexer drape \
+               platform editor geometry coding base freetype expat fribidi gflags \
+               jansson protobuf osrm stats_client minizip succinct \
+               opening_hours pugixml stb_image sdf_image
+
+include($$ROOT_DIR/common.pri)
+
+INCLUDEPATH *= $$ROOT_DIR/3party/gflags/src
+
+# needed for Platform::WorkingDir() and unicode combining
+QT *= core network opengl
+
+macx-* {
+  LIBS *= "-framework IOKit" "-framework SystemConfiguration"
+}
+
+HEADERS += \
+
+SOURCES += \
+    search_benchmark_tool.cpp \
@@ -187,3 +187,31 @@ UNIT_TEST(LooksLikeHouseNumber_Smoke)
   TEST(LooksLikeHouseNumber("дом 16", false /* isPrefix */), ());
   TEST(LooksLikeHouseNumber("дом 14 д 1", false /* isPrefix */), ());
 }
+
+UNIT_TEST(HouseNumbersMatcher_QueryMatcher)
+{
+  {
+    HouseNumbersMatcher matcher(MakeUniString("39 строение 79"), false /* queryIsPrefix */);
+    TEST(!matcher.Empty(), ());
+    TEST(matcher.Matches(MakeUniString("39с79")), ());
+    TEST(matcher.Matches(MakeUniString("39/79")), ());
+    TEST(!matcher.Matches(MakeUniString("39")), ());
+    TEST(!matcher.Matches(MakeUniString("")), ());
+
+    // Repeated calls with the same candidate must give the same result,
+    // as scratch buffers are reused between calls.
+    TEST(matcher.Matches(MakeUniString("39с79")), ());
+  }
+
+  {
+    HouseNumbersMatcher matcher(MakeUniString("39 кор"), true /* queryIsPrefix */);
+    TEST(matcher.Matches(MakeUniString("39 корпус 79")), ());
+    TEST(!matcher.Matches(MakeUniString("7")), ());
+  }
+
+  {
+    HouseNumbersMatcher matcher(MakeUniString(""), false /* queryIsPrefix */);
+    TEST(matcher.Empty(), ());
+    TEST(!matcher.Matches(MakeUniString("39")), ());
+  }
+}
@@ -64,6 +64,28 @@ UNIT_TEST(IntervalSet_AdjacentIntervalAdd)
   CheckSet(set, {TInterval<int>(90, 110)});
 }
 
+UNIT_TEST(IntervalSet_AddIntervals)
+{
+  IntervalSet<int> set;
+  TEST(set.Elems().empty(), ());
+
+  // Overlapping and touching intervals are coalesced before insertion.
+  set.AddIntervals({TInterval<int>(4, 7), TInterval<int>(0, 2), TInterval<int>(2, 3),
+                    TInterval<int>(5, 9), TInterval<int>(12, 13)});
+  CheckSet(set, {TInterval<int>(0, 3), TInterval<int>(4, 9), TInterval<int>(12, 13)});
+
+  // Bulk addition merges with the intervals already in the set.
+  set.AddIntervals({TInterval<int>(10, 12), TInterval<int>(3, 4)});
+  CheckSet(set, {TInterval<int>(0, 9), TInterval<int>(10, 13)});
+
+  // Empty intervals are skipped.
+  set.AddIntervals({TInterval<int>(20, 20)});
+  CheckSet(set, {TInterval<int>(0, 9), TInterval<int>(10, 13)});
+
+  set.AddIntervals({});
+  CheckSet(set, {TInterval<int>(0, 9), TInterval<int>(10, 13)});
+}
+
 UNIT_TEST(IntervalSet_SubtractFrom)
 {
   IntervalSet<int> set;
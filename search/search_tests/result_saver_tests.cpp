@@ -0,0 +1,98 @@
+#include "testing/testing.hpp"
+
+#include "search/result_saver.hpp"
+
+#include "std/string.hpp"
+
+namespace
+{
+search::ResultSaver::SavedResult MakeResult(string const & mwmName, uint32_t index,
+                                            string const & title)
+{
+  search::ResultSaver::SavedResult result;
+  result.m_mwmName = mwmName;
+  result.m_mwmVersion = 160101;
+  result.m_featureIndex = index;
+  result.m_center = m2::PointD(1.0, 2.0);
+  result.m_title = title;
+  result.m_address = "Some address";
+  result.m_featureType = "cafe";
+  return result;
+}
+}  // namespace
+
+namespace search
+{
+UNIT_TEST(ResultSaverOrderingTest)
+{
+  ResultSaver saver;
+  saver.Clear();
+
+  ResultSaver::SavedResult const record1 = MakeResult("Russia_Moscow", 1, "record1");
+  ResultSaver::SavedResult const record2 = MakeResult("Russia_Moscow", 2, "record2");
+
+  saver.Add(record1);
+  saver.Add(record2);
+  {
+    list<ResultSaver::SavedResult> const & result = saver.Get();
+    TEST_EQUAL(result.size(), 2, ());
+    TEST(result.back().IsSameFeature(record1), ());
+    TEST(result.front().IsSameFeature(record2), ());
+  }
+
+  // Choosing a saved result again moves it to the front without a duplicate.
+  saver.Add(record1);
+  {
+    list<ResultSaver::SavedResult> const & result = saver.Get();
+    TEST_EQUAL(result.size(), 2, ());
+    TEST(result.front().IsSameFeature(record1), ());
+    TEST(result.back().IsSameFeature(record2), ());
+  }
+  saver.Clear();
+}
+
+UNIT_TEST(ResultSaverSerializerTest)
+{
+  ResultSaver saver;
+  saver.Clear();
+
+  ResultSaver::SavedResult const record = MakeResult("Russia_Moscow", 1, "record");
+  saver.Add(record);
+
+  string data;
+  saver.Serialize(data);
+  TEST_GREATER(data.size(), 0, ());
+  saver.Clear();
+  TEST_EQUAL(saver.Get().size(), 0, ());
+  saver.Deserialize(data);
+
+  list<ResultSaver::SavedResult> const & result = saver.Get();
+  TEST_EQUAL(result.size(), 1, ());
+  TEST(result.front().IsSameFeature(record), ());
+  TEST_EQUAL(result.front().m_mwmVersion, record.m_mwmVersion, ());
+  TEST_EQUAL(result.front().m_center, record.m_center, ());
+  TEST_EQUAL(result.front().m_title, record.m_title, ());
+  TEST_EQUAL(result.front().m_address, record.m_address, ());
+  TEST_EQUAL(result.front().m_featureType, record.m_featureType, ());
+}
+
+UNIT_TEST(ResultSaverRemoveObsoleteTest)
+{
+  ResultSaver saver;
+  saver.Clear();
+
+  saver.Add(MakeResult("Russia_Moscow", 1, "record1"));
+  saver.Add(MakeResult("Belarus_Minsk", 2, "record2"));
+  TEST_EQUAL(saver.Get().size(), 2, ());
+
+  saver.RemoveObsolete([](ResultSaver::SavedResult const & r)
+  {
+    return r.m_mwmName != "Russia_Moscow";
+  });
+
+  list<ResultSaver::SavedResult> const & result = saver.Get();
+  TEST_EQUAL(result.size(), 1, ());
+  TEST_EQUAL(result.front().m_mwmName, "Belarus_Minsk", ());
+  saver.Clear();
+}
+}  // namespace search
@@ -38,8 +38,10 @@ SOURCES += \
     nearby_points_sweeper_test.cpp \
     query_saver_tests.cpp \
     ranking_tests.cpp \
+    result_saver_tests.cpp \
     string_intersection_test.cpp \
     string_match_test.cpp \
+    viewport_search_policy_test.cpp \
 
 HEADERS += \
     match_cost_mock.hpp \
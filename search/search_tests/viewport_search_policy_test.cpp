@@ -0,0 +1,82 @@
+#include "testing/testing.hpp"
+
+#include "search/viewport_search_policy.hpp"
+
+#include "geometry/rect2d.hpp"
+
+using namespace search;
+
+namespace
+{
+using Action = ViewportSearchPolicy::Action;
+
+ViewportSearchPolicy::Params DefaultParams()
+{
+  ViewportSearchPolicy::Params params;
+  params.m_minOverlapToReuse = 0.8;
+  params.m_debounceVelocity = 1.0;
+  return params;
+}
+}  // namespace
+
+UNIT_TEST(ViewportSearchPolicy_ReuseOnOverlap)
+{
+  ViewportSearchPolicy policy(DefaultParams());
+
+  m2::RectD const viewport(0.0, 0.0, 10.0, 10.0);
+  TEST_EQUAL(policy.OnQueryPosted(viewport), Action::Process, ());
+  policy.OnQueryProcessed(viewport);
+
+  // A slightly shifted viewport is mostly covered by the searched one.
+  TEST_EQUAL(policy.OnQueryPosted(m2::RectD(0.2, 0.2, 10.2, 10.2)), Action::Reuse, ());
+
+  // A viewport far away is not.
+  TEST_NOT_EQUAL(policy.OnQueryPosted(m2::RectD(100.0, 100.0, 110.0, 110.0)), Action::Reuse, ());
+}
+
+UNIT_TEST(ViewportSearchPolicy_NoReuseWithoutCompletedQuery)
+{
+  ViewportSearchPolicy policy(DefaultParams());
+
+  m2::RectD const viewport(0.0, 0.0, 10.0, 10.0);
+  TEST_EQUAL(policy.OnQueryPosted(viewport), Action::Process, ());
+
+  // The first query was never processed, its results can't be reused.
+  TEST_NOT_EQUAL(policy.OnQueryPosted(viewport), Action::Reuse, ());
+}
+
+UNIT_TEST(ViewportSearchPolicy_NoReuseOnZoomOut)
+{
+  ViewportSearchPolicy policy(DefaultParams());
+
+  m2::RectD const viewport(0.0, 0.0, 10.0, 10.0);
+  TEST_EQUAL(policy.OnQueryPosted(viewport), Action::Process, ());
+  policy.OnQueryProcessed(viewport);
+
+  // The searched viewport covers only a small share of the new one.
+  TEST_NOT_EQUAL(policy.OnQueryPosted(m2::RectD(-10.0, -10.0, 20.0, 20.0)), Action::Reuse, ());
+}
+
+UNIT_TEST(ViewportSearchPolicy_DebounceOnFastMovement)
+{
+  ViewportSearchPolicy policy(DefaultParams());
+
+  TEST_EQUAL(policy.OnQueryPosted(m2::RectD(0.0, 0.0, 10.0, 10.0)), Action::Process, ());
+
+  // Jumping many viewport sizes away right after the previous update
+  // means the viewport is still moving.
+  TEST_EQUAL(policy.OnQueryPosted(m2::RectD(100.0, 100.0, 110.0, 110.0)), Action::Debounce, ());
+}
+
+UNIT_TEST(ViewportSearchPolicy_Reset)
+{
+  ViewportSearchPolicy policy(DefaultParams());
+
+  m2::RectD const viewport(0.0, 0.0, 10.0, 10.0);
+  TEST_EQUAL(policy.OnQueryPosted(viewport), Action::Process, ());
+  policy.OnQueryProcessed(viewport);
+
+  // E.g. the query text has changed - previous results are unusable.
+  policy.Reset();
+  TEST_EQUAL(policy.OnQueryPosted(viewport), Action::Process, ());
+}
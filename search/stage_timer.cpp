@@ -0,0 +1,65 @@
+#include "search/stage_timer.hpp"
+
+#include "base/assert.hpp"
+#include "base/macros.hpp"
+
+namespace search
+{
+namespace
+{
+// Innermost active stage guard on this thread, if any.
+thread_local StageTimer::ScopedStage * t_currentStage = nullptr;
+
+char const * const kStageNames[] = {"Retrieval", "Geocoding", "PreRanking", "Ranking"};
+static_assert(ARRAY_SIZE(kStageNames) == StageTimer::StagesCount, "");
+}  // namespace
+
+// static
+StageTimer & StageTimer::Instance()
+{
+  static StageTimer instance;
+  return instance;
+}
+
+void StageTimer::Add(Stage stage, uint64_t timeUs)
+{
+  ASSERT_LESS(stage, StagesCount, ());
+  m_timeUs[stage] += timeUs;
+}
+
+uint64_t StageTimer::Get(Stage stage) const
+{
+  ASSERT_LESS(stage, StagesCount, ());
+  return m_timeUs[stage];
+}
+
+void StageTimer::Reset()
+{
+  for (auto & time : m_timeUs)
+    time = 0;
+}
+
+// static
+char const * StageTimer::GetStageName(Stage stage)
+{
+  ASSERT_LESS(stage, StagesCount, ());
+  return kStageNames[stage];
+}
+
+StageTimer::ScopedStage::ScopedStage(Stage stage) : m_stage(stage), m_parent(t_currentStage)
+{
+  t_currentStage = this;
+}
+
+StageTimer::ScopedStage::~ScopedStage()
+{
+  double const total = m_timer.ElapsedSeconds();
+  double const exclusive = total - m_childSeconds;
+  if (exclusive > 0.0)
+    Instance().Add(m_stage, static_cast<uint64_t>(exclusive * 1e6));
+
+  if (m_parent != nullptr)
+    m_parent->m_childSeconds += total;
+  t_currentStage = m_parent;
+}
+}  // namespace search
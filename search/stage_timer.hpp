@@ -0,0 +1,63 @@
+#pragma once
+
+#include "base/timer.hpp"
+
+#include "std/array.hpp"
+#include "std/atomic.hpp"
+#include "std/cstdint.hpp"
+#include "std/noncopyable.hpp"
+
+namespace search
+{
+// Accumulates wall time spent in the major stages of query processing:
+// retrieval from the search index, geocoding, pre-ranking and ranking.
+// The stages nest at runtime (retrieval and both rankers are invoked
+// from inside the geocoder), so scoped guards attribute each interval
+// to the innermost active stage and the per-stage times are exclusive
+// and sum up to the measured total.
+//
+// Counters are process-wide and atomically updated; the benchmark
+// harness resets them around a query to get its breakdown.
+class StageTimer : private noncopyable
+{
+public:
+  enum Stage
+  {
+    StageRetrieval = 0,  // reading features from the search index
+    StageGeocoding,      // matching token layers, excluding nested stages
+    StagePreRanking,     // filtering and filling pre-results
+    StageRanking,        // building and sorting final results
+
+    StagesCount
+  };
+
+  static StageTimer & Instance();
+
+  void Add(Stage stage, uint64_t timeUs);
+  uint64_t Get(Stage stage) const;
+  /// Drops the accumulated times, e.g. before replaying a query.
+  void Reset();
+
+  static char const * GetStageName(Stage stage);
+
+  /// Measures the enclosing scope into the given stage, subtracting
+  /// time spent in nested guards on the same thread.
+  class ScopedStage : private noncopyable
+  {
+  public:
+    explicit ScopedStage(Stage stage);
+    ~ScopedStage();
+
+  private:
+    Stage const m_stage;
+    my::Timer m_timer;
+    double m_childSeconds = 0.0;
+    ScopedStage * m_parent;
+  };
+
+private:
+  StageTimer() = default;
+
+  array<atomic<uint64_t>, StagesCount> m_timeUs = {};
+};
+}  // namespace search
@@ -31,7 +31,7 @@ void StreetVicinityLoader::SetContext(MwmContext * context)
 
 void StreetVicinityLoader::OnQueryFinished() { m_cache.ClearIfNeeded(); }
 
-StreetVicinityLoader::Street const & StreetVicinityLoader::GetStreet(uint32_t featureId)
+StreetVicinityLoader::Street & StreetVicinityLoader::GetStreet(uint32_t featureId)
 {
   auto r = m_cache.Get(featureId);
   if (!r.second)
@@ -41,6 +41,31 @@ StreetVicinityLoader::Street const & StreetVicinityLoader::GetStreet(uint32_t fe
   return r.first;
 }
 
+bool StreetVicinityLoader::GetProjection(uint32_t streetId, uint32_t houseId,
+                                         ProjectionOnStreet & proj)
+{
+  Street & street = GetStreet(streetId);
+  if (street.IsEmpty())
+    return false;
+
+  auto const it = street.m_projections.find(houseId);
+  if (it != street.m_projections.end())
+  {
+    proj = it->second.second;
+    return it->second.first;
+  }
+
+  auto & entry = street.m_projections[houseId];
+  entry.first = false;
+
+  FeatureType feature;
+  if (m_context->GetFeature(houseId, feature))
+    entry.first = street.m_calculator->GetProjection(feature::GetCenter(feature), entry.second);
+
+  proj = entry.second;
+  return entry.first;
+}
+
 void StreetVicinityLoader::LoadStreet(uint32_t featureId, Street & street)
 {
   FeatureType feature;
@@ -12,6 +12,7 @@
 #include "base/macros.hpp"
 
 #include "std/unordered_map.hpp"
+#include "std/utility.hpp"
 
 namespace search
 {
@@ -34,8 +35,13 @@ public:
     m2::RectD m_rect;
     unique_ptr<ProjectionOnStreetCalculator> m_calculator;
 
-    /// @todo Cache GetProjection results for features here, because
-    /// feature::GetCenter and ProjectionOnStreetCalculator::GetProjection are not so fast.
+    // Cached results of GetProjection() for features' best geometry
+    // centers, because feature::GetCenter and
+    // ProjectionOnStreetCalculator::GetProjection are not so fast.
+    // Streets live in the loader's cache, which belongs to a per-mwm
+    // FeaturesLayerMatcher and thus survives a single query, so
+    // projections are reused across keystrokes.
+    unordered_map<uint32_t, pair<bool, ProjectionOnStreet>> m_projections;
 
     DISALLOW_COPY(Street);
   };
@@ -78,7 +84,14 @@ public:
 
   void OnQueryFinished();
 
-  Street const & GetStreet(uint32_t featureId);
+  Street & GetStreet(uint32_t featureId);
+
+  // Returns true and fills |proj| iff |houseId|'s center has a
+  // projection on the street |streetId|. The center is computed from
+  // the best geometry, as house-to-street tables are generated by
+  // using high-precision centers of features. The result is cached in
+  // the street and reused by subsequent queries against the same mwm.
+  bool GetProjection(uint32_t streetId, uint32_t houseId, ProjectionOnStreet & proj);
 
 private:
   void LoadStreet(uint32_t featureId, Street & street);
@@ -95,7 +95,7 @@ template <typename ToDo>
 void ForEachCategoryTypeFuzzy(StringSliceBase const & slice, TLocales const & locales,
                               CategoriesHolder const & categories, ToDo && todo)
 {
-  using Trie = my::MemTrie<strings::UniString, my::VectorValues<uint32_t>>;
+  using Trie = CategoriesHolder::Trie;
 
   auto const & trie = categories.GetNameToTypesTrie();
   auto const & trieRootIt = trie.GetRootIterator();
@@ -0,0 +1,83 @@
+#include "search/viewport_search_policy.hpp"
+
+#include "std/algorithm.hpp"
+
+namespace search
+{
+namespace
+{
+double Area(m2::RectD const & r)
+{
+  return r.IsValid() ? r.SizeX() * r.SizeY() : 0.0;
+}
+
+// Share of the united area of |r1| and |r2| covered by their
+// intersection. Symmetric, so both panning away and zooming out drop
+// the overlap below the reuse threshold.
+double GetOverlapShare(m2::RectD const & r1, m2::RectD const & r2)
+{
+  if (!r1.IsValid() || !r2.IsValid())
+    return 0.0;
+
+  m2::RectD intersection = r1;
+  if (!intersection.Intersect(r2))
+    return 0.0;
+
+  double const unitedArea = Area(r1) + Area(r2) - Area(intersection);
+  if (unitedArea == 0.0)
+    return 0.0;
+  return Area(intersection) / unitedArea;
+}
+
+// Viewport movement speed in viewport sizes per second.
+double GetVelocity(m2::RectD const & prev, m2::RectD const & curr, double elapsedSeconds)
+{
+  if (!prev.IsValid())
+    return 0.0;
+
+  double const size = max(max(prev.SizeX(), prev.SizeY()), max(curr.SizeX(), curr.SizeY()));
+  if (size == 0.0)
+    return 0.0;
+
+  double const distance = prev.Center().Length(curr.Center());
+  // The timer is monotonic, so the elapsed time is only clamped to keep
+  // nearly simultaneous updates counted as fast movement.
+  return distance / size / max(elapsedSeconds, 1e-6);
+}
+}  // namespace
+
+ViewportSearchPolicy::ViewportSearchPolicy(Params const & params) : m_params(params) {}
+
+ViewportSearchPolicy::Action ViewportSearchPolicy::OnQueryPosted(m2::RectD const & viewport)
+{
+  lock_guard<mutex> lock(m_mu);
+
+  double const now = m_timer.ElapsedSeconds();
+  double const velocity = GetVelocity(m_lastPostedViewport, viewport, now - m_lastPostedTime);
+
+  m_lastPostedViewport = viewport;
+  m_lastPostedTime = now;
+
+  if (GetOverlapShare(m_lastSearchedViewport, viewport) >= m_params.m_minOverlapToReuse)
+    return Action::Reuse;
+
+  if (velocity >= m_params.m_debounceVelocity)
+    return Action::Debounce;
+
+  return Action::Process;
+}
+
+void ViewportSearchPolicy::OnQueryProcessed(m2::RectD const & viewport)
+{
+  lock_guard<mutex> lock(m_mu);
+  m_lastSearchedViewport = viewport;
+}
+
+void ViewportSearchPolicy::Reset()
+{
+  lock_guard<mutex> lock(m_mu);
+  m_lastPostedViewport.MakeEmpty();
+  m_lastPostedTime = 0.0;
+  m_lastSearchedViewport.MakeEmpty();
+}
+}  // namespace search
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "geometry/rect2d.hpp"
+
+#include "base/timer.hpp"
+
+#include "std/mutex.hpp"
+#include "std/string.hpp"
+
+namespace search
+{
+// Decides how viewport-driven search requests should be throttled.
+// Viewport search is re-posted on every movement end, so during casual
+// map browsing the engine is flooded with queries whose viewports
+// barely differ. The policy reuses previous results when the new
+// viewport is mostly covered by the last searched one and debounces
+// requests posted while the viewport is still moving fast, leaving the
+// final resting viewport to be processed.
+//
+// NOTE: this class is thread-safe.
+class ViewportSearchPolicy
+{
+public:
+  struct Params
+  {
+    // Minimal share of the intersection area in the united area of the
+    // new and the last searched viewports to reuse previous results.
+    double m_minOverlapToReuse = 0.8;
+    // Viewport movement speed (in viewport sizes per second) starting
+    // from which requests are debounced.
+    double m_debounceVelocity = 1.0;
+    // Pause before processing a debounced request. A request superseded
+    // during the pause is dropped, so a burst of movements results in a
+    // single processed query.
+    uint32_t m_debounceIntervalMs = 150;
+  };
+
+  enum class Action
+  {
+    Process,   // run the query as usual
+    Debounce,  // pause before processing and re-check supersession
+    Reuse      // previous results still cover the viewport
+  };
+
+  explicit ViewportSearchPolicy(Params const & params);
+
+  // Called for every posted viewport query.
+  Action OnQueryPosted(m2::RectD const & viewport);
+
+  // Called when a viewport query has been processed to completion;
+  // cancelled queries must not be reported here.
+  void OnQueryProcessed(m2::RectD const & viewport);
+
+  // Forgets the accumulated state, e.g. when the query text changes and
+  // previous results become unusable.
+  void Reset();
+
+  uint32_t GetDebounceIntervalMs() const { return m_params.m_debounceIntervalMs; }
+
+private:
+  Params const m_params;
+
+  mutex m_mu;
+
+  // All fields below are guarded by |m_mu|.
+  my::Timer m_timer;
+  m2::RectD m_lastPostedViewport;
+  double m_lastPostedTime = 0.0;
+  m2::RectD m_lastSearchedViewport;
+};
+
+inline string DebugPrint(ViewportSearchPolicy::Action action)
+{
+  switch (action)
+  {
+  case ViewportSearchPolicy::Action::Process: return "Process";
+  case ViewportSearchPolicy::Action::Debounce: return "Debounce";
+  case ViewportSearchPolicy::Action::Reuse: return "Reuse";
+  }
+  return "Unknown";
+}
+}  // namespace search
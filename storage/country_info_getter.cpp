@@ -13,10 +13,12 @@
 #include "coding/read_write_utils.hpp"
 
 #include "base/logging.hpp"
+#include "base/stl_helpers.hpp"
 #include "base/string_utils.hpp"
 
 #include "3party/Alohalytics/src/alohalytics.h"
 
+#include "std/algorithm.hpp"
 #include "std/bind.hpp"
 #include "std/function.hpp"
 #include "std/limits.hpp"
@@ -76,6 +78,21 @@ vector<TCountryId> CountryInfoGetter::GetRegionsCountryIdByRect(m2::RectD const
   return result;
 }
 
+vector<TCountryId> CountryInfoGetter::GetRegionsCountryIdByPoints(
+    vector<m2::PointD> const & points) const
+{
+  vector<TCountryId> result;
+  result.reserve(points.size());
+  for (auto const & pt : points)
+  {
+    TRegionId const id = FindFirstCountry(pt);
+    if (id != kInvalidId)
+      result.push_back(m_countries[id].m_countryId);
+  }
+  my::SortUnique(result);
+  return result;
+}
+
 void CountryInfoGetter::GetRegionsCountryId(m2::PointD const & pt, TCountriesVec & closestCoutryIds)
 {
   double const kLookupRadiusM = 30 /* km */ * 1000;
@@ -181,10 +198,41 @@ void CountryInfoGetter::InitAffiliationsInfo(TMappingAffiliations const * affili
 
 CountryInfoGetter::TRegionId CountryInfoGetter::FindFirstCountry(m2::PointD const & pt) const
 {
-  for (size_t id = 0; id < m_countries.size(); ++id)
+  // Lookups come mostly from sequential GPS fixes, so the recently hit
+  // regions are checked before going to the rect tree. The polygon
+  // tests are performed outside of the lock deliberately.
+  vector<TRegionId> candidates;
+  {
+    lock_guard<mutex> lock(m_recentRegionsMutex);
+    candidates = m_recentRegions;
+  }
+
+  for (TRegionId const id : candidates)
   {
     if (m_countries[id].m_rect.IsPointInside(pt) && IsBelongToRegionImpl(id, pt))
+    {
+      AddRecentRegion(id);
+      return id;
+    }
+  }
+
+  candidates.clear();
+  m_countryRectTree.ForEachInRect(m2::RectD(pt, pt), [&candidates](TRegionId id)
+  {
+    candidates.push_back(id);
+  });
+
+  // The traversal order of the tree is unspecified, but the linear scan
+  // used here before returned the region with the least index. Keep
+  // this order - some regions are really covered by others.
+  sort(candidates.begin(), candidates.end());
+  for (TRegionId const id : candidates)
+  {
+    if (IsBelongToRegionImpl(id, pt))
+    {
+      AddRecentRegion(id);
       return id;
+    }
   }
 
   ms::LatLon const latLon = MercatorBounds::ToLatLon(pt);
@@ -194,6 +242,24 @@ CountryInfoGetter::TRegionId CountryInfoGetter::FindFirstCountry(m2::PointD cons
   return kInvalidId;
 }
 
+void CountryInfoGetter::BuildCountryRectTree()
+{
+  for (size_t id = 0; id < m_countries.size(); ++id)
+    m_countryRectTree.Add(id, m_countries[id].m_rect);
+}
+
+void CountryInfoGetter::AddRecentRegion(TRegionId id) const
+{
+  lock_guard<mutex> lock(m_recentRegionsMutex);
+
+  auto const it = find(m_recentRegions.begin(), m_recentRegions.end(), id);
+  if (it != m_recentRegions.end())
+    m_recentRegions.erase(it);
+  m_recentRegions.insert(m_recentRegions.begin(), id);
+  if (m_recentRegions.size() > kMaxRecentRegions)
+    m_recentRegions.pop_back();
+}
+
 template <typename ToDo>
 void CountryInfoGetter::ForEachCountry(string const & prefix, ToDo && toDo) const
 {
@@ -259,6 +325,8 @@ CountryInfoReader::CountryInfoReader(ModelReaderPtr polyR, ModelReaderPtr countr
   for (size_t i = 0; i < countrySz; ++i)
     m_countryIndex[m_countries[i].m_countryId] = i;
 
+  BuildCountryRectTree();
+
   string buffer;
   countryR.ReadAsString(buffer);
   LoadCountryFile2CountryInfo(buffer, m_id2info, m_isSingleMwm);
@@ -370,6 +438,7 @@ CountryInfoGetterForTesting::CountryInfoGetterForTesting(vector<CountryDef> cons
 void CountryInfoGetterForTesting::AddCountry(CountryDef const & country)
 {
   m_countries.push_back(country);
+  m_countryRectTree.Add(m_countries.size() - 1, country.m_rect);
   string const & name = country.m_countryId;
   m_id2info[name].m_name = name;
 }
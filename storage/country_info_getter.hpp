@@ -6,6 +6,7 @@
 #include "platform/platform.hpp"
 
 #include "geometry/region2d.hpp"
+#include "geometry/tree4d.hpp"
 
 #include "coding/file_container.hpp"
 
@@ -40,6 +41,12 @@ public:
   // countries belong to |rect|.
   vector<TCountryId> GetRegionsCountryIdByRect(m2::RectD const & rect) const;
 
+  // Returns sorted unique country ids for all |points|. It's a batch
+  // version of GetRegionCountryId for classifying polyline points
+  // (e.g. an online route): consecutive points usually hit the same
+  // region, so most of them cost a single polygon test.
+  vector<TCountryId> GetRegionsCountryIdByPoints(vector<m2::PointD> const & points) const;
+
   // Returns a list of country ids by a |pt| in mercator.
   // |closestCoutryIds| is filled with country ids of mwm which covers |pt| or close to it.
   // |closestCoutryIds| is not filled with country world.mwm country id and with custom mwm.
@@ -90,6 +97,13 @@ protected:
   // Returns identifier of a first country containing |pt|.
   TRegionId FindFirstCountry(m2::PointD const & pt) const;
 
+  // Fills |m_countryRectTree| with bounding rects of m_countries.
+  // Should be called when m_countries is filled.
+  void BuildCountryRectTree();
+
+  // Moves |id| to the front of m_recentRegions.
+  void AddRecentRegion(TRegionId id) const;
+
   // Invokes |toDo| on each country whose name starts with |prefix|.
   template <typename ToDo>
   void ForEachCountry(string const & prefix, ToDo && toDo) const;
@@ -113,6 +127,17 @@ protected:
   // Maps all leaf country id (file names) to their indices in m_countries.
   unordered_map<TCountryId, TRegionId> m_countryIndex;
 
+  // An in-memory tree of the countries bounding rects. Replaces the
+  // linear scan over m_countries in point lookups.
+  m4::Tree<TRegionId> m_countryRectTree;
+
+  // A few recently hit regions. Lookups come mostly from sequential
+  // GPS fixes, so these regions are checked first in FindFirstCountry.
+  // The front is the most recently used one.
+  static size_t const kMaxRecentRegions = 3;
+  mutable vector<TRegionId> m_recentRegions;
+  mutable mutex m_recentRegionsMutex;
+
   TMappingAffiliations const * m_affiliations = nullptr;
 
   // Maps country file name without an extension to a country info.
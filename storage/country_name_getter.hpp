@@ -5,7 +5,6 @@
 #include "platform/get_text_by_id.hpp"
 
 #include "std/string.hpp"
-#include "std/unique_ptr.hpp"
 
 namespace storage
 {
@@ -38,7 +37,7 @@ public:
   void SetLocaleForTesting(string const & jsonBuffer, string const & locale);
 
 private:
-  unique_ptr<platform::GetTextById> m_getCurLang;
+  platform::TGetTextByIdPtr m_getCurLang;
 };
 
 }  // namespace storage
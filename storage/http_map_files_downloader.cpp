@@ -46,9 +46,13 @@ void HttpMapFilesDownloader::DownloadMapFile(vector<string> const & urls, string
                                              TDownloadingProgressCallback const & onProgress)
 {
   ASSERT_THREAD_CHECKER(m_checker, ());
+  // Map files are bulk transfers: they yield the link to small
+  // latency-sensitive requests, see downloader::DownloadPriority.
   m_request.reset(downloader::HttpRequest::GetFile(
       urls, path, size, bind(&HttpMapFilesDownloader::OnMapFileDownloaded, this, onDownloaded, _1),
-      bind(&HttpMapFilesDownloader::OnMapFileDownloadingProgress, this, onProgress, _1)));
+      bind(&HttpMapFilesDownloader::OnMapFileDownloadingProgress, this, onProgress, _1),
+      512 * 1024 /* chunkSize */, true /* doCleanOnCancel */, 4 /* connectionsCount */,
+      downloader::DownloadPriority::Background));
 
   if (!m_request)
   {
@@ -231,6 +231,7 @@ void Storage::Clear()
   m_failedCountries.clear();
   m_localFiles.clear();
   m_localFilesForFakeCountries.clear();
+  m_groupNodeStatusCache.clear();
   SaveDownloadQueue();
 }
 
@@ -240,6 +241,7 @@ void Storage::RegisterAllLocalMaps()
 
   m_localFiles.clear();
   m_localFilesForFakeCountries.clear();
+  m_groupNodeStatusCache.clear();
 
   vector<LocalCountryFile> localFiles;
   FindAllLocalMapsAndCleanup(GetCurrentDataVersion(), m_dataDir, localFiles);
@@ -526,6 +528,17 @@ void Storage::NotifyStatusChanged(TCountryId const & countryId)
 {
   ASSERT_THREAD_CHECKER(m_threadChecker, ());
 
+  ++m_statusVersion;
+  m_lastStatusChangeVersion[countryId] = m_statusVersion;
+
+  // Drop cached aggregated statuses. This method is called for every
+  // ancestor of a changed leaf, so erasing the notified node only is
+  // enough to keep the cache consistent.
+  vector<TCountryTreeNode const *> found;
+  m_countries.Find(countryId, found);
+  for (auto const * node : found)
+    m_groupNodeStatusCache.erase(node);
+
   for (CountryObservers const & observer : m_observers)
     observer.m_changeCountryFn(countryId);
 }
@@ -606,6 +619,14 @@ void Storage::DownloadNextFile(QueuedCountry const & country)
     return;
   }
 
+  // The server list is the same for all the maps of the current data
+  // version, so the one received earlier in the session is reused.
+  if (!m_sessionServerList.empty())
+  {
+    OnServerListDownloaded(m_sessionServerList);
+    return;
+  }
+
   // send Country name for statistics
   m_downloader->GetServersList(GetCurrentDataVersion(), countryFile.GetName(),
                                bind(&Storage::OnServerListDownloaded, this, _1));
@@ -701,7 +722,21 @@ void Storage::OnMapFileDownloadFinished(bool success,
     return;
   }
 
-  OnMapDownloadFinished(countryId, success, queuedCountry.GetInitOptions());
+  MapOptions const initOptions = queuedCountry.GetInitOptions();
+
+  CorrectJustDownloadedAndQueue(m_queue.begin());
+  SaveDownloadQueue();
+  m_downloader->Reset();
+
+  // The next download is started before the downloaded map is
+  // registered: registration (files renaming, index building in
+  // m_didDownload) may take a while and the network would be idle
+  // otherwise. The downloader performs requests on its own threads, so
+  // the next map is being downloaded while this thread applies the
+  // previous one.
+  DownloadNextCountryFromQueue();
+
+  OnMapDownloadFinished(countryId, success, initOptions);
 
   // Send stastics to Push Woosh.
   if (success)
@@ -715,12 +750,7 @@ void Storage::OnMapFileDownloadFinished(bool success,
                                                          std::string(nowStr));
   }
 
-  CorrectJustDownloadedAndQueue(m_queue.begin());
-  SaveDownloadQueue();
-
-  m_downloader->Reset();
   NotifyStatusChangedForHierarchy(countryId);
-  DownloadNextCountryFromQueue();
 }
 
 void Storage::ReportProgress(TCountryId const & countryId, MapFilesDownloader::TProgress const & p)
@@ -758,6 +788,9 @@ void Storage::OnServerListDownloaded(vector<string> const & urls)
 {
   ASSERT_THREAD_CHECKER(m_threadChecker, ());
 
+  if (m_sessionServerList.empty())
+    m_sessionServerList = urls;
+
   // Queue can be empty because countries were deleted from queue.
   if (m_queue.empty())
     return;
@@ -1292,8 +1325,19 @@ void Storage::DeleteNode(TCountryId const & countryId)
 
 StatusAndError Storage::GetNodeStatus(TCountryTreeNode const & node) const
 {
+  bool const isGroupNode = node.ChildrenCount() != 0;
+  if (isGroupNode)
+  {
+    auto const it = m_groupNodeStatusCache.find(&node);
+    if (it != m_groupNodeStatusCache.end())
+      return it->second;
+  }
+
   vector<pair<TCountryId, NodeStatus>> disputedTerritories;
-  return GetNodeStatusInfo(node, disputedTerritories);
+  StatusAndError const result = GetNodeStatusInfo(node, disputedTerritories);
+  if (isGroupNode)
+    m_groupNodeStatusCache.insert(make_pair(&node, result));
+  return result;
 }
 
 bool Storage::IsDisputed(TCountryTreeNode const & node) const
@@ -1468,6 +1512,19 @@ void Storage::GetNodeStatuses(TCountryId const & countryId, NodeStatuses & nodeS
   nodeStatuses.m_groupNode = (node->ChildrenCount() != 0);
 }
 
+uint64_t Storage::GetChangedCountriesSince(uint64_t version, TCountriesVec & countries) const
+{
+  ASSERT_THREAD_CHECKER(m_threadChecker, ());
+
+  countries.clear();
+  for (auto const & idAndVersion : m_lastStatusChangeVersion)
+  {
+    if (idAndVersion.second > version)
+      countries.push_back(idAndVersion.first);
+  }
+  return m_statusVersion;
+}
+
 void Storage::SetCallbackForClickOnDownloadMap(TDownloadFn & downloadFn)
 {
   ASSERT_THREAD_CHECKER(m_threadChecker, ());
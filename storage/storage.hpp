@@ -175,6 +175,17 @@ private:
   /// stores countries whose download has failed recently
   TCountriesSet m_failedCountries;
 
+  /// Aggregated statuses of group nodes are calculated by a subtree walk
+  /// which is too expensive to repeat for every observer query, so they
+  /// are cached here. An entry is erased in NotifyStatusChanged which is
+  /// called for every ancestor of a changed leaf.
+  mutable map<TCountryTreeNode const *, StatusAndError> m_groupNodeStatusCache;
+
+  /// Every status change bumps |m_statusVersion| and remembers it for the
+  /// changed node. @see GetChangedCountriesSince.
+  uint64_t m_statusVersion = 0;
+  map<TCountryId, uint64_t> m_lastStatusChangeVersion;
+
   map<TCountryId, list<TLocalFilePtr>> m_localFiles;
 
   // Our World.mwm and WorldCoasts.mwm are fake countries, together with any custom mwm in data
@@ -223,6 +234,13 @@ private:
   // For example {"http://new-search.mapswithme.com/"}.
   vector<string> m_downloadingUrlsForTesting;
 
+  // Server list received from the metaserver. It depends on the data
+  // version only, so it's requested once and then reused for all the
+  // maps downloaded during the session. This saves one http round trip
+  // per queued map which is noticeable when bulk-downloading many small
+  // maps.
+  vector<string> m_sessionServerList;
+
   // |m_downloadMapOnTheMap| is called when an end user clicks on download map or retry button
   // on the map.
   TDownloadFn m_downloadMapOnTheMap;
@@ -380,6 +398,18 @@ public:
   /// \note This method works quicklier than GetNodeAttrs().
   void GetNodeStatuses(TCountryId const & countryId, NodeStatuses & nodeStatuses) const;
 
+  /// \brief Returns an opaque version of the last node status change.
+  /// The version is increased every time a status of any node is changed.
+  uint64_t GetStatusVersion() const { return m_statusVersion; }
+
+  /// \brief Fills |countries| with ids of all nodes (leaf and group ones) whose
+  /// statuses have been changed since |version| was obtained with GetStatusVersion()
+  /// or returned from this method.
+  /// \returns the current status version to be passed to the next call.
+  /// \note It lets UI update the changed list items only instead of
+  /// re-querying whole subtrees on every notification.
+  uint64_t GetChangedCountriesSince(uint64_t version, TCountriesVec & countries) const;
+
   string GetNodeLocalName(TCountryId const & countryId) const { return m_countryNameGetter(countryId); }
 
   /// \brief Downloads one node (expandable or not) by countryId.
@@ -48,6 +48,19 @@ UNIT_TEST(CountryInfoGetter_GetByPoint_Smoke)
   TEST_EQUAL(info.m_name, "Japan, Kinki", ());
 }
 
+UNIT_TEST(CountryInfoGetter_GetRegionsCountryIdByPoints_Smoke)
+{
+  auto const getter = CreateCountryInfoGetter();
+
+  vector<m2::PointD> const points = {
+      MercatorBounds::FromLatLon(53.9022651, 27.5618818) /* Minsk */,
+      MercatorBounds::FromLatLon(53.9522651, 27.5618818) /* Minsk suburb */,
+      MercatorBounds::FromLatLon(-6.4146288, -38.0098101) /* Brazil, Northeast */};
+
+  auto const countries = getter->GetRegionsCountryIdByPoints(points);
+  TEST_EQUAL(countries, (vector<storage::TCountryId>{"Belarus", "Brazil_Northeast"}), ());
+}
+
 UNIT_TEST(CountryInfoGetter_GetRegionsCountryIdByRect_Smoke)
 {
   auto const getter = CreateCountryInfoGetter();
@@ -41,6 +41,7 @@
 #include "base/scope_guard.hpp"
 #include "base/string_utils.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/bind.hpp"
 #include "std/condition_variable.hpp"
 #include "std/exception.hpp"
@@ -570,6 +571,33 @@ UNIT_TEST(StorageTest_Smoke)
              "Georgia" DATA_FILE_EXTENSION ROUTING_FILE_EXTENSION, ());
 }
 
+UNIT_CLASS_TEST(StorageTest, ChangedCountriesSince)
+{
+  TCountryId const azerbaijanCountryId = storage.FindCountryIdByFile("Azerbaijan");
+  TEST(IsCountryIdValid(azerbaijanCountryId), ());
+
+  storage.DeleteCountry(azerbaijanCountryId, MapOptions::Map);
+  MY_SCOPE_GUARD(cleanupCountryFiles,
+                 bind(&Storage::DeleteCountry, &storage, azerbaijanCountryId, MapOptions::Map));
+
+  TCountriesVec changed;
+  uint64_t version = storage.GetChangedCountriesSince(storage.GetStatusVersion(), changed);
+  TEST(changed.empty(), (changed));
+
+  {
+    unique_ptr<CountryDownloaderChecker> checker =
+        AbsentCountryDownloaderChecker(storage, azerbaijanCountryId, MapOptions::Map);
+    checker->StartDownload();
+    runner.Run();
+  }
+
+  version = storage.GetChangedCountriesSince(version, changed);
+  TEST(find(changed.begin(), changed.end(), azerbaijanCountryId) != changed.end(), (changed));
+
+  storage.GetChangedCountriesSince(version, changed);
+  TEST(changed.empty(), (changed));
+}
+
 UNIT_CLASS_TEST(StorageTest, CountryDownloading)
 {
   TCountryId const azerbaijanCountryId = storage.FindCountryIdByFile("Azerbaijan");
@@ -26,6 +26,7 @@ public:
   bool Reconnect();
   void Shutdown();
   bool Send(boost::circular_buffer<DataPoint> const & points);
+  bool Send(vector<DataPoint> const & points);
 
 private:
   unique_ptr<platform::Socket> m_socket;
@@ -1,19 +1,30 @@
 #include "reporter.hpp"
 
 #include "platform/location.hpp"
+#include "platform/platform.hpp"
 #include "platform/socket.hpp"
 
 #include "base/logging.hpp"
 #include "base/timer.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/target_os.hpp"
 
 namespace
 {
 double constexpr kRequiredHorizontalAccuracy = 10.0;
 double constexpr kMinDelaySeconds = 1.0;
-double constexpr kReconnectDelaySeconds = 60.0;
 size_t constexpr kRealTimeBufferSize = 60;
+// An upper bound on the number of points packed into one data packet.
+// A frame this large is still a single small socket write, and filling
+// it up wakes the worker without waiting for the push delay.
+size_t constexpr kMaxPointsPerFrame = 60;
+// The reconnection delay doubles after every failed attempt between
+// these bounds and resets on success.
+double constexpr kMinReconnectDelaySeconds = 5.0;
+double constexpr kMaxReconnectDelaySeconds = 300.0;
+char const kSpillFileName[] = "tracking_spill.bin";
+uint64_t constexpr kMaxSpillFileSize = 256 * 1024;
 } // namespace
 
 namespace tracking
@@ -28,7 +39,9 @@ Reporter::Reporter(unique_ptr<platform::Socket> socket, string const & host, uin
   : m_allowSendingPoints(true)
   , m_realtimeSender(move(socket), host, port, false)
   , m_pushDelay(pushDelay)
+  , m_reconnectDelaySeconds(kMinReconnectDelaySeconds)
   , m_points(kRealTimeBufferSize)
+  , m_spillQueue(GetPlatform().WritablePathForFile(kSpillFileName), kMaxSpillFileSize)
   , m_thread([this] { Run(); })
 {
 }
@@ -57,6 +70,10 @@ void Reporter::AddLocation(location::GpsInfo const & info, traffic::SpeedGroup t
   m_input.push_back(
       DataPoint(info.m_timestamp, ms::LatLon(info.m_latitude, info.m_longitude),
                 static_cast<std::underlying_type<traffic::SpeedGroup>::type>(traffic)));
+
+  // A full frame is worth sending without waiting for the push delay.
+  if (m_input.size() >= kMaxPointsPerFrame)
+    m_cv.notify_one();
 }
 
 void Reporter::Run()
@@ -74,7 +91,7 @@ void Reporter::Run()
     m_input.clear();
 
     lock.unlock();
-    if (m_points.empty() && m_idleFn)
+    if (m_points.empty() && m_spillQueue.IsEmpty() && m_idleFn)
     {
       m_idleFn();
     }
@@ -87,7 +104,10 @@ void Reporter::Run()
 
     auto const passedMs = duration_cast<milliseconds>(steady_clock::now() - startTime);
     if (passedMs < m_pushDelay)
-      m_cv.wait_for(lock, m_pushDelay - passedMs, [this]{return m_isFinished;});
+    {
+      m_cv.wait_for(lock, m_pushDelay - passedMs,
+                    [this] { return m_isFinished || m_input.size() >= kMaxPointsPerFrame; });
+    }
   }
 
   LOG(LINFO, ("Tracking Reporter finished"));
@@ -102,29 +122,84 @@ bool Reporter::SendPoints()
       m_realtimeSender.Shutdown();
       m_wasConnected = false;
     }
+    // The user turned tracking off; do not keep the backlog around.
+    m_spillQueue.Clear();
     return true;
   }
 
-  if (m_points.empty())
+  if (m_points.empty() && m_spillQueue.IsEmpty())
     return true;
 
   if (m_wasConnected)
-    m_wasConnected = m_realtimeSender.Send(m_points);
+    m_wasConnected = SendFrames();
 
   if (m_wasConnected)
     return true;
 
   double const currentTime = my::Timer::LocalTime();
-  if (currentTime < m_lastConnectionAttempt + kReconnectDelaySeconds)
+  if (currentTime < m_lastConnectionAttempt + m_reconnectDelaySeconds)
+  {
+    SpillPoints();
     return false;
+  }
 
   m_lastConnectionAttempt = currentTime;
 
   m_wasConnected = m_realtimeSender.Reconnect();
   if (!m_wasConnected)
+  {
+    m_reconnectDelaySeconds = min(m_reconnectDelaySeconds * 2.0, kMaxReconnectDelaySeconds);
+    SpillPoints();
     return false;
+  }
 
-  m_wasConnected = m_realtimeSender.Send(m_points);
+  m_reconnectDelaySeconds = kMinReconnectDelaySeconds;
+  m_wasConnected = SendFrames();
   return m_wasConnected;
 }
+
+bool Reporter::SendFrames()
+{
+  vector<DataPoint> frame;
+
+  // The backlog spilled during an outage goes first to preserve the
+  // chronological order of points on the server.
+  vector<DataPoint> backlog;
+  m_spillQueue.TakeAll(backlog);
+  for (size_t sent = 0; sent < backlog.size();)
+  {
+    size_t const frameSize = min(kMaxPointsPerFrame, backlog.size() - sent);
+    frame.assign(backlog.begin() + sent, backlog.begin() + sent + frameSize);
+    if (!m_realtimeSender.Send(frame))
+    {
+      // Return the unsent remainder to the disk queue.
+      m_spillQueue.Append(vector<DataPoint>(backlog.begin() + sent, backlog.end()));
+      return false;
+    }
+    sent += frameSize;
+  }
+
+  while (!m_points.empty())
+  {
+    size_t const frameSize = min(kMaxPointsPerFrame, m_points.size());
+    frame.assign(m_points.begin(), m_points.begin() + frameSize);
+    if (!m_realtimeSender.Send(frame))
+      return false;
+    m_points.erase_begin(frameSize);
+  }
+
+  return true;
+}
+
+void Reporter::SpillPoints()
+{
+  if (m_points.empty())
+    return;
+
+  vector<DataPoint> points(m_points.begin(), m_points.end());
+  if (m_spillQueue.Append(points))
+    m_points.clear();
+  // Otherwise the points stay in the memory buffer and the oldest ones
+  // are overwritten once it is full, as before.
+}
 }  // namespace tracking
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "tracking/connection.hpp"
+#include "tracking/spill_queue.hpp"
 
 #include "traffic/speed_groups.hpp"
 
@@ -48,12 +49,24 @@ public:
 private:
   void Run();
   bool SendPoints();
+  // Sends the spilled backlog and then the collected points in frames
+  // of at most kMaxPointsPerFrame. Returns false on the first failed
+  // write; the unsent points stay queued.
+  bool SendFrames();
+  // Moves the collected points to the on-disk queue so that they
+  // survive an outage (and a restart) instead of being overwritten in
+  // the small memory buffer.
+  void SpillPoints();
 
   atomic<bool> m_allowSendingPoints;
   Connection m_realtimeSender;
   milliseconds m_pushDelay;
   bool m_wasConnected = false;
   double m_lastConnectionAttempt = 0.0;
+  // Delay before the next reconnection attempt. Doubles after every
+  // failed attempt up to a cap and resets on success, so a flaky link
+  // is not hammered.
+  double m_reconnectDelaySeconds;
   // Function to be called every |kPushDelayMs| in
   // case no points were sent.
   function<void()> m_idleFn;
@@ -61,6 +74,8 @@ private:
   vector<DataPoint> m_input;
   // Last collected points, sends periodically to server.
   boost::circular_buffer<DataPoint> m_points;
+  // Points spilled to disk while the connection was down.
+  SpillQueue m_spillQueue;
   double m_lastGpsTime = 0.0;
   bool m_isFinished = false;
   mutex m_mutex;
@@ -0,0 +1,89 @@
+#include "tracking/spill_queue.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/internal/file_data.hpp"
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+#include "coding/writer.hpp"
+
+#include "base/exception.hpp"
+#include "base/logging.hpp"
+
+namespace tracking
+{
+SpillQueue::SpillQueue(string const & filePath, uint64_t maxFileSize)
+  : m_filePath(filePath), m_maxFileSize(maxFileSize)
+{
+  if (m_filePath.empty() || !my::GetFileSize(m_filePath, m_fileSize))
+    m_fileSize = 0;
+}
+
+bool SpillQueue::Append(vector<DataPoint> const & points)
+{
+  if (points.empty())
+    return true;
+
+  if (m_filePath.empty() || m_fileSize >= m_maxFileSize)
+    return false;
+
+  // A record is the payload size followed by the points in the wire
+  // format (coding::TrafficGPSEncoder); the size is needed because the
+  // decoder consumes its source to the end.
+  vector<uint8_t> payload;
+  MemWriter<decltype(payload)> memWriter(payload);
+  coding::TrafficGPSEncoder::SerializeDataPoints(coding::TrafficGPSEncoder::kLatestVersion,
+                                                 memWriter, points);
+
+  try
+  {
+    FileWriter writer(m_filePath, FileWriter::OP_APPEND);
+    WriteVarUint(writer, static_cast<uint64_t>(payload.size()));
+    writer.Write(payload.data(), payload.size());
+    m_fileSize = writer.Size();
+  }
+  catch (RootException const & e)
+  {
+    LOG(LWARNING, ("Could not spill tracking points to disk:", e.Msg()));
+    return false;
+  }
+
+  return true;
+}
+
+void SpillQueue::TakeAll(vector<DataPoint> & result)
+{
+  if (IsEmpty())
+    return;
+
+  try
+  {
+    FileReader reader(m_filePath);
+    ReaderSource<FileReader> src(reader);
+    while (src.Size() > 0)
+    {
+      auto const payloadSize = static_cast<size_t>(ReadVarUint<uint64_t>(src));
+      vector<uint8_t> payload(payloadSize);
+      src.Read(payload.data(), payload.size());
+
+      MemReader memReader(payload.data(), payload.size());
+      ReaderSource<MemReader> payloadSrc(memReader);
+      coding::TrafficGPSEncoder::DeserializeDataPoints(coding::TrafficGPSEncoder::kLatestVersion,
+                                                       payloadSrc, result);
+    }
+  }
+  catch (RootException const & e)
+  {
+    LOG(LWARNING, ("Could not read spilled tracking points:", e.Msg()));
+  }
+
+  Clear();
+}
+
+void SpillQueue::Clear()
+{
+  if (m_fileSize != 0)
+    my::DeleteFileX(m_filePath);
+  m_fileSize = 0;
+}
+}  // namespace tracking
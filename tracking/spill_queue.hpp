@@ -0,0 +1,43 @@
+#pragma once
+
+#include "coding/traffic.hpp"
+
+#include "std/cstdint.hpp"
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+namespace tracking
+{
+// A small bounded on-disk queue for GPS points that could not be sent
+// because of a network outage. Points are appended in the same
+// delta-encoded format that is used on the wire and are read back (and
+// the file is removed) when the connection is restored.
+// Not thread safe: all methods must be called from the reporter's
+// worker thread.
+class SpillQueue final
+{
+public:
+  using DataPoint = coding::TrafficGPSEncoder::DataPoint;
+
+  // |filePath| may be empty; such a queue stays empty and rejects all
+  // appends. The file is never grown past |maxFileSize|.
+  SpillQueue(string const & filePath, uint64_t maxFileSize);
+
+  // Appends |points| to the queue. Returns false if the queue is
+  // disabled, full or the write failed; the caller keeps the points.
+  bool Append(vector<DataPoint> const & points);
+
+  // Moves all queued points to the end of |result| in the order they
+  // were appended and empties the queue.
+  void TakeAll(vector<DataPoint> & result);
+
+  void Clear();
+
+  bool IsEmpty() const { return m_fileSize == 0; }
+
+private:
+  string const m_filePath;
+  uint64_t const m_maxFileSize;
+  uint64_t m_fileSize = 0;
+};
+}  // namespace tracking
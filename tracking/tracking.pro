@@ -10,8 +10,10 @@ SOURCES += \
     connection.cpp \
     protocol.cpp \
     reporter.cpp \
+    spill_queue.cpp \
 
 HEADERS += \
     connection.hpp \
     protocol.hpp \
     reporter.hpp \
+    spill_queue.hpp \
@@ -0,0 +1,84 @@
+#include "testing/testing.hpp"
+
+#include "tracking/spill_queue.hpp"
+
+#include "platform/platform.hpp"
+
+#include "base/math.hpp"
+#include "base/scope_guard.hpp"
+
+#include "std/vector.hpp"
+
+using namespace tracking;
+
+namespace
+{
+using DataPoint = SpillQueue::DataPoint;
+
+DataPoint MakePoint(uint64_t timestamp, double lat, double lon)
+{
+  return DataPoint(timestamp, ms::LatLon(lat, lon), 0 /* traffic */);
+}
+
+void TestPointsEqual(vector<DataPoint> const & lhs, vector<DataPoint> const & rhs)
+{
+  TEST_EQUAL(lhs.size(), rhs.size(), ());
+  for (size_t i = 0; i < lhs.size(); ++i)
+  {
+    TEST_EQUAL(lhs[i].m_timestamp, rhs[i].m_timestamp, ());
+    TEST(my::AlmostEqualAbs(lhs[i].m_latLon.lat, rhs[i].m_latLon.lat, 0.001), ());
+    TEST(my::AlmostEqualAbs(lhs[i].m_latLon.lon, rhs[i].m_latLon.lon, 0.001), ());
+  }
+}
+}  // namespace
+
+UNIT_TEST(SpillQueue_Smoke)
+{
+  string const filePath = GetPlatform().WritablePathForFile("spill_queue_test.bin");
+  MY_SCOPE_GUARD(cleanup, [&filePath] { SpillQueue(filePath, 0 /* maxFileSize */).Clear(); });
+
+  SpillQueue queue(filePath, 1024 * 1024 /* maxFileSize */);
+  queue.Clear();
+  TEST(queue.IsEmpty(), ());
+
+  vector<DataPoint> const points1 = {MakePoint(1, 2.0, 3.0), MakePoint(4, 2.0001, 3.0001)};
+  vector<DataPoint> const points2 = {MakePoint(7, 2.0002, 3.0002)};
+
+  TEST(queue.Append(points1), ());
+  TEST(queue.Append(points2), ());
+  TEST(!queue.IsEmpty(), ());
+
+  // The queue survives a restart.
+  SpillQueue reopened(filePath, 1024 * 1024 /* maxFileSize */);
+  TEST(!reopened.IsEmpty(), ());
+
+  vector<DataPoint> result;
+  reopened.TakeAll(result);
+  TEST(reopened.IsEmpty(), ());
+
+  vector<DataPoint> expected = points1;
+  expected.insert(expected.end(), points2.begin(), points2.end());
+  TestPointsEqual(result, expected);
+}
+
+UNIT_TEST(SpillQueue_Bounds)
+{
+  // A disabled queue rejects appends.
+  SpillQueue disabled("" /* filePath */, 1024 /* maxFileSize */);
+  TEST(!disabled.Append({MakePoint(1, 2.0, 3.0)}), ());
+  TEST(disabled.IsEmpty(), ());
+
+  string const filePath = GetPlatform().WritablePathForFile("spill_queue_test.bin");
+  MY_SCOPE_GUARD(cleanup, [&filePath] { SpillQueue(filePath, 0 /* maxFileSize */).Clear(); });
+
+  // A full queue rejects appends; the already queued points are kept.
+  SpillQueue queue(filePath, 1 /* maxFileSize */);
+  queue.Clear();
+  vector<DataPoint> const points = {MakePoint(1, 2.0, 3.0)};
+  TEST(queue.Append(points), ());
+  TEST(!queue.Append(points), ());
+
+  vector<DataPoint> result;
+  queue.TakeAll(result);
+  TestPointsEqual(result, points);
+}
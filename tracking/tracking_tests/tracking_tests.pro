@@ -28,3 +28,4 @@ SOURCES += \
     $$ROOT_DIR/testing/testingmain.cpp \
     protocol_test.cpp \
     reporter_test.cpp \
+    spill_queue_test.cpp \
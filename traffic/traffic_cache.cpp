@@ -1,30 +1,67 @@
 #include "traffic/traffic_cache.hpp"
 
+#include "std/target_os.hpp"
+
+#include <atomic>
+
 namespace traffic
 {
 using namespace std;
 
+TrafficCache::TrafficCache() : m_trafficColoring(make_shared<ColoringMap>()) {}
+
 void TrafficCache::Set(MwmSet::MwmId const & mwmId, TrafficInfo::Coloring && coloring)
 {
-  m_trafficColoring[mwmId] = make_shared<TrafficInfo::Coloring>(move(coloring));
+  lock_guard<mutex> lock(m_mutex);
+  // Copy-on-write: the map holds shared pointers, so copying it copies a
+  // handful of pointers, not the colorings themselves.
+  auto updated = make_shared<ColoringMap>(*m_trafficColoring);
+  (*updated)[mwmId] = make_shared<TrafficInfo::Coloring>(move(coloring));
+  Publish(move(updated));
 }
 
-void TrafficCache::Remove(MwmSet::MwmId const & mwmId) { m_trafficColoring.erase(mwmId); }
+void TrafficCache::Remove(MwmSet::MwmId const & mwmId)
+{
+  lock_guard<mutex> lock(m_mutex);
+  auto updated = make_shared<ColoringMap>(*m_trafficColoring);
+  updated->erase(mwmId);
+  Publish(move(updated));
+}
 
 shared_ptr<TrafficInfo::Coloring> TrafficCache::GetTrafficInfo(MwmSet::MwmId const & mwmId) const
 {
-  auto it = m_trafficColoring.find(mwmId);
+  auto const coloring = GetTrafficSnapshot();
+  auto const it = coloring->find(mwmId);
 
-  if (it == m_trafficColoring.cend())
+  if (it == coloring->cend())
     return shared_ptr<TrafficInfo::Coloring>();
   return it->second;
 }
 
-void TrafficCache::CopyTraffic(
-    map<MwmSet::MwmId, shared_ptr<traffic::TrafficInfo::Coloring>> & trafficColoring) const
+shared_ptr<TrafficCache::ColoringMap const> TrafficCache::GetTrafficSnapshot() const
 {
-  trafficColoring = m_trafficColoring;
+#if !defined(OMIM_OS_LINUX)
+  return atomic_load(&m_trafficColoring);
+#else
+  lock_guard<mutex> lock(m_mutex);
+  return m_trafficColoring;
+#endif
 }
 
-void TrafficCache::Clear() { m_trafficColoring.clear(); }
+void TrafficCache::Publish(shared_ptr<ColoringMap const> coloring)
+{
+  // Writers already hold m_mutex here; the atomic store pairs with the
+  // lock-free load in GetTrafficSnapshot.
+#if !defined(OMIM_OS_LINUX)
+  atomic_store(&m_trafficColoring, shared_ptr<ColoringMap const>(move(coloring)));
+#else
+  m_trafficColoring = move(coloring);
+#endif
+}
+
+void TrafficCache::Clear()
+{
+  lock_guard<mutex> lock(m_mutex);
+  Publish(make_shared<ColoringMap>());
+}
 }  // namespace traffic
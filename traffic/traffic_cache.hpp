@@ -6,20 +6,26 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace traffic
 {
 class TrafficCache
 {
 public:
-  TrafficCache() : m_trafficColoring() {}
+  using ColoringMap = std::map<MwmSet::MwmId, std::shared_ptr<TrafficInfo::Coloring>>;
+
+  TrafficCache();
   virtual ~TrafficCache() = default;
 
   virtual shared_ptr<traffic::TrafficInfo::Coloring> GetTrafficInfo(
       MwmSet::MwmId const & mwmId) const;
-  virtual void CopyTraffic(
-      std::map<MwmSet::MwmId, std::shared_ptr<traffic::TrafficInfo::Coloring>> & trafficColoring)
-      const;
+
+  // Returns the current immutable snapshot of all mwm colorings. Readers
+  // share the snapshot instead of copying the map; an update publishes a
+  // whole new snapshot, so the returned object never changes under the
+  // caller.
+  virtual std::shared_ptr<ColoringMap const> GetTrafficSnapshot() const;
 
 protected:
   void Set(MwmSet::MwmId const & mwmId, TrafficInfo::Coloring && mwmIdAndColoring);
@@ -27,6 +33,11 @@ protected:
   void Clear();
 
 private:
-  std::map<MwmSet::MwmId, std::shared_ptr<traffic::TrafficInfo::Coloring>> m_trafficColoring;
+  void Publish(std::shared_ptr<ColoringMap const> coloring);
+
+  // Serializes writers (the traffic updater thread); readers on the router
+  // and rendering threads only load the snapshot pointer.
+  mutable std::mutex m_mutex;
+  std::shared_ptr<ColoringMap const> m_trafficColoring;
 };
 }  // namespace traffic
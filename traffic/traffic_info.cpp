@@ -76,6 +76,13 @@ string MakeRemoteURL(string const & name, uint64_t version)
 }
 
 char const kETag[] = "etag";
+
+// A client that already has values for the etag it sends advertises delta
+// support with this request header; a server that can serve a delta against
+// that etag marks the response with the same header (lowercased in the
+// parsed response headers, like "etag" above).
+char const kTrafficDeltaHeader[] = "X-Traffic-Delta";
+char const kTrafficDeltaResponseHeader[] = "x-traffic-delta";
 }  // namespace
 
 // TrafficInfo::RoadSegmentId -----------------------------------------------------------------
@@ -91,6 +98,7 @@ TrafficInfo::RoadSegmentId::RoadSegmentId(uint32_t fid, uint16_t idx, uint8_t di
 // static
 uint8_t const TrafficInfo::kLatestKeysVersion = 0;
 uint8_t const TrafficInfo::kLatestValuesVersion = 0;
+uint8_t const TrafficInfo::kLatestDeltasVersion = 0;
 
 TrafficInfo::TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion)
   : m_mwmId(mwmId)
@@ -143,7 +151,14 @@ TrafficInfo::TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion
 TrafficInfo TrafficInfo::BuildForTesting(Coloring && coloring)
 {
   TrafficInfo info;
-  info.m_coloring = move(coloring);
+  for (auto const & kv : coloring)
+  {
+    info.m_keys.push_back(kv.first);
+    info.m_values.push_back(kv.second);
+    if (kv.second != SpeedGroup::Unknown)
+      ++info.m_numColoredSegments;
+  }
+  info.m_hasSnapshot = true;
   return info;
 }
 
@@ -154,12 +169,29 @@ void TrafficInfo::SetTrafficKeysForTesting(vector<RoadSegmentId> const & keys)
 }
 
 bool TrafficInfo::ReceiveTrafficData(string & etag)
+{
+  coding::ZLib::Inflater inflater;
+  return ReceiveTrafficData(etag, inflater);
+}
+
+bool TrafficInfo::ReceiveTrafficData(string & etag, coding::ZLib::Inflater & inflater)
 {
   vector<SpeedGroup> values;
-  switch (ReceiveTrafficValues(etag, values))
+  switch (ReceiveTrafficValues(etag, values, inflater))
   {
   case ServerDataStatus::New:
     return UpdateTrafficData(values);
+  case ServerDataStatus::NewDelta:
+    return true;
+  case ServerDataStatus::DeltaFailed:
+  {
+    // Full-snapshot fallback: without an etag the server can respond
+    // neither with 304 nor with a delta.
+    etag.clear();
+    if (ReceiveTrafficValues(etag, values, inflater) != ServerDataStatus::New)
+      return false;
+    return UpdateTrafficData(values);
+  }
   case ServerDataStatus::NotChanged:
     return true;
   case ServerDataStatus::NotFound:
@@ -171,10 +203,14 @@ bool TrafficInfo::ReceiveTrafficData(string & etag)
 
 SpeedGroup TrafficInfo::GetSpeedGroup(RoadSegmentId const & id) const
 {
-  auto const it = m_coloring.find(id);
-  if (it == m_coloring.cend())
+  // m_keys is sorted, m_values is parallel to it.
+  auto const it = lower_bound(m_keys.begin(), m_keys.end(), id);
+  if (it == m_keys.end() || !(*it == id))
     return SpeedGroup::Unknown;
-  return it->second;
+  auto const index = static_cast<size_t>(distance(m_keys.begin(), it));
+  if (index >= m_values.size())
+    return SpeedGroup::Unknown;
+  return m_values[index];
 }
 
 // static
@@ -367,9 +403,18 @@ void TrafficInfo::SerializeTrafficValues(vector<SpeedGroup> const & values,
 // static
 void TrafficInfo::DeserializeTrafficValues(vector<uint8_t> const & data,
                                            vector<SpeedGroup> & result)
+{
+  coding::ZLib::Inflater inflater;
+  DeserializeTrafficValues(data, result, inflater);
+}
+
+// static
+void TrafficInfo::DeserializeTrafficValues(vector<uint8_t> const & data,
+                                           vector<SpeedGroup> & result,
+                                           coding::ZLib::Inflater & inflater)
 {
   vector<uint8_t> decompressedData;
-  coding::ZLib::Inflate(data.data(), data.size(), back_inserter(decompressedData));
+  inflater.Inflate(data.data(), data.size(), decompressedData);
 
   MemReaderWithExceptions memReader(decompressedData.data(), decompressedData.size());
   ReaderSource<decltype(memReader)> src(memReader);
@@ -389,6 +434,82 @@ void TrafficInfo::DeserializeTrafficValues(vector<uint8_t> const & data,
   ASSERT_EQUAL(src.Size(), 0, ());
 }
 
+// static
+void TrafficInfo::SerializeTrafficDeltas(vector<SegmentDelta> const & deltas,
+                                         vector<uint8_t> & result)
+{
+  vector<uint8_t> buf;
+  MemWriter<vector<uint8_t>> memWriter(buf);
+  WriteToSink(memWriter, kLatestDeltasVersion);
+  WriteVarUint(memWriter, deltas.size());
+  {
+    BitWriter<decltype(memWriter)> bitWriter(memWriter);
+
+    uint32_t prevIndex = 0;
+    for (auto const & delta : deltas)
+    {
+      uint64_t const indexDiff = static_cast<uint64_t>(delta.first - prevIndex);
+      bool const ok = coding::GammaCoder::Encode(bitWriter, indexDiff + 1);
+      ASSERT(ok, ());
+      UNUSED_VALUE(ok);
+      prevIndex = delta.first;
+    }
+
+    auto const numSpeedGroups = static_cast<uint8_t>(SpeedGroup::Count);
+    for (auto const & delta : deltas)
+    {
+      uint8_t const u = static_cast<uint8_t>(delta.second);
+      CHECK_LESS(u, numSpeedGroups, ());
+      bitWriter.Write(u, 3);
+    }
+  }
+
+  coding::ZLib::Deflate(buf.data(), buf.size(), coding::ZLib::Level::BestCompression,
+                        back_inserter(result));
+}
+
+// static
+void TrafficInfo::DeserializeTrafficDeltas(vector<uint8_t> const & data,
+                                           vector<SegmentDelta> & result)
+{
+  coding::ZLib::Inflater inflater;
+  DeserializeTrafficDeltas(data, result, inflater);
+}
+
+// static
+void TrafficInfo::DeserializeTrafficDeltas(vector<uint8_t> const & data,
+                                           vector<SegmentDelta> & result,
+                                           coding::ZLib::Inflater & inflater)
+{
+  vector<uint8_t> decompressedData;
+  inflater.Inflate(data.data(), data.size(), decompressedData);
+
+  MemReaderWithExceptions memReader(decompressedData.data(), decompressedData.size());
+  ReaderSource<decltype(memReader)> src(memReader);
+
+  auto const version = ReadPrimitiveFromSource<uint8_t>(src);
+  CHECK_EQUAL(version, kLatestDeltasVersion, ("Unsupported version of traffic deltas."));
+
+  auto const n = ReadVarUint<uint32_t>(src);
+  result.resize(n);
+  BitReader<decltype(src)> bitReader(src);
+
+  uint32_t prevIndex = 0;
+  for (size_t i = 0; i < static_cast<size_t>(n); ++i)
+  {
+    prevIndex += coding::GammaCoder::Decode(bitReader) - 1;
+    result[i].first = prevIndex;
+  }
+
+  for (size_t i = 0; i < static_cast<size_t>(n); ++i)
+  {
+    // SpeedGroup's values fit into 3 bits.
+    result[i].second = static_cast<SpeedGroup>(bitReader.Read(3));
+  }
+
+  ASSERT_EQUAL(src.Size(), 0, ());
+}
+
 // todo(@m) This is a temporary method. Do not refactor it.
 bool TrafficInfo::ReceiveTrafficKeys()
 {
@@ -428,7 +549,9 @@ bool TrafficInfo::ReceiveTrafficKeys()
   return true;
 }
 
-TrafficInfo::ServerDataStatus TrafficInfo::ReceiveTrafficValues(string & etag, vector<SpeedGroup> & values)
+TrafficInfo::ServerDataStatus TrafficInfo::ReceiveTrafficValues(string & etag,
+                                                                vector<SpeedGroup> & values,
+                                                                coding::ZLib::Inflater & inflater)
 {
   if (!m_mwmId.IsAlive())
     return ServerDataStatus::Error;
@@ -446,17 +569,42 @@ TrafficInfo::ServerDataStatus TrafficInfo::ReceiveTrafficValues(string & etag, v
   platform::HttpClient request(url);
   request.LoadHeaders(true);
   request.SetRawHeader("If-None-Match", etag);
+  // Advertise that a delta against the values identified by |etag| can be
+  // applied instead of a full snapshot.
+  if (!etag.empty() && m_hasSnapshot)
+    request.SetRawHeader(kTrafficDeltaHeader, "1");
 
   if (!request.RunHttpRequest() || request.ErrorCode() != 200)
     return ProcessFailure(request, version);
+
+  auto const & headers = request.GetHeaders();
+  bool const isDelta = headers.find(kTrafficDeltaResponseHeader) != headers.end();
+
   try
   {
     string const & response = request.ServerResponse();
     vector<uint8_t> contents(response.cbegin(), response.cend());
-    DeserializeTrafficValues(contents, values);
+    if (isDelta)
+    {
+      vector<SegmentDelta> deltas;
+      DeserializeTrafficDeltas(contents, deltas, inflater);
+      if (!ApplyTrafficDeltas(deltas))
+        return ServerDataStatus::DeltaFailed;
+    }
+    else
+    {
+      DeserializeTrafficValues(contents, values, inflater);
+    }
   }
   catch (Reader::Exception const & e)
   {
+    if (isDelta)
+    {
+      LOG(LWARNING, ("Could not read traffic delta received from server. MWM:",
+                     info->GetCountryName(), "Version:", info->GetVersion()));
+      return ServerDataStatus::DeltaFailed;
+    }
+
     m_availability = Availability::NoData;
     LOG(LWARNING, ("Could not read traffic values received from server. MWM:",
                    info->GetCountryName(), "Version:", info->GetVersion()));
@@ -469,18 +617,18 @@ TrafficInfo::ServerDataStatus TrafficInfo::ReceiveTrafficValues(string & etag, v
     return ServerDataStatus::Error;
   }
   // Update ETag for this MWM.
-  auto const & headers = request.GetHeaders();
   auto const it = headers.find(kETag);
   if (it != headers.end())
     etag = it->second;
 
   m_availability = Availability::IsAvailable;
-  return ServerDataStatus::New;
+  return isDelta ? ServerDataStatus::NewDelta : ServerDataStatus::New;
 }
 
 bool TrafficInfo::UpdateTrafficData(vector<SpeedGroup> const & values)
 {
-  m_coloring.clear();
+  m_values.clear();
+  m_numColoredSegments = 0;
 
   if (m_keys.size() != values.size())
   {
@@ -495,12 +643,47 @@ bool TrafficInfo::UpdateTrafficData(vector<SpeedGroup> const & values)
     return false;
   }
 
-  for (size_t i = 0; i < m_keys.size(); ++i)
+  m_values = values;
+  for (auto const & v : m_values)
+  {
+    if (v != SpeedGroup::Unknown)
+      ++m_numColoredSegments;
+  }
+
+  m_hasSnapshot = true;
+  return true;
+}
+
+bool TrafficInfo::ApplyTrafficDeltas(vector<SegmentDelta> const & deltas)
+{
+  if (!m_hasSnapshot)
+  {
+    LOG(LWARNING, ("Received a traffic delta without a base snapshot."));
+    return false;
+  }
+
+  // Validate the whole delta before patching anything.
+  for (auto const & delta : deltas)
+  {
+    if (delta.first >= m_values.size())
+    {
+      LOG(LWARNING, ("A traffic delta refers to the nonexistent segment", delta.first,
+                     "of", m_values.size()));
+      return false;
+    }
+  }
+
+  for (auto const & delta : deltas)
   {
-    if (values[i] != SpeedGroup::Unknown)
-      m_coloring.emplace(m_keys[i], values[i]);
+    SpeedGroup & value = m_values[delta.first];
+    if (value != SpeedGroup::Unknown)
+      --m_numColoredSegments;
+    value = delta.second;
+    if (value != SpeedGroup::Unknown)
+      ++m_numColoredSegments;
   }
 
+  LOG(LINFO, ("Applied a traffic delta of", deltas.size(), "segments."));
   return true;
 }
 
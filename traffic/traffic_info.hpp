@@ -4,6 +4,8 @@
 
 #include "indexer/mwm_set.hpp"
 
+#include "coding/zlib.hpp"
+
 #include "std/cstdint.hpp"
 #include "std/map.hpp"
 #include "std/shared_ptr.hpp"
@@ -24,6 +26,7 @@ class TrafficInfo
 public:
   static uint8_t const kLatestKeysVersion;
   static uint8_t const kLatestValuesVersion;
+  static uint8_t const kLatestDeltasVersion;
 
   enum class Availability
   {
@@ -73,9 +76,18 @@ public:
     uint8_t m_dir : 1;
   };
 
-  // todo(@m) unordered_map?
+  // A coloring in the map form. Used for transient copies (the routing
+  // cache, the rendering engine) and for tests; the resident storage
+  // inside TrafficInfo is a plain SpeedGroup array parallel to the
+  // sorted keys vector, which is an order of magnitude smaller.
   using Coloring = map<RoadSegmentId, SpeedGroup>;
 
+  // A single change against a previously received values snapshot: the
+  // index of the changed segment in the sorted keys vector and its new
+  // speed group. The keys do not change during an mwm's lifetime, so
+  // both sides of the protocol agree on the indexing.
+  using SegmentDelta = pair<uint32_t, SpeedGroup>;
+
   TrafficInfo() = default;
 
   TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion);
@@ -88,17 +100,42 @@ public:
   // The ETag or entity tag is part of HTTP, the protocol for the World Wide Web.
   // It is one of several mechanisms that HTTP provides for web cache validation,
   // which allows a client to make conditional requests.
+  // A client that already has values for some etag also advertises delta
+  // support; the server may then respond with the changed segments only
+  // (see SerializeTrafficDeltas) instead of a full snapshot, and the
+  // coloring is patched in place. If a delta cannot be applied, a full
+  // snapshot is requested instead.
   // *NOTE* This method must not be called on the UI thread.
   bool ReceiveTrafficData(string & etag);
 
+  // Same as above but reuses |inflater| for the payload decompression;
+  // callers polling many mwms in a loop should share one inflater.
+  bool ReceiveTrafficData(string & etag, coding::ZLib::Inflater & inflater);
+
   // Returns the latest known speed group by a feature segment's id
   // or SpeedGroup::Unknown if there is no information about the segment.
   SpeedGroup GetSpeedGroup(RoadSegmentId const & id) const;
 
   MwmSet::MwmId const & GetMwmId() const { return m_mwmId; }
-  Coloring const & GetColoring() const { return m_coloring; }
   Availability GetAvailability() const { return m_availability; }
 
+  // Returns the number of segments whose speed group is known, i.e. the
+  // size the coloring map would have.
+  size_t GetNumColoredSegments() const { return m_numColoredSegments; }
+
+  // Calls |toDo| with (RoadSegmentId const &, SpeedGroup) for every
+  // segment whose speed group is known, in the increasing order of keys.
+  template <typename ToDo>
+  void ForEachColoredSegment(ToDo && toDo) const
+  {
+    ASSERT(m_values.empty() || m_values.size() == m_keys.size(), ());
+    for (size_t i = 0; i < m_values.size(); ++i)
+    {
+      if (m_values[i] != SpeedGroup::Unknown)
+        toDo(m_keys[i], m_values[i]);
+    }
+  }
+
   // Extracts RoadSegmentIds from mwm and stores them in a sorted order.
   static void ExtractTrafficKeys(string const & mwmPath, vector<RoadSegmentId> & result);
 
@@ -120,43 +157,79 @@ public:
 
   static void DeserializeTrafficValues(vector<uint8_t> const & data, vector<SpeedGroup> & result);
 
+  static void DeserializeTrafficValues(vector<uint8_t> const & data, vector<SpeedGroup> & result,
+                                       coding::ZLib::Inflater & inflater);
+
+  // Serializes |deltas| (sorted by segment index) in the same manner as
+  // the values: gamma-coded index diffs plus 3 bits per speed group,
+  // compressed with zlib. A minute-to-minute delta is a small fraction
+  // of a full snapshot.
+  static void SerializeTrafficDeltas(vector<SegmentDelta> const & deltas, vector<uint8_t> & result);
+
+  static void DeserializeTrafficDeltas(vector<uint8_t> const & data, vector<SegmentDelta> & result);
+
+  static void DeserializeTrafficDeltas(vector<uint8_t> const & data, vector<SegmentDelta> & result,
+                                       coding::ZLib::Inflater & inflater);
+
 private:
   enum class ServerDataStatus
   {
     New,
+    // The response was a delta against the values identified by the etag
+    // the client sent; the coloring has already been patched in place.
+    NewDelta,
+    // The response was a delta that could not be applied; the caller
+    // should fall back to requesting a full snapshot.
+    DeltaFailed,
     NotChanged,
     NotFound,
     Error,
   };
 
   friend void UnitTest_TrafficInfo_UpdateTrafficData();
+  friend void UnitTest_TrafficInfo_ApplyTrafficDeltas();
 
   // todo(@m) A temporary method. Remove it once the keys are added
   // to the generator and the data is regenerated.
   bool ReceiveTrafficKeys();
 
-  // Tries to read the values of the Coloring map from server into |values|.
+  // Tries to read the speed group values from server into |values|.
   // Returns result of communicating with server as ServerDataStatus.
-  // Otherwise, returns false and does not change m_coloring.
-  ServerDataStatus ReceiveTrafficValues(string & etag, vector<SpeedGroup> & values);
+  ServerDataStatus ReceiveTrafficValues(string & etag, vector<SpeedGroup> & values,
+                                        coding::ZLib::Inflater & inflater);
 
   // Updates the coloring and changes the availability status if needed.
   bool UpdateTrafficData(vector<SpeedGroup> const & values);
 
-  ServerDataStatus ProcessFailure(platform::HttpClient const & request, int64_t const mwmVersion);
+  // Patches the coloring in place with |deltas|. Returns false (leaving
+  // the coloring untouched) if there is no base snapshot to patch or a
+  // delta refers to a nonexistent segment.
+  bool ApplyTrafficDeltas(vector<SegmentDelta> const & deltas);
 
-  // The mapping from feature segments to speed groups (see speed_groups.hpp).
-  Coloring m_coloring;
+  ServerDataStatus ProcessFailure(platform::HttpClient const & request, int64_t const mwmVersion);
 
-  // The keys of the coloring map. The values are downloaded periodically
-  // and combined with the keys to form m_coloring.
+  // The road segment keys, sorted. They are static per mwm version, so
+  // they are read once and shared between updates.
   // *NOTE* The values must be received in the exact same order that the
   // keys are saved in.
   vector<RoadSegmentId> m_keys;
 
+  // The speed group of m_keys[i] is m_values[i]. One byte per segment
+  // instead of a map node keeps a metropolis-sized mwm's coloring small
+  // enough to hold many mwms live at once.
+  vector<SpeedGroup> m_values;
+
+  // The number of entries of m_values that are not SpeedGroup::Unknown.
+  size_t m_numColoredSegments = 0;
+
   MwmSet::MwmId m_mwmId;
   Availability m_availability = Availability::Unknown;
   int64_t m_currentDataVersion = 0;
+
+  // True once a full values snapshot has been applied; deltas may only
+  // be applied on top of one. Note that an mwm may have no keys at all,
+  // so an empty m_values is not a substitute for this flag.
+  bool m_hasSnapshot = false;
 };
 
 class TrafficObserver
@@ -131,11 +131,69 @@ UNIT_TEST(TrafficInfo_UpdateTrafficData)
   info.SetTrafficKeysForTesting(keys);
 
   TEST(info.UpdateTrafficData(values1), ());
+  TEST_EQUAL(info.GetNumColoredSegments(), 3, ());
   for (size_t i = 0; i < keys.size(); ++i)
     TEST_EQUAL(info.GetSpeedGroup(keys[i]), values1[i], ());
 
   TEST(info.UpdateTrafficData(values2), ());
+  TEST_EQUAL(info.GetNumColoredSegments(), 2, ());
   for (size_t i = 0; i < keys.size(); ++i)
     TEST_EQUAL(info.GetSpeedGroup(keys[i]), values2[i], ());
+
+  // ForEachColoredSegment enumerates the known segments in key order.
+  TrafficInfo::Coloring coloring;
+  info.ForEachColoredSegment(
+      [&coloring](TrafficInfo::RoadSegmentId const & id, SpeedGroup group) {
+        coloring.emplace(id, group);
+      });
+  TrafficInfo::Coloring const expected = {
+      {keys[0], SpeedGroup::G4}, {keys[1], SpeedGroup::G5},
+  };
+  TEST_EQUAL(coloring, expected, ());
+}
+
+UNIT_TEST(TrafficInfo_ApplyTrafficDeltas)
+{
+  vector<TrafficInfo::RoadSegmentId> const keys = {
+      TrafficInfo::RoadSegmentId(0, 0, 0),
+
+      TrafficInfo::RoadSegmentId(1, 0, 0), TrafficInfo::RoadSegmentId(1, 0, 1),
+
+      TrafficInfo::RoadSegmentId(5, 0, 0),
+  };
+
+  vector<SpeedGroup> const values = {
+      SpeedGroup::G1, SpeedGroup::G2, SpeedGroup::G3, SpeedGroup::Unknown,
+  };
+
+  vector<TrafficInfo::SegmentDelta> const deltas = {
+      {0, SpeedGroup::G4}, {2, SpeedGroup::Unknown}, {3, SpeedGroup::TempBlock},
+  };
+
+  // Deltas survive a serialization round trip.
+  vector<uint8_t> buf;
+  TrafficInfo::SerializeTrafficDeltas(deltas, buf);
+  vector<TrafficInfo::SegmentDelta> deserializedDeltas;
+  TrafficInfo::DeserializeTrafficDeltas(buf, deserializedDeltas);
+  TEST_EQUAL(deltas, deserializedDeltas, ());
+
+  TrafficInfo info;
+  info.SetTrafficKeysForTesting(keys);
+
+  // A delta may not be applied before a full snapshot.
+  TEST(!info.ApplyTrafficDeltas(deltas), ());
+
+  TEST(info.UpdateTrafficData(values), ());
+  TEST(info.ApplyTrafficDeltas(deserializedDeltas), ());
+  TEST_EQUAL(info.GetNumColoredSegments(), 3, ());
+
+  TEST_EQUAL(info.GetSpeedGroup(keys[0]), SpeedGroup::G4, ());
+  TEST_EQUAL(info.GetSpeedGroup(keys[1]), SpeedGroup::G2, ());
+  TEST_EQUAL(info.GetSpeedGroup(keys[2]), SpeedGroup::Unknown, ());
+  TEST_EQUAL(info.GetSpeedGroup(keys[3]), SpeedGroup::TempBlock, ());
+
+  // A delta referring to a nonexistent segment is rejected whole.
+  TEST(!info.ApplyTrafficDeltas({{static_cast<uint32_t>(keys.size()), SpeedGroup::G0}}), ());
+  TEST_EQUAL(info.GetSpeedGroup(keys[0]), SpeedGroup::G4, ());
 }
 }  // namespace traffic